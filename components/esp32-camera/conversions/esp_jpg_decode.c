@@ -13,21 +13,31 @@
 // limitations under the License.
 #include "esp_jpg_decode.h"
 
+#include <stdlib.h>
 #include "esp_system.h"
-#if ESP_IDF_VERSION_MAJOR >= 4 // IDF 4+
-#if CONFIG_IDF_TARGET_ESP32 // ESP32/PICO-D4
-#include "esp32/rom/tjpgd.h"
-#elif CONFIG_IDF_TARGET_ESP32S3
-#include "esp32s3/rom/tjpgd.h"
-#elif CONFIG_IDF_TARGET_ESP32C3
-#include "esp32c3/rom/tjpgd.h"
-#elif CONFIG_ESP_ROM_HAS_JPEG_DECODE // available since IDF 4.4
-#include "rom/tjpgd.h"  // latest IDFs have `rom/` includes available
+#include "esp_heap_caps.h"
+#include "sdkconfig.h"
+
+// The decoder core is shared with esp_jpeg, it is selected and tuned by its JD_* options
+#if CONFIG_JD_USE_ROM
+#include "rom/tjpgd.h"
+typedef unsigned int jpg_decode_out_t;
 #else
-#include "tjpgd.h"  // using software decoder
+#include "tjpgd.h"  // esp_jpeg/tjpgd
+typedef int jpg_decode_out_t;
 #endif
-#else // ESP32 Before IDF 4.0
-#include "rom/tjpgd.h"
+
+#if defined(JD_FORMAT) && (JD_FORMAT != 0)
+#error "JPEG conversions need RGB888 output of the decoder, select JD_FORMAT_RGB888 in esp_jpeg configuration"
+#endif
+
+// Same working buffer as esp_jpeg_decode() uses for the configured optimization level
+#if defined(JD_FASTDECODE) && (JD_FASTDECODE == 2)
+#define JPG_WORK_BUF_SIZE 65472
+#elif defined(JD_FASTDECODE) && (JD_FASTDECODE == 1)
+#define JPG_WORK_BUF_SIZE 3500
+#else
+#define JPG_WORK_BUF_SIZE 3100
 #endif
 
 #if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
@@ -59,7 +69,7 @@ static const char * jd_errors[] = {
     "Not supported JPEG standard"
 };
 
-static unsigned int _jpg_write(JDEC *decoder, void *bitmap, JRECT *rect)
+static jpg_decode_out_t _jpg_write(JDEC *decoder, void *bitmap, JRECT *rect)
 {
     uint16_t x = rect->left;
     uint16_t y = rect->top;
@@ -93,7 +103,6 @@ static unsigned int _jpg_read(JDEC *decoder, uint8_t *buf, unsigned int len)
 
 esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jpg_writer_cb writer, void * arg)
 {
-    static uint8_t work[3100];
     JDEC decoder;
     esp_jpg_decoder_t jpeg;
 
@@ -104,9 +113,16 @@ esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jp
     jpeg.scale = scale;
     jpeg.index = 0;
 
-    JRESULT jres = jd_prepare(&decoder, _jpg_read, work, 3100, &jpeg);
+    uint8_t *work = (uint8_t *)heap_caps_malloc(JPG_WORK_BUF_SIZE, MALLOC_CAP_DEFAULT);
+    if (!work) {
+        ESP_LOGE(TAG, "JPG Work Buffer Alloc Failed!");
+        return ESP_ERR_NO_MEM;
+    }
+
+    JRESULT jres = jd_prepare(&decoder, _jpg_read, work, JPG_WORK_BUF_SIZE, &jpeg);
     if(jres != JDR_OK){
         ESP_LOGE(TAG, "JPG Header Parse Failed! %s", jd_errors[jres]);
+        free(work);
         return ESP_FAIL;
     }
 
@@ -116,10 +132,12 @@ esp_err_t esp_jpg_decode(size_t len, jpg_scale_t scale, jpg_reader_cb reader, jp
     //output start
     if (!writer(arg, 0, 0, output_width, output_height, NULL)) {
         ESP_LOGE(TAG, "JPG Writer Start Failed!");
+        free(work);
         return ESP_FAIL;
     }
     //output write
     jres = jd_decomp(&decoder, _jpg_write, (uint8_t)jpeg.scale);
+    free(work);
     //output end
     if (!writer(arg, output_width, output_height, output_width, output_height, NULL)) {
         ESP_LOGE(TAG, "JPG Writer End Failed!");
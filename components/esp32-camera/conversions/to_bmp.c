@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include "img_converters.h"
 #include "soc/efuse_reg.h"
@@ -19,6 +20,7 @@
 #include "yuv.h"
 #include "sdkconfig.h"
 #include "esp_jpg_decode.h"
+#include "jpeg_decoder.h"
 
 #include "esp_system.h"
 
@@ -49,14 +51,6 @@ typedef struct {
     uint32_t mostimpcolor;
 } bmp_header_t;
 
-typedef struct {
-        uint16_t width;
-        uint16_t height;
-        uint16_t data_offset;
-        const uint8_t *input;
-        uint8_t *output;
-} rgb_jpg_decoder;
-
 static void *_malloc(size_t size)
 {
     // check if SPIRAM is enabled and allocate on SPIRAM if allocatable
@@ -67,167 +61,89 @@ static void *_malloc(size_t size)
     return malloc(size);
 }
 
-//output buffer and image width
-static bool _rgb_write(void * arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data)
+// JPEG conversions are decoded by esp_jpeg, its RGB888 output is swapped to the B, G, R order of this component
+static bool jpg_decode(const uint8_t *src, size_t src_len, uint8_t *out, size_t out_len, esp_jpeg_image_format_t format, jpg_scale_t scale)
 {
-    rgb_jpg_decoder * jpeg = (rgb_jpg_decoder *)arg;
-    if(!data){
-        if(x == 0 && y == 0){
-            //write start
-            jpeg->width = w;
-            jpeg->height = h;
-            //if output is null, this is BMP
-            if(!jpeg->output){
-                size_t out_size = (w*h*3)+jpeg->data_offset;
-                jpeg->output = (uint8_t *)_malloc(out_size);
-                if(!jpeg->output){
-                    ESP_LOGE(TAG, "_malloc failed! %zu", out_size);
-                    return false;
-                }
-            }
-        } else {
-            //write end
-        }
-        return true;
-    }
-
-    size_t jw = jpeg->width*3;
-    size_t t = y * jw;
-    size_t b = t + (h * jw);
-    size_t l = x * 3;
-    uint8_t *out = jpeg->output+jpeg->data_offset;
-    uint8_t *o = out;
-    size_t iy, ix;
-
-    w = w * 3;
-
-    for(iy=t; iy<b; iy+=jw) {
-        o = out+iy+l;
-        for(ix=0; ix<w; ix+= 3) {
-            o[ix] = data[ix+2];
-            o[ix+1] = data[ix+1];
-            o[ix+2] = data[ix];
-        }
-        data+=w;
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)src,
+        .indata_size = src_len,
+        .outbuf = out,
+        .outbuf_size = out_len,
+        .out_format = format,
+        .out_scale = (esp_jpeg_image_scale_t)scale,
+        .flags = {
+            .swap_color_bytes = (format == JPEG_IMAGE_FORMAT_RGB888),
+        },
+    };
+    esp_jpeg_image_output_t img;
+    esp_err_t ret = esp_jpeg_decode(&jpeg_cfg, &img);
+    if(ret != ESP_OK){
+        ESP_LOGE(TAG, "JPG decode failed! %s", esp_err_to_name(ret));
+        return false;
     }
     return true;
 }
 
-static bool _rgb565_write(void * arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data)
+static bool jpg_output_len(const uint8_t *src, size_t src_len, esp_jpeg_image_format_t format, jpg_scale_t scale, esp_jpeg_image_output_t *img)
 {
-    rgb_jpg_decoder * jpeg = (rgb_jpg_decoder *)arg;
-    if(!data){
-        if(x == 0 && y == 0){
-            //write start
-            jpeg->width = w;
-            jpeg->height = h;
-            //if output is null, this is BMP
-            if(!jpeg->output){
-                size_t out_size = (w*h*3)+jpeg->data_offset;
-                jpeg->output = (uint8_t *)_malloc(out_size);
-                if(!jpeg->output){
-                    ESP_LOGE(TAG, "_malloc failed! %zu", out_size);
-                    return false;
-                }
-            }
-        } else {
-            //write end
-        }
-        return true;
-    }
-
-    size_t jw = jpeg->width*3;
-    size_t jw2 = jpeg->width*2;
-    size_t t = y * jw;
-    size_t t2 = y * jw2;
-    size_t b = t + (h * jw);
-    size_t l = x * 2;
-    uint8_t *out = jpeg->output+jpeg->data_offset;
-    uint8_t *o = out;
-    size_t iy, iy2, ix, ix2;
-
-    w = w * 3;
-
-    for(iy=t, iy2=t2; iy<b; iy+=jw, iy2+=jw2) {
-        o = out+iy2+l;
-        for(ix2=ix=0; ix<w; ix+= 3, ix2 +=2) {
-            uint16_t r = data[ix];
-            uint16_t g = data[ix+1];
-            uint16_t b = data[ix+2];
-            uint16_t c = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
-            o[ix2+1] = c>>8;
-            o[ix2] = c&0xff;
-        }
-        data+=w;
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)src,
+        .indata_size = src_len,
+        .out_format = format,
+        .out_scale = (esp_jpeg_image_scale_t)scale,
+    };
+    if(esp_jpeg_get_image_info(&jpeg_cfg, img) != ESP_OK){
+        ESP_LOGE(TAG, "JPG Header Parse Failed!");
+        return false;
     }
     return true;
 }
 
-//input buffer
-static unsigned int _jpg_read(void * arg, size_t index, uint8_t *buf, size_t len)
-{
-    rgb_jpg_decoder * jpeg = (rgb_jpg_decoder *)arg;
-    if(buf) {
-        memcpy(buf, jpeg->input + index, len);
-    }
-    return len;
-}
-
 static bool jpg2rgb888(const uint8_t *src, size_t src_len, uint8_t * out, jpg_scale_t scale)
 {
-    rgb_jpg_decoder jpeg;
-    jpeg.width = 0;
-    jpeg.height = 0;
-    jpeg.input = src;
-    jpeg.output = out;
-    jpeg.data_offset = 0;
-
-    if(esp_jpg_decode(src_len, scale, _jpg_read, _rgb_write, (void*)&jpeg) != ESP_OK){
+    esp_jpeg_image_output_t img;
+    if(!jpg_output_len(src, src_len, JPEG_IMAGE_FORMAT_RGB888, scale, &img)){
         return false;
     }
-    return true;
+    return jpg_decode(src, src_len, out, img.output_len, JPEG_IMAGE_FORMAT_RGB888, scale);
 }
 
 bool jpg2rgb565(const uint8_t *src, size_t src_len, uint8_t * out, jpg_scale_t scale)
 {
-    rgb_jpg_decoder jpeg;
-    jpeg.width = 0;
-    jpeg.height = 0;
-    jpeg.input = src;
-    jpeg.output = out;
-    jpeg.data_offset = 0;
-
-    if(esp_jpg_decode(src_len, scale, _jpg_read, _rgb565_write, (void*)&jpeg) != ESP_OK){
+    esp_jpeg_image_output_t img;
+    if(!jpg_output_len(src, src_len, JPEG_IMAGE_FORMAT_RGB565, scale, &img)){
         return false;
     }
-    return true;
+    return jpg_decode(src, src_len, out, img.output_len, JPEG_IMAGE_FORMAT_RGB565, scale);
 }
 
 bool jpg2bmp(const uint8_t *src, size_t src_len, uint8_t ** out, size_t * out_len)
 {
-
-    rgb_jpg_decoder jpeg;
-    jpeg.width = 0;
-    jpeg.height = 0;
-    jpeg.input = src;
-    jpeg.output = NULL;
-    jpeg.data_offset = BMP_HEADER_LEN;
-
-    if(esp_jpg_decode(src_len, JPG_SCALE_NONE, _jpg_read, _rgb_write, (void*)&jpeg) != ESP_OK){
+    esp_jpeg_image_output_t img;
+    if(!jpg_output_len(src, src_len, JPEG_IMAGE_FORMAT_RGB888, JPG_SCALE_NONE, &img)){
         return false;
     }
 
-    size_t output_size = jpeg.width*jpeg.height*3;
+    size_t output_size = img.output_len;
+    uint8_t * out_buf = (uint8_t *)_malloc(output_size+BMP_HEADER_LEN);
+    if(!out_buf){
+        ESP_LOGE(TAG, "_malloc failed! %zu", output_size+BMP_HEADER_LEN);
+        return false;
+    }
+    if(!jpg_decode(src, src_len, out_buf+BMP_HEADER_LEN, output_size, JPEG_IMAGE_FORMAT_RGB888, JPG_SCALE_NONE)){
+        free(out_buf);
+        return false;
+    }
 
-    jpeg.output[0] = 'B';
-    jpeg.output[1] = 'M';
-    bmp_header_t * bitmap  = (bmp_header_t*)&jpeg.output[2];
+    out_buf[0] = 'B';
+    out_buf[1] = 'M';
+    bmp_header_t * bitmap  = (bmp_header_t*)&out_buf[2];
     bitmap->reserved = 0;
     bitmap->filesize = output_size+BMP_HEADER_LEN;
     bitmap->fileoffset_to_pixelarray = BMP_HEADER_LEN;
     bitmap->dibheadersize = 40;
-    bitmap->width = jpeg.width;
-    bitmap->height = -jpeg.height;//set negative for top to bottom
+    bitmap->width = img.width;
+    bitmap->height = -img.height;//set negative for top to bottom
     bitmap->planes = 1;
     bitmap->bitsperpixel = 24;
     bitmap->compression = 0;
@@ -237,7 +153,7 @@ bool jpg2bmp(const uint8_t *src, size_t src_len, uint8_t ** out, size_t * out_le
     bitmap->numcolorspallette = 0;
     bitmap->mostimpcolor = 0;
 
-    *out = jpeg.output;
+    *out = out_buf;
     *out_len = output_size+BMP_HEADER_LEN;
 
     return true;
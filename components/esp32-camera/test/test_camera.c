@@ -9,6 +9,7 @@
 #include "driver/i2c.h"
 
 #include "esp_camera.h"
+#include "jpeg_decoder.h"
 
 #ifdef CONFIG_IDF_TARGET_ESP32
 #define BOARD_WROVER_KIT 1
@@ -525,6 +526,104 @@ TEST_CASE("Conversions image 480x320 jpeg decode test", "[camera]")
     img_jpeg_decode_test(2, 0);
 }
 
+typedef struct {
+    const uint8_t *jpg;
+    uint8_t *rgb;
+    uint16_t width;
+} stream_decode_t;
+
+static size_t stream_read(void *arg, size_t index, uint8_t *buf, size_t len)
+{
+    stream_decode_t *stream = (stream_decode_t *)arg;
+    if (buf) {
+        memcpy(buf, stream->jpg + index, len);
+    }
+    return len;
+}
+
+static bool stream_write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data)
+{
+    stream_decode_t *stream = (stream_decode_t *)arg;
+    if (!data) {
+        return true;
+    }
+    for (int j = 0; j < h; j++) {
+        memcpy(&stream->rgb[((y + j) * stream->width + x) * 3], &data[j * w * 3], w * 3);
+    }
+    return true;
+}
+
+static void conversions_vs_esp_jpeg_test(const uint8_t *jpg, uint32_t length, uint16_t w, uint16_t h)
+{
+    const size_t rgb_len = w * h * 3;
+    uint8_t *expected = heap_caps_malloc(rgb_len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    uint8_t *out = heap_caps_calloc(1, rgb_len, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(out);
+
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)jpg,
+        .indata_size = length,
+        .outbuf = expected,
+        .outbuf_size = rgb_len,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+        .out_scale = JPEG_IMAGE_SCALE_0,
+    };
+    esp_jpeg_image_output_t outimg;
+
+    /* Streaming decoder runs on the same core, R, G, B order */
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+    TEST_ASSERT_EQUAL(w, outimg.width);
+    TEST_ASSERT_EQUAL(h, outimg.height);
+    stream_decode_t stream = {
+        .jpg = jpg,
+        .rgb = out,
+        .width = w,
+    };
+    TEST_ESP_OK(esp_jpg_decode(length, JPG_SCALE_NONE, stream_read, stream_write, &stream));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, rgb_len);
+
+    /* RGB888 and BMP conversions are B, G, R */
+    jpeg_cfg.flags.swap_color_bytes = 1;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+    TEST_ASSERT_TRUE(fmt2rgb888(jpg, length, PIXFORMAT_JPEG, out));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, rgb_len);
+
+    uint8_t *bmp = NULL;
+    size_t bmp_len = 0;
+    TEST_ASSERT_TRUE(jpg2bmp(jpg, length, &bmp, &bmp_len));
+    TEST_ASSERT_EQUAL(rgb_len + 54, bmp_len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, bmp + 54, rgb_len);
+    free(bmp);
+
+    /* RGB565 conversion is little endian, check all scales */
+    jpeg_cfg.out_format = JPEG_IMAGE_FORMAT_RGB565;
+    jpeg_cfg.flags.swap_color_bytes = 0;
+    for (int scale = JPG_SCALE_NONE; scale <= JPG_SCALE_MAX; scale++) {
+        jpeg_cfg.out_scale = (esp_jpeg_image_scale_t)scale;
+        TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+        TEST_ASSERT_TRUE(jpg2rgb565(jpg, length, out, (jpg_scale_t)scale));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, outimg.output_len);
+    }
+
+    heap_caps_free(out);
+    heap_caps_free(expected);
+}
+
+TEST_CASE("Conversions decode same as esp_jpeg decoder", "[camera]")
+{
+    extern const uint8_t img1_start[] asm("_binary_testimg_jpeg_start");
+    extern const uint8_t img1_end[]   asm("_binary_testimg_jpeg_end");
+    extern const uint8_t img2_start[] asm("_binary_test_inside_jpeg_start");
+    extern const uint8_t img2_end[]   asm("_binary_test_inside_jpeg_end");
+    extern const uint8_t img3_start[] asm("_binary_test_outside_jpeg_start");
+    extern const uint8_t img3_end[]   asm("_binary_test_outside_jpeg_end");
+
+    conversions_vs_esp_jpeg_test(img1_start, img1_end - img1_start, 227, 149);
+    conversions_vs_esp_jpeg_test(img2_start, img2_end - img2_start, 320, 240);
+    conversions_vs_esp_jpeg_test(img3_start, img3_end - img3_start, 480, 320);
+}
+
 TEST_CASE("Camera driver uses an i2c port initialized by other devices test", "[camera]")
 {
     TEST_ESP_OK(i2c_master_init(I2C_MASTER_NUM));
@@ -0,0 +1,181 @@
+#include "alloc_audit.h"
+
+#if CONFIG_ALLOC_AUDIT
+
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define TAG "ALLOC_AUDIT"
+
+static portMUX_TYPE audit_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t tasks[ALLOC_AUDIT_MAX_TASKS];
+static pipeline_stage_t task_stages[ALLOC_AUDIT_MAX_TASKS];
+static uint32_t frame_count[PIPELINE_STAGE_COUNT];
+static uint32_t frame_bytes[PIPELINE_STAGE_COUNT];
+static alloc_audit_stats_t stats;
+static bool armed = false;
+static bool reported = false;
+
+// Called from the wrapped heap functions, must not allocate or log
+static void record(size_t size, const void* caller) {
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) {
+        return;
+    }
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+
+    taskENTER_CRITICAL(&audit_lock);
+    pipeline_stage_t stage = PIPELINE_STAGE_OTHER;
+    for (int i = 0; i < ALLOC_AUDIT_MAX_TASKS; ++i) {
+        if (tasks[i] == task) {
+            stage = task_stages[i];
+            break;
+        }
+    }
+    stats.count[stage]++;
+    stats.bytes[stage] += size;
+    frame_count[stage]++;
+    frame_bytes[stage] += size;
+    if (armed && stage != PIPELINE_STAGE_OTHER && stats.violations++ == 0) {
+        stats.violation_stage = stage;
+        stats.violation_size = size;
+        stats.violation_caller = caller;
+    }
+    taskEXIT_CRITICAL(&audit_lock);
+}
+
+void alloc_audit_set_stage(pipeline_stage_t stage) {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    int free_index = -1;
+
+    taskENTER_CRITICAL(&audit_lock);
+    for (int i = 0; i < ALLOC_AUDIT_MAX_TASKS; ++i) {
+        if (tasks[i] == task) {
+            task_stages[i] = stage;
+            taskEXIT_CRITICAL(&audit_lock);
+            return;
+        }
+        if (!tasks[i] && free_index < 0) {
+            free_index = i;
+        }
+    }
+    if (free_index >= 0) {
+        tasks[free_index] = task;
+        task_stages[free_index] = stage;
+    }
+    taskEXIT_CRITICAL(&audit_lock);
+
+    if (free_index < 0) {
+        ESP_LOGW(TAG, "Too many audited tasks, %s is not tracked", pcTaskGetName(task));
+    }
+}
+
+void alloc_audit_frame_done() {
+    bool report = false;
+
+    taskENTER_CRITICAL(&audit_lock);
+    for (int stage = 0; stage < PIPELINE_STAGE_COUNT; ++stage) {
+        stats.frame_count[stage] = frame_count[stage];
+        stats.frame_bytes[stage] = frame_bytes[stage];
+        frame_count[stage] = 0;
+        frame_bytes[stage] = 0;
+    }
+    stats.frames++;
+    if (stats.violations && !reported) {
+        report = reported = true;
+    }
+    taskEXIT_CRITICAL(&audit_lock);
+
+    if (report) {
+        ESP_LOGE(TAG, "Allocation after warm-up: stage %d, %u bytes, caller %p",
+                 stats.violation_stage, (unsigned)stats.violation_size, stats.violation_caller);
+    }
+}
+
+void alloc_audit_arm() {
+    taskENTER_CRITICAL(&audit_lock);
+    armed = true;
+    taskEXIT_CRITICAL(&audit_lock);
+    ESP_LOGI(TAG, "Armed after %u frames", (unsigned)stats.frames);
+}
+
+void alloc_audit_get_stats(alloc_audit_stats_t* out) {
+    taskENTER_CRITICAL(&audit_lock);
+    *out = stats;
+    taskEXIT_CRITICAL(&audit_lock);
+}
+
+void alloc_audit_reset() {
+    taskENTER_CRITICAL(&audit_lock);
+    stats = {};
+    for (int stage = 0; stage < PIPELINE_STAGE_COUNT; ++stage) {
+        frame_count[stage] = 0;
+        frame_bytes[stage] = 0;
+    }
+    armed = false;
+    reported = false;
+    taskEXIT_CRITICAL(&audit_lock);
+}
+
+// Linked with -Wl,--wrap=<function>, see CMakeLists.txt
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void* __real_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+
+void* __wrap_malloc(size_t size) {
+    record(size, __builtin_return_address(0));
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+    record(n * size, __builtin_return_address(0));
+    return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    record(size, __builtin_return_address(0));
+    return __real_realloc(ptr, size);
+}
+
+void* __wrap_heap_caps_malloc(size_t size, uint32_t caps) {
+    record(size, __builtin_return_address(0));
+    return __real_heap_caps_malloc(size, caps);
+}
+
+void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+    record(n * size, __builtin_return_address(0));
+    return __real_heap_caps_calloc(n, size, caps);
+}
+
+void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps) {
+    record(size, __builtin_return_address(0));
+    return __real_heap_caps_realloc(ptr, size, caps);
+}
+
+void* __wrap_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps) {
+    record(size, __builtin_return_address(0));
+    return __real_heap_caps_aligned_alloc(alignment, size, caps);
+}
+}
+
+// Goes through the wrapped malloc also where the C++ runtime is a shared library, as on the linux target
+void* operator new(size_t size) {
+    void* ptr = malloc(size);
+    if (!ptr) abort();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    void* ptr = malloc(size);
+    if (!ptr) abort();
+    return ptr;
+}
+
+#endif // CONFIG_ALLOC_AUDIT
@@ -0,0 +1,48 @@
+#ifndef ALLOC_AUDIT_H
+#define ALLOC_AUDIT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "pipeline.h"
+
+// Heap allocations are attributed to the pipeline stage the calling task is in.
+// With CONFIG_ALLOC_AUDIT the heap functions are wrapped at link time, otherwise the API compiles away.
+
+#define ALLOC_AUDIT_MAX_TASKS 4
+
+struct alloc_audit_stats_t {
+    uint32_t count[PIPELINE_STAGE_COUNT];        // allocations since boot
+    uint32_t bytes[PIPELINE_STAGE_COUNT];        // bytes requested since boot
+    uint32_t frame_count[PIPELINE_STAGE_COUNT];  // allocations during the last completed frame
+    uint32_t frame_bytes[PIPELINE_STAGE_COUNT];  // bytes requested during the last completed frame
+    uint32_t frames;                             // completed frames
+    uint32_t violations;                         // pipeline stage allocations after alloc_audit_arm()
+    pipeline_stage_t violation_stage;            // first violation: stage, size and caller
+    size_t violation_size;
+    const void* violation_caller;
+};
+
+#if CONFIG_ALLOC_AUDIT
+
+// Sets the stage of the calling task, up to ALLOC_AUDIT_MAX_TASKS tasks are tracked
+void alloc_audit_set_stage(pipeline_stage_t stage);
+// Closes the per-frame counters, logs the first violation once
+void alloc_audit_frame_done();
+// Ends the warm-up, from now on every allocation in a pipeline stage is a violation
+void alloc_audit_arm();
+void alloc_audit_get_stats(alloc_audit_stats_t* stats);
+void alloc_audit_reset();
+
+#else
+
+static inline void alloc_audit_set_stage(pipeline_stage_t stage) {}
+static inline void alloc_audit_frame_done() {}
+static inline void alloc_audit_arm() {}
+static inline void alloc_audit_get_stats(alloc_audit_stats_t* stats) { *stats = {}; }
+static inline void alloc_audit_reset() {}
+
+#endif
+
+#endif // ALLOC_AUDIT_H
@@ -0,0 +1,203 @@
+#ifndef AOT_KERNELS_H
+#define AOT_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+
+#include "esp_nn.h"
+#include "sdkconfig.h"
+
+// Kernels called by the code tools/model_compiler generates. Shapes are template arguments so every loop
+// bound is a constant of its own instantiation, tensors are NHWC, filters [out][h][w][in]. Kernels forward to
+// esp-nn, float ones to its f32 family, with the parameters the compiler worked out. Convolutions and fully
+// connected layers go through esp_nn_parallel.h, which splits them with the other core once nn_worker runs.
+// With CONFIG_SIGN_TILED_CONV aot_conv_f32 and aot_conv_s8 go through esp_nn_tiled.h instead, in bands staged
+// in the internal buffer init_buffers() sets.
+
+// Normalised or quantized model input from 8 bit pixels through a table of the 256 values
+template <int N, typename T>
+static inline void aot_input(const uint8_t* pixels, const T* table, T* out) {
+    for (int i = 0; i < N; ++i) {
+        out[i] = table[pixels[i]];
+    }
+}
+
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static inline void aot_conv_f32(const float* in, const float* filter, const float* bias, float* out, float act_min,
+                                float act_max) {
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t filter_dims = {KW, KH, C, O};
+    const data_dims_t out_dims = {OW, OH, O, 1};
+    const conv_f32_params_t params = {{SW, SH}, {PW, PH}, {act_min, act_max}};
+#if CONFIG_SIGN_TILED_CONV
+    esp_nn_tiled_conv_f32(&in_dims, in, &filter_dims, filter, bias, &out_dims, out, &params);
+#else
+    esp_nn_parallel_conv_f32(&in_dims, in, &filter_dims, filter, bias, &out_dims, out, &params);
+#endif
+}
+
+// First convolution straight from the pixels, the normalisation is folded into filter and bias and pad is the
+// pixel standing for the zero padding
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static inline void aot_conv_rgb_f32(const uint8_t* rgb, const float* filter, const float* bias, float* out, float pad,
+                                    float act_min, float act_max) {
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t filter_dims = {KW, KH, C, O};
+    const data_dims_t out_dims = {OW, OH, O, 1};
+    const conv_f32_params_t params = {{SW, SH}, {PW, PH}, {act_min, act_max}};
+    esp_nn_parallel_conv_rgb_f32(&in_dims, rgb, &filter_dims, filter, bias, &out_dims, out, &params, pad);
+}
+
+template <int H, int W, int C, int OH, int OW, int FH, int FW, int SH, int SW, int PH, int PW>
+static inline void aot_max_pool_f32(const float* in, float* out, float act_min, float act_max) {
+    esp_nn_max_pool_f32(in, W, H, out, OW, OH, SW, SH, FW, FH, PW, PH, act_min, act_max, C);
+}
+
+// Mean over the N positions of every channel
+template <int N, int C>
+static inline void aot_mean_f32(const float* in, float* out) {
+    esp_nn_global_avg_pool_f32(in, N, 1, C, out);
+}
+
+template <int I, int O>
+static inline void aot_fully_connected_f32(const float* in, const float* weights, const float* bias, float* out,
+                                           float act_min, float act_max) {
+    esp_nn_parallel_fully_connected_f32(in, I, weights, bias, out, O, act_min, act_max);
+}
+
+// Mean read only by a fully connected, the classifier head of a model: the C means never reach the arena
+template <int N, int C, int O>
+static inline void aot_mean_fully_connected_f32(const float* in, const float* weights, const float* bias, float* out,
+                                                float act_min, float act_max) {
+    static_assert(C <= ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS, "too many channels for the fused head");
+    esp_nn_global_avg_pool_fc_f32(in, N, 1, C, weights, bias, out, O, act_min, act_max);
+}
+
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static int aot_conv_s8_scratch_size() {
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t filter_dims = {KW, KH, C, O};
+    const data_dims_t out_dims = {OW, OH, O, 1};
+    const conv_params_t params = {0, 0, {SW, SH}, {PW, PH}, {1, 1}, {-128, 127}};
+    return esp_nn_get_conv_scratch_size(&in_dims, &filter_dims, &out_dims, &params);
+}
+
+// Per channel requantization, in_offset is minus the input zero point and out_offset the output zero point
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static void aot_conv_s8(const int8_t* in, const int8_t* filter, const int32_t* bias, int8_t* out, int32_t in_offset,
+                        int32_t out_offset, const int32_t* mult, const int32_t* shift, int32_t act_min,
+                        int32_t act_max, void* scratch) {
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t filter_dims = {KW, KH, C, O};
+    const data_dims_t out_dims = {OW, OH, O, 1};
+    const conv_params_t params = {in_offset, out_offset, {SW, SH}, {PW, PH}, {1, 1}, {act_min, act_max}};
+    // esp-nn only reads the quantization arrays
+    const quant_data_t quant = {const_cast<int32_t*>(shift), const_cast<int32_t*>(mult)};
+    esp_nn_set_conv_scratch_buf(scratch);
+#if CONFIG_SIGN_TILED_CONV
+    esp_nn_tiled_conv_s8(&in_dims, in, &filter_dims, filter, bias, &out_dims, out, &params, &quant);
+#else
+    esp_nn_parallel_conv_s8(&in_dims, in, &filter_dims, filter, bias, &out_dims, out, &params, &quant);
+#endif
+}
+
+template <int H, int W, int C, int OH, int OW, int FH, int FW, int SH, int SW, int PH, int PW>
+static inline void aot_max_pool_s8(const int8_t* in, int8_t* out, int32_t act_min, int32_t act_max) {
+    esp_nn_max_pool_s8(in, W, H, out, OW, OH, SW, SH, FW, FH, PW, PH, act_min, act_max, C);
+}
+
+// Convolution with the max pool that reads it fused, only the pooled tensor is written. The first shape is the
+// convolution's, POH..PPW the pool's output, filter, stride and padding
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW, int POH, int POW,
+          int PFH, int PFW, int PSH, int PSW, int PPH, int PPW>
+static void aot_conv_max_pool_s8(const int8_t* in, const int8_t* filter, const int32_t* bias, int8_t* out,
+                                 int32_t in_offset, int32_t out_offset, const int32_t* mult, const int32_t* shift,
+                                 int32_t act_min, int32_t act_max, int32_t pool_min, int32_t pool_max) {
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t filter_dims = {KW, KH, C, O};
+    const data_dims_t conv_dims = {OW, OH, O, 1};
+    const data_dims_t out_dims = {POW, POH, O, 1};
+    const conv_params_t params = {in_offset, out_offset, {SW, SH}, {PW, PH}, {1, 1}, {act_min, act_max}};
+    const pool_params_t pool = {{PFW, PFH}, {PSW, PSH}, {PPW, PPH}, {pool_min, pool_max}};
+    const quant_data_t quant = {const_cast<int32_t*>(shift), const_cast<int32_t*>(mult)};
+    esp_nn_parallel_conv_max_pool_s8(&in_dims, in, &filter_dims, filter, bias, &conv_dims, &out_dims, out, &params,
+                                     &pool, &quant);
+}
+
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static int aot_conv_winograd_s8_scratch_size() {
+    const data_dims_t in_dims = {W, H, C, 1};
+    return esp_nn_get_conv_winograd_scratch_size(&in_dims);
+}
+
+// Winograd F(2x2, 3x3) with the filters the compiler transformed, the same outputs as aot_conv_s8
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW>
+static void aot_conv_winograd_s8(const int8_t* in, const int16_t* filter, const int32_t* bias, int8_t* out,
+                                 int32_t in_offset, int32_t out_offset, const int32_t* mult, const int32_t* shift,
+                                 int32_t act_min, int32_t act_max, void* scratch) {
+    static_assert(KH == 3 && KW == 3 && SH == 1 && SW == 1, "Winograd F(2x2, 3x3) runs 3x3 stride 1 convolutions");
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t out_dims = {OW, OH, O, 1};
+    const conv_params_t params = {in_offset, out_offset, {SW, SH}, {PW, PH}, {1, 1}, {act_min, act_max}};
+    const quant_data_t quant = {const_cast<int32_t*>(shift), const_cast<int32_t*>(mult)};
+    esp_nn_set_conv_winograd_scratch_buf(scratch);
+    esp_nn_parallel_conv_winograd_s8(&in_dims, in, filter, bias, &out_dims, out, &params, nullptr, &quant);
+}
+
+// As aot_conv_max_pool_s8, every 2x2 output tile is one window of the pool
+template <int H, int W, int C, int OH, int OW, int O, int KH, int KW, int SH, int SW, int PH, int PW, int POH, int POW,
+          int PFH, int PFW, int PSH, int PSW, int PPH, int PPW>
+static void aot_conv_winograd_max_pool_s8(const int8_t* in, const int16_t* filter, const int32_t* bias, int8_t* out,
+                                          int32_t in_offset, int32_t out_offset, const int32_t* mult,
+                                          const int32_t* shift, int32_t act_min, int32_t act_max, int32_t pool_min,
+                                          int32_t pool_max, void* scratch) {
+    static_assert(KH == 3 && KW == 3 && SH == 1 && SW == 1, "Winograd F(2x2, 3x3) runs 3x3 stride 1 convolutions");
+    static_assert(PFH == 2 && PFW == 2 && PSH == 2 && PSW == 2 && PPH == 0 && PPW == 0,
+                  "only a 2x2 stride 2 pool fuses into the Winograd tiles");
+    const data_dims_t in_dims = {W, H, C, 1};
+    const data_dims_t out_dims = {POW, POH, O, 1};
+    const conv_params_t params = {in_offset, out_offset, {SW, SH}, {PW, PH}, {1, 1}, {act_min, act_max}};
+    const pool_params_t pool = {{PFW, PFH}, {PSW, PSH}, {PPW, PPH}, {pool_min, pool_max}};
+    const quant_data_t quant = {const_cast<int32_t*>(shift), const_cast<int32_t*>(mult)};
+    esp_nn_set_conv_winograd_scratch_buf(scratch);
+    esp_nn_parallel_conv_winograd_s8(&in_dims, in, filter, bias, &out_dims, out, &params, &pool, &quant);
+}
+
+// Mean over the N positions, mult and shift rescale from the input to the output scale before the rounded
+// division, as the integer Mean of TFLite Micro
+template <int N, int C>
+static inline void aot_mean_s8(const int8_t* in, int8_t* out, int32_t in_offset, int32_t out_offset, int32_t mult,
+                               int32_t shift) {
+    esp_nn_global_avg_pool_s8(in, N, 1, C, in_offset, out_offset, mult, shift, out);
+}
+
+template <int I, int O>
+static inline void aot_fully_connected_s8(const int8_t* in, const int8_t* weights, const int32_t* bias, int8_t* out,
+                                          int32_t in_offset, int32_t weights_offset, int32_t out_offset,
+                                          int32_t mult, int32_t shift, int32_t act_min, int32_t act_max) {
+    esp_nn_parallel_fully_connected_s8(in, in_offset, I, weights, weights_offset, bias, out, O, out_offset, shift,
+                                       mult, act_min, act_max);
+}
+
+// aot_mean_s8 then aot_fully_connected_s8, mean_offset is the zero point of the means
+template <int N, int C, int O>
+static inline void aot_mean_fully_connected_s8(const int8_t* in, const int8_t* weights, const int32_t* bias,
+                                               int8_t* out, int32_t in_offset, int32_t mean_offset,
+                                               int32_t mean_mult, int32_t mean_shift, int32_t weights_offset,
+                                               int32_t out_offset, int32_t mult, int32_t shift, int32_t act_min,
+                                               int32_t act_max) {
+    static_assert(C <= ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS, "too many channels for the fused head");
+    esp_nn_global_avg_pool_fc_s8(in, N, 1, C, in_offset, mean_offset, mean_mult, mean_shift, weights, weights_offset,
+                                 bias, out, O, out_offset, shift, mult, act_min, act_max);
+}
+
+// Logits of a quantized output tensor
+template <int N>
+static inline void aot_dequantize(const int8_t* in, float* out, int32_t zero_point, float scale) {
+    for (int i = 0; i < N; ++i) {
+        out[i] = (in[i] - zero_point) * scale;
+    }
+}
+
+#endif // AOT_KERNELS_H
@@ -0,0 +1,150 @@
+#include "buffer_pool.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+#define TAG "BUFFER_POOL"
+
+struct buffer_pool_t {
+    uint8_t* memory;
+    uint32_t free_mask;  // bit i set when buffer i is free
+    buffer_pool_stats_t stats;
+};
+
+static const char* class_names[BUFFER_CLASS_COUNT] = {
+    "band",
+    "jpeg_work",
+    "frame_rows",
+    "frame_stats",
+    "patch",
+    "tensor_arena",
+    "tensor_persistent",
+    "model_weights",
+    "features",
+    "tile"
+};
+
+static buffer_pool_t pools[BUFFER_CLASS_COUNT];
+static portMUX_TYPE pools_lock = portMUX_INITIALIZER_UNLOCKED;
+
+esp_err_t buffer_pool_init(buffer_class_t cls, size_t size, int count, uint32_t caps) {
+    if (cls >= BUFFER_CLASS_COUNT || size == 0 || count <= 0 || count > BUFFER_POOL_MAX_SLABS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    buffer_pool_t& pool = pools[cls];
+    if (pool.memory) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const size_t slab_size = (size + BUFFER_POOL_ALIGN - 1) & ~(size_t)(BUFFER_POOL_ALIGN - 1);
+    uint8_t* memory = (uint8_t*)heap_caps_aligned_alloc(BUFFER_POOL_ALIGN, slab_size * count, caps);
+    if (!memory) {
+        ESP_LOGE(TAG, "Failed to allocate %d x %u bytes for %s", count, (unsigned)slab_size, class_names[cls]);
+        return ESP_ERR_NO_MEM;
+    }
+
+    taskENTER_CRITICAL(&pools_lock);
+    pool.memory = memory;
+    pool.free_mask = count == 32 ? UINT32_MAX : (1u << count) - 1;
+    pool.stats = {};
+    pool.stats.slab_size = slab_size;
+    pool.stats.caps = caps;
+    pool.stats.count = count;
+    taskEXIT_CRITICAL(&pools_lock);
+
+    ESP_LOGI(TAG, "%s: %d x %u bytes (caps 0x%x)", class_names[cls], count, (unsigned)slab_size, (unsigned)caps);
+    return ESP_OK;
+}
+
+esp_err_t buffer_pool_deinit(buffer_class_t cls) {
+    if (cls >= BUFFER_CLASS_COUNT) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    buffer_pool_t& pool = pools[cls];
+
+    taskENTER_CRITICAL(&pools_lock);
+    if (pool.stats.in_use) {
+        taskEXIT_CRITICAL(&pools_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    uint8_t* memory = pool.memory;
+    pool = {};
+    taskEXIT_CRITICAL(&pools_lock);
+
+    heap_caps_free(memory);
+    return ESP_OK;
+}
+
+buffer_handle_t buffer_pool_acquire(buffer_class_t cls) {
+    if (cls >= BUFFER_CLASS_COUNT) {
+        return buffer_handle_t();
+    }
+    buffer_pool_t& pool = pools[cls];
+
+    taskENTER_CRITICAL(&pools_lock);
+    if (!pool.free_mask) {
+        pool.stats.exhausted++;
+        taskEXIT_CRITICAL(&pools_lock);
+        return buffer_handle_t();
+    }
+    const int index = __builtin_ctz(pool.free_mask);
+    pool.free_mask &= ~(1u << index);
+    pool.stats.acquired++;
+    if (++pool.stats.in_use > pool.stats.high_water) {
+        pool.stats.high_water = pool.stats.in_use;
+    }
+    uint8_t* data = pool.memory + index * pool.stats.slab_size;
+    taskEXIT_CRITICAL(&pools_lock);
+
+    return buffer_handle_t(cls, index, data);
+}
+
+void buffer_pool_get_stats(buffer_class_t cls, buffer_pool_stats_t* stats) {
+    taskENTER_CRITICAL(&pools_lock);
+    *stats = pools[cls].stats;
+    taskEXIT_CRITICAL(&pools_lock);
+}
+
+const char* buffer_pool_class_name(buffer_class_t cls) {
+    return cls < BUFFER_CLASS_COUNT ? class_names[cls] : "unknown";
+}
+
+void buffer_pool_log_stats() {
+    for (int cls = 0; cls < BUFFER_CLASS_COUNT; ++cls) {
+        buffer_pool_stats_t s;
+        buffer_pool_get_stats(static_cast<buffer_class_t>(cls), &s);
+        if (!s.count) continue;
+        ESP_LOGI(TAG, "%s: %u/%u in use, high water %u, acquired %u, exhausted %u", class_names[cls],
+                 s.in_use, s.count, s.high_water, (unsigned)s.acquired, (unsigned)s.exhausted);
+    }
+}
+
+buffer_handle_t::buffer_handle_t(buffer_handle_t&& other) noexcept
+    : cls_(other.cls_), index_(other.index_), data_(other.data_) {
+    other.data_ = nullptr;
+}
+
+buffer_handle_t& buffer_handle_t::operator=(buffer_handle_t&& other) noexcept {
+    if (this != &other) {
+        reset();
+        cls_ = other.cls_;
+        index_ = other.index_;
+        data_ = other.data_;
+        other.data_ = nullptr;
+    }
+    return *this;
+}
+
+void buffer_handle_t::reset() {
+    if (!data_) return;
+    buffer_pool_t& pool = pools[cls_];
+    taskENTER_CRITICAL(&pools_lock);
+    pool.free_mask |= 1u << index_;
+    pool.stats.in_use--;
+    taskEXIT_CRITICAL(&pools_lock);
+    data_ = nullptr;
+}
+
+size_t buffer_handle_t::size() const {
+    return data_ ? pools[cls_].stats.slab_size : 0;
+}
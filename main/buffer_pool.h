@@ -0,0 +1,74 @@
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Buffers are carved from one allocation per class at startup and recycled afterwards,
+// acquiring and releasing a buffer never calls the heap
+#define BUFFER_POOL_MAX_SLABS 32
+#define BUFFER_POOL_ALIGN 16
+
+enum buffer_class_t {
+    BUFFER_CLASS_BAND,               // one MCU row of the decoded frame
+    BUFFER_CLASS_JPEG_WORK,          // TJpgDec work buffer
+    BUFFER_CLASS_FRAME_ROWS,         // frame rows kept for classification, RGB888
+    BUFFER_CLASS_FRAME_STATS,        // row slots and prefix sums of a frame
+    BUFFER_CLASS_PATCH,              // window resized to the model input
+    BUFFER_CLASS_TENSOR_ARENA,       // TFLite Micro tensor arena, activations and scratch when split,
+                                     // or the arena of the compiled model
+    BUFFER_CLASS_TENSOR_PERSISTENT,  // TFLite Micro persistent tensor data when the arena is split
+    BUFFER_CLASS_MODEL_WEIGHTS,      // constant tensors copied out of flash
+    BUFFER_CLASS_FEATURES,           // feature rows of the shared convolutions of a pyramid level
+    BUFFER_CLASS_TILE,               // internal RAM the compiled model's convolutions stage bands in
+    BUFFER_CLASS_COUNT
+};
+
+struct buffer_pool_stats_t {
+    size_t slab_size;     // bytes per buffer, rounded up to BUFFER_POOL_ALIGN
+    uint32_t caps;        // heap capabilities the slabs were allocated with
+    uint16_t count;       // buffers in the pool
+    uint16_t in_use;      // buffers currently handed out
+    uint16_t high_water;  // most buffers handed out at the same time
+    uint32_t acquired;    // successful acquisitions
+    uint32_t exhausted;   // acquisitions that found the pool empty
+};
+
+// Owns one buffer of a pool and returns it on destruction, move only
+class buffer_handle_t {
+public:
+    buffer_handle_t() = default;
+    buffer_handle_t(buffer_handle_t&& other) noexcept;
+    buffer_handle_t& operator=(buffer_handle_t&& other) noexcept;
+    buffer_handle_t(const buffer_handle_t&) = delete;
+    buffer_handle_t& operator=(const buffer_handle_t&) = delete;
+    ~buffer_handle_t() { reset(); }
+
+    void reset();
+    uint8_t* data() const { return data_; }
+    template <typename T> T* as() const { return reinterpret_cast<T*>(data_); }
+    size_t size() const;
+    explicit operator bool() const { return data_ != nullptr; }
+
+private:
+    friend buffer_handle_t buffer_pool_acquire(buffer_class_t cls);
+    buffer_handle_t(buffer_class_t cls, uint8_t index, uint8_t* data) : cls_(cls), index_(index), data_(data) {}
+
+    buffer_class_t cls_ = BUFFER_CLASS_COUNT;
+    uint8_t index_ = 0;
+    uint8_t* data_ = nullptr;
+};
+
+// Allocates count buffers of size bytes with the given heap capabilities, once per class
+esp_err_t buffer_pool_init(buffer_class_t cls, size_t size, int count, uint32_t caps);
+// Frees the pool so the class can be initialised again, fails while any buffer is in use
+esp_err_t buffer_pool_deinit(buffer_class_t cls);
+// Returns an empty handle if the pool is not initialised or every buffer is in use
+buffer_handle_t buffer_pool_acquire(buffer_class_t cls);
+void buffer_pool_get_stats(buffer_class_t cls, buffer_pool_stats_t* stats);
+const char* buffer_pool_class_name(buffer_class_t cls);
+void buffer_pool_log_stats();
+
+#endif // BUFFER_POOL_H
@@ -0,0 +1,184 @@
+#include "detect_frame.h"
+#include "esp_log.h"
+#include <cmath>
+#include <algorithm>
+
+#define TAG "DETECTOR"
+
+static const float scales[] = {1.0f, 0.75f, 0.56f, 0.42f, 0.31f, 0.22f, 0.17f};
+
+void detect_frame_windows(int width, int height, std::vector<window_t>& windows) {
+    for (int s = 0; s < sizeof(scales)/sizeof(scales[0]); ++s) {
+        int patch_size = static_cast<int>(height * scales[s]);
+        if (patch_size < 64 || patch_size > height || patch_size > width) continue;
+
+        int stride = patch_size / 2;
+        for (int y = 0; y <= height - patch_size; y += stride) {
+            for (int x = 0; x <= width - patch_size; x += stride) {
+                window_t win = {};
+                win.x = x;
+                win.y = y;
+                win.size = patch_size;
+                win.margin = patch_size / 4;
+                win.scale = scales[s];
+                windows.push_back(win);
+            }
+        }
+    }
+}
+
+// Only the rows picked by the nearest neighbour resize to the model input are kept, returns their count
+static int assign_row_slots(const std::vector<window_t>& windows, int height, int16_t* row_slot) {
+    std::fill(row_slot, row_slot + height, -1);
+    for (const window_t& win : windows) {
+        for (int j = 0; j < DETECT_INPUT_SIZE; ++j) {
+            row_slot[win.y + j * win.size / DETECT_INPUT_SIZE] = 0;
+        }
+    }
+    int kept = 0;
+    for (int y = 0; y < height; ++y) {
+        if (row_slot[y] == 0) row_slot[y] = kept++;
+    }
+    return kept;
+}
+
+static size_t frame_stats_size(int width, int height) {
+    return height * sizeof(int16_t) + 4 * (width + 1) * sizeof(uint32_t);
+}
+
+void detect_frame_buffer_sizes(int width, int height, size_t* rows_size, size_t* stats_size) {
+    std::vector<window_t> windows;
+    detect_frame_windows(width, height, windows);
+    std::vector<int16_t> row_slot(height);
+    *rows_size = assign_row_slots(windows, height, row_slot.data()) * width * 3;
+    *stats_size = frame_stats_size(width, height);
+}
+
+detect_frame_t* detect_frame_create(int width, int height) {
+    detect_frame_t* frame = new detect_frame_t();
+    frame->width = width;
+    frame->height = height;
+    detect_frame_windows(width, height, frame->windows);
+
+    frame->stats_buffer = buffer_pool_acquire(BUFFER_CLASS_FRAME_STATS);
+    if (!frame->stats_buffer || frame->stats_buffer.size() < frame_stats_size(width, height)) {
+        ESP_LOGE(TAG, "No frame statistics buffer for %dx%d", width, height);
+        detect_frame_delete(frame);
+        return nullptr;
+    }
+    // prefix first, it needs the 4 byte alignment of the pool buffer
+    frame->prefix = frame->stats_buffer.as<uint32_t>();
+    frame->row_slot = reinterpret_cast<int16_t*>(frame->prefix + 4 * (width + 1));
+    int kept = assign_row_slots(frame->windows, height, frame->row_slot);
+
+    frame->rows_buffer = buffer_pool_acquire(BUFFER_CLASS_FRAME_ROWS);
+    if (!frame->rows_buffer || frame->rows_buffer.size() < (size_t)kept * width * 3) {
+        ESP_LOGE(TAG, "No buffer for %d kept rows", kept);
+        detect_frame_delete(frame);
+        return nullptr;
+    }
+    frame->rows = frame->rows_buffer.data();
+
+    ESP_LOGI(TAG, "Frame %dx%d: %d windows, %d of %d rows kept", width, height,
+             (int)frame->windows.size(), kept, height);
+    return frame;
+}
+
+void detect_frame_delete(detect_frame_t* frame) {
+    delete frame;
+}
+
+esp_err_t detect_frame_band_cb(const esp_jpeg_band_t* band, void* user_data) {
+    detect_frame_t* frame = static_cast<detect_frame_t*>(user_data);
+    const int width = frame->width;
+    if (band->width != width || band->stride != width * 4u || band->y + band->height > frame->height) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    if (band->y == 0) {
+        for (window_t& win : frame->windows) {
+            win.red_like = 0;
+            std::fill(win.sum, win.sum + 3, 0);
+            std::fill(win.center, win.center + 3, 0);
+        }
+    }
+
+    uint32_t* pr = frame->prefix;
+    uint32_t* pg = pr + width + 1;
+    uint32_t* pb = pg + width + 1;
+    uint32_t* pm = pb + width + 1;
+    pr[0] = pg[0] = pb[0] = pm[0] = 0;
+
+    for (int j = 0; j < band->height; ++j) {
+        const int y = band->y + j;
+        const uint8_t* pixel = band->data + j * band->stride;
+
+        // Row prefix sums turn every window row into two lookups
+        for (int i = 0; i < width; ++i, pixel += 4) {
+            pr[i + 1] = pr[i] + pixel[0];
+            pg[i + 1] = pg[i] + pixel[1];
+            pb[i + 1] = pb[i] + pixel[2];
+            pm[i + 1] = pm[i] + (pixel[3] & 1);  // red mask from the JPEG decoder: s > 0.25 && (h < 30 || h > 330)
+        }
+
+        if (frame->row_slot[y] >= 0) {
+            pixel = band->data + j * band->stride;
+            uint8_t* dst = &frame->rows[frame->row_slot[y] * width * 3];
+            for (int i = 0; i < width; ++i, pixel += 4, dst += 3) {
+                dst[0] = pixel[0];
+                dst[1] = pixel[1];
+                dst[2] = pixel[2];
+            }
+        }
+
+        for (window_t& win : frame->windows) {
+            if (y < win.y || y >= win.y + win.size) continue;
+
+            const int x0 = win.x, x1 = win.x + win.size;
+            win.red_like += pm[x1] - pm[x0];
+            win.sum[0] += pr[x1] - pr[x0];
+            win.sum[1] += pg[x1] - pg[x0];
+            win.sum[2] += pb[x1] - pb[x0];
+
+            if (y >= win.y + win.margin && y < win.y + win.size - win.margin) {
+                const int c0 = x0 + win.margin, c1 = x1 - win.margin;
+                win.center[0] += pr[c1] - pr[c0];
+                win.center[1] += pg[c1] - pg[c0];
+                win.center[2] += pb[c1] - pb[c0];
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+bool is_candidate(const window_t& win) {
+    const int total = win.size * win.size;
+    const int center_size = win.size - 2 * win.margin;
+    const int center_total = center_size * center_size;
+
+    float red_ratio = static_cast<float>(win.red_like) / total;
+
+    float contrast = 0.0f;
+    for (int c = 0; c < 3; ++c) {
+        contrast += fabs(static_cast<float>(win.sum[c]) / total - static_cast<float>(win.center[c]) / center_total);
+    }
+    contrast /= 255.0f;
+
+    return (red_ratio > 0.06f) && (contrast > 0.2f);
+}
+
+void resize_window_nearest(const detect_frame_t* frame, const window_t& win, uint8_t* dst) {
+    for (int y = 0; y < DETECT_INPUT_SIZE; ++y) {
+        int src_y = win.y + y * win.size / DETECT_INPUT_SIZE;
+        const uint8_t* src_row = &frame->rows[frame->row_slot[src_y] * frame->width * 3];
+        for (int x = 0; x < DETECT_INPUT_SIZE; ++x) {
+            int src_x = win.x + x * win.size / DETECT_INPUT_SIZE;
+            const uint8_t* src_pixel = &src_row[src_x * 3];
+            uint8_t* dst_pixel = &dst[(y * DETECT_INPUT_SIZE + x) * 3];
+            dst_pixel[0] = src_pixel[0];
+            dst_pixel[1] = src_pixel[1];
+            dst_pixel[2] = src_pixel[2];
+        }
+    }
+}
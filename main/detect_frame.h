@@ -0,0 +1,47 @@
+#ifndef DETECT_FRAME_H
+#define DETECT_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "esp_err.h"
+#include "buffer_pool.h"
+#include "jpeg_decoder.h"
+
+// Side of the square model input the windows are resized to
+#define DETECT_INPUT_SIZE 64
+
+// Sliding window of the pyramid, its statistics are accumulated band by band while the frame is decoded
+struct window_t {
+    int16_t x, y, size, margin;
+    float scale;
+    uint32_t red_like;
+    uint32_t sum[3];
+    uint32_t center[3];
+};
+
+struct detect_frame_t {
+    int width, height;
+    std::vector<window_t> windows;  // scan order: scale, y, x
+    int16_t* row_slot;              // slot of the image row in rows, -1 if the row is not sampled by any window
+    uint8_t* rows;                  // kept image rows, RGB888
+    uint32_t* prefix;               // prefix sums of R, G, B and red mask of the current row, 4 x (width + 1)
+    buffer_handle_t rows_buffer;    // BUFFER_CLASS_FRAME_ROWS, backs rows
+    buffer_handle_t stats_buffer;   // BUFFER_CLASS_FRAME_STATS, backs prefix and row_slot
+};
+
+// Windows of every pyramid level of a width x height frame, in scan order
+void detect_frame_windows(int width, int height, std::vector<window_t>& windows);
+// Sizes of the BUFFER_CLASS_FRAME_ROWS and BUFFER_CLASS_FRAME_STATS buffers a frame needs
+void detect_frame_buffer_sizes(int width, int height, size_t* rows_size, size_t* stats_size);
+// Takes its buffers from the pool, which must be initialised for one buffer of each class per frame
+detect_frame_t* detect_frame_create(int width, int height);
+void detect_frame_delete(detect_frame_t* frame);
+// esp_jpeg_decode_bands() callback for RGBM8888 bands, user_data is the detect_frame_t
+esp_err_t detect_frame_band_cb(const esp_jpeg_band_t* band, void* user_data);
+bool is_candidate(const window_t& win);
+// Nearest neighbour resize of the window to the model input, rows are read from the kept rows
+void resize_window_nearest(const detect_frame_t* frame, const window_t& win, uint8_t* dst);
+
+#endif // DETECT_FRAME_H
@@ -11,10 +11,15 @@
 
 #include "sign_detector.h"
 #include "sign_model.h"
+#include "sign_model_aot.h"
+#include "pipeline.h"
+#include "mem_telemetry.h"
+#include "model_memory.h"
+#include "op_profiler.h"
+#include "nn_worker.h"
 
 extern "C" {
 #include "http_server.h"
-#include "jpeg_decoder.h"
 }
 
 #include "tensorflow/lite/c/common.h"
@@ -22,15 +27,6 @@ extern "C" {
 
 #define TAG "MAIN"
 
-static const char* class_names[] = {
-    "50 speed limit",
-    "give way",
-    "STOP",
-    "no vehicles",
-    "no entry",
-    "pedestrian crossing"
-};
-
 #define PWDN_GPIO_NUM -1
 #define RESET_GPIO_NUM -1
 #define XCLK_GPIO_NUM 21
@@ -93,7 +89,7 @@ esp_err_t init_camera() {
         .pixel_format   = PIXFORMAT_JPEG,
         .frame_size     = FRAMESIZE_QVGA,
         .jpeg_quality   = 12,
-        .fb_count       = 1,
+        .fb_count       = 2,
         .fb_location    = CAMERA_FB_IN_PSRAM,
         .grab_mode      = CAMERA_GRAB_LATEST,
         .sccb_i2c_port  = 0
@@ -101,24 +97,9 @@ esp_err_t init_camera() {
     return esp_camera_init(&config);
 }
 
-void detect_task(void* arg) {
-    uint8_t* rgb_buffer = (uint8_t*)arg;
-
-    float confidence = 0.0f;
-    int prediction = detect_in_image(rgb_buffer, 320, 240, &confidence);
-    free(rgb_buffer);
-
-    if (prediction >= 0 && prediction < (int)(sizeof(class_names) / sizeof(class_names[0]))) {
-        ESP_LOGI("DETECTOR", "Znak: %s (conf: %.2f)", class_names[prediction], confidence);
-    } else {
-        ESP_LOGI("DETECTOR", "Brak znaku");
-    }
-
-    vTaskDelete(NULL);
-}
-
 extern "C" void app_main(void) {
     ESP_ERROR_CHECK(nvs_flash_init());
+    mem_telemetry_init();
 
     if (init_filesystem("/spiffs", nullptr) != ESP_OK) return;
     if (init_camera() != ESP_OK) return;
@@ -146,50 +127,23 @@ extern "C" void app_main(void) {
 
     int width = fb->width;
     int height = fb->height;
-    uint8_t* rgb_buffer = (uint8_t*)malloc(width * height * 3);
-    if (!rgb_buffer) {
-        ESP_LOGE(TAG, "Failed to allocate RGB buffer");
-        esp_camera_fb_return(fb);
-        return;
-    }
-
-    esp_jpeg_image_cfg_t jpeg_cfg = {
-        .indata = fb->buf,
-        .indata_size = fb->len,
-        .outbuf = rgb_buffer,
-        .outbuf_size = static_cast<uint32_t>(width * height * 3),
-        .out_format = JPEG_IMAGE_FORMAT_RGB888,
-        .out_scale = JPEG_IMAGE_SCALE_0,
-        .flags = {
-            .swap_color_bytes = false
-        },
-        .advanced = {
-            .working_buffer = NULL,
-            .working_buffer_size = 0
-        },
-        .priv = {
-            .read = 0
-        }
-    };
-
-    esp_jpeg_image_output_t jpeg_out;
-
-    esp_err_t decode_result = esp_jpeg_decode(&jpeg_cfg, &jpeg_out);
-
-    if (decode_result != ESP_OK) {
-        ESP_LOGE(TAG, "esp_jpeg_decode() failed");
-        free(rgb_buffer);
-        return;
-    }
-
     esp_camera_fb_return(fb);
 
     ESP_LOGI(TAG, "Free RAM before model load: %d bytes", heap_caps_get_free_size(MALLOC_CAP_8BIT));
 
+#if CONFIG_SIGN_AOT_MODEL
+    // The compiled model needs no interpreter, op resolver or tensor allocation
+    init_buffers();
+    mem_telemetry_set_arena(sign_model_arena_size(), sign_model_arena_size());
+    ESP_LOGI(TAG, "Compiled model, %u byte arena", (unsigned)sign_model_arena_size());
+    // The classifier runs on core 1, the other half of its layers on the capture core
+    if (nn_worker_start(0) != ESP_OK) {
+        ESP_LOGW(TAG, "Layers stay on one core");
+    }
+#else
     const tflite::Model* model = tflite::GetModel(sign_model_tflite);
     if (model->version() != TFLITE_SCHEMA_VERSION) {
         ESP_LOGE(TAG, "Model schema mismatch!");
-        free(rgb_buffer);
         return;
     }
 
@@ -205,21 +159,15 @@ extern "C" void app_main(void) {
     resolver.AddMaxPool2D();
     resolver.AddMean();
 
-    constexpr size_t tensor_arena_size = 384 * 1024;
-    static uint8_t* tensor_arena = (uint8_t*)heap_caps_malloc(tensor_arena_size, MALLOC_CAP_SPIRAM);
-    if (!tensor_arena) {
-        ESP_LOGE(TAG, "Failed to allocate tensor_arena");
-        return;
-    }
-    static tflite::MicroInterpreter static_interpreter(model, resolver, tensor_arena, tensor_arena_size);
-    interpreter = &static_interpreter;
-
-    if (interpreter->AllocateTensors() != kTfLiteOk) {
+    interpreter = model_memory_create_interpreter(model, resolver, op_profiler_instance());
+    if (!interpreter) {
         ESP_LOGE(TAG, "Failed to allocate tensors");
-        free(rgb_buffer);
         return;
     }
 
+    mem_telemetry_set_arena(model_memory_arena_size(), interpreter->arena_used_bytes());
+    op_profiler_init(interpreter, model);
+
     input = interpreter->input(0);
     output = interpreter->output(0);
 
@@ -233,15 +181,14 @@ extern "C" void app_main(void) {
     ESP_LOGI(TAG, "Output: type=%" PRId32 ", scale=%.5f, zero_point=%" PRId32,
              (int32_t)output->type, output->params.scale, (int32_t)output->params.zero_point);
 
+    model_memory_place_weights(interpreter, model);
+    model_memory_report(interpreter, model);
     init_buffers();
+    init_shared_features(model, width, height);
+#endif
+    op_profiler_reset();
 
-    xTaskCreatePinnedToCore(
-        detect_task,
-        "detect_task",
-        8192,
-        rgb_buffer,
-        5,
-        nullptr,
-        1
-    );
+    if (pipeline_start(width, height) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start pipeline");
+    }
 }
@@ -0,0 +1,206 @@
+#include <inttypes.h>
+#include <algorithm>
+#include "mem_telemetry.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+#define TAG "MEM"
+
+#define INTERNAL_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define SPIRAM_CAPS MALLOC_CAP_SPIRAM
+
+static const char* stage_names[PIPELINE_STAGE_COUNT] = {"other", "capture", "decode", "classify"};
+
+static portMUX_TYPE telemetry_lock = portMUX_INITIALIZER_UNLOCKED;
+static size_t internal_total = 0;
+static size_t spiram_total = 0;
+static size_t arena_size = 0;
+static size_t arena_used = 0;
+static mem_task_info_t tasks[MEM_TELEMETRY_MAX_TASKS];
+static int task_count = 0;
+static mem_stage_usage_t stage_usage[PIPELINE_STAGE_COUNT];
+// Lowest free bytes since boot, the heap's own minimum only covers the current monitor window
+static size_t internal_lowest_free = SIZE_MAX;
+static size_t spiram_lowest_free = SIZE_MAX;
+
+// Free bytes when a stage started and the lowest seen since
+struct stage_window_t {
+    bool active;
+    size_t internal_start_free;
+    size_t spiram_start_free;
+    size_t internal_min_free;
+    size_t spiram_min_free;
+};
+static stage_window_t windows[PIPELINE_STAGE_COUNT];
+static mem_sample_t samples[MEM_TELEMETRY_SAMPLES];
+static int sample_next = 0;
+static int sample_count = 0;
+
+static void heap_usage(uint32_t caps, mem_heap_usage_t* usage) {
+    usage->free = heap_caps_get_free_size(caps);
+    usage->largest_free_block = heap_caps_get_largest_free_block(caps);
+    const size_t lowest = caps == INTERNAL_CAPS ? internal_lowest_free : spiram_lowest_free;
+    usage->minimum_free = std::min(lowest, heap_caps_get_minimum_free_size(caps));
+}
+
+// Lowest free bytes since the monitor window opened, then opens the next one. Walks every heap under its own
+// lock, so it runs outside telemetry_lock.
+static void take_local_minimum(size_t* internal_min, size_t* spiram_min) {
+    *internal_min = heap_caps_get_minimum_free_size(INTERNAL_CAPS);
+    *spiram_min = heap_caps_get_minimum_free_size(SPIRAM_CAPS);
+    heap_caps_monitor_local_minimum_free_size_stop();
+    heap_caps_monitor_local_minimum_free_size_start();
+}
+
+// Folds the minimum of the closed window into the running stages, so each stage sees the minimum over its own
+// run. Called with telemetry_lock held.
+static void fold_local_minimum(size_t internal_min, size_t spiram_min) {
+    for (stage_window_t& window : windows) {
+        if (!window.active) continue;
+        window.internal_min_free = std::min(window.internal_min_free, internal_min);
+        window.spiram_min_free = std::min(window.spiram_min_free, spiram_min);
+    }
+    internal_lowest_free = std::min(internal_lowest_free, internal_min);
+    spiram_lowest_free = std::min(spiram_lowest_free, spiram_min);
+}
+
+void mem_telemetry_init() {
+    internal_total = heap_caps_get_total_size(INTERNAL_CAPS);
+    spiram_total = heap_caps_get_total_size(SPIRAM_CAPS);
+    internal_lowest_free = heap_caps_get_minimum_free_size(INTERNAL_CAPS);
+    spiram_lowest_free = heap_caps_get_minimum_free_size(SPIRAM_CAPS);
+    heap_caps_monitor_local_minimum_free_size_start();
+}
+
+void mem_telemetry_watch_task(TaskHandle_t task, const char* name, uint32_t stack_size) {
+    taskENTER_CRITICAL(&telemetry_lock);
+    if (task_count < MEM_TELEMETRY_MAX_TASKS) {
+        tasks[task_count++] = {task, name, stack_size};
+    }
+    taskEXIT_CRITICAL(&telemetry_lock);
+}
+
+void mem_telemetry_set_arena(size_t size, size_t used) {
+    arena_size = size;
+    arena_used = used;
+    ESP_LOGI(TAG, "Tensor arena: %u of %u bytes used", (unsigned)used, (unsigned)size);
+}
+
+void mem_telemetry_stage_start(pipeline_stage_t stage) {
+    size_t internal_min, spiram_min;
+    take_local_minimum(&internal_min, &spiram_min);
+    const size_t internal_free = heap_caps_get_free_size(INTERNAL_CAPS);
+    const size_t spiram_free = heap_caps_get_free_size(SPIRAM_CAPS);
+
+    taskENTER_CRITICAL(&telemetry_lock);
+    fold_local_minimum(internal_min, spiram_min);
+    stage_window_t& window = windows[stage];
+    window.active = true;
+    window.internal_start_free = internal_free;
+    window.spiram_start_free = spiram_free;
+    window.internal_min_free = internal_free;
+    window.spiram_min_free = spiram_free;
+    taskEXIT_CRITICAL(&telemetry_lock);
+}
+
+void mem_telemetry_stage_done(pipeline_stage_t stage) {
+    size_t internal_min, spiram_min;
+    take_local_minimum(&internal_min, &spiram_min);
+
+    taskENTER_CRITICAL(&telemetry_lock);
+    fold_local_minimum(internal_min, spiram_min);
+    stage_window_t& window = windows[stage];
+    if (window.active) {
+        window.active = false;
+        // used at the start plus what the stage took beyond it at its lowest free
+        const size_t internal_peak = (internal_total - window.internal_start_free) +
+                                     (window.internal_start_free - window.internal_min_free);
+        const size_t spiram_peak = (spiram_total - window.spiram_start_free) +
+                                   (window.spiram_start_free - window.spiram_min_free);
+        mem_stage_usage_t& usage = stage_usage[stage];
+        if (internal_peak > usage.internal_peak) usage.internal_peak = internal_peak;
+        if (spiram_peak > usage.spiram_peak) usage.spiram_peak = spiram_peak;
+        usage.samples++;
+    }
+    taskEXIT_CRITICAL(&telemetry_lock);
+}
+
+void mem_telemetry_sample(uint32_t frame) {
+    mem_sample_t sample = {};
+    sample.time_us = esp_timer_get_time();
+    sample.frame = frame;
+    heap_usage(INTERNAL_CAPS, &sample.internal);
+    heap_usage(SPIRAM_CAPS, &sample.spiram);
+    sample.arena_used = arena_used;
+
+    mem_task_info_t info[MEM_TELEMETRY_MAX_TASKS];
+    const int count = mem_telemetry_get_tasks(info);
+    for (int i = 0; i < count; ++i) {
+        sample.stack_free[i] = uxTaskGetStackHighWaterMark(info[i].task);
+    }
+
+    taskENTER_CRITICAL(&telemetry_lock);
+    samples[sample_next] = sample;
+    sample_next = (sample_next + 1) % MEM_TELEMETRY_SAMPLES;
+    if (sample_count < MEM_TELEMETRY_SAMPLES) sample_count++;
+    taskEXIT_CRITICAL(&telemetry_lock);
+}
+
+int mem_telemetry_get_samples(mem_sample_t* out, int max_samples) {
+    taskENTER_CRITICAL(&telemetry_lock);
+    const int count = sample_count < max_samples ? sample_count : max_samples;
+    // The newest count samples, oldest first
+    int index = (sample_next - count + MEM_TELEMETRY_SAMPLES) % MEM_TELEMETRY_SAMPLES;
+    for (int i = 0; i < count; ++i) {
+        out[i] = samples[index];
+        index = (index + 1) % MEM_TELEMETRY_SAMPLES;
+    }
+    taskEXIT_CRITICAL(&telemetry_lock);
+    return count;
+}
+
+void mem_telemetry_get_stage_usage(mem_stage_usage_t usage[PIPELINE_STAGE_COUNT]) {
+    taskENTER_CRITICAL(&telemetry_lock);
+    for (int stage = 0; stage < PIPELINE_STAGE_COUNT; ++stage) {
+        usage[stage] = stage_usage[stage];
+    }
+    taskEXIT_CRITICAL(&telemetry_lock);
+}
+
+int mem_telemetry_get_tasks(mem_task_info_t out[MEM_TELEMETRY_MAX_TASKS]) {
+    taskENTER_CRITICAL(&telemetry_lock);
+    for (int i = 0; i < task_count; ++i) {
+        out[i] = tasks[i];
+    }
+    const int count = task_count;
+    taskEXIT_CRITICAL(&telemetry_lock);
+    return count;
+}
+
+void mem_telemetry_log() {
+    mem_sample_t sample;
+    if (mem_telemetry_get_samples(&sample, 1) == 0) return;
+
+    ESP_LOGI(TAG, "internal free %u (largest %u, min %u) of %u, spiram free %u (largest %u, min %u) of %u",
+             (unsigned)sample.internal.free, (unsigned)sample.internal.largest_free_block,
+             (unsigned)sample.internal.minimum_free, (unsigned)internal_total,
+             (unsigned)sample.spiram.free, (unsigned)sample.spiram.largest_free_block,
+             (unsigned)sample.spiram.minimum_free, (unsigned)spiram_total);
+    ESP_LOGI(TAG, "tensor arena %u of %u used", (unsigned)sample.arena_used, (unsigned)arena_size);
+
+    mem_task_info_t info[MEM_TELEMETRY_MAX_TASKS];
+    const int count = mem_telemetry_get_tasks(info);
+    for (int i = 0; i < count; ++i) {
+        ESP_LOGI(TAG, "%s stack: %" PRIu32 " of %" PRIu32 " bytes never used", info[i].name,
+                 sample.stack_free[i], info[i].stack_size);
+    }
+
+    mem_stage_usage_t usage[PIPELINE_STAGE_COUNT];
+    mem_telemetry_get_stage_usage(usage);
+    for (int stage = 0; stage < PIPELINE_STAGE_COUNT; ++stage) {
+        if (!usage[stage].samples) continue;
+        ESP_LOGI(TAG, "%s peak: internal %u, spiram %u", stage_names[stage],
+                 (unsigned)usage[stage].internal_peak, (unsigned)usage[stage].spiram_peak);
+    }
+}
@@ -0,0 +1,59 @@
+#ifndef MEM_TELEMETRY_H
+#define MEM_TELEMETRY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "pipeline.h"
+
+// Ring of memory samples taken while the pipeline runs, the oldest sample is overwritten
+#define MEM_TELEMETRY_SAMPLES 32
+#define MEM_TELEMETRY_MAX_TASKS 4
+
+struct mem_heap_usage_t {
+    size_t free;                // free bytes when sampled
+    size_t largest_free_block;  // largest allocation that would succeed when sampled
+    size_t minimum_free;        // lowest free bytes since boot
+};
+
+struct mem_sample_t {
+    int64_t time_us;
+    uint32_t frame;                                // frames decoded when sampled
+    mem_heap_usage_t internal;                     // MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT
+    mem_heap_usage_t spiram;                       // MALLOC_CAP_SPIRAM
+    size_t arena_used;                             // tensor arena bytes used by the interpreter
+    uint32_t stack_free[MEM_TELEMETRY_MAX_TASKS];  // least free stack bytes of the watched tasks
+};
+
+// Highest heap usage seen while a stage ran, its own temporaries included. The heaps are shared, so a stage
+// running on the other core at the same time counts too.
+struct mem_stage_usage_t {
+    size_t internal_peak;
+    size_t spiram_peak;
+    uint32_t samples;
+};
+
+struct mem_task_info_t {
+    TaskHandle_t task;
+    const char* name;
+    uint32_t stack_size;
+};
+
+void mem_telemetry_init();
+// Watched tasks get a column in stack_free, in the order they were added
+void mem_telemetry_watch_task(TaskHandle_t task, const char* name, uint32_t stack_size);
+void mem_telemetry_set_arena(size_t size, size_t used);
+// Bracket a stage: the lowest free heap in between gives its peak usage, cheap enough for every frame
+void mem_telemetry_stage_start(pipeline_stage_t stage);
+void mem_telemetry_stage_done(pipeline_stage_t stage);
+// Takes a full sample into the ring, walks the heaps for the largest free blocks
+void mem_telemetry_sample(uint32_t frame);
+// Copies up to max_samples samples, oldest first, returns how many were copied
+int mem_telemetry_get_samples(mem_sample_t* samples, int max_samples);
+void mem_telemetry_get_stage_usage(mem_stage_usage_t usage[PIPELINE_STAGE_COUNT]);
+int mem_telemetry_get_tasks(mem_task_info_t tasks[MEM_TELEMETRY_MAX_TASKS]);
+void mem_telemetry_log();
+
+#endif // MEM_TELEMETRY_H
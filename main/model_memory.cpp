@@ -0,0 +1,252 @@
+#include <new>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include "model_memory.h"
+#include "buffer_pool.h"
+#include "op_profiler.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "sdkconfig.h"
+
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/micro/micro_allocator.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#define TAG "MODEL_MEMORY"
+
+#define INTERNAL_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define REPORT_INVOKES 5
+
+#if CONFIG_SIGN_WEIGHTS_PSRAM
+#define WEIGHTS_CAPS MALLOC_CAP_SPIRAM
+#else
+#define WEIGHTS_CAPS INTERNAL_CAPS
+#endif
+
+#ifndef CONFIG_SIGN_ARENA_SPLIT
+#define CONFIG_SIGN_ARENA_PERSISTENT_SIZE 0
+#define CONFIG_SIGN_ARENA_INTERNAL_SIZE 0
+#endif
+
+static const char* layout_names[] = {"internal", "split", "psram"};
+
+alignas(tflite::MicroInterpreter) static uint8_t interpreter_storage[sizeof(tflite::MicroInterpreter)];
+static buffer_handle_t arena;
+static buffer_handle_t persistent_arena;
+static buffer_handle_t weights_buffer;
+static model_arena_layout_t layout = MODEL_ARENA_PSRAM;
+
+static bool init_arena(buffer_class_t cls, size_t size, uint32_t caps, buffer_handle_t& handle) {
+    if (buffer_pool_init(cls, size, 1, caps) != ESP_OK) {
+        return false;
+    }
+    handle = buffer_pool_acquire(cls);
+    return static_cast<bool>(handle);
+}
+
+static void release_arenas() {
+    arena.reset();
+    persistent_arena.reset();
+    buffer_pool_deinit(BUFFER_CLASS_TENSOR_ARENA);
+    buffer_pool_deinit(BUFFER_CLASS_TENSOR_PERSISTENT);
+}
+
+static tflite::MicroInterpreter* try_create(const tflite::Model* model, const tflite::MicroOpResolver& resolver,
+                                            tflite::MicroProfilerInterface* profiler, model_arena_layout_t try_layout) {
+    tflite::MicroAllocator* allocator = nullptr;
+    if (try_layout == MODEL_ARENA_PSRAM) {
+        if (init_arena(BUFFER_CLASS_TENSOR_ARENA, CONFIG_SIGN_ARENA_SIZE * 1024, MALLOC_CAP_SPIRAM, arena)) {
+            allocator = tflite::MicroAllocator::Create(arena.data(), arena.size());
+        }
+    } else {
+        // The persistent data (tensor structs, op data) is read by every op, activations only by their neighbours
+        const bool internal = try_layout == MODEL_ARENA_INTERNAL;
+        const size_t activations_size = (internal ? CONFIG_SIGN_ARENA_INTERNAL_SIZE : CONFIG_SIGN_ARENA_SIZE) * 1024;
+        if (init_arena(BUFFER_CLASS_TENSOR_PERSISTENT, CONFIG_SIGN_ARENA_PERSISTENT_SIZE * 1024, INTERNAL_CAPS,
+                       persistent_arena) &&
+            init_arena(BUFFER_CLASS_TENSOR_ARENA, activations_size, internal ? INTERNAL_CAPS : MALLOC_CAP_SPIRAM,
+                       arena)) {
+            allocator = tflite::MicroAllocator::Create(persistent_arena.data(), persistent_arena.size(),
+                                                       arena.data(), arena.size());
+        }
+    }
+    if (!allocator) {
+        release_arenas();
+        return nullptr;
+    }
+
+    tflite::MicroInterpreter* interpreter =
+        new (interpreter_storage) tflite::MicroInterpreter(model, resolver, allocator, nullptr, profiler);
+    if (interpreter->AllocateTensors() != kTfLiteOk) {
+        interpreter->~MicroInterpreter();
+        release_arenas();
+        return nullptr;
+    }
+    layout = try_layout;
+    return interpreter;
+}
+
+tflite::MicroInterpreter* model_memory_create_interpreter(const tflite::Model* model,
+                                                         const tflite::MicroOpResolver& resolver,
+                                                         tflite::MicroProfilerInterface* profiler) {
+    const model_arena_layout_t first = CONFIG_SIGN_ARENA_INTERNAL_SIZE ? MODEL_ARENA_INTERNAL
+                                     : CONFIG_SIGN_ARENA_PERSISTENT_SIZE ? MODEL_ARENA_SPLIT
+                                     : MODEL_ARENA_PSRAM;
+    for (int l = first; l <= MODEL_ARENA_PSRAM; ++l) {
+        tflite::MicroInterpreter* interpreter = try_create(model, resolver, profiler, static_cast<model_arena_layout_t>(l));
+        if (interpreter) {
+            ESP_LOGI(TAG, "Tensor arena layout: %s, %u bytes used", layout_names[l],
+                     (unsigned)interpreter->arena_used_bytes());
+            return interpreter;
+        }
+        if (l < MODEL_ARENA_PSRAM) {
+            ESP_LOGW(TAG, "Tensor arena layout %s does not fit, trying %s", layout_names[l], layout_names[l + 1]);
+        }
+    }
+    return nullptr;
+}
+
+model_arena_layout_t model_memory_layout() {
+    return layout;
+}
+
+size_t model_memory_arena_size() {
+    return arena.size() + persistent_arena.size();
+}
+
+enum memory_region_t { REGION_INTERNAL, REGION_PSRAM, REGION_FLASH, REGION_OTHER, REGION_COUNT };
+static const char* region_names[REGION_COUNT] = {"internal", "psram", "flash", "other"};
+
+static memory_region_t memory_region(const void* ptr) {
+    if (esp_ptr_external_ram(ptr)) return REGION_PSRAM;
+    if (esp_ptr_internal(ptr)) return REGION_INTERNAL;
+    if (esp_ptr_in_drom(ptr)) return REGION_FLASH;
+    return REGION_OTHER;
+}
+
+// Timing on a blank input, classification overwrites it for every window. Logs the operator profile
+// of these invokes only
+static float mean_invoke_ms(tflite::MicroInterpreter* interpreter) {
+    TfLiteTensor* input = interpreter->input(0);
+    memset(input->data.raw, 0, input->bytes);
+    op_profiler_reset();
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < REPORT_INVOKES; ++i) {
+        if (op_profiler_invoke(interpreter) != kTfLiteOk) {
+            ESP_LOGW(TAG, "Invoke failed");
+            return 0.0f;
+        }
+    }
+    const float ms = (esp_timer_get_time() - start) / 1000.0f / REPORT_INVOKES;
+    op_profiler_log();
+    return ms;
+}
+
+struct weight_tensor_t {
+    int index;
+    size_t bytes;
+    uint32_t reads;  // times every element is read by one Invoke()
+};
+
+// Constant inputs of the operators, convolutions read their filter once per output position
+static std::vector<weight_tensor_t> weight_tensors(tflite::MicroInterpreter* interpreter, const tflite::Model* model) {
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    std::vector<weight_tensor_t> weights;
+
+    for (const tflite::Operator* op : *subgraph->operators()) {
+        const tflite::BuiltinOperator code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+        uint32_t reads = 1;
+        if (code == tflite::BuiltinOperator_CONV_2D || code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D) {
+            const TfLiteEvalTensor* out = interpreter->GetTensor(op->outputs()->Get(0));
+            reads = out->dims->data[1] * out->dims->data[2];
+        }
+
+        for (int32_t index : *op->inputs()) {
+            if (index < 0) continue;
+            const TfLiteEvalTensor* tensor = interpreter->GetTensor(index);
+            size_t bytes = 0;
+            if (!tensor->data.raw || !esp_ptr_in_drom(tensor->data.raw) ||
+                tflite::TfLiteEvalTensorByteLength(tensor, &bytes) != kTfLiteOk) {
+                continue;
+            }
+            auto it = std::find_if(weights.begin(), weights.end(),
+                                   [index](const weight_tensor_t& w) { return w.index == index; });
+            if (it != weights.end()) {
+                it->reads += reads;
+            } else {
+                weights.push_back({index, bytes, reads});
+            }
+        }
+    }
+    return weights;
+}
+
+void model_memory_place_weights(tflite::MicroInterpreter* interpreter, const tflite::Model* model) {
+#if CONFIG_SIGN_WEIGHTS_FLASH
+    ESP_LOGI(TAG, "Weights stay in flash");
+#else
+    std::vector<weight_tensor_t> weights = weight_tensors(interpreter, model);
+    // Most read first, a byte moved out of flash saves one cache fetch per read
+    std::sort(weights.begin(), weights.end(), [](const weight_tensor_t& a, const weight_tensor_t& b) {
+        return a.reads != b.reads ? a.reads > b.reads : a.bytes < b.bytes;
+    });
+
+    const size_t budget = CONFIG_SIGN_WEIGHTS_BUDGET * 1024;
+    size_t total = 0;
+    std::vector<weight_tensor_t> selected;
+    for (const weight_tensor_t& w : weights) {
+        const size_t aligned = (w.bytes + BUFFER_POOL_ALIGN - 1) & ~(size_t)(BUFFER_POOL_ALIGN - 1);
+        if (total + aligned > budget) continue;
+        total += aligned;
+        selected.push_back(w);
+    }
+    weights.swap(selected);
+    if (weights.empty()) {
+        ESP_LOGI(TAG, "No weights fit in %u bytes", (unsigned)budget);
+        return;
+    }
+
+    const float flash_ms = mean_invoke_ms(interpreter);
+    if (buffer_pool_init(BUFFER_CLASS_MODEL_WEIGHTS, total, 1, WEIGHTS_CAPS) != ESP_OK) {
+        ESP_LOGW(TAG, "No %u bytes with caps 0x%x for the weights, they stay in flash", (unsigned)total,
+                 (unsigned)WEIGHTS_CAPS);
+        return;
+    }
+    weights_buffer = buffer_pool_acquire(BUFFER_CLASS_MODEL_WEIGHTS);
+
+    // Kernels read constant tensors through their eval tensors on every Invoke(), repointing them is enough
+    uint8_t* dst = weights_buffer.data();
+    for (const weight_tensor_t& w : weights) {
+        TfLiteEvalTensor* tensor = interpreter->GetTensor(w.index);
+        memcpy(dst, tensor->data.raw, w.bytes);
+        tensor->data.raw = reinterpret_cast<char*>(dst);
+        ESP_LOGI(TAG, "weights %2d: %6u bytes, %4u reads per invoke", w.index, (unsigned)w.bytes, (unsigned)w.reads);
+        dst += (w.bytes + BUFFER_POOL_ALIGN - 1) & ~(size_t)(BUFFER_POOL_ALIGN - 1);
+    }
+    ESP_LOGI(TAG, "Moved %d weight tensors (%u bytes) out of flash, Invoke %.2f ms -> %.2f ms",
+             (int)weights.size(), (unsigned)total, flash_ms, mean_invoke_ms(interpreter));
+#endif
+}
+
+void model_memory_report(tflite::MicroInterpreter* interpreter, const tflite::Model* model) {
+    const int tensor_count = model->subgraphs()->Get(0)->tensors()->size();
+    size_t region_bytes[REGION_COUNT] = {};
+
+    for (int i = 0; i < tensor_count; ++i) {
+        const TfLiteEvalTensor* tensor = interpreter->GetTensor(i);
+        size_t bytes = 0;
+        if (!tensor || !tensor->data.raw || tflite::TfLiteEvalTensorByteLength(tensor, &bytes) != kTfLiteOk) {
+            continue;
+        }
+        const memory_region_t region = memory_region(tensor->data.raw);
+        region_bytes[region] += bytes;
+        ESP_LOGI(TAG, "tensor %2d: %6u bytes in %s", i, (unsigned)bytes, region_names[region]);
+    }
+    ESP_LOGI(TAG, "Tensor bytes: internal %u, psram %u, flash %u", (unsigned)region_bytes[REGION_INTERNAL],
+             (unsigned)region_bytes[REGION_PSRAM], (unsigned)region_bytes[REGION_FLASH]);
+
+    ESP_LOGI(TAG, "Invoke with %s arena: %.2f ms", layout_names[layout], mean_invoke_ms(interpreter));
+}
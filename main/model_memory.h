@@ -0,0 +1,32 @@
+#ifndef MODEL_MEMORY_H
+#define MODEL_MEMORY_H
+
+#include <stddef.h>
+
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Where the interpreter keeps its tensors, from the fastest layout to the one that always fits
+enum model_arena_layout_t {
+    MODEL_ARENA_INTERNAL,    // persistent data, activations and scratch in internal RAM
+    MODEL_ARENA_SPLIT,       // persistent data in internal RAM, activations and scratch in PSRAM
+    MODEL_ARENA_PSRAM,       // one arena in PSRAM
+};
+
+// Creates the interpreter and allocates its tensors in the fastest layout enabled in menuconfig
+// that fits the model, returns nullptr if not even the PSRAM arena fits
+tflite::MicroInterpreter* model_memory_create_interpreter(const tflite::Model* model,
+                                                         const tflite::MicroOpResolver& resolver,
+                                                         tflite::MicroProfilerInterface* profiler);
+model_arena_layout_t model_memory_layout();
+// Arena bytes reserved for the interpreter, persistent and non-persistent
+size_t model_memory_arena_size();
+// Copies the most read constant tensors out of flash as configured in menuconfig and logs the Invoke() time
+// before and after, must run after AllocateTensors()
+void model_memory_place_weights(tflite::MicroInterpreter* interpreter, const tflite::Model* model);
+// Logs the memory region of every tensor of the main subgraph and the mean Invoke() time
+void model_memory_report(tflite::MicroInterpreter* interpreter, const tflite::Model* model);
+
+#endif // MODEL_MEMORY_H
@@ -0,0 +1,74 @@
+#include "nn_worker.h"
+
+#if CONFIG_SIGN_DUAL_CORE_KERNELS
+
+#include <atomic>
+#include "esp_nn.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define TAG "NN_WORKER"
+
+#define WORKER_TASK_STACK 4096
+// Above the pipeline tasks: a decode running on the worker's core waits for the half layer
+#define WORKER_TASK_PRIORITY 6
+#define WORKER_SCRATCH_SIZE (ESP_NN_WINOGRAD_MAX_CHANNELS * 16 * sizeof(int16_t))
+
+static TaskHandle_t worker_handle = nullptr;
+static void (*job_fn)(void*) = nullptr;
+static void* job_arg = nullptr;
+static std::atomic<bool> job_done{true};
+static std::atomic<uint32_t> jobs{0};
+static esp_nn_worker_t worker = {};
+
+static void worker_task(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        job_fn(job_arg);
+        jobs.fetch_add(1, std::memory_order_relaxed);
+        job_done.store(true, std::memory_order_release);
+    }
+}
+
+static void start_job(void (*job)(void*), void* arg) {
+    job_fn = job;
+    job_arg = arg;
+    job_done.store(false, std::memory_order_relaxed);
+    xTaskNotifyGive(worker_handle);
+}
+
+// Spin barrier: the calling core ran the other half meanwhile, so the wait is short and a blocking wait would
+// cost more in context switches than it saves
+static void wait_job() {
+    while (!job_done.load(std::memory_order_acquire)) {
+    }
+}
+
+esp_err_t nn_worker_start(int core) {
+    if (worker_handle) {
+        return ESP_OK;
+    }
+    void* scratch = heap_caps_malloc(WORKER_SCRATCH_SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!scratch) {
+        ESP_LOGE(TAG, "No internal RAM for the worker scratch");
+        return ESP_ERR_NO_MEM;
+    }
+    if (xTaskCreatePinnedToCore(worker_task, "nn_worker", WORKER_TASK_STACK, nullptr, WORKER_TASK_PRIORITY,
+                                &worker_handle, core) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create the worker task");
+        heap_caps_free(scratch);
+        return ESP_ERR_NO_MEM;
+    }
+    worker = {start_job, wait_job, scratch, (int32_t)WORKER_SCRATCH_SIZE, CONFIG_SIGN_DUAL_CORE_MIN_MACS};
+    esp_nn_set_worker(&worker);
+    ESP_LOGI(TAG, "Layers from %d MACs split with core %d", CONFIG_SIGN_DUAL_CORE_MIN_MACS, core);
+    return ESP_OK;
+}
+
+uint32_t nn_worker_jobs() {
+    return jobs.load(std::memory_order_relaxed);
+}
+
+#endif // CONFIG_SIGN_DUAL_CORE_KERNELS
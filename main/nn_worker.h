@@ -0,0 +1,26 @@
+#ifndef NN_WORKER_H
+#define NN_WORKER_H
+
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+// Persistent task on the other core that runs half of every large enough esp-nn convolution and fully
+// connected layer called through esp_nn_parallel.h, the compiled model's kernels. A job is handed over with a
+// task notification and its end is awaited by spinning, the calling core has finished its own half by then.
+// Without CONFIG_SIGN_DUAL_CORE_KERNELS nothing starts and the kernels stay on the calling core.
+
+#if CONFIG_SIGN_DUAL_CORE_KERNELS
+
+// Starts the worker pinned to core and hands it to esp-nn, with its Winograd scratch in internal RAM
+esp_err_t nn_worker_start(int core);
+// Jobs the worker ran since it started
+uint32_t nn_worker_jobs();
+
+#else
+
+static inline esp_err_t nn_worker_start(int core) { return ESP_OK; }
+static inline uint32_t nn_worker_jobs() { return 0; }
+
+#endif // CONFIG_SIGN_DUAL_CORE_KERNELS
+
+#endif // NN_WORKER_H
@@ -0,0 +1,181 @@
+#include "op_profiler.h"
+
+#if CONFIG_SIGN_OP_PROFILER
+
+#include <inttypes.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#if CONFIG_IDF_TARGET_LINUX
+#include <chrono>
+#else
+#include "esp_cpu.h"
+#endif
+
+#define TAG "OP_PROFILER"
+
+#if CONFIG_IDF_TARGET_LINUX
+#define TICK_UNIT "ns"
+#define TICKS_PER_US 1000
+
+// Wraps every 4.3 s, the differences of an operator or an Invoke() stay exact
+static uint32_t ticks() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+#else
+#define TICK_UNIT "cycles"
+#define TICKS_PER_US CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+
+static uint32_t ticks() {
+    return esp_cpu_get_cycle_count();
+}
+#endif
+
+// Events arrive in execution order, one per operator, the handle is the operator index
+class op_profiler_t : public tflite::MicroProfilerInterface {
+public:
+    uint32_t BeginEvent(const char* tag) override;
+    void EndEvent(uint32_t event_handle) override;
+
+    void begin_invoke() { next_op_ = 0; }
+
+private:
+    int next_op_ = 0;
+    uint32_t start_[OP_PROFILER_MAX_OPS] = {};
+};
+
+static op_profiler_t profiler;
+static portMUX_TYPE profiler_lock = portMUX_INITIALIZER_UNLOCKED;
+static op_profile_t ops[OP_PROFILER_MAX_OPS];
+static int op_count = 0;
+static uint32_t invokes = 0;
+static uint64_t invoke_ticks = 0;
+
+uint32_t op_profiler_t::BeginEvent(const char* tag) {
+    const int op = next_op_++;
+    if (op >= OP_PROFILER_MAX_OPS) return OP_PROFILER_MAX_OPS;
+    // the tags were set by op_profiler_init(), ops[] is only written under profiler_lock
+    start_[op] = ticks();
+    return op;
+}
+
+void op_profiler_t::EndEvent(uint32_t event_handle) {
+    const uint32_t end = ticks();
+    if (event_handle >= OP_PROFILER_MAX_OPS) return;
+    const uint32_t elapsed = end - start_[event_handle];
+
+    taskENTER_CRITICAL(&profiler_lock);
+    op_profile_t& op = ops[event_handle];
+    op.invocations++;
+    op.total_ticks += elapsed;
+    if (elapsed > op.max_ticks) op.max_ticks = elapsed;
+    if ((int)event_handle >= op_count) op_count = event_handle + 1;
+    taskEXIT_CRITICAL(&profiler_lock);
+}
+
+tflite::MicroProfilerInterface* op_profiler_instance() {
+    return &profiler;
+}
+
+static uint32_t tensor_bytes(tflite::MicroInterpreter* interpreter, int index) {
+    size_t bytes = 0;
+    const TfLiteEvalTensor* tensor = interpreter->GetTensor(index);
+    if (!tensor || tflite::TfLiteEvalTensorByteLength(tensor, &bytes) != kTfLiteOk) return 0;
+    return bytes;
+}
+
+void op_profiler_init(tflite::MicroInterpreter* interpreter, const tflite::Model* model) {
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    const int count = subgraph->operators()->size();
+    if (count > OP_PROFILER_MAX_OPS) {
+        ESP_LOGW(TAG, "Model has %d operators, profiling the first %d", count, OP_PROFILER_MAX_OPS);
+    }
+
+    taskENTER_CRITICAL(&profiler_lock);
+    for (int i = 0; i < count && i < OP_PROFILER_MAX_OPS; ++i) {
+        const tflite::Operator* op = subgraph->operators()->Get(i);
+        op_profile_t& profile = ops[i];
+        profile = {};
+        profile.tag = tflite::EnumNameBuiltinOperator(
+            tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index())));
+
+        for (int32_t index : *op->inputs()) {
+            if (index < 0) continue;
+            const tflite::Buffer* buffer = model->buffers()->Get(subgraph->tensors()->Get(index)->buffer());
+            const bool constant = buffer->data() && buffer->data()->size();
+            (constant ? profile.weight_bytes : profile.input_bytes) += tensor_bytes(interpreter, index);
+        }
+        for (int32_t index : *op->outputs()) {
+            profile.output_bytes += tensor_bytes(interpreter, index);
+        }
+    }
+    taskEXIT_CRITICAL(&profiler_lock);
+}
+
+TfLiteStatus op_profiler_invoke(tflite::MicroInterpreter* interpreter) {
+    profiler.begin_invoke();
+    const uint32_t start = ticks();
+    const TfLiteStatus status = interpreter->Invoke();
+    const uint32_t elapsed = ticks() - start;
+
+    taskENTER_CRITICAL(&profiler_lock);
+    invokes++;
+    invoke_ticks += elapsed;
+    taskEXIT_CRITICAL(&profiler_lock);
+    return status;
+}
+
+int op_profiler_get(op_profile_t* out, int max_ops, op_profiler_summary_t* summary) {
+    taskENTER_CRITICAL(&profiler_lock);
+    const int count = op_count < max_ops ? op_count : max_ops;
+    for (int i = 0; i < count; ++i) {
+        out[i] = ops[i];
+    }
+    summary->invokes = invokes;
+    summary->invoke_ticks = invoke_ticks;
+    summary->op_count = op_count;
+    taskEXIT_CRITICAL(&profiler_lock);
+
+    summary->unit = TICK_UNIT;
+    summary->ticks_per_us = TICKS_PER_US;
+    return count;
+}
+
+// Keeps the tags and tensor sizes
+void op_profiler_reset() {
+    taskENTER_CRITICAL(&profiler_lock);
+    for (int i = 0; i < OP_PROFILER_MAX_OPS; ++i) {
+        ops[i].invocations = 0;
+        ops[i].total_ticks = 0;
+        ops[i].max_ticks = 0;
+    }
+    invokes = 0;
+    invoke_ticks = 0;
+    taskEXIT_CRITICAL(&profiler_lock);
+}
+
+void op_profiler_log() {
+    static op_profile_t snapshot[OP_PROFILER_MAX_OPS];
+    op_profiler_summary_t summary;
+    const int count = op_profiler_get(snapshot, OP_PROFILER_MAX_OPS, &summary);
+    if (!summary.invokes) return;
+
+    const uint64_t mean_invoke = summary.invoke_ticks / summary.invokes;
+    ESP_LOGI(TAG, "%" PRIu32 " invokes, %" PRIu64 " %s (%.2f ms) each", summary.invokes, mean_invoke, summary.unit,
+             mean_invoke / (summary.ticks_per_us * 1000.0f));
+    for (int i = 0; i < count; ++i) {
+        const op_profile_t& op = snapshot[i];
+        if (!op.invocations) continue;
+        const uint64_t mean = op.total_ticks / op.invocations;
+        ESP_LOGI(TAG, "%2d %-16s %5.1f%% %10" PRIu64 " mean %10" PRIu32 " max, in %" PRIu32 " weights %" PRIu32
+                 " out %" PRIu32 " bytes",
+                 i, op.tag, 100.0f * op.total_ticks / summary.invoke_ticks, mean, op.max_ticks,
+                 op.input_bytes, op.weight_bytes, op.output_bytes);
+    }
+}
+
+#endif
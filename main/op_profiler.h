@@ -0,0 +1,63 @@
+#ifndef OP_PROFILER_H
+#define OP_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+// Times every operator of Invoke() through the MicroProfilerInterface of TFLite Micro. On the chip a tick
+// is a CPU cycle of the core running Invoke(), in the linux host build a nanosecond of the steady clock.
+// Without CONFIG_SIGN_OP_PROFILER the API compiles away and Invoke() runs unprofiled.
+
+#define OP_PROFILER_MAX_OPS 32
+
+struct op_profile_t {
+    const char* tag;        // operator name reported by TFLite Micro
+    uint32_t invocations;
+    uint64_t total_ticks;
+    uint32_t max_ticks;
+    uint32_t input_bytes;   // activations read
+    uint32_t weight_bytes;  // constant inputs read
+    uint32_t output_bytes;
+};
+
+struct op_profiler_summary_t {
+    uint32_t invokes;
+    uint64_t invoke_ticks;  // whole Invoke() calls, interpreter overhead included
+    int op_count;
+    const char* unit;
+    uint32_t ticks_per_us;
+};
+
+#if CONFIG_SIGN_OP_PROFILER
+
+// Profiler to construct the interpreter with
+tflite::MicroProfilerInterface* op_profiler_instance();
+// Fills the tensor sizes of every operator, must run after AllocateTensors()
+void op_profiler_init(tflite::MicroInterpreter* interpreter, const tflite::Model* model);
+// Invoke() with the events attributed to the operators in execution order
+TfLiteStatus op_profiler_invoke(tflite::MicroInterpreter* interpreter);
+// Copies up to max_ops operators, returns how many
+int op_profiler_get(op_profile_t* ops, int max_ops, op_profiler_summary_t* summary);
+void op_profiler_reset();
+void op_profiler_log();
+
+#else
+
+static inline tflite::MicroProfilerInterface* op_profiler_instance() { return nullptr; }
+static inline void op_profiler_init(tflite::MicroInterpreter* interpreter, const tflite::Model* model) {}
+static inline TfLiteStatus op_profiler_invoke(tflite::MicroInterpreter* interpreter) { return interpreter->Invoke(); }
+static inline int op_profiler_get(op_profile_t* ops, int max_ops, op_profiler_summary_t* summary) {
+    *summary = {};
+    return 0;
+}
+static inline void op_profiler_reset() {}
+static inline void op_profiler_log() {}
+
+#endif
+
+#endif // OP_PROFILER_H
@@ -0,0 +1,280 @@
+#include <inttypes.h>
+#include "pipeline.h"
+#include "sign_detector.h"
+#include "buffer_pool.h"
+#include "alloc_audit.h"
+#include "mem_telemetry.h"
+#include "op_profiler.h"
+#include "esp_camera.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+
+extern "C" {
+#include "jpeg_decoder.h"
+}
+
+#define TAG "PIPELINE"
+
+// Same work buffer size as esp_jpeg allocates for the configured optimization level
+#if CONFIG_JD_FASTDECODE == 2
+#define JPEG_WORK_BUF_SIZE 65472
+#elif CONFIG_JD_FASTDECODE == 1
+#define JPEG_WORK_BUF_SIZE 3500
+#else
+#define JPEG_WORK_BUF_SIZE 3100
+#endif
+
+static const char* class_names[] = {
+    "50 speed limit",
+    "give way",
+    "STOP",
+    "no vehicles",
+    "no entry",
+    "pedestrian crossing"
+};
+
+struct frame_slot_t {
+    detect_frame_t* frame;
+    uint32_t id;
+};
+
+static frame_slot_t slots[PIPELINE_FRAME_SLOTS];
+static QueueHandle_t free_queue = nullptr;   // slots ready to be decoded into
+static QueueHandle_t ready_queue = nullptr;  // latest decoded slot, waiting for the classifier
+static buffer_handle_t band_buffer;
+static buffer_handle_t jpeg_work_buffer;
+static pipeline_stats_t stats = {};
+
+#define CAPTURE_TASK_STACK 4096
+#define CLASSIFY_TASK_STACK 8192
+
+// Closes the stage the calling task was in and attributes what follows to the next one
+static void enter_stage(pipeline_stage_t& current, pipeline_stage_t next) {
+    if (current != PIPELINE_STAGE_OTHER) {
+        mem_telemetry_stage_done(current);
+    }
+    if (next != PIPELINE_STAGE_OTHER) {
+        mem_telemetry_stage_start(next);
+    }
+    alloc_audit_set_stage(next);
+    current = next;
+}
+
+// Takes a slot to decode the next frame into, the waiting frame is dropped if no slot is free
+static frame_slot_t* acquire_slot() {
+    frame_slot_t* slot = nullptr;
+    if (xQueueReceive(free_queue, &slot, 0) == pdTRUE) {
+        return slot;
+    }
+    if (xQueueReceive(ready_queue, &slot, 0) == pdTRUE) {
+        stats.dropped++;
+        return slot;
+    }
+    // Classifier holds every other slot, wait until it returns one
+    xQueueReceive(free_queue, &slot, portMAX_DELAY);
+    return slot;
+}
+
+// Publishes the decoded slot, latest frame wins
+static void publish_slot(frame_slot_t* slot) {
+    frame_slot_t* stale = nullptr;
+    if (xQueueReceive(ready_queue, &stale, 0) == pdTRUE) {
+        stats.dropped++;
+        xQueueSend(free_queue, &stale, 0);
+    }
+    xQueueSend(ready_queue, &slot, 0);
+}
+
+static void log_stats(int64_t& last_time, uint32_t& last_decoded, uint32_t& last_classified) {
+    int64_t now = esp_timer_get_time();
+    float seconds = (now - last_time) / 1000000.0f;
+    uint32_t decoded = stats.decoded, classified = stats.classified;
+    stats.capture_fps = (decoded - last_decoded) / seconds;
+    stats.classify_fps = (classified - last_classified) / seconds;
+    last_time = now;
+    last_decoded = decoded;
+    last_classified = classified;
+
+    pipeline_stats_t s;
+    pipeline_get_stats(&s);
+    ESP_LOGI(TAG, "capture %.1f fps, classify %.1f fps, captured %" PRIu32 ", dropped %" PRIu32
+             ", failed %" PRIu32 "/%" PRIu32 ", ready %" PRIu32 ", free %" PRIu32,
+             s.capture_fps, s.classify_fps, s.captured, s.dropped,
+             s.capture_failed, s.decode_failed, s.ready_depth, s.free_depth);
+
+    mem_telemetry_sample(decoded);
+    mem_telemetry_log();
+    op_profiler_log();
+
+#if CONFIG_ALLOC_AUDIT
+    alloc_audit_stats_t audit;
+    alloc_audit_get_stats(&audit);
+    ESP_LOGI(TAG, "allocations last frame: capture %" PRIu32 ", decode %" PRIu32 " (%" PRIu32 " B), classify %"
+             PRIu32 " (%" PRIu32 " B), violations %" PRIu32,
+             audit.frame_count[PIPELINE_STAGE_CAPTURE], audit.frame_count[PIPELINE_STAGE_DECODE],
+             audit.frame_bytes[PIPELINE_STAGE_DECODE], audit.frame_count[PIPELINE_STAGE_CLASSIFY],
+             audit.frame_bytes[PIPELINE_STAGE_CLASSIFY], audit.violations);
+#endif
+
+    for (int cls = 0; cls < BUFFER_CLASS_COUNT; ++cls) {
+        buffer_pool_stats_t pool;
+        buffer_pool_get_stats(static_cast<buffer_class_t>(cls), &pool);
+        if (pool.exhausted) {
+            ESP_LOGW(TAG, "Buffer pool %s exhausted %" PRIu32 " times, high water %u of %u",
+                     buffer_pool_class_name(static_cast<buffer_class_t>(cls)), pool.exhausted,
+                     pool.high_water, pool.count);
+        }
+    }
+}
+
+static void capture_task(void* arg) {
+    int64_t last_time = esp_timer_get_time();
+    uint32_t last_decoded = 0, last_classified = 0;
+    uint32_t frame_id = 0;
+#if CONFIG_ALLOC_AUDIT
+    bool audit_armed = false;
+#endif
+
+    pipeline_stage_t stage = PIPELINE_STAGE_OTHER;
+
+    while (true) {
+        enter_stage(stage, PIPELINE_STAGE_CAPTURE);
+        camera_fb_t* fb = esp_camera_fb_get();
+        if (!fb) {
+            stats.capture_failed++;
+            enter_stage(stage, PIPELINE_STAGE_OTHER);
+            vTaskDelay(1);
+            continue;
+        }
+        stats.captured++;
+
+        enter_stage(stage, PIPELINE_STAGE_DECODE);
+        frame_slot_t* slot = acquire_slot();
+
+        esp_jpeg_image_cfg_t jpeg_cfg = {
+            .indata = fb->buf,
+            .indata_size = static_cast<uint32_t>(fb->len),
+            .outbuf = band_buffer.data(),
+            .outbuf_size = static_cast<uint32_t>(band_buffer.size()),
+            .out_format = JPEG_IMAGE_FORMAT_RGBM8888,
+            .out_scale = JPEG_IMAGE_SCALE_0,
+            .flags = {
+                .swap_color_bytes = false
+            },
+            .advanced = {
+                .working_buffer = jpeg_work_buffer.data(),
+                .working_buffer_size = static_cast<uint32_t>(jpeg_work_buffer.size())
+            },
+        };
+        esp_jpeg_image_output_t jpeg_out;
+        esp_err_t result = esp_jpeg_decode_bands(&jpeg_cfg, &jpeg_out, detect_frame_band_cb, slot->frame);
+        enter_stage(stage, PIPELINE_STAGE_CAPTURE);
+        esp_camera_fb_return(fb);
+        enter_stage(stage, PIPELINE_STAGE_OTHER);
+
+        if (result != ESP_OK) {
+            ESP_LOGW(TAG, "esp_jpeg_decode_bands() failed: %s", esp_err_to_name(result));
+            stats.decode_failed++;
+            xQueueSend(free_queue, &slot, 0);
+        } else {
+            slot->id = frame_id++;
+            stats.decoded++;
+            publish_slot(slot);
+        }
+
+        alloc_audit_frame_done();
+#if CONFIG_ALLOC_AUDIT
+        // Both tasks went through their first frames, lazy allocations are done
+        if (!audit_armed && stats.decoded >= CONFIG_ALLOC_AUDIT_WARMUP_FRAMES &&
+            stats.classified >= CONFIG_ALLOC_AUDIT_WARMUP_FRAMES) {
+            alloc_audit_arm();
+            audit_armed = true;
+        }
+#endif
+
+        if (esp_timer_get_time() - last_time >= PIPELINE_STATS_PERIOD_MS * 1000LL) {
+            log_stats(last_time, last_decoded, last_classified);
+        }
+    }
+}
+
+static void classify_task(void* arg) {
+    pipeline_stage_t stage = PIPELINE_STAGE_OTHER;
+
+    while (true) {
+        frame_slot_t* slot = nullptr;
+        xQueueReceive(ready_queue, &slot, portMAX_DELAY);
+
+        enter_stage(stage, PIPELINE_STAGE_CLASSIFY);
+        float confidence = 0.0f;
+        int prediction = detect_in_frame(slot->frame, &confidence);
+        uint32_t id = slot->id;
+        xQueueSend(free_queue, &slot, 0);
+        enter_stage(stage, PIPELINE_STAGE_OTHER);
+        stats.classified++;
+
+        if (prediction >= 0 && prediction < (int)(sizeof(class_names) / sizeof(class_names[0]))) {
+            ESP_LOGI("DETECTOR", "Frame %" PRIu32 " znak: %s (conf: %.2f)", id, class_names[prediction], confidence);
+        } else {
+            ESP_LOGI("DETECTOR", "Frame %" PRIu32 " brak znaku", id);
+        }
+    }
+}
+
+esp_err_t pipeline_start(int width, int height) {
+    free_queue = xQueueCreate(PIPELINE_FRAME_SLOTS, sizeof(frame_slot_t*));
+    ready_queue = xQueueCreate(1, sizeof(frame_slot_t*));
+    if (!free_queue || !ready_queue) {
+        ESP_LOGE(TAG, "Failed to create pipeline queues");
+        return ESP_ERR_NO_MEM;
+    }
+
+    size_t rows_size, stats_size;
+    detect_frame_buffer_sizes(width, height, &rows_size, &stats_size);
+    // One row of 4:2:0 MCUs in RGBM8888, decoded and analysed in internal RAM
+    const uint32_t internal = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    esp_err_t ret = buffer_pool_init(BUFFER_CLASS_BAND, width * 16 * 4, 1, internal);
+    if (ret == ESP_OK) ret = buffer_pool_init(BUFFER_CLASS_JPEG_WORK, JPEG_WORK_BUF_SIZE, 1, internal);
+    if (ret == ESP_OK) ret = buffer_pool_init(BUFFER_CLASS_FRAME_STATS, stats_size, PIPELINE_FRAME_SLOTS, internal);
+    if (ret == ESP_OK) ret = buffer_pool_init(BUFFER_CLASS_FRAME_ROWS, rows_size, PIPELINE_FRAME_SLOTS, MALLOC_CAP_SPIRAM);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to allocate pipeline buffers");
+        return ret;
+    }
+    band_buffer = buffer_pool_acquire(BUFFER_CLASS_BAND);
+    jpeg_work_buffer = buffer_pool_acquire(BUFFER_CLASS_JPEG_WORK);
+
+    for (int i = 0; i < PIPELINE_FRAME_SLOTS; ++i) {
+        slots[i].frame = detect_frame_create(width, height);
+        if (!slots[i].frame) {
+            return ESP_ERR_NO_MEM;
+        }
+        frame_slot_t* slot = &slots[i];
+        xQueueSend(free_queue, &slot, 0);
+    }
+
+    TaskHandle_t capture_handle = nullptr, classify_handle = nullptr;
+    if (xTaskCreatePinnedToCore(capture_task, "capture_task", CAPTURE_TASK_STACK, nullptr, 5,
+                                &capture_handle, 0) != pdPASS ||
+        xTaskCreatePinnedToCore(classify_task, "detect_task", CLASSIFY_TASK_STACK, nullptr, 5,
+                                &classify_handle, 1) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create pipeline tasks");
+        return ESP_ERR_NO_MEM;
+    }
+    mem_telemetry_watch_task(capture_handle, "capture_task", CAPTURE_TASK_STACK);
+    mem_telemetry_watch_task(classify_handle, "detect_task", CLASSIFY_TASK_STACK);
+
+    ESP_LOGI(TAG, "Pipeline started: %dx%d, %d frame slots", width, height, PIPELINE_FRAME_SLOTS);
+    buffer_pool_log_stats();
+    return ESP_OK;
+}
+
+void pipeline_get_stats(pipeline_stats_t* out) {
+    *out = stats;
+    out->ready_depth = ready_queue ? uxQueueMessagesWaiting(ready_queue) : 0;
+    out->free_depth = free_queue ? uxQueueMessagesWaiting(free_queue) : 0;
+}
@@ -0,0 +1,38 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+// Frames decoded on core 0 while the previous frame is classified on core 1:
+// one slot is decoded, one waits for the classifier and one is classified
+#define PIPELINE_FRAME_SLOTS 3
+#define PIPELINE_STATS_PERIOD_MS 5000
+
+// Work a pipeline task is doing, used to attribute allocations and memory usage
+enum pipeline_stage_t {
+    PIPELINE_STAGE_OTHER,     // tasks outside the pipeline, or a pipeline task between stages
+    PIPELINE_STAGE_CAPTURE,   // waiting for and returning camera frame buffers
+    PIPELINE_STAGE_DECODE,    // JPEG band decoding and window statistics
+    PIPELINE_STAGE_CLASSIFY,  // candidate windows through the model
+    PIPELINE_STAGE_COUNT
+};
+
+struct pipeline_stats_t {
+    uint32_t captured;        // frames taken from the camera
+    uint32_t decoded;         // frames decoded and analysed
+    uint32_t classified;      // frames classified by the detector
+    uint32_t dropped;         // decoded frames replaced by a newer one before classification
+    uint32_t capture_failed;  // esp_camera_fb_get() failures
+    uint32_t decode_failed;   // JPEG decoding failures
+    uint32_t ready_depth;     // frames waiting for the classifier
+    uint32_t free_depth;      // recycled frames available for decoding
+    float capture_fps;        // decoded frames per second over the last stats period
+    float classify_fps;       // classified frames per second over the last stats period
+};
+
+esp_err_t pipeline_start(int width, int height);
+void pipeline_get_stats(pipeline_stats_t* stats);
+
+#endif // PIPELINE_H
@@ -0,0 +1,255 @@
+#include "shared_features.h"
+#include <algorithm>
+
+// Windows of one scale, consecutive in the scan order, and the area of the frame they cover
+struct level_t {
+    int first, count;
+    int size;             // window side in frame pixels
+    int x0, y0;           // frame position of the level origin
+    int width, height;    // level input, one pixel per model input pixel
+};
+
+// Rows of the level input (stage 0) or of the output of layer stage - 1, kept in a ring
+struct stage_t {
+    float* ring;
+    int ring_rows;
+    int width, height, channels;
+    int next_row;         // first row not computed yet
+};
+
+struct stream_t {
+    const sign_net_t& net;
+    const detect_frame_t* frame;
+    const level_t& level;
+    stage_t stages[SHARED_FEATURES_MAX_LAYERS + 1];
+    float* conv_rows[SHARED_FEATURES_MAX_LAYERS];  // two unpooled rows of a pooling layer
+    float* sums;                                   // [windows][channels of the last layer]
+    float* logits;                                 // [windows][classes]
+};
+
+static int pool_factor(const sign_net_t& net) {
+    int factor = 1;
+    for (int l = 0; l < net.layer_count; ++l) {
+        if (net.layers[l].pool) factor *= 2;
+    }
+    return factor;
+}
+
+// Window positions in the level must land on cells of the last feature map
+static bool find_level(const std::vector<window_t>& windows, int first, int factor, level_t* level) {
+    const int size = windows[first].size;
+    int end = first;
+    int x0 = windows[first].x, y0 = windows[first].y, x1 = x0, y1 = y0;
+    for (; end < (int)windows.size() && windows[end].size == size; ++end) {
+        x0 = std::min<int>(x0, windows[end].x);
+        y0 = std::min<int>(y0, windows[end].y);
+        x1 = std::max<int>(x1, windows[end].x);
+        y1 = std::max<int>(y1, windows[end].y);
+    }
+    if (DETECT_INPUT_SIZE % factor) return false;
+    for (int w = first; w < end; ++w) {
+        const int dx = (windows[w].x - x0) * DETECT_INPUT_SIZE;
+        const int dy = (windows[w].y - y0) * DETECT_INPUT_SIZE;
+        if (dx % size || dy % size || (dx / size) % factor || (dy / size) % factor) return false;
+    }
+
+    level->first = first;
+    level->count = end - first;
+    level->size = size;
+    level->x0 = x0;
+    level->y0 = y0;
+    level->width = (x1 - x0) * DETECT_INPUT_SIZE / size + DETECT_INPUT_SIZE;
+    level->height = (y1 - y0) * DETECT_INPUT_SIZE / size + DETECT_INPUT_SIZE;
+    return true;
+}
+
+// Lays the stages out in the workspace, with a null workspace only counts the floats
+static size_t plan(stream_t* s, float* workspace) {
+    const sign_net_t& net = s->net;
+    size_t used = 0;
+    auto take = [&used, workspace](size_t floats) {
+        float* p = workspace ? workspace + used : nullptr;
+        used += floats;
+        return p;
+    };
+
+    int width = s->level.width, height = s->level.height, channels = net.layers[0].in_channels;
+    for (int stage = 0; stage <= net.layer_count; ++stage) {
+        if (stage > 0) {
+            const sign_conv_layer_t& layer = net.layers[stage - 1];
+            s->conv_rows[stage - 1] = layer.pool ? take(2 * width * layer.out_channels) : nullptr;
+            if (layer.pool) {
+                width /= 2;
+                height /= 2;
+            }
+            channels = layer.out_channels;
+        }
+        stage_t& st = s->stages[stage];
+        st.ring_rows = stage < net.layer_count ? net.layers[stage].kernel : 1;
+        st.width = width;
+        st.height = height;
+        st.channels = channels;
+        st.next_row = 0;
+        st.ring = take(st.ring_rows * width * channels);
+    }
+    s->sums = take(s->level.count * channels);
+    s->logits = take(s->level.count * net.classes);
+    return used;
+}
+
+static const float* fetch_row(stream_t* s, int stage, int row);
+
+// Nearest neighbour sampling of the kept frame rows, the same pixels resize_window_nearest() picks
+static void input_row(stream_t* s, int row, float* dst) {
+    const level_t& level = s->level;
+    const detect_frame_t* frame = s->frame;
+    const int slot = frame->row_slot[level.y0 + row * level.size / DETECT_INPUT_SIZE];
+    if (slot < 0) {
+        std::fill(dst, dst + level.width * 3, 0.0f);
+        return;
+    }
+    const uint8_t* src_row = &frame->rows[slot * frame->width * 3];
+    for (int x = 0; x < level.width; ++x, dst += 3) {
+        const uint8_t* src_pixel = &src_row[(level.x0 + x * level.size / DETECT_INPUT_SIZE) * 3];
+        for (int c = 0; c < 3; ++c) {
+            dst[c] = (src_pixel[c] / 255.0f - 0.5f) / 0.5f;  // as the model input of detect_in_frame()
+        }
+    }
+}
+
+// One row of convolution and ReLU, rows outside the input are the zero padding
+static void conv_row(stream_t* s, int l, int row, float* dst) {
+    const sign_conv_layer_t& layer = s->net.layers[l];
+    const stage_t& in = s->stages[l];
+    const int half = layer.kernel / 2;
+    const float* rows[16];
+    // Highest row first, fetching it may drop the oldest row of the ring
+    for (int ky = layer.kernel - 1; ky >= 0; --ky) {
+        rows[ky] = fetch_row(s, l, row + ky - half);
+    }
+
+    const int ci = layer.in_channels;
+    for (int x = 0; x < in.width; ++x, dst += layer.out_channels) {
+        for (int o = 0; o < layer.out_channels; ++o) {
+            float acc = layer.bias[o];
+            const float* filter = layer.weights + o * layer.kernel * layer.kernel * ci;
+            for (int ky = 0; ky < layer.kernel; ++ky) {
+                if (!rows[ky]) continue;
+                for (int kx = 0; kx < layer.kernel; ++kx) {
+                    const int ix = x + kx - half;
+                    if (ix < 0 || ix >= in.width) continue;
+                    const float* src = rows[ky] + ix * ci;
+                    const float* w = filter + (ky * layer.kernel + kx) * ci;
+                    for (int i = 0; i < ci; ++i) {
+                        acc += src[i] * w[i];
+                    }
+                }
+            }
+            dst[o] = acc > 0.0f ? acc : 0.0f;
+        }
+    }
+}
+
+static void compute_row(stream_t* s, int stage, int row, float* dst) {
+    if (stage == 0) {
+        input_row(s, row, dst);
+        return;
+    }
+    const int l = stage - 1;
+    const sign_conv_layer_t& layer = s->net.layers[l];
+    if (!layer.pool) {
+        conv_row(s, l, row, dst);
+        return;
+    }
+
+    const int row_floats = s->stages[l].width * layer.out_channels;
+    float* top = s->conv_rows[l];
+    float* bottom = top + row_floats;
+    conv_row(s, l, 2 * row, top);
+    conv_row(s, l, 2 * row + 1, bottom);
+    const int c = layer.out_channels;
+    for (int x = 0; x < s->stages[stage].width; ++x) {
+        for (int o = 0; o < c; ++o) {
+            const int i = 2 * x * c + o;
+            dst[x * c + o] = std::max(std::max(top[i], top[i + c]), std::max(bottom[i], bottom[i + c]));
+        }
+    }
+}
+
+// Rows are computed in order on first use, nullptr outside the stage
+static const float* fetch_row(stream_t* s, int stage, int row) {
+    stage_t& st = s->stages[stage];
+    if (row < 0 || row >= st.height) return nullptr;
+    const int row_floats = st.width * st.channels;
+    while (st.next_row <= row) {
+        compute_row(s, stage, st.next_row, st.ring + (st.next_row % st.ring_rows) * row_floats);
+        st.next_row++;
+    }
+    return st.ring + (row % st.ring_rows) * row_floats;
+}
+
+size_t shared_features_workspace_size(const sign_net_t& net, const std::vector<window_t>& windows) {
+    const int factor = pool_factor(net);
+    size_t largest = 0;
+    for (size_t first = 0; first < windows.size();) {
+        level_t level;
+        if (!find_level(windows, first, factor, &level)) {
+            const int size = windows[first].size;
+            while (first < windows.size() && windows[first].size == size) ++first;
+            continue;
+        }
+        stream_t s = {net, nullptr, level};
+        largest = std::max(largest, plan(&s, nullptr));
+        first += level.count;
+    }
+    return largest * sizeof(float);
+}
+
+int shared_features_classify_level(const sign_net_t& net, const detect_frame_t* frame, int first,
+                                   uint8_t* workspace, size_t workspace_size, const float** logits) {
+    level_t level;
+    const int factor = pool_factor(net);
+    if (!find_level(frame->windows, first, factor, &level)) return 0;
+    stream_t s = {net, frame, level};
+    if (plan(&s, nullptr) * sizeof(float) > workspace_size) return 0;
+    plan(&s, reinterpret_cast<float*>(workspace));
+
+    const stage_t& last = s.stages[net.layer_count];
+    const int channels = last.channels;
+    const int cells = DETECT_INPUT_SIZE / factor;
+    std::fill(s.sums, s.sums + level.count * channels, 0.0f);
+
+    for (int row = 0; row < last.height; ++row) {
+        const float* features = fetch_row(&s, net.layer_count, row);
+        for (int w = 0; w < level.count; ++w) {
+            const window_t& win = frame->windows[level.first + w];
+            const int cy = (win.y - level.y0) * DETECT_INPUT_SIZE / level.size / factor;
+            if (row < cy || row >= cy + cells) continue;
+            const int cx = (win.x - level.x0) * DETECT_INPUT_SIZE / level.size / factor;
+            float* sum = s.sums + w * channels;
+            for (int x = cx; x < cx + cells; ++x) {
+                const float* cell = features + x * channels;
+                for (int c = 0; c < channels; ++c) {
+                    sum[c] += cell[c];
+                }
+            }
+        }
+    }
+
+    // Global average pooling of the window region, then the linear layer
+    const float scale = 1.0f / (cells * cells);
+    for (int w = 0; w < level.count; ++w) {
+        const float* sum = s.sums + w * channels;
+        float* out = s.logits + w * net.classes;
+        for (int k = 0; k < net.classes; ++k) {
+            const float* weights = net.fc_weights + k * channels;
+            float acc = 0.0f;
+            for (int c = 0; c < channels; ++c) {
+                acc += sum[c] * scale * weights[c];
+            }
+            out[k] = acc + net.fc_bias[k];
+        }
+    }
+    *logits = s.logits;
+    return level.count;
+}
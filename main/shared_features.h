@@ -0,0 +1,43 @@
+#ifndef SHARED_FEATURES_H
+#define SHARED_FEATURES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "detect_frame.h"
+
+// Fully convolutional classification of the sliding windows. The convolution trunk runs once over the
+// area a pyramid level covers, every window then averages its region of the last feature map and goes
+// through the fully connected layer. Rows stream through the layers, each layer keeps only the rows the
+// next convolution reads.
+
+#define SHARED_FEATURES_MAX_LAYERS 4
+
+struct sign_conv_layer_t {
+    const float* weights;  // [out][kernel][kernel][in]
+    const float* bias;
+    int in_channels;
+    int out_channels;
+    int kernel;            // odd, stride 1, zero padded to keep the size
+    bool pool;             // 2x2 max pool with stride 2 after the ReLU
+};
+
+// Convolution, ReLU and max pool stack followed by global average pooling and one linear layer
+struct sign_net_t {
+    sign_conv_layer_t layers[SHARED_FEATURES_MAX_LAYERS];
+    int layer_count;
+    const float* fc_weights;  // [classes][features], features are the channels of the last layer
+    const float* fc_bias;
+    int classes;
+};
+
+// Workspace bytes for the largest pyramid level of the windows
+size_t shared_features_workspace_size(const sign_net_t& net, const std::vector<window_t>& windows);
+// Classifies every window of the pyramid level whose first window is first, logits points into the
+// workspace, [windows][classes]. Returns the number of windows of the level, 0 if the windows are not
+// aligned to the last feature map or the workspace is too small.
+int shared_features_classify_level(const sign_net_t& net, const detect_frame_t* frame, int first,
+                                   uint8_t* workspace, size_t workspace_size, const float** logits);
+
+#endif // SHARED_FEATURES_H
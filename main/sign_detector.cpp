@@ -1,103 +1,223 @@
 #include "sign_detector.h"
+#include "op_profiler.h"
+#include "shared_features.h"
+#include "sign_model_aot.h"
+#include "esp_nn.h"
 #include "esp_log.h"
 #include <cmath>
+#include <cstring>
 #include <algorithm>
-#include <vector>
-#include <map>
 #include "esp_heap_caps.h"
 #include "esp_task_wdt.h"
 
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_utils.h"
 
 #define TAG "DETECTOR"
 
 tflite::MicroInterpreter* interpreter = nullptr;
 TfLiteTensor* input = nullptr;
 TfLiteTensor* output = nullptr;
-uint8_t* patch_src = nullptr;
 uint8_t* resized_patch = nullptr;
+static buffer_handle_t patch_buffer;
+static sign_net_t shared_net;
+static buffer_handle_t features_buffer;
+static buffer_handle_t aot_arena;
+static buffer_handle_t tile_buffer;
 
-void resize_rgb888_nearest(
-    const uint8_t* src, int src_w, int src_h,
-    uint8_t* dst, int dst_w, int dst_h
-) {
-    for (int y = 0; y < dst_h; ++y) {
-        int src_y = y * src_h / dst_h;
-        for (int x = 0; x < dst_w; ++x) {
-            int src_x = x * src_w / dst_w;
-            const uint8_t* src_pixel = &src[(src_y * src_w + src_x) * 3];
-            uint8_t* dst_pixel = &dst[(y * dst_w + x) * 3];
-            dst_pixel[0] = src_pixel[0];
-            dst_pixel[1] = src_pixel[1];
-            dst_pixel[2] = src_pixel[2];
-        }
+void init_buffers() {
+    if (buffer_pool_init(BUFFER_CLASS_PATCH, DETECT_INPUT_SIZE * DETECT_INPUT_SIZE * 3, 1, MALLOC_CAP_SPIRAM) == ESP_OK) {
+        patch_buffer = buffer_pool_acquire(BUFFER_CLASS_PATCH);
+    }
+    resized_patch = patch_buffer.data();
+#if CONFIG_SIGN_AOT_MODEL
+    if (buffer_pool_init(BUFFER_CLASS_TENSOR_ARENA, sign_model_arena_size(), 1, MALLOC_CAP_SPIRAM) == ESP_OK) {
+        aot_arena = buffer_pool_acquire(BUFFER_CLASS_TENSOR_ARENA);
+    }
+    if (!aot_arena) {
+        ESP_LOGE(TAG, "No arena for the compiled model");
+    }
+#if CONFIG_SIGN_TILED_CONV
+    const size_t tile_size = CONFIG_SIGN_TILE_BUF_SIZE * 1024;
+    if (buffer_pool_init(BUFFER_CLASS_TILE, tile_size, 1, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT) == ESP_OK) {
+        tile_buffer = buffer_pool_acquire(BUFFER_CLASS_TILE);
+    }
+    if (tile_buffer) {
+        esp_nn_set_tile_buf(tile_buffer.data(), tile_size);
+    } else {
+        // the convolutions then run on the arena in place
+        ESP_LOGW(TAG, "No internal RAM for the convolution tiles");
+    }
+#endif
+#endif
+    if (!resized_patch) {
+        ESP_LOGE(TAG, "Nie udało się zaalokować buforów w PSRAM!");
     }
 }
 
-static bool is_candidate(uint8_t* rgb, int width, int x, int y, int patch_size) {
-    int red_like = 0, total = 0;
-    float r_sum = 0, g_sum = 0, b_sum = 0;
-    float r_center = 0, g_center = 0, b_center = 0;
-    int center_total = 0;
-
-    int margin = patch_size / 4;
-    int center_start = margin;
-    int center_end = patch_size - margin;
-
-    for (int j = 0; j < patch_size; ++j) {
-        for (int i = 0; i < patch_size; ++i) {
-            int px = x + i, py = y + j;
-            uint8_t* pixel = &rgb[(py * width + px) * 3];
-            float r = pixel[0] / 255.0f;
-            float g = pixel[1] / 255.0f;
-            float b = pixel[2] / 255.0f;
+static bool is_float32(const tflite::SubGraph* subgraph, int index) {
+    return index >= 0 && subgraph->tensors()->Get(index)->type() == tflite::TensorType_FLOAT32;
+}
 
-            float max = std::max({r, g, b});
-            float min = std::min({r, g, b});
-            float delta = max - min;
+// Values of the int32 input of op, nullptr unless it holds count of them
+static const int32_t* const_ints(const tflite::SubGraph* subgraph, const tflite::Operator* op, int input, int count) {
+    if ((int)op->inputs()->size() <= input) return nullptr;
+    const int index = op->inputs()->Get(input);
+    if (subgraph->tensors()->Get(index)->type() != tflite::TensorType_INT32) return nullptr;
+    const TfLiteEvalTensor* tensor = interpreter->GetTensor(index);
+    int elements = 1;
+    for (int i = 0; i < tensor->dims->size; ++i) elements *= tensor->dims->data[i];
+    return elements == count ? tensor->data.i32 : nullptr;
+}
 
-            float h = 0;
-            if (delta > 0.0001f) {
-                if (max == r) h = fmod((g - b) / delta, 6.0f);
-                else if (max == g) h = ((b - r) / delta) + 2.0f;
-                else h = ((r - g) / delta) + 4.0f;
-                h *= 60.0f;
-                if (h < 0) h += 360.0f;
+// Reads the convolution stack out of the model. Layout operators are skipped since the weights are applied
+// to HWC rows directly, anything else the shared path cannot reproduce rejects the model.
+static bool sign_net_from_model(const tflite::Model* model, sign_net_t* net) {
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    *net = {};
+    int pad = 0;  // spatial zero padding of PAD operators since the last convolution
+    bool pooled = false;
+    // Axis of the channels in the current 4D layout, the converter runs PAD and MEAN on NCHW between TRANSPOSEs
+    const flatbuffers::Vector<int32_t>* input_shape = subgraph->tensors()->Get(subgraph->inputs()->Get(0))->shape();
+    if (!input_shape || input_shape->size() != 4) return false;
+    int channel_axis = input_shape->Get(3) == 3 ? 3 : 1;
+
+    for (const tflite::Operator* op : *subgraph->operators()) {
+        const tflite::BuiltinOperator code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+        switch (code) {
+        case tflite::BuiltinOperator_TRANSPOSE: {
+            // only NCHW <-> NHWC, out[i] = in[perm[i]]
+            static const int32_t to_nhwc[4] = {0, 2, 3, 1}, to_nchw[4] = {0, 3, 1, 2};
+            const int32_t* perm = const_ints(subgraph, op, 1, 4);
+            const int32_t* expected = channel_axis == 1 ? to_nhwc : to_nchw;
+            if (!perm || memcmp(perm, expected, sizeof(to_nhwc))) return false;
+            channel_axis = channel_axis == 1 ? 3 : 1;
+            break;
+        }
+        case tflite::BuiltinOperator_RESHAPE:
+            break;
+        case tflite::BuiltinOperator_PAD: {
+            // {before, after} per axis, only the same zero padding on every spatial side is reproduced
+            const int32_t* paddings = const_ints(subgraph, op, 1, 8);
+            if (!paddings || paddings[0] || paddings[1] || paddings[2 * channel_axis] ||
+                paddings[2 * channel_axis + 1]) {
+                return false;
             }
-
-            float s = max == 0 ? 0 : delta / max;
-
-            if (s > 0.25f && (h < 30.0f || h > 330.0f)) {
-                red_like++;
+            const int amount = channel_axis == 3 ? paddings[2] : paddings[4];
+            for (int axis = 1; axis < 4; ++axis) {
+                if (axis == channel_axis) continue;
+                if (paddings[2 * axis] != amount || paddings[2 * axis + 1] != amount) return false;
             }
-
-            r_sum += r; g_sum += g; b_sum += b;
-            if (i >= center_start && i < center_end && j >= center_start && j < center_end) {
-                r_center += r; g_center += g; b_center += b;
-                center_total++;
+            pad += amount;
+            break;
+        }
+        case tflite::BuiltinOperator_CONV_2D: {
+            const tflite::Conv2DOptions* options = op->builtin_options_as_Conv2DOptions();
+            const int w = op->inputs()->Get(1), b = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+            if (net->layer_count == SHARED_FEATURES_MAX_LAYERS || !options || !is_float32(subgraph, w) ||
+                !is_float32(subgraph, b) || options->stride_w() != 1 || options->stride_h() != 1 ||
+                options->dilation_w_factor() != 1 || options->dilation_h_factor() != 1 ||
+                options->fused_activation_function() != tflite::ActivationFunctionType_RELU || channel_axis != 3) {
+                return false;
             }
-
-            total++;
+            const TfLiteEvalTensor* weights = interpreter->GetTensor(w);
+            const int kernel = weights->dims->data[1];
+            const int same = options->padding() == tflite::Padding_SAME ? kernel / 2 : 0;
+            if (kernel % 2 == 0 || kernel > 16 || weights->dims->data[2] != kernel || pad + same != kernel / 2) {
+                return false;
+            }
+            sign_conv_layer_t& layer = net->layers[net->layer_count++];
+            layer.weights = weights->data.f;
+            layer.bias = interpreter->GetTensor(b)->data.f;
+            layer.out_channels = weights->dims->data[0];
+            layer.in_channels = weights->dims->data[3];
+            layer.kernel = kernel;
+            pad = 0;
+            break;
+        }
+        case tflite::BuiltinOperator_MAX_POOL_2D: {
+            const tflite::Pool2DOptions* options = op->builtin_options_as_Pool2DOptions();
+            if (!net->layer_count || !options || options->filter_width() != 2 || options->filter_height() != 2 ||
+                options->stride_w() != 2 || options->stride_h() != 2 ||
+                options->fused_activation_function() != tflite::ActivationFunctionType_NONE ||
+                net->layers[net->layer_count - 1].pool || channel_axis != 3) {
+                return false;
+            }
+            net->layers[net->layer_count - 1].pool = true;
+            break;
+        }
+        case tflite::BuiltinOperator_MEAN: {
+            // the windows average over height and width, {1, 2} in NHWC
+            const int32_t* axes = const_ints(subgraph, op, 1, 2);
+            const int height_axis = channel_axis == 3 ? 1 : 2;
+            if (!net->layer_count || pooled || !axes || std::min(axes[0], axes[1]) != height_axis ||
+                std::max(axes[0], axes[1]) != height_axis + 1) {
+                return false;
+            }
+            pooled = true;
+            break;
+        }
+        case tflite::BuiltinOperator_FULLY_CONNECTED: {
+            const tflite::FullyConnectedOptions* options = op->builtin_options_as_FullyConnectedOptions();
+            const int w = op->inputs()->Get(1), b = op->inputs()->size() > 2 ? op->inputs()->Get(2) : -1;
+            if (!pooled || net->classes || !options || !is_float32(subgraph, w) || !is_float32(subgraph, b) ||
+                options->fused_activation_function() != tflite::ActivationFunctionType_NONE) {
+                return false;
+            }
+            const TfLiteEvalTensor* weights = interpreter->GetTensor(w);
+            if (weights->dims->data[1] != net->layers[net->layer_count - 1].out_channels) return false;
+            net->fc_weights = weights->data.f;
+            net->fc_bias = interpreter->GetTensor(b)->data.f;
+            net->classes = weights->dims->data[0];
+            break;
+        }
+        default:
+            return false;
         }
     }
+    return net->classes > 0 && net->layers[0].in_channels == 3;
+}
 
-    float red_ratio = static_cast<float>(red_like) / total;
-
-    float r_avg = r_sum / total, g_avg = g_sum / total, b_avg = b_sum / total;
-    float r_cavg = r_center / center_total, g_cavg = g_center / center_total, b_cavg = b_center / center_total;
-    float contrast = fabs(r_avg - r_cavg) + fabs(g_avg - g_cavg) + fabs(b_avg - b_cavg);
-
-    return (red_ratio > 0.06f) && (contrast > 0.2f);
+void init_shared_features(const tflite::Model* model, int width, int height) {
+#if CONFIG_SIGN_SHARED_FEATURES
+    if (!sign_net_from_model(model, &shared_net) || shared_net.classes != output->dims->data[1]) {
+        ESP_LOGW(TAG, "Model is not a plain convolution stack, classifying every window separately");
+        return;
+    }
+    std::vector<window_t> windows;
+    detect_frame_windows(width, height, windows);
+    const size_t size = shared_features_workspace_size(shared_net, windows);
+    if (!size || buffer_pool_init(BUFFER_CLASS_FEATURES, size, 1, MALLOC_CAP_SPIRAM) != ESP_OK) {
+        ESP_LOGW(TAG, "No shared features, classifying every window separately");
+        return;
+    }
+    features_buffer = buffer_pool_acquire(BUFFER_CLASS_FEATURES);
+    ESP_LOGI(TAG, "Shared features of %d layers, %u bytes of rows", shared_net.layer_count, (unsigned)size);
+#endif
 }
 
+// Logits of one window, nullptr if the model failed
+static const float* classify_window(detect_frame_t* frame, const window_t& win) {
+    resize_window_nearest(frame, win, resized_patch);
+#if CONFIG_SIGN_AOT_MODEL
+    static_assert(SIGN_MODEL_INPUT_WIDTH == DETECT_INPUT_SIZE && SIGN_MODEL_INPUT_HEIGHT == DETECT_INPUT_SIZE &&
+                  SIGN_MODEL_INPUT_CHANNELS == 3, "compiled model does not take the resized window");
+    static float logits[SIGN_MODEL_OUTPUTS];
+    sign_model_predict(resized_patch, logits, aot_arena.data());
+    return logits;
+#else
+    float* in = input->data.f;
+    for (int j = 0; j < DETECT_INPUT_SIZE * DETECT_INPUT_SIZE * 3; ++j) {
+        in[j] = (resized_patch[j] / 255.0f - 0.5f) / 0.5f;  // [0–255] -> [0–1] -> [-1,1]
+    }
 
-void init_buffers() {
-    patch_src = (uint8_t*)heap_caps_malloc(240 * 240 * 3, MALLOC_CAP_SPIRAM);
-    resized_patch = (uint8_t*)heap_caps_malloc(64 * 64 * 3, MALLOC_CAP_SPIRAM);
-    if (!patch_src || !resized_patch) {
-        ESP_LOGE(TAG, "Nie udało się zaalokować buforów w PSRAM!");
+    if (op_profiler_invoke(interpreter) != kTfLiteOk) {
+        ESP_LOGW(TAG, "Interpreter failed");
+        return nullptr;
     }
+    return output->data.f;
+#endif
 }
 
 bool find_red_bbox(uint8_t* patch, int patch_size, int& out_x, int& out_y, int& out_w, int& out_h) {
@@ -150,92 +270,91 @@ bool find_red_bbox(uint8_t* patch, int patch_size, int& out_x, int& out_y, int&
 }
 
 
-int detect_in_image(uint8_t* image_rgb888, int width, int height, float* out_confidence) {
-    const int input_size = 64;
-
+int detect_in_frame(detect_frame_t* frame, float* out_confidence) {
+#if CONFIG_SIGN_AOT_MODEL
+    const int num_classes = SIGN_MODEL_OUTPUTS;
+#else
     const int num_classes = output->dims->data[1];
-    float scales[] = {1.0f, 0.75f, 0.56f, 0.42f, 0.31f, 0.22f, 0.17f};
+#endif
 
     int patch_counter = 0;
-
-    for (int s = 0; s < sizeof(scales)/sizeof(scales[0]); ++s) {
-        ESP_LOGI(TAG, "Sprawdzanie: scale=%.2f", scales[s]);
-        int patch_size = static_cast<int>(height * scales[s]);
-        if (patch_size < 64 || patch_size > height || patch_size > width) continue;
-
-        int stride = patch_size / 2;
-
-        for (int y = 0; y <= height - patch_size; y += stride) {
-            for (int x = 0; x <= width - patch_size; x += stride) {
-
-                if (!is_candidate(image_rgb888, width, x, y, patch_size))
-                    continue;
-
-                for (int j = 0; j < patch_size; ++j) {
-                    for (int i = 0; i < patch_size; ++i) {
-                        const uint8_t* src = &image_rgb888[((y + j) * width + (x + i)) * 3];
-                        uint8_t* dst = &patch_src[(j * patch_size + i) * 3];
-                        dst[0] = src[0];
-                        dst[1] = src[1];
-                        dst[2] = src[2];
-                    }
-                }
-
-                resize_rgb888_nearest(patch_src, patch_size, patch_size, resized_patch, input_size, input_size);
-
-                float* in = input->data.f;
-                for (int j = 0; j < input_size * input_size * 3; ++j) {
-                    in[j] = (resized_patch[j] / 255.0f - 0.5f) / 0.5f;  // [0–255] -> [0–1] -> [-1,1]
-                }
-
-                if (interpreter->Invoke() != kTfLiteOk) {
-                    ESP_LOGW(TAG, "Interpreter failed");
-                    continue;
+    float logged_scale = 0.0f;
+    // Windows [level_first, level_end) have their logits in level_logits
+    int level_first = 0, level_end = 0;
+    const float* level_logits = nullptr;
+
+    for (int w = 0; w < (int)frame->windows.size(); ++w) {
+        const window_t& win = frame->windows[w];
+        if (win.scale != logged_scale) {
+            ESP_LOGI(TAG, "Sprawdzanie: scale=%.2f", win.scale);
+            logged_scale = win.scale;
+        }
+        const int x = win.x, y = win.y;
+
+        if (!is_candidate(win))
+            continue;
+
+        if (features_buffer && w >= level_end) {
+            // Every window of the level from the first candidate on, in one pass of the convolutions
+            const int count = shared_features_classify_level(shared_net, frame, w, features_buffer.data(),
+                                                             features_buffer.size(), &level_logits);
+            level_first = w;
+            level_end = w + count;
+            if (!count) {
+                level_logits = nullptr;
+                while (level_end < (int)frame->windows.size() && frame->windows[level_end].size == win.size) {
+                    ++level_end;
                 }
+            }
+        }
 
-                float* out = output->data.f;
-                float logits[10], probs[10];
+        const float* out;
+        if (level_logits && w < level_end) {
+            out = level_logits + (w - level_first) * num_classes;
+        } else {
+            out = classify_window(frame, win);
+            if (!out) continue;
+        }
+        float logits[10], probs[10];
 
-                float max_logit = -INFINITY;
-                for (int i = 0; i < num_classes; ++i) {
-                    logits[i] = out[i];
-                    if (logits[i] > max_logit) max_logit = logits[i];
-                }
+        float max_logit = -INFINITY;
+        for (int i = 0; i < num_classes; ++i) {
+            logits[i] = out[i];
+            if (logits[i] > max_logit) max_logit = logits[i];
+        }
 
-                float sum_exp = 0;
-                for (int i = 0; i < num_classes; ++i) {
-                    probs[i] = expf(logits[i] - max_logit);
-                    sum_exp += probs[i];
-                }
-                for (int i = 0; i < num_classes; ++i) {
-                    probs[i] /= sum_exp;
-                    ESP_LOGI(TAG, "  class=%d -> prob=%.4f", i, probs[i]);
-                }
+        float sum_exp = 0;
+        for (int i = 0; i < num_classes; ++i) {
+            probs[i] = expf(logits[i] - max_logit);
+            sum_exp += probs[i];
+        }
+        for (int i = 0; i < num_classes; ++i) {
+            probs[i] /= sum_exp;
+            ESP_LOGI(TAG, "  class=%d -> prob=%.4f", i, probs[i]);
+        }
 
-                int best_class = std::max_element(probs, probs + num_classes) - probs;
-                float conf = probs[best_class];
+        int best_class = std::max_element(probs, probs + num_classes) - probs;
+        float conf = probs[best_class];
 
-                float second = 0.0f;
-                for (int i = 0; i < num_classes; ++i) {
-                    if (i != best_class && probs[i] > second)
-                        second = probs[i];
-                }
+        float second = 0.0f;
+        for (int i = 0; i < num_classes; ++i) {
+            if (i != best_class && probs[i] > second)
+                second = probs[i];
+        }
 
-                float margin = conf - second;
+        float margin = conf - second;
 
-                ESP_LOGI(TAG, "Patch x=%d y=%d scale=%.2f → class=%d conf=%.2f margin=%.2f",
-                         x, y, scales[s], best_class, conf, margin);
+        ESP_LOGI(TAG, "Patch x=%d y=%d scale=%.2f → class=%d conf=%.2f margin=%.2f",
+                 x, y, win.scale, best_class, conf, margin);
 
-                if (++patch_counter % 10 == 0) {
-                    vTaskDelay(1);
-                }
+        if (++patch_counter % 10 == 0) {
+            vTaskDelay(1);
+        }
 
-                if (conf > 0.4f && margin > 0.1f) {
-                    *out_confidence = conf;
-                    ESP_LOGI("DETECTOR", "Patch x=%d y=%d scale=%.2f → class=%d conf=%.4f", x, y, scales[s], best_class, conf);
-                    return best_class;
-                }
-            }
+        if (conf > 0.4f && margin > 0.1f) {
+            *out_confidence = conf;
+            ESP_LOGI("DETECTOR", "Patch x=%d y=%d scale=%.2f → class=%d conf=%.4f", x, y, win.scale, best_class, conf);
+            return best_class;
         }
     }
 
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "esp_err.h"
+#include "detect_frame.h"
 #include "tensorflow/lite/c/common.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
@@ -12,7 +14,10 @@ extern tflite::MicroInterpreter* interpreter;
 extern TfLiteTensor* input;
 extern TfLiteTensor* output;
 
-int detect_in_image(uint8_t* image_rgb888, int width, int height, float* out_confidence);
+int detect_in_frame(detect_frame_t* frame, float* out_confidence);
 void init_buffers();
+// Classifies whole pyramid levels from shared convolution features when CONFIG_SIGN_SHARED_FEATURES is set
+// and the model is a plain convolution stack, must run after the weights are placed
+void init_shared_features(const tflite::Model* model, int width, int height);
 
 #endif // SIGN_DETECTOR_H
@@ -0,0 +1,3053 @@
+// Generated by tools/model_compiler, do not edit
+#include "sign_model_aot.h"
+#include <float.h>
+#include "aot_kernels.h"
+
+#define ACTIVATION_BYTES 327680
+
+alignas(16) static const float conv_0_filter[432] = {
+    0.00185674499f, -0.00162892696f, -0.00110048533f, 0.000110326691f, -0.000402903068f, -0.00185982394f, 3.27122871e-05f, -0.001618988f,
+    0.000312875782f, 0.00133069779f, 0.000185579571f, -6.66481428e-05f, 0.00222684396f, -0.00174091139f, 0.000138010015f, 0.00116723869f,
+    -0.000237972607f, -0.000569886528f, 0.00113562483f, -0.00127762428f, -0.00145843311f, 0.00185413018f, -0.000816827698f, 0.000743299723f,
+    0.000810578931f, 0.000582301698f, -4.27802806e-05f, 2.65354356e-05f, 0.0014901032f, 0.00184359006f, 0.000345485838f, 0.00127077813f,
+    -0.0005620218f, 3.05974609e-05f, -0.00190292567f, -0.000775749853f, 0.0018606903f, 0.00149281207f, 0.000734713802f, 0.000805106189f,
+    0.00100634189f, -0.00168176496f, -0.00102667336f, -0.000243833172f, -0.000708816689f, -0.000236521082f, 0.00152664504f, 0.00259837951f,
+    -0.00012068823f, -0.00052775559f, -0.00181951246f, -0.00247477344f, -0.00143089658f, -0.00170923152f, 0.000292560202f, 4.07613952e-05f,
+    0.00105806254f, 0.000454919966f, 0.0014045696f, 0.000963659026f, 0.00137057528f, 0.00123324723f, 0.00223780447f, 0.00034114343f,
+    0.00204196083f, 0.00182927505f, 0.00175030588f, 0.00189004594f, 0.000235164669f, 0.000796566252f, 0.00186512864f, 0.00217294693f,
+    0.00122231827f, 0.000373978488f, 0.00119441131f, 0.000966316322f, -8.40432476e-05f, 0.00276754214f, -0.00052888511f, 0.00111124956f,
+    0.00209345948f, 0.00128649373f, 0.00195041788f, 0.001563887f, -0.000979220145f, 0.000652604154f, -0.000132142915f, -0.00163681689f,
+    0.000684513303f, 0.000900840969f, -0.000347972527f, -0.000119000113f, 0.00206511701f, -0.00170906342f, -0.000169694395f, 0.000736684655f,
+    -0.00128102943f, -0.0011571449f, 0.00152731221f, -0.001748587f, -0.00076099945f, -0.000862453948f, -0.00197489304f, -0.00162809691f,
+    0.00061929255f, -0.000430529064f, -0.000795135915f, 0.0012077369f, 0.00199654279f, 0.00147725537f, -0.000365632179f, -0.00105572096f,
+    0.00186762551f, 0.00063459744f, 0.00157542585f, 0.00267059798f, 0.000456763664f, -0.000186762059f, 0.00200792635f, 0.00109393045f,
+    -0.00103869825f, 0.000487119454f, 0.00072334602f, 0.00111648871f, 0.00184299529f, 0.000400361489f, -0.000121250065f, -0.000619850238f,
+    -0.00233902643f, -0.00061839004f, -0.000934946991f, -0.00291118491f, -0.00235621259f, -0.0013433079f, -0.00339708035f, -0.00242508552f,
+    0.000948037952f, -0.00100028969f, -0.0018292286f, -0.000832270482f, -0.000386329601f, -0.00255854032f, -0.00147830893f, -0.00109023822f,
+    0.000611368741f, 9.17627331e-05f, -0.000815054635f, -0.000710621243f, 0.000374227617f, -0.000973655959f, 0.000959441357f, 0.0009057399f,
+    0.00113868341f, 0.00137864938f, -0.000107010957f, 0.00232551387f, 0.000194978114f, -0.000287463859f, 0.000583918358f, 0.00123340148f,
+    0.00250779535f, 0.000861821172f, -0.000346589863f, 0.00144860835f, 0.000532046484f, 0.00108587334f, 0.000995815266f, 0.000268722972f,
+    -0.000345190638f, 0.000681027712f, 0.000244442665f, -0.0010541816f, 0.00112613034f, 0.000810899888f, -9.85779188e-05f, 0.00145869853f,
+    0.000489734812f, 0.000360479491f, 0.00108562445f, -0.000333059841f, -0.00163264072f, -0.000410016539f, -0.000758992392f, 3.78847994e-06f,
+    -0.000718393014f, -0.000572155346f, 0.000135639624f, -0.000811118865f, -0.000669658883f, 0.00024856918f, -0.000163882418f, 0.0014781662f,
+    0.00137574365f, 0.00167714921f, 0.00108178053f, 9.90933113e-05f, 0.000812323124f, -0.000536562235f, 0.00083442335f, -0.000872763107f,
+    -0.000436877366f, 0.001066203f, 0.000728214625f, 5.98666702e-05f, -0.00140291126f, -0.000703326194f, 6.47629786e-05f, -0.00113927433f,
+    0.000711328001f, -0.00128825428f, 5.25428113e-05f, -0.00176283112f, -6.64673571e-05f, -0.0014808136f, 0.000849005301f, 0.00131168193f,
+    -0.000722092343f, 0.000404897408f, -0.0006645174f, -0.00190424791f, 0.00148873904f, 0.000830792997f, -0.00210974016f, -0.000857199659f,
+    -0.000551656238f, -0.00170362252f, -8.15805324e-05f, -0.000728552346f, -0.00166179717f, 0.00110280677f, -0.000726958504f, -0.00104935165f,
+    -0.000558372354f, 0.00141726807f, -0.00169702934f, -0.000315650832f, 0.000826271833f, -0.00162290363f, 0.000497802801f, 0.000756671885f,
+    -0.00054341543f, -0.000563547772f, -0.000749584928f, 0.00174054434f, -0.000378144206f, -0.000773781445f, 0.00131054083f, -0.000552066951f,
+    -0.00185298582f, 0.00176893431f, 0.000103700688f, -0.000543687376f, 0.00188261806f, -0.00176519051f, -0.000595804944f, -0.000349372363f,
+    -0.0015741447f, -0.000863244233f, 0.00116659305f, -0.00173063448f, -0.00125561701f, -0.000263022317f, -0.000961242069f, -0.000150699721f,
+    -0.000602567336f, 1.95396224e-05f, -0.00203099335f, 0.000972389826f, -0.000790758291f, -0.0020688721f, 0.00119264214f, -0.000606880873f,
+    -0.00137738558f, 0.000713834015f, -0.000595770427f, -0.00133968017f, 0.00136520399f, -0.000322686887f, 0.000211848994f, 0.00161314756f,
+    -0.000256889267f, -0.0010595239f, 0.0006722791f, 0.000655104755f, -0.00153493113f, 0.00151310267f, -0.00195288553f, -0.00131738617f,
+    -0.000735705311f, -0.00044374456f, -0.000246432261f, 0.000857488252f, -4.43269237e-05f, -0.000811705424f, 0.00104181794f, 0.000795429281f,
+    -0.00183850888f, -0.00083615398f, -0.00229025632f, -0.000879221654f, -0.00118993316f, -0.000541655289f, -0.00131990213f, 0.000331761607f,
+    -4.43352365e-05f, -0.000507086399f, 0.000263433845f, 0.000475593028f, -0.000539111963f, 0.0017309183f, -0.00193011784f, -0.000753977743f,
+    0.00209795241f, -0.00184224918f, 0.000916248711f, 0.00226571062f, -0.000705762883f, 0.00014713667f, 0.000614491233f, -0.00141031935f,
+    0.00158461707f, 0.0021660903f, 9.07201247e-05f, 0.00136305217f, 0.000826150819f, -0.0010512179f, -0.000898409984f, -0.00128145062f,
+    -0.000882459746f, 0.000488460355f, 0.000307821116f, 0.00207704515f, -0.00102550967f, -0.000179984389f, -0.000314721226f, 0.000395293959f,
+    0.000138403615f, -0.00100217701f, 0.000549521996f, 0.000729165564f, 0.00164320692f, 0.000850014272f, -0.00188653963f, -1.21938356e-05f,
+    -0.00119545695f, -0.00146888848f, 0.00120214454f, 0.000606494839f, -0.000460108917f, 0.00121377863f, 0.00121514197f, -0.00179479329f,
+    -0.000660551363f, -0.000248691533f, -0.00157904124f, -0.000523915165f, 0.000345701643f, -0.000265937444f, 0.00227114349f, 0.00160328741f,
+    -0.00116758363f, -0.00127785106f, -0.00157821598f, 0.000636837678f, 0.00149987882f, -0.000234557025f, 0.00209574401f, -0.00047222944f,
+    0.000331791758f, 0.000681404024f, -0.00196951791f, -0.00174027495f, 0.000180252115f, -8.17662949e-05f, 0.00128457567f, 0.0012860006f,
+    0.00158887357f, 0.000209880964f, -0.000528249773f, -0.00130604382f, -0.0014177002f, -0.00225057965f, -0.000967347762f, -0.00174625369f,
+    -0.001621873f, -0.00172061904f, 0.0012987951f, -0.000194243345f, -0.00208366849f, -0.000684271683f, 0.00114637066f, 0.000889364805f,
+    -0.0005120571f, 0.00163476891f, 0.000165956051f, 0.00102253607f, -0.000774886168f, 0.00122670352f, -0.00014479844f, 0.00225403556f,
+    0.00203856803f, 0.000647441717f, 0.00106360181f, 0.00113533973f, 0.00169015874f, 7.58438091e-07f, 0.00239652954f, 0.000353652547f,
+    0.000294505357f, 0.00193592743f, -0.00126504083f, -0.00040008442f, 0.00210276106f, -0.000374146068f, -0.00160551991f, 0.00104739307f,
+    0.000948971254f, -0.00142951997f, 0.000411297835f, -0.000476554618f, -0.00173630356f, -0.00032030436f, 9.48473389e-05f, -0.00171980169f,
+    0.000815162901f, -0.00118944375f, -0.00197209767f, 0.00120612851f, 0.000474543485f, -0.000246070907f, 0.000831553305f, -0.00147842616f
+};
+
+alignas(16) static const float conv_0_bias[16] = {
+    0.0644212216f, 0.027481541f, -3.95123792f, 0.257400066f, -0.0638634786f, 0.161944628f, -0.0144516313f, -0.0288715884f,
+    1.39043367f, 1.18865788f, 0.392010182f, 0.158985853f, 0.0689308494f, -0.00824701227f, -0.00639380887f, 0.294760317f
+};
+
+alignas(16) static const float tensor_5[4608] = {
+    0.137980402f, -0.245286316f, 0.0556504801f, 0.00292305951f, 0.071082443f, 0.0738009512f, -0.0462412536f, -0.00902280957f,
+    -0.001381765f, 0.0588135794f, 0.0621234365f, 0.0542448089f, -0.00761842122f, -0.254277617f, -0.00132770441f, -0.132071465f,
+    0.0332965218f, -0.0863025486f, -0.112411812f, -0.0946959183f, 0.0657305196f, -0.0276335329f, 0.0209961757f, -0.0947364196f,
+    0.041019313f, 0.145968959f, 0.115706988f, 0.092608802f, -0.104613826f, -0.177981049f, 0.0185516626f, -0.0207494181f,
+    0.11324764f, -0.0400483795f, -0.0730932206f, -0.0712001622f, -0.000606597401f, 0.0107292673f, -0.0614433587f, -0.0384775363f,
+    0.00972827151f, 0.0976765305f, 0.117635854f, 0.0768225789f, -0.204714909f, -0.192354128f, -0.06889835f, -0.0866782367f,
+    0.103210926f, -0.269448578f, -0.0436523482f, 0.0452811904f, -0.0292607192f, 0.0575804748f, -0.0879084766f, -0.00571175572f,
+    -0.0180868749f, -0.0246298146f, 0.162134349f, 0.11687728f, -0.0477918908f, -0.198324069f, 0.08496923f, -0.141789466f,
+    0.0797390789f, -0.237142533f, -0.134866342f, -0.0867119282f, -0.114226624f, -0.000265754352f, -0.117243662f, 0.00143490813f,
+    0.0584334657f, 0.114800669f, 0.0587911829f, 0.0560414605f, -0.0288991276f, -0.134045795f, 0.17828384f, -0.0748583302f,
+    0.113839529f, -0.21053043f, 0.0358422808f, -0.0642036572f, -0.0893470272f, 0.0318872631f, -0.068758294f, -0.129613861f,
+    -0.00832715724f, 0.123134002f, 0.150380582f, 0.00427638227f, -0.00783689413f, -0.242699578f, 0.0248260908f, -0.0939883664f,
+    0.100082323f, -0.266275853f, 0.0321380906f, 0.019103948f, 0.0214216057f, 0.215837643f, -0.03687343f, -0.0502032004f,
+    0.0308920648f, -0.00279533956f, 0.00142689166f, 0.119875193f, -0.0273357108f, -0.130807191f, 0.180041641f, -0.0751330182f,
+    0.0682758763f, -0.231623039f, 0.14513807f, -0.00709812809f, 0.0379306339f, 0.179327518f, -0.0285251867f, -0.0564510226f,
+    0.0116620399f, -0.024892481f, 0.0545405187f, 0.119892888f, -0.0457115844f, -0.147427112f, 0.132229403f, -0.0878470689f,
+    0.0990873724f, -0.250746846f, 0.104055956f, -0.0370304212f, -0.00714087347f, 0.116612382f, -0.0446786098f, -0.0401410609f,
+    0.0255536623f, 0.0339108035f, 0.0113250948f, 0.0268184133f, 0.000660451187f, -0.135969669f, 0.198634118f, -0.0494669676f,
+    -0.173335716f, -0.224910066f, 0.0332689621f, -0.0266629793f, 0.00871661771f, 0.0243498106f, 0.1050632f, 0.183397323f,
+    0.0883514509f, -0.164412037f, -0.0846308023f, -0.219852313f, -0.012048848f, -0.248333484f, -0.475619704f, 0.00710090576f,
+    -0.185375735f, -0.225347385f, -0.0304012615f, -0.000906488043f, -0.076336734f, -0.028770078f, 0.183582917f, 0.0693678781f,
+    0.123242922f, -0.20380038f, -0.166423559f, -0.169370055f, 0.111302383f, -0.181977361f, -0.346885681f, 0.119954556f,
+    -0.249502167f, -0.198017046f, -0.0600665994f, 0.120625265f, 0.0391880572f, -0.0164629556f, 0.140547276f, 0.177664846f,
+    0.106434502f, -0.0593106374f, -0.00737431133f, -0.301400691f, 0.00921077654f, -0.103123426f, -0.518709183f, 0.074118495f,
+    -0.0569889769f, -0.372292876f, 0.0800916404f, -0.0329893939f, -0.142403811f, -0.00790390186f, 0.0800538212f, 0.128599316f,
+    -0.0504682586f, -0.0250409655f, -0.0754320249f, -0.145570949f, 0.00610189093f, -0.116603419f, -0.293619573f, -0.00313234213f,
+    -0.145669654f, -0.213086784f, 0.0509297736f, 0.100470476f, -0.140635267f, 0.0521573126f, 0.0903517976f, 0.0447148494f,
+    0.0418977365f, -0.0955482647f, -0.11698398f, -0.0524377525f, -0.0117455004f, -0.127743453f, -0.247539788f, -0.00996748917f,
+    -0.101692729f, -0.17659159f, -0.00904552266f, -0.00290715205f, -0.0244039726f, 0.0457487479f, 0.014714459f, 0.0704108253f,
+    0.16271691f, 0.0725234598f, 0.0400080644f, -0.116963886f, -0.0249133501f, -0.259847552f, -0.434824228f, -0.00862436648f,
+    0.00199286058f, -0.340494394f, 0.0990188643f, -0.0171132367f, -0.0146493912f, -0.0723068267f, 0.105862439f, 0.194937035f,
+    0.0706556365f, -0.0122498004f, -0.107580893f, -0.0126802986f, 0.169475436f, 0.0969849005f, -0.523738205f, -0.107394613f,
+    -0.0783558041f, -0.185805798f, 0.0824490264f, 0.0940453187f, -0.0471227393f, 0.0663517714f, 0.167184651f, 0.07614135f,
+    -0.0180072114f, -0.14438051f, -0.151797086f, -0.205579087f, 0.0111140469f, -0.0456172302f, -0.460137844f, -0.0826479346f,
+    -0.0362581871f, 0.00728426175f, -0.101645596f, -0.0386061706f, -0.0255518928f, -0.101601399f, 0.129068583f, 0.0947719365f,
+    0.118374512f, -0.0544244424f, -0.0303173065f, -0.111773387f, -0.0304062571f, -0.269614041f, -0.664470077f, -0.00964638591f,
+    0.0149167292f, -0.406106651f, -0.213729367f, -0.00185290747f, 0.00969034899f, -0.0849549249f, -0.196718186f, -0.267101854f,
+    -0.0160699338f, 0.097803764f, 0.119144268f, -0.0106089478f, 0.0128075341f, -0.278234214f, -0.178398535f, -0.0626251325f,
+    -0.062801674f, -0.338889509f, -0.120868832f, -0.0108118523f, -0.0106508173f, -0.0950900018f, -0.270913959f, -0.221676528f,
+    -0.0424274504f, 0.0623463057f, 0.0332288854f, -0.0306635853f, -0.108047269f, -0.285557657f, -0.110463761f, -0.101331979f,
+    0.0408851728f, -0.260171294f, -0.189686835f, -0.0332733467f, 0.0675761476f, -0.058823783f, -0.2260454f, -0.247551695f,
+    0.0391170084f, 0.118541531f, 0.146079272f, -0.0962390304f, -0.157137945f, -0.325956464f, -0.140807107f, -0.0661799237f,
+    -0.0783432275f, -0.505365729f, 0.0265882295f, 0.0195854846f, 0.0314626619f, -0.0794027597f, -0.245284453f, -0.243587643f,
+    0.0405104794f, 0.0704234838f, 0.139968321f, -0.0160215665f, -0.111080036f, -0.0913444832f, 0.0346738435f, -0.0305654705f,
+    -0.027128309f, -0.435981572f, 0.0105540119f, 0.036505565f, 0.0119763333f, -0.0916866139f, -0.305978149f, -0.192767397f,
+    -0.022714613f, -0.0252581239f, 0.106108315f, -0.00222996669f, -0.103588969f, -0.175597787f, -0.0518991314f, -0.146690786f,
+    -0.0599817373f, -0.372200161f, 0.0682896003f, -0.00257932954f, -0.0266924798f, 0.00183385937f, -0.267596275f, -0.29855004f,
+    -0.0255640503f, 0.0267570969f, 0.150286496f, -0.0269702151f, -0.186830327f, -0.304026455f, -0.0126687437f, -0.0331650823f,
+    -0.00843043346f, -0.510541379f, 0.283235461f, -0.0221408121f, 0.0521415584f, 0.113799423f, -0.25675565f, -0.224910423f,
+    0.0313429572f, 0.0624515451f, 0.0614872687f, 0.0405443273f, 0.0528948456f, -0.0694101676f, 0.105577916f, -0.15981546f,
+    -0.0240391586f, -0.43218419f, 0.206556723f, -0.0314168409f, 0.0632473901f, 0.0353924967f, -0.183332205f, -0.228172183f,
+    -0.0221415069f, -0.0293018315f, 0.104630262f, 0.0511526838f, -0.043190904f, -0.0950004682f, 0.118308738f, -0.0423790291f,
+    0.0472591035f, -0.536917329f, 0.335188776f, -0.138035238f, 0.0538240783f, 0.122018956f, -0.189723387f, -0.139391154f,
+    0.0332194455f, 0.0673030093f, 0.0245822314f, -0.0765874162f, 0.0236573257f, -0.122465074f, 0.275055617f, -0.127717733f,
+    0.0454035215f, 0.0664328709f, -0.0877269804f, -0.192256182f, -0.0722942799f, 0.0974263325f, -0.0663842857f, 0.0407338589f,
+    -0.0155435652f, 0.122515999f, 0.109992877f, 0.0865135714f, -0.0298517011f, -0.253905982f, 0.0983539671f, -0.064130947f,
+    0.110385135f, 0.0746508092f, -0.242151156f, -0.13752462f, -0.134760424f, 0.071345076f, -0.175739452f, -0.00460927701f,
+    -0.00110485964f, 0.0361035466f, 0.157699466f, 0.149447218f, -0.0557575114f, -0.166542187f, 0.182061091f, -0.0908210352f,
+    0.123212457f, 0.061394915f, -0.190742224f, 0.0179360993f, -0.280794531f, 0.175204605f, -0.228942022f, -0.0487855263f,
+    0.0384551883f, 0.0360589921f, 0.173361942f, 0.0531237274f, -0.0110687632f, -0.0345765091f, 0.232307687f, -0.119558305f,
+    0.0323154256f, -0.166390851f, 0.0174870677f, -0.0683746636f, 0.0248222165f, 0.0907809809f, 0.0432011858f, -0.0207054075f,
+    0.0541645363f, -0.0418459363f, 0.0610006973f, 0.110638291f, -0.0267741196f, -0.0486128367f, 0.157329291f, -0.0172104277f,
+    -0.0426262319f, -0.0439577214f, 0.0156492181f, -0.0962247401f, -0.0942196697f, 0.146863848f, 0.0378444903f, -0.0626812726f,
+    -0.0525791161f, -0.0373874679f, -0.057889048f, 0.0602824464f, -0.0259426814f, -0.061020758f, 0.127277493f, -0.0925129429f,
+    0.0450903289f, -0.103939243f, 0.0489134975f, -0.0462239757f, 0.0190552305f, 0.151144475f, -0.0504874252f, -0.0108839013f,
+    0.0427967831f, -0.0511725396f, -0.049091164f, 0.0901830941f, 0.0982570201f, -0.0920118764f, 0.177192152f, -0.027231995f,
+    -0.0414048955f, -0.207491249f, 0.10122399f, 0.0633158311f, 0.179707959f, 0.0583303459f, 0.0565602109f, 0.0605954863f,
+    0.0340241194f, -0.0917254239f, -0.130421489f, -0.0980723798f, 0.0110344915f, -0.0319774002f, 0.18244195f, 0.0405484959f,
+    -0.104918152f, -0.156556889f, 0.139384478f, 0.0733643547f, 0.135785937f, 0.085416615f, 0.148468837f, 0.0997807756f,
+    0.0419257469f, -0.0797212645f, -0.198653594f, -0.115357324f, 0.0490677282f, 0.0334932208f, 0.0514357202f, 0.0954282358f,
+    -0.0100613264f, -0.06148481f, 0.163240746f, 0.165167302f, 0.192867115f, 0.155393928f, 0.0958635956f, 0.0681257024f,
+    -0.0343926735f, -0.172017753f, -0.174364105f, -0.0821208879f, 0.0314521939f, -0.0866346881f, 0.067549333f, -0.00386584061f,
+    0.0673963502f, 0.313810289f, 0.0433069468f, -0.115003102f, -0.0876763985f, -0.06419231f, 0.0419006087f, -0.0732381791f,
+    -0.067507796f, -0.0710270703f, -0.0238582287f, -0.0302300863f, 0.117362872f, 0.224441513f, 0.0371556506f, 0.0379130319f,
+    0.00843861513f, 0.437552005f, -0.0551626496f, -0.181200996f, -0.150403142f, -0.0463581569f, -0.0168991201f, 0.0347499363f,
+    -0.038038563f, 0.0718629286f, 0.067717433f, -0.00888391491f, -0.0955967531f, -0.114014618f, -0.190001369f, 0.0717282444f,
+    0.0462990031f, 0.0706734732f, 0.0857296884f, 0.00153047778f, -0.146709591f, 0.0113596441f, -0.166841105f, 0.0321369767f,
+    -0.0297463816f, 0.12640661f, 0.0248967204f, 0.0315868631f, 0.102414213f, 0.148973465f, 0.0174457803f, 0.0503750667f,
+    -0.101985432f, 0.320806712f, 0.13860476f, -0.127457008f, -0.0798634663f, -0.0907014012f, 0.135860622f, 0.128622919f,
+    0.00471689412f, -0.0174642764f, -0.0519133136f, -0.149339586f, 0.00677224528f, 0.116473511f, -0.0131506082f, 0.105082639f,
+    0.0778146163f, 0.430284083f, -0.0584375523f, -0.164207578f, -0.0547080524f, -0.0446463265f, -0.0256526303f, -0.0633133575f,
+    0.0505401231f, 0.0412988551f, 0.0771794617f, -0.0290745515f, -0.1070484f, -0.0861090943f, -0.0942353159f, 0.0070934766f,
+    0.0309849847f, 0.032490924f, -0.000133004098f, -0.0821691379f, -0.0878564119f, 0.0552266948f, -0.171576142f, -0.0549777262f,
+    0.0654088408f, 0.0518329404f, 0.0715487376f, 0.128985316f, 0.0848673135f, 0.236874983f, 0.132905245f, 0.0763131529f,
+    -0.12549673f, 0.377447844f, -0.0399888605f, 0.0427021049f, 0.0417809784f, -0.190760195f, 0.0755128711f, 0.0526356474f,
+    -0.0495637134f, -0.107994266f, -0.052755516f, -0.185815975f, 0.0500523411f, 0.181631088f, -0.177628636f, 0.0526916124f,
+    0.0272477008f, 0.330775589f, -0.0417997465f, 0.0025441281f, -0.0629779994f, -0.0533086509f, -0.0732854903f, -0.0633390695f,
+    -0.00326805585f, 0.027900517f, 0.0831252933f, -0.0522790812f, -0.072588712f, 0.0442651249f, -0.108449332f, 0.0404873975f,
+    0.0837598518f, 0.100348614f, -0.0281848479f, -0.13216798f, -0.126981691f, -0.0532523915f, -0.0205859821f, 0.0055797603f,
+    0.0360481367f, 0.0476491451f, -0.0527828746f, 0.067818895f, 0.112579867f, 0.15191339f, 0.03546964f, 0.0737459883f,
+    -0.167072445f, 0.00251854514f, 0.0167990588f, -0.0405191816f, 0.0132029215f, 0.0232238229f, 0.127075806f, -0.00762480125f,
+    0.00676447479f, -0.147461995f, 0.0133873131f, -0.234177738f, 0.0304024573f, -0.205629066f, -0.26670891f, 0.0284514148f,
+    0.0219171215f, 0.150018245f, -0.0553019792f, -0.0711043403f, -0.013064377f, -0.00449366495f, 0.0758457407f, -0.0144525059f,
+    -0.0680040568f, 0.0618581101f, 0.0445309468f, 0.0145366099f, -0.083211787f, -0.197200373f, -0.329889178f, 0.0833268836f,
+    0.11828313f, 0.279809594f, -0.14325881f, -0.0597703606f, -0.0842600465f, -0.0560163297f, -0.100317664f, -0.129143551f,
+    0.073817268f, 0.0884677544f, 0.158355355f, 0.104662523f, -0.168214709f, -0.123422697f, -0.187152043f, -0.0403859392f,
+    -0.0924786851f, 0.143435761f, -0.0325109996f, -0.00672803586f, -0.0542357303f, -0.0763281062f, 0.0778858364f, 0.109766982f,
+    0.0453362651f, -0.18142122f, -0.122385375f, -0.233118504f, 0.0223561171f, -0.218065351f, -0.420961767f, 0.0641731173f,
+    -0.0341215804f, 0.17333509f, -0.14365615f, -0.0601151288f, 0.0115050506f, -0.135286182f, 0.0265990254f, 0.0374807119f,
+    -0.08837495f, 0.0252859164f, 0.0681014657f, -0.0773408487f, 0.0539522469f, -0.0854158252f, -0.261381596f, 0.0743274167f,
+    0.136489347f, 0.259051651f, -0.0862025768f, 0.00691358233f, -0.150498584f, -0.106706299f, 0.0537662953f, -0.0757457167f,
+    0.000679744058f, 0.152623013f, 0.134576753f, 0.126281038f, -0.0764585957f, -0.172478735f, 0.0615109056f, -0.0204471238f,
+    -0.228751034f, 0.367191702f, -0.040894676f, 0.0356191285f, 0.108459331f, -0.113613904f, 0.0296472628f, -0.00350548723f,
+    -0.051623024f, -0.0707506686f, -0.168687597f, -0.259378701f, -0.0024213437f, -0.264991313f, -0.221530333f, 0.157611549f,
+    -0.0976240635f, 0.200367048f, -0.158289343f, 0.0465411544f, -0.0197043922f, -0.0520176478f, 0.0405085534f, 0.0256156567f,
+    0.0227311254f, 0.0450044572f, 0.0948595852f, -0.105062127f, -0.0120102819f, 0.0717850178f, -0.0405959599f, 0.0734443069f,
+    0.0786125585f, 0.162449479f, -0.0344839096f, -0.0533591062f, -0.0697800666f, 0.0514927655f, -0.0189138949f, -0.0151040703f,
+    0.0595572963f, 0.0653008744f, 0.0120096244f, 0.0378043167f, 0.00359744183f, 0.00397536065f, 0.144222319f, -0.0368863195f,
+    0.113836706f, -0.00979448948f, -0.214688063f, -0.0826119259f, -0.162710294f, 0.00252474984f, -0.139285967f, -0.0559084564f,
+    -0.149936035f, 0.0205050521f, -0.0137502039f, 0.0376025029f, 0.111316934f, 0.191505134f, 0.157629311f, -0.105727471f,
+    -0.0433323085f, 0.246665582f, -0.159348831f, -0.11593312f, -0.200627282f, -0.0298576355f, -0.0909307301f, -0.0647795796f,
+    -0.0950864404f, 0.0129531063f, -0.0648572594f, -0.0337659232f, 0.0125005441f, 0.107410684f, 0.0982729495f, 0.00631231675f,
+    -0.00910616573f, 0.189496547f, -0.197159171f, -0.169148549f, -0.17893067f, -0.0418895781f, -0.132714659f, -0.152521119f,
+    0.0601223893f, 0.0906592086f, -0.0774063841f, 0.103528865f, -0.0316694677f, -0.0570800416f, -0.0424162038f, -0.0342245325f,
+    0.00803880673f, 0.0410261713f, -0.142766938f, 0.0591774061f, -0.104002684f, 0.000844262016f, -0.133707806f, 0.091748938f,
+    -0.0723645613f, 0.0607899092f, -0.0599926412f, 0.0432966165f, 0.166281894f, 0.185702458f, 0.0221139006f, -9.21239916e-05f,
+    0.0364486314f, 0.317281842f, -0.12693955f, 0.0132045308f, 0.0423058644f, -0.00975742657f, 0.0268758219f, 0.145932674f,
+    0.0167878009f, 0.0102320975f, -0.068620123f, -0.0387964658f, 0.115212955f, 0.185659945f, 0.136681423f, -0.0681597665f,
+    0.0363700986f, 0.333137274f, -0.152331069f, 0.0216308255f, -0.147805527f, -0.0278932247f, -0.0969154462f, -0.0112969251f,
+    -0.0200487841f, 0.153291002f, -0.0200175568f, -0.0143581415f, -0.0843246952f, -0.191083223f, -0.183763534f, -0.00729121082f,
+    0.17254743f, -0.0536191761f, -0.279058754f, -0.0568783693f, -0.162272409f, 0.0273595918f, -0.135684207f, -0.110271558f,
+    0.0370685086f, 0.163958803f, 0.0591215082f, 0.218707532f, 0.0557077229f, 0.125020057f, 0.0475261994f, -0.17435877f,
+    -0.0230858587f, 0.195563778f, -0.207350716f, 0.0719258115f, -0.154899895f, -0.0758608133f, 0.029431209f, 0.0395384133f,
+    -0.045304779f, 0.032870084f, -0.108557537f, 0.123118401f, 0.0732013211f, 0.238036007f, 0.0253253393f, -0.0741011873f,
+    0.0120275365f, 0.400852025f, -0.226410136f, -0.0902964771f, -0.236986533f, -0.0622975938f, -0.0694356114f, -0.00691384729f,
+    -0.0226711761f, 0.113488279f, -0.0555810966f, 0.0270567257f, -0.0501935184f, 0.0393766761f, -0.0811358392f, -0.0893993825f,
+    -0.0466420799f, -0.0551785901f, 0.141758472f, -0.117736034f, 0.269166261f, -0.179635748f, 0.0328515805f, 0.114543587f,
+    -0.0947801694f, 0.118727326f, 0.116212383f, -0.131932229f, -0.11626333f, 0.120286956f, -0.326393634f, -0.119531348f,
+    -0.0450631529f, -0.08557944f, 0.138375834f, -0.217668459f, 0.267342955f, -0.240811214f, 0.18268469f, 0.0305430442f,
+    -0.0573244914f, 0.021827735f, 0.140203342f, -0.104788519f, -0.187933236f, -0.0795143396f, -0.409451842f, -0.281808943f,
+    0.032255277f, -0.157630086f, 0.108267583f, -0.233644664f, 0.136538014f, -0.153404877f, 0.156388715f, 0.0257893521f,
+    -0.0383341871f, 0.0755435377f, 0.115753464f, -0.0120748999f, -0.149003074f, -0.0884945244f, -0.256663918f, -0.248966262f,
+    -0.00427041715f, -0.12089175f, -0.0612292029f, -0.178203002f, 0.0587550327f, -0.103846706f, -0.103164062f, -0.0616261959f,
+    0.0663482249f, 0.164118022f, 0.139684707f, -0.00872810278f, -0.216394648f, -0.283072025f, -0.0495975614f, -0.231566295f,
+    -0.0488900505f, -0.165857419f, 0.0111073041f, -0.0758975446f, 0.0208040606f, -0.116522104f, -0.0154752461f, -0.101199642f,
+    -0.0714171901f, 0.150503263f, 0.0895339996f, -0.0164928734f, -0.218356505f, -0.0486345738f, -0.107556731f, -0.110638909f,
+    -0.0304516815f, -0.378873914f, -0.0507844761f, -0.0917094275f, 0.0442767516f, -0.0421980359f, 0.0191246942f, -0.105390497f,
+    -0.0191508848f, 0.141590059f, 0.114190698f, 0.068038784f, -0.199024022f, -0.0178884137f, -0.0891542882f, -0.13962169f,
+    0.1104647f, -0.368198752f, -0.126093745f, -0.216457382f, -0.159922004f, -0.0125295781f, -0.259240955f, -0.128089458f,
+    -0.071181491f, 0.182013407f, 0.15630509f, 0.0502281114f, -0.244017422f, -0.297979265f, -0.0711862147f, -0.265277892f,
+    0.0615361482f, -0.308586746f, -0.0654882044f, -0.239647165f, -0.161560521f, -0.0534011349f, -0.203625292f, -0.256474614f,
+    -0.0624693334f, 0.188555494f, 0.154516146f, -0.00177101081f, -0.102534719f, -0.175816894f, -0.0238891505f, -0.180177718f,
+    0.0912322626f, -0.487718344f, -0.0414906703f, -0.153914303f, -0.00862370618f, -0.0113555389f, -0.221373111f, -0.252004504f,
+    0.0279642269f, 0.189787701f, 0.0874204114f, 0.0821215659f, -0.222222507f, -0.0568266697f, 0.00680397078f, -0.183984846f,
+    0.0951333717f, -0.382451773f, -0.0701404065f, -0.0852139816f, -0.21661526f, -0.000899289851f, 0.052573774f, 0.130062655f,
+    0.0354762413f, -0.025919985f, -0.0855939612f, 0.0225917287f, 0.0794228464f, -0.311560363f, -0.040697746f, 0.0307328999f,
+    0.0254883636f, -0.325025469f, -0.0415457338f, -0.0253549423f, -0.130671561f, 0.116393417f, 0.0355812348f, 0.0939440355f,
+    -0.0267073195f, 0.0382677689f, -0.00825737696f, 0.105465814f, 0.0816105306f, -0.1663827f, -0.0253886953f, -0.0377687141f,
+    0.130339831f, -0.0876385048f, -0.135961384f, -0.11125277f, -0.203251496f, 0.0955730379f, -0.0458210707f, 0.0707948282f,
+    -0.0576465949f, -0.0196083002f, 0.0496943779f, 0.153077573f, -0.0560139194f, -0.15669544f, 0.0212704875f, -0.0030553909f,
+    0.0926297382f, -0.310253143f, -0.0611286536f, 0.03144091f, -0.190050095f, 0.154856697f, 0.0891402289f, 0.161271274f,
+    -0.0606998056f, -0.121059604f, 0.0126315197f, 0.11680077f, -0.0389396362f, -0.238387719f, 0.0711244792f, 0.0202533808f,
+    0.0883352086f, -0.369466692f, -0.0641093478f, -0.0590695925f, -0.249572143f, 0.120620996f, 0.00109463162f, 0.0372705087f,
+    -0.0196091719f, -0.0926464126f, -0.121158108f, 0.0676111281f, 0.0547834076f, -0.312662512f, -0.0459056683f, -0.0142014027f,
+    0.082016252f, -0.089887619f, -0.0148222242f, 0.0348113999f, -0.212315008f, 0.132069826f, -0.0482941344f, 0.0351515077f,
+    0.101958774f, 0.0287404675f, -0.00615871232f, 0.125756949f, 0.0146595016f, -0.157690734f, 0.0486302152f, 0.0180623513f,
+    -0.0154377576f, -0.405046523f, 0.143453985f, 0.0399684794f, -0.342386127f, -0.0324139297f, -0.0457132757f, -0.00542444503f,
+    -0.0433274731f, -0.0812599957f, -0.0748180151f, -0.0376895219f, -0.0589903444f, -0.249966294f, -0.122657374f, 0.0575853176f,
+    -0.00492365984f, -0.331152797f, 0.0472610854f, -0.00156806642f, -0.357938528f, 0.0901028067f, -0.0480748527f, 0.102853946f,
+    0.0430755801f, -0.0928741023f, -0.000585333561f, 0.0053871898f, 0.0750535429f, -0.357553989f, -0.111298837f, 0.0505875461f,
+    0.00987629127f, -0.00281687034f, 0.0765021071f, 0.0196593795f, -0.249603301f, -0.0572994798f, 0.0467264093f, -0.0101433396f,
+    0.0650087893f, 0.0793023556f, -0.0177037697f, -0.00930720568f, 0.0830972865f, -0.213993818f, -0.207230359f, 0.102354549f,
+    0.0858643129f, 0.0680432171f, 0.00494523253f, -0.103795812f, -0.210495681f, 0.0280472394f, 0.0303294957f, -0.050951343f,
+    0.0375899561f, -0.0926977322f, -0.0432944708f, 0.1236654f, 0.140491664f, 0.232590482f, 0.163727f, 0.0242268518f,
+    0.0200136229f, 0.392225504f, 0.0251063667f, -0.161224887f, -0.107491232f, -0.153290614f, 0.0295536164f, -0.0570555739f,
+    -0.0829492211f, 0.0483516268f, 0.0572423637f, 0.0332456715f, -0.0702128857f, -0.0059132413f, -0.0534291603f, -0.0764986351f,
+    0.0135755548f, 0.340010196f, 0.100310765f, -0.0502633452f, -0.120893113f, -0.185711786f, -0.0175656341f, 0.0737540871f,
+    0.0424979106f, -0.000697071431f, 0.106415562f, 0.00381689076f, -0.0918487981f, 0.00560946483f, -0.0745126978f, 0.0615154207f,
+    0.0170984827f, 0.163800701f, 0.117716447f, -0.226142347f, -0.0820567533f, 0.0582254529f, -0.0319014266f, 0.0886716917f,
+    -0.0906658247f, -0.11597193f, 0.0111322934f, -0.0366513468f, 0.062816903f, 0.176273063f, 0.182262644f, -0.0704255998f,
+    -0.0415380672f, 0.356317639f, -0.0695713013f, -0.0910805836f, -0.140982628f, -0.188802853f, 0.00554718357f, 0.0142268687f,
+    0.0180461127f, 0.0724893287f, 0.000959593803f, -0.0682970509f, -0.172643125f, -0.111477405f, -0.128936023f, -0.0743481442f,
+    0.0845731422f, 0.282310396f, -0.0814364105f, -0.0401467904f, -0.159860194f, -0.0434238464f, -0.0525068976f, -0.0626522005f,
+    -0.0193983167f, 0.151398271f, 0.132603943f, 0.0126805073f, -0.0414298065f, 0.010104239f, -0.0135149136f, 0.0740789473f,
+    -0.00659997202f, 0.206598386f, 0.0774129182f, -0.0755250677f, 0.0641969144f, -0.195077881f, 0.154463619f, 0.110147275f,
+    -0.0810192749f, -0.0360791795f, -0.131262675f, -0.121498503f, 0.100725219f, 0.213162467f, -0.0575213879f, 0.00997910276f,
+    0.0537374355f, 0.315143496f, -0.00561089488f, -0.0216609444f, -0.0991854146f, -0.10899999f, 0.00973496865f, 0.01531645f,
+    0.063723661f, -0.00669489242f, 0.00823343545f, -0.101487212f, -0.106066778f, -0.125971198f, -0.117429361f, 0.11613518f,
+    0.0252864938f, 0.115733624f, -0.0840639398f, 0.00942399446f, -0.153740868f, 0.00250946451f, -0.109165184f, -0.0779854506f,
+    0.0973848477f, 0.0969097018f, 0.125177249f, 0.113649778f, 0.0646086186f, 0.091135107f, 0.131719276f, 0.0851527452f,
+    -0.0866846219f, -0.03889158f, 0.0816589594f, -0.0217035823f, -0.0703635216f, -0.111237213f, 0.0360532105f, -0.0140244281f,
+    0.0242295321f, 0.02225242f, -0.0121535705f, 0.0233878586f, 0.227825657f, 0.133411556f, 0.101637043f, -0.016033968f,
+    -0.0251692925f, 0.376662672f, -0.0856303349f, -0.250910342f, -0.114022434f, -0.224610731f, -0.0621659122f, -0.00661481451f,
+    -0.0568129495f, 0.101190545f, -0.0351574197f, 0.0148986857f, -0.115889333f, -0.0861994699f, -0.267157257f, -0.125814274f,
+    0.163779601f, 0.25987789f, 0.0677945688f, -0.0761538818f, -0.237759277f, -0.00831388682f, -0.0974696279f, -0.00353795197f,
+    -0.0363918692f, 0.145150572f, 0.173084646f, 0.144323379f, 0.115789391f, 0.179754615f, 5.78280233e-05f, -0.0401729308f,
+    -0.107602596f, 0.270415604f, 0.0717969015f, 0.0176616274f, 0.00792454649f, -0.116719969f, -0.0640959963f, -0.015722191f,
+    0.0986273587f, -0.0888787732f, -0.00716382358f, -0.0869499817f, 0.140882015f, 0.275130928f, 0.0896583945f, 0.0434177332f,
+    0.00346683734f, 0.299559861f, -0.0784845203f, -0.0415365472f, -0.123477526f, -0.130400866f, 0.0642906278f, -0.0900513157f,
+    -0.0827944279f, -0.031940721f, 0.0433312692f, -0.117902674f, -0.196099639f, -0.0804651156f, -0.27138713f, -0.0107900845f,
+    0.0620095767f, 0.0314978622f, 0.0717718452f, -0.23475033f, -0.0865098163f, -0.00328856194f, -0.0883095786f, -0.0219137035f,
+    -0.0216686297f, 0.120666064f, 0.128360793f, 0.14578864f, 0.0297156218f, 0.266420543f, 0.0244016461f, -0.134636059f,
+    -0.0997278467f, 0.392900705f, -0.02428413f, -0.00592444837f, 0.00232638372f, -0.189767271f, 0.0354807191f, 0.0418735296f,
+    -0.028300276f, -0.0740894079f, 0.0242623203f, -0.184213892f, 0.0203303918f, 0.140946269f, -0.155212179f, 0.0847303867f,
+    0.0790539011f, 0.362935603f, -0.0948113874f, -0.00242413627f, -0.116171643f, -0.211468175f, 0.0272182897f, 0.0850137398f,
+    0.0572961718f, 0.0845210925f, 0.0401498526f, -0.101043649f, -0.0947751254f, 0.153414607f, -0.153844014f, -0.0354540572f,
+    0.067736797f, 0.105082959f, 0.0519638136f, -0.241634905f, -0.000133275476f, -0.102567323f, 0.0105466591f, -0.100346178f,
+    0.0675637722f, 0.0234746374f, 0.107819065f, -0.00182106579f, -0.0722216293f, 0.184209362f, -0.0887483209f, -0.0634289607f,
+    -0.0523788705f, 0.265829593f, 0.0436178409f, 0.049021665f, 0.174498245f, -0.245967299f, 0.0922661275f, 0.146093488f,
+    -0.184509322f, -0.181156456f, -0.0884022415f, 0.00650484581f, -0.0569810085f, -0.197038651f, -0.309399217f, -0.0010627181f,
+    -0.0213335697f, 0.13877517f, 0.127391502f, 0.0795608386f, 0.160108671f, -0.182164192f, 0.142027512f, 0.116292275f,
+    -0.144020513f, -0.0915380642f, 0.0106871631f, -0.0212998819f, -0.0613600723f, -0.0810676441f, -0.0772151798f, 0.0425409861f,
+    0.0709285811f, 0.128588766f, 0.0521323271f, 0.135758728f, 0.0306340791f, -0.0959640071f, 0.107772417f, 0.0823046193f,
+    -0.135341123f, -0.011086164f, -0.065496251f, -0.0701517016f, 0.0306179356f, -0.115506709f, -0.0488752089f, -0.00194485497f,
+    0.126914382f, 0.279006571f, 0.0135580553f, 0.0589623749f, -0.00741910189f, -0.15945895f, -0.00888032373f, 0.0726354048f,
+    -0.058958374f, -0.0135989888f, 0.0302305557f, -0.0212195423f, -0.13623473f, -0.0955965519f, -0.179282621f, 0.021786632f,
+    -0.0171332564f, 0.192373902f, 0.00480662286f, 0.0340066701f, 0.0961276144f, -0.0379155241f, 0.105361782f, 0.102171488f,
+    0.0102216378f, -0.0586197302f, -0.117310502f, 0.0138225295f, 0.0175892469f, -0.00655184081f, -0.00599096762f, 0.00553040253f,
+    -0.0662491843f, 0.0653321445f, 0.0184605233f, 0.0811061189f, -0.00285206712f, 0.0924624652f, -0.0208322499f, 0.0840277001f,
+    -0.0373493358f, -0.161994189f, -0.124114312f, 0.0836169571f, 0.0210662782f, 0.0125827463f, 0.0973154604f, 0.023826668f,
+    0.0415124744f, 0.140068948f, -0.140841976f, -0.0582486913f, -0.172103673f, 0.0728741437f, -0.133859277f, -0.0585629866f,
+    -0.0717838183f, -0.0410012007f, 0.0417028405f, 0.0350193381f, -0.0413305759f, -0.0998919532f, 0.176503792f, -0.0662179366f,
+    0.115440734f, -0.0635041445f, -0.090619795f, -0.0695100725f, -0.100346804f, 0.101002462f, -0.136715531f, 0.0350112803f,
+    -0.117832169f, -0.158191904f, 0.0168417189f, 0.064516075f, 0.0312421415f, 0.0487570316f, 0.247414783f, -0.0378689691f,
+    -0.0200313199f, -0.0748319104f, 0.00438191323f, -0.132650077f, 0.0467298962f, 0.144061759f, -0.0722239539f, -0.0614648461f,
+    -0.0466516465f, -0.162898436f, -0.15914996f, 0.102422886f, 0.0378918424f, 0.128242537f, 0.248028904f, -0.0931631327f,
+    0.0502494499f, -0.383107692f, -0.0968538597f, -0.00754911359f, 0.0968057439f, -0.102644198f, -0.23511222f, -0.222447664f,
+    -0.0454387069f, 0.0568062626f, 0.0573893785f, 0.0195140131f, -0.17874065f, -0.341763109f, -0.302462876f, -0.204947025f,
+    0.0382601097f, -0.322928667f, -0.126117259f, -0.10624595f, -0.0538024306f, -0.232471436f, -0.352813512f, -0.242416352f,
+    0.0719281733f, 0.0732660368f, 0.0568613783f, -0.038695816f, -0.248157918f, -0.375935763f, -0.392139971f, -0.198966786f,
+    -0.0472775698f, -0.27315411f, -0.170955554f, -0.0619042367f, -0.0677998587f, -0.151136547f, -0.304773748f, -0.423130542f,
+    0.0239583179f, 0.158597633f, 0.083608292f, -0.0669394135f, -0.314320415f, -0.487958908f, -0.483769238f, -0.257592976f,
+    0.0671631545f, -0.58442992f, -0.281352669f, -0.0960605517f, -0.0139308488f, -0.118891835f, -0.495987475f, -0.350744963f,
+    0.0831833035f, 0.058376126f, 0.0782492086f, 0.0407179371f, -0.205995396f, -0.227398083f, -0.254267961f, -0.244997934f,
+    0.0181250013f, -0.523487747f, -0.214650422f, -0.0493977144f, 0.0126854591f, -0.0486317426f, -0.384228498f, -0.293459713f,
+    -0.0627511144f, 0.0877318606f, 0.142389581f, -0.145333782f, -0.0852935389f, -0.230651051f, -0.242996529f, -0.12608844f,
+    0.00329251192f, -0.425245911f, -0.237845644f, -0.170719817f, -0.11029043f, -0.0844331458f, -0.454343855f, -0.442741156f,
+    -0.0480974056f, 0.176743776f, 0.114942946f, 0.00229463493f, -0.320103407f, -0.495558023f, -0.235776156f, -0.128303617f,
+    0.0654573515f, -0.787484169f, -0.149997488f, -0.206047103f, -0.0679746792f, 0.0121924272f, -0.542332947f, -0.382037371f,
+    0.0576048978f, 0.0847223327f, 0.0946893021f, 0.032247901f, -0.247586235f, -0.158569545f, -0.0333312899f, -0.241460755f,
+    0.0376801006f, -0.660916984f, -0.179577351f, -0.0695809871f, -0.0363417156f, 0.0147304498f, -0.44742763f, -0.404155314f,
+    0.0349653699f, 0.112468049f, 0.080920957f, 0.01903506f, -0.195758566f, -0.113503061f, -0.0943480805f, -0.204804927f,
+    -0.0440553129f, -0.578106284f, -0.105339982f, -0.105245814f, -0.141340718f, -0.035020873f, -0.401531458f, -0.34368965f,
+    -0.088601388f, 0.0707982033f, 0.113885432f, 0.0509999432f, -0.281212419f, -0.296992749f, -0.0227088146f, -0.196978301f,
+    0.0467050672f, -0.112431414f, 0.0304111335f, 0.114591934f, -0.18675825f, 0.0199715346f, -0.142025396f, -0.0178082343f,
+    0.1215792f, -0.079125002f, -0.0688774809f, 0.0208937302f, 0.204268798f, 0.235785857f, 0.0725646093f, 0.173875704f,
+    -0.121957034f, 0.172030553f, 0.0207229313f, -0.0395404808f, -0.248461992f, 0.126171142f, 0.0425313041f, -0.00258109975f,
+    0.120550044f, -0.146180674f, -0.00874409452f, -0.00247446797f, 0.0895756781f, 0.315531105f, 0.119950242f, 0.11469999f,
+    -0.0539037064f, 0.192393482f, -0.0961702317f, -0.108541712f, -0.339602828f, 0.0505270027f, -0.00801900867f, -0.181961238f,
+    -0.0129484273f, -0.01905974f, -0.0368686952f, -0.0494418256f, 0.0587582514f, 0.148109511f, 0.0697018728f, -0.0152715817f,
+    -0.0541320406f, -0.139964595f, -0.0259610433f, 0.00725160958f, -0.265153915f, 0.0368529372f, -0.0476111248f, -0.142536551f,
+    0.165987208f, -0.0687889308f, 0.024070872f, 0.118695974f, 0.147300258f, 0.301747024f, 0.279234231f, 0.00226888433f,
+    -0.0368794762f, 0.0282845981f, 0.0912858546f, -0.244683385f, -0.267005503f, 0.064227514f, 0.0333396941f, -0.0579421408f,
+    -0.00791971106f, -0.0918703452f, -0.125418574f, 0.110500984f, 0.115282096f, 0.192424223f, 0.081896998f, -0.0670889169f,
+    0.060015671f, 0.211358815f, 0.00427779835f, -0.123770416f, -0.223369256f, -0.0224544443f, -0.0998860002f, -0.0168785881f,
+    0.00515574077f, 0.0939004943f, 0.0891052559f, -0.0786255747f, -0.0903511643f, 0.0477580242f, -0.238331884f, 0.0027416877f,
+    -0.0028271114f, 0.0285457913f, 0.109352499f, -0.187248886f, -0.147296965f, 0.0745372027f, -0.0423615798f, -0.0493685007f,
+    -0.0279218201f, 0.0460003093f, 0.0183779467f, 0.0535894744f, 0.0211062655f, 0.294885993f, 0.26024887f, -0.035329219f,
+    0.0987487286f, 0.0963028595f, -0.00879472494f, -0.233820811f, -0.166158453f, -0.0395437554f, -0.0534434244f, 0.000785605051f,
+    0.0104151815f, -0.0154576078f, -0.0847247615f, 0.0381629132f, 0.0284242705f, 0.0428804271f, -0.113640003f, -0.0141364718f,
+    0.023923343f, 0.303901583f, -0.00308876554f, -0.164338499f, -0.151181757f, -0.0221102536f, -0.0848198012f, -0.0229188949f,
+    -0.082617335f, 0.0695860237f, 0.091868706f, 0.0865253806f, -0.1759132f, -0.0626233444f, -0.0427864566f, -0.137204975f,
+    -0.0346130952f, -0.00947783235f, -0.0312182959f, 0.117651939f, 0.0675837994f, 0.0182136837f, 0.195340618f, 0.136264339f,
+    -0.0276378319f, -0.0268796831f, 0.0776179582f, -0.15313594f, 0.0833579004f, 0.0185672175f, -0.237538427f, 0.180501834f,
+    -0.0414611474f, -0.0425680093f, 0.0335622802f, 0.103191622f, 0.0852397606f, 0.0473311171f, 0.130902931f, 0.203684777f,
+    -0.0710935071f, -0.0762573257f, -0.0292910766f, -0.208668396f, 0.16557762f, -0.0232701115f, -0.141373903f, 0.105267599f,
+    -0.036559578f, -0.0426873714f, -0.0151022393f, 0.220753282f, 0.0860636383f, -0.0735578462f, 0.206453368f, 0.217549503f,
+    -0.0693352669f, -0.10819713f, -0.0250378419f, -0.24359487f, 0.112598203f, 0.0151108056f, -0.253021032f, 0.114696242f,
+    -0.0583392717f, -0.327165723f, 0.0632310063f, 0.036552377f, -0.00731394533f, 0.0913096592f, 0.0759341493f, 0.0595031716f,
+    -0.060465645f, -0.121331558f, 0.0370319709f, -0.0640771538f, 0.00612209411f, 0.029666895f, -0.245883882f, -0.0242934823f,
+    -0.0166256204f, 0.0058374526f, 0.0543570071f, 0.0620855242f, -0.0494711772f, 0.0831741542f, 0.0323689543f, 0.0859298408f,
+    0.000514516665f, -0.0315887704f, 0.0194655359f, -0.0563542582f, 0.13665992f, -0.0852589458f, -0.134958565f, 0.113716796f,
+    -0.0569431596f, 0.0530332923f, 0.0459010154f, -0.0203480441f, 0.0474700816f, 0.0635918975f, 0.133104742f, 0.0387506224f,
+    0.0314644389f, -0.126261115f, 0.0608139671f, -0.119466923f, 0.017927561f, 0.0126466909f, -0.13882497f, 0.021534605f,
+    -0.0157045517f, -0.174943432f, 0.0470899306f, 0.0118926344f, 0.0363695957f, -0.102559648f, 0.104490057f, 0.0456293076f,
+    -0.0249912199f, -0.0806638002f, -0.0894709677f, -0.213436916f, 0.0382849947f, 0.0704037845f, -0.340878963f, -0.00780981965f,
+    -0.129612446f, -0.128491938f, 0.0788724422f, -0.0629815087f, 0.0485190116f, -0.0765903443f, 0.0790360048f, 0.115507662f,
+    -0.0739006177f, -0.171334371f, -0.0592872202f, -0.160044119f, 0.0811639503f, 0.038979046f, -0.304724514f, 0.0647138953f,
+    -0.11481943f, 0.176054776f, 0.0913814083f, -0.00376144494f, -0.0357865877f, -0.093268685f, 0.12074329f, 0.0200129915f,
+    -0.0489917286f, 0.0263436232f, 0.0956207812f, -0.0816354454f, 0.126985148f, -0.0309763793f, -0.304964364f, -0.0492451973f,
+    0.0317046456f, -0.0365158357f, -0.0759988874f, -0.0869019106f, -0.251776099f, -0.0530275181f, 0.000860278436f, 0.0586873926f,
+    -0.0207576398f, -0.0304944832f, 0.072088927f, -0.0193299651f, 0.0375724137f, -0.342631787f, -0.32514149f, -0.0290534571f,
+    0.0260104295f, -0.00635752268f, 0.0151810367f, -0.0202155318f, -0.221273988f, -0.0473923422f, -0.0233002771f, 0.0131531367f,
+    0.0749882832f, -0.0631334484f, 0.00177004107f, 0.0662563592f, 0.126771539f, -0.25506106f, -0.263729185f, 0.0216245707f,
+    0.124400057f, 0.0869773552f, -0.155448943f, 0.0337721109f, -0.185002282f, -0.0745360255f, 0.020594785f, 0.104809493f,
+    0.0435713716f, -0.0411939099f, 0.0761868209f, 0.0944052115f, 0.0254963897f, -0.107025765f, -0.233942941f, 0.151841462f,
+    -0.0391838513f, -0.0948107764f, -0.10679464f, -0.0320105739f, -0.223474979f, -0.0651682913f, 0.0370882452f, -0.0108646695f,
+    -0.0829532295f, 0.0353630334f, -0.0768278986f, -0.0104879178f, 0.0520000905f, -0.278383464f, -0.249176815f, 0.0640511662f,
+    0.103871569f, 0.0783998445f, -0.100440271f, 0.0146756237f, -0.128285274f, 0.0168838222f, -0.00603069365f, 0.0400769301f,
+    0.0159804262f, -0.0609911419f, -0.00496412767f, -0.059380386f, 0.0285573807f, -0.163997397f, -0.261323273f, 0.10485331f,
+    0.0982164592f, 0.0864773467f, -0.158116713f, -0.0598183013f, -0.179709524f, -0.129859746f, 0.108306803f, 0.113129459f,
+    0.0881590471f, 0.0889118314f, 0.0770427585f, 0.0158884656f, 0.0774255097f, -0.0924326628f, -0.282463223f, 0.0285030901f,
+    -0.0474135578f, 0.096998103f, -0.0696128383f, -0.096575357f, -0.107551545f, -0.00589395966f, 0.071682699f, 0.012511746f,
+    -0.00698254164f, 0.0221170932f, -0.0103826793f, -0.019864928f, 0.0739124343f, -0.186787903f, 0.020715192f, 0.0865825787f,
+    0.0804874077f, 0.175408468f, -0.180121928f, 0.0372735895f, -0.132662237f, 0.0378255174f, 0.0540549867f, 0.0640040711f,
+    0.0987203717f, -0.0638878569f, 0.0416913442f, -0.0101793222f, 0.072488986f, -0.0744504035f, -0.14359948f, 0.0540812947f,
+    0.0358462036f, 0.132580742f, -0.150372878f, -0.0280798972f, -0.122938544f, 0.00723753637f, 0.102153823f, 0.0259320736f,
+    0.0519578271f, 0.117259294f, -0.0203324948f, 0.0472417586f, 0.0963864997f, -0.0527448095f, -0.159134597f, 0.139330313f,
+    0.0406990424f, 0.428621441f, -0.0494471118f, -0.156195566f, -0.13054572f, -0.0189786814f, -0.0410803743f, -0.0767089054f,
+    -0.0402298905f, 0.0850455835f, -0.0542895533f, 0.0955427885f, -0.170199543f, -0.182942361f, -0.0931908786f, -0.190875649f,
+    0.0615293719f, 0.225676432f, -0.034255404f, -0.205459058f, -0.0219463594f, -0.201030478f, -0.010679448f, 0.0543053821f,
+    -0.00826285593f, 0.0934527069f, 0.0859282315f, 0.0576993637f, 0.0524064712f, 0.0522234552f, 0.0391151346f, -0.104151331f,
+    0.0972409546f, -0.0396312848f, 0.0490528829f, -0.218054935f, -0.0717548877f, -0.0340797044f, 0.0368104614f, 0.0612224638f,
+    -0.0581810176f, -0.115733601f, -0.0183412656f, 0.118425705f, 0.200210601f, 0.208215743f, 0.150957897f, -0.232968777f,
+    0.0303753894f, 0.399672836f, 0.0299904644f, -0.0323431417f, -0.0403127633f, -0.136987567f, 0.0780042261f, 0.147632971f,
+    -0.00336673157f, -0.00649576727f, -0.123957999f, -0.0997109562f, -0.0134425769f, 0.0911547914f, 0.00984506961f, -0.0592469908f,
+    -0.0304826442f, 0.312501997f, -0.141009793f, -0.307157755f, -0.0578083284f, 0.0108055808f, -0.101202793f, 0.00162252982f,
+    -0.0794296116f, -0.0283950623f, 0.0748711675f, 0.10046792f, -0.112549983f, 0.0686667189f, -0.0806501284f, -0.21061869f,
+    0.0865646973f, -0.0615336262f, 0.113702081f, -0.183410719f, -0.0077183675f, -0.0730178878f, 0.016667515f, 0.0572809875f,
+    -0.0543023199f, -0.0905594975f, -0.0773093924f, 0.0130263856f, 0.227847621f, 0.350887805f, 0.109588102f, -0.105333753f,
+    0.0823408291f, 0.317328066f, 0.0457497835f, -0.0483965836f, -0.0390644707f, -0.216960192f, 0.102236211f, 0.155796334f,
+    0.0595338158f, 0.0238182284f, -0.0316988565f, -0.0666348189f, -0.0285966787f, 0.310364276f, -0.155738696f, -0.107678019f,
+    0.106661759f, 0.25848043f, -0.15834789f, -0.243196458f, -0.154578552f, -0.064794749f, -0.135582417f, -0.0395671651f,
+    -0.0220568553f, 0.036602322f, -0.0616846122f, -0.0406776667f, -0.146528646f, -0.0589912198f, -0.158327475f, -0.221432269f,
+    -0.000359529338f, 0.0840812325f, 0.0230362639f, -0.160405308f, 0.0219129939f, -0.144875571f, 0.0747415274f, 0.0490452498f,
+    0.0132581154f, 0.0887368321f, 0.048708085f, 0.0264804102f, 0.17502822f, 0.252347857f, 0.0176553503f, -0.209271699f,
+    0.119878754f, 0.0359783024f, -0.115296111f, -0.0907914415f, -0.00504913274f, -0.0449096859f, -0.0712611526f, 0.00248779333f,
+    -0.0529078804f, -0.0291657969f, -0.0606086552f, 0.0370916054f, -0.043968223f, -0.280600995f, -0.267466158f, 0.067662105f,
+    0.0460435115f, 0.0108360471f, -0.1433433f, -0.024245752f, -0.0507787205f, -0.0832527354f, 0.0299761184f, -0.0300886966f,
+    0.0293531399f, 0.0583133623f, -0.00255131745f, -0.0442544632f, -0.00327540818f, -0.176648125f, -0.212503478f, 0.0992369056f,
+    0.0971037224f, 0.000831939571f, -0.0922246501f, -0.0663766563f, -0.00951190852f, -0.0506984591f, -0.000294526311f, 0.068136178f,
+    0.0496212877f, 0.0747698843f, 0.0192680303f, 0.0957659036f, 0.0441364124f, -0.0518193357f, -0.0991649628f, 0.0789374858f,
+    0.0990744457f, 0.122996919f, -0.171824843f, -0.130784422f, -0.00120923365f, -0.0585235953f, 0.0180192869f, 0.0140463831f,
+    -0.0286903251f, -0.0805201381f, 0.0689884722f, 0.0622118749f, -0.0627154559f, -0.227667421f, -0.243891865f, 0.0534311943f,
+    0.114838056f, 0.0744753331f, -0.174273223f, 0.034103591f, -0.138333768f, 0.0290927533f, -0.0785879791f, 0.103085473f,
+    0.0372332186f, -0.0188606381f, -0.0420375839f, -0.0431964584f, 0.0226884671f, -0.245522454f, -0.217685103f, 0.133163467f,
+    0.0302056726f, 0.108036809f, -0.0570731163f, 0.0323372632f, -0.0569474101f, 0.00526290573f, 0.0596371107f, 0.0936192647f,
+    -0.00669605564f, 0.0316923894f, 0.0218259953f, 0.00672128331f, 0.08101511f, -0.0212821644f, -0.0905468017f, 0.184664562f,
+    -0.0377098247f, 0.0551098101f, -0.0134817986f, -0.0662699491f, -0.0427512042f, 0.00659749843f, -0.0389131904f, 0.0102542089f,
+    0.0706875026f, -0.0304547455f, -0.0333784036f, -0.0113327606f, 0.0238258913f, -0.21006982f, -0.0626052395f, 0.0848611891f,
+    -0.0508501232f, 0.0920376033f, -0.201866046f, 0.0326829888f, -0.0305396859f, -0.0326128304f, 0.0416661277f, -0.0446689911f,
+    0.0286725052f, 0.0375905633f, 0.0417397693f, -0.0609056465f, -0.0646454319f, -0.103595711f, -0.0277217925f, 0.021516541f,
+    0.0294451416f, 0.016285643f, -0.114486575f, 0.0716676563f, -0.0362171084f, -0.00415559439f, -0.0678322464f, -0.0667819157f,
+    0.105305858f, -0.069889985f, -0.0657488182f, -0.0224338882f, 0.0929605886f, 0.0242165029f, -0.0589021705f, 0.176594287f,
+    -0.0146352369f, -0.417728126f, -0.126371101f, -0.000468217273f, 0.186081439f, -0.231941253f, -0.201661468f, -0.29206425f,
+    -0.0847772285f, 0.0503256954f, 0.0642496496f, 0.0288417507f, -0.194605306f, -0.366567552f, -0.233961701f, -0.149998069f,
+    0.00817959756f, -0.301588476f, -0.0903623998f, -0.0654696673f, 0.0824674889f, -0.201852247f, -0.173587322f, -0.175937057f,
+    0.0456120558f, 0.0846452713f, 0.167578205f, -0.0932431668f, -0.15786092f, -0.352154523f, -0.189253986f, -0.198303834f,
+    -0.0101773581f, -0.242815003f, -0.103262484f, -0.0775877014f, 0.169738278f, -0.207039326f, -0.264693409f, -0.281722516f,
+    -0.0878825113f, 0.206717923f, 0.117402814f, -0.020408636f, -0.393302113f, -0.319921225f, -0.351651073f, -0.0896825492f,
+    -0.000903596578f, -0.436336875f, -0.12597321f, -0.0712490007f, -0.0296152998f, -0.0424894206f, -0.403641492f, -0.22451818f,
+    0.0345501453f, 0.0406172872f, 0.15036507f, 0.0661922917f, -0.174932957f, -0.29958275f, -0.0594840944f, -0.118314266f,
+    0.0170119721f, -0.483871967f, -0.106088094f, -0.0204049051f, -0.0501757227f, -0.105852775f, -0.248521253f, -0.326087564f,
+    -0.00762223639f, 0.0521641821f, 0.13482058f, -0.0451395959f, -0.158028558f, -0.160186291f, -0.0184056237f, -0.0531265587f,
+    0.0250896439f, -0.423814237f, -0.0257264469f, -0.156774983f, 0.0441701077f, -0.115676984f, -0.332615018f, -0.335892618f,
+    -0.0252893791f, 0.0863836184f, 0.184976995f, -0.0821126848f, -0.314067155f, -0.402752817f, -0.120754078f, -0.0380557552f,
+    0.00106699043f, -0.531266153f, 0.112355754f, -0.210155159f, -0.0250369087f, 0.0866079852f, -0.348785073f, -0.334959924f,
+    0.0763756633f, 0.0636401549f, 0.0848090947f, -0.0242228415f, -0.127487704f, -0.0530255325f, 0.123135559f, -0.145989612f,
+    0.0410007387f, -0.630477548f, 0.134622708f, -0.135717019f, 0.0430309437f, 0.0880518407f, -0.210456774f, -0.316031933f,
+    0.0418162048f, 0.0287853815f, 0.119034834f, -0.0472031459f, -0.0897631273f, -0.145296901f, 0.180012524f, -0.192829102f,
+    0.0301884264f, -0.556610286f, 0.180893809f, -0.0635355189f, 0.0113093778f, 0.0944726244f, -0.278150707f, -0.305970311f,
+    -0.0787845775f, 0.102063268f, 0.0881497338f, 0.00217691786f, -0.0240892097f, -0.2494701f, 0.199278861f, -0.2315308f,
+    -0.107878134f, -0.0253085718f, 0.0352696367f, -0.111182213f, 0.00568240043f, -0.15781875f, 0.0762753263f, 0.111525983f,
+    -0.0301862359f, 0.128561169f, 0.109381936f, -0.0890291929f, -0.0305546988f, -0.0832822472f, -0.0307322349f, -0.165628389f,
+    0.0388055444f, 0.0883962363f, 0.0806974545f, -0.199111864f, 0.0848976076f, -0.173314497f, 0.19303f, 0.065727368f,
+    -0.0568651557f, 0.0694279522f, 0.0718361437f, -0.00500263739f, -0.0681447908f, -0.0136731723f, -0.221939608f, -0.0849043205f,
+    0.0698353052f, 0.0929075927f, 0.0856156275f, -0.0952563509f, 0.100226864f, -0.102017492f, 0.162231565f, 0.069498226f,
+    -0.111293562f, 0.104280874f, 0.0710258111f, -0.0469347276f, 0.00546517083f, -0.0276148822f, -0.211077347f, -0.142563581f,
+    -0.0769920647f, 0.160650432f, 0.0565915145f, -0.282065779f, 0.00559825357f, -0.0312761664f, 0.0315113999f, 0.0237367824f,
+    -0.0458670855f, 0.0917219818f, 0.0616603866f, -0.0831969455f, -0.0197183471f, -0.127024531f, -0.122814819f, -0.0760740191f,
+    -0.0266684331f, 0.0945556611f, -0.109203361f, -0.187766775f, -0.0385772139f, -0.101461887f, 0.0893153101f, -0.0195519198f,
+    -0.114128701f, 0.155034348f, 0.16966334f, -0.0084335478f, -0.141787767f, -0.108605333f, -0.169212073f, -0.198976651f,
+    0.0710538402f, -0.0187650602f, 0.00618951721f, -0.0635395944f, 0.0676941872f, -0.102715917f, -0.00128703646f, 0.111378059f,
+    -0.0752026811f, 0.159941316f, 0.177718386f, -0.0117341457f, -0.0370449908f, 0.000166496699f, -0.0186810847f, -0.159252122f,
+    -0.0590720326f, 0.231591508f, 0.0105651468f, -0.190197766f, 0.0278927032f, 0.0304521006f, 0.0838560089f, 0.0209471453f,
+    -0.0120963035f, 0.147619054f, 0.0424998179f, -0.105974741f, -0.0100343656f, -0.0488122851f, -0.197421432f, -0.0264261607f,
+    0.112572417f, 0.0965716541f, -0.157815427f, -0.25582251f, -0.199964136f, 0.0719004795f, 0.0256423037f, -0.0741335005f,
+    -0.0332292467f, 0.147667274f, 0.17705366f, 0.0993838087f, -0.0977671072f, -0.0862261951f, 0.000391556125f, -0.102105282f,
+    0.116389267f, -0.11405129f, -0.0915840343f, -0.236855894f, -0.109175004f, 0.0362133458f, -0.0979980826f, -0.0253048949f,
+    -0.11655198f, 0.118370928f, 0.0723919347f, 0.0595288165f, -0.0158029925f, -0.031293463f, 0.217635021f, -0.0889799669f,
+    0.150311977f, 0.124101281f, -0.126005515f, -0.162479773f, -0.0805594251f, -0.0544663854f, 0.0250940453f, 0.0550117977f,
+    -0.183776468f, 0.202260211f, 0.245995581f, 0.1661935f, 0.00129266805f, -0.040350005f, -0.0342011563f, -0.110546291f,
+    0.153217003f, -0.0660307556f, -0.0065352181f, -0.250706285f, -0.0752774104f, -0.136598453f, -0.0135562047f, 0.0379639156f,
+    -0.112872057f, 0.19054392f, 0.204106495f, 0.040611051f, -0.0369413793f, 0.150307223f, -0.00896326825f, -0.227767542f,
+    0.0183206256f, -0.113149472f, 0.0903171822f, -0.182002038f, -0.095721662f, -0.133486956f, 0.0524314865f, 0.0522497892f,
+    -0.0365662053f, 0.169558004f, 0.12570703f, -0.0202804748f, 0.020112386f, 0.101288624f, 0.104711428f, -0.112453371f,
+    0.167064235f, 0.12759234f, -0.0525159724f, -0.253027827f, -0.046542123f, -0.0409580357f, 0.0281641781f, 0.0286234822f,
+    -0.146854624f, 0.200227812f, 0.264318734f, 0.0721773282f, -0.0757555142f, -0.0242175031f, 0.0426527224f, -0.186931089f,
+    0.140425116f, 0.0722094253f, 0.0387398675f, -0.206038207f, -0.0745597854f, -0.0775286108f, -0.0115632173f, -0.00222430541f,
+    -0.125443339f, 0.113795973f, 0.255390912f, -0.0044036801f, 0.0141970804f, -0.0545828268f, -0.0347642936f, -0.206598014f,
+    0.0268635713f, 0.0511816926f, 0.0793192685f, -0.14149566f, 0.0504251234f, -0.15521884f, 0.0537034646f, 0.0096173007f,
+    -0.0122210933f, 0.170351341f, 0.150652513f, 0.0463422872f, 0.0129115488f, 0.018970836f, 0.0346610248f, -0.153105214f,
+    0.133431733f, 0.0715300888f, -0.0140793482f, -0.13785702f, 0.0384731218f, 0.0542851537f, 0.072995685f, -0.0557571873f,
+    -0.0386110134f, 0.0297919139f, 0.0723102689f, -0.018684959f, -0.0637118593f, -0.0345312767f, -0.0315740034f, -0.167572483f,
+    0.0248391088f, 0.157892153f, -0.0146029051f, -0.281440675f, -0.0764484331f, 0.0385910384f, 0.0650243238f, 0.0261965133f,
+    -0.0164501071f, 0.128467068f, 0.213638663f, -0.00418948755f, -0.0573267527f, -0.0496334471f, -0.0219567493f, -0.201271117f,
+    0.129414693f, 0.122373506f, -0.0279835239f, -0.220645458f, 0.0536234714f, -0.0571710393f, -0.0122852614f, 0.0336739123f,
+    -0.0401457101f, 0.1425028f, 0.186661214f, -0.0787563622f, 0.081461817f, -0.0293051191f, -0.0264835563f, -0.132443801f,
+    0.0343980081f, 0.0868038461f, 0.0530933551f, -0.0950454772f, 0.0956705883f, -0.112969548f, 0.0511880331f, 0.00346424105f,
+    -0.0603787825f, 0.193112791f, 0.130354777f, 0.0318820998f, -0.101368807f, -0.0643280745f, -0.0592924915f, -0.197532803f,
+    0.157630876f, -0.0181379486f, -0.109719999f, -0.0466348231f, -0.0569619164f, -0.0660682768f, 0.140647203f, -0.0265317336f,
+    -0.0207640938f, 0.0566343963f, 0.094910264f, 0.0633685589f, -0.0433616489f, 0.020125173f, 0.0659400821f, -0.0570942424f,
+    0.076806657f, -0.154628769f, 0.0588673279f, -0.0644267946f, 0.0251903143f, -0.0810459107f, 0.0895466059f, 0.0737264007f,
+    -0.0783712938f, 0.133718342f, 0.152527645f, 0.0483257771f, 0.0494357981f, 0.038947273f, 0.0858951062f, -0.170180663f,
+    0.133942738f, -0.0447471961f, -0.0132238269f, -0.215802521f, -0.0646869838f, 0.0884641558f, -0.0663186535f, -0.0605992749f,
+    -0.129143015f, 0.137560695f, 0.224463299f, 0.121038303f, -0.0476917215f, -0.100919373f, 0.0164563134f, -0.084647432f,
+    0.131577656f, -0.0214875471f, -0.131201655f, -0.152710736f, -0.00131367543f, 0.0362961404f, -0.0895610079f, -0.0594766438f,
+    -0.0759278163f, 0.0884049237f, 0.184302449f, 0.132324725f, -0.0679204613f, -0.0158342533f, 0.099383451f, -0.0986592397f,
+    0.076116927f, -0.0834864676f, 0.0253848378f, -0.0882742554f, -0.0350559056f, 0.0461660624f, 0.0667761415f, -0.0345761068f,
+    -0.0992879122f, 0.0894450024f, 0.161695525f, 0.00928056613f, -0.01910921f, -0.0245661531f, 0.0461178869f, -0.218009248f,
+    0.115080856f, -0.0429524481f, 0.115928046f, -0.163247183f, -0.0116283232f, 0.182557374f, -0.0151496092f, 0.0303056519f,
+    -0.053423509f, 0.0284841023f, 0.101865917f, 0.0676888451f, 0.0152316196f, -0.0128573775f, 0.216765732f, -0.177668661f,
+    0.129134551f, -0.0298955627f, 0.0313108489f, -0.240326405f, 0.0802649558f, 0.04634168f, 0.0666933656f, -0.0867052078f,
+    -0.0714541897f, 0.1142831f, 0.0580564775f, 0.0296055805f, -0.104612686f, -0.112442598f, 0.179047793f, -0.176586092f,
+    0.0689556599f, 0.11303737f, -0.0181291662f, -0.231299847f, -0.0752297342f, 0.0464430787f, 0.0139673203f, -0.0305966269f,
+    -0.0709260926f, 0.152891904f, 0.183988675f, 0.113254748f, -0.0892403796f, -0.107486516f, 0.00638403557f, -0.0892706066f,
+    -0.0130548542f, 0.372626871f, 0.126750886f, 0.0671555996f, 0.208463937f, -0.0617721267f, 0.116751678f, 0.214041457f,
+    -0.104593925f, -0.0402203351f, -0.0162870605f, 0.0079631675f, -0.132057071f, -0.0740387216f, 0.0602817237f, 0.0518006571f,
+    0.0572085604f, 0.313103706f, -0.0245603323f, 0.131949142f, 0.220532313f, 0.0840793401f, 0.107222423f, 0.0508088358f,
+    0.0976320058f, 0.0957226679f, -0.0262783971f, -0.0643675178f, 0.00814511441f, 0.0982186198f, 0.115876026f, 0.0584283285f,
+    -0.0570292138f, 0.0882861838f, -0.324723065f, 0.202645123f, -0.137291119f, -0.0307110939f, -0.178201467f, -0.0948319882f,
+    0.0648073703f, 0.0954213291f, -0.038834013f, -0.280938655f, -0.122692093f, -0.159384131f, -0.0468795784f, 0.184455842f,
+    0.00952040497f, 0.216467902f, 0.232986718f, -0.0133936359f, 0.162234917f, 0.18835929f, 0.053904064f, 0.0376611501f,
+    -0.127273321f, -0.01499754f, -0.0962666273f, 0.101299152f, -0.129411295f, 0.084046863f, 0.240828082f, 0.00537722185f,
+    0.0107465647f, 0.265948683f, 0.0476294383f, 0.13143678f, 0.102079123f, 0.0376610644f, -0.0919275284f, 0.0570319146f,
+    -0.0247645713f, -0.0129487449f, -0.0302272979f, 0.0332101174f, 0.116845064f, 0.186886728f, 0.135426551f, 0.125939235f,
+    -0.159991056f, -0.132879272f, -0.257192373f, 0.0354233123f, -0.215781152f, -0.0483802669f, -0.17117396f, -0.252384216f,
+    -0.0326657556f, -0.056478627f, 0.00502354978f, -0.224035501f, -0.119354025f, -0.164428383f, -0.147605658f, 0.131959528f,
+    0.021153897f, 0.251443535f, 0.224471152f, 0.0224062018f, 0.304497719f, 0.00307348277f, 0.0512944758f, 0.065503329f,
+    -0.149854332f, -0.0531157702f, -0.0566365905f, 0.0159657504f, -0.115525052f, 0.138248757f, 0.170228913f, -0.0635773987f,
+    -0.0587297492f, 0.32692188f, 0.0278726798f, 0.236081734f, 0.121371999f, 0.0880468115f, 0.0879380256f, 0.05732885f,
+    0.0484029949f, -0.00641386211f, -0.0504719466f, -0.0466296971f, -0.0584143735f, 0.119896859f, 0.0475125723f, 0.127249658f,
+    -0.140865594f, 0.00438425876f, -0.259937376f, 0.00794704352f, 0.0933155194f, -0.145418897f, -0.122128747f, -0.235279754f,
+    0.0927638486f, -0.0754354894f, -0.0264095012f, -0.190142378f, -0.126068249f, -0.113356836f, -0.320200026f, 0.0158177726f,
+    0.0742317215f, 0.0884617865f, 0.126167253f, 0.0417315699f, 0.118258461f, -0.0278630648f, 0.0329643264f, 0.0532334596f,
+    -0.040381413f, -0.0226321556f, 0.082222566f, -0.0469101071f, 0.0770879164f, -0.117897712f, -0.0199401341f, -0.0200568065f,
+    0.00117959245f, -0.0887666494f, 0.0559779294f, 0.0424359553f, 0.153824762f, -0.0026660664f, -0.0652255788f, -0.00223897677f,
+    0.0783347934f, -0.0664416254f, -0.0699975938f, -0.0314088725f, 0.00726129767f, -0.147620976f, -0.0071430048f, -0.0269004367f,
+    0.015855547f, -0.0381089188f, 0.106872819f, 0.101904318f, 0.114486866f, 0.0480936356f, 0.100557789f, 0.0113017298f,
+    0.108509295f, 0.0208560321f, -0.0121256737f, -0.113972634f, 0.0733029991f, -0.122813784f, -0.0975643173f, 0.0834771171f,
+    -0.0104344403f, -0.167485371f, -0.0331126377f, 0.0189426858f, 0.034091901f, -0.0369525664f, -0.117587946f, -0.0158807114f,
+    0.0218098164f, 0.0368096754f, 0.10912089f, -0.084203884f, 0.0570317172f, -0.0610800609f, -0.116079897f, 0.0114516765f,
+    0.0823340043f, -0.0463414192f, 0.0769893825f, 0.102377199f, 0.029898148f, 0.0129951397f, 0.00206650514f, 0.0582967661f,
+    -0.0354343802f, 0.0479540117f, -0.0486631244f, -0.0108148158f, 0.00405027019f, -0.132357582f, -0.0348746032f, 0.0287054721f,
+    0.0175621398f, -0.184144825f, -0.00211351248f, 0.173627943f, -0.0585624725f, -0.0874467716f, -0.00695754075f, -0.0529164113f,
+    -0.018124057f, -0.0200957842f, -0.0613350235f, -0.112171605f, -0.0765027702f, -0.21081765f, -0.133714959f, 0.00462523289f,
+    0.0378866196f, -0.221166894f, 0.0390990451f, 0.0695843771f, -0.0786366165f, -0.121938355f, -0.00558077777f, 0.0456528813f,
+    0.0761749744f, 0.0347600244f, 0.00830340199f, -0.0475797132f, -0.0499532707f, -0.0559800975f, -0.00801884755f, -0.0493559241f,
+    -0.0677751675f, -0.0768513456f, 0.104775563f, 0.0573959537f, -0.112488054f, -0.0386025049f, 0.0271520931f, -0.00267632748f,
+    0.0395503417f, -0.134231091f, -0.0878310651f, -0.0705917478f, 0.0261368193f, -0.180321008f, -0.0955286548f, 0.0392279029f,
+    0.0285407156f, -0.231394216f, 0.0853446946f, 0.124905251f, -0.149990126f, -0.0875998363f, -0.112293936f, -0.0194120184f,
+    0.110576376f, -0.0799328536f, -0.116269387f, -0.0521661341f, -0.010734207f, -0.169559747f, -0.22872664f, 0.0180159118f,
+    -0.0628564209f, -0.203736618f, -0.0256086569f, 0.00298487931f, -0.186202094f, 0.0207595546f, -0.0367877483f, 0.118642002f,
+    -0.0297981575f, -0.0105697168f, -0.142126873f, -0.10457249f, 0.00422769506f, -0.372827917f, -0.354011804f, 0.100905053f,
+    -0.0335136317f, -0.19938688f, -0.0450251475f, -0.00137376972f, -0.208147421f, -0.0318874903f, -0.0222202186f, -0.041536361f,
+    0.108480714f, -0.100717425f, -0.0450758412f, -0.0272856131f, -0.0344093479f, -0.206939444f, -0.270325154f, 0.0883162469f,
+    0.0524052233f, -0.0843550712f, -0.166068897f, 0.0152300047f, -0.236418307f, -0.0463546626f, 0.0772214085f, 0.00564667862f,
+    0.0181071367f, 0.0753631964f, -0.0907340646f, 0.0454828218f, 0.0551557243f, -0.124095768f, -0.180218279f, -0.00456562126f,
+    -0.0977525413f, -0.174553052f, -0.0999117643f, -0.0158119891f, -0.184196755f, 0.0225814804f, 0.0045637805f, 0.0197226834f,
+    0.0373424105f, -0.00907907169f, -0.0715826154f, -0.0318579748f, 0.014669871f, -0.272364885f, -0.28066799f, -0.0117092654f,
+    -0.00773823028f, -0.135280281f, -0.177002206f, 0.0526775457f, -0.23076281f, 0.0405053459f, 0.00494505046f, 0.0379531868f,
+    0.0122997342f, -0.0437153988f, -0.167450026f, -0.125875041f, 0.0597537123f, -0.211305037f, -0.27115649f, 0.00633503404f,
+    -0.0159689914f, -0.161005422f, -0.144875914f, 0.0758839697f, -0.245765731f, -0.0278433859f, 0.0423787758f, 0.0975656658f,
+    0.121241607f, 0.0390860289f, -0.064883925f, -0.0659962445f, 0.0215461571f, -0.119450785f, -0.270231992f, 0.121774405f,
+    -0.0910529047f, -0.223276764f, -0.0757760778f, 0.0326028876f, -0.111935414f, -0.0364405587f, 0.0877201185f, 0.0955921561f,
+    0.0849173293f, -0.0457044281f, -0.0909589007f, -0.0276703574f, 0.0326590016f, -0.0930101499f, -0.0365509093f, 0.000139449839f,
+    -0.0798050538f, -0.199119449f, -0.0697420463f, 0.066247344f, -0.254996985f, 0.111570619f, 0.0987873301f, 0.00102969259f,
+    0.0329926014f, -0.0266721062f, -0.0456151329f, 0.0592777915f, -0.0845750421f, -0.114922911f, -0.0309445504f, 0.00836509652f,
+    -0.072788246f, -0.059785895f, -0.169961706f, 0.0623401515f, -0.0938089043f, 0.0481653623f, 0.0504011475f, 0.0632459819f,
+    0.131370157f, -0.0354609378f, -0.0673458278f, -0.0130279185f, -0.0391768403f, -0.055021096f, -0.1196445f, 0.122129403f,
+    -0.0940835848f, 0.0326555111f, 0.027513383f, -0.0593581013f, 0.0193885863f, -0.15814735f, 0.00787310209f, 0.0591824986f,
+    0.0113932574f, -0.102758989f, -0.00703791063f, -0.0513606817f, -0.00699045975f, 0.0562834479f, 0.0722440034f, 0.0410079174f,
+    -0.101554476f, 0.0453643724f, 0.0883284733f, -0.0565912537f, 0.149916366f, -0.115488745f, 0.15094997f, -0.038364388f,
+    -0.0691447333f, -0.0461520255f, -0.0844853893f, -0.0808780119f, -0.00641459087f, -0.163440093f, -0.231039822f, -0.0879350305f,
+    0.0448791385f, 0.0803375468f, 0.14341341f, -0.0579942614f, 0.0330012888f, -0.150721133f, 0.0348398909f, 0.100831829f,
+    -0.0750624835f, -0.0261960551f, 0.036495395f, -0.08116097f, 0.030950686f, -0.0913017839f, -0.1267948f, -0.022498291f,
+    -0.0276242662f, 0.20825541f, 0.100279331f, -0.11604365f, 0.140853524f, -0.102053531f, -0.0109892348f, 0.0383685082f,
+    0.0445816144f, -0.0217319224f, -0.000206980068f, -0.0954220966f, -0.0373071358f, -0.0351572223f, -0.119562566f, 0.0192543305f,
+    -0.0582617819f, 0.255089402f, -0.0461570211f, 0.0554855913f, 0.136928812f, -0.293473989f, 0.139674172f, -0.00865068194f,
+    0.00670061633f, -0.0394541286f, 0.0856137052f, -0.186420321f, -0.112060137f, -0.170228496f, -0.346401721f, 0.0501669459f,
+    -0.0444503427f, 0.149437442f, -0.00890398305f, -0.0322945863f, 0.0370449014f, -0.153765216f, 0.112568796f, 0.0997096524f,
+    -0.0143369418f, 0.0865503475f, -0.0645612404f, -0.1013413f, 0.0762651637f, -0.0893945619f, -0.231454283f, 0.106107771f,
+    -0.0641727373f, 0.317837358f, -0.0244423449f, -0.00387753057f, -0.0107100662f, -0.125573561f, 0.0567012914f, -0.0279209428f,
+    0.0252067894f, 0.0425763316f, 0.054986354f, 0.0290233213f, -0.157544658f, -0.00327095948f, -0.0332183093f, -0.00810316764f,
+    -0.0373372212f, 0.145251885f, -0.151965782f, -0.0330528095f, -0.108235538f, 0.0552822948f, -0.0528063439f, -0.033684507f,
+    0.107080854f, 0.0759227872f, 0.0840233415f, 0.0147797503f, -0.0134174889f, -0.101844154f, 0.125610918f, 0.142367363f,
+    0.0576490127f, -0.0236850753f, -0.146321058f, 0.058443781f, -0.135535762f, -0.000215361913f, -0.0881982595f, -0.0240407512f,
+    0.123428747f, 0.0668104589f, 0.0617909767f, 0.0847521424f, 0.0493112542f, 0.0982652754f, 0.11421556f, 0.122888826f,
+    -0.218513086f, -0.0889972374f, -0.121473707f, 0.0959597751f, -0.150901973f, -0.173621148f, 0.0624131262f, -0.0324320607f,
+    0.0247058813f, -0.149585083f, -0.167425022f, -0.295263976f, 0.1096626f, -0.378843665f, -0.683778346f, 0.0811974779f,
+    0.0139405131f, 0.231307745f, -0.0199733488f, -0.0698262602f, -0.175049707f, -0.16997914f, 0.0668625012f, -0.0963976532f,
+    -0.0147056766f, 0.0404378325f, 0.18033424f, 0.043097876f, -0.114609919f, -0.158583909f, -0.259633452f, -0.105675891f,
+    0.227364272f, 0.334464103f, -0.113838658f, -0.293280542f, -0.241326645f, -0.23521328f, -0.0555770844f, -0.135788947f,
+    -0.00814696774f, 0.207987383f, 0.310835749f, 0.258265704f, -0.130027518f, -0.0728359893f, -0.276912421f, -0.240380526f,
+    -0.28853035f, 0.142730385f, -0.00409579137f, 0.06388136f, 0.000176316476f, -0.0358201005f, 0.00332634081f, 0.04465992f,
+    -0.00835928135f, -0.058493346f, -0.0717024654f, -0.39349702f, 0.136324495f, -0.338749439f, -0.611131251f, 0.0539976247f,
+    0.0922960714f, 0.195852548f, -0.067162849f, -0.146306977f, -0.0934973136f, -0.183347851f, 0.175154507f, -0.000420020078f,
+    -0.0183859915f, 0.0390474498f, -0.0157692749f, -0.118533075f, 0.000621531508f, 0.112307511f, -0.210996643f, -0.0874250531f,
+    0.159242526f, 0.382337719f, -0.0297305416f, -0.203450024f, -0.185113981f, -0.175872162f, -0.0572803989f, -0.167025149f,
+    -0.106146805f, 0.146346837f, 0.282618076f, 0.154212594f, -0.152661815f, -0.139264822f, -0.0454108901f, -0.197247788f,
+    -0.310540527f, 0.423922658f, 0.0110101616f, 0.118890829f, 0.0797909349f, -0.216953084f, 0.120898485f, -0.0723726749f,
+    0.0989999846f, -0.162577853f, -0.0654434487f, -0.338343054f, -0.0783648789f, -0.387194037f, -0.733947873f, 0.181662157f,
+    0.0556090511f, 0.239940777f, -0.175549701f, -0.0605532005f, -0.099073641f, -0.273435354f, 0.155608043f, -0.038417507f,
+    -0.0462562479f, 0.0774064511f, 0.0261852033f, -0.0250753947f, 0.0494942293f, 0.217202514f, -0.258282274f, 0.0603281409f,
+    0.231439024f, 0.192729905f, -0.0684745163f, -0.182650492f, -0.0907383636f, -0.0983391553f, 0.00686386786f, -0.0562005527f,
+    -0.0541284308f, 0.217245802f, 0.119297072f, 0.00563085312f, 0.0745100379f, 0.135450676f, 0.0110208411f, -0.212723538f,
+    0.113509476f, -0.364737779f, -0.0157988425f, -0.079945229f, -0.172277361f, 0.231257409f, 0.0269952212f, 0.0625134036f,
+    0.0646661669f, -0.0811205506f, -0.0517288037f, 0.210311189f, 0.0587586723f, -0.000149954954f, 0.100861467f, 0.0185313765f,
+    0.12628746f, -0.00980678853f, -0.0384591334f, 0.0454843603f, -0.15551509f, 0.186288267f, 0.0551045984f, 0.0708439425f,
+    -0.0111284293f, 0.00683393748f, 0.00961822737f, 0.174441963f, -0.00275049289f, -0.0337034762f, 0.0547299162f, 0.103580743f,
+    0.156166404f, 0.120969884f, -0.0613599531f, 0.164842248f, -0.110999726f, 0.25390017f, 0.104790002f, 0.0850249231f,
+    0.010649574f, -0.0241223238f, -0.0230805855f, 0.115962677f, 0.150502473f, 0.139418393f, 0.149513543f, 0.11208491f,
+    0.119125471f, -0.278042257f, -0.0876008198f, -0.0562525429f, -0.139906928f, 0.0788867176f, 0.0476459004f, 0.0434540212f,
+    -0.0685834214f, -0.173800975f, -0.0850660652f, 0.072067894f, -0.0667364299f, 0.0139610432f, -0.0097319521f, -0.04628741f,
+    0.079948321f, -0.00461535342f, -0.0236720536f, 0.14628014f, 0.0381237455f, 0.181065232f, 0.0406867154f, 0.0184434243f,
+    -0.057570871f, -0.052928105f, -0.190386027f, 0.217224449f, 0.0423331074f, -0.0116840163f, 0.0775980279f, 0.114950493f,
+    0.0461001396f, 0.126508951f, -0.07119295f, 0.0969624519f, 0.000190371153f, 0.139023066f, 0.0462558009f, 0.19544141f,
+    -0.0167183168f, -0.115807205f, -0.09163028f, 0.223668799f, 0.0230961833f, 0.112082578f, 0.16798158f, -0.0131906923f,
+    0.0772356689f, -0.188915312f, 0.0516439751f, -0.0723703727f, 0.0402693115f, 0.0564071797f, -0.00391009916f, 0.00108192209f,
+    -0.233871132f, -0.264108032f, -0.174037188f, 0.0391753726f, -0.036387708f, -0.188304245f, -0.0481566601f, -0.0102962488f,
+    -0.0272194892f, -0.128364801f, -0.0356990658f, 0.0544909015f, -0.0168365166f, 0.0941456929f, 0.010966463f, 0.0351119563f,
+    -0.0642588586f, -0.160507843f, -0.210664466f, 0.148203611f, -0.0402575731f, -0.0911984742f, 0.133032009f, -0.0813341364f,
+    -0.0450638384f, 0.0881369412f, 0.0382143632f, 0.0425025411f, 0.0094332248f, 0.137021631f, -0.00481279194f, 0.172320619f,
+    0.00698440615f, -0.115292586f, -0.249899015f, 0.111342609f, 0.000485869765f, 0.0524643138f, 0.141438067f, 0.0359289981f,
+    -0.0751014724f, -0.0616433583f, 0.104202658f, -0.114499055f, -0.0507982746f, -0.163098052f, 0.117808796f, 0.0246129893f,
+    -0.0495233461f, -0.101100549f, -0.076883018f, -0.124792039f, -0.0861504525f, -0.314599752f, -0.337185383f, 0.000112798865f,
+    0.0816689581f, -0.0372306481f, 0.0733183399f, -0.0308118816f, 0.0583955273f, -0.203947634f, 0.097384721f, 0.0816690102f,
+    -0.00135279645f, -0.0328835435f, -0.0554211326f, -0.023836853f, -0.0716391802f, -0.312097758f, -0.380538851f, 0.0577004552f,
+    0.0531277321f, 0.00139810052f, 0.202600464f, -0.0237001777f, 0.0136569543f, -0.16652295f, 0.0985649154f, 0.0349033326f,
+    -0.0329363979f, 0.0282124784f, 0.004915189f, 0.0329706594f, 0.056706503f, -0.130817071f, -0.251240313f, 0.0356056467f,
+    0.0778390989f, -0.0228072386f, -0.0028116731f, -0.0488757342f, 0.0708888248f, -0.15801309f, 0.0800531805f, 0.0644668341f,
+    -0.00470469287f, -0.0452963933f, 0.0492319874f, -0.089699842f, -0.14624393f, -0.198240623f, -0.228570893f, 0.0671691746f,
+    0.0282040499f, 0.111848488f, -0.0874557123f, 0.0420042872f, 0.0994596556f, -0.121361971f, 0.069020696f, 0.164129689f,
+    0.0262484085f, -0.0212138835f, -0.0276621785f, 0.00373497745f, -0.070257552f, -0.136591718f, -0.104196213f, 0.134924084f,
+    -0.0706248656f, 0.0746653005f, -0.110831015f, 0.0610959865f, 0.0875592753f, 0.00531545142f, 0.0751944706f, 0.163090318f,
+    0.0441957824f, 0.0702193603f, -0.0304443445f, -0.0760158226f, 0.0789828077f, -0.00652964227f, 0.00424608169f, 0.172562256f,
+    -0.070075281f, 0.086678125f, -0.267714858f, -0.0178094245f, -0.163644329f, 0.0138019565f, -0.0812083632f, -0.0513930246f,
+    0.0208428428f, -0.0566298291f, -0.0740062371f, 0.0310498197f, -0.0312716626f, -0.138185382f, 0.0424095988f, 0.0896595269f,
+    -0.0277492683f, 0.109991632f, -0.121284358f, -0.0104813278f, -0.208357334f, 0.131608561f, -0.0798145384f, 0.0169084761f,
+    0.113382652f, -0.0665722191f, 0.0475686304f, 0.0600245968f, -0.0572543032f, -0.0510172844f, 0.0721527115f, 0.0905522183f,
+    -0.00623523211f, -0.00663337624f, 0.00500861509f, 0.130304962f, -0.175301209f, 0.144936174f, -0.0791035369f, -0.00482703513f,
+    0.136952654f, -0.0136724766f, 0.0545921586f, -0.0297696795f, 0.066005148f, 0.0308819693f, 0.0680819601f, 0.0745668039f,
+    0.00113800855f, -0.27212742f, -0.0233796034f, 0.114255153f, -0.0830525681f, -0.0433472879f, -0.0488339588f, 0.0310625248f,
+    0.0276028533f, -0.0849791318f, -0.153105035f, -0.157248542f, 0.102444477f, -0.154599443f, -0.102068968f, 0.101100564f,
+    -0.0519262068f, -0.21188429f, -0.0189879257f, 0.00167795003f, -0.079355821f, 0.00861621462f, -0.00113251538f, 0.0603761114f,
+    0.0543388054f, 0.0257819407f, -0.108943261f, 0.000453704561f, 0.0458211601f, -0.131594196f, -0.169499636f, 0.139439136f,
+    -0.0845750719f, -0.317897052f, 0.00654441537f, 0.136359096f, 0.0631600544f, -0.0348428003f, -0.0592455864f, 0.0842995718f,
+    0.121982992f, -0.109861046f, -0.0762499943f, -0.108837664f, 0.00739746168f, -0.209010541f, -0.224963456f, 0.0360988341f,
+    -0.00740387104f, -0.198838562f, -0.00897993427f, 0.0640899166f, -0.189182654f, 0.0503704064f, 0.0551445447f, 0.126494199f,
+    0.00966082513f, -0.0946824551f, -0.166285872f, -0.0289948788f, 0.00562898023f, 0.0252290666f, -0.192492217f, 0.0944012702f,
+    0.0102808587f, -0.261916459f, -0.104590461f, 0.0100129759f, -0.128364056f, 0.0725834966f, 0.0696044266f, 0.120965488f,
+    0.0126818195f, -0.106768183f, -0.0870649442f, -0.00884447247f, -0.0218886174f, -0.0894367322f, -0.159831494f, 0.0319485851f,
+    -0.102248438f, -0.168694884f, -0.0216752402f, 0.11162784f, 0.0103281392f, -0.0632564053f, -0.0431927107f, 0.0111667989f,
+    -0.0112452004f, -0.0851533413f, -0.0689766333f, -0.0491024591f, 0.0822113082f, -0.141824096f, -0.173976377f, 0.126802117f,
+    -0.131549552f, -0.232838735f, -0.180937156f, 0.107778177f, -0.0374367014f, 0.0788795874f, 0.0430914797f, 0.0803553537f,
+    0.0269810874f, 0.023448525f, -0.0415975675f, -0.0531512611f, 0.148914784f, 0.0688240677f, -0.072991997f, 0.0617813431f,
+    -0.0360466205f, -0.27624476f, -0.125506312f, 0.0703848451f, -0.146376893f, -0.0602611303f, -0.0336397067f, 0.0324599743f,
+    0.107134633f, -0.0127418377f, -0.1507833f, -0.119180247f, 0.0640770867f, -0.193261489f, -0.101855963f, 0.000580426538f,
+    -0.0573379211f, -0.149064332f, -0.142892674f, 0.040352229f, -0.111124001f, 0.058977671f, 0.0387332663f, -0.0394726247f,
+    -0.021363683f, 0.0446738899f, -0.114281096f, -0.037654262f, 0.0501467623f, -0.239831299f, -0.209230542f, 0.161046997f,
+    -0.229200244f, 0.374902517f, 0.0786759779f, 0.0547928922f, 0.0375890397f, -0.383143634f, 0.119323134f, 0.0595887974f,
+    0.000678903831f, 0.0134237381f, -0.071605809f, -0.253450751f, -0.159359023f, -0.234404802f, -0.438166589f, 0.118466437f,
+    -0.232223198f, 0.351145566f, -0.0125062009f, 0.218296349f, 0.0596472472f, -0.10828466f, 0.0968142077f, 0.143265665f,
+    0.109530486f, 0.0743229464f, -0.149241015f, -0.243227616f, 0.0532368459f, -0.115927503f, -0.063756451f, 0.14455539f,
+    -0.180681586f, 0.0760783777f, 0.0238804501f, 0.297968775f, -0.0192882046f, -0.0774254203f, 0.0409684554f, -0.0457076877f,
+    0.0296090432f, 0.0346164219f, -0.0923799723f, -0.061784856f, 0.13180007f, -0.09664803f, 0.055395931f, 0.192137405f,
+    -0.0912000686f, 0.237747729f, -0.0772214457f, 0.230157778f, -0.0577812605f, 0.157695234f, -0.0569532178f, 0.0487386361f,
+    0.150018021f, -0.0345704481f, -0.132745028f, 0.0740177408f, -0.0808717459f, -0.0606768727f, 0.0767262205f, 0.105134159f,
+    0.0254812595f, 0.162529603f, -0.0486133099f, 0.212814957f, -0.0408685058f, 0.182263747f, -0.0717414245f, -0.0325350016f,
+    0.110692255f, -0.0558865331f, -0.186923534f, 0.0247821286f, 0.0196184628f, 0.0408577695f, 0.266576082f, 0.13670966f,
+    -0.0899972841f, -0.0972077176f, 0.050671123f, 0.102144837f, 0.00736314943f, 0.125518158f, -0.0249425136f, -0.109492414f,
+    0.049337469f, -0.0961726308f, -0.239368394f, 0.0726030916f, 0.0991382226f, 0.109648123f, 0.328922451f, 0.140929371f,
+    -0.0180194993f, 0.0180346984f, 0.00932672899f, -0.200925633f, -0.170066774f, 0.233796835f, -0.0817936659f, -0.147736534f,
+    -0.00165388384f, -0.252807289f, -0.224218085f, 0.0351564661f, 0.0412038006f, 0.0379210599f, 0.296652794f, -0.134685442f,
+    -0.0700777695f, 0.0570175797f, 0.0407853201f, -0.205520809f, 0.0277658291f, 0.268381238f, -0.0033996189f, -0.0501623116f,
+    0.0857177228f, -0.321516216f, -0.262843639f, 0.150073349f, -0.00685775746f, 0.106878541f, 0.190101013f, -0.103779487f,
+    -0.0433026254f, -0.0183313545f, 0.064430736f, -0.257711053f, -0.0110542392f, 0.13294673f, -0.0976031795f, -0.0495051481f,
+    0.0817748308f, -0.0789302513f, -0.0883199945f, 0.0769309923f, -0.113053486f, -0.0299471486f, 0.189631298f, -0.149032131f,
+    -0.0208333712f, 0.246190146f, 0.00985258445f, -0.168401986f, 0.0453987867f, -0.0452994034f, 0.130548447f, 0.141616151f,
+    -0.0450962707f, 0.110092282f, -0.0058620018f, -0.022869477f, 0.0663159043f, 0.0123538179f, -0.0263055544f, -0.11157348f,
+    0.0543195121f, -0.0148030557f, 0.00887880847f, -0.128790319f, -0.0642960221f, -0.0218944475f, -0.00823432673f, 0.0844395533f,
+    -0.0374344774f, 0.0915623084f, 0.0984023288f, 0.071312502f, -0.0312922411f, 0.0471031703f, -0.125998884f, -0.0107207214f,
+    -0.0241473932f, -0.0400610678f, -0.038956672f, -0.194795325f, 0.083395347f, -0.0535046756f, 0.080517225f, 0.0512477122f,
+    -0.0637371689f, 0.00342151104f, 0.0322531313f, -0.0904203281f, 0.075050801f, 0.18163532f, -0.0601586662f, -0.105419122f,
+    0.143406942f, 0.205447793f, -0.0616320781f, -0.122284174f, -0.0444991626f, 0.0496038571f, 0.0224850625f, 0.113302253f,
+    0.0115262307f, 0.0341591761f, -0.0120780198f, 0.0222873259f, -0.0312496461f, 0.0813236907f, 0.0195355974f, 0.0213924292f,
+    0.0701065436f, -0.00107200758f, -0.0158708617f, -0.0860462263f, -0.0605004691f, 0.0314405747f, 0.0295770448f, 0.00336273434f,
+    -0.0219457857f, -0.0683828667f, 0.0587394312f, 0.0558287203f, 0.0362432785f, 0.0180901773f, 0.0650264397f, -0.0965956673f,
+    -0.0626187548f, 0.121343508f, -0.0459856838f, -0.0654135644f, 0.0409251004f, 0.0102429399f, 0.105516128f, -0.0197400115f,
+    0.0600659847f, -0.034789104f, -0.0810909867f, -0.120990142f, 0.062716417f, 0.117404372f, 0.0276882537f, -0.0285576656f,
+    -0.00115803769f, 0.0013470999f, 0.00468187686f, -0.0524511673f, -0.0516160354f, -0.0648187697f, -0.0171993542f, 0.0691973642f,
+    -0.04857767f, 0.155739963f, 0.0482873507f, 0.0284023117f, 0.111569859f, 0.172681063f, 0.0451083817f, -0.134290308f,
+    -0.0251765326f, 0.144333392f, 0.017466424f, -0.175963208f, 0.00460142316f, 0.00546072703f, 0.104121447f, 0.151007369f,
+    0.0283897333f, -0.101637244f, 0.00220699864f, -0.0888072103f, 0.0085861655f, 0.0812756419f, -0.0598568544f, -0.0483460426f,
+    -0.0708802342f, 0.175315887f, -0.00517041376f, -0.0767013654f, 0.0256480388f, -0.0475306325f, 0.0716708079f, -0.00871784333f,
+    0.0992632732f, 0.0367969424f, 0.00578841334f, -0.130866915f, -0.050653886f, 0.0351019613f, -0.252452433f, -0.0529831387f
+};
+
+alignas(16) static const float tensor_2[32] = {
+    0.078637436f, 0.210196868f, -0.116686612f, 0.0375748202f, 0.0150290867f, 0.136445597f, -0.0262133647f, -0.0778965428f,
+    0.129901588f, 0.035650298f, -0.0128850052f, -0.0917850733f, -0.105701931f, -0.0461197644f, 0.0724093318f, 0.0612813011f,
+    -0.0394446068f, 0.0964864939f, -0.154792458f, 0.0655076727f, -0.00625931891f, -0.0274673291f, -0.123317823f, -0.0497316904f,
+    0.0350453407f, 0.00125212979f, 0.103622891f, 0.185893446f, 0.0426503196f, 0.0272093974f, -0.0592182167f, 0.135056019f
+};
+
+alignas(16) static const float tensor_6[18432] = {
+    -0.0123297442f, -0.510700345f, -0.00331776333f, 0.126203835f, 0.0792412758f, -0.148865193f, 0.181681573f, 0.0688209608f,
+    -0.117234185f, 0.0987566933f, -0.0203511324f, 0.164295018f, 0.192849666f, 0.188599348f, -0.266959667f, -0.105355844f,
+    0.229089409f, 0.0272298474f, 0.182327911f, 0.0831195638f, 0.0394685343f, 0.122707434f, -0.158013403f, -0.136691168f,
+    -0.100182787f, -0.0437120385f, -0.43360275f, -0.0981919318f, -0.0534570441f, -0.071190089f, 0.0987052321f, 0.107450821f,
+    0.0495614372f, -0.556075811f, 0.011146293f, 0.0902076885f, 0.0417094715f, -0.201126009f, 0.135957941f, 0.0236550961f,
+    -0.10010343f, 0.10853646f, -0.0631521419f, 0.0377205499f, 0.185104623f, 0.0435198285f, -0.306057453f, 0.0215417761f,
+    0.0898216367f, -0.025213046f, 0.159797326f, -0.0172394011f, 0.0751868784f, 0.0924375281f, -0.174762905f, -0.0966033787f,
+    -0.0791041479f, -0.046092242f, -0.33342427f, -0.153313741f, -0.101584934f, -0.00902333483f, -0.0648756623f, -0.0669957176f,
+    0.0719143003f, -0.567788363f, 0.0209742188f, 0.159444392f, 0.219278082f, -0.0207818411f, 0.187268808f, 0.0976987556f,
+    -0.0497933105f, 0.215817556f, 0.17082192f, 0.0369197354f, 0.150536343f, 0.10461808f, -0.3024593f, 0.0702552572f,
+    0.297571063f, 0.0726489872f, 0.161538228f, 0.135971501f, 0.16515623f, 0.108006112f, -0.324593931f, -0.097091876f,
+    -0.0542995483f, 0.0581908636f, -0.163180202f, -0.0823288262f, 0.00810483191f, -0.0848197937f, 0.10952042f, 0.0649406537f,
+    -0.0892038345f, -0.471649408f, 0.0440295637f, 0.00510775018f, 0.0506258309f, -0.20088923f, 0.18764089f, 0.0323856659f,
+    -0.19971998f, 0.112875029f, -0.0153651396f, 0.117793016f, 0.141558424f, 0.159812838f, -0.149643302f, -0.00969406497f,
+    0.175861448f, -0.0886663347f, 0.164106444f, 0.028259322f, 0.0182516165f, 0.133924559f, -0.245726719f, -0.0867222995f,
+    -0.0152645037f, 0.000881642161f, -0.393273264f, -0.200267538f, -0.0474600121f, -0.0662120804f, -0.0339486115f, -0.00409952924f,
+    -0.0971681401f, -0.369194895f, 0.0274331961f, 0.00449754996f, 0.0458410382f, -0.19588387f, 0.0767168254f, -0.0330575667f,
+    -0.131720737f, 0.0995147005f, -0.0663433447f, 0.0891878456f, 0.13118051f, -0.0042050248f, -0.180738419f, -0.0418416522f,
+    0.0651833788f, 0.0366567709f, 0.115403734f, -0.0334507562f, -0.00857110694f, 0.00100083172f, -0.190297574f, -0.0685272068f,
+    -0.0103345262f, -0.0787498131f, -0.354975551f, -0.220440462f, -0.022230491f, 0.0344810784f, -0.163836777f, -0.0370843299f,
+    -0.0510984436f, -0.490145385f, 0.0133347223f, -0.0511976592f, 0.108499087f, 0.0270272139f, 0.114901848f, 0.0753343925f,
+    -0.066222541f, 0.159446701f, 0.130053461f, 0.120175563f, 0.174326196f, 0.14570187f, -0.18328701f, -0.0126107261f,
+    0.213943437f, 0.0041993456f, 0.060734842f, 0.079900898f, 0.00149997277f, 0.0538487695f, -0.342199534f, -0.164666727f,
+    -0.0009489925f, 0.0166967493f, -0.15712145f, -0.163214594f, -0.000941268867f, 0.0238801334f, 0.0575518981f, 0.056443207f,
+    -0.0192166623f, -0.494947642f, 0.0567987971f, 0.00176798028f, 0.0219035987f, -0.185657725f, 0.144422621f, 0.185239062f,
+    -0.105728611f, 0.154235154f, -0.0187710784f, 0.208546609f, 0.242328584f, 0.196726397f, -0.277378052f, 0.0264123082f,
+    0.222287342f, 0.0175529476f, 0.193112463f, 0.203899086f, 0.0885143802f, 0.186042085f, -0.284133673f, -0.0776837766f,
+    -0.0750465095f, 0.0638443604f, -0.36852476f, -0.35785231f, -0.05702338f, -0.0855268165f, 0.0939944834f, 0.0692876652f,
+    -0.102895401f, -0.473529816f, 0.074450314f, 0.0123433657f, 0.025316786f, -0.101543278f, 0.0676028803f, 0.00934925396f,
+    -0.156121537f, 0.110608004f, 0.0396362655f, 0.133707732f, 0.175726563f, 0.0586737692f, -0.183049262f, 0.0212646592f,
+    0.12621367f, 0.0272887144f, 0.135280713f, 0.070540607f, 0.0929931179f, 0.0195423104f, -0.228872225f, -0.147465646f,
+    -0.0142414533f, 0.119591117f, -0.347062856f, -0.329635412f, 0.0375291109f, -0.0271072891f, 0.0182071831f, -0.0405252762f,
+    0.00131289545f, -0.496844172f, 0.0558799915f, 0.000901443302f, 0.168478355f, 0.0696582049f, 0.187830821f, 0.0738154873f,
+    -0.138121605f, 0.230707899f, 0.153144538f, 0.222345069f, 0.194381922f, 0.186006203f, -0.211138114f, 0.0619719326f,
+    0.254841685f, 0.0730065703f, 0.105084054f, 0.150637865f, 0.120643623f, 0.0974576399f, -0.344702929f, -0.0426621884f,
+    -0.0213553607f, 0.218872622f, -0.129727155f, -0.22063376f, 0.0939422399f, -0.0746750608f, 0.251258403f, 0.0830824375f,
+    -0.240681812f, 0.105964594f, -0.23939763f, -0.214373827f, -0.0907196775f, -0.0429060794f, -0.00766925327f, -0.0325241685f,
+    0.0057200389f, 0.0127487676f, -0.0081945369f, -0.0544957779f, -0.33841151f, -0.0445927344f, 0.0167528391f, -0.0804836005f,
+    -0.208354145f, 0.0118865231f, -0.306153417f, -0.158973098f, -0.246505916f, -0.289931417f, -0.0430745333f, 0.113135703f,
+    0.0368997343f, 0.0216490738f, 0.105176657f, -0.0630975887f, -0.0807836503f, 0.00959383417f, 0.01149882f, 0.0428424962f,
+    -0.18100892f, 0.0989904925f, -0.0867386982f, -0.0955765024f, 0.0983382091f, 0.0692859516f, 0.0362364836f, -0.313793391f,
+    0.0093686264f, 0.0938649923f, 0.225331768f, -0.0491574779f, -0.196372926f, 0.0607831031f, 0.0367696211f, 0.00748063298f,
+    0.160700604f, -0.0704773888f, -0.283383131f, -0.0351030603f, -0.163006455f, -0.146789148f, 0.0757883415f, 0.0506162234f,
+    0.00309456373f, -0.017305553f, 0.115418032f, 0.019217683f, -0.162264749f, 0.0605906583f, 0.0758273527f, 0.140179127f,
+    -0.192815244f, 0.0909057856f, -0.117316693f, -0.160687566f, -0.155649498f, -0.0723286495f, -0.0421996638f, -0.300380737f,
+    0.0302538294f, -0.00956289191f, -0.199840099f, -0.166911215f, -0.250075668f, 0.0878645852f, 0.000521561538f, -0.103213713f,
+    -0.154841274f, -0.0855110139f, -0.220463365f, -0.179988787f, -0.219661906f, -0.156628162f, -0.0748657361f, 0.0683465898f,
+    0.0102206459f, -0.114047334f, -0.289492279f, -0.0362032801f, -0.176680759f, 0.0223937836f, 0.00503938878f, 0.10747306f,
+    0.0513044111f, 0.126791045f, -0.132850826f, 0.106087781f, -0.11722976f, -0.0449163876f, -0.0586974546f, 0.452082187f,
+    0.0616381168f, -0.0216719098f, -0.102592051f, -0.101683311f, -0.039743185f, 0.0316273049f, 0.177806348f, 0.00995845627f,
+    -0.250974119f, -0.00500213308f, 0.0836113393f, 0.0932056978f, -0.136723012f, -0.00624840846f, -0.0938882455f, 0.124695517f,
+    0.0363684855f, 0.024524888f, 0.0631679818f, 0.152771771f, -0.0470258258f, 0.0282710772f, 0.0326838531f, 0.118194856f,
+    -0.0433275588f, 0.14732185f, -0.00290035899f, 0.0438517816f, 0.0451182686f, 0.064386636f, -0.0280385334f, 0.27098605f,
+    0.141280085f, 0.177402094f, 0.233805746f, -0.0768878311f, -0.00961945392f, -0.0172114391f, 0.134415805f, 0.0124998493f,
+    0.0502275117f, -0.0493847653f, 0.0228741542f, 0.159584984f, 0.0687655434f, -0.043600399f, 0.0351106301f, 0.0803645775f,
+    -0.0331379697f, -0.0247145947f, 0.204152048f, 0.0805905685f, -0.13406834f, 0.00951630995f, 0.0582474992f, 0.0769398138f,
+    -0.0162281413f, 0.0801279098f, -0.0724425763f, 0.109184965f, -0.0996176153f, -0.0208004788f, -0.0955410823f, 0.143412948f,
+    0.128793731f, 0.0163851753f, -0.12473318f, -0.143362045f, -0.0999789611f, -0.0131324017f, 0.136854708f, -0.0487524718f,
+    -0.0573542491f, -0.00370297534f, -0.0407709405f, -0.0339612216f, -0.0927873328f, -0.047036998f, -0.052792266f, 0.11486873f,
+    0.0361923501f, -0.0351060964f, -0.208242789f, 0.183462575f, -0.0687307045f, -0.0185229927f, -0.00692391861f, 0.0967026353f,
+    0.247416556f, 0.143223941f, 0.290549785f, -0.0568367541f, -0.265316218f, 0.0576276854f, -0.183899179f, 0.566251457f,
+    0.123451315f, -0.0792160109f, -0.0504871495f, -0.202229664f, 0.116812967f, -0.115379177f, 0.150185928f, 0.0320736058f,
+    -0.336927295f, 0.135853931f, 0.416673183f, 0.114549473f, 0.0747285187f, 0.0437619984f, -0.138597816f, 0.0821204484f,
+    -0.0109931594f, -0.0558430292f, 0.267933339f, 0.0791080147f, -0.0507145822f, 0.0301617961f, -0.252829731f, 0.107199997f,
+    0.102508701f, 0.161120132f, 0.155970395f, -0.0959424973f, -0.0394693352f, 0.0745558515f, -0.132784665f, 0.467477262f,
+    0.0916178897f, 0.0234770309f, 0.242829174f, -0.100054823f, 0.15678215f, -0.0557044484f, 0.165996209f, 0.0532098338f,
+    0.0113721043f, -0.0285840873f, 0.36511001f, 0.274929374f, 0.26993233f, 0.0496542901f, 0.00974684022f, 0.0804937258f,
+    -0.0601022728f, 0.00801139697f, 0.323008955f, 0.00411927374f, -0.0891495869f, 0.0176129732f, -0.186415359f, 0.125048488f,
+    0.0940005481f, 0.257351547f, 0.0606338829f, -0.0470147394f, -0.197728693f, 0.00685460586f, -0.326934725f, 0.366916537f,
+    0.00849691033f, -0.0385664217f, -0.205307573f, -0.16971387f, -0.0221127942f, -0.180579826f, 0.12857534f, -0.0228134617f,
+    -0.245455429f, 0.0197669901f, 0.0587080121f, 0.104051054f, 0.167154968f, 0.0349544212f, -0.0521662273f, 0.217232555f,
+    -0.00330879074f, -0.0286044627f, -0.234014958f, 0.0354787707f, -0.0722460374f, 0.0118814623f, -0.324310899f, 0.124714129f,
+    0.100109674f, -0.0769069195f, 0.158663705f, 0.0589538664f, -0.12907964f, 0.017713882f, -0.150403127f, 0.108275212f,
+    0.0957584679f, -0.220173955f, -0.182822198f, -0.129077971f, 0.0658267066f, -0.0246655829f, -0.0520375594f, 0.026197644f,
+    -0.29297027f, 0.00346009829f, 0.0568361059f, 0.0951450542f, 0.1100998f, 0.0737234727f, 0.00301694684f, 0.0197180659f,
+    0.018709071f, 0.00253422023f, 0.028632516f, 0.0110455751f, 0.090153493f, -0.00602903543f, 0.0509368666f, -0.0117057581f,
+    0.0214941222f, -0.110434435f, 0.097291328f, 0.153202623f, -0.232344419f, -0.00847551227f, -0.145699829f, 0.0959993228f,
+    0.00841448735f, -0.281112552f, -0.235333905f, -0.0778247491f, 0.0797674209f, -0.0352541991f, -0.070878841f, 0.0178457517f,
+    -0.21467641f, -0.0141780823f, 0.149933159f, 0.109471858f, 0.0786910802f, 0.0539975911f, -0.213381067f, -0.022545293f,
+    0.0573844202f, -0.0441137925f, -0.128556967f, 0.0387105979f, 0.0467083119f, 0.0198462196f, -0.0475108996f, -0.120753802f,
+    0.0555457883f, -0.118775152f, 0.144591689f, 0.148244619f, -0.185633704f, -0.0743951574f, -0.166928247f, 0.0494552106f,
+    0.0902220905f, -0.131422728f, -0.190686837f, -0.045194339f, 0.0507194996f, -0.123770654f, -0.149522811f, 0.0419687554f,
+    -0.277826697f, -0.00716545898f, 0.13902472f, 0.0786882117f, 0.127500489f, 0.0608503222f, -0.0768463016f, 0.0335411839f,
+    0.0261370633f, 0.0600363575f, -0.126450121f, -0.010906822f, 0.082751371f, -0.0368025973f, -0.0207713414f, -0.0182855539f,
+    0.0958686471f, -0.0181251727f, 0.143209293f, 0.109194994f, -0.20276016f, -0.0353318974f, -0.107492037f, 0.0839820355f,
+    0.00670948718f, -0.116742522f, -0.103794314f, -0.109167375f, 0.0365996696f, 0.00444905972f, -0.1174528f, -0.00916524325f,
+    -0.107566498f, -0.00654404843f, 0.120740809f, 0.0783766434f, 0.00102307147f, 0.0967276171f, -0.124760218f, -0.012011217f,
+    0.0222652052f, -0.0547057763f, -0.0395996384f, 0.0213863719f, 0.0533782989f, -0.015965946f, -0.0359584503f, 0.00762455538f,
+    0.0186729357f, -0.0900179073f, 0.082655333f, 0.100546874f, -0.209966615f, -0.0628530905f, -0.0631116703f, 0.0574970059f,
+    0.0581470393f, -0.17641224f, -0.173156545f, -0.0608691983f, 0.0411659181f, -0.111040577f, -0.0716184676f, -0.00342052337f,
+    -0.210588694f, -0.00168040115f, 0.116445661f, 0.0865589157f, 0.00407947367f, 0.0809220672f, -0.225708336f, 0.00692226505f,
+    0.0331690349f, -0.00535126356f, -0.0175283216f, 0.0107070999f, -0.0242317896f, -0.0306994468f, -0.0701946318f, -0.0662086233f,
+    0.0706468821f, -0.0160171241f, 0.154228643f, 0.100867011f, -0.187035307f, 0.0368826315f, -0.129219219f, 0.121869028f,
+    0.0877225772f, -0.142542034f, -0.0734407678f, -0.0786762908f, 0.00970893633f, -0.117950447f, -0.0639491156f, -0.0129087185f,
+    -0.137208924f, 0.0293825865f, 0.114059791f, 0.128750727f, 0.0596326441f, 0.0249245912f, -0.0815865472f, 0.00938002672f,
+    0.0936234817f, 0.0156103214f, 0.0980623066f, 0.0416910462f, -0.00114146178f, 0.0383861586f, -0.143536597f, -0.0724003538f,
+    0.0728018135f, 0.0625011772f, 0.106958881f, 0.125263393f, -0.14757219f, -0.0103543364f, -0.155586824f, 0.125778288f,
+    0.044857759f, -0.192059755f, -0.130459815f, -0.0105589926f, -0.00318279397f, 0.0193357188f, 0.0339318663f, 0.0857482255f,
+    -0.241901696f, 0.0805119127f, 0.0495084301f, 0.0323933251f, 0.0803938359f, 0.0505742729f, -0.0660326034f, 0.0641052797f,
+    0.0295459051f, -0.00551590929f, 0.116286725f, 0.0448789224f, 0.0293008238f, 0.0321190357f, 0.0682575926f, 0.0440293811f,
+    0.100625023f, 0.00610576943f, 0.171309963f, 0.1993016f, -0.155396596f, 0.0809279084f, -0.176787704f, 0.0726680756f,
+    0.00872082449f, -0.108519465f, -0.128998026f, 0.0511042625f, -0.0111431349f, -0.0651129186f, -0.00873406976f, -0.0090734344f,
+    -0.206903353f, 0.0446369573f, 0.102026172f, 0.0704582036f, 0.103165917f, 0.096965149f, -0.136328518f, -0.0311405957f,
+    0.0696469769f, 0.0763495415f, 0.0674290583f, -0.00131677475f, 0.0614633374f, -0.00446436414f, -0.0059818239f, 0.0378042981f,
+    0.0560753383f, 0.0410992391f, 0.182182714f, 0.106247246f, -0.147150069f, 0.0268576611f, -0.141753122f, 0.156359851f,
+    0.0468473323f, -0.113354072f, -0.112636738f, 0.0426365025f, 0.10577292f, -0.0640088543f, -0.072843127f, 0.00139248231f,
+    -0.0991237611f, 0.0340271778f, 0.136219487f, 0.155532464f, 0.105055965f, 0.129176944f, -0.0370596834f, -0.0159672908f,
+    0.112375326f, 0.108012117f, 0.21354118f, -0.00676842919f, 0.0153789464f, -0.0509910695f, 0.0703278854f, -0.0536597595f,
+    0.0426514819f, 0.0314527266f, -0.0115455138f, -0.0451852269f, -0.219532445f, -0.274280488f, 0.0482756905f, 0.408544928f,
+    -0.00557915168f, -0.118941069f, -0.233228713f, -0.342118293f, 0.102611929f, -0.0310096052f, -0.00913411099f, -0.0883979276f,
+    -0.125163525f, -0.0512337163f, 0.238533646f, -0.258841306f, 0.0903091878f, -0.0481352657f, -0.227203429f, -0.0375262462f,
+    -0.0714029744f, -0.168920353f, -0.415168732f, 0.0484768003f, -0.129687682f, 0.117733113f, -0.177472144f, 0.0411422774f,
+    -0.191114306f, 0.0398418494f, -0.143492118f, -0.0365001f, 0.0368389301f, 0.027201876f, 0.0600713715f, -0.0543712974f,
+    -0.030163629f, 0.0135941803f, 0.0776889175f, -0.133691967f, -0.0651754662f, 0.12608245f, 0.0689856634f, -0.0169515144f,
+    -0.0383138359f, -0.0402332395f, -0.0389835872f, -0.206267327f, -0.112067029f, -0.128603831f, 0.244512632f, -0.0404983908f,
+    -0.0840396658f, 0.0202708971f, -0.105195254f, 0.12902768f, -0.0284591615f, 0.0126384208f, 0.0501981564f, 0.0880646706f,
+    -0.14234443f, 0.0996059403f, -0.119100891f, -0.0445583537f, 0.0968027934f, -0.0990841016f, 0.00217528595f, -0.14064379f,
+    -0.0699659735f, 0.0268086232f, -0.0421803594f, -0.0945396945f, -0.00372353406f, 0.0791398883f, 0.145266652f, -0.0971709713f,
+    -0.0333100632f, -0.0260518547f, -0.0978890583f, -0.26403451f, -0.29057917f, -0.183634415f, 0.285865605f, 0.0169271026f,
+    -0.0888171643f, 0.00640684739f, -0.0961999223f, 0.110562459f, -0.0993951634f, 0.0923107117f, 0.0016922385f, 0.112708174f,
+    0.0895090476f, -0.0337647311f, -0.106015384f, 0.0905509517f, -0.0627686381f, -0.087890096f, 0.112318203f, 0.0871537477f,
+    0.0376409926f, 0.0139016397f, -0.133681551f, -0.175311387f, -0.0545965321f, 0.0436737239f, 0.0666812733f, 0.0750532076f,
+    -0.0821144655f, 0.0223722048f, -0.0734172761f, -0.147211343f, 0.00237016566f, 0.0415530987f, 0.00412469031f, 0.0120602418f,
+    0.0384976938f, 0.0545946173f, -0.201153859f, 0.126746073f, 0.0194318499f, 0.0869881585f, -0.109415099f, 0.112072237f,
+    -0.0395970941f, 0.0598119982f, -0.128519684f, 0.0139969848f, 0.136907279f, 0.0971426666f, 0.119597204f, -0.137604415f,
+    0.0726315901f, 0.117013998f, 0.0605437458f, -0.0436060838f, 0.00770270871f, -0.0289947614f, 0.0726664886f, 0.069618158f,
+    -0.0560197048f, 0.11326284f, -0.13675572f, -0.126262262f, -0.159772426f, -0.163448825f, 0.294885397f, -0.00842838082f,
+    0.0770710781f, 0.13096346f, -0.0099626584f, 0.134329811f, 0.118820399f, 0.0518459976f, -0.0321922489f, 0.0867889374f,
+    0.0211992394f, 0.115832679f, -0.0394203477f, 0.0012116204f, 0.0664698482f, -0.0490827523f, 0.0470040776f, -0.0525254048f,
+    0.0857347474f, -0.00914540142f, 0.023983933f, -0.0516543947f, 0.000676725351f, -0.0530843139f, 0.140416905f, 0.004626384f,
+    -0.176672444f, -0.00611085398f, -0.0684993416f, -0.0945768803f, -0.302412957f, -0.114487894f, 0.231093153f, 0.0318440832f,
+    0.0595897883f, 0.102442458f, -0.164657623f, 0.143159702f, -0.00384741882f, 0.118204989f, 0.00658222334f, 0.0992532223f,
+    0.0716092661f, 0.0458450355f, -0.166947126f, -0.0597278439f, -0.0227384679f, 0.00448175985f, 0.0730648264f, 0.16982007f,
+    -0.00582917687f, 0.00383361173f, -0.0930327103f, -0.17646195f, -0.0641454384f, 0.00612326199f, 0.07058011f, 0.0499313027f,
+    -0.0541608781f, 0.0746919811f, -0.0518568493f, -0.0870377347f, 0.0152991423f, -0.101248324f, -0.0242454931f, 0.0326959267f,
+    0.114910163f, 0.055547934f, -0.129043862f, 0.0933905542f, 0.033579655f, 0.171781346f, -0.0546709485f, 0.102346919f,
+    -0.121254049f, 0.0792736709f, -0.117590576f, 0.00571755273f, 0.0948843658f, 0.114959359f, 0.0402719341f, 0.0602014065f,
+    -0.0220194142f, 0.18173407f, 0.0861311927f, -0.0699018836f, -0.03059729f, 0.0168672968f, 0.158090249f, 0.0538533255f,
+    -0.000975410803f, 0.053492073f, -0.131926611f, -0.0787005126f, -0.140636653f, -0.170684755f, 0.31650281f, 0.118333749f,
+    0.0879412219f, 0.154455438f, 0.0219276939f, 0.127570376f, 0.108750649f, 0.111412257f, -0.0473329797f, 0.130819857f,
+    -0.0367956758f, 0.0379468165f, -0.0483666249f, 0.0202764869f, 0.0410396568f, 0.0267244112f, -0.0241391659f, -0.0212575197f,
+    0.071755819f, -0.00603254093f, -0.0161325857f, -0.0449522808f, 0.0187716689f, -0.0380665734f, 0.130948886f, 0.0368674323f,
+    -0.106580064f, 0.0710158274f, 0.0109681338f, -0.170368597f, -0.249589473f, -0.226420239f, 0.274822652f, 0.105845183f,
+    0.127630651f, 0.0671825558f, -0.0528807379f, 0.153346509f, -0.0095312167f, 0.229251727f, -0.0818722919f, 0.0659909695f,
+    -0.015140526f, 0.00979439262f, -0.0139845666f, -0.0513587818f, -0.059903983f, -0.00685354834f, 0.0428746901f, 0.0109359818f,
+    0.0321808122f, 0.0313315131f, -0.038288001f, 0.0175089221f, 0.0315705091f, -0.042104397f, 0.042982012f, -0.0522984751f,
+    -0.0221472438f, -0.00795226637f, -0.000270106684f, 0.0399478786f, -0.00689009903f, -0.0327164233f, -0.0592012294f, -0.0351103246f,
+    -0.0545864627f, -0.00872745179f, -0.0702535883f, 0.0460806191f, -0.00235198881f, 0.0253373515f, -0.0400287621f, -0.00721674878f,
+    -0.00685808202f, -0.0411065929f, -0.0465625264f, -0.0232972186f, -0.0109707424f, -0.063502945f, -0.0275126826f, -0.0319508389f,
+    -0.0640299767f, 0.0226173289f, 0.0222473089f, -0.0602447018f, -0.0308919456f, 0.00329447305f, 0.00641540997f, -0.029644832f,
+    -0.019063158f, 0.0380963534f, -0.0253898855f, -0.00876354147f, -0.0718706101f, 0.00361945946f, -0.00165958225f, -0.0421051048f,
+    0.0247491505f, 0.0106891198f, 0.0107343309f, 0.0101282755f, -0.01625246f, 0.0413403511f, -0.0133411437f, -0.0140600577f,
+    -0.0639110729f, -0.0368769392f, -0.0388021171f, 0.00798025448f, -0.0289091226f, -0.00708081201f, 0.0218106024f, 0.0402538218f,
+    -0.0176366922f, -0.0737425983f, -0.0563590601f, -0.00884329155f, -0.0594006479f, 0.0176383089f, -0.0675117075f, -0.0396959595f,
+    -0.0428289995f, 0.0155767631f, -0.0112055717f, -0.0148461731f, -0.0266064312f, -0.0276704822f, -0.00808900502f, -0.0043239356f,
+    0.00258442643f, -0.045741301f, -0.05996719f, -0.0772143081f, -0.0519590527f, 0.0260881167f, 0.028810408f, -0.0553354174f,
+    -0.00109031447f, 0.0102071948f, 0.0225950796f, 0.0456297435f, 0.0334869102f, 0.0143055059f, -0.00601409189f, -0.0452238433f,
+    0.00844559912f, 0.00676114671f, -0.0314882249f, -0.0272789747f, -0.00118623511f, 0.0249834433f, -0.071553126f, 0.0376430526f,
+    -0.0292127691f, -0.0164385978f, -0.025671564f, 0.0147933122f, -0.0409530848f, -0.0368587561f, 0.0400788598f, -0.0123240547f,
+    0.00757262623f, 0.0186594427f, -0.00622192398f, -0.0517705418f, -0.0347524658f, 0.0241913628f, -0.0550410524f, -0.041282203f,
+    0.0152141144f, -0.0762136057f, -0.060721714f, -0.0082572205f, -0.0329248272f, 0.01228878f, -0.0317798443f, 0.0151202325f,
+    0.036312528f, -0.033996027f, -0.0470342934f, 0.0347876251f, 0.0020951659f, -0.0288194437f, 0.0378113016f, 0.0254334304f,
+    -0.000700289675f, 0.0158322398f, 0.02936849f, 0.0202888381f, 0.0399529152f, -0.0080522839f, -0.0120004453f, -0.0375112183f,
+    0.0283549186f, 0.0194726568f, 0.015716739f, -0.00979479961f, 0.0275369175f, -0.0417344496f, -0.0634815246f, -0.0162195731f,
+    -0.0656459928f, 0.0134112965f, -0.0655747205f, -0.0100803496f, -0.0627551526f, -0.0499426052f, -0.012238387f, 0.00626919093f,
+    -0.0714570656f, -0.0538198873f, -0.0175395794f, 0.0107863517f, 0.0356076024f, -0.00254132901f, -0.0108431196f, -0.0596779659f,
+    -0.00954016671f, -0.0115669603f, 0.0333184116f, -0.0312691852f, -0.0146269482f, 0.00872283522f, -0.059022855f, -0.0584253855f,
+    -0.0304470081f, -0.0115100686f, -0.0120376162f, 0.00554132182f, -0.0626628101f, 0.0397342108f, -0.0450972393f, 0.00202200795f,
+    -0.0484913215f, -0.0625929907f, 0.0247814897f, -0.00915285759f, -0.0214602482f, 0.0420175716f, -0.00651836023f, -0.00343108783f,
+    -0.0340652503f, -0.0472800657f, -0.0690925643f, 0.0413792618f, -0.0508647338f, -0.0298402812f, 0.0012678653f, 0.0476257205f,
+    0.040914271f, -0.047276374f, -0.010642984f, -0.0481652431f, 0.0237645376f, -0.0224035531f, -0.0291637201f, -0.0398821682f,
+    -0.0195303224f, 0.0313984007f, -0.0587168671f, 0.00990263745f, 0.0146293696f, 0.0356745981f, 0.00508366339f, -0.0278264806f,
+    -0.0685757697f, 0.0059062927f, -0.00217910716f, -0.00225223904f, -0.0410944447f, 0.0174069796f, -0.0119611621f, 0.0436356999f,
+    -0.0306508839f, -0.00406743819f, -0.0691927373f, -0.0658634603f, -0.0525952913f, -0.0655419677f, -0.0552183874f, 0.019039508f,
+    0.0116352905f, 0.015457659f, -0.0512410216f, 0.0467321873f, 0.0404650308f, -0.0186790545f, 0.0209312849f, -0.0398578309f,
+    0.0139104044f, -0.0650300682f, -0.0570807643f, -0.0477193296f, -0.00627399702f, -0.00709686521f, -0.0330075063f, -0.0375388302f,
+    0.0182894021f, -0.0593794286f, 0.0100510772f, -0.0516644046f, -0.00951998215f, -0.0532470271f, 0.0542055033f, -0.0212103073f,
+    -0.00771074835f, -0.0367089398f, 0.020387087f, -0.0232952088f, -0.0602801293f, -0.0406870097f, -0.0441278629f, 0.017876301f,
+    0.00975435134f, 0.050264515f, -0.0127491178f, 0.0249130614f, -0.0545984097f, -0.0527319498f, 0.0285540447f, -0.0521993265f,
+    -0.0446738712f, -0.0220061913f, -0.0471484289f, -0.0381671488f, -0.0510773808f, 0.0369413458f, 0.00243321108f, 0.045999296f,
+    0.0815065429f, -0.30394572f, 0.100647748f, 0.0624820516f, 0.174578488f, -0.267010778f, 0.277418256f, -0.00288757193f,
+    -0.291037589f, 0.110699512f, 0.0908812433f, 0.310632527f, 0.136260122f, 0.0880279392f, -0.0989416167f, -0.187101886f,
+    0.339866906f, -0.182688221f, 0.108888142f, 0.122606017f, 0.135944054f, 0.107635558f, -0.299654275f, -0.0510152802f,
+    -0.218008101f, 0.0706031322f, -0.46982345f, 0.0258839205f, -0.184697673f, 0.0103972713f, -0.243345439f, 0.261575729f,
+    -0.0172031708f, -0.505359292f, 0.108745761f, -0.00180687068f, 0.0348949917f, -0.326911718f, 0.191762269f, 0.0361771509f,
+    -0.22947669f, 0.105142288f, 0.103846595f, 0.402759582f, 0.22955887f, -0.0876198187f, -0.187007248f, -0.0993301049f,
+    0.189808726f, -0.0474709906f, 0.090138942f, 0.113431506f, 0.058751978f, 0.0940075219f, -0.465181082f, -0.102301374f,
+    -0.137560397f, -0.0674291551f, -0.480463356f, -0.0540529042f, -0.168317005f, -0.0391954668f, -0.117910452f, 0.187758148f,
+    0.0735631809f, -0.422202677f, 0.0658649355f, -0.176505193f, 0.21137099f, -0.355672508f, 0.244279563f, 0.0843705982f,
+    -0.294240654f, 0.22391744f, 0.147870675f, 0.209808663f, 0.229088262f, 0.0111960741f, -0.2156647f, -0.0608236678f,
+    0.3808662f, 0.00849234406f, 0.118264496f, 0.0845648423f, 0.134019941f, 0.102476962f, -0.423882455f, -0.158286497f,
+    -0.182731345f, -0.0190938599f, -0.412885159f, -0.0586380698f, -0.232304737f, -0.131504104f, -0.259346217f, 0.258924007f,
+    0.0413470231f, -0.478114665f, 0.110824972f, -0.169052422f, 0.0981269926f, -0.3285878f, 0.312405348f, -0.0248168204f,
+    -0.302123606f, 0.0791222453f, 0.117062911f, 0.203328639f, 0.143977642f, 0.0694903657f, -0.178152874f, -0.184012145f,
+    0.376185685f, -0.157395348f, 0.101898663f, 0.109799027f, 0.0808107555f, 0.043739561f, -0.472347647f, -0.176286906f,
+    -0.21153377f, -0.116741218f, -0.49322179f, -0.113696843f, -0.338441163f, -0.0402488969f, -0.345555574f, 0.270841479f,
+    0.0430804752f, -0.575780451f, 0.0907053202f, -0.170407593f, 0.0364349373f, -0.420067668f, 0.173964545f, -0.021329252f,
+    -0.22608684f, 0.0885015056f, -0.000443470868f, 0.225394994f, 0.172175586f, -0.0371279269f, -0.286558628f, -0.163771018f,
+    0.215575263f, -0.179926425f, -0.0080435602f, 0.0291214045f, 0.00183683657f, 0.0148379663f, -0.625900269f, -0.137227193f,
+    -0.259180903f, -0.0607889481f, -0.551330507f, -0.0995694101f, -0.290616781f, -0.0713659599f, -0.190068245f, 0.0945993736f,
+    0.0666582212f, -0.537596583f, -0.00742884539f, -0.228010803f, 0.135061592f, -0.319462597f, 0.313346863f, -0.0887216404f,
+    -0.360279739f, 0.190938681f, 0.256336153f, 0.128653407f, 0.0750705749f, 0.0972682163f, -0.352283508f, -0.0574051477f,
+    0.345985919f, -0.0512031093f, -0.0151650133f, 0.0970698819f, 0.110349596f, 0.0297205895f, -0.470205188f, -0.152311429f,
+    -0.260624558f, -0.101932585f, -0.299565881f, -0.140614599f, -0.291007459f, -0.113822952f, -0.306802571f, 0.142622024f,
+    0.0434293039f, -0.677681506f, 0.0783942938f, -0.114483029f, 0.142640173f, -0.443750799f, 0.357666731f, -0.00345790712f,
+    -0.295260519f, 0.170782372f, 0.123094492f, 0.0221390389f, 0.119535752f, 0.0305107143f, -0.356372476f, -0.224135414f,
+    0.324522465f, -0.12748529f, 0.0542468578f, 0.113164283f, 0.0854406208f, 0.168687597f, -0.532253265f, -0.243235305f,
+    -0.278464854f, -0.053480342f, -0.538269579f, -0.0410939008f, -0.349942327f, -0.0580890179f, -0.227785975f, 0.213219285f,
+    0.036888022f, -0.816753447f, 0.0150455413f, -0.113742575f, 0.00483298767f, -0.397404969f, 0.241080627f, -0.0548723526f,
+    -0.262676775f, 0.141696364f, 0.0311277062f, 0.152524933f, 0.0461422987f, 0.0813579187f, -0.419641823f, -0.164491698f,
+    0.247845203f, -0.121611759f, -0.0558843948f, 0.108895741f, 0.0858000442f, 0.0218201671f, -0.600250363f, -0.323841304f,
+    -0.33470279f, -0.1321024f, -0.577869236f, -0.0624265634f, -0.235296279f, -0.0402386449f, -0.13135694f, 0.148226246f,
+    0.0637782589f, -0.648355246f, 0.000565761351f, -0.136016533f, 0.193935454f, -0.262382388f, 0.397022367f, -0.0645905659f,
+    -0.374299228f, 0.219772473f, 0.226386636f, 0.0757294819f, 0.107958883f, 0.254757673f, -0.345429093f, -0.142265677f,
+    0.409579903f, -0.0609186403f, -0.0852934569f, 0.128640309f, 0.0686954334f, 0.142980605f, -0.46583885f, -0.278616548f,
+    -0.297995389f, 0.023744924f, -0.397328049f, -0.0930100456f, -0.184019893f, -0.10026519f, -0.150631934f, 0.240691394f,
+    0.0323283337f, -0.21471253f, -0.171030685f, 0.0435324423f, 0.109880872f, -0.0486203134f, 0.214555427f, -0.270995796f,
+    -0.0431151316f, 0.122603968f, 0.070721209f, -0.0738473609f, -0.0732027814f, 0.0866294503f, -0.158483088f, 0.0695191249f,
+    0.0117655452f, -0.01595507f, 0.0628177822f, 0.0682404265f, 0.151459038f, 0.104834467f, 0.176005617f, -0.0819675624f,
+    0.000658143428f, -0.0171269495f, -0.295708656f, -0.0933589414f, 0.0590300076f, -0.0249611642f, -0.240877047f, 0.0930858999f,
+    -0.042095799f, -0.199064612f, -0.232220501f, 0.0797933191f, 0.0911388025f, -0.0464721099f, 0.097044237f, -0.408712506f,
+    -0.0333720408f, 0.126823932f, 0.0122630242f, -0.0470663905f, -0.234599888f, 0.0464399755f, -0.214458674f, 0.0256409701f,
+    0.0957857296f, 0.0369595028f, -0.120812915f, -0.033895839f, 0.00846269168f, -0.0356930867f, 0.0221564975f, -0.113315277f,
+    0.0175082274f, 0.0157107115f, -0.258608937f, -0.24102053f, 0.00971600041f, 0.00760305021f, -0.0711561441f, 0.0415145569f,
+    -0.0249588452f, -0.231870472f, -0.257050425f, 0.0398332439f, 0.09901651f, -0.019639777f, 0.0408502407f, -0.293968618f,
+    -0.00903057586f, 0.161915436f, 0.1183834f, -0.167219967f, -0.222227246f, 0.0508422628f, -0.223549142f, 0.0850412995f,
+    0.0519861057f, -0.0138184056f, -0.176707163f, 0.110126972f, 0.0465850495f, 0.0722118095f, -0.126881152f, -0.0857445821f,
+    0.0301882662f, 0.0369937606f, -0.231554568f, -0.221798792f, 0.0998619199f, 0.0198896583f, -0.167767167f, 0.0140478918f,
+    0.0400973558f, -0.139788285f, -0.165589392f, 0.0753927976f, 0.0246482547f, -0.0315543413f, 0.198048219f, -0.211598217f,
+    -0.140337721f, 0.115472361f, 0.0250176657f, 0.00630936306f, -0.146283448f, 0.140427873f, -0.198264286f, 0.0835995302f,
+    0.0590800419f, 0.0538008213f, 0.0207359921f, 0.0502930693f, 0.168270007f, 0.170866415f, 0.0979289412f, -0.0563316755f,
+    -0.0583099239f, 0.0155168977f, -0.229139343f, -0.0808672383f, 0.0118389148f, -0.039410606f, -0.0145835979f, 0.0656745583f,
+    -0.109861895f, -0.300349176f, -0.286734968f, 0.0252814367f, 0.0890041813f, -0.0524313487f, 0.0656773373f, -0.367980868f,
+    0.00813996047f, 0.105930991f, 0.0156168742f, -0.0425773375f, -0.213766649f, 0.0663187653f, -0.128875703f, 0.0447054394f,
+    0.094983913f, 0.055339843f, -0.106643945f, -0.00909264013f, -0.0204425361f, 0.0505596921f, 0.0778267011f, -0.091855146f,
+    0.00172736309f, 0.0144937746f, -0.149068043f, -0.14766109f, 0.0881993026f, 0.0300834998f, -0.0163011756f, 0.0330051072f,
+    -9.90601984e-06f, -0.272971749f, -0.226897955f, 0.0923112333f, 0.082118772f, -0.080030717f, 0.00470318319f, -0.179214016f,
+    -0.0336739384f, 0.14848581f, 0.0236912165f, -0.0772805065f, -0.141184151f, 0.0835216865f, -0.244396418f, 0.050865341f,
+    0.145366415f, 0.0784340724f, -0.162100554f, 0.0724744201f, 0.0518987738f, 0.141651064f, -0.155298084f, -0.132969782f,
+    -0.0290309396f, 0.0571889207f, -0.184893817f, -0.192812055f, -0.000654789619f, -0.0382930897f, -0.0830376223f, -0.0774727687f,
+    0.0211152192f, -0.224481449f, -0.256600112f, 0.140726089f, 0.0735101178f, -0.0528728329f, 0.112513065f, -0.209647775f,
+    -0.0628217757f, 0.166423321f, 0.0448720306f, -0.0292326398f, -0.179124191f, 0.061867673f, -0.174772426f, -0.0494133756f,
+    0.0983198583f, 0.00489415508f, -0.086696662f, 0.0418942347f, 0.126961395f, 0.134652197f, 0.0636279061f, -0.132397205f,
+    -0.11777015f, 0.07796029f, -0.32274729f, -0.0669239983f, -0.00470785378f, 0.0125549845f, -0.00400397647f, 0.118726686f,
+    -0.0487511456f, -0.290100515f, -0.197538555f, 0.150074184f, 0.0905858055f, -0.0814013258f, 0.0365536995f, -0.335904628f,
+    -0.0708056688f, 0.120732069f, 0.0585632622f, 0.00337733026f, -0.238249034f, 0.0339028724f, -0.172227994f, 0.0870737508f,
+    -0.016441403f, 0.0571989119f, -0.166521236f, 0.0354335159f, -0.0343447439f, -0.0239795446f, 0.101218626f, -0.119718902f,
+    -0.0237732474f, 0.0448169038f, -0.196496516f, -0.0439769477f, 0.0711625516f, -0.0611014739f, 0.0187779739f, 0.055389788f,
+    -0.0218298752f, -0.370463967f, -0.25444451f, 0.127710059f, 0.088357076f, -0.0367737785f, 0.0240055826f, -0.174136341f,
+    -0.048707433f, 0.0718851313f, 0.00627330597f, 0.0110015981f, -0.0737936273f, 0.0965932459f, -0.224154279f, -0.0328316204f,
+    0.0826389641f, 0.0180505961f, -0.0401787981f, 0.179681197f, 0.0842303857f, 0.181831181f, -0.0553794466f, -0.108717941f,
+    -0.064121902f, 0.101913862f, -0.204207271f, -0.0883601531f, -0.00877343211f, -0.0302499216f, -0.0196700133f, -0.0691679567f,
+    0.0472698249f, 0.00699351961f, 0.317129791f, 0.120485045f, 0.196758375f, 0.0355480015f, 0.126251429f, 0.0527217463f,
+    -0.0999824107f, 0.132849306f, 0.159957811f, 0.2227135f, 0.344695598f, 0.0847220942f, 0.0191796497f, -0.0533811301f,
+    0.26827988f, 0.036900375f, 0.356247216f, 0.153137371f, 0.0949505121f, 0.172887072f, 0.66868484f, -0.0724987984f,
+    -0.00582583435f, 0.157388777f, -0.226565406f, -0.0673845634f, -0.0717995465f, 0.0727011114f, 0.0037080911f, 0.161666006f,
+    0.1357117f, -0.137308374f, 0.280225575f, 0.166236728f, 0.0513008498f, -0.214145541f, 0.0661721677f, 0.142893806f,
+    -0.0554518513f, -0.0305287521f, -0.00487860711f, 0.202566698f, 0.419974357f, -0.109083876f, -0.0409840979f, -0.0184705649f,
+    0.187513709f, -0.0427800119f, 0.35425207f, 0.0916927382f, 0.0507464036f, 0.116066664f, 0.49558109f, -0.131035984f,
+    0.0415529571f, 0.0558878668f, -0.292912394f, -0.0462097973f, 0.0183675364f, 0.0898095667f, -0.183087081f, 0.163077056f,
+    0.169960558f, 0.0240500271f, 0.412493885f, 0.0523853824f, 0.0261735618f, -0.313999087f, 0.0670951977f, 0.206564918f,
+    -0.00588540826f, -0.0383691713f, 0.0473316386f, 0.00510134734f, 0.441812903f, -0.106097534f, -0.0414251499f, 0.047227256f,
+    0.267863452f, 0.0229634754f, 0.364270926f, 0.163252503f, 0.199692979f, 0.108200051f, 0.149498597f, 0.0487140566f,
+    0.0322587639f, -0.039083913f, -0.273436725f, -0.185222492f, -0.0147564793f, 0.189457953f, -0.435192645f, 0.072385706f,
+    0.00401531765f, 0.0318215266f, 0.28840071f, -0.02937188f, -0.068359144f, -0.26305747f, 0.0736626759f, 0.0158695411f,
+    -0.114140771f, -0.0601432063f, -0.0874120519f, 0.0871300027f, 0.382519424f, -0.0198031105f, -0.0226378217f, -0.0889294595f,
+    0.121771321f, -0.0872313604f, 0.258020014f, -0.0234714504f, -0.0225353427f, 0.0256322026f, 0.220913813f, -0.0718252808f,
+    -0.038567923f, -0.103706539f, -0.439087957f, -0.0449924953f, -0.122836024f, 0.0758117437f, 0.0585022084f, 0.111841053f,
+    0.0511272028f, -0.0643953905f, 0.283198714f, 0.0507928319f, -0.127702743f, -0.296572566f, 0.0467383005f, 0.0524237566f,
+    -0.0705321208f, -0.156240582f, -0.115483291f, 0.0554150827f, 0.369181663f, -0.0431175977f, 0.0238175411f, -0.0355737582f,
+    0.0880619213f, -0.030526232f, 0.212184384f, 0.0261818655f, -0.0351521596f, -0.0154782236f, 0.0333588161f, -0.0639926046f,
+    0.019825073f, -0.132429719f, -0.469259262f, -0.00622394169f, -0.0497969799f, 0.103345193f, 0.0884897858f, 0.072573334f,
+    0.0435445122f, -0.0221947916f, 0.258727789f, -0.0427837931f, -0.0608369f, -0.314227849f, 0.111824915f, 0.0967454389f,
+    -0.0721792802f, -0.0609403551f, -0.0435808487f, -0.060806565f, 0.328157097f, 0.0407772772f, -0.0526235774f, -0.0683684871f,
+    0.245789513f, -0.0269145463f, 0.35182026f, -0.00408157753f, 0.0788592398f, 0.0384620018f, 0.00832161587f, -0.0079864813f,
+    0.0133595103f, -0.126519635f, -0.332733899f, -0.172880217f, -0.182343975f, 0.0394961089f, -0.259091616f, 0.0712362677f,
+    0.025166491f, 0.0643874332f, 0.336657882f, -0.019001659f, -0.161345571f, -0.402481616f, -0.000528161414f, 0.166893125f,
+    -0.122867487f, -0.185202241f, -0.176013395f, -0.309930861f, 0.426773399f, -0.162260428f, 0.0167544559f, -0.177224457f,
+    0.116663091f, -0.109123796f, 0.304384649f, 0.0488336757f, 0.0428434238f, 0.131156415f, -0.298511118f, -0.0691422597f,
+    -0.12917541f, -0.287023246f, -0.5950858f, -0.00110868877f, -0.207879245f, 0.0465266295f, -0.37423256f, 0.068495065f,
+    0.0211933106f, 0.0509523042f, 0.288082838f, 0.0770120546f, -0.153214067f, -0.44223693f, 0.0547034107f, 0.100404195f,
+    -0.136392534f, -0.175934941f, -0.227071345f, -0.260843247f, 0.378416359f, -0.0592761226f, -0.0181037933f, -0.113091141f,
+    0.0950318947f, -0.104907878f, 0.332229137f, 0.00113852613f, 0.0966755077f, 0.118074805f, -0.346698225f, -0.0272201113f,
+    -0.0561568514f, -0.165514916f, -0.504568279f, -0.0375225097f, -0.286915749f, 0.0282133482f, -0.239078715f, 0.045308616f,
+    0.105375163f, 0.146147996f, 0.316451281f, 0.0303647965f, -0.120561838f, -0.235431999f, 0.120836914f, 0.0878403112f,
+    -0.0546606667f, -0.0293068849f, -0.0029382084f, -0.204448894f, 0.389794379f, 0.193336889f, 0.08089488f, -0.0900131315f,
+    0.180206522f, -0.0389055721f, 0.292120636f, 0.0302945152f, 0.0558037497f, 0.130808935f, 0.0453045368f, 0.0303606577f,
+    -0.0610369779f, -0.19706136f, -0.252961814f, 0.0613151789f, -0.233372346f, 0.0262906291f, -0.322367817f, 0.168499276f,
+    0.0124856578f, 0.0715074241f, -0.175544813f, 0.0564796627f, 0.051314123f, 0.127897352f, -0.174646094f, -0.0642805323f,
+    0.0374189131f, 0.0574631393f, 0.00850025099f, 0.031063769f, -0.435549021f, 0.00881495699f, -0.0225497223f, 0.0557924844f,
+    -0.191907987f, 0.0147642167f, -0.241871625f, 0.0577997454f, 0.044928968f, 0.027101865f, -0.0170546267f, 0.035958834f,
+    0.0140884183f, 0.0242838189f, 0.301816642f, -0.0105985012f, 0.0486672595f, -0.0639435798f, 0.0406676196f, -0.0585476384f,
+    0.0866089612f, 0.0391588397f, -0.139980584f, -0.0386937447f, 0.0354582183f, 0.154479831f, -0.183140337f, -0.0153229544f,
+    0.125999093f, -0.0125078019f, 0.000538149383f, 0.0347747989f, -0.30531171f, -0.0394127257f, -0.00898532011f, -0.029398175f,
+    -0.109610036f, 0.0714880526f, -0.101857632f, 0.146501526f, 0.0790734142f, 0.0643254891f, -0.211703628f, 0.0392108299f,
+    0.0689775795f, 0.0646953285f, 0.265275061f, -0.0156976581f, 0.0720817074f, -0.0392875671f, 0.0572890826f, -0.0635210797f,
+    0.0625078455f, -0.0171360858f, -0.0585997291f, 0.0772596821f, -0.0704061836f, 0.127031475f, -0.104362734f, -0.0329445526f,
+    0.118610077f, 0.00641422765f, -0.00931426696f, 0.0302003622f, -0.270506501f, -0.0111156963f, 0.0234056562f, 0.0474168845f,
+    -0.128967538f, 0.0855613053f, -0.107891828f, 0.10896387f, 0.0247586388f, 0.00339188054f, -0.161546975f, 0.0790923759f,
+    0.0441428609f, -0.0170206632f, 0.268183887f, -0.029522676f, 0.0919663832f, 0.00590395182f, 0.0547535494f, -0.0837761462f,
+    0.0271438509f, 0.0173750669f, -0.169345379f, 0.00193143217f, -0.0172392074f, 0.165752485f, -0.0720781162f, -0.0609819442f,
+    0.110872842f, 0.0436620004f, 0.072769329f, 0.0537776314f, -0.336077005f, -0.0649918616f, -0.0559747294f, -0.0167125575f,
+    -0.114241213f, 0.00329649099f, -0.23884888f, 0.148256913f, 0.0967681482f, 0.131131798f, 0.00657701166f, 0.0352617912f,
+    0.0356686488f, 0.0218141526f, 0.331641197f, 0.0190800261f, 0.0777556971f, -0.0279720761f, 0.0131096849f, 0.0014007471f,
+    0.0520513728f, -0.0798393339f, -0.0720380992f, -0.0201245081f, 0.031269975f, 0.129468158f, -0.172731012f, -0.0188017841f,
+    0.0378510058f, -0.0150271738f, 0.0399924591f, 0.00272551598f, -0.226661116f, 0.00956814736f, -0.0837096348f, 0.0715788454f,
+    -0.0820446834f, 0.0486137494f, -0.109997749f, 0.123201832f, 0.120021395f, 0.149708405f, -0.198730558f, 0.0211776868f,
+    0.0594904572f, -0.00457979832f, 0.249439657f, -0.115572289f, 0.0129514737f, -0.021452507f, 0.0302348491f, -0.0490462892f,
+    -0.00127435033f, 0.0151733132f, -0.101096578f, 0.0642755106f, -0.0564987473f, 0.125009626f, -0.111973688f, -0.000737546594f,
+    0.071710363f, 0.0275840908f, -0.0227025654f, 0.0068397685f, -0.268691421f, -0.0610527918f, -0.0742587224f, 0.0697388947f,
+    -0.168138027f, -0.00866637845f, -0.0552450307f, 0.090953812f, 0.0669059902f, 0.100281306f, -0.176124156f, -0.0140803698f,
+    -0.00578793744f, 0.066357255f, 0.222626373f, -0.0528621674f, 0.0709448159f, -0.0410074182f, 0.0127914613f, -0.0543905012f,
+    0.0254025143f, 0.0401815027f, -0.194526553f, 0.0962428227f, 0.0913726464f, 0.173355833f, -0.186132833f, -0.0916675031f,
+    0.125254661f, 0.0576512069f, -0.030283941f, 0.0928177238f, -0.39560926f, -0.0519421324f, -0.0476349406f, 0.0350069366f,
+    -0.185845301f, 0.0786768571f, -0.267075598f, -0.00778080476f, 0.0579854585f, 0.0505447313f, -0.0245343149f, 0.0226934608f,
+    -0.0240765028f, 0.0347224213f, 0.347931981f, -0.00045448009f, 0.107186966f, -0.0638530925f, 0.124463305f, -0.0103356829f,
+    0.013533704f, -0.0245973859f, -0.0501624756f, 0.0428539626f, -0.0077661965f, 0.182822809f, -0.0964005068f, -0.0696741417f,
+    0.146422774f, -0.0166255962f, -0.0149286529f, 0.0364959575f, -0.29068777f, -0.0341649316f, -0.0345079899f, 0.0233249497f,
+    -0.147223726f, 0.063052237f, -0.243595421f, 0.0612900183f, 0.00944278669f, 0.0757260621f, -0.0661530644f, 0.0704996288f,
+    -0.0149677387f, 0.0674796626f, 0.245032355f, -0.0803685561f, 0.0915110931f, -0.049418699f, 0.0511391237f, 0.0217466298f,
+    0.061941877f, -0.0225319453f, -0.0645204708f, 0.115398832f, 0.0515375547f, 0.158933878f, -0.192149237f, -0.0904144421f,
+    0.133769035f, -0.00451354962f, -0.0450738184f, 0.100631587f, -0.277687788f, -0.00684153521f, -0.0407179259f, 0.0460608974f,
+    -0.193304136f, 0.083124809f, -0.193041876f, 0.0656733066f, 0.0429685079f, 0.0366867445f, -0.0691875294f, 0.0318238176f,
+    0.0973217785f, -0.00756412046f, 0.225283876f, 0.0217870548f, 0.0915398449f, -0.0270579029f, 0.193500206f, -0.0115174148f,
+    0.0355448574f, -0.0628262907f, -0.0189288706f, 0.0229372755f, 0.0194438975f, 0.045745004f, -0.0724796057f, 0.0151923848f,
+    0.0290278737f, 0.0130063267f, -0.0199537612f, -0.0349932462f, -0.00869548786f, 0.025381051f, 0.0211393349f, -0.013969996f,
+    -0.0181296021f, 0.0279887281f, 0.00838242471f, 0.0312958285f, -0.0369052663f, -0.0294547807f, -0.0626715794f, 0.027090976f,
+    0.0211650692f, -0.0499731489f, -0.0384662375f, -0.0177646484f, -0.0709145144f, 0.0197764374f, 0.00834352989f, 0.0253085718f,
+    -0.0414704755f, 0.00871496648f, -0.0115879746f, -0.0388905816f, 0.0210887268f, 0.00389297446f, -0.0573078953f, -0.0156148467f,
+    -0.0672537759f, -0.0330516882f, -0.0137385596f, -0.0128756389f, 0.029575875f, -0.00913786516f, -0.0362579189f, -0.0496337786f,
+    0.0346218199f, -0.0583000667f, -0.0284974687f, -0.0351358913f, 0.0226177331f, -0.0225614049f, -0.0906592011f, -0.0444956683f,
+    -0.0289468635f, 0.0121892747f, 0.0180543009f, -0.0539146699f, 0.0191154759f, -0.0506017096f, -0.00871884264f, 0.0242336988f,
+    -0.0554966368f, 0.0281976014f, -0.015390751f, -0.0389401242f, -0.0326163135f, -0.00424353871f, -0.0412296318f, -0.0317668952f,
+    0.0426541381f, -0.0190876033f, -0.069048427f, 0.00387592358f, 0.0202978607f, 0.0204616599f, 0.018353058f, 0.00518397568f,
+    0.0217391588f, 0.00178304594f, -0.0228713732f, -0.0439479165f, -0.0291621462f, -0.101481751f, -0.0274122171f, 0.0428257808f,
+    -0.0549218021f, 0.00582802854f, -0.0121205151f, -0.0662283078f, -0.0561585426f, -0.0300046951f, -0.0475502498f, -0.0386388935f,
+    -0.069317095f, -0.0087014623f, 0.0288254134f, -0.0133707104f, -0.0346411057f, 0.0178369731f, -0.00968956668f, 0.0292551275f,
+    -0.0425178073f, -0.0255898368f, 0.0292646717f, 0.0276058111f, -0.0544142611f, -0.0252409521f, -0.0727955401f, 0.0228272136f,
+    -0.00984980352f, 0.0364846848f, -0.0694911703f, -0.0690850019f, -0.0389158465f, 0.0374078378f, -0.0263181739f, 0.0379555076f,
+    -0.0602921434f, -0.041764129f, -0.0722876191f, -0.104605213f, -0.00938412547f, -0.0498329997f, 0.046515014f, -0.0357599221f,
+    0.0438466109f, -0.0817164332f, 0.0236925483f, -0.0338987075f, 0.00341388211f, 0.0365690999f, -0.0211054832f, 0.0013984032f,
+    0.0279018059f, -0.0231876075f, 0.0225215908f, -0.0454079211f, -0.0278277081f, -0.0652308017f, 0.018594157f, -0.00793892145f,
+    0.00654294016f, 0.0161597915f, -0.0474323481f, 0.0406594612f, 0.0433801897f, -0.0649574026f, -0.0259077251f, -0.0221894849f,
+    0.00790050998f, 0.0233975854f, -0.0692994148f, -0.0472158566f, -0.0496198423f, 0.0166291092f, 0.0349827372f, -0.0659601763f,
+    0.00117155933f, 0.00341358455f, -0.0240046643f, -0.0216674544f, -0.0556951277f, -0.0436242148f, -0.0573135205f, 0.0185256246f,
+    -0.0276801959f, -0.00756416097f, 0.00123222615f, -0.00764706964f, -0.0112075042f, -0.025721658f, 0.0185484588f, -0.0566081405f,
+    0.04595799f, 0.0478030294f, -0.0511334091f, -0.0289041456f, -0.0241674446f, 0.0442673154f, -0.0635845885f, -0.0344900452f,
+    -0.0339308716f, -0.065329425f, -0.00965737551f, -0.0948724151f, 0.0408799723f, -0.0113032088f, -0.0229742806f, -0.0424050391f,
+    0.0324479379f, 0.0182797499f, -0.0352509581f, 0.0203043465f, -0.011918392f, -0.056978751f, -0.0115738278f, 0.0171529725f,
+    0.0255211052f, 0.031382557f, -0.0409276001f, 0.0155720813f, 0.0130807795f, 0.0192386732f, 0.00901130121f, -0.046133697f,
+    -0.0605506152f, 0.0431904346f, -0.000130739281f, -0.0275103953f, -0.0636418983f, -0.00526726898f, -0.025463447f, -0.0335301496f,
+    -0.06530568f, -0.0350738689f, -0.0377799608f, 0.0129779521f, 0.0210016798f, -0.0350276679f, 0.00940627512f, -0.0184678063f,
+    -0.0212221164f, -0.0402874202f, -0.017444456f, -0.0415210687f, 0.00318310689f, -0.0627903789f, 0.0120087452f, 0.0350492969f,
+    -0.0090546282f, -0.0218497626f, 0.00263622217f, -0.0657154694f, -0.0153948227f, -0.0572488941f, -0.107874781f, -0.0548151508f,
+    0.0399897769f, -0.00840271357f, 0.0350935385f, 0.0220662002f, 0.0171205327f, -0.0849063098f, -0.00848199334f, 0.000403612095f,
+    -0.0454974286f, -0.0468920767f, -0.0364479236f, -0.0424232893f, -0.0127744414f, -0.0256087463f, -0.018540144f, 0.0289859436f,
+    0.0434522592f, -0.0803652406f, -0.0604585633f, 0.0178287197f, -0.0642541051f, -0.0571289137f, -0.0159394853f, -0.0150312465f,
+    -0.0239981115f, -0.0568556301f, 0.041905988f, -0.0530421175f, 0.0289051756f, -0.00294394838f, -0.00430590054f, -0.00191438489f,
+    -0.00305569894f, 0.0053809844f, -0.024639532f, -0.00974554941f, 0.0165695511f, -0.0312378369f, -0.0115307067f, 0.008139343f,
+    -0.0325348005f, -0.00620260555f, 0.012510472f, -0.0780606195f, 0.0413342267f, -0.0181485638f, -0.0255241711f, -0.0278465115f,
+    0.0134063773f, -0.176931441f, 0.190407604f, 0.0139609929f, -0.0486320741f, -0.0989603698f, 0.0299078058f, 0.00309707341f,
+    -0.0228034239f, -0.0414824896f, -0.0196095109f, 0.0663510188f, 0.43049559f, -0.089079462f, -0.0946181715f, 0.0123309204f,
+    0.0321893692f, 0.102965713f, 0.336595714f, -0.0330086239f, -0.0400131233f, 0.0244282205f, 0.0497174412f, 0.0481804237f,
+    0.0109992595f, -0.0279067121f, -0.190440744f, -0.161688462f, 0.0161801092f, 0.0104417196f, 0.0778589249f, 0.000569031108f,
+    0.0671462268f, -0.222564399f, 0.287152201f, 0.0219072979f, -0.0942989811f, -0.172103345f, 0.0308263358f, 0.0552630089f,
+    0.0556918941f, -0.0917929336f, -0.136168286f, 0.0651795939f, 0.385676444f, -0.12013524f, -0.240693197f, 0.10719198f,
+    0.0414857268f, 0.0690839514f, 0.253158987f, -0.0265991893f, 0.048634056f, 7.12046167e-05f, 0.105610222f, -0.0221321974f,
+    0.0665407628f, -0.12353348f, -0.240699098f, -0.209747598f, 0.0638913587f, 0.0421039574f, 0.0363982245f, 0.000393082941f,
+    0.0444081202f, -0.266019911f, 0.290919363f, -0.0512608737f, -0.0936267674f, -0.184567913f, 0.00170255266f, 0.08194305f,
+    -0.0319636017f, -0.123267017f, -0.1187433f, 0.103021033f, 0.497222185f, -0.0638928711f, -0.161071241f, 0.021925576f,
+    0.160523385f, 0.0637529865f, 0.38687104f, 0.0430594012f, -0.0249895472f, 0.0559156723f, 0.303307176f, -0.00587623473f,
+    0.0471241511f, -0.133374155f, -0.361981422f, -0.239066333f, 0.0858756155f, 0.00257352972f, 0.0792770535f, 0.000535663567f,
+    0.0316136628f, -0.0341581106f, 0.288564056f, -0.00735385064f, -0.13041307f, -0.0769893825f, -0.0323747173f, 0.104984075f,
+    0.00635470776f, -0.126460835f, -0.0643119887f, -0.0012044576f, 0.393248886f, -0.0422563255f, -0.0881828591f, 0.0439081565f,
+    -0.0118992105f, 0.0769991577f, 0.341531426f, -0.00498515926f, -0.0598556921f, 0.0396691002f, -0.0714529157f, 0.0389968194f,
+    0.039215818f, -0.133343071f, -0.0753694475f, -0.177863181f, 0.0115512758f, 0.0327434056f, 0.0198148917f, 0.018261509f,
+    0.0884857476f, -0.147382915f, 0.256450653f, 0.10286729f, -0.221955657f, -0.183531523f, -0.0367701799f, 0.0627031177f,
+    -0.0202305671f, -0.172974586f, -0.0855825022f, 0.0746375471f, 0.411990523f, -0.127875939f, -0.167935669f, 0.0791899711f,
+    0.0722955987f, 0.0163981058f, 0.339286923f, -0.0421289727f, -0.0329409204f, 0.0060170074f, -0.114242092f, 0.0179536324f,
+    0.00193695724f, -0.140692815f, -0.191528335f, -0.109335758f, 0.036268685f, 0.0936189666f, 0.0323089883f, 0.00494980486f,
+    -0.000974851311f, -0.216971472f, 0.279952705f, 0.0819518343f, -0.0954610333f, -0.0891854763f, -0.0142419524f, 0.0412462652f,
+    -0.00661470927f, -0.101165757f, -0.0496397465f, 0.019321464f, 0.461337417f, -0.0114799924f, -0.0738603473f, 0.0682463497f,
+    0.138910562f, 0.0258245599f, 0.275259733f, 0.00185471505f, -0.049980294f, 0.038998805f, 0.154231802f, 0.0223677084f,
+    0.0453780331f, -0.105355844f, -0.155544445f, -0.0672535971f, -0.0166503284f, 0.0196179319f, 0.169337571f, -0.0242853723f,
+    0.0331610814f, -0.0396477133f, 0.251153678f, 0.181998566f, -0.202578038f, -0.0924267247f, -0.048245389f, 0.166687012f,
+    0.0504611023f, -0.207210302f, -0.0892338976f, -0.0556061417f, 0.509859204f, -0.0697261766f, 0.0815816075f, 0.0283574015f,
+    0.104279481f, 0.0285251606f, 0.390467018f, 0.0495522767f, 0.00963009428f, 0.153308079f, -0.371300459f, 0.095818311f,
+    0.00665683951f, -0.111715898f, -0.103764549f, 0.0224977322f, 0.05107731f, 0.0485061258f, 0.0250587519f, 0.0286720265f,
+    0.11120709f, -0.0393186361f, 0.266907692f, 0.170714051f, -0.239085034f, -0.0747450739f, -0.0123709459f, 0.203665569f,
+    0.0918281376f, -0.118746199f, -0.0994822085f, -0.00756609486f, 0.470192045f, -0.0967166647f, -0.0240447689f, 0.0674377978f,
+    0.0809201226f, 0.0619374663f, 0.378098994f, 0.0223202389f, 0.0712586343f, 0.0764746442f, -0.360695183f, 0.0498695746f,
+    0.0387961082f, -0.074752517f, -0.0382986739f, 0.141492337f, -0.0171717443f, 0.0168241914f, 0.112800069f, 0.0206529368f,
+    0.102849148f, 0.0101386523f, 0.325976074f, 0.212080672f, -0.136373222f, -0.0487012118f, 0.036037799f, 0.156271279f,
+    0.0838408545f, -0.0600546598f, -0.134407938f, 0.0398903452f, 0.391275316f, -0.0200874303f, 0.0491266139f, 0.0538100265f,
+    0.204972431f, 0.0445303656f, 0.299894989f, 0.00158382102f, 0.0635604858f, 0.060739439f, 0.0751857758f, 0.101007372f,
+    0.115337461f, -0.0402444899f, -0.0200947765f, 0.151515394f, -0.0196583625f, 0.0616349317f, 0.203486949f, 0.0745974779f,
+    -0.0824962258f, 0.102043577f, -0.0128732417f, 0.0944389254f, 0.0287291966f, 0.108225316f, -0.140856758f, -0.184257984f,
+    0.0801486671f, -0.0480046012f, 0.0513607338f, 0.267844737f, -0.239341825f, -0.0805314928f, 0.0740977153f, 0.0282624885f,
+    0.076938197f, -0.0306311902f, -0.14444451f, 0.187212542f, -0.00913799834f, 0.0679640174f, -0.0801186785f, 0.0353211351f,
+    0.00485573569f, 0.0798722729f, 0.121089078f, -0.0878784955f, -0.0288341381f, -0.014319608f, 0.155501455f, 0.0573251694f,
+    -0.0262638144f, 0.0796595588f, 0.0440511368f, 0.0105505651f, -0.0364191346f, 0.0318813249f, -0.0796789974f, -0.176476508f,
+    0.104364678f, 0.00853510294f, -0.00454202108f, 0.23461242f, -0.131326467f, -0.0284946561f, -0.0253651403f, 0.0172018316f,
+    0.0129504828f, 0.0821374282f, -0.159277603f, 0.178220734f, 0.0776682124f, 0.0605049655f, -0.251360059f, 0.0761987045f,
+    -0.0271780491f, 0.0716976076f, 0.163127542f, -0.110221587f, 0.00114907569f, -0.0336393416f, 0.110348135f, 0.0336141102f,
+    -0.0736931786f, 0.0827672258f, -0.0360425375f, 0.0265604071f, 0.0289137978f, 0.107733518f, -0.113734148f, -0.177065656f,
+    0.096032925f, 0.0362984948f, 0.0766336098f, 0.214242801f, -0.108532198f, -0.0649910942f, -0.0202242155f, 0.114576325f,
+    0.103078417f, 0.0975390449f, -0.0863140002f, 0.128075391f, -0.0290930178f, 0.000866314862f, -0.169784486f, 0.0766928419f,
+    0.0938146859f, 0.0830511972f, 0.102361746f, -0.0810449421f, 0.104126342f, 0.00444181589f, 0.24040857f, 0.036251273f,
+    -0.0400235765f, 0.0309821758f, -0.0569411591f, 0.0443501994f, 0.0559931658f, 0.00594691234f, -0.127659157f, -0.141276643f,
+    0.120712779f, -0.0398579948f, 0.107318059f, 0.131043464f, -0.180101365f, -0.0705592409f, 0.0906330422f, 0.00427536806f,
+    0.106436044f, 0.00931966864f, -0.151285723f, 0.0587665476f, -0.019644903f, 0.00977877341f, -0.10568139f, -0.0117899179f,
+    0.0112200305f, 0.0420933217f, 0.137846231f, -0.120864443f, -0.0349125527f, 0.0017850002f, 0.0560680628f, 0.0918310806f,
+    0.00481135631f, -0.00268837344f, 0.0459595546f, 0.00906489324f, 0.0184658933f, 0.0111170178f, -0.161220178f, -0.184072375f,
+    0.122436382f, 0.0110432478f, 0.0503385291f, 0.139327168f, -0.118501879f, -0.0968491361f, -0.0342281871f, 0.0474754833f,
+    0.0601199716f, 0.0838620588f, -0.0785697475f, 0.104657598f, 0.00125458324f, 0.0317549109f, -0.187244773f, 0.0436242186f,
+    0.0109744957f, 0.00247059832f, 0.0618629195f, -0.145237416f, 0.0169100221f, -0.0538026169f, 0.0118159428f, 0.0152277406f,
+    -0.0985958129f, 0.0791425034f, -0.00684868824f, 0.0840373337f, 0.0780179575f, 0.0984805971f, -0.158407629f, -0.248008341f,
+    0.0425396301f, -0.0205082279f, 0.0965216979f, 0.102213442f, -0.108330525f, -0.120278604f, -0.0286604781f, 0.0685013086f,
+    0.0363372453f, 0.0408221856f, -0.139681533f, 0.0150685804f, 0.0441251695f, -0.058448378f, -0.158409864f, 0.00423259847f,
+    0.101035669f, 0.0270757321f, 0.0931309164f, -0.0972874984f, 0.0609451719f, -0.0191790611f, 0.10967283f, 0.0249409825f,
+    -0.0812776461f, 0.127893656f, 0.0210790895f, 0.0196662471f, 0.072130844f, 0.122490399f, -0.131698921f, -0.215685517f,
+    0.0911578834f, -0.00813943613f, 0.0787717327f, 0.162981495f, -0.197687805f, -0.0898512676f, 0.0859534815f, 0.0941888019f,
+    0.0171157178f, 0.0529787876f, -0.17056784f, 0.0736214668f, -0.0335492417f, -0.0417095199f, -0.046182014f, 0.116279788f,
+    0.0992681533f, 0.00263328082f, 0.117561124f, -0.129633754f, 0.0344808139f, -0.0447330996f, 0.18541272f, 0.0927311182f,
+    -0.074783206f, 0.0839330703f, 0.0296705309f, 0.0852383599f, -0.054293368f, 0.0613521188f, -0.155133277f, -0.199849218f,
+    0.12995851f, -0.0363017209f, -0.0324690565f, 0.185751721f, -0.21236147f, -0.0675607622f, -0.0105940644f, 0.0245911833f,
+    -0.000547942764f, 0.0858844891f, -0.18776536f, 0.0632840246f, 0.00934291817f, -0.0582920574f, -0.139534712f, 0.0234567076f,
+    0.00788780022f, 0.0370196961f, 0.0674406961f, -0.0682971254f, 0.0291455779f, 0.0305473283f, 0.130568042f, 0.0748993382f,
+    -0.122302704f, 0.0329560824f, -0.0581954867f, 0.0299950615f, -0.0233309902f, 0.0677259862f, -0.104631059f, -0.260083109f,
+    0.0450112857f, -0.0271724313f, -0.00795578677f, 0.220265999f, -0.225176886f, -0.0942622498f, 0.0762449056f, 0.14016138f,
+    0.0857893229f, 0.0683073029f, -0.170773655f, 0.047317747f, -0.0142365126f, -0.00877489429f, -0.181446657f, 0.0714155734f,
+    0.052743677f, 0.0770709142f, 0.0805305764f, -0.101877466f, 0.0627779737f, -0.0659525916f, 0.330408454f, 0.0353541076f,
+    0.0893909484f, 0.19161354f, 0.0485157259f, 0.117552653f, -0.382217824f, -0.0968532637f, 0.0680506974f, -0.0563844629f,
+    0.19614622f, -0.337761909f, -0.17286481f, -0.173007384f, 0.125491723f, -0.267086655f, -0.0488803983f, 0.00392107153f,
+    -0.0602008924f, 0.00203081453f, -0.0282543022f, -0.105225965f, 0.173900813f, 0.0929706618f, -0.367561758f, 0.00804047659f,
+    0.0704366937f, -0.370037943f, 0.0305619966f, -0.00140272523f, -0.103451863f, 0.184690788f, -0.521430135f, -0.0376596004f,
+    0.0829344466f, 0.123293489f, 0.0825058594f, 0.234025866f, -0.0474620052f, 0.0330238193f, 0.0606001206f, -0.064067632f,
+    0.208755195f, -0.0983871818f, 0.0128422361f, -0.0931319743f, 0.0226136111f, -0.224296823f, 0.0398100801f, 0.0486921445f,
+    0.179616332f, 0.0281906184f, -0.0122000584f, 0.0723944157f, 0.100561999f, 0.0934804082f, -0.297939211f, -0.0745025575f,
+    0.128820181f, -0.0660655424f, 0.320275187f, -0.0802691951f, 0.0126929972f, 0.211456865f, -0.180159226f, 0.0488181002f,
+    0.0722107813f, 0.146477595f, 0.139757425f, 0.246047616f, 0.0657218024f, 0.169394463f, 0.0640082657f, -0.0508436933f,
+    0.243050635f, 0.016988961f, 0.113745816f, 0.114719108f, 0.175807551f, -0.263116479f, -0.0652543232f, 0.0418624394f,
+    0.127702072f, -0.06116179f, 0.0701599345f, 0.186417729f, 0.152411461f, 0.16779612f, -0.145376205f, -0.0717884749f,
+    0.0491556004f, -0.038774319f, 0.416320831f, -0.0974863693f, 0.0319579914f, 0.224154145f, -0.338729203f, 0.0634470209f,
+    0.00366629544f, 0.179127872f, 0.0319527164f, -0.101792321f, -0.334583133f, -0.0119349901f, -0.0223354977f, -0.0930231214f,
+    0.181642205f, -0.279160798f, -0.0499488078f, -0.424835712f, 0.101383291f, -0.436618298f, -0.0145201506f, 0.0826716647f,
+    0.0388505869f, 0.0429768302f, 0.0586946271f, -0.170686409f, 0.0575021692f, -0.0796600506f, -0.372597575f, -0.04646983f,
+    0.015587518f, -0.35402745f, 0.214039877f, -0.0940784216f, -0.0950044692f, 0.233778477f, -0.715674579f, 0.0389624275f,
+    -0.0580508821f, 0.107654825f, 0.0345843434f, 0.010378574f, 0.0417567305f, 0.150883228f, 0.00869578496f, -0.132966891f,
+    0.219253764f, -0.00717288535f, 0.159701794f, -0.0870982632f, 0.144407868f, -0.273897767f, 0.0617139265f, 0.0599329136f,
+    0.18390806f, 0.0351647511f, 0.00369599066f, 0.013826712f, 0.0698762015f, -0.0604176782f, -0.137173429f, 0.0448261686f,
+    0.117862359f, -0.0243018549f, 0.353003919f, -0.0242027398f, -0.00976542477f, 0.249427989f, -0.287239969f, -0.00983444136f,
+    -0.150762856f, 0.152735427f, -0.0376392677f, 0.12315134f, 0.101187408f, 0.117035307f, 0.0391475447f, -0.155141383f,
+    0.14411281f, 0.105908372f, 0.167849332f, 0.0468814634f, 0.108472615f, -0.208593994f, -0.000437373557f, 0.0743438601f,
+    0.199933037f, -0.0423381925f, -0.0133324657f, 0.0824489966f, 0.121886991f, 0.0605871454f, -0.0322749242f, -0.0114589501f,
+    0.105424754f, -0.0362474918f, 0.30133459f, -0.156812504f, -0.0483065397f, 0.159404442f, -0.24958235f, 0.0944499895f,
+    -0.0933228508f, 0.23798798f, 0.0413634442f, -0.347874135f, -0.0634774268f, 0.164056644f, 0.0525396504f, -0.0584847331f,
+    0.0665917248f, -0.0520461053f, 0.0997007489f, -0.369654745f, 0.103325307f, -0.562928379f, -0.0286579933f, 0.115998857f,
+    0.199953184f, -0.0444957949f, 0.0184034333f, -0.00467454875f, 0.172760367f, -0.033602681f, -0.28463921f, 0.0312514082f,
+    0.0275478847f, -0.225055546f, 0.421375722f, -0.219062373f, -0.0639578551f, 0.217431441f, -0.957876444f, 0.010245583f,
+    -0.0680220798f, 0.159624591f, 0.0244041644f, -0.255323529f, 0.0388761722f, 0.0789043754f, 0.0338478275f, -0.00524037238f,
+    0.0898087099f, -0.0221749879f, 0.164322197f, -0.0733948722f, 0.125732914f, -0.468247831f, 0.0748939663f, 0.00735072326f,
+    0.207191467f, -0.0134223085f, 0.050438229f, 0.0599609427f, 0.0694993809f, 0.0591898747f, -0.222196594f, 0.015346989f,
+    0.121394202f, -0.0949764252f, 0.380528778f, -0.162351057f, -0.0332034975f, 0.241734684f, -0.40379259f, 0.00123837544f,
+    -0.135026619f, 0.119093738f, 0.0212927535f, -0.22066997f, 0.140874475f, 0.154052898f, 0.115174644f, -0.091213502f,
+    0.0386436582f, 0.101046711f, 0.175117701f, -0.0412587821f, 0.117645077f, -0.207598746f, 0.00106577657f, 0.133016378f,
+    0.153137758f, -0.0121380361f, -0.00435981341f, 0.136641964f, 0.110980466f, 0.0179852657f, -0.0620247796f, -0.098657541f,
+    0.0214700066f, 0.080524914f, 0.37618649f, -0.275110453f, -0.0818617046f, 0.160869762f, -0.26575622f, 0.0401038863f,
+    0.0119537907f, 0.0292330626f, 0.269732028f, 0.218085572f, -0.115066603f, -0.108949684f, -0.0707921907f, 0.224524349f,
+    -0.0357647315f, -0.00236157631f, -0.0597087555f, -0.0194598064f, 0.49418965f, -0.0244449098f, -0.0106870541f, -0.0477946773f,
+    -0.0129512874f, 0.000215053064f, 0.343028933f, 0.24322173f, 0.099619098f, 0.127887532f, 0.16366449f, 0.0284849368f,
+    -0.0115952073f, 0.16893357f, -0.310217857f, -0.0533627383f, -0.0520729385f, 0.0178752337f, -0.073888652f, 0.0731231496f,
+    0.0816316381f, -0.0085943304f, 0.287944555f, 0.131694928f, -0.129678473f, -0.135576025f, -0.152078509f, 0.313046753f,
+    -0.0516838208f, -0.0548312068f, -0.200713649f, 0.0116413729f, 0.467801929f, -0.0864678621f, -0.0484733284f, -0.0657046661f,
+    0.0306218527f, 0.00464107189f, 0.387767702f, 0.172731578f, 0.117841668f, 0.14182803f, 0.0884489268f, -0.0862577558f,
+    0.0401142128f, 0.0286593344f, -0.400785804f, -0.144714162f, -0.0334451087f, 0.0569105558f, -0.197657332f, 0.084863469f,
+    0.0759415552f, 0.020684192f, 0.36281839f, 0.0960960388f, -0.0225608312f, -0.104042768f, -0.0231781565f, 0.255575478f,
+    -0.0490439944f, -0.0312438216f, -0.077832751f, -0.0341814309f, 0.519342959f, -0.120765761f, -0.0195225608f, 0.03134574f,
+    0.0948703513f, -0.00384485722f, 0.45537442f, 0.216373309f, 0.0954756513f, 0.180060372f, 0.35920772f, 0.0429474823f,
+    0.107183516f, 0.107581921f, -0.0977856368f, -0.141267836f, 0.0200825371f, 0.0590319373f, -0.241485953f, 0.0742728487f,
+    -0.0351806544f, -0.0282745212f, 0.241053283f, 0.133793429f, -0.164992139f, -0.126111984f, -0.139674962f, 0.204781115f,
+    -0.038146887f, -0.089164868f, -0.183943167f, -0.00599347986f, 0.463589787f, -0.0831273645f, -0.0598961487f, -0.034187451f,
+    -0.00843957253f, -0.0621705577f, 0.301927775f, 0.195176035f, 0.00821596291f, 0.133389071f, -0.166108727f, -0.0103556421f,
+    -0.0200316906f, -0.000274088263f, -0.260377079f, -0.230520919f, -0.142630339f, 0.04688311f, -0.216839328f, -0.0332271419f,
+    -0.0179202016f, -0.0494522601f, 0.199202955f, 0.0777943507f, -0.195143208f, -0.174772575f, -0.138802931f, 0.231909499f,
+    -0.0774359629f, -0.120090112f, -0.20099926f, 0.0440081209f, 0.370952606f, -0.154946566f, -0.0405058526f, -0.075374417f,
+    -0.0360740684f, -0.0995747522f, 0.342063129f, 0.0752557516f, 0.00880975369f, 0.0351424627f, -0.293510675f, -0.113411896f,
+    0.00565837417f, 0.0171615239f, -0.374047577f, -0.150045365f, -0.0719522387f, -0.0655785128f, -0.19460316f, -0.0548794866f,
+    -0.0412430316f, -0.0679330006f, 0.275851309f, 0.121549986f, -0.116352171f, -0.0735144317f, -0.0716608986f, 0.257837504f,
+    -0.0681866258f, -0.0452773683f, -0.0330408923f, 0.071960628f, 0.449076533f, -0.131596297f, -0.00185055239f, -0.0286050159f,
+    0.123265572f, -0.0213728528f, 0.404170632f, 0.0800708532f, 0.0922173187f, 0.0556583963f, 0.368355244f, -0.0642542541f,
+    0.0479371808f, -0.0547063686f, -0.169814155f, -0.180544063f, -0.118964605f, 0.0126707666f, -0.0975790098f, 0.0302204173f,
+    0.115442447f, 0.0181590728f, 0.307340086f, 0.223849013f, -0.223573595f, -0.1329633f, -0.0590592213f, 0.262570828f,
+    -0.0715990514f, -0.169003919f, -0.234861985f, 0.00953397993f, 0.470511377f, -0.101803437f, 0.00585473608f, 0.0130704474f,
+    0.00751504209f, -0.0443116911f, 0.351242155f, 0.191937506f, 0.0619113632f, 0.140896708f, -0.379009217f, -0.103967905f,
+    0.0611479133f, 0.156719685f, -0.365984261f, -0.0440288633f, -0.0305396989f, -0.0318943374f, 0.0286904462f, 0.0337819234f,
+    0.0448710807f, -0.0587961003f, 0.188214883f, 0.137732431f, -0.248132676f, -0.226985291f, -0.116334334f, 0.237425148f,
+    -0.035878323f, -0.155735761f, -0.206191137f, 0.0250704139f, 0.452670068f, -0.132283017f, -0.0354708135f, -0.0605210997f,
+    -0.015385977f, -0.00852986518f, 0.33303687f, 0.0732296109f, 0.0264022108f, 0.177361041f, -0.196447223f, -0.0863349661f,
+    -0.0285969991f, 0.00862917025f, -0.44658944f, -0.0130696269f, -0.0374985933f, 0.0186876282f, 0.109052353f, -0.0155695174f,
+    0.0632674769f, -0.0425348878f, 0.250221848f, 0.175846815f, -0.0371073559f, -0.125094205f, -0.0133172069f, 0.183658212f,
+    -0.041863516f, -0.0185393374f, -0.138224363f, 0.104582116f, 0.452663869f, -0.0148802754f, -0.0303506907f, 0.00854272675f,
+    0.098787576f, 0.00817310624f, 0.324819088f, 0.140497774f, 0.0779093951f, 0.216994897f, 0.382440388f, 0.0434795767f,
+    0.0500486568f, 0.110243045f, -0.257304221f, -0.0311852712f, 0.0515690446f, 0.0220867563f, 0.160351202f, 0.149710119f,
+    -0.0526902638f, 0.086030975f, -0.0192090217f, 0.0617511086f, 0.0598822273f, 0.17769888f, -0.0962017775f, -0.189390361f,
+    0.142723694f, 0.0131820599f, 0.0739281178f, 0.300636768f, -0.282688588f, -0.0369463824f, 0.120541707f, 0.0006224346f,
+    0.0720373094f, 0.00247833692f, -0.214522764f, 0.113032192f, 0.063413322f, -0.0200925022f, -0.0498440154f, 0.0401141718f,
+    -0.012856748f, 0.0967023745f, 0.330631644f, -0.0858509392f, -0.0255791713f, -0.0503719561f, 0.1810029f, 0.0589115322f,
+    0.0389156863f, 0.0248579867f, -0.0174775701f, 0.0213153604f, 0.00362563622f, 0.100431331f, -0.0963618681f, -0.0889681503f,
+    0.148799613f, 0.0233521368f, 0.0741800964f, 0.242070943f, -0.11584843f, -0.144084796f, 0.0786756128f, -0.0183343496f,
+    -0.00808880478f, -0.0140020158f, -0.0834779069f, 0.118316062f, 0.0466252416f, 0.0846771821f, -0.319977194f, -0.0039172601f,
+    -0.00591088645f, 0.0840888545f, 0.243126124f, -0.0904021934f, 0.0744770765f, -0.0428194925f, 0.166359082f, 0.0239222515f,
+    -0.0489465781f, 0.0903102309f, -0.0415066555f, 0.0391831398f, 0.00659854896f, 0.100826509f, -0.0865003243f, -0.124342725f,
+    0.0852141231f, 0.0655370429f, 0.116904035f, 0.209220201f, -0.222585738f, -0.0994257778f, 0.0800721198f, 0.0408355221f,
+    0.0598137975f, 0.0235197954f, -0.112436891f, 0.156009525f, 0.032397192f, -0.0199698787f, -0.304687679f, 0.0223530065f,
+    0.0649753436f, 0.0924280062f, 0.249830097f, -0.106097952f, 0.00500508444f, -0.0580725968f, 0.263966769f, -0.00556172011f,
+    -0.0601346679f, 0.0728131905f, -0.0624592006f, 0.0683806092f, 0.0436229147f, 0.0995528623f, -0.144527271f, -0.158168241f,
+    0.100635737f, 0.063574709f, 0.11231304f, 0.175835997f, -0.238868892f, -0.0592698492f, 0.0804897249f, 0.0329721197f,
+    0.063554436f, -0.0215617567f, -0.159851998f, 0.0915751681f, 0.0961381048f, 0.0806816518f, -0.0924547315f, 0.0611372441f,
+    0.0227012821f, -0.025685396f, 0.363315552f, -0.16727443f, 0.0140070114f, -0.0277374294f, 0.081919834f, 0.0944880918f,
+    -0.0756923035f, 0.048360724f, -0.0191645883f, 0.00371640571f, 0.0254647434f, 0.124729589f, -0.171011373f, -0.0691045001f,
+    0.0319078788f, -0.0307787992f, 0.0661006048f, 0.0801821649f, -0.0969960168f, -0.143654421f, 0.00481667696f, -0.018720489f,
+    0.00339000486f, 0.0211555529f, -0.101616688f, 0.0562373511f, 0.0884507224f, 0.0280510038f, -0.343882024f, 0.0589526743f,
+    0.030760387f, -0.0175394434f, 0.293961197f, -0.107409276f, -0.00985982269f, -0.0642726198f, 0.0412159376f, 0.0247011799f,
+    -0.0161417108f, 0.0716182962f, 0.0145737575f, 0.000527347729f, -0.00846685842f, 0.157698706f, -0.0926158801f, -0.194164529f,
+    0.0463000908f, 0.0201496854f, 0.0105092842f, 0.171608254f, -0.177613631f, -0.153388739f, -0.0306957122f, 0.0805230811f,
+    0.0426216498f, -0.0116191795f, -0.126035437f, 0.0724447519f, -0.0314819552f, -0.000696153264f, -0.263609707f, -0.0202336479f,
+    0.0170699731f, 0.00469445903f, 0.280383945f, -0.11149177f, 0.0725593045f, -0.000836794672f, 0.159831554f, 0.0124775823f,
+    -0.066256769f, 0.109259449f, -0.0591476709f, 0.0208333023f, 0.0914792195f, 0.117398322f, -0.120641313f, -0.269537985f,
+    0.0589025468f, -0.0128450943f, 0.120266296f, 0.251115978f, -0.299549699f, -0.12470793f, 0.0566478632f, 0.0701854602f,
+    0.110932961f, 0.00498033967f, -0.213577688f, 0.0608687028f, 0.0366936438f, -0.0941966251f, -0.136379778f, 0.0161348023f,
+    0.0384746157f, 0.0768885389f, 0.398795724f, -0.109576508f, 0.0447301716f, 0.0114543037f, 0.175183922f, 0.00385009777f,
+    0.00227836403f, 0.10735146f, -0.00300817052f, 0.0403628573f, -0.0113300998f, 0.128597409f, -0.12956953f, -0.250167876f,
+    0.105168983f, -0.053790208f, 0.0904003456f, 0.149331316f, -0.254899651f, -0.15032132f, 0.0151416901f, 0.104865476f,
+    0.0134529993f, 0.0212790314f, -0.17916055f, 0.031394165f, 0.0300623067f, -0.0496006757f, -0.268311739f, 0.00184871966f,
+    0.0809621587f, 0.0813619718f, 0.217200682f, -0.108127214f, 0.0416245796f, -0.0707026795f, 0.148329899f, -0.020067146f,
+    -0.105029412f, 0.0326160118f, -0.0152713833f, 0.0965076014f, 0.0095320493f, 0.166944399f, -0.202756554f, -0.312731683f,
+    0.0511798635f, 0.0254269727f, 0.0862731114f, 0.177361637f, -0.199355736f, -0.173868552f, 0.00619926257f, 0.112121664f,
+    0.00472430559f, 0.124483116f, -0.234054223f, 0.0716476142f, -0.0808958784f, -0.0888880566f, -0.247739002f, -0.0006991509f,
+    0.05831993f, 0.000310553791f, 0.253213704f, -0.108743794f, 0.0932978317f, -0.0347462744f, 0.294821471f, 0.0479730703f,
+    0.0268431585f, -0.115986861f, -0.00885400269f, 0.112050101f, 0.0352906175f, 0.101351097f, -0.0386362635f, 0.14999485f,
+    0.0217662808f, 0.0498669446f, 0.0632190853f, 0.177948669f, -0.110772908f, 0.0822251141f, -0.0737282634f, -0.0425019674f,
+    -0.0804243237f, -0.0521643534f, -0.0857531354f, 0.0995129943f, 0.108884804f, 0.0224575549f, -0.318212837f, -0.0772537291f,
+    0.0212651566f, 0.044762779f, 0.0305559952f, 0.0886939019f, -0.0156263225f, -0.0162787382f, 0.322895646f, 0.053300716f,
+    0.0557683371f, -0.108407728f, -0.0311183836f, 0.056113638f, -0.00500414521f, 0.0103542982f, -0.0865606219f, 0.183622956f,
+    -0.0350488424f, 0.000818651577f, 0.0257385988f, 0.177515671f, -0.126330242f, -0.0142282564f, -0.0516573489f, -0.0187213104f,
+    -0.0902158916f, 0.00694512064f, -0.0976124853f, 0.119522274f, 0.0344779156f, 0.0471704006f, -0.330644369f, -0.0527361706f,
+    0.0319590867f, 0.00458592735f, 0.0202143937f, -0.0341605321f, 0.04538095f, -0.0808124095f, 0.257998139f, 0.00370008079f,
+    -0.0107776597f, -0.057152696f, -0.107589863f, 0.0602901317f, 0.0549937934f, 0.106667988f, -0.0214366261f, 0.159202561f,
+    -0.00349282264f, 0.0604161732f, 0.0421725139f, 0.132430226f, -0.189389661f, -0.0493431278f, -0.0859337002f, -0.0284963902f,
+    -0.0384295136f, 0.0174385663f, -0.0835081339f, 0.0630598068f, 0.0237093363f, 0.0343092009f, -0.419863492f, -0.0947862566f,
+    -0.0547455922f, 0.030155357f, 0.107700154f, 0.0611706972f, 0.0583318882f, -0.0410580151f, 0.321569771f, 0.0580512658f,
+    0.0703567266f, -0.134122744f, -0.0306901317f, -0.0107750362f, 0.0158375129f, 0.039631214f, 0.00114109751f, 0.133268356f,
+    -0.0111307222f, 0.0684061646f, 0.0220703725f, 0.189258903f, -0.154765531f, -0.0405368209f, -0.0736262798f, -0.0289928f,
+    -0.0957374498f, 0.0412677713f, -0.0508743934f, 0.0223023947f, 0.0398035794f, 0.0131228659f, -0.27405113f, -0.0721907765f,
+    0.0236904044f, -0.0468979664f, 0.0263124984f, -0.0184877198f, 0.0366538912f, -0.0694437847f, 0.20108889f, 0.0347247832f,
+    -0.0239646565f, -0.0998142585f, -0.0175275635f, -0.0771625564f, 0.0343462788f, 0.0501607321f, -0.0117014889f, 0.154155686f,
+    -0.0163775142f, -0.0393618755f, 0.00595462462f, 0.0554541759f, -0.118585683f, -0.0913423002f, -0.0558720194f, -0.0151958913f,
+    -0.0740123615f, -0.0286860298f, -0.0368650071f, 0.0346822329f, 0.0189150609f, 0.045754578f, -0.382547885f, -0.028609138f,
+    0.0214942154f, -0.0113939056f, 0.0871079341f, -0.0617281683f, 0.0380017273f, -0.0832080171f, 0.198902041f, 0.016635282f,
+    0.0150682032f, -0.0378889292f, -0.042483855f, 0.00329297013f, 0.0558850393f, 0.150002718f, 0.0310916882f, 0.194837511f,
+    -0.0584203489f, 0.0270273164f, 0.0395609029f, 0.0954691693f, -0.100899339f, -0.0592510253f, -0.0561106876f, 0.0136856483f,
+    0.046323698f, -0.0242676679f, -0.0918570533f, 0.0395824648f, 0.0587205477f, -0.000768068188f, -0.445576131f, -0.0421295613f,
+    0.0473430492f, 0.0393765159f, 0.197897106f, -0.067778945f, -0.00601377338f, -0.0918662697f, 0.24903819f, 0.0285256393f,
+    0.0447017998f, -0.10000895f, -0.0788685083f, -0.0238378122f, 0.0206472557f, 0.0782812238f, 0.00134427624f, 0.10986115f,
+    0.0240283459f, 0.128497317f, -0.0219312478f, 0.248485595f, -0.198994458f, 0.0508862063f, -0.0527402088f, 0.00143941073f,
+    -0.00437101116f, -0.00927561149f, -0.0882337913f, 0.0245184805f, 0.0802538395f, -0.0348296575f, -0.317646772f, -0.0672240481f,
+    -0.0150869209f, -0.00168929924f, 0.00405442109f, 0.000481556606f, 0.0237496626f, -0.0106022619f, 0.287390262f, 0.000254407845f,
+    0.0627634302f, -0.123414807f, -0.0998519212f, 0.0256382748f, 0.0338206626f, 0.0587446317f, -0.067117855f, 0.0715111122f,
+    0.0172155704f, 0.0625574291f, -0.0354498811f, 0.157642946f, -0.079476133f, -0.0277664214f, -0.123033449f, -0.0488191545f,
+    -0.0293575544f, -0.000117600415f, -0.143207043f, -0.00306911627f, 0.0553649813f, 0.0441248007f, -0.343973547f, -0.0440647788f,
+    -0.000247860764f, -0.0178861897f, 0.0467662476f, -0.0754245967f, 0.0188664719f, -0.0853266194f, 0.31832099f, -0.0433667377f,
+    -0.00696742069f, -0.125456765f, -0.055656556f, 0.0202507563f, 0.0620803796f, 0.145860687f, -0.0572985634f, 0.147805005f,
+    -0.0294608697f, 0.0783167481f, 0.0980126858f, 0.203822419f, -0.189292058f, -0.0701058507f, -0.127015889f, 0.0708509609f,
+    0.0633926168f, 0.0064638732f, -0.0521029197f, 0.0346011519f, 0.00377910421f, -0.0252201334f, -0.421385735f, -0.0429007635f,
+    0.0171671379f, 0.061784368f, 0.216246426f, -0.0140698571f, 0.0757716224f, -0.0736591667f, 0.306162268f, 0.0045887162f,
+    -0.0238229334f, 0.0951013044f, 0.0557218753f, -0.206497341f, 0.183188975f, 0.0443838909f, 0.19563143f, -0.0846668854f,
+    0.043740496f, 0.160573825f, 0.207842201f, 0.0534483455f, 0.0575918853f, 0.0079710288f, 0.0369804017f, -0.0419192873f,
+    0.381595343f, -0.0881456435f, -0.0182480942f, 0.0979573876f, 0.0857462212f, 0.0664279163f, -0.317425817f, 0.018301174f,
+    -0.124472715f, -0.0507741161f, 0.163444713f, -0.247201383f, -0.140580609f, 0.0840030611f, -0.374899268f, 0.0659363419f,
+    -0.0236631818f, 0.0445406996f, -0.00146192266f, -0.0882216021f, 0.0482768863f, -0.0348269455f, 0.169119596f, -0.0424528643f,
+    0.00367292599f, 0.142519653f, 0.0982201621f, 0.0571677387f, 0.00958801992f, -0.118017167f, 0.000966997119f, 0.00469377078f,
+    0.230838567f, -0.0780638978f, -0.00572568458f, 0.152183115f, 0.167752713f, 0.0529721305f, -0.387159377f, -0.0404068418f,
+    -0.0953454599f, -0.0781405047f, 0.137148425f, -0.278875053f, -0.0554850511f, 0.101032153f, -0.334810942f, 0.0532704145f,
+    0.0323791504f, 0.00984739233f, 0.0258893166f, -0.209020928f, 0.145720229f, 0.00246738456f, 0.167545199f, -0.0276626348f,
+    0.0297382027f, 0.132712275f, 0.14490065f, 0.119551711f, 0.0121946912f, -0.0861999243f, 0.027567856f, 0.0130986022f,
+    0.24936378f, 0.00980061851f, 0.0313661806f, 0.0426667072f, 0.126871213f, 0.0254280381f, -0.478073776f, -0.0300588124f,
+    -0.0936054885f, -0.0157502498f, 0.0490927845f, -0.351219565f, -0.0753685758f, 0.108303659f, -0.220964447f, 0.0978584439f,
+    -0.00627069129f, 0.0270298105f, 0.0504337884f, -0.214461863f, 0.174366817f, -0.0413003378f, 0.162538454f, -0.174754083f,
+    0.0172639359f, 0.109937549f, 0.212090731f, -0.00657876441f, 0.0356669538f, 0.0457208939f, 0.078644909f, 0.072661154f,
+    0.347648084f, -0.00291683897f, -0.062534228f, 0.0946111381f, 0.0718911439f, 0.0942309275f, -0.231328204f, 0.0439621173f,
+    -0.0884952396f, -0.0890561342f, 0.195541382f, -0.273621082f, -0.141974345f, -0.0178125091f, -0.318182647f, 0.123246737f,
+    0.0093004955f, 0.0266156867f, 0.00841668528f, -0.231322557f, 0.069277145f, -0.0388137735f, 0.114430666f, -0.105970651f,
+    -0.0440073572f, 0.109078646f, 0.0981355533f, 0.0609223619f, -0.0285035111f, -0.0829927102f, -0.023024125f, 0.0273593236f,
+    0.265177548f, -0.00921999663f, 0.00690458668f, 0.105619997f, 0.0483428687f, -0.00496067293f, -0.261065453f, -0.0661429614f,
+    -0.0235857107f, -0.0346548669f, 0.157123834f, -0.364593714f, -0.100547276f, 0.000453090353f, -0.214106202f, 0.0869785622f,
+    -0.000183369717f, -0.0100916894f, -0.0400107428f, -0.148237661f, 0.121229053f, 0.0504363552f, 0.167230248f, -0.165867493f,
+    -0.0344148949f, 0.164324343f, 0.130321786f, 0.0508203506f, 0.0690705851f, -0.0846881941f, 0.000232883933f, 0.0560056344f,
+    0.222855419f, 0.0509067439f, -0.0512939394f, 0.038171459f, 0.0833628029f, 0.01477795f, -0.354291886f, -0.0354577266f,
+    -0.0092440825f, -0.0233876463f, 0.0662091076f, -0.405485511f, -0.0469960421f, 0.0392382853f, -0.181379393f, 0.0554177575f,
+    -0.0255091544f, 0.0370744504f, 0.00307979574f, -0.33956176f, 0.21007067f, 0.0944734514f, 0.169975519f, -0.0861754715f,
+    -0.0915047601f, 0.145620406f, 0.173210844f, 0.0510971546f, 0.0487328693f, -0.0295821149f, 0.0125699462f, 0.026761692f,
+    0.288664669f, 0.040287856f, -0.127416432f, 0.0967861563f, 0.145207152f, 0.0316291265f, -0.179572359f, 0.0263407584f,
+    -0.0977578536f, 0.0556704253f, 0.143937692f, -0.388471097f, -0.113750406f, 0.00671824208f, -0.311948955f, 0.111884363f,
+    -0.0811934173f, 0.0434517302f, -0.0480332375f, -0.279637784f, 0.160040304f, 0.055311162f, 0.14818351f, -0.165481523f,
+    -0.121518895f, 0.170517296f, 0.191590264f, 0.0317009427f, 0.0154467961f, -0.0474168099f, -0.0524223484f, 0.0783747286f,
+    0.285292685f, 0.0317418464f, -0.0924307257f, 0.0466740131f, 0.0647819489f, 0.0685502589f, -0.252735525f, -0.014159306f,
+    -0.0240742508f, 0.0394399688f, 0.143724352f, -0.351748914f, -0.0435926542f, -0.0520792156f, -0.269352496f, 0.0821705908f,
+    -0.0794958174f, 0.0486558415f, -0.0379793271f, -0.263762474f, 0.189570308f, 0.00230859825f, 0.210242853f, -0.0973160788f,
+    -0.0123361889f, 0.122790843f, 0.156551376f, 0.000272539211f, 0.0160625484f, -0.00262225023f, -0.0694033056f, 0.101024278f,
+    0.252726495f, 0.0142426221f, -0.0789888576f, 0.0960868523f, 0.062834613f, 0.00234533101f, -0.392201185f, -0.053834334f,
+    0.0261478201f, 0.00761757791f, -0.0272327773f, -0.466695249f, -0.0819977745f, -0.0267098974f, -0.271278381f, -0.00353844254f,
+    -0.00986669771f, -0.0457824655f, -0.0824986473f, -0.0761087835f, -0.0467912555f, -0.0154067464f, -0.0648895428f, -0.0196173321f,
+    -0.0511090569f, -0.0447901376f, 0.012714074f, 0.0062878984f, -0.0609429404f, 0.00791680999f, 0.0265770108f, 0.00918400101f,
+    0.043599315f, 0.0471445546f, 0.0258469023f, 0.00810852088f, -0.00759292208f, -0.0482243709f, -0.0051527652f, 0.0110865561f,
+    -0.0150720784f, 0.00477627339f, -0.029007351f, 0.0210231263f, -0.0542063601f, -0.0559556969f, 0.0239143185f, 0.0293198749f,
+    0.027318608f, -0.0883705765f, 0.011903245f, -0.03717364f, -0.0638242066f, 0.0298322309f, -0.0166094154f, -0.00587011548f,
+    -0.0409050137f, -0.0530425645f, -0.00916110259f, 0.0361909047f, -0.00277683139f, 0.0131939873f, -0.0602803305f, 0.000991011038f,
+    0.0122024771f, 0.0280232113f, -0.0217573345f, 5.58417705e-05f, -0.0459459126f, 0.00483769597f, -0.0712617487f, -0.0632253066f,
+    -0.0430761278f, 0.00396285625f, 0.0451949947f, -0.0020263209f, -0.0220935978f, -0.0114539657f, -0.0135650951f, -0.0440357774f,
+    -0.033622358f, -0.0606522262f, -0.0330127664f, 1.44504493e-05f, 0.0782078505f, -0.0391314551f, -0.0264510941f, -0.00400376646f,
+    -0.00287843123f, 0.0174344536f, 0.0236913543f, -0.00891355146f, -0.0295878593f, 0.0122530395f, 0.0292408857f, -0.0553496405f,
+    0.0564468168f, 0.0487446748f, 5.2211919e-05f, -0.0571758524f, -0.0544383898f, -0.0355930775f, -0.0139788138f, -0.0297906343f,
+    0.0339737982f, -0.0198223535f, 0.0449503921f, 0.0445624329f, -0.0490921959f, -0.00305752154f, -0.0178149194f, -0.0142961368f,
+    -0.0675017163f, -0.0257732645f, -0.0712215602f, 0.0367507935f, -0.0034755785f, 0.017363593f, -0.0354551598f, -0.0479282439f,
+    0.0244878083f, -0.0755801424f, -0.0184051339f, 0.027876934f, 0.00739749987f, -0.00217991765f, 0.00385022303f, 0.0131663149f,
+    -0.0423283763f, -0.0416037627f, 0.0083589768f, -0.0773405135f, 0.0230421964f, 0.0282757413f, -0.0849844217f, -0.0446427092f,
+    -0.0145410728f, -0.0151403807f, 0.0204440523f, -0.00686118752f, -0.0539909862f, -0.00568247959f, 0.0227608569f, -0.0812539309f,
+    -0.0180359725f, -0.0316040367f, 0.0398484953f, -0.0295222495f, -0.0705695376f, 0.0225406289f, -0.0353516601f, -0.028692225f,
+    -0.0626815557f, -0.0573821478f, -0.0173897296f, 0.0451633632f, -0.0488982834f, -0.0110834017f, 0.00379465614f, 0.0194271188f,
+    0.0301405117f, -0.0413284935f, 0.0406231731f, -0.0637293085f, -0.00724808266f, -0.0319214128f, -0.0137904957f, -0.0389210097f,
+    0.0399742648f, -0.00996219926f, 0.01654635f, -0.0391913503f, -0.0283579733f, 0.0504842587f, 0.0655383021f, 0.0159877464f,
+    -0.0240503792f, -0.0420627072f, 0.00322615704f, -0.0936165527f, 0.0300074369f, -0.023492001f, -0.0315717645f, 0.0228250027f,
+    -0.0548343472f, -0.0437387787f, 0.0129425908f, -0.0249461103f, -0.0201996341f, -0.0589036755f, -0.0219642036f, 0.0304750465f,
+    0.00889389217f, 0.0300388765f, 0.0179977864f, -0.0215194412f, -0.039097704f, -0.0148685705f, -0.104896002f, -0.0495059304f,
+    0.0454570539f, -0.0355794542f, -0.0347565673f, -0.0526768751f, -0.0673704743f, 0.0460674986f, -0.0541038997f, -0.0167530496f,
+    -0.076333113f, -0.0326559767f, -0.0141956517f, -0.0590630993f, -0.0245895274f, -0.0674408898f, -0.063828446f, -0.00364267733f,
+    0.0550849326f, -0.0819920525f, -0.065002203f, 0.0475113243f, -0.0279185176f, -0.0392010137f, 0.00279166317f, -0.0639402121f,
+    -0.0153574413f, -0.049855601f, -0.0112390919f, 0.0186715908f, -0.000143270896f, -0.0105973957f, -0.117575355f, 0.0129114725f,
+    -0.0197138488f, 0.0239101164f, -0.0628263354f, 0.00735362992f, 0.0435435437f, 0.00653266953f, -0.0301769413f, -0.0649986118f,
+    -0.0280657709f, -0.019541394f, -0.0176748075f, 0.0130388224f, 0.0131789902f, -0.0563220084f, -0.0455014557f, -0.0136167714f,
+    0.0157093648f, -0.01790094f, 0.00724268798f, 0.0347236246f, -0.0636216998f, -0.0291078053f, -0.0461218171f, -0.000134247282f,
+    0.0171529297f, 0.0108552305f, -0.0865959749f, 0.00811773911f, -0.0544448085f, -0.0204769317f, 0.0465177223f, -0.0454805419f,
+    0.0213515013f, 0.0211702567f, -0.0781441033f, -0.0630357638f, -0.0555177443f, -0.0154709266f, -0.0798827186f, 0.0270410813f,
+    -0.0617825314f, -0.00349469576f, 0.0500582643f, -0.0156535823f, 0.00826851465f, -0.00785100367f, -0.0478183366f, -0.028585149f,
+    -0.0586436093f, -0.0495703593f, -0.0530972928f, -0.0554040484f, -0.0529715829f, -0.0545872934f, -0.000827631389f, 0.0285386443f,
+    -0.0359506346f, 0.0347663648f, 0.0259767845f, -0.0586984754f, 0.0291184597f, -0.10848812f, -0.0588874333f, -0.0400810875f,
+    -0.0269019417f, 0.0200660098f, -0.0129458839f, -0.0541808195f, -0.0242262129f, -0.00476941187f, -0.0217057467f, -0.0664193258f,
+    0.0684680939f, -0.0434313454f, 0.118347861f, 0.193710312f, -0.102337137f, -0.0552630983f, -0.194350481f, 0.136618167f,
+    0.0706449226f, -0.110582002f, -0.201183558f, -0.0317553654f, 0.0252585877f, -0.0588510893f, -0.0687562898f, 0.0412561335f,
+    -0.298582166f, -0.00274563069f, 0.0419335365f, 0.068030268f, 0.0198841672f, 0.0465084426f, -0.170677379f, 0.0311627593f,
+    0.0476731025f, 0.0967210457f, -0.0961172506f, 0.105109744f, 0.0414983667f, -0.0794036761f, 0.163293898f, -0.010045059f,
+    0.0639791638f, 0.0230051093f, 0.0481476709f, 0.0769694448f, -0.110896774f, 0.0136343697f, -0.207352489f, 0.135890543f,
+    0.0555612035f, -0.0485651195f, -0.1617461f, 0.0864364952f, 0.000936241879f, -0.131538734f, -0.108348474f, -0.0278908592f,
+    -0.362098306f, 0.00618678005f, 0.0749603212f, 0.131333441f, 0.0602734685f, 0.0696895793f, -0.292172462f, 0.0194014348f,
+    -0.0329356492f, 0.0276544895f, -0.0836059451f, 0.0458444729f, 0.0426370949f, -0.029000055f, 0.178633094f, 0.0451877452f,
+    0.060442917f, -0.07601358f, 0.0570283718f, 0.108225346f, -0.103137955f, 0.0684611201f, -0.127693161f, 0.173961237f,
+    0.0696705133f, -0.045855388f, -0.184504062f, 0.0749076381f, -0.0355141535f, -0.0326450206f, -0.0777345076f, -0.0263698362f,
+    -0.287157416f, -0.0121189496f, 0.101439632f, 0.086586304f, 0.0406962f, 0.0355519764f, -0.276904881f, -0.0634743348f,
+    0.0262630917f, 0.170604855f, -0.0732830018f, 0.027483765f, 0.0538781695f, -0.0829280317f, 0.184211552f, -0.0406600945f,
+    0.0560920686f, -0.070138365f, 0.0469605699f, 0.135254428f, -0.0878607407f, -0.00835413951f, -0.135725901f, 0.134350523f,
+    -0.030836273f, -0.0937278867f, -0.192677662f, 0.0732692778f, 0.0265835784f, -0.0973559171f, -0.0436637364f, -0.0229414683f,
+    -0.23565267f, -0.017525835f, 0.0433970578f, 0.0504608825f, 0.106818751f, 0.052053865f, -0.0873837098f, 0.0268605147f,
+    -0.00572569063f, 0.057878837f, -0.087925151f, 0.0954439566f, 0.0643385351f, -0.0614788681f, 0.182304949f, 0.0373152569f,
+    -0.0163199045f, -0.0418156981f, 0.112980068f, 0.124924697f, -0.0861077979f, 0.0165685806f, -0.150691167f, 0.0606447794f,
+    -0.0506207719f, -0.000558821543f, -0.204054639f, 0.0515120476f, -0.0378805175f, -0.0666542351f, -0.0154790049f, 0.0557639189f,
+    -0.294114113f, -0.010206691f, 0.0774185136f, 0.127993748f, 0.106213652f, 0.091572389f, -0.158179462f, -0.0276593566f,
+    0.0292691067f, 0.0669795796f, 0.00805622246f, 0.0461762957f, 0.046335917f, -0.0945889875f, 0.138748839f, 0.0225739293f,
+    0.00684455642f, -0.0519368574f, 0.00449746335f, 0.0984047055f, -0.0850228146f, 0.0828455389f, -0.0786073431f, 0.133349642f,
+    0.00949462038f, -0.0454846807f, -0.159795716f, 0.0511993431f, 0.0322684497f, -0.117197789f, -0.0549869761f, 0.00894208159f,
+    -0.198015794f, -0.0194128193f, 0.106668197f, 0.152958572f, 0.0860365853f, 0.00835842919f, -0.283850849f, -0.0599745587f,
+    0.048176419f, 0.100021169f, 0.0391847081f, 0.0868101195f, 0.0159199089f, -0.0500843599f, 0.082041733f, -0.000978495111f,
+    0.00222575222f, -0.0924497768f, 0.0825278014f, 0.1194961f, -0.132098034f, 0.00167957856f, -0.130014509f, 0.0960462987f,
+    0.0285444539f, -0.0870207474f, -0.103581913f, 0.10672424f, -0.0278478526f, -0.0141744772f, -0.0760270581f, 0.0197022688f,
+    -0.242583439f, -0.0227047913f, 0.13257505f, 0.0691969916f, 0.030003259f, 0.027234029f, 0.00378271262f, -0.073991999f,
+    -0.0412042253f, 0.112542324f, -0.0266607255f, 0.0630786493f, 0.0617247261f, -0.0680227801f, 0.332295954f, 0.00546878437f,
+    -0.0122332079f, -0.139788806f, 0.0715043023f, 0.183606371f, -0.0790036172f, 0.0565480143f, -0.15966551f, 0.103643678f,
+    -0.0298081171f, -0.0477426536f, -0.198124126f, 0.117472388f, -0.00760663999f, -0.105774291f, -0.100406557f, 0.00671395008f,
+    -0.290878803f, -0.0220991671f, 0.146302134f, 0.134236887f, 0.0422404185f, 0.0579458028f, -0.165348366f, -0.0559154674f,
+    0.057214573f, 0.126335949f, -0.0442195199f, 0.0525210127f, 0.0250930842f, -0.0531378649f, 0.289026976f, -0.0157348681f,
+    0.0779010952f, -0.0784478858f, 0.067621991f, 0.0673231632f, -0.074452579f, 0.0628456473f, -0.127753586f, 0.225519165f,
+    0.0565239452f, 0.0200733393f, -0.132567883f, 0.137431145f, -0.0173636004f, -0.0519355722f, -0.0735981092f, -0.0295956489f,
+    -0.29696089f, -0.0160557013f, 0.125630438f, 0.0819636434f, 0.0539751612f, 0.136382461f, -0.246021852f, -0.0564489551f,
+    0.0434996933f, 0.0967569426f, -0.0626706481f, 0.0497912094f, 0.0319145471f, -0.0721504241f, 0.314755827f, 0.0107883448f,
+    0.12638396f, 0.103311419f, 0.222638994f, 0.0715999976f, 0.178109735f, 0.0602206215f, 0.222746208f, 0.187367946f,
+    -0.257508427f, 0.145693928f, 0.137291506f, 0.114591181f, 0.374187857f, 0.0772373453f, 0.113766246f, -0.176266536f,
+    0.336089611f, -0.163197562f, 0.287544429f, 0.178761587f, 0.164643154f, 0.213428035f, 0.402180135f, 0.0955499634f,
+    -0.134521335f, 0.221059904f, -0.0830279291f, 0.0433699824f, -0.137110099f, 0.101192065f, -0.183255106f, 0.186775535f,
+    0.136313245f, 0.0687387288f, 0.270529151f, 0.0118643399f, 0.0749437436f, -0.0603349991f, 0.103802845f, 0.18743743f,
+    -0.127816781f, 0.0612489656f, -0.000383446168f, 0.0574126206f, 0.307357252f, -0.125435829f, -0.0335565321f, -0.0656906217f,
+    0.160160393f, -0.14316465f, 0.234471917f, 0.136562422f, 0.134758994f, 0.0831239074f, 0.286465257f, 0.0614210181f,
+    -0.0246376973f, 0.0884869099f, -0.253428996f, 0.00835456885f, -0.089278385f, 0.196655333f, -0.29283157f, 0.0488777198f,
+    0.239353091f, 0.147583023f, 0.297895342f, -0.118549153f, 0.00386904692f, -0.19937031f, 0.0768104568f, 0.292173356f,
+    -0.0708424076f, -0.0607821383f, -0.00730422465f, -0.139593542f, 0.405967474f, -0.0605731271f, 0.0356340595f, -0.0526568517f,
+    0.204749733f, -0.141742244f, 0.345527351f, 0.130631521f, 0.213799968f, 0.187429607f, 0.089581795f, 0.0301164649f,
+    0.0697056428f, -0.106439598f, -0.11285916f, -0.0632312596f, -0.157838628f, 0.204229802f, -0.722230494f, 0.0824601501f,
+    0.058317896f, 0.0631866679f, 0.24147819f, -0.0613611266f, -0.00468307966f, -0.0715550631f, 0.0965947285f, 0.109312341f,
+    -0.307364583f, 0.0379395969f, -0.0630287603f, -0.0179221891f, 0.387708038f, -0.110796325f, 0.0490342975f, -0.180520415f,
+    0.173372984f, -0.263889998f, 0.267777026f, 0.0732276291f, 0.10765855f, 0.0972070843f, 0.208360463f, -0.0450170115f,
+    -0.213813826f, -0.0272774864f, -0.175784722f, 0.056908261f, -0.23564069f, -0.0880853757f, -0.157153159f, 0.0858609006f,
+    0.0372188538f, 0.102878653f, 0.255261749f, -0.0166048333f, -0.125180289f, -0.225926712f, -0.00650709262f, 0.062392734f,
+    -0.166242063f, -0.154053584f, -0.145421818f, 0.0780178905f, 0.367963523f, -0.0949616581f, -0.0436907597f, -0.126985326f,
+    0.104066588f, -0.136914343f, 0.250411481f, 0.0362795815f, 0.062716499f, 0.0696669146f, -0.108243071f, -0.00349142612f,
+    -0.135956749f, -0.0984703824f, -0.356778383f, 0.00145913474f, -0.196021602f, -0.0374680981f, 0.006209624f, 0.00906586554f,
+    0.106167868f, 0.0206089057f, 0.217755437f, -0.149833322f, -0.0386067219f, -0.21921885f, 0.0544144176f, 0.156045124f,
+    -0.13755247f, -0.116764665f, -0.0319665931f, -0.1965646f, 0.2810992f, 0.0762075037f, -0.0547129288f, -0.0451461002f,
+    0.124238029f, -0.185723603f, 0.26823476f, 0.0878517181f, 0.0348982625f, 0.0650058463f, 0.0403559394f, -0.0467389189f,
+    -0.0239127334f, -0.193006173f, -0.238848671f, -0.0546156354f, -0.227535576f, 0.151575238f, -0.518565536f, 0.0110232439f,
+    0.0965228602f, 0.0962533653f, 0.257702321f, -0.0483506694f, -0.0443806164f, -0.303099781f, 0.0886819884f, 0.20395261f,
+    -0.23994723f, -0.109429203f, -0.21304962f, -0.188891143f, 0.370241553f, -0.0998994485f, -0.0243405048f, -0.307635009f,
+    0.135718137f, -0.288284898f, 0.318333894f, 0.143966913f, 0.134904072f, 0.12717241f, -0.240811899f, -0.126507521f,
+    -0.21709618f, -0.271805793f, -0.352731824f, 0.104827903f, -0.36894092f, -0.0794127956f, -0.40087083f, 0.0260831341f,
+    0.174563736f, 0.0547585338f, 0.222142383f, -0.0157114901f, -0.220911294f, -0.434004605f, 0.0840842575f, 0.159526214f,
+    -0.189047575f, -0.194941938f, -0.182184324f, -0.235359162f, 0.349513352f, -0.0658784434f, 0.00163324759f, -0.289510369f,
+    0.0254879501f, -0.3000907f, 0.263785213f, 0.0861717761f, 0.00357423909f, 0.110747114f, -0.371432155f, -0.111479834f,
+    -0.194277778f, -0.2602956f, -0.428768545f, 0.0746708363f, -0.406518668f, -0.0279399417f, -0.154662132f, -0.0694615394f,
+    0.182134479f, 0.0268255491f, 0.209984809f, -0.113102347f, -0.110626854f, -0.29507643f, 0.0882841647f, 0.164932653f,
+    -0.159505561f, -0.0432411097f, -0.13881965f, -0.196389824f, 0.336873353f, 0.164020658f, 0.0149275148f, -0.203719109f,
+    0.065924868f, -0.23108612f, 0.259233534f, 0.114830673f, 0.0548412651f, 0.168198809f, 0.09621308f, -0.126069576f,
+    -0.206279695f, -0.182578877f, -0.24867487f, 0.0957468003f, -0.296495289f, -0.0442793332f, -0.383356154f, 0.0709787533f,
+    -0.0364967361f, 0.116936669f, -0.160385206f, -0.142415628f, 0.0332355686f, 0.364312917f, -0.121017493f, 0.17159389f,
+    0.0397462249f, 0.00643524248f, 0.11450047f, 0.113718517f, -0.304218322f, -0.0516951717f, 0.013363407f, -0.0729082152f,
+    -0.00444342569f, -0.0523237027f, -0.1319222f, 0.263113886f, 0.211797103f, 0.114715904f, -0.145566911f, -0.0898705572f,
+    0.0461262614f, 0.0615015514f, 0.626774371f, -0.0810640082f, -0.0338376202f, -0.0832283199f, 0.0264365617f, -0.04694774f,
+    -0.00911005493f, 0.089466162f, -0.196810812f, -0.0403502882f, -0.0614641383f, 0.225565061f, -0.185928956f, 0.0881332681f,
+    0.0447001122f, -0.0128073664f, 0.0270882882f, 0.0616181493f, -0.386560559f, -0.00280182809f, -0.0372480042f, 0.0060238149f,
+    -0.123930164f, -0.0218567103f, -0.218800247f, 0.187521726f, 0.17963919f, 0.130034402f, -0.196562812f, -0.0467287973f,
+    -0.0118915439f, 0.0626251921f, 0.542394638f, -0.0378428437f, 0.0239796508f, -0.0275325347f, 0.131072283f, -0.00325714098f,
+    -0.0515825301f, 0.0309031289f, -0.221298546f, 0.0140495971f, -0.0604784451f, 0.244164094f, -0.217583016f, -0.093550995f,
+    0.0534011908f, -0.16278249f, -0.0652103797f, 0.146802843f, -0.406481743f, -0.101170063f, -0.0099206185f, -0.00722704642f,
+    -0.337039381f, -0.024754094f, -0.387630194f, -0.0447529517f, 0.00580479158f, -0.0490253344f, -0.0955997482f, -0.0149224149f,
+    -0.000494437816f, 0.0328044519f, 0.38255018f, 0.0740279928f, 0.0925060138f, -0.0516875274f, 0.318790406f, -0.102711804f,
+    0.0357153863f, 0.0118033867f, -0.032226529f, -0.0622765012f, 0.044568859f, 0.277703941f, -0.119288027f, 0.168754071f,
+    0.0216317475f, 0.09302672f, 0.128565058f, 0.0402451418f, -0.13947688f, -0.0356291868f, -0.00323141878f, -0.0790035054f,
+    -0.0238065198f, -0.0399248078f, -0.0653078929f, 0.258548886f, 0.188946262f, 0.224570885f, -0.171364218f, -0.0709508434f,
+    -0.0464530513f, 0.037320964f, 0.698515236f, -0.107989989f, -0.0126825664f, -0.0404737964f, -0.109630704f, 0.0049481513f,
+    0.103091151f, 0.0415481105f, -0.0440168306f, 0.0528222024f, 0.0316407196f, 0.176770896f, -0.148154691f, 0.1166839f,
+    0.0718705803f, -0.0340294614f, 0.0752017051f, 0.0904002115f, -0.194865465f, -0.0753224343f, -0.0845181346f, -0.00409939792f,
+    -0.0147410771f, -0.0688040107f, -0.0707333535f, 0.124046631f, 0.241395086f, 0.192363873f, -0.286156863f, -0.040313419f,
+    -0.0817370489f, -0.0946039855f, 0.558838844f, -0.0655425638f, 0.0197295398f, -0.0689583346f, -0.0490427278f, -0.018470129f,
+    -0.0318007544f, 0.0712328777f, -0.235620856f, 0.0827348232f, -0.167730868f, 0.0727455467f, -0.261562526f, -0.0529810414f,
+    0.108030438f, -0.155447185f, -0.18918936f, 0.0209074598f, -0.456689477f, -0.133386672f, -0.0517500564f, -0.0126881562f,
+    -0.330319345f, -0.0352061912f, -0.266664714f, -0.0274574291f, 0.0251718424f, -0.0120622898f, -0.216344342f, 0.0229304135f,
+    0.0550160594f, -0.125834286f, 0.3243092f, 0.0677697212f, 0.0143653927f, -0.0796381161f, 0.0978254229f, -0.0015283844f,
+    0.081076771f, -0.0308907628f, -0.0700552985f, 0.0782326609f, 0.110744692f, 0.344113708f, -0.148417786f, 0.0111674806f,
+    0.196070939f, 0.0246229041f, 0.208740845f, 0.128178373f, -0.267956853f, -0.125185043f, -0.0608291142f, 0.0562155992f,
+    -0.0114295548f, 0.0317742266f, -0.140786693f, 0.19903405f, 0.136762351f, 0.0909533575f, -0.0630802736f, 0.0335534699f,
+    0.103446044f, 0.0269954875f, 0.711988211f, 0.0171233676f, 0.0345042683f, -0.0282667037f, 0.0560661927f, 0.00019709731f,
+    0.0329562239f, 0.0274765082f, -0.117477208f, 0.156236365f, 0.023664156f, 0.140916407f, -0.200948581f, 0.0565699227f,
+    0.123963311f, -0.0691319108f, -0.0227814373f, 0.110047251f, -0.333577752f, -0.231552064f, -0.0021443218f, 0.0405126475f,
+    -0.061945539f, 0.0509135351f, -0.264445662f, 0.0473928489f, 0.0781082734f, 0.156032756f, -0.180859447f, -0.00405999832f,
+    0.0260472056f, -0.08429607f, 0.551826298f, -0.053543061f, 0.00811000168f, 0.00360919535f, 0.0491396785f, 0.0268251766f,
+    -0.105723403f, 0.0778139308f, -0.274194449f, 0.190190554f, -0.228477538f, 0.0103390589f, -0.304975241f, -0.208503664f,
+    0.162761793f, -0.293512076f, -0.211451456f, 0.0447162278f, -0.452331215f, -0.262605011f, -0.0529080406f, 0.044242207f,
+    -0.295209706f, 0.0607436337f, -0.38092041f, -0.0985499099f, -0.0802647322f, -0.0439227447f, -0.0407136008f, -0.00814815424f,
+    0.0863780305f, -0.108460493f, 0.270010799f, 0.128499314f, 0.0325718671f, -0.0575296991f, 0.173574165f, -0.0609329082f,
+    0.0317174271f, -0.0944608152f, 0.0545366183f, 0.12764135f, -0.196808934f, -0.000662908191f, -0.249183863f, 0.0688419417f,
+    -0.0140543282f, -0.0776452348f, -0.289773405f, -0.0545408987f, -0.00929681491f, -0.0561284274f, 0.0108236354f, 0.0212084763f,
+    -0.342239201f, -0.00840683468f, 0.0477893353f, 0.0552985296f, 0.0937672779f, 0.0361323729f, -0.152937964f, -0.0326158442f,
+    0.0298740938f, 0.0681463256f, -0.152008951f, 0.115038857f, 0.0209815335f, -0.0343627855f, 0.164542794f, 0.0104632564f,
+    0.00460457196f, -0.0522881486f, -0.0512887165f, 0.132725224f, -0.192584604f, 0.026873203f, -0.162058055f, 0.0544417761f,
+    0.00546571938f, -0.019936109f, -0.191446334f, -0.0156562179f, -0.018186884f, -0.0270430464f, -0.052943565f, -0.00990922283f,
+    -0.412669361f, 0.0449652709f, 0.00973571558f, 0.120911658f, 0.0987416208f, 0.0673108846f, -0.192518562f, -0.0280636027f,
+    -0.0338651165f, 0.096542336f, -0.199668884f, 0.00795648806f, 0.0362155773f, -0.0410637781f, 0.106122077f, 0.0218975395f,
+    0.0433536246f, -0.0893634111f, 0.0620403215f, 0.0888040811f, -0.0432931818f, 0.0568379872f, -0.235020876f, 0.155051723f,
+    -0.0100510772f, -0.0380283967f, -0.146171495f, 0.0454064459f, 0.00275450409f, 0.0409254916f, -0.042338077f, -0.0545878708f,
+    -0.337304413f, 0.00570218544f, 0.0879459158f, 0.0772232935f, 0.0493917912f, 0.14227736f, -0.226279825f, -0.0520561598f,
+    -0.0556061082f, 0.13522999f, -0.0800822973f, 0.00137165422f, 0.00692501897f, -0.104953088f, 0.198695511f, 0.0430363491f,
+    0.0683942586f, -0.0465189442f, 0.0493456051f, 0.0855883807f, -0.11791645f, 0.0605861656f, -0.191403195f, 0.0871815905f,
+    0.0425411165f, -0.0430729315f, -0.177060902f, -0.0815333799f, -0.0531380028f, -0.0746182352f, -0.0345721394f, -0.0222361404f,
+    -0.269233793f, -0.039049495f, -0.00411691144f, 0.102523461f, 0.137133628f, 0.0575282238f, -0.00985100213f, 0.0390810817f,
+    0.0583353266f, 0.0969611183f, -0.0513426326f, 0.0011098464f, 0.0786031187f, -0.0895832777f, -0.0707133412f, 0.0139058782f,
+    -0.017253086f, -0.0786263421f, 0.0519154519f, 0.0250569917f, -0.0702952594f, 0.0108374534f, -0.211407319f, 0.086844556f,
+    -0.0693676248f, -0.0322192311f, -0.13409315f, -0.010216184f, -0.0858793259f, -0.0756604746f, -0.0294511169f, 0.0317272954f,
+    -0.248525053f, 0.0145880068f, 0.0519140512f, 0.0544644184f, 0.0333774984f, 0.0811093897f, -0.126471445f, -0.0491359085f,
+    0.0441917963f, 0.0793315396f, -0.121784434f, -0.0935963616f, 0.0253728982f, -0.0154670458f, -0.120228514f, -0.0313413627f,
+    0.0221029986f, 0.0081753321f, 0.0621188357f, 0.111823425f, -0.0233968832f, 0.0250907671f, -0.216753215f, 0.119670816f,
+    0.00874250103f, -0.0357957818f, -0.130446553f, -0.0191617329f, -0.0756778046f, -0.0609296188f, -0.116595365f, 0.0505314544f,
+    -0.190468803f, 0.0077734571f, 0.0453381948f, 0.175406843f, 0.126299784f, 0.0319284238f, -0.191335291f, 0.014052364f,
+    0.0549996682f, 0.076072149f, -0.0193773601f, -0.00537636224f, 0.0753452405f, -0.0575327873f, -0.0355872698f, 0.0403573029f,
+    0.0372868739f, -0.0991472602f, 0.0177841298f, 0.0891035348f, -0.0427974947f, 0.0804153755f, -0.158182323f, 0.106638901f,
+    -0.0326078534f, 0.016591914f, -0.192975551f, 0.159060702f, -0.0713160858f, -0.0507934391f, -0.145964831f, 0.00674916944f,
+    -0.328508198f, -0.0128637562f, 0.0729347467f, 0.0764102414f, 0.0867940187f, 0.0827566609f, 0.0527532063f, -0.078089945f,
+    0.0196992196f, 0.14758344f, -0.129449233f, -0.0557163581f, 0.0879094824f, -0.11675097f, 0.207793877f, 0.0537524074f,
+    0.0753392875f, -0.0845316425f, -0.0309220999f, 0.0587138273f, -0.103437737f, 0.105230026f, -0.197460383f, 0.129370585f,
+    -0.0235995483f, -0.00656558154f, -0.189208329f, 0.110601403f, -0.000620486098f, -0.000319836661f, -0.157565609f, -0.008849659f,
+    -0.344456285f, 0.0133395446f, 0.0229741111f, 0.117533036f, 0.0487538502f, 0.05692688f, -0.0521419011f, -0.131201595f,
+    0.0261963792f, 0.106914647f, -0.0746640861f, -0.0819024965f, 0.125714421f, -0.0301084518f, 0.183964804f, 0.0323964432f,
+    0.0364644527f, -0.0810809508f, 0.0545414723f, 0.12731497f, -0.0893351287f, 0.134223878f, -0.235278726f, 0.0983540863f,
+    0.0239504836f, 0.0111044254f, -0.204994977f, 0.143735558f, 0.0371190235f, -0.0641377941f, -0.0852114633f, 0.042660214f,
+    -0.203327611f, 0.0263020732f, 0.0529087894f, 0.13031131f, 0.112354405f, 0.0738715157f, -0.0606231727f, -0.0903720707f,
+    0.0746943429f, 0.134033412f, -0.0888159424f, -0.0906482935f, 0.103590973f, -0.0233563185f, 0.151203275f, -0.0546306968f,
+    0.0429710373f, -0.53509444f, -0.0601579212f, 0.172213733f, 0.0837835446f, -0.0699075386f, 0.130092859f, 0.0565791465f,
+    -0.0442003608f, 0.184860021f, 0.0556007996f, 0.111664921f, -0.0126321884f, 0.269254148f, -0.321669787f, 0.0157771073f,
+    0.14806664f, -0.00825147796f, 0.046347782f, 0.0574382022f, 0.0773063451f, 0.076694414f, -0.21724242f, -0.166651368f,
+    -0.0273590423f, 0.0115894256f, -0.275398642f, -0.178562209f, 0.0545860231f, 0.0207152218f, 0.158100739f, -0.0436718538f,
+    0.0848968849f, -0.372979611f, -0.0877855271f, 0.131741881f, 0.115709729f, -0.122401938f, 0.0178444646f, 0.0576136522f,
+    -0.0889138952f, 0.146418884f, -0.0399749912f, 0.0722434372f, -0.0758503601f, 0.144929737f, -0.265808135f, 0.0534147881f,
+    0.0122118667f, 0.0823122039f, -0.0367808938f, 0.0174407288f, 0.0686522648f, 0.0730105788f, -0.297521055f, -0.0581968129f,
+    0.0724675506f, 0.0192569457f, -0.222479343f, -0.216506824f, -0.0452966541f, -0.0540654138f, 0.0769058168f, 0.0122581413f,
+    0.0279137436f, -0.449965715f, 0.00698815705f, 0.131542549f, 0.235300288f, -0.0378413796f, 0.21078001f, 0.0817692429f,
+    -0.0336430036f, 0.284122556f, 0.0769118294f, 0.132484108f, -0.0440556593f, 0.178285167f, -0.281749278f, 0.0850541741f,
+    0.222104624f, 0.0819961354f, -0.0479350202f, 0.0778947398f, 0.165916368f, 0.147057652f, -0.469142646f, -0.154528573f,
+    0.0421672277f, 0.0222273655f, -0.112056985f, -0.157983825f, -0.0231074113f, -0.00625000428f, 0.112292841f, 0.0256371722f,
+    -0.019262718f, -0.365018606f, -0.0464705415f, 0.0193418879f, 0.122857332f, -0.111146435f, 0.184817776f, 0.0246970411f,
+    -0.0854043365f, 0.115795165f, 0.0515654907f, 0.0987028405f, -0.0834357291f, 0.234358206f, -0.250176609f, 0.0557095706f,
+    0.145795494f, -0.0212183837f, 0.000819073466f, 0.00597216189f, 0.145780429f, 0.0192415416f, -0.204945251f, -0.103349708f,
+    -0.0429371968f, 0.0258006118f, -0.290188581f, -0.232028976f, -0.00641047396f, -0.0226797368f, 0.065268822f, 0.0540501103f,
+    -0.0191308651f, -0.249541417f, -0.0504116975f, -0.0143678971f, 0.000246662588f, -0.115881145f, -0.0140993502f, 0.0157647934f,
+    -0.0587460585f, 0.123557344f, 0.0251579434f, 8.96504498e-05f, -0.0445211232f, 0.0632051453f, -0.217346892f, 0.0943531245f,
+    0.0255644135f, 0.0128259175f, -0.0892929435f, 0.02925862f, -0.0348970406f, 0.00946037192f, -0.288455069f, -0.0544868037f,
+    0.0161015969f, -0.0468989201f, -0.248203173f, -0.170223236f, -0.0149381543f, 0.0502833351f, -0.0350332744f, -0.0668718964f,
+    -0.0291543137f, -0.293949544f, -0.135222897f, 0.0104045207f, 0.134667382f, 0.104768731f, 0.163899764f, 0.0261730347f,
+    -0.0450552516f, 0.144347131f, 0.197203413f, 0.0887135416f, -0.0189162269f, 0.204050615f, -0.251068741f, -0.00489760935f,
+    0.143769711f, 0.0323130116f, -0.0735071227f, 0.0933297276f, 0.0125617729f, 0.0188261252f, -0.46347183f, -0.0278450828f,
+    0.0457299836f, 0.0114030438f, -0.042198848f, -0.254142851f, 0.0489983484f, -0.0347539373f, 0.0706668943f, -0.0222941674f,
+    -0.0154279927f, -0.450166076f, -0.104443498f, -0.00982719939f, 0.147118643f, -0.100978866f, 0.154700652f, 0.104720078f,
+    -0.109156355f, 0.203258082f, 0.082339257f, 0.231234342f, -0.0979877338f, 0.257178485f, -0.272078246f, 0.0520486087f,
+    0.249420881f, 0.0192801226f, -0.0754240602f, 0.0563505888f, 0.161636204f, 0.141082838f, -0.215732917f, -0.131052271f,
+    -0.017743038f, 0.0349990129f, -0.267528564f, -0.287280172f, 0.0917468444f, 0.023364462f, 0.217352092f, 0.0740953013f,
+    -0.0223702043f, -0.250718802f, -0.0716225356f, -0.0895059705f, 0.102971666f, -0.0620671809f, 0.0566619486f, 0.0559818745f,
+    -0.0692824498f, 0.0774917454f, -0.016964715f, 0.201533511f, -0.0545333102f, 0.143900841f, -0.157168195f, 0.0878102854f,
+    0.105757691f, 0.000536268752f, -0.0603625625f, 0.106729373f, 0.00522530125f, -0.00504837139f, -0.268349051f, -0.0544863865f,
+    -0.0181641001f, 0.012375881f, -0.219501853f, -0.285494357f, 0.0375832804f, -0.0556503274f, 0.14613618f, 0.020796543f,
+    0.000999135198f, -0.321135402f, -0.104667678f, -0.114756182f, 0.274156958f, 0.0612862259f, 0.173435703f, 0.0154166371f,
+    -0.0413875692f, 0.220102757f, 0.16688934f, 0.204192445f, -0.058584325f, 0.211713195f, -0.251982987f, 0.0284060799f,
+    0.210009858f, 0.0346895382f, -0.0798113123f, 0.17960602f, 0.0837687403f, 0.0878798813f, -0.36697948f, -0.0422559977f,
+    0.0408127457f, 0.133050188f, 0.00548765389f, -0.18734175f, 0.0828048363f, -0.0650635958f, 0.204872027f, 0.0424548313f,
+    0.110062689f, 0.130853504f, 0.111269772f, 0.0969623104f, -0.361581564f, -0.119279958f, 0.0227879696f, 0.0209962167f,
+    0.0913502574f, -0.43132177f, -0.308114737f, -0.225381374f, 0.168681905f, -0.232411757f, -0.0089136241f, 0.0961395726f,
+    -0.184169605f, 0.0100269709f, 0.175832838f, -0.196664751f, 0.0849597529f, 0.0766310841f, -0.397725821f, 0.0327991955f,
+    0.122756213f, -0.302720279f, -0.132390812f, 0.0158842355f, -0.00301155425f, 0.137404919f, -0.446471393f, -0.0328333415f,
+    0.0520644113f, 0.0711772144f, 0.101255283f, 0.202019334f, -0.106411368f, 0.0280854329f, -0.0275446866f, -0.0244011581f,
+    0.0614426658f, -0.0552872084f, 0.0755526572f, -0.116922349f, 0.118363716f, -0.160774305f, -0.0251050461f, 0.0141120423f,
+    0.13498114f, 0.00883723982f, 0.0629717931f, -0.027346991f, 0.0662528872f, 0.0204665326f, -0.19810243f, -0.0639477968f,
+    0.114042915f, -0.0824398026f, 0.27301988f, -0.0149606727f, -0.059343189f, 0.155047789f, -0.220253438f, 0.0464448445f,
+    0.157226101f, 0.0484753288f, 0.218343541f, 0.250054181f, 0.0413336009f, 0.160444885f, 0.0218926966f, -0.0583633967f,
+    0.121671639f, 0.0616349019f, 0.174244881f, 0.0926831439f, 0.247651562f, -0.213682473f, -0.0574115813f, 0.136507884f,
+    0.105026245f, 0.0173056666f, 0.16575408f, 0.124473989f, 0.155498996f, 0.0879471824f, 0.0616234168f, -0.0356690772f,
+    0.0935075283f, -0.00113704149f, 0.383951306f, -0.0175695252f, -0.0402645469f, 0.146664217f, -0.369548947f, 0.0101227444f,
+    0.00131058518f, 0.149018139f, 0.0218897965f, 0.00804743357f, -0.380129129f, -0.114623442f, -0.029179303f, -0.0688541681f,
+    0.0873952359f, -0.287727177f, -0.159676343f, -0.314492583f, 0.199776828f, -0.271808714f, -0.0144366808f, -0.00770470919f,
+    -0.0722403973f, -0.0392460488f, 0.0688131675f, -0.143731594f, -0.00336513924f, -0.0202445872f, -0.450328112f, 0.0395667478f,
+    0.0846705884f, -0.212965205f, 0.12384934f, -0.00972612575f, -0.0186491944f, 0.192848846f, -0.603896558f, 0.0744863227f,
+    -0.0527147204f, 0.113960519f, 0.0393896289f, -0.0043239072f, -0.0977430344f, 0.129946813f, 0.06220733f, -0.0422144569f,
+    0.0850041881f, -0.019432269f, 0.129159853f, -0.145558685f, 0.136138856f, -0.186435938f, -0.00904054474f, 0.0761173889f,
+    0.173065498f, -0.0358048975f, -0.0113995848f, -0.0787750781f, 0.0170037039f, -0.0950364396f, -0.145316556f, 0.00498973019f,
+    0.0983870551f, -0.0935441554f, 0.383686036f, -0.00188106834f, -0.0262334738f, 0.126184493f, -0.347348899f, 0.00208235881f,
+    -0.0134101715f, 0.0128065227f, 0.0652132854f, 0.0706815347f, 0.0842463672f, 0.125120685f, 0.126302958f, -0.110234536f,
+    0.117988192f, 0.132592842f, 0.201714396f, -0.00128805812f, 0.169572517f, -0.192840576f, -0.073538579f, 0.108619243f,
+    0.239700496f, 0.028086219f, 0.120108813f, 0.101055264f, 0.0466044061f, -0.0291356407f, 0.0433223993f, -0.00577281183f,
+    0.12107823f, 0.0129166404f, 0.305401027f, -0.0343609005f, 0.00671555195f, 0.114292599f, -0.212475345f, -0.0150951836f,
+    -0.0378068946f, 0.135751128f, 0.0418907963f, -0.182212174f, -0.235655725f, 0.0264628027f, 0.0416049473f, -0.030059373f,
+    0.0658779517f, -0.156711102f, 0.049649097f, -0.35818404f, 0.0969495177f, -0.453417867f, 0.00946553051f, 0.0498852655f,
+    0.185267165f, -0.0245266892f, 0.00660850946f, -0.0140157938f, 0.0802967399f, -0.00303969812f, -0.284492612f, 0.102587245f,
+    0.106885731f, -0.14877212f, 0.355419666f, -0.115584649f, -0.0293327011f, 0.100278035f, -0.781930506f, 0.0275377445f,
+    0.0117255747f, 0.170290828f, 0.090876326f, -0.137318701f, 0.0139015615f, 0.0915409103f, 0.0235765744f, 0.0364288166f,
+    0.103655092f, -0.0998902023f, 0.057120733f, -0.0634441748f, 0.129612118f, -0.397857845f, 0.0603075065f, 0.052527938f,
+    0.135650277f, -0.049436152f, 0.0112513807f, 0.0657334924f, 0.0510188602f, -0.0729486048f, -0.158943519f, -0.00493736798f,
+    0.0696036965f, -0.0737630948f, 0.402223259f, -0.0723058134f, -0.00285258982f, 0.149909392f, -0.389159679f, 0.0808577463f,
+    -0.0397353917f, 0.132413387f, 0.0310807992f, -0.0718367696f, 0.0755723864f, 0.144900814f, 0.123730436f, -0.0463317633f,
+    0.0730594024f, 0.0965781808f, 0.116459347f, -0.0326618925f, 0.132140756f, -0.208318606f, -0.0613025948f, 0.0804765373f,
+    0.0819861144f, 0.0916483104f, 0.0503076501f, 0.13184464f, 0.104229473f, -0.0111979684f, 0.0815867335f, 0.0526942387f,
+    0.14265959f, 0.028782798f, 0.363910228f, -0.0577771291f, 0.00706044212f, 0.112813354f, -0.2064033f, 0.0359903872f,
+    0.044552058f, -0.385020256f, -0.325429022f, 0.0255952999f, 0.112660676f, -0.0459740162f, 0.0475169942f, 0.054678835f,
+    -0.0352312848f, 0.116439663f, -0.0367134549f, -0.0119557781f, -0.332088202f, 0.299015939f, -0.195157871f, 0.0924782008f,
+    0.0167193525f, 0.0389707759f, -0.277124316f, 0.101736665f, 0.1336364f, 0.0324325375f, -0.128671005f, -0.0801389664f,
+    -0.00842432585f, -0.0269432403f, -0.134548575f, -0.0768295974f, 0.0729640424f, -0.0772102252f, 0.127544269f, -0.0583373569f,
+    0.020967165f, -0.369417518f, -0.328950018f, 0.0727623627f, 0.0087470673f, -0.0384458005f, -0.00270841084f, 0.0316645056f,
+    0.00252883183f, 0.0148801077f, 0.0184415709f, -0.117459744f, -0.29318133f, 0.260942668f, -0.272923052f, 0.0545843095f,
+    -0.149043158f, 0.0886308551f, -0.222400948f, 0.0184803121f, 0.10528104f, 0.168401614f, -0.191182271f, -0.0169966277f,
+    -0.0140063111f, -0.0675993115f, -0.052993834f, -0.0824372694f, 0.0174296889f, -0.00899336487f, 0.0042000562f, -0.0589129068f,
+    0.0736109838f, -0.329016209f, -0.25482741f, -0.0260568969f, 0.136392668f, 0.0773001909f, 0.107327439f, 0.0976200774f,
+    0.00710032322f, 0.174114615f, 0.087519601f, -0.0395875499f, -0.36928302f, 0.265812784f, -0.304533452f, 0.0660658255f,
+    0.0321740024f, 0.0186193511f, -0.199739352f, 0.132406533f, 0.107844979f, 0.214469686f, -0.350810111f, -0.0906090289f,
+    -0.00493521011f, -0.0199566502f, -0.00538301421f, -0.0620785058f, 0.0608330555f, -0.117621213f, 0.101374425f, -0.0862411261f,
+    0.00273189135f, -0.30235374f, -0.303238541f, 0.0350230336f, 0.0066657518f, -0.102175191f, 0.0961656719f, 0.141960114f,
+    -0.0945867524f, 0.0839256495f, 0.0261707287f, -0.00336341653f, -0.385234624f, 0.232116669f, -0.251240879f, 0.0119468495f,
+    -0.0356782414f, 0.0484922379f, -0.298069984f, 0.0772683397f, 0.127510965f, 0.160579666f, -0.177463055f, -0.061128065f,
+    -0.021864932f, -0.0691621378f, -0.147551805f, -0.111865073f, 0.0193106215f, -0.0188330784f, 0.0430095866f, -0.00924500916f,
+    0.0569248423f, -0.141052634f, -0.317560405f, -0.00728993258f, -0.00634301826f, -0.0947723538f, -0.0542953536f, 0.153825685f,
+    -0.0118142935f, 0.0436626896f, -0.0162224341f, -0.0500202775f, -0.294759691f, 0.179886132f, -0.102592908f, -0.0107070645f,
+    -0.0654969588f, -0.0434844829f, -0.141420618f, 0.160402462f, 0.188019171f, 0.183765739f, -0.265213102f, 0.00239311415f,
+    0.0583076738f, -0.080541186f, -0.120455116f, -0.117045179f, -0.0467745177f, -0.0375587419f, -0.092419304f, -0.122732677f,
+    0.0922005475f, -0.102206215f, -0.291457385f, -0.0428907014f, 0.0868660137f, 0.0521208532f, 0.0441128537f, 0.19130531f,
+    -0.0377014503f, 0.153592542f, 0.122764476f, -0.0831567645f, -0.34234941f, 0.204283327f, -0.195859507f, 0.0669796318f,
+    -0.0247463323f, 0.0556025468f, -0.128645182f, 0.142364427f, 0.222375825f, 0.190409228f, -0.307086706f, -0.100329943f,
+    -0.0387476608f, 0.0193942487f, 0.0371909216f, -0.0797891095f, 0.0547062419f, -0.0118252728f, -0.0380227305f, -0.0628344268f,
+    0.0217996072f, -0.45039317f, -0.358446747f, -0.0524961576f, 0.00890560076f, -0.0518774278f, 0.107999593f, 0.00349501241f,
+    -0.0389550366f, 0.16109775f, -0.024808472f, 0.279778808f, -0.446799457f, 0.254986674f, -0.276762277f, 0.0415551886f,
+    0.102772094f, 0.0666014254f, -0.318543285f, 0.0933274105f, 0.0905583575f, 0.185965464f, -0.144396335f, -0.102535598f,
+    -0.0371553935f, -0.0380044207f, -0.132296249f, -0.134970546f, 0.0897191837f, -0.0177795105f, 0.22319746f, -0.0793120638f,
+    -0.00628925581f, -0.157724157f, -0.315324515f, -0.0593636781f, 0.0433202982f, -0.0477499701f, 0.0132897357f, 0.140559956f,
+    -0.0595210865f, 0.0646652207f, 0.0106002744f, 0.114107281f, -0.452571988f, 0.202706471f, -0.110770583f, -0.0257028192f,
+    -0.000788339064f, 0.0194610301f, -0.164592534f, 0.166150704f, 0.122711778f, 0.167787179f, -0.259896368f, -0.140062511f,
+    -0.0323606767f, 0.0235159267f, -0.0529617369f, -0.154263437f, 0.018290529f, -0.0805223212f, 0.127232626f, -0.0811960772f,
+    -0.0220822599f, -0.266513199f, -0.293027252f, -0.0162260626f, 0.13440764f, 0.191974297f, 0.137706563f, 0.0755100176f,
+    -0.0314466357f, 0.194912702f, 0.193625629f, 0.15643537f, -0.436004639f, 0.207361892f, -0.222089365f, 0.0793683231f,
+    0.00238308357f, 0.0396608971f, -0.181706816f, 0.104357563f, 0.146888301f, 0.225411355f, -0.198404878f, -0.168599382f,
+    3.74265401e-05f, 0.0753754526f, 0.126014248f, -0.0950354487f, 0.103173397f, -0.0734385028f, 0.19995743f, 0.0130139403f,
+    0.0450451002f, -0.00576690119f, 0.0360103063f, 0.137924418f, -0.103156321f, 0.0907798707f, -0.221934423f, 0.146898255f,
+    0.0955412015f, -0.144719675f, -0.0889518559f, -0.0183193702f, -0.0278362837f, -0.135469794f, -0.0625937507f, -0.0347928107f,
+    -0.270262629f, -0.00547156809f, 0.0647899434f, 0.0183486547f, 0.0786937252f, 0.0986676216f, 0.0313409828f, 0.00569575513f,
+    0.00573774427f, 0.0806091726f, 0.175690234f, 0.111483522f, 0.00338313705f, -0.0320236534f, 0.0674857721f, -0.00892299786f,
+    0.0940036625f, -0.00269992277f, 0.0945040062f, 0.0686045364f, -0.136505634f, 0.0770623535f, -0.195853904f, 0.122751996f,
+    0.0579670705f, -0.144493312f, -0.140815184f, -0.0233811513f, -0.0815219432f, -0.0748560652f, -0.0760778636f, 0.019554561f,
+    -0.306632429f, 0.0517856665f, 0.00310014468f, 0.10713017f, 0.0806138813f, 0.0447746031f, -0.129997894f, -0.0521208644f,
+    0.00508273952f, 0.014429329f, 0.205302179f, 0.147338688f, -0.0269533955f, 0.00175547809f, 0.0712690949f, 0.0337008238f,
+    0.117926657f, -0.0972566977f, 0.0660222545f, 0.08520969f, -0.0698065609f, 0.0866368264f, -0.164949149f, 0.153129756f,
+    0.0893927217f, -0.0877874419f, -0.0899151415f, 0.0225245766f, -0.0157139935f, -0.128437608f, -0.0745000914f, 0.0211894382f,
+    -0.218036309f, -0.0224025752f, 0.0856296867f, 0.0836164132f, 0.0608290806f, 0.0609204434f, -0.0824530646f, -0.0630092546f,
+    0.0358601101f, 0.0644163787f, 0.277471066f, 0.146359071f, 0.0439095348f, -0.0889148265f, 0.107031442f, -0.0161886141f,
+    0.0182593446f, -0.0284367967f, 0.0743580088f, 0.11940635f, -0.0389569513f, 0.145652115f, -0.175547734f, 0.164398864f,
+    0.0377130657f, -0.109635599f, -0.121265821f, -0.013288565f, -0.0970753506f, -0.107175574f, -0.0574150197f, -0.00876301527f,
+    -0.189722687f, -0.0270070992f, 0.0311723333f, 0.0774373189f, 0.0454023443f, 0.105836786f, 0.0506801382f, -0.0516168997f,
+    0.0598029383f, 0.0472831577f, 0.214077279f, 0.224083424f, 0.0232960638f, -0.0796786919f, 0.0853846669f, -0.0407794639f,
+    0.00387219735f, -0.0690997839f, 0.0448246151f, 0.0260252617f, -0.0693127364f, 0.0691249743f, -0.115007438f, 0.169437766f,
+    0.0817962512f, -0.112204507f, -0.138685927f, 0.0630065873f, -0.0548841096f, -0.152237043f, -0.0331654623f, 0.0161157865f,
+    -0.210349217f, 0.0359982997f, -0.0136966733f, 0.0142034385f, 0.0628767386f, 0.00346452603f, -0.0807507187f, -0.0270274412f,
+    0.0708425269f, -0.00619823998f, 0.267476052f, 0.180285081f, -0.0084417602f, -0.0489253923f, 0.105095007f, 0.0179604441f,
+    0.0676889271f, -0.0927249938f, 0.0779755488f, 0.0505991727f, -0.10725572f, 0.0808026195f, -0.105528019f, 0.175173372f,
+    0.070161514f, -0.079483062f, -0.13662757f, 0.0815784931f, -0.101323031f, -0.11464569f, -0.122622125f, -0.0402404964f,
+    -0.248412579f, 0.0323513858f, 0.0107080452f, 0.0638222322f, 0.0259386729f, 0.0956534371f, -0.102863394f, -0.0567348562f,
+    0.0925630108f, -0.0182838179f, 0.228328958f, 0.106033131f, 0.0600926131f, -0.0414281972f, 0.00529808039f, -0.0387182683f,
+    0.0293776803f, 0.0130317397f, -0.00406503351f, 0.138979495f, -0.0935972705f, 0.144787788f, -0.214071393f, 0.148606285f,
+    0.0626967624f, -0.0532529689f, -0.0448970236f, 0.115860514f, -0.00526862545f, -0.137453794f, -0.0592720769f, -0.0106647704f,
+    -0.269949347f, -0.0346410796f, 0.01571339f, 0.0497977771f, 0.0842659324f, 0.0797699988f, 0.00277821021f, -0.0176773481f,
+    0.0443298966f, 0.0307192691f, 0.24005121f, 0.24890326f, -0.0230558887f, 0.0171410143f, 0.161196351f, 0.0303676333f,
+    0.0225597452f, -0.0552028157f, 0.0773448944f, 0.167927697f, -0.125676647f, 0.0709415823f, -0.15767999f, 0.18595086f,
+    0.00037706396f, -0.0404878743f, -0.0547887757f, 0.118964709f, -0.0710349604f, -0.111668117f, -0.0510999225f, -0.0546175763f,
+    -0.285329163f, 0.00677189324f, 0.0540643968f, 0.00514914468f, 0.0159688722f, 0.0446913205f, -0.0273680054f, -0.0938007981f,
+    -0.0012860531f, 0.0153940022f, 0.265829116f, 0.200749621f, 0.0582486615f, -0.0546647534f, 0.132359207f, -0.0419523008f,
+    0.0914042816f, -0.0228531845f, 0.0978000611f, 0.105499275f, -0.051513616f, 0.126960397f, -0.223931849f, 0.158355236f,
+    0.0803148672f, -0.107748188f, -0.106681898f, 0.079663597f, -0.00900532585f, -0.161441043f, -0.115024567f, 0.0315571837f,
+    -0.21616517f, -0.030933097f, 0.0185955819f, 0.125506252f, 0.0966499746f, 0.0269339681f, -0.0175144132f, -0.0979354978f,
+    0.0355448239f, 0.000822286762f, 0.22804983f, 0.104825966f, 0.0841326565f, 7.45545694e-05f, 0.140384182f, -0.0205195937f,
+    0.065383628f, 0.000982761267f, 0.166487589f, 0.0882975981f, -0.172454476f, -0.35294798f, 0.175699219f, 0.153229892f,
+    0.0113414787f, -0.154715419f, -0.13890478f, -0.25215736f, 0.459627748f, 0.0560450479f, -0.0350059234f, 0.0882879198f,
+    -0.00799200404f, 0.112070747f, 0.5447402f, -0.217073858f, -0.0240291506f, 0.0790463835f, -0.0126623828f, 0.0163270906f,
+    0.0817106292f, -0.105214536f, -0.523380637f, 0.032683529f, 0.0470311604f, 0.142158628f, -0.197136879f, 0.06502489f,
+    0.0605068468f, -0.00288688461f, 0.0961178541f, 0.0810239092f, -0.0683778301f, -0.105622262f, 0.239888594f, 0.0382729582f,
+    0.0619603805f, -0.0408471823f, 0.00437696604f, -0.14824371f, 0.324370533f, 0.172549412f, 0.0199656188f, 0.0187507197f,
+    0.0138316592f, -0.00378561672f, 0.361824304f, -0.141778991f, -0.0955287069f, 0.0327430815f, 0.115603998f, -0.00502766483f,
+    0.00872779172f, -0.105615683f, -0.142203763f, 0.117293425f, -0.0146584166f, 0.101063304f, -0.0947919786f, 0.0904199257f,
+    -0.0455060117f, 0.0991085693f, 0.102333814f, 0.0776574612f, 0.112934284f, -0.0561676323f, 0.134132639f, -0.16527611f,
+    0.0308373217f, 0.0336883739f, 0.0871828049f, -0.133997813f, 0.123186186f, 0.231612116f, 0.0667916536f, -0.0033828388f,
+    0.0173708797f, 0.02033359f, 0.089167662f, -0.092604965f, -0.16478084f, -0.139307797f, 0.314462006f, 0.0874718428f,
+    0.0643442348f, 0.033725366f, -0.0838824287f, 0.13339071f, -0.0599002577f, 0.0846513361f, -0.125370219f, 0.151554883f,
+    0.0636340678f, -0.0301841926f, 0.0762860328f, 0.091514118f, 0.0174900554f, -0.205197722f, 0.2087951f, 0.0202209335f,
+    0.0883924291f, -0.0330403708f, -0.0692664161f, -0.219264761f, 0.105631135f, 0.148234412f, -0.0448846519f, 0.0701443925f,
+    0.103486367f, 0.0864420161f, 0.311695695f, -0.161304727f, 0.0524363928f, -0.0503026955f, 0.0514411777f, -0.00463177357f,
+    0.0602817237f, -0.0619936399f, -0.382051677f, 0.111301892f, 0.0590265989f, 0.0801521167f, -0.200298518f, 0.0542941242f,
+    0.0300713573f, 0.0396790542f, 0.0391258262f, 0.121362336f, 0.00793587789f, 0.012478332f, 0.158787027f, -0.0887039155f,
+    -0.0106274895f, 0.0560701936f, 0.0917776227f, -0.150278926f, -0.0131673235f, 0.138240486f, 0.096980162f, 0.105647273f,
+    0.0465241745f, 0.00221739267f, 0.0876228511f, -0.149448112f, 0.0108420933f, -0.0285852086f, 0.178143859f, 0.0169571955f,
+    0.0648874789f, -0.0319833532f, -0.0870729908f, 0.103570275f, 0.0511579812f, 0.165125042f, -0.184696317f, 0.169870764f,
+    -0.0511022694f, 0.141398892f, -0.0677735135f, 0.0588629469f, 0.128018379f, -0.0214145426f, 0.129009932f, -0.283857226f,
+    -0.0116890036f, 0.0559746809f, 0.0257172734f, -0.0902874619f, -0.0164815057f, 0.111281559f, 0.067155391f, 0.0227691848f,
+    0.0844656676f, 0.0902991816f, -0.0495300665f, -0.186929032f, -0.149807334f, -0.136852354f, 0.210880026f, 0.134362429f,
+    0.0909258649f, 0.0881840214f, -0.0876619518f, 0.118532792f, -0.0480566323f, 0.106774002f, -0.203086555f, 0.133653447f,
+    0.0854671448f, 0.00386233837f, -0.0231999867f, 0.105849095f, 0.0354482159f, -0.0692569315f, 0.280134529f, -0.00462821964f,
+    -0.00926333666f, 0.0709306449f, 0.0904779285f, -0.0913652331f, -0.0908067748f, 0.130791739f, 0.038938649f, 0.03135252f,
+    0.193346068f, 0.0276343562f, -0.02820215f, -0.00912624598f, -0.0146365874f, -0.0124397976f, 0.0862434357f, 0.0270831175f,
+    0.128872499f, 0.060811881f, -0.228392467f, 0.109789275f, 0.0787058026f, 0.153301865f, -0.26806128f, 0.0695931539f,
+    0.0704383776f, 0.0648710579f, 0.0133203967f, 0.0597532392f, 0.0752428174f, -0.00237167161f, 0.171544403f, -0.0446571857f,
+    0.0641905665f, 0.127911061f, 0.126782507f, 0.0244775452f, -0.0277693179f, 0.146247745f, 0.0913714543f, 0.00327666127f,
+    0.14139235f, 0.0795186237f, -0.0729644224f, -0.0830459595f, 0.00787146389f, -0.0294952728f, 0.265654027f, 0.0312140696f,
+    0.00662384322f, 0.0814172626f, -0.0606612191f, 0.0822736248f, 0.00363180949f, 0.156555444f, -0.216308221f, 0.116168171f,
+    0.0294814631f, 0.159759402f, 0.0344074555f, 0.0361560211f, 0.0157883186f, 0.0162057709f, 0.199002847f, -0.0945308357f,
+    0.061073266f, 0.0465115756f, 0.0322088674f, 0.000846323732f, 0.0293840431f, -0.0137708075f, 0.121523872f, 0.0615985133f,
+    -0.00851458311f, 0.0828720108f, -0.00722843222f, -0.0817101151f, -0.105265178f, -0.147307858f, 0.273487687f, 0.138556823f,
+    0.0247344784f, 0.0659291521f, -0.0889883116f, 0.130316034f, -0.0303356685f, 0.126984641f, -0.255142331f, 0.146423683f,
+    0.108037166f, 0.00203560689f, 0.201527044f, 0.233549744f, -0.143860012f, 0.0328551009f, -0.111226931f, 0.267538637f,
+    0.000455433968f, -0.0299026985f, -0.189673588f, 0.0725206509f, 0.20525299f, -0.0733083412f, 0.00642003911f, -0.00602917187f,
+    -0.239890918f, -0.0277197678f, 0.233633101f, 0.137530699f, 0.119229347f, 0.114715971f, -0.309239566f, -0.0325710252f,
+    0.00393043552f, 0.107587621f, -0.205557033f, 0.0448451862f, -0.0563209318f, -0.0671120062f, 0.246727645f, 0.06478104f,
+    -0.0269183852f, -0.0358421504f, 0.170591235f, 0.122898698f, -0.125461191f, -0.0334343128f, -0.0954048038f, 0.293751419f,
+    0.00899508502f, -0.0620015115f, -0.201225579f, 0.0602747612f, 0.173388779f, -0.136593193f, -0.0355862975f, -0.0376493223f,
+    -0.25327915f, -0.000908626535f, 0.299224406f, 0.0760446414f, 0.0783265755f, 0.0675825998f, -0.399270028f, 0.000727191393f,
+    0.00645256322f, 0.0326225758f, -0.182557195f, 0.0724330544f, -0.0487187169f, -0.0291936509f, 0.21391958f, 0.00883374736f,
+    0.00837834086f, -0.0411588475f, 0.128748342f, 0.098644048f, -0.0425722674f, -0.0143192783f, -0.0781031102f, 0.264423072f,
+    -0.0385203324f, 0.0239975583f, -0.106039755f, 0.124074429f, 0.243724868f, -0.13809979f, -0.0578586608f, -0.0062957285f,
+    -0.146305516f, 0.0211053863f, 0.223616809f, 0.182076052f, 0.1265295f, 0.158526137f, -0.308088452f, -0.0270110313f,
+    0.00738991005f, 0.065072529f, -0.142861888f, -0.00425614091f, -0.0318883918f, -0.0417899191f, 0.256760806f, 0.064281255f,
+    0.0277958196f, 0.00768373441f, 0.172649801f, 0.150507003f, -0.0636582598f, -0.0142570417f, -0.142780691f, 0.235131532f,
+    -0.0469396822f, -0.0440695584f, -0.0980435982f, 0.0726087466f, 0.190391943f, -0.0558595397f, -0.000845637522f, -0.0438894555f,
+    -0.252354741f, -0.0483710803f, 0.274972975f, 0.130240679f, 0.054269962f, 0.050090272f, -0.205883846f, -0.0231906194f,
+    0.0321784988f, 0.0653831586f, -0.126262948f, -0.078644082f, 0.0057144789f, -0.0783777684f, 0.211218759f, 0.00766942045f,
+    0.0550557822f, -0.12132214f, 0.129256263f, 0.0451908223f, -0.133267894f, 0.0548787974f, -0.205854237f, 0.234778732f,
+    -0.00934481621f, -0.0489026345f, -0.149437755f, 0.106119767f, 0.21890831f, -0.179410368f, -0.0550004914f, 0.0413447507f,
+    -0.218559876f, 0.0536458194f, 0.19156611f, 0.0891678482f, 0.0310541634f, 0.0153319864f, -0.194009289f, -0.0280099101f,
+    -0.0165808052f, 0.117372096f, -0.158394337f, -0.0857175514f, -0.0317495875f, -0.00714022107f, 0.181287244f, -0.0307204966f,
+    -0.0275486391f, -0.0457956567f, 0.111318298f, 0.0674153715f, -0.0618425459f, 0.0857690126f, -0.14552936f, 0.233296543f,
+    -0.0141904019f, 0.00486667408f, -0.197554797f, 0.0420132652f, 0.158334628f, -0.182302058f, -0.0230284296f, 0.0572533235f,
+    -0.216900095f, -0.0236130934f, 0.24260278f, 0.164165229f, 0.00718603842f, 0.12392097f, -0.253396958f, -0.0557045974f,
+    0.0466598123f, 0.0685643405f, -0.0480388477f, -0.0801061094f, 0.0654541329f, -0.06761612f, 0.22058253f, -0.014769014f,
+    0.0195057429f, -0.175296903f, 0.105574436f, 0.109407626f, -0.0686375722f, 0.0338770673f, -0.169535637f, 0.317296654f,
+    -0.0628794059f, -0.0650837719f, -0.118267208f, 0.251795381f, 0.233015031f, -0.0515306965f, -0.0229614098f, 0.029846115f,
+    -0.201566219f, 0.0600243695f, 0.27680707f, 0.161256582f, 0.0448736064f, 0.0652438775f, -0.0764489919f, -0.113500744f,
+    0.0260093771f, 0.110441431f, -0.218579784f, -0.0465183631f, 0.0891890898f, -0.0678308308f, 0.32689333f, 0.00912694447f,
+    0.0570266545f, -0.197469547f, 0.16037032f, 0.0952870548f, -0.131380275f, 0.00660542725f, -0.115020454f, 0.244768709f,
+    -0.0943455994f, 0.0102310032f, -0.133286893f, 0.18013595f, 0.163102552f, -0.0860085711f, -0.0698385686f, 0.0375697948f,
+    -0.159030363f, 0.00310901715f, 0.257571757f, 0.102632247f, 0.000216283108f, 0.0468421653f, -0.186023101f, -0.0869427174f,
+    0.00211388525f, 0.0650263429f, -0.143412337f, -0.0568744615f, 0.0666029304f, -0.0829600692f, 0.297899693f, -0.0319114365f,
+    -0.00667873258f, -0.140795738f, 0.152241901f, 0.149373531f, -0.0325541161f, 0.0555741116f, -0.109326057f, 0.270466149f,
+    -0.0063905525f, 0.0348160081f, -0.0817962289f, 0.097463347f, 0.184606478f, -0.0822324529f, -0.0650097281f, 0.0206212699f,
+    -0.157970741f, 0.0877018422f, 0.235736847f, 0.0820807666f, 0.0616415739f, 0.0726499483f, -0.240824193f, -0.136264771f,
+    0.0486612469f, 0.128106117f, -0.0811311752f, -0.0517497323f, -0.00238086609f, -0.0747929886f, 0.42688328f, 0.0611508042f,
+    0.0929123759f, 0.0580411404f, 0.24365516f, 0.164231643f, -0.155827969f, -0.00354817882f, -0.146823913f, 0.256446689f,
+    -0.0419882163f, -0.114027314f, -0.114875942f, -0.0495220274f, 0.345179319f, 0.0114747798f, 0.0181705523f, 0.0253754891f,
+    -0.119458631f, -0.00015500786f, 0.313933074f, 0.199172929f, 0.126972079f, 0.180570364f, 0.015291472f, 0.0140997618f,
+    0.0932542309f, 0.0758106634f, -0.216681257f, -0.0301194265f, 0.0599484034f, 0.0625372678f, -0.134915143f, 0.0565062314f,
+    0.0820092559f, 0.0115494467f, 0.207497478f, 0.17179288f, -0.257583678f, -0.120354541f, -0.191463232f, 0.292796254f,
+    -0.0812253803f, -0.0304417964f, -0.156246871f, -0.0170063525f, 0.339707106f, -0.0978758112f, -0.0524207391f, -0.0323742442f,
+    -0.133169785f, 0.0472991802f, 0.261490077f, 0.175810546f, 0.0519217551f, 0.181707159f, -0.124526121f, -0.0608981624f,
+    0.0461293906f, 0.0453478284f, -0.299304783f, -0.0483427532f, -0.0647630021f, -0.0176315233f, -0.227268472f, -0.0279298853f,
+    0.0521185398f, 0.0217618141f, 0.273655802f, 0.13323471f, -0.114068568f, 0.0194909349f, -0.0857684687f, 0.286669165f,
+    -0.094329156f, -0.0516415685f, -0.0723117664f, -0.0484598987f, 0.340532541f, -0.0712337494f, 0.013144807f, 0.0846214294f,
+    0.0151190646f, -0.00207686541f, 0.365101904f, 0.159763947f, 0.183729097f, 0.189400211f, 0.275110632f, -0.0195876714f,
+    0.0443983339f, 0.141968161f, -0.107526921f, -0.117950484f, 0.0383932032f, 0.0337862745f, -0.037398085f, 0.10261438f,
+    0.070401147f, -0.031507805f, 0.195338845f, 0.0649413764f, -0.135928541f, -0.0184202529f, -0.220349967f, 0.255223721f,
+    -0.0187020022f, -0.145188436f, -0.179750383f, -0.0284006074f, 0.38395524f, -0.111683339f, -0.0960553735f, -0.0153368153f,
+    -0.159786552f, -0.0378660336f, 0.264671683f, 0.123249114f, 0.0147173041f, 0.134124607f, -0.200738385f, 0.0201612208f,
+    0.0149687715f, 0.0565461814f, -0.231812388f, -0.114005595f, -0.0646156594f, -0.0051454748f, -0.185393602f, 0.0208502505f,
+    -0.0376364142f, -0.0999037176f, 0.162512839f, 0.0589555055f, -0.256191343f, -0.0792516917f, -0.252343804f, 0.169547617f,
+    -0.0684554204f, -0.139317438f, -0.25234887f, -0.0573620424f, 0.324265271f, -0.166461587f, -0.0606416576f, -0.00189836731f,
+    -0.13851808f, -0.0010673207f, 0.318484694f, 0.115616433f, 0.0714270025f, 0.0193079654f, -0.296408951f, -0.0682218894f,
+    -0.0255320258f, 0.0442801975f, -0.314867705f, -0.151031926f, -0.138530239f, 0.0177908931f, -0.204899371f, 0.038633734f,
+    -0.00140170194f, -0.0600543879f, 0.213576064f, 0.139667362f, -0.0872210711f, -0.0369611345f, -0.110738143f, 0.155093089f,
+    -0.0684830323f, -0.00594529416f, -0.192659959f, -0.0360517167f, 0.369099468f, -0.0933297575f, -0.060687311f, 0.0520628057f,
+    -0.0118234791f, -0.0351936705f, 0.277495474f, 0.166176423f, 0.0590755977f, 0.128328189f, 0.347169191f, -0.035202466f,
+    0.0368561484f, -0.0303987861f, -0.198974118f, -0.0757025704f, -0.0703440979f, -0.0224928018f, -0.0343944095f, 0.0523575805f,
+    0.05004384f, -0.145403415f, 0.230973005f, 0.138958335f, -0.13997072f, -0.0953977928f, -0.201288983f, 0.199320629f,
+    -0.0876756459f, -0.156213298f, -0.240051627f, 0.0475077555f, 0.34374252f, 0.00116500654f, -0.00924024358f, -0.0195686743f,
+    -0.0663503185f, -0.0107551832f, 0.399772823f, 0.116699383f, 0.0359833837f, 0.147535682f, -0.212464228f, -0.101371408f,
+    0.0997871906f, 0.188617572f, -0.305687964f, -0.0809449404f, 0.0101567442f, 0.0158139654f, 0.116916083f, 0.0160675403f,
+    0.0628704876f, -0.103769779f, 0.160571069f, 0.134812728f, -0.242496818f, -0.0874957219f, -0.146609455f, 0.230327636f,
+    -0.102080069f, -0.147494912f, -0.269390225f, -0.022962248f, 0.306916803f, -0.0477876328f, -0.128760636f, 0.022346247f,
+    -0.158040226f, -0.0260173418f, 0.346646875f, 0.172543302f, 0.0600905456f, 0.158480227f, -0.133399993f, -0.0424351506f,
+    -0.0074854563f, 0.0790840909f, -0.385330945f, -0.0195347462f, 0.0618093498f, -0.0184834693f, 0.163995609f, -0.0434993766f,
+    0.0776346624f, -0.138802886f, 0.158446908f, 0.129061699f, -0.142875254f, 0.0145021565f, -0.100143954f, 0.231638014f,
+    -0.125407413f, 0.0269501824f, -0.12340641f, 0.11121542f, 0.362693071f, -0.00571360625f, -0.0724118724f, 0.0951575041f,
+    -0.0143635049f, 0.0164987519f, 0.357822746f, 0.112903588f, 0.0491004437f, 0.175236166f, 0.344905466f, -0.00320973666f,
+    0.0790296718f, 0.115448758f, -0.246890321f, -0.0544015542f, -0.0149802407f, -0.0314368047f, 0.275554448f, 0.0934705287f,
+    0.13977173f, 0.103202805f, -0.0937846154f, 0.0599246994f, -0.374195218f, -0.203862533f, 0.0544840433f, -0.0379803777f,
+    0.158991754f, -0.442054838f, -0.237940714f, -0.228484794f, -0.0807577595f, -0.247911185f, 0.0136839831f, 0.0277376659f,
+    -0.118872136f, -0.0389262475f, -0.055160325f, -0.172756821f, 0.0569056459f, 0.0273859203f, -0.59279108f, 0.0600849316f,
+    0.0501036979f, -0.396924525f, -0.0734779537f, -0.0789484605f, -0.0862804726f, 0.222557411f, -0.55232656f, 0.0102319634f,
+    0.0978557244f, 0.144719973f, -0.0965847224f, 0.216811627f, 0.028969707f, 0.118676424f, 0.020834377f, -0.0814148784f,
+    0.238646582f, -0.000741684926f, 0.0999076739f, 0.00680947071f, 0.00676176371f, -0.0436387882f, 0.0351084545f, 0.013895642f,
+    0.0400656573f, -0.0371890664f, -0.0680479929f, 0.0803137645f, 0.0847099945f, 0.081489034f, -0.200397566f, -0.0752638131f,
+    0.0550616682f, -0.0759205967f, 0.312577248f, -0.0448040627f, 0.00972952694f, 0.234923959f, -0.147661999f, 0.0192043688f,
+    0.0727618411f, 0.0265546404f, -0.0295594484f, 0.246780246f, 0.144893914f, 0.160953999f, 0.173333511f, -0.0153767141f,
+    0.188287944f, 0.133049622f, 0.133996621f, 0.148365587f, 0.0641480163f, -0.0925926715f, -0.0106576383f, 0.0612062216f,
+    0.145337686f, -0.00738433423f, 0.0626160875f, 0.150649145f, 0.221444696f, 0.198021844f, 0.0548143722f, -0.0967255384f,
+    0.0267175604f, 0.0348731466f, 0.365653336f, -0.0597891025f, -0.04879722f, 0.133879572f, -0.211525679f, 0.0122418189f,
+    -0.023534447f, 0.161638632f, -0.047659941f, -0.0728605539f, -0.333916396f, -0.0847358778f, -0.0612121746f, -0.158055514f,
+    0.126886845f, -0.321736097f, -0.176370844f, -0.463949561f, 0.054788705f, -0.318190724f, 0.00324758166f, 0.0255463682f,
+    -0.216537997f, -0.0548348278f, -0.0145653766f, -0.207043275f, 0.0412952974f, -0.092831403f, -0.506756008f, -0.00665723346f,
+    0.0174076036f, -0.386498064f, 0.140542388f, 0.0179776754f, -0.111409388f, 0.224381477f, -0.759820938f, -0.0513227992f,
+    -0.0177633241f, 0.0917316973f, -0.125713497f, 0.0623787865f, -0.0220314283f, 0.130045637f, 0.0100398818f, -0.153932229f,
+    0.153971374f, -0.0114267189f, 0.111187749f, -0.13099961f, 0.0485128686f, -0.129881889f, 0.0164987259f, -0.000589667005f,
+    0.0454630107f, -0.062137682f, -0.0348828696f, -0.0363282375f, 0.00245802151f, 0.0220463946f, -0.10968741f, -0.0455735065f,
+    0.0658778474f, -0.0155430697f, 0.352546066f, 0.0127671482f, -0.0777762011f, 0.253140628f, -0.248194024f, -0.0821442604f,
+    -0.0468123555f, 0.0191806071f, -0.0145972548f, 0.150372699f, 0.20332247f, 0.16168721f, 0.229376286f, -0.146915227f,
+    0.0433600247f, 0.113125324f, 0.161275506f, 0.0820972249f, 0.148079276f, 0.0927320123f, -0.0116203437f, 0.0931327268f,
+    0.142406985f, 0.0514580235f, -0.0416602977f, 0.129637644f, 0.156261086f, 0.0687823892f, 0.0868762359f, -0.0411617942f,
+    0.0335246287f, 0.0171029512f, 0.281039268f, 0.0252556652f, -0.0829545408f, 0.113567643f, -0.100220747f, 0.00100244232f,
+    0.0484881997f, 0.126524866f, -0.0642089695f, -0.271415293f, -0.170568764f, 0.0110806115f, 0.0533715039f, -0.194809496f,
+    0.178000525f, -0.127151981f, -0.019044267f, -0.480869859f, 0.0485550947f, -0.41007039f, -0.00669840351f, 0.0164402779f,
+    0.012920754f, -0.0273226704f, -0.0358422324f, -0.0677375272f, 0.0736150965f, 0.0112551143f, -0.395686179f, 0.0495610125f,
+    0.0446441434f, -0.287221313f, 0.365247905f, -0.0603184663f, -0.153748095f, 0.184240609f, -0.919229686f, -0.00598256662f,
+    -0.0660907254f, 0.104857281f, -0.0252348725f, -0.103864096f, 0.0599477179f, 0.124898925f, -0.00406470802f, -0.0643139631f,
+    0.0667397752f, -0.0802486539f, 0.125390634f, -0.132340819f, 0.0336492583f, -0.17640686f, 0.0592241362f, 0.0264078323f,
+    0.0174346045f, -0.0692965686f, 0.00114588696f, 0.0716620609f, 0.0185644291f, 0.00155642733f, -0.216831893f, 0.0671390891f,
+    0.0901961699f, -0.120140776f, 0.274342865f, -0.017215671f, -0.0780679956f, 0.191849336f, -0.319302708f, -0.0177767463f,
+    0.00215390977f, 0.0839291438f, -0.0549332462f, -0.0608365051f, 0.133964047f, 0.143087f, 0.115125626f, -0.0339976139f,
+    0.121052049f, 0.179894894f, 0.220808029f, 0.000851992751f, 0.108432531f, -0.00246061618f, -0.0608999804f, 0.020450348f,
+    0.0590506308f, 0.0315365829f, 0.0630632713f, 0.0525598936f, 0.1208992f, 0.0698515028f, -0.0555027202f, -0.0698218122f,
+    -0.0257709939f, 0.015479465f, 0.259675741f, -0.0796244591f, -0.0558415204f, 0.0828774199f, -0.124745399f, 0.0120453006f,
+    -0.109365299f, 0.00805686321f, 0.0342239365f, -0.00294225756f, 0.124205947f, 0.0604332611f, -0.0812148377f, -0.381103396f,
+    -0.0209582206f, 0.0126491506f, 0.160641044f, 0.145874366f, -0.0758866593f, 0.086051859f, 0.0208200049f, 0.0336962715f,
+    0.174360573f, -0.0490081348f, -0.346264929f, 0.135415867f, -0.194348484f, 0.00952935126f, 0.118581451f, -0.0269103851f,
+    0.0930429399f, 0.111822434f, 0.0861713216f, -0.0307539422f, 0.0832790062f, 0.0847204998f, 0.246255606f, -0.0967326537f,
+    -0.02834359f, -0.0243728068f, -0.0245224908f, 0.108667649f, -0.0382192023f, -0.00140587625f, -0.0343180671f, -0.256157279f,
+    0.00377129414f, 0.0358997695f, -0.0403125249f, 0.183159724f, 0.0151780192f, 0.137732536f, 0.0322356895f, -0.0433170833f,
+    0.0879967511f, -0.0140733635f, -0.278486371f, 0.0526522435f, -0.146693245f, -0.0240180548f, 0.159638256f, -0.0231918152f,
+    0.0543438271f, 0.0709946081f, -0.0881962031f, -0.0227425937f, 0.0772070736f, 0.0430882424f, 0.120454051f, -0.0520102531f,
+    -0.117923789f, 0.0477752909f, -0.0237769075f, 0.0319568999f, -0.00666831154f, -0.0838466585f, -0.0162085257f, -0.318795264f,
+    -0.0682834759f, 0.00961537752f, -0.0418688431f, 0.13116613f, -0.163372859f, 0.121184766f, -0.0313998088f, -0.0279353186f,
+    0.0979506373f, -0.0248632934f, -0.425122231f, -0.0862363726f, -0.266703486f, -0.0606744885f, 0.225116491f, 0.0783103853f,
+    0.0702518523f, 0.0409332551f, -0.0611241795f, -0.0633548871f, 0.0788393691f, 0.0304939542f, 0.278093398f, -0.0250771567f,
+    0.00485798158f, 0.0118433889f, 0.0391978286f, 0.157469079f, -0.0036402049f, -0.0676629096f, -0.0144605888f, 0.00879642367f,
+    0.00817988068f, 0.0135968486f, 0.0385453999f, 0.176629573f, -0.0323578976f, 0.1587203f, -0.0671849549f, 0.0193685759f,
+    0.0800425187f, -0.0406684056f, -0.0530637093f, 0.0290680695f, -0.110773526f, 0.007030298f, 0.203012377f, -0.043804165f,
+    0.0874123946f, 0.0891863406f, -0.10138236f, 0.0595143922f, 0.0335666128f, 0.106732227f, 0.214088291f, -0.121960819f,
+    0.065955855f, -0.0216739103f, 0.0760463849f, 0.132625699f, -0.0393801108f, -0.13176994f, 0.00163168763f, 0.118499994f,
+    0.0386705101f, -0.0782813057f, -0.129137546f, 0.14108713f, -0.0985343829f, 0.126124159f, -0.00256306399f, -0.0501647815f,
+    0.0577871576f, -0.0335175991f, -0.026356373f, 0.0246033538f, 0.102423556f, 0.118201867f, 0.119512133f, 0.0533840768f,
+    0.0601498485f, 0.0510584414f, -0.212868392f, 0.0595453233f, 0.00920339022f, 0.0518787652f, 0.1065787f, -0.127815232f,
+    0.0490790494f, 0.026423417f, 0.0167979021f, 0.127702773f, -0.0540122204f, -0.161831111f, 0.00601792382f, 0.145486668f,
+    0.0382921472f, -0.093749769f, -0.0882297903f, 0.108997852f, -0.153168857f, 0.0779996142f, -0.056819912f, -0.0732355267f,
+    0.00990634691f, 0.029980246f, -0.0692085847f, -0.0365205407f, -0.0166597664f, 0.0200873185f, 0.188099265f, 0.0471088812f,
+    0.0181819964f, 0.00654731039f, -0.272150785f, -0.0230475403f, 0.0365049765f, 0.0282940269f, 0.186523214f, -0.0643284023f,
+    0.0560236238f, -0.11494264f, 0.0868575275f, 0.310866028f, -0.097780928f, -0.0457878262f, -0.126612693f, -0.226971179f,
+    0.0604136139f, -0.0100361537f, -0.134395912f, 0.195050165f, -0.0915351212f, 0.128836557f, -0.00934274402f, -0.0576572903f,
+    -0.0756413862f, 0.035706576f, -0.0576635711f, -0.0738956705f, -0.287257493f, 0.0459493883f, 0.147373497f, 0.0205919147f,
+    0.0971096456f, 0.024268778f, -0.180486754f, 0.131948799f, 0.129475638f, 0.10600549f, 0.268692583f, -0.0507098399f,
+    0.0840949044f, -0.0956111327f, 0.0256306492f, 0.210336208f, -0.107218511f, -0.0961454585f, 0.033758793f, 0.00670392718f,
+    0.0986683443f, -0.0779078454f, -0.0568827651f, 0.176689267f, 0.00501040742f, 0.121152349f, -0.0381231904f, 0.0200283844f,
+    0.0254779011f, -0.0421775058f, 0.0099955434f, -0.0481766798f, -0.0547540896f, 0.0982730016f, 0.159744352f, 0.0339462161f,
+    0.0156835504f, 0.0314217731f, -0.119661696f, 0.0443571322f, 0.0127870748f, 0.0603500791f, 0.228478178f, -0.106109895f,
+    0.0116612017f, -0.00903730281f, 0.0317836665f, 0.300398052f, -0.099402383f, -0.0800277293f, 0.0084536327f, -0.123405091f,
+    0.125206709f, -0.182285011f, -0.18052955f, 0.174329638f, -0.111901134f, 0.0248911735f, -0.00752945058f, 0.0198604334f,
+    -0.0476558022f, 0.0108638937f, -0.118760809f, -0.0806596875f, -0.122973025f, 0.0616054758f, 0.156915039f, 0.0417519212f,
+    0.00416694582f, 0.00984092336f, -0.295701027f, 0.0220661946f, 0.131855056f, 0.0614749454f, 0.248073161f, -0.0986061394f,
+    -0.0724963173f, -0.0723757297f, -0.062402986f, -0.0437857956f, -0.0154290665f, -0.00605802285f, -0.115286961f, -0.09216813f,
+    0.0137548745f, -0.132295296f, -0.105323955f, -0.133068189f, 0.00389120844f, -0.0861739218f, -0.0371191278f, -0.0613072589f,
+    -0.10353215f, -0.0235214792f, -0.0849631652f, -0.067595996f, -0.0894297734f, -0.134640262f, 0.0943874419f, -0.0594613701f,
+    -0.136022106f, 0.0532922074f, -0.0346250758f, -0.108241789f, 0.0778032094f, -0.0754256397f, -0.00160032383f, -0.089465633f,
+    0.0450668186f, -0.0334448852f, 0.00669459393f, -0.06104251f, 0.00940971915f, -0.0397314951f, -0.0166041218f, -0.0324281268f,
+    -0.0369633511f, -0.0627458692f, -0.0525554605f, -0.0678434372f, 0.0459267534f, -0.0289210603f, -0.11758931f, -0.0218726974f,
+    -0.031120915f, 0.0552027263f, -0.0627802163f, -0.0791307315f, -0.0338244587f, -0.0120036155f, 0.0225706045f, -0.0619818196f,
+    -0.181557402f, -0.0349312164f, -0.0327814035f, -0.00381449494f, 0.0296067446f, -0.120301902f, 0.0206773952f, -0.113201447f,
+    -0.0348325968f, -0.0776897892f, 0.0728465095f, 0.00841736235f, -0.0428267606f, -0.184032723f, 0.0792398974f, 0.00514393998f,
+    0.0379773155f, -0.0933785513f, -0.0590536259f, -0.115383513f, -0.00113973347f, 0.0446475223f, -0.033623036f, -0.088916935f,
+    -0.0479477048f, 3.8318587e-05f, 0.0124290586f, 0.00370443054f, -0.0479156673f, -0.0496561304f, -0.0506200902f, -0.0991671309f,
+    -0.144179627f, -0.0459951349f, -0.205109209f, -0.0532150716f, 0.0452218167f, -0.0414540693f, -0.0311052073f, -0.0900228992f,
+    0.0501553454f, -0.183922291f, 0.0238018204f, -0.0073378887f, 0.0139142191f, 0.000921408297f, 0.0337015763f, -0.025593739f,
+    0.0127440281f, -0.118339315f, -0.061832469f, -0.0192601588f, -0.00274898927f, -0.0275681354f, -0.107165717f, 0.0176882446f,
+    -0.0418435633f, -0.0532352552f, -0.0638344288f, -0.0509716533f, 0.0504078977f, -0.0123636071f, 0.0417441167f, -0.0442012437f,
+    -0.0887977928f, -0.0154930744f, -0.0202404279f, -0.101426624f, 0.0232380964f, -0.068479903f, -0.0873148069f, -0.0306342356f,
+    0.0493988842f, -0.0807733163f, -0.00808116328f, -0.0156548005f, 0.00233555492f, -0.0122818993f, 0.0832478926f, -0.0391072109f,
+    0.00783718191f, 0.0108009744f, 0.037728928f, -0.0179455094f, -0.0233966652f, 0.128299624f, -0.000372692157f, -0.00620477321f,
+    0.00510712666f, -0.0472279489f, -0.0222912505f, 0.0464881249f, 0.0206606183f, 0.0457408242f, -0.0661945939f, -0.02951511f,
+    -0.105731748f, -0.0065000318f, 0.0489607789f, -0.0299743805f, 0.0347900055f, 0.0235976242f, 0.00140626985f, -0.0817324072f,
+    0.0499641933f, -0.0800768062f, -0.0123150544f, -0.0215564668f, -0.0210863054f, -0.162385672f, 0.0489396527f, 0.0504957587f,
+    -0.012352651f, 0.0742590576f, 0.0440999717f, -0.0264647454f, 0.0113358786f, 0.118107028f, -0.0689695328f, -0.0642481819f,
+    -0.00768709462f, -0.0255619567f, 0.0274863895f, 0.0560533814f, 0.110027909f, 0.173379302f, -0.0225977451f, -0.0745796934f,
+    -0.0702462867f, -0.113378197f, -0.0858606696f, -0.0197599567f, -0.023331644f, -0.0370445028f, -0.034229029f, 0.0543865934f,
+    0.0450270958f, -0.240323424f, -0.0490654185f, 0.022279907f, 0.0189032014f, -0.0815242231f, 0.0105739459f, -0.0435470343f,
+    0.0766668245f, -0.0363286175f, -0.0275349952f, -0.0825310946f, 0.0108149629f, 0.0539096408f, -0.0928388759f, 0.0685267523f,
+    -0.0404494368f, -0.0106326519f, -0.131361589f, 0.0145022543f, 0.0424465053f, 0.0455352329f, 0.00461556856f, -0.0615645833f,
+    0.00782744959f, -0.163958907f, -0.0639811307f, -0.000236698717f, -0.0567992032f, -0.0460519046f, 0.0191010628f, -0.0252716932f,
+    0.0705470517f, -0.0413280129f, 0.037786983f, 0.0674023926f, 0.00228655734f, 0.0275280103f, -0.0357500277f, -0.0871767774f,
+    0.0472711548f, 0.0121752648f, 0.0771102682f, -0.0807966217f, -0.0120098758f, 0.0969065875f, -0.0473370068f, 0.00392940082f,
+    -0.0251147281f, 0.00403500907f, -0.0943487287f, 0.00174800225f, 0.0476020016f, 0.114735916f, 0.0480995439f, -0.0776723474f,
+    0.0166531242f, -0.0856579095f, 0.0763959885f, -0.034320619f, 0.037407361f, -0.0133796725f, -0.0264062509f, 0.0413070917f,
+    0.046200484f, -0.0484096557f, -0.0496827438f, 0.0915983766f, 0.103540502f, -0.0248978604f, 0.0760231614f, -0.0128858341f,
+    0.0506535955f, 0.0371898077f, 0.0654721409f, -0.00450460939f, -0.0269912444f, 0.190500706f, -0.00122133817f, 0.0523674116f,
+    0.0536337569f, 0.0100647658f, -0.039001476f, -0.0175124109f, 0.0608224347f, 0.164327338f, 0.0711805373f, -0.098840937f,
+    -0.134534925f, -0.0193639733f, 0.147281215f, 0.0307797324f, -0.0411368571f, -0.0213190243f, -0.0309366751f, 0.0287488271f,
+    0.00692390976f, 0.0652337149f, 0.0559235588f, -0.00171075133f, 0.152554825f, 0.130370855f, 0.0514311567f, -0.154824123f,
+    0.030471893f, 0.0823768973f, 0.219182745f, 0.313164324f, -0.0927774534f, -0.11992389f, 0.0755443051f, 0.0176806841f,
+    0.231506288f, 0.0399968997f, -0.073095277f, 0.122060426f, 0.113457084f, 0.0898060501f, -0.0582567863f, -0.0271410551f,
+    0.00466338312f, -0.0170055032f, 0.287715226f, -0.161637932f, -0.0441368744f, -0.0485643819f, 0.117433071f, 0.0867690817f,
+    0.0146345329f, 0.0740141869f, 0.0124386894f, -0.0224236902f, 0.0428252034f, 0.0834397376f, -0.00333779329f, -0.0586724021f,
+    0.0229100846f, 0.0297939982f, 0.0986559242f, 0.244438022f, -0.0761462599f, -0.0629099756f, 0.0800660923f, 0.0603234395f,
+    0.17624411f, 0.00645025354f, -0.0936948955f, 0.0800535083f, 0.0823337361f, 0.093564339f, -0.263448894f, -0.00963821169f,
+    -0.0167270619f, 0.00276598916f, 0.17500475f, -0.121928804f, -0.0318512358f, -0.0211914834f, 0.0190485008f, 0.0762791857f,
+    -0.0111375535f, 0.0863766894f, 0.0244369879f, 0.0307565592f, 0.113439009f, 0.0546305887f, -0.0223090034f, -0.187835783f,
+    0.0937248394f, 0.0840379f, 0.0952683687f, 0.222715497f, -0.0635697469f, -0.060250774f, 0.0162034351f, 0.0079230275f,
+    0.255870134f, -0.0335725695f, -0.0563099012f, 0.108739302f, 0.0117904264f, 0.00780699076f, -0.184879676f, 0.00489408383f,
+    0.062246263f, 0.077681154f, 0.174605042f, -0.116385438f, 0.0179352462f, 0.0340580083f, 0.0743911341f, -0.00849568192f,
+    -0.0768244267f, 0.108221844f, 0.00616697734f, -0.0200203583f, 0.116662063f, 0.0932344869f, 0.0391299352f, -0.168452621f,
+    0.124955803f, 0.0726425499f, 0.222454846f, 0.185232252f, -0.0383874848f, -0.0750557259f, 0.0923786536f, -0.0245806966f,
+    0.242480129f, 0.0414357707f, -0.0790633187f, 0.163798004f, 0.039618548f, 0.0428547636f, -0.120797254f, 0.0758347884f,
+    0.0198178031f, 0.00788807124f, 0.235517085f, -0.204133347f, 0.0263694599f, 0.0536372103f, 0.0117941331f, -0.00176169258f,
+    0.0136347404f, 0.0141908797f, 0.0450404249f, 0.0139310071f, 0.0625622645f, 0.00864332821f, 0.0593961067f, -0.06163086f,
+    0.130925924f, 0.037943244f, 0.0879830718f, 0.145542726f, -0.047993619f, -0.0579505526f, 0.0563695729f, 0.0754949078f,
+    0.102687366f, -0.0423759446f, -0.0298064277f, 0.0849250257f, 0.0942204744f, 0.0059661991f, -0.268555999f, 0.00387338456f,
+    -0.00141839287f, -0.0297578331f, 0.171384558f, -0.153592274f, 0.0102978796f, -0.0475274958f, -0.025423985f, -0.0243885554f,
+    -0.0154121062f, 0.0450534075f, -0.0154396528f, 0.0545741692f, 0.0406496264f, 0.0756962225f, 0.0437216237f, -0.206132755f,
+    0.114769205f, 0.00606494397f, 0.116142772f, 0.118679039f, 0.0253364649f, -0.0598536804f, 0.0570308976f, 0.0655315593f,
+    0.226194724f, 0.0826912522f, -0.0887787417f, 0.0410392061f, 0.0222470127f, -0.00505051762f, -0.258957893f, 0.0146979736f,
+    -0.0243976396f, -0.0140262432f, 0.202567533f, -0.159217224f, 0.024241386f, 0.00865795556f, 0.00257601938f, 0.0643646941f,
+    -0.00845434424f, 0.0505118482f, -0.0393207669f, -0.0278350301f, 0.140625626f, 0.0290871058f, 0.0206863247f, -0.176693439f,
+    0.100880198f, 0.0797854364f, 0.167985693f, 0.211430743f, -0.120864563f, -0.138664663f, 0.0914375111f, -0.00252370141f,
+    0.270387918f, 0.042779427f, -0.0998355448f, 0.0900072306f, -0.03894113f, -0.0485331528f, -0.0757339895f, -0.00739745051f,
+    0.0202742722f, 0.0344220698f, 0.25474453f, -0.176753014f, 0.0211604778f, -0.0144167915f, 0.0936330333f, 0.0570240766f,
+    -0.0207112078f, 0.0524787754f, 0.0431121811f, -0.0378311388f, 0.0782267749f, 0.00821223762f, -0.0179125126f, -0.15228799f,
+    0.0961133316f, -0.0264407042f, 0.105566978f, 0.140791118f, -0.0905875638f, -0.10415411f, -0.00409599114f, -0.01051105f,
+    0.154605791f, 0.0449938104f, -0.127583757f, 0.0221702158f, -0.0207913741f, -0.0073977448f, -0.228445485f, 0.0339533426f,
+    -0.0308431443f, -0.000799989037f, 0.207679108f, -0.17985867f, -0.00644784933f, 0.0150575843f, -0.0267003924f, -0.00260083051f,
+    -0.0729100779f, 0.0211674049f, -0.0300245751f, -0.00874046143f, 0.0469267853f, 0.00786169898f, -0.0723043159f, -0.238688454f,
+    0.0339571908f, 0.0139288297f, 0.147135764f, 0.206341103f, -0.0589710474f, -0.148715124f, -0.0193914678f, 0.110875443f,
+    0.229731843f, -0.00456412276f, -0.141066268f, 0.067486465f, -0.0371071063f, -0.0284049269f, -0.169353306f, -0.0185431521f,
+    0.0973613188f, 0.0604368001f, 0.182492718f, -0.217970356f, 0.075842984f, 0.0702795908f, 0.027560018f, 0.00272553158f,
+    0.0157528203f, 0.0369388424f, 0.0567182079f, -0.0478300378f, 0.158840701f, 0.0642253757f, 0.167911366f, -0.163955182f,
+    0.0868391916f, 0.153244078f, 0.12985009f, 0.0842079297f, 0.0447260663f, -0.112726465f, 0.0891071483f, -0.018771451f,
+    0.285132617f, -0.0394263454f, 0.0157994572f, 0.0578567497f, 0.110228978f, 0.0306402426f, -0.230560467f, -0.0325573832f,
+    0.0146020018f, -0.108892784f, 0.176663116f, -0.218438134f, -0.0892409161f, 0.00259326957f, -0.173364416f, 0.117223084f,
+    -0.0436542034f, 0.110294893f, 0.0309620555f, 0.0254202466f, 0.0450132377f, 0.0206418838f, 0.152913451f, -0.0675707385f,
+    0.00874141883f, 0.02598387f, 0.124133632f, 0.0844236836f, -0.00121588144f, -0.151018918f, -0.0154652866f, 0.0741074979f,
+    0.191199362f, -0.0589663163f, 0.0169199836f, 0.106909804f, 0.118940443f, -0.00307552912f, -0.28964749f, -0.0442089438f,
+    -0.0590120889f, -0.0411501639f, 0.193541631f, -0.113652013f, -0.0114806136f, 0.0574683286f, -0.236780509f, 0.00683119381f,
+    -0.0259048454f, 0.0746267587f, 0.0707964301f, 0.0334100239f, 0.104034878f, 0.0424272828f, 0.0459547304f, -0.158648759f,
+    0.038921874f, 0.108086243f, 0.16436635f, 0.098948963f, 0.0163422823f, -0.141961396f, -0.0355387926f, 0.0480382778f,
+    0.234185562f, 0.0650616065f, -0.0967546925f, 0.110854663f, 0.0354336835f, 0.00384579948f, -0.34499836f, -0.0165713467f,
+    0.0635449961f, -0.0196810588f, 0.114811964f, -0.195732847f, 0.0305390935f, 0.0320761241f, -0.119143337f, 0.0268740486f,
+    -0.0613928586f, 0.147671998f, -0.0245096032f, -0.0613526441f, 0.138418287f, 0.0693182349f, 0.0881235227f, -0.161488101f,
+    0.0679895729f, 0.0990832075f, 0.132114083f, 0.0951260924f, 0.0662622303f, -0.0145555269f, 0.027077863f, 0.0553110875f,
+    0.29242149f, -0.0284874886f, -0.0642740428f, 0.103332877f, 0.0452090651f, 0.0392161869f, -0.177159712f, 0.0124822538f,
+    -0.0116927736f, -0.0156582743f, 0.182933509f, -0.27797094f, -0.0707120597f, 0.0157322045f, -0.21798493f, 0.125436708f,
+    0.00200131489f, 0.0978460684f, 0.00761603191f, -0.0627139732f, 0.0250220019f, -0.0132142976f, 0.0823370069f, -0.176960289f,
+    0.0437779687f, 0.0454971343f, 0.119831353f, 0.0959895924f, 0.0450365655f, -0.0893115923f, -0.0182033889f, 0.0813675597f,
+    0.240298241f, -0.0455884188f, 0.0055899932f, 0.0650980696f, 0.109800808f, 0.0629645288f, -0.298116118f, 0.0333246477f,
+    -0.0109327352f, -0.0277783889f, 0.0902316794f, -0.189460993f, 0.0129305087f, 0.047756616f, -0.156102151f, 0.0581354089f,
+    0.0152607923f, 0.0272742622f, 0.0701109171f, -0.10883382f, 0.123019792f, 0.0103295213f, 0.0279219318f, -0.210821763f,
+    0.077359587f, 0.117337741f, 0.12097951f, 0.0660272688f, -0.0505024977f, -0.115923591f, -0.0339822806f, 0.0380258299f,
+    0.216794029f, -0.00935322233f, -0.0141971689f, 0.0583457872f, 0.0264230575f, -0.0153362248f, -0.293084532f, -0.0219285339f,
+    -0.0203854684f, -0.0138659067f, 0.123671159f, -0.273319215f, 0.0566675924f, 0.129705086f, -0.128302395f, 0.0207507834f,
+    -0.0780937225f, 0.031193383f, -0.00840698183f, -0.151558027f, 0.115647219f, 0.0622703135f, 0.0855201557f, -0.211679414f,
+    -0.0244962107f, 0.0494794473f, 0.226736024f, 0.0947622135f, 0.0472218022f, -0.071357809f, 0.0342708007f, 0.0818590671f,
+    0.248932391f, 0.0608064793f, -0.100769669f, 0.0423489213f, 0.0455150455f, -0.0492960177f, -0.191661343f, 0.0310056936f,
+    0.0598215722f, 0.0385052934f, 0.262010843f, -0.332229882f, -0.0163810086f, 0.0689145997f, -0.194896474f, 0.0322237648f,
+    -0.00899161212f, 0.0549747646f, 0.00388880982f, -0.108850077f, 0.0456493907f, 0.0649048313f, 0.0381827503f, -0.166335911f,
+    -0.0333031937f, 0.116792202f, 0.102770627f, 0.0993485823f, -0.0185419973f, -0.0575610846f, 0.009272472f, 0.0788992122f,
+    0.268066913f, 0.062867552f, -0.118146963f, 0.056734059f, 0.0227108598f, 0.010442174f, -0.265779525f, -0.0244608857f,
+    0.0790139362f, -0.0545111038f, 0.143159866f, -0.279431701f, -0.0279757269f, 0.1160172f, -0.1961101f, 0.0639895871f,
+    -0.0183269046f, 0.0958253071f, -0.0124174133f, -0.139588445f, 0.107187115f, 0.00202905643f, 0.0851404294f, -0.242312163f,
+    -0.0326706991f, 0.0835097879f, 0.118844241f, 0.102920644f, 0.0226667523f, -0.0957546681f, -0.0443089679f, 0.0571437329f,
+    0.193126023f, 0.0384046994f, -0.0976058096f, 0.0725331381f, 0.0333445333f, -0.00945231225f, -0.264061153f, 0.0598444007f,
+    0.0234453734f, -0.0230386537f, 0.0844205245f, -0.291120887f, 0.0439174101f, 0.0658967122f, -0.0996067151f, 0.0849759206f,
+    -0.0130422888f, 0.0147427721f, 0.0285792593f, 0.032483995f, -0.00777214579f, 0.0106851757f, -0.0427204184f, -0.019604275f,
+    -0.0473456942f, 0.0319257565f, -0.0663901791f, -0.00914500747f, 0.046665173f, 0.0249338001f, -0.0464399345f, 0.0172196385f,
+    0.0339890681f, -0.0277725011f, -0.0554662421f, -0.0415901579f, 0.0232019052f, -0.00870216824f, 0.0367609672f, 0.0254991036f,
+    0.0401145071f, 0.0148156947f, 0.00719505688f, 0.0214944109f, 0.0420980938f, 0.00734100444f, -0.0458048098f, 0.0410469733f,
+    0.0187016018f, 0.0213129688f, 0.00733555993f, -0.063590683f, 0.0182959046f, -0.0160154048f, 0.00431431644f, -0.00679015508f,
+    -0.0227110032f, 0.0213800594f, 0.0283286124f, 0.0445084386f, 0.011663232f, -0.0023161436f, -0.022389384f, 0.0123591088f,
+    -0.0335557759f, -0.0203903113f, -0.00933580287f, 0.00169364957f, -0.055679366f, -0.0492391735f, -0.0636683628f, -0.0337006003f,
+    -0.0141633982f, -0.0465208702f, -0.0631265119f, -0.0133375628f, -0.0261755269f, 0.0101355277f, -0.0248538833f, 0.00918214954f,
+    -0.0615184791f, -0.00890875235f, 0.0221976079f, 0.0275161359f, -0.034262117f, -0.0503735468f, -0.0171146132f, -0.0282355286f,
+    0.0106979404f, -0.0186981391f, -0.0498866774f, -0.0304874182f, 0.00342789362f, 0.0365875103f, -0.0363837406f, 0.0365993269f,
+    -0.0569789745f, -0.00471619517f, -0.0354272388f, 0.0474655963f, 0.0315849297f, 0.00379250874f, -0.0113329254f, -0.0064971759f,
+    -0.0568141192f, -0.00193119317f, 0.0403978303f, -0.0472369157f, 0.000608725764f, 0.0102509111f, -0.0174513515f, -0.0103018712f,
+    0.0310805645f, -0.0546249077f, -0.0567063168f, -0.0399655253f, -0.00426945742f, -0.00405270094f, -0.0613053516f, -0.0262894649f,
+    -0.0615269914f, 0.0207965635f, 0.0219833478f, 0.0325614586f, 0.0402484089f, -0.0157540198f, -0.0424112938f, 0.00477840751f,
+    -0.0396240242f, -0.0268619023f, -0.00100499322f, -0.0367851369f, -0.0587432198f, -0.0548432693f, -0.0226966683f, 0.00770314038f,
+    -0.0361518078f, -0.0464065745f, -0.042135261f, 0.0249870848f, -0.0171547364f, 0.00180975173f, -0.0295322649f, -0.0242137071f,
+    -0.0410210751f, -0.0017596113f, -0.0057543912f, -0.041125726f, -0.0319525674f, 0.0459814593f, -0.0272492543f, -0.0587777533f,
+    0.0267929267f, -0.01347348f, -0.0469077192f, 0.0485768057f, -0.0482497364f, 0.0300259609f, -0.00529720774f, 0.0266250931f,
+    0.0215680711f, 0.0102213938f, 0.0208419058f, 0.00331732119f, -0.0510195866f, -0.0261492394f, -0.0413425229f, -0.0137897283f,
+    0.00131195632f, 0.0159921721f, -0.054641068f, 0.0304286797f, 0.0254475679f, 0.0203218833f, -0.045649536f, 0.00661901198f,
+    0.032764487f, -0.0614669248f, -0.0328969546f, -0.0123764519f, 0.0451835617f, 0.0162163246f, -0.038988661f, 0.00444806693f,
+    -0.0398581848f, -0.062213257f, 0.0162616111f, 0.015003901f, -0.00343481428f, -0.0507096164f, -0.0596317276f, -0.0402627699f,
+    -0.0282920077f, -0.0534440055f, 0.042319797f, -0.0301782619f, 0.00910690054f, -0.0683011636f, 0.0191406719f, -0.0395587683f,
+    -0.0212496072f, -0.0664087981f, -0.0663266331f, -0.0478827544f, 0.0123066343f, -0.0199836995f, 0.0196030661f, -0.0371555723f,
+    -0.0358381905f, -0.0227810852f, 0.0273782238f, -0.0634439215f, -0.0204593278f, -0.0444676504f, -0.033635933f, -0.0334851667f,
+    -0.0105336756f, 0.0123876529f, -0.0452188216f, 0.00986280106f, 0.0353101604f, -0.0614429712f, 0.0215553343f, 0.00652005849f,
+    -0.0370000675f, -0.05920735f, 0.0205083173f, -0.0587799475f, -0.0127826165f, 0.0428597927f, -0.0469364636f, -0.00109483313f,
+    -0.0658617541f, -0.0569139421f, 0.0146761127f, -0.029470589f, 0.0430464484f, 0.0179765448f, 0.00631230185f, 0.040938098f,
+    0.0499156415f, -0.0183219351f, 0.0462691113f, -0.0391173474f, -0.0642820522f, -0.0229367428f, -0.0190606229f, -0.0335850827f,
+    0.0447722152f, -0.052126728f, -0.044035729f, 0.00556349289f, 0.0270079691f, -0.0652404428f, -0.0408542231f, 0.00838738494f,
+    -0.0108050592f, -0.0529898331f, 0.0300754067f, -0.0612268969f, -0.0344271064f, -0.0206083693f, 0.00618911721f, 0.00909280591f,
+    0.0101839211f, -0.0425789133f, -0.0664809272f, -0.0283226017f, -0.0562073067f, -0.00383111346f, 0.0581460819f, -0.0704827979f,
+    -0.0363640822f, -0.0430302583f, -0.0136581827f, -0.0562218167f, -0.047707729f, 0.0210375916f, 0.0146636292f, -0.0576993823f,
+    0.024887694f, -0.022062121f, -0.0429068655f, -0.0211657491f, -0.0597802736f, 0.0192613825f, -0.0456038117f, -0.0244966783f,
+    -0.0562935583f, -0.000626468158f, -0.0450294949f, -0.0173445325f, -0.0446045175f, -0.0776951611f, -0.0392845012f, 0.0134283397f,
+    -0.0488072708f, -0.00902095251f, 0.00345452037f, -0.00204039598f, 0.0308331717f, -0.0133780148f, 0.00617189053f, 0.0133640384f,
+    0.0353100784f, 0.0872526765f, -0.14802821f, -0.0230298694f, 0.0385305397f, 0.255490124f, -0.0583149679f, 0.00458274549f,
+    0.058252003f, -0.00752603635f, 0.102952972f, 0.101555109f, -0.243256599f, -0.0964995176f, 0.0860326961f, 0.0306996163f,
+    -0.0996477827f, 0.0172900427f, -0.229292601f, 0.125773802f, -0.0011891597f, 0.0407451503f, 0.0679679662f, 0.0305014234f,
+    -0.0395623557f, 0.00574612664f, 0.474179476f, 0.041119609f, -0.000739585957f, 0.0512053221f, 0.11252255f, 0.0599940009f,
+    0.0602645017f, 0.0863898918f, -0.135847718f, 0.0650745034f, 0.00750739221f, 0.163692936f, -0.0918780863f, -0.00667243218f,
+    0.115290061f, -0.0488165021f, 0.0123869665f, 0.108337291f, -0.239491925f, -0.061749246f, 0.0122275157f, 0.00822911691f,
+    -0.0677787215f, 0.045913361f, -0.190789774f, 0.119072251f, 0.0386994518f, 0.0990924165f, -0.0969543755f, -0.00731511926f,
+    0.0208334923f, -0.00875347573f, 0.379600704f, 0.072132349f, -0.0152023332f, -0.0523440689f, 0.112457827f, 0.0388801135f,
+    0.0117839593f, 0.0636760816f, -0.0949400291f, -0.00205185334f, -0.0366633274f, 0.103731766f, -0.10398826f, 0.035081517f,
+    0.0935654119f, -0.0940436348f, -0.0520898774f, 0.126121491f, -0.265807182f, -0.103976615f, 0.0364347473f, 0.0474496111f,
+    -0.137389585f, 0.00983455777f, -0.0959711894f, 0.0615398362f, 0.112599023f, 0.0331754386f, -0.123506539f, -0.0558919236f,
+    0.0528181158f, 0.0212265402f, 0.428144038f, 0.0994897634f, 0.0475880504f, 0.0360348076f, 0.0872558132f, 0.0322404318f,
+    0.0426792093f, 0.033615239f, -0.0691479966f, 0.0521084778f, 0.0258905292f, 0.163061604f, -0.0724687204f, -0.00592125719f,
+    0.0117724482f, -0.00818687398f, 0.0252316017f, 0.0177678913f, -0.32570827f, -0.0765656084f, 0.0392573699f, 0.0294384416f,
+    -0.118845955f, 0.0223961007f, -0.156322807f, 0.115539424f, 0.0471998341f, 0.0718220845f, 0.0234375224f, 0.000456258887f,
+    0.0130930301f, 0.0113320053f, 0.52509439f, 0.0425651371f, 0.0396332406f, -0.0267201476f, 0.0175614394f, 0.034382835f,
+    0.0470407009f, -0.0338891372f, -0.0538043827f, -0.014509839f, -0.00707667507f, 0.151145443f, -0.143320084f, 0.0251651779f,
+    0.0191483367f, -0.12623331f, 0.0539563559f, 0.0597431846f, -0.300243407f, -0.0773492381f, 0.0244340375f, 0.0252654329f,
+    -0.0520184636f, 0.00312869553f, -0.158497125f, 0.0850150287f, 0.0491415448f, 0.0539413504f, -0.111695021f, -0.00691115623f,
+    0.0486823395f, -0.0238809008f, 0.360668689f, 0.0459046029f, -0.0487402976f, -0.0167350639f, -0.0221014209f, 0.0296474844f,
+    0.00836331304f, -0.0330898575f, -0.00170901476f, 0.0893147662f, -0.0907995403f, 0.137613341f, -0.186129317f, -0.0490999967f,
+    0.0620676801f, -0.0540484227f, -0.0485274643f, -0.00393395545f, -0.214243859f, -0.107075632f, 0.0239635445f, 0.0609274693f,
+    -0.097413443f, 0.0474150404f, -0.170861632f, 0.107961074f, 0.120145887f, 0.0707441196f, -0.0844091028f, -0.0249899998f,
+    0.0988869742f, 0.000180924602f, 0.350431502f, -0.00958467834f, 0.016776735f, 0.00501301419f, 0.0636098981f, -0.015158643f,
+    0.0607044287f, 0.0509646125f, -0.0713841319f, 0.0205384567f, -0.00890859403f, 0.187166393f, -0.12084379f, -0.0693902448f,
+    0.143184856f, 0.013529337f, 0.11688105f, 0.113186523f, -0.351368994f, -0.113167152f, 0.0458531454f, 0.0271927677f,
+    -0.136139959f, 0.011870319f, -0.243203029f, 0.0605500937f, 0.0607574508f, -0.0222664122f, 0.145211324f, -0.0494964607f,
+    0.0602302253f, 0.0518919788f, 0.485322148f, 0.123328269f, 0.0321720876f, -0.0356044583f, 0.0573856756f, 0.0433505885f,
+    0.0368413106f, 0.0521202944f, -0.120421901f, 0.0553577505f, -0.0381145291f, 0.0858874768f, -0.0870665386f, -0.102804311f,
+    0.146682888f, -0.01559259f, -0.0535628274f, -0.0103742052f, -0.288529277f, -0.0585495643f, -0.0317854285f, -0.016070798f,
+    -0.171352819f, 0.0383184329f, -0.142186418f, -0.0112751815f, 0.107178219f, -0.00399223156f, -0.103167839f, 0.0128301717f,
+    0.0758036003f, -0.00472190278f, 0.333224267f, 0.0622467324f, -0.0149208987f, 0.0181796197f, 0.00506625697f, 0.0328112096f,
+    0.0813335925f, 0.0703268722f, -0.0274091829f, 0.0719368905f, -0.0220889598f, 0.186804608f, -0.136443615f, -0.0580753535f,
+    0.122696482f, -0.0842083544f, 0.0235028528f, 0.0724556819f, -0.298710108f, -0.144355714f, -0.0387585498f, 0.0100320196f,
+    -0.152331725f, 0.0626830086f, -0.151969567f, 0.0130488267f, 0.0404604264f, 0.0494779013f, -0.0824749395f, 0.00359265925f,
+    0.0915319547f, 0.051327806f, 0.399970829f, 0.105899014f, 0.0652528033f, -0.0298966896f, 0.0298325252f, 0.0147054074f,
+    -0.0477289446f, 0.0382868871f, -0.138917297f, -0.197346032f, 0.11159604f, 0.0777893066f, -0.032492362f, 0.0159008857f,
+    -0.167597935f, 0.0189325921f, 0.0318830833f, 0.0472796522f, -0.101273753f, 0.0159588419f, 0.0508677065f, 0.0910098851f,
+    -0.0285638776f, 0.0509794131f, -0.18475391f, -0.0675750375f, -0.086159341f, -0.168200567f, 0.102310598f, 0.0329449661f,
+    0.0259107817f, 0.0161238983f, 0.0728164911f, -0.0773085952f, 0.0482451916f, 0.0382698737f, 0.0939469039f, -0.109670222f,
+    -0.0328150541f, -0.050858479f, -0.0315775909f, -0.0561208613f, -0.0193493702f, -0.0295298342f, -0.0448147841f, -0.0818321034f,
+    -0.223335937f, -0.133954778f, -0.0183367245f, 0.0176424477f, -0.159300029f, 0.11223238f, -0.0192805566f, 0.0468344167f,
+    -0.00795982685f, 0.0361892954f, -0.252226263f, -0.0897368267f, -0.0954410806f, -0.0442960262f, 0.0281047653f, 0.0395330377f,
+    0.0136466157f, -0.058189135f, -0.0780900568f, -0.0667019188f, -0.0298937224f, -0.0318511315f, 0.0522085242f, -0.0753182247f,
+    0.0596381277f, 0.0354994722f, -0.0738791674f, -0.0854735449f, 0.0156779662f, -0.00528187212f, 0.117981032f, -0.112284333f,
+    -0.159334823f, 0.0801397115f, 0.0196179636f, 0.0402738936f, -0.156631827f, 0.232049584f, -0.0222143978f, -0.0120104318f,
+    -0.036406558f, -0.04499368f, -0.173671141f, 0.0104513485f, -0.0468516685f, -0.0329555832f, 0.0636700764f, 0.0517803244f,
+    0.0409424417f, -0.0599950552f, 0.0650993884f, -0.0344882756f, -0.00413447712f, -0.00027411693f, 0.0451097786f, -0.048144158f,
+    0.00804519374f, 0.053413935f, -0.118111573f, -0.0821842924f, 0.104977719f, 0.0713995621f, 0.00542386528f, 0.121042825f,
+    -0.163183764f, 0.110891104f, 0.0501420163f, -0.0626002997f, -0.102486037f, 0.0615613684f, -5.43557653e-05f, 0.0326163024f,
+    -0.0212401096f, 0.0759455413f, -0.00406216085f, 0.00305959885f, 0.0427214876f, -0.0610205904f, 0.10505233f, 0.0160492901f,
+    -0.0365342274f, 0.0671725869f, 0.037333332f, -0.0862568766f, 0.0904401168f, 0.0140911331f, 0.0929759294f, -0.0536745377f,
+    0.0215097796f, -0.0852186605f, -0.0181670189f, -0.0781351998f, -0.0794544518f, 0.0333498754f, -0.0774176866f, 0.0616211668f,
+    -0.183697224f, -0.0934602693f, 0.00383446715f, -0.0604712516f, -0.112302154f, 0.140578225f, 0.0234035607f, -0.0370454378f,
+    -0.0301115904f, -0.0500953905f, -0.163261041f, -0.0578297041f, -0.0212867353f, -0.00663392153f, 0.0334849879f, 0.0216745678f,
+    0.0531308018f, 0.0536552705f, 0.00906901341f, -0.038580738f, -0.0243253801f, -0.00104385882f, -0.0509216413f, -0.0026432923f,
+    0.0505954139f, 0.0206786599f, -0.0824446827f, -0.0826745778f, 0.00899647828f, 0.00969690084f, 0.0808895901f, 0.0290252082f,
+    -0.0960854143f, 0.00254907622f, 0.136564881f, -0.0653692484f, -0.198688641f, 0.19061932f, 0.0419487171f, -0.00730918115f,
+    0.074034743f, -0.059859816f, -0.165702403f, -0.0113458391f, 0.00278178928f, 0.0887377486f, 0.0205677859f, 0.0154722733f,
+    -0.0378278121f, 0.0169425514f, 0.0860696062f, -0.0395296998f, 0.0452899672f, -0.083597593f, -0.0250108317f, -0.0355121978f,
+    0.0395451449f, 0.00213781628f, -0.0224317014f, -0.0742905289f, 0.0240399651f, 0.131274343f, 0.0796034932f, 0.189138606f,
+    -0.145052254f, 0.141719446f, 0.0796438381f, -0.0551533848f, -0.0687309876f, -0.00541537907f, -0.0499446243f, 0.0131250136f,
+    -0.0482500866f, 0.0749452338f, 0.00182796153f, 0.103909887f, 0.0785008445f, 0.0229287241f, 0.10833621f, -0.0735262111f,
+    -0.0674120635f, 0.0967275351f, 0.127926111f, -0.1384532f, 0.0750720426f, -0.000602054177f, -0.0262853764f, -0.114117622f,
+    0.0148307439f, -0.0159382895f, -0.0814607665f, -0.107548848f, 0.0359900333f, 0.0642517284f, -0.02860526f, 0.146685645f,
+    -0.150205404f, 0.0217872616f, -0.0269468371f, -0.0508523621f, -0.154682532f, 0.0358180888f, -0.11635071f, -0.0528473184f,
+    0.0721522048f, 0.0545977652f, -0.0108872522f, 0.0183065571f, 0.0257105473f, 0.0526483469f, -0.0965613946f, -0.0437238924f,
+    0.0275137592f, 0.0521572307f, 0.0506156795f, -0.0487812459f, 0.0519849807f, 0.0371093489f, -0.0872731805f, -0.022262834f,
+    0.0336086117f, 0.00983372517f, -0.14493227f, -0.0137867657f, 0.0563815124f, 0.0148398224f, 0.112564899f, 0.10963136f,
+    -0.238331556f, 0.0729551911f, 0.106694229f, 0.00924075115f, -0.115363516f, 0.210230991f, 0.00469373586f, -0.0194231756f,
+    0.102107234f, -0.0232291277f, -0.0267317574f, 0.0669427961f, 0.159632489f, 0.154870436f, -0.00112189597f, 0.0203794148f,
+    -0.0916579515f, 0.00891584158f, 0.147892803f, 0.0410494246f, 0.0243916847f, 0.00752847455f, -0.0421289206f, -0.00746636605f,
+    0.0515233502f, -0.0325770974f, 0.0276500434f, -0.0490340628f, -0.0217571128f, -0.0642366633f, -0.0103428345f, -0.0547085293f,
+    -0.0287472643f, 0.0463035181f, -0.0193264205f, -0.0202888362f, 0.0162030291f, 0.031862352f, 0.0176629331f, 0.0413845107f,
+    -0.0500906371f, -0.0204731822f, 0.0163644888f, 0.0139626954f, -0.0649103001f, 0.00217438024f, 0.0177285075f, 0.0433587506f,
+    -0.0650854036f, -0.00495703379f, -0.0414625853f, -0.0168043282f, 0.00221147668f, 0.0250534639f, -0.0325137973f, -0.0305553135f,
+    -0.0207180995f, -0.0307793431f, 0.00808533933f, 0.0416708663f, 0.00191419816f, 0.00937289f, 0.00287052966f, 0.0232114363f,
+    -0.0403690338f, -0.026401354f, 0.0427552648f, -0.021864187f, -0.0243409332f, -0.00616179965f, 0.0341246575f, 0.0478248447f,
+    -0.0229725353f, 0.0196979064f, 0.018409716f, -0.0598861016f, 0.0446109101f, -0.106467083f, 0.0188785791f, 0.0361780673f,
+    -0.0491823442f, -0.0276485831f, 0.0179066546f, 0.0195704978f, -0.0126370927f, -0.0192275103f, -0.0728485435f, 0.00909797288f,
+    0.0092161959f, -0.0306220688f, -0.00833945535f, -0.037461184f, 0.0305240657f, -0.0339052454f, -0.0166785326f, -0.0559630804f,
+    -0.00982978009f, 5.58360625e-05f, 0.00561750634f, 0.0316708945f, -0.00313073886f, -0.029832216f, -0.0945083797f, -0.00888508465f,
+    -0.0376028977f, -0.0368153714f, 0.0129773412f, -0.0247410722f, -0.0316006057f, 0.0447263718f, -0.0198060293f, 0.00238859816f,
+    0.000400013058f, 0.0040417579f, -0.0601296388f, -0.0209960453f, 0.0173162427f, -0.0206135064f, -0.0398635119f, -0.0647801533f,
+    8.16082434e-07f, -0.0337807909f, 0.0122128595f, 0.014951502f, -0.0398505293f, 0.0043801167f, -0.0327783711f, 0.00295531005f,
+    -0.016564317f, -0.0152357779f, 0.023420956f, -0.0413682684f, 0.0393198878f, -0.00861573871f, 0.00181928603f, 0.0482657105f,
+    -0.0246248711f, -0.00206598337f, -0.0493967831f, 0.0272517167f, 0.0064939186f, -0.0298335198f, 0.0285053179f, -0.0413380004f,
+    -0.0500261076f, 0.0196646769f, -0.0350652337f, -0.00926405191f, 0.0442910418f, -0.0504644811f, -0.064007163f, -0.0139208296f,
+    0.0429982096f, -0.0569545962f, 0.0395807773f, -0.0523295403f, -0.0424909033f, 0.0318038799f, 0.030099662f, -0.0207469482f,
+    -0.0385385901f, -0.0333975963f, -0.0517077819f, 0.0372852087f, 0.0360194966f, -0.0605639853f, -0.0660258085f, -0.0300468523f,
+    -0.00488166651f, 0.00788664166f, 0.00879439805f, 0.0056728432f, 0.0104225781f, -0.065029107f, -0.0278271679f, -0.0479841754f,
+    0.0372342393f, 0.0163351875f, 0.0412104577f, 0.0331643112f, -0.00429592934f, 0.0269048046f, -0.0945333987f, -0.0413277932f,
+    -0.0256128367f, -0.0319184177f, -0.0362413451f, 0.0292934664f, 0.00947121438f, -0.0311033744f, -0.0193342622f, -0.0505735315f,
+    -0.0602229573f, 0.00697163213f, -0.0409572683f, 0.0203599855f, 0.0452278107f, -0.0244356114f, -0.013220693f, -0.057078395f,
+    -0.00422302075f, -0.064099133f, -0.0637477562f, 0.0239134133f, 0.0111176958f, -0.0043429127f, 0.023799587f, 0.0329274796f,
+    -0.0204092488f, -0.0032030025f, -0.00889065396f, -0.0339258537f, 0.0120879607f, 0.0161188524f, 0.00538800284f, -0.0701292008f,
+    -0.0600380078f, 0.029884804f, 0.00785404071f, -0.0206907298f, -0.0395176597f, -0.0679599345f, -0.0462914146f, -0.0488969944f,
+    0.0481438376f, 0.0069893687f, 0.0500331745f, -0.0115841869f, -0.0424451083f, -0.032554917f, -0.0477339737f, 0.0142828831f,
+    -0.0530817099f, -0.0619186424f, -0.0536669306f, -0.0541521497f, 0.0140568838f, -0.041921299f, 0.0448776595f, 0.0294079278f,
+    -0.0259060301f, -0.0212002713f, 0.0146542229f, -0.0702020898f, -0.0120849637f, 0.0374349505f, -0.0443114713f, 0.0102528445f,
+    -0.0441752523f, -0.0157107525f, -0.0606124289f, 0.0245675072f, 0.00185667991f, -0.0415846035f, 0.0193116963f, 0.0389762148f,
+    -0.0644889846f, 0.00302902958f, 0.0277456865f, 0.0362159461f, -0.0560501404f, 0.0035079096f, -0.0377437174f, 0.0353943445f,
+    -0.0395345353f, 0.0337366238f, 0.0473788828f, 0.00686375704f, -0.0041973996f, 0.034808442f, -0.0049226433f, 0.0364820883f,
+    -0.00185057067f, -0.0125073567f, -0.0585534014f, -0.0572953857f, 0.0389741585f, 0.0310671255f, -0.061122179f, -0.0131350774f,
+    -0.0103667136f, -0.0471840277f, -0.0614843592f, -0.00246417592f, -0.0477557667f, -0.0313857086f, -0.0350223929f, 0.0260293745f,
+    -0.0562479012f, -0.0598329641f, -0.0128485616f, 0.000667683198f, -0.0219372623f, 0.0225382391f, -0.0109360786f, -0.00486392621f,
+    0.0421396568f, 0.0397685654f, -0.0322629213f, -0.0148605034f, -0.0625460371f, 0.056522388f, -0.0146407699f, 0.0364065543f,
+    -0.018815212f, -0.0224440731f, -0.0250392593f, -0.0377134383f, -0.0454190113f, -0.026945984f, -0.0550290681f, 0.0245325286f,
+    -0.0053178044f, 0.161858737f, -0.131303176f, 0.0400772281f, 0.0180106051f, 0.109965332f, -0.0697797537f, -0.109271638f,
+    0.173215389f, -0.08166603f, 0.0737927034f, 0.0711690709f, -0.313249826f, -0.176983044f, 0.00155219878f, -0.00335136265f,
+    0.11331097f, -0.00514655281f, -0.149573162f, 0.189591587f, 0.145476311f, 0.0716017783f, 0.0580464788f, 0.00917222071f,
+    0.0911178663f, 0.026411904f, 0.436363399f, -0.000827565324f, 0.0177016202f, 0.00592039339f, -0.181284145f, 0.120440029f,
+    -0.00511882268f, 0.136260405f, -0.0084113339f, 0.0948654711f, -0.00834655948f, 0.143853024f, -0.0514627621f, -0.0609017387f,
+    0.154206485f, -0.0223111548f, 0.00976992585f, 0.0849367529f, -0.203165561f, -0.136403188f, 0.04518364f, 0.0751425922f,
+    0.0280783642f, 0.021229513f, -0.0603278875f, 0.177809238f, 0.0970258191f, 0.0822241455f, -0.176039398f, -0.015896095f,
+    0.0184315015f, -0.0756854936f, 0.411142468f, -0.0994870141f, -0.00155831873f, -0.0193244871f, -0.130575195f, 0.000854390615f,
+    0.00521749211f, 0.0381763652f, 0.00480134739f, 0.0428370796f, -0.0675380602f, 0.160618246f, -0.157721817f, -0.0994621441f,
+    0.117389195f, -0.0610417239f, 0.0411977768f, 0.0786456391f, -0.194280922f, -0.197145626f, 0.00521975616f, 0.0351364166f,
+    -0.00447620824f, 0.0647389665f, -0.116694748f, 0.111164592f, 0.0992222726f, 0.0739406869f, -0.107018612f, -0.0379295796f,
+    0.101584822f, -0.0466225296f, 0.377740085f, -0.0472702645f, -0.00315317768f, 0.0691329464f, -0.0390854515f, -0.00396500807f,
+    -0.0797669515f, 0.154568166f, -0.0814378411f, -0.035838902f, -0.0450209789f, 0.163683414f, -0.119962238f, -0.155196324f,
+    0.133079961f, -0.00290869945f, 0.0742491484f, -0.0203032047f, -0.247039452f, -0.183698982f, -0.0169305801f, 0.0528233536f,
+    0.0539182648f, 0.0486142933f, -0.103172325f, 0.0489026085f, 0.0485912152f, 0.0497618802f, 0.084350124f, 0.0104662301f,
+    0.0661637634f, -0.060938295f, 0.504436195f, -0.133609459f, -0.073652871f, 0.0774975345f, -0.309228063f, 0.105306096f,
+    -0.0772969127f, 0.0423390791f, 0.0224333163f, 0.0619425364f, -0.0661199018f, 0.0861186609f, -0.148319691f, -0.125447065f,
+    0.116056167f, -0.0447762199f, 0.0910527185f, 0.00156409224f, -0.13084197f, -0.198068991f, -0.0548071414f, 0.0526908711f,
+    0.0886678472f, 0.0618535876f, -0.171947703f, 0.080703944f, 0.121862456f, 0.0427639596f, -0.175914004f, -0.00737973955f,
+    0.0498533882f, -0.00813587476f, 0.375703692f, -0.0262703039f, -0.0648870617f, 0.0153998584f, -0.237330884f, 0.0588216856f,
+    0.00794982165f, 0.074538663f, -0.026699353f, 0.00629458623f, -0.063594237f, 0.118439846f, -0.126662925f, -0.118076764f,
+    0.0649760291f, -0.0238907076f, 0.108752176f, 0.0331601389f, -0.207171932f, -0.13969554f, 0.0178847946f, 0.0897750482f,
+    0.0173313823f, 0.0588594005f, -0.129264414f, 0.0899771824f, 0.0500118174f, -0.0514778569f, -0.115211479f, 0.065684855f,
+    0.0672596321f, -0.0822391436f, 0.465598851f, -0.16315639f, 0.0129400026f, 0.0174004454f, -0.156511948f, -0.0108704325f,
+    -0.0382392965f, 0.194071546f, -0.124954388f, -0.0808467418f, 0.0600847602f, 0.135920167f, -0.137066185f, -0.16095674f,
+    0.10149958f, -0.110273682f, 0.123181999f, -0.0784079507f, -0.336032271f, -0.22047396f, 0.0818046406f, 0.00242744829f,
+    0.135834217f, 0.0188408028f, -0.198833674f, 0.0112264426f, 0.0236795563f, 0.0174120385f, 0.013576963f, 0.0535055473f,
+    0.033038944f, -0.0984204113f, 0.518446922f, -0.129954308f, 0.0252378751f, 0.103733957f, -0.255639344f, 0.112770006f,
+    -0.00120378414f, 0.167164519f, -0.0832140893f, -0.130332023f, -0.064844586f, 0.135818258f, -0.191765159f, -0.224754184f,
+    0.102434129f, -0.0992432758f, 0.0752795562f, -0.0443357117f, -0.205906987f, -0.133805752f, 0.0336342938f, 0.101546779f,
+    0.0205196235f, 0.00307428534f, -0.166187286f, 0.0579730757f, 0.0153478058f, -0.0488287993f, -0.157270789f, 0.0183406901f,
+    0.0433152951f, -0.0372857749f, 0.483806461f, -0.0911335871f, -0.0369138531f, 0.0021331145f, -0.179403961f, 0.0526377894f,
+    -0.087274313f, 0.138902873f, -0.0960503295f, -0.101311415f, 0.0294275749f, 0.132611528f, -0.163447261f, -0.196692973f,
+    0.0905665383f, -0.0839655176f, 0.087398082f, -0.0838463008f, -0.242321685f, -0.227765217f, 0.0260147862f, 0.0477252603f,
+    -0.00374785461f, 0.0722887814f, -0.230640486f, 0.0230996367f, 0.0501158386f, -0.0492669828f, -0.0967666209f, 0.0636144951f,
+    0.0614878535f, 0.0410651267f, 0.460162282f, -0.157958671f, -0.026637923f, 0.127974212f, -0.208095267f, 0.0441071428f,
+    -0.00128552399f, 0.00844138768f, -0.0646677539f, 0.124748774f, 0.0229365043f, 0.0492833219f, -0.0626207441f, 0.30709967f,
+    -0.0667716414f, 0.0423347391f, -0.103427425f, 0.0700047314f, -0.252897859f, -0.0128064379f, 0.0897087976f, -0.123393364f,
+    -0.174438491f, 0.0136804255f, -0.0625763983f, 0.124428265f, 0.0434354842f, 0.125642583f, -0.257653773f, 0.00139525486f,
+    -0.101028979f, 0.0427943468f, -0.107446194f, 0.140104249f, -0.097000517f, -0.0168861728f, 0.144661874f, 0.0225245226f,
+    0.0448330864f, 0.00101941905f, -0.0916179344f, -0.00717852032f, -0.0928742439f, 0.0650519133f, -0.097053729f, 0.319232732f,
+    -0.0349654965f, 0.0787802413f, -0.0373128355f, 0.0875775069f, -0.160293967f, -0.127983272f, 0.0731086135f, -0.10816475f,
+    -0.294122726f, -0.102134272f, 0.00111126748f, 0.0165232997f, 0.071350947f, -0.0355650187f, -0.320831388f, 0.0130359801f,
+    -0.00947323442f, 0.13082093f, 0.0381584652f, 0.0550718307f, -0.0484962501f, 0.0157507751f, 0.17246449f, -0.0202720426f,
+    -0.000333204807f, 0.0253532771f, -0.0382496342f, 0.0266727507f, 0.114952609f, 0.122968428f, -0.0669971853f, 0.428333372f,
+    -0.0306579657f, 0.0566043295f, 0.0480092578f, -0.00219592056f, -0.100288361f, -0.184331149f, 0.0632211119f, -0.0317403711f,
+    -0.0917229652f, -0.0334322937f, -0.021118002f, 0.0669437274f, 0.0893234611f, 0.0957455486f, -0.00456036767f, -0.0677913278f,
+    -0.00448977947f, 0.0269390941f, 0.165619254f, 0.112507276f, -0.0361454189f, 0.0557759255f, 0.185492218f, -0.00861591846f,
+    -0.0132435858f, -0.0446180031f, -0.0867227688f, 0.0544960909f, -0.00681783119f, 0.0504564084f, -0.0788350776f, 0.347669631f,
+    -0.073572129f, 0.0432986319f, -0.147183239f, 0.0498157591f, -0.239221424f, -0.0481613614f, 0.0689440668f, -0.0463946909f,
+    -0.184053004f, -0.0476862825f, -0.121339731f, 0.0360438786f, -0.0143473577f, -0.0190830957f, -0.158374667f, -0.0308612362f,
+    -0.0340195373f, 0.0856917128f, -0.0546009764f, 0.113660544f, 0.0181957576f, -0.0708035678f, 0.149043247f, -0.0602719337f,
+    -0.0730451122f, -0.0300854761f, -0.107936569f, 0.0461487509f, -0.10396868f, -0.00332899718f, -0.0523528755f, 0.254101902f,
+    -0.0869363621f, 0.00929669105f, -0.162261471f, 0.0500903353f, -0.304013282f, -0.133931041f, 0.0813514218f, -0.105718538f,
+    -0.296482146f, 0.0180734918f, -0.120880067f, -0.0626588315f, 0.0113987261f, -0.0243148897f, -0.247708037f, -0.00410201075f,
+    -0.0493904389f, 0.121523269f, -0.0599010214f, 0.0531161986f, -0.0129628889f, -0.0530894324f, 0.135984167f, 0.00232487754f,
+    0.0630169734f, 0.0857718959f, -0.113108769f, -0.0426973328f, 0.000806580356f, 0.115609638f, -0.114909224f, 0.300734103f,
+    -0.086159423f, 0.0480367467f, -0.0296195913f, 0.0274625309f, -0.19911769f, -0.136321187f, 0.0842624977f, 0.0296141114f,
+    -0.120045722f, -0.0208078474f, -0.0590858534f, 0.037731342f, -0.0213206578f, 0.00720239012f, -0.0871149376f, -0.00778090628f,
+    0.0251833573f, 0.100144133f, 0.00803159457f, 0.0710785985f, -0.00522060599f, -0.0694055185f, 0.105986826f, 0.0257076975f,
+    -0.0249133743f, -0.00802198611f, -0.102626242f, 0.0677988231f, -0.0615606233f, 0.106222585f, -0.123148277f, 0.351672828f,
+    -0.123868652f, -0.011706898f, -0.108244546f, 0.110727012f, -0.162416026f, 0.0124273952f, -0.0131715816f, 0.00537496852f,
+    -0.206906483f, 0.0567215718f, -0.0797457248f, 0.00679310132f, -0.0138922241f, 0.0126785431f, -0.113607429f, -0.120668255f,
+    0.0140831638f, 0.135920689f, -0.1594394f, 0.0559137836f, 0.0716015846f, -0.0510733612f, 0.236901432f, 0.0167238414f,
+    -0.0707059726f, -0.0297698304f, -0.09342134f, 0.0522022173f, -0.0352587663f, 0.0460108928f, -0.110944703f, 0.200244352f,
+    -0.0365145691f, -0.0141110756f, -0.138668627f, 0.10225933f, -0.219096899f, 0.0151040126f, -0.0264661331f, -0.0632875934f,
+    -0.292732239f, 0.0789003819f, -0.177686989f, -0.0045639649f, -0.0600140877f, -0.0951243192f, -0.229661897f, 0.00853692461f,
+    0.0416897163f, 0.111965783f, -0.161233097f, 0.0192728732f, 0.0244600903f, -0.0721581429f, 0.240362316f, -0.0227941647f,
+    0.020089766f, 0.0201095548f, -0.103970744f, 0.00396876084f, 0.0893114731f, 0.0653872341f, -0.0917740539f, 0.358648688f,
+    -0.0339892544f, 0.101508789f, 0.0511781573f, 0.0615651384f, -0.201588005f, -0.0820361152f, 0.00814760104f, 0.0101104341f,
+    -0.167717487f, 0.0637023374f, -0.0598368421f, 0.0919282362f, -0.00950155035f, 0.0267846975f, 0.0580326952f, -0.0831505731f,
+    0.123083197f, 0.116713308f, -0.0205556098f, 0.00298770703f, 0.0573442057f, -0.00114800851f, 0.258466601f, -0.0550241582f,
+    0.0765367299f, -0.105132833f, 0.118182525f, 0.194866598f, -0.0638704374f, 0.0201085042f, -0.101887912f, 0.192751303f,
+    0.0371601209f, 0.0182661153f, -0.11042475f, -0.0143761905f, 0.187989891f, 0.0350360312f, -0.0300731249f, -0.0238282196f,
+    -0.150574848f, 0.0156137338f, 0.250403523f, 0.0677414238f, 0.0647050068f, 0.141007781f, -0.215514347f, 0.0400895327f,
+    -0.017136449f, 0.033551015f, -0.195574462f, 0.0746824741f, 0.0533249453f, -0.0219387077f, 0.248584509f, -0.00359706534f,
+    0.00183086004f, -0.0804594755f, 0.0635592118f, 0.173061967f, -0.141796052f, -0.0573662221f, -0.125497282f, 0.212082162f,
+    -0.0515499599f, -0.0492225029f, -0.17541486f, -0.0435651429f, 0.174784154f, -0.0266488995f, -0.0438163094f, 0.0525052734f,
+    -0.230648398f, -0.0286079925f, 0.186898276f, 0.0541976281f, 9.67790475e-05f, 0.0446488187f, -0.351264626f, -0.0333169922f,
+    -0.0545105971f, 0.14144209f, -0.147021398f, 0.0471637025f, 0.0116473837f, 0.0010145749f, 0.171923295f, 0.0384307876f,
+    0.0276307669f, -0.150961742f, 0.0893408582f, 0.123961434f, -0.0283327159f, 0.0236601382f, -0.130595997f, 0.271521658f,
+    -0.0506156124f, 0.0997989029f, -0.0464662053f, 0.067859754f, 0.218285546f, -0.0420208275f, -0.087676473f, 0.0460711047f,
+    -0.14080064f, 0.0321645811f, 0.172521785f, 0.19567515f, 0.0805877447f, 0.138046473f, -0.374447525f, -0.046990674f,
+    -0.019228369f, 0.131895036f, -0.0903252587f, 0.0655246153f, -0.0290328544f, 0.0283710938f, 0.241342306f, -0.00962904189f,
+    0.0415181182f, -0.0044735237f, 0.0735460818f, 0.120430321f, -0.117674403f, -0.0166664068f, -0.19348529f, 0.179083928f,
+    -0.00604196312f, -0.0524577312f, -0.15730992f, 0.0945956782f, 0.19814305f, -0.0948369652f, 0.0286174566f, -0.0207697302f,
+    -0.155431673f, 0.065645732f, 0.250383526f, 0.0869435668f, 0.0650656223f, 0.0504526347f, -0.185920969f, 0.0161227975f,
+    0.0496713184f, 0.105916806f, -0.199229866f, -0.0887221247f, 0.00817995705f, -0.0666371584f, 0.0757598355f, 0.00951503497f,
+    -0.0312372092f, -0.107742645f, 0.0538618341f, 0.0901013166f, -0.0863412246f, -0.010216373f, -0.127973497f, 0.210778505f,
+    -0.00413828762f, -0.000860966626f, -0.171275496f, 0.0354250036f, 0.189086795f, -0.151965722f, -0.125329733f, 0.0513435714f,
+    -0.197851673f, -0.00968224369f, 0.128471449f, 0.102466643f, 0.0319558904f, 0.0172583666f, -0.248629496f, 0.0136320964f,
+    0.0605325252f, 0.0459560603f, -0.168533623f, -0.123814419f, -0.0324185267f, -0.0121393371f, 0.0221872125f, 0.0367889702f,
+    -0.0334284939f, -0.0626812801f, 0.0448769443f, -0.0143580483f, -0.0297748223f, 0.0842534751f, -0.153338403f, 0.226265073f,
+    -0.0590741187f, 0.0082138991f, -0.0977470279f, -0.00457954779f, 0.215523049f, -0.0870930925f, -0.105023593f, 0.00383793749f,
+    -0.147446543f, -0.0137530947f, 0.200757831f, 0.189876869f, 0.0548773035f, 0.0803865865f, -0.304063737f, -0.0773187727f,
+    0.0334372334f, 0.125139967f, -0.133261397f, -0.0682249218f, 0.00741564669f, -0.0566313043f, 0.146687031f, 0.0585025474f,
+    0.0240107495f, -0.253485173f, 0.140138656f, 0.0904229209f, -0.08842884f, 0.00580217736f, -0.134848565f, 0.197803974f,
+    0.0192143321f, 0.0341617838f, -0.166407987f, 0.170254841f, 0.153615937f, -0.0244241394f, -0.0832352862f, -0.0035058863f,
+    -0.15096429f, 0.0440033711f, 0.249901727f, 0.118668191f, 0.0986262187f, 0.155574068f, -0.0317548439f, -0.101343997f,
+    0.0129258176f, 0.128168389f, -0.185652614f, -0.125766963f, 0.0711121708f, -0.085628815f, 0.408621669f, 0.0331479274f,
+    0.0603451803f, -0.20975931f, 0.117205992f, 0.104773104f, -0.140437111f, 0.0511696264f, -0.123703897f, 0.199137375f,
+    0.00523403659f, -0.0555813015f, -0.110615104f, 0.0985840112f, 0.131797537f, -0.0512502193f, -0.097906217f, 0.0493540466f,
+    -0.168058679f, 0.049931746f, 0.191138938f, 0.0659342632f, 0.0686201751f, 0.0558342077f, -0.196740299f, -0.127822787f,
+    -0.0258688945f, 0.171930626f, -0.291211754f, -0.117045358f, -0.000755499583f, -0.0650825873f, 0.289218336f, -0.0550491475f,
+    -0.018340461f, -0.264143318f, 0.128378436f, 0.0753319114f, -0.0530175269f, 0.0213045049f, -0.0242055152f, 0.25402227f,
+    -0.0206164494f, 0.0755502805f, -0.0874560326f, 0.110440247f, 0.135833681f, -0.0646339133f, -0.111321114f, 0.0754454732f,
+    -0.0962383524f, 0.0164098293f, 0.235649437f, 0.212006778f, 0.024701342f, 0.0801502392f, -0.261196643f, -0.0833824947f,
+    -0.00265735574f, 0.20831801f, -0.0783308148f, -0.00508387014f, 0.0926225483f, -0.0629221797f, 0.377060831f, -0.00213487842f,
+    0.111473247f, 0.123004906f, 0.111209378f, 0.180588722f, -0.523737729f, -0.199875042f, 0.0927492753f, 0.0427016765f,
+    0.153068453f, -0.470273703f, -0.299231082f, -0.215990335f, 0.209587634f, -0.288518101f, -0.0998373926f, 0.00412908429f,
+    -0.103099793f, 0.012211564f, 0.160205051f, -0.00909990352f, 0.11791794f, 0.12472032f, -0.298368424f, 0.00276616449f,
+    0.00784011651f, -0.384763241f, -0.156489387f, -0.00417054491f, -0.0116310809f, 0.223085821f, -0.616071641f, 0.0452246442f,
+    0.129906446f, 0.105879724f, 0.170421332f, 0.185473099f, -0.195415944f, 0.067808792f, 0.0607117079f, 0.0491451472f,
+    0.17672798f, -0.141527563f, -0.0205663331f, -0.206786454f, 0.135464907f, -0.207999662f, 0.040418487f, 0.0563503653f,
+    -0.0806996748f, -0.020158207f, 0.135892794f, -0.0437864363f, 0.0447577387f, 0.0771928728f, -0.11146421f, 0.0567769445f,
+    0.0563220493f, -0.111661911f, 0.26582095f, 0.018321516f, 0.0159356482f, 0.219959348f, -0.381877393f, 0.0533455275f,
+    0.196118608f, 0.0941883251f, 0.178204045f, 0.205094293f, 0.0040072999f, 0.195592612f, -0.0105301961f, 0.0388896354f,
+    0.211736888f, -0.0242103599f, 0.13284637f, -0.151064515f, 0.178060681f, -0.259351373f, -0.0657790005f, 0.136537388f,
+    0.0655062497f, 0.0918968916f, 0.195688546f, 0.169162959f, 0.195575714f, 0.199983001f, -0.0576356612f, -0.0354390256f,
+    0.132828295f, -0.0420963429f, 0.513099611f, -0.0995761454f, 0.0674250871f, 0.164295092f, -0.62230587f, 0.0260211658f,
+    0.0320747457f, 0.0797936022f, 0.00774701498f, -0.0465577394f, -0.459126323f, -0.149620757f, 0.0547496714f, -0.0754401833f,
+    0.0812497437f, -0.397145301f, -0.236121729f, -0.334829241f, 0.0926795304f, -0.249364629f, 0.00527226785f, 0.013757403f,
+    0.0604251921f, -0.00370145775f, 0.0476520844f, -0.144672856f, 0.0153575838f, -0.0255588647f, -0.366954684f, -0.0310298f,
+    0.0577551313f, -0.403761297f, -0.126145303f, 0.0594823733f, -0.100682355f, 0.211442322f, -0.583197594f, 0.0870689899f,
+    -0.0889883116f, 0.121313587f, 0.0916953012f, 0.0546954684f, -0.0825469792f, 0.129951164f, -0.0527227819f, -0.0896339789f,
+    0.108373277f, -0.13986139f, 0.130188897f, -0.22541368f, 0.0739798322f, -0.243668333f, 0.0338073932f, 0.0428810269f,
+    0.0677524433f, -0.0464783646f, 0.034510795f, -0.115395866f, 0.0117856823f, -0.0606399141f, 0.0178143214f, -0.0137852775f,
+    0.110204235f, -0.114094391f, 0.378104717f, 0.0442472063f, -0.0704561844f, 0.147758991f, -0.289063483f, 0.0354326144f,
+    -0.0394108631f, 0.11742992f, 0.109568499f, 0.0190308578f, 0.00826891046f, 0.232538745f, -0.0104409438f, -0.0407095253f,
+    0.0836387649f, -0.00341311586f, 0.188029766f, -0.106919333f, 0.152573749f, -0.178059012f, -0.0206570774f, 0.105214946f,
+    0.0371149778f, 0.00860610232f, 0.0594290681f, 0.0686560944f, 0.00368585321f, 0.0355893932f, -0.0515173897f, 0.0414411649f,
+    0.0647073314f, -0.0103641637f, 0.454216182f, -0.0535876863f, -0.0164352134f, 0.182249337f, -0.483698457f, 0.0237047207f,
+    0.0191274062f, 0.14689374f, 0.065213196f, -0.29156515f, -0.269620806f, -0.035189949f, 0.0129362652f, 0.145378023f,
+    0.119237229f, -0.288626373f, -0.0114507126f, -0.456227213f, 0.192263767f, -0.313798934f, 0.0412126444f, 0.0658086166f,
+    0.266020805f, -0.0413844734f, 0.166770026f, 0.0634806156f, 0.16532141f, 0.147456005f, -0.396292329f, 0.0849048719f,
+    0.103114352f, -0.30555889f, 0.2885423f, -0.0557406098f, -0.099698782f, 0.205864266f, -0.972172618f, 0.000709051848f,
+    0.00415559486f, 0.204251781f, 0.0208904333f, -0.241403922f, -0.100461803f, 0.164938286f, 0.0283424947f, 0.136778682f,
+    0.0847626328f, -0.068164058f, 0.097705856f, -0.285706639f, 0.166655064f, -0.315215558f, 0.0433515534f, 0.00962685049f,
+    0.119583108f, 0.017222438f, 0.0687334538f, 0.121943407f, 0.012456378f, 0.0821505189f, -0.107647896f, 0.0112643056f,
+    0.0684274733f, -0.0966982394f, 0.46651572f, -0.0272551868f, -0.0441651046f, 0.145817891f, -0.564485312f, 0.011728921f,
+    -0.046737209f, 0.163622081f, 0.124958806f, -0.178713694f, 0.0827103183f, 0.203335583f, 0.0904548168f, 0.106270485f,
+    0.103952549f, 0.0684675276f, 0.148273289f, -0.166378707f, 0.139428869f, -0.119900495f, 0.0619350672f, 0.051341325f,
+    0.0189044084f, 0.0790776163f, 0.0825603679f, 0.082763657f, 0.129427657f, 0.0919948742f, -0.102264389f, 0.108585894f,
+    0.0706471801f, 0.0204010401f, 0.485593349f, -0.086050868f, -0.0778343305f, 0.198551878f, -0.519535601f, 0.06131934f,
+    0.0352867544f, -0.0154226674f, -0.167280078f, 0.0131636802f, -0.0351704098f, 0.107553698f, -0.144817621f, -0.0883597881f,
+    0.047352884f, 0.0632644817f, 0.0285128001f, 0.109033182f, -0.300665468f, 0.0960771218f, -0.0296924543f, 0.0717432573f,
+    -0.133451164f, 0.0643592626f, -0.0619165413f, 0.107689023f, 0.0990497097f, 0.0326079391f, -0.00871900376f, -0.0182561409f,
+    0.0443732329f, 0.109478578f, 0.0173079167f, -0.053986147f, 0.0338901877f, -0.0916204304f, 0.205112979f, -0.0167334247f,
+    -0.0505179539f, -0.0374017805f, -0.0901662484f, 0.0590200759f, 0.0337460749f, 0.0654342026f, -0.0570909604f, -0.0696162656f,
+    0.0119024804f, -0.0258691311f, -0.063771084f, 0.00450534979f, -0.266758472f, 0.0591805913f, -0.0157265794f, 0.0606653281f,
+    -0.135417342f, 0.0348235071f, -0.0746098682f, 0.042688556f, 0.08481168f, 0.0787898451f, -0.120159067f, -0.0287593044f,
+    0.0153347664f, 0.069301486f, -0.00113798212f, -0.110541299f, 0.0829887316f, -0.0624210909f, 0.09028171f, -0.094289653f,
+    -0.0535446107f, -0.000858361949f, -0.120363943f, 0.0261982568f, 0.0281988513f, 0.0304400101f, -0.102088854f, -0.0861208737f,
+    0.0223446637f, 0.0215908997f, 0.0114055267f, 0.120053567f, -0.244086042f, 0.0887917653f, -0.0276670363f, -0.0190809462f,
+    -0.0587933846f, 0.102838866f, -0.143861115f, 0.12037307f, 0.0453458242f, 0.0798678324f, -0.196210563f, 0.0580016039f,
+    0.0535569414f, 0.0128785549f, 0.0199136771f, -0.0672362298f, 0.10293401f, -0.0107661365f, 0.185845941f, -0.0422590449f,
+    -0.0459103212f, -0.0833009556f, -0.0343100838f, 0.0509265251f, -0.0281812511f, 0.114753567f, -0.120007969f, 0.00818066578f,
+    0.024507273f, 0.0726230666f, -0.0239861589f, 0.0213443059f, -0.226128906f, 0.0289611798f, -0.0755472928f, 0.0777989924f,
+    -0.156874239f, 0.0844069347f, -0.073819913f, 0.0605647899f, 0.114173159f, 0.13165845f, -0.0597623587f, -0.000209688238f,
+    -0.00145077636f, 0.00753641129f, 0.0440686755f, -0.160592377f, 0.0520176888f, -0.0518206321f, 0.0449323766f, -0.024095336f,
+    0.0533955358f, -0.0723818988f, -0.127778277f, -0.0263618156f, -0.0305153225f, 0.0448522344f, -0.143454164f, -0.0484392457f,
+    0.00992357545f, 0.0227977764f, 0.00715672225f, 0.0132580949f, -0.27601406f, 0.071099855f, -0.013903413f, -0.0187533665f,
+    -0.0905601978f, 0.0150094694f, -0.0899232402f, 0.0559357405f, 0.0718842f, 0.0747972876f, -0.195066616f, 0.00880630035f,
+    0.0301339272f, -0.0262024179f, 0.0714931637f, -0.207115367f, 0.0272889528f, -0.000398726785f, 0.00529251341f, -0.0370865837f,
+    0.0446344838f, -0.0554753095f, -0.102260999f, 0.00177298533f, 0.000116905576f, 0.110432506f, -0.103058144f, -0.0437986106f,
+    0.0216972567f, 0.0573666543f, 0.0143528301f, 0.0823602304f, -0.251369715f, 0.126131207f, -0.0657724291f, 0.0140095288f,
+    -0.129111305f, 0.100373626f, -0.0787516683f, 0.0529813282f, 0.0472436771f, 0.11362496f, -0.227766216f, 0.00443758955f,
+    -0.0295869391f, 0.0793809965f, 0.00782941468f, -0.176546648f, 0.0859148577f, 0.00711361552f, 0.0850825533f, 0.00449996209f,
+    0.0112544382f, -0.0843795836f, -0.0412248597f, 0.0559981056f, 0.0736655891f, 0.0325737707f, -0.135646597f, -0.0370432809f,
+    0.0353754126f, 0.0312417485f, -0.0131263025f, 0.0727266669f, -0.303181559f, 0.0702166557f, -0.0507385917f, 0.017731322f,
+    -0.100254476f, 0.10480167f, -0.0823506117f, 0.100517653f, 0.077434063f, 0.0953164101f, -0.0110626286f, 0.063789852f,
+    -0.0162525717f, 0.102053307f, 0.0268226415f, -0.0603997819f, 0.0499002486f, -0.0467903465f, 0.285194427f, -0.00488696573f,
+    0.03549283f, -0.00425289944f, -0.133302301f, 0.0709689632f, -0.0219702926f, 0.128039658f, -0.0894894823f, -0.136906534f,
+    -0.01131141f, -0.0315315463f, -0.0327459611f, 0.0785522684f, -0.320245504f, 0.0210176278f, -0.0150081683f, 0.114222854f,
+    -0.100847483f, 0.108051457f, -0.167918861f, 0.0534727052f, 0.0229042247f, 0.0333738439f, -0.0682135001f, -0.0154580977f,
+    0.00644222228f, 0.0473545007f, -0.0148328431f, -0.205600545f, 0.125786111f, -0.065044567f, 0.198338315f, 0.00132575806f,
+    0.0468079858f, -0.0405155718f, -0.0988962203f, 0.0319967717f, 0.0207038969f, 0.134772137f, -0.0441951528f, -0.124897346f,
+    0.0784909353f, -0.0100267716f, -0.0381395593f, 0.0249020979f, -0.321319342f, 0.0443481579f, -0.021620011f, 0.0140116177f,
+    -0.0943820998f, 0.113427542f, -0.167679861f, 0.0424263775f, 0.0464126803f, 0.0780408382f, -0.140337229f, 0.0112690153f,
+    0.0946706459f, 0.115667284f, 0.0640106797f, -0.111243777f, 0.0981652811f, -0.0127309635f, 0.309850901f, -0.0387071818f,
+    0.102783881f, 0.145638436f, 0.255380332f, 0.168041289f, 0.0288509186f, 0.152335167f, 0.0219156984f, 0.294543207f,
+    -0.0618084148f, 0.0562118664f, 0.0584242307f, 0.0219817236f, 0.328656375f, -0.0175028648f, 0.092530407f, 0.00477250759f,
+    0.0299903881f, -0.0286755003f, 0.326518208f, 0.182895482f, 0.114371903f, 0.131847665f, 0.404818952f, 0.091255255f,
+    0.0569148622f, 0.119000606f, -0.0428799726f, 0.0050485977f, -0.10276302f, 0.102175072f, -0.253048182f, 0.0653480962f,
+    0.164250746f, 0.105276369f, 0.22868146f, 0.0458602421f, -0.117893569f, 0.0308536217f, -0.0460399054f, 0.204340145f,
+    -0.147866741f, -0.0848024786f, -0.0374896824f, -0.0224172603f, 0.2900289f, -0.0998806059f, 0.0877808332f, -0.00986127742f,
+    -0.0750040114f, -0.00959105138f, 0.213201717f, 0.190375239f, 0.134432957f, 0.171715483f, 0.29267624f, -0.0156855099f,
+    0.0831303596f, 0.090341121f, -0.0488039963f, -0.0510593094f, -0.0531511493f, 0.103394717f, -0.440695077f, 0.0575541072f,
+    0.165798932f, 0.0994170532f, 0.251933694f, -0.0616032705f, -0.100191534f, 0.0419058762f, -0.124979638f, 0.252615005f,
+    -0.0793828145f, -0.0391990878f, -0.11679852f, -0.0768398643f, 0.361679852f, -0.175620854f, 0.0186213013f, 0.0227516033f,
+    0.0614332184f, -0.0524891801f, 0.264925241f, 0.107111484f, 0.125428483f, 0.177247018f, 0.25748378f, 0.107311673f,
+    0.0889352039f, -0.0319227912f, -0.0156441499f, -0.090966925f, -0.0306164697f, 0.115311556f, -0.698314428f, 0.0748455971f,
+    0.0270435438f, 0.108492173f, 0.177313447f, 0.0642818809f, -0.0514519736f, 0.0117596202f, -0.0571887381f, 0.250895619f,
+    -0.149738729f, -0.124048799f, -0.0875719488f, -0.132205009f, 0.33207339f, -0.0597671457f, -0.0281041581f, -0.116632141f,
+    -0.0330289453f, -0.117131568f, 0.257754982f, 0.0612482689f, 0.115624137f, 0.173636883f, 0.196331277f, -0.00971329305f,
+    -0.0269870851f, -0.0628090948f, -0.0502350666f, 0.0260550324f, -0.164303616f, 0.0149632385f, -0.309709549f, 0.00902575906f,
+    0.0433981121f, 0.0715919137f, 0.236280173f, 0.106843144f, -0.151624426f, -0.0713448972f, -0.121902749f, 0.243585721f,
+    -0.156092808f, -0.11055731f, -0.119867086f, -0.0211598407f, 0.295315295f, -0.187267244f, -0.00923696812f, -0.0637261644f,
+    -0.182404399f, -0.0449251533f, 0.205307692f, 0.073731333f, 0.0677793622f, 0.101959996f, 0.198730975f, -0.0656580254f,
+    -0.0253451653f, -0.0691869482f, -0.164424121f, -0.0736062676f, -0.103364371f, 0.0451076105f, -0.331886828f, -0.0785301551f,
+    0.126266748f, 0.081991531f, 0.222322538f, -0.00916984584f, -0.133471921f, -0.134231731f, -0.0691157281f, 0.167206913f,
+    -0.17177996f, -0.0597123578f, -0.104663774f, -0.115841292f, 0.255324155f, -0.122724861f, -0.053852614f, 0.0358756483f,
+    -0.0447235368f, -0.0642598122f, 0.214867756f, 0.0197927225f, 0.126445517f, 0.111773357f, 0.352960914f, -0.0211939774f,
+    0.0411290489f, -0.0997678041f, -0.176349342f, -0.109013259f, -0.0304482169f, 0.0526321605f, -0.403533638f, 0.0138673987f,
+    0.173907146f, 0.0666678026f, 0.261438459f, 0.136468008f, -0.186501563f, -0.0689645857f, -0.146539211f, 0.277967781f,
+    -0.197357848f, -0.187152013f, -0.1998602f, -0.182650477f, 0.251860261f, -0.0730960295f, 0.0430673957f, -0.147257745f,
+    -0.0843589306f, -0.151141882f, 0.328320652f, 0.162952855f, 0.127658695f, 0.20263043f, -0.0249272808f, -0.0312092341f,
+    -0.059415143f, -0.132485241f, -0.183904603f, 0.0401708037f, -0.0976025537f, -0.0842644051f, -0.31251809f, -0.0664992481f,
+    0.0458159745f, 0.0913756564f, 0.175759465f, 0.186893731f, -0.258278042f, -0.173624694f, -0.143178791f, 0.295190275f,
+    -0.119330138f, -0.186754018f, -0.256985247f, -0.135367051f, 0.232049376f, -0.166710019f, -0.0469795614f, -0.106822975f,
+    -0.149639189f, -0.0726617426f, 0.263058335f, 0.134304881f, 0.0707355738f, 0.104170337f, 0.0463125445f, -0.0778929591f,
+    -0.069403097f, -0.125443444f, -0.361552924f, 0.0427339822f, -0.149794593f, -0.115279429f, -0.173714042f, 0.0443910658f,
+    0.117489286f, 0.0805240273f, 0.240107447f, 0.106084935f, -0.254858881f, -0.164885044f, -0.093174547f, 0.195178717f,
+    -0.11476671f, -0.153810441f, -0.198039815f, -0.0874245241f, 0.326847374f, -0.0822416246f, -0.0667273626f, -0.0501447357f,
+    -0.0768448561f, -0.0283788871f, 0.317717373f, 0.105002552f, 0.0685706511f, 0.14145942f, 0.304307818f, -0.0416393243f,
+    0.0235415325f, -0.0458025932f, -0.324532628f, -0.0201069657f, -0.00462507224f, 0.00816185307f, -0.194122881f, -0.0114825433f,
+    -0.0339775011f, 0.037735343f, 0.0943585932f, -0.175920814f, 0.158887982f, 0.00459170481f, 0.216206968f, 0.0272572543f,
+    -0.157036021f, 0.166717008f, 0.165585324f, 0.232683882f, 0.195401639f, -0.129548192f, 0.0864471942f, -0.156393483f,
+    0.32150352f, -0.122805387f, 0.00171186577f, 0.128895894f, 0.10163378f, 0.0558166169f, -0.24217622f, -0.034505859f,
+    -0.302691728f, 0.0572593473f, 0.0312058292f, -0.211394653f, -0.283385366f, -0.0448924191f, -0.220824599f, 0.15206416f,
+    -0.0243092403f, 0.110158473f, 0.033615943f, -0.183019221f, 0.121642083f, -0.0975052118f, 0.196350306f, -0.00720193237f,
+    -0.132677555f, 0.0775472075f, 0.1503741f, 0.232433721f, 0.0941850021f, -0.197028622f, 0.0889570788f, -0.0571723916f,
+    0.254814118f, -0.167217091f, -0.00220836257f, 0.0539251007f, 0.0768692791f, 0.0324707329f, -0.339982301f, 0.0282699671f,
+    -0.24123469f, -0.00851902086f, -0.0426549353f, -0.157067209f, -0.200540394f, -0.00777838007f, -0.168980688f, 0.125643268f,
+    -0.0192416906f, 0.0783581808f, 0.119204119f, -0.150896877f, 0.171735391f, -0.0268920101f, 0.178249106f, 0.0815453306f,
+    -0.0609708726f, 0.150795013f, 0.187100634f, 0.275617391f, 0.0892309397f, -0.225931033f, 0.0679764077f, -0.0766791925f,
+    0.279188335f, -0.0544489659f, 0.104171745f, 0.140719324f, 0.105818257f, 0.11957638f, -0.36052826f, -0.0149992984f,
+    -0.238608852f, 0.0442576781f, 0.0641293526f, -0.224928141f, -0.218453556f, -0.00584360166f, -0.135387078f, 0.107252091f,
+    -0.0625571758f, 0.0614718646f, 0.0495694615f, -0.207488298f, 0.136395112f, -0.0369070061f, 0.167127326f, 0.0136552239f,
+    -0.0943719819f, 0.0883029252f, 0.196967036f, 0.0540703908f, 0.114804693f, -0.0743521601f, -0.0273907203f, -0.0071337265f,
+    0.327323318f, -0.0302662607f, -0.0180608369f, 0.0479045138f, 0.0311309602f, 0.0808889344f, -0.205011129f, -0.0286859106f,
+    -0.185470074f, 0.0140237045f, -0.00997483917f, -0.177295685f, -0.216820493f, 0.0195244439f, -0.245413557f, 0.0421557538f,
+    -0.0800047368f, 0.0321767069f, 0.0720287934f, -0.260844111f, 0.114149697f, 0.00220512436f, 0.132196352f, -0.0304522775f,
+    -0.0944071561f, 0.0462344736f, 0.102435604f, 0.139866307f, 0.155658543f, -0.19137606f, -0.0270978753f, -0.0365104079f,
+    0.297644019f, -0.0355850719f, 0.0546083227f, 0.0700464845f, -0.0106129972f, -0.00683335168f, -0.306390196f, -0.0290373228f,
+    -0.12662597f, -0.0612668768f, 0.0343538448f, -0.23188521f, -0.156411126f, -0.0458203293f, -0.138553083f, 0.101449557f,
+    0.0129138241f, -0.0506464206f, 0.0779800862f, -0.222798437f, 0.0910143852f, -0.0905769691f, 0.139277607f, 0.0111493999f,
+    -0.132808402f, 0.0326706208f, 0.165266275f, 0.166081846f, 0.164674029f, -0.0980737284f, 0.0286700409f, 0.0159808174f,
+    0.288682729f, -0.124897636f, 0.0631795079f, 0.0224303082f, 0.00987503491f, 0.0543895923f, -0.419152886f, 0.0308684818f,
+    -0.139736488f, -0.00621340657f, -0.0912018865f, -0.206453741f, -0.219399437f, -0.00909717474f, -0.207039982f, 0.0130133871f,
+    -0.0658554807f, 0.0112508591f, 0.0929034129f, -0.249371886f, 0.114176326f, 0.0069915778f, 0.207431287f, 0.0496819727f,
+    -0.18414101f, 0.12992534f, 0.11727643f, 0.028058691f, 0.0928333104f, -0.145635828f, -0.0351670273f, 0.0114387982f,
+    0.334177375f, -0.0445399173f, 0.0372435562f, 0.0964622274f, 0.0674030259f, 0.100798935f, -0.236492798f, -0.0598320663f,
+    -0.17094636f, 0.0280977525f, 0.0612751245f, -0.306214333f, -0.153410628f, -0.103377678f, -0.35203734f, 0.0413222052f,
+    -0.00641106069f, -0.0706008896f, 0.0505477972f, -0.195913836f, 0.0823959783f, -0.0930117518f, 0.163155094f, -0.0255754367f,
+    -0.130781367f, 0.0855110586f, 0.108030304f, 0.0976729766f, 0.157991558f, -0.128834918f, -0.10467609f, -0.0197944846f,
+    0.292430609f, -0.0699927583f, 0.0791151822f, 0.0559868179f, -0.00971125718f, -0.000925076019f, -0.362364531f, -0.0912077501f,
+    -0.0785602257f, -0.0294503439f, -0.0194302779f, -0.248760119f, -0.171922833f, -0.0760816634f, -0.197519898f, 0.0406579189f,
+    -0.0428639948f, -0.125696406f, 0.094000116f, -0.263700753f, 0.0880678743f, -0.107644081f, 0.189631149f, 0.00243739923f,
+    -0.183472842f, 0.0478243269f, 0.132894546f, 0.0334197283f, 0.132144704f, -0.0414753072f, -0.127889842f, -0.0154631445f,
+    0.298059136f, -0.0840302259f, 0.012759937f, 0.0282244533f, 0.0652427897f, 0.00827766489f, -0.429887295f, -0.0785625279f,
+    -0.0381449535f, -0.060773164f, -0.101131476f, -0.292243868f, -0.215686619f, 0.0467627943f, -0.263118923f, 0.0877152532f,
+    0.066349797f, -0.0372482762f, -0.111142278f, 0.0843796432f, 0.175905317f, 0.106131405f, 0.197984025f, -0.0712877735f,
+    0.021980403f, 0.0989970192f, 0.281385273f, 0.119526252f, -0.0543217696f, 0.0961146727f, -0.0456705354f, 0.0476501919f,
+    0.306703001f, -0.0307838749f, -0.042602323f, 0.150499105f, 0.177103207f, 0.161461294f, 0.245764554f, -0.136707053f,
+    0.00336907036f, 0.0361115709f, 0.340490311f, 0.0390377156f, 0.023895761f, 0.0320954695f, 0.167174995f, 0.152100563f,
+    0.00214782357f, 0.1160274f, -0.0972884446f, 0.049077943f, -0.0543286279f, -0.0989628136f, 0.0632731095f, 0.00755538559f,
+    0.0170149226f, -0.0754742026f, -0.0342542306f, -0.099872306f, -0.00512888422f, 0.0978219807f, -0.0729735643f, 0.0161701776f,
+    -0.0124814603f, -0.0369548947f, 0.00146775448f, 0.0250568222f, 0.0102093648f, 0.111438833f, 0.0275079422f, -0.018264208f,
+    0.0503090657f, -0.0444193222f, -0.0655566081f, -0.00260741729f, -0.0952132121f, 0.0198923666f, -0.0584907196f, 0.00557373837f,
+    0.035184864f, 0.108087867f, -0.0754628032f, -0.0848021507f, -0.244150117f, -0.116312698f, -0.139741927f, 0.012132803f,
+    0.193560004f, -0.215810686f, -0.194047332f, -0.388884544f, -0.0172880217f, -0.14653638f, -0.0273975506f, 0.0367965437f,
+    -0.303624004f, 0.084462747f, 0.0396079086f, -0.10804414f, -0.0642574728f, 0.00311180577f, -0.137618288f, 0.0797177628f,
+    0.118212372f, -0.274049789f, -0.116320133f, -0.0423419327f, -0.0697035417f, 0.151605338f, -0.279767126f, -0.0634226277f,
+    0.0112621104f, -0.0903528854f, -0.128522411f, -0.0234483238f, 0.13567166f, 0.175804079f, 0.130889267f, -0.0715032667f,
+    -0.031737227f, 0.111687459f, 0.169582158f, 0.150483787f, -0.0271214396f, 0.144853577f, -0.0466892906f, -0.0279503409f,
+    0.209825754f, 0.0743217245f, 0.0455829166f, 0.0670075938f, 0.098112449f, 0.0570986234f, 0.219724864f, -0.151058704f,
+    0.108973958f, 0.111460835f, 0.308386028f, -0.0267989822f, -0.00596166169f, 0.0377777517f, 0.233714417f, 0.117633224f,
+    -0.083041504f, 0.119066626f, -0.104695402f, -0.0489714742f, -0.0560194664f, -0.0863265693f, 0.0799250156f, -0.0203516725f,
+    0.036915563f, -0.0325275138f, -0.10780564f, -0.0725115389f, -0.0300551038f, 0.120131247f, -0.0171601791f, 0.00350788003f,
+    -0.0955960229f, 0.0689598694f, 0.0468338765f, -0.00371519662f, 0.00417466694f, 0.0240765251f, 0.0890091509f, 0.0308760069f,
+    0.0209739506f, -0.096694164f, -0.0718915761f, -0.00204787846f, -0.0467510074f, 0.127222046f, 0.0710852146f, 0.0677149817f,
+    -0.0125551419f, 0.101318918f, 0.0144723384f, -0.149605885f, -0.299349934f, -0.14468649f, -0.255482465f, 0.00801286753f,
+    0.0939663053f, -0.334232271f, -0.323820144f, -0.463160187f, 0.0184410252f, -0.148930758f, -0.0611846298f, 0.0270262957f,
+    -0.28308332f, -0.0108977584f, 0.0834661201f, -0.127034202f, -0.11028336f, -0.0987653732f, -0.246303543f, 0.00582772912f,
+    0.136123478f, -0.221018121f, -0.051041387f, -0.0302392039f, -0.0712443069f, 0.234671101f, -0.303257585f, -0.123587847f,
+    -0.0260426421f, -0.0592466071f, -0.0967734233f, -0.0157283358f, 0.133631706f, 0.085529536f, 0.174481288f, 0.0109462915f,
+    -0.111744814f, 0.150841847f, 0.206684142f, 0.0973816589f, -0.0576716699f, 0.200154677f, -0.0561061203f, -0.0541421846f,
+    0.169429377f, 0.0619367547f, -0.0757246986f, 0.128280565f, 0.125953391f, 0.173255593f, 0.278901577f, -0.0465416834f,
+    0.020136131f, 0.0890112892f, 0.209123313f, -0.0206825119f, -0.0723942369f, 0.0629760474f, 0.268080473f, 0.115071841f,
+    -0.0715461373f, 0.145471394f, -0.0831700712f, -0.134330943f, -0.0113230925f, -0.156325817f, 0.110231213f, -0.0717606321f,
+    0.0791380405f, 0.05595579f, -0.0556477755f, -0.0580923967f, -0.0781156197f, 0.138980702f, -0.0396758132f, 0.0154036889f,
+    0.0625378639f, 0.0643483475f, -0.0138986902f, 0.0628248379f, 0.124867946f, 0.0908590853f, 0.0951246396f, 0.0181559604f,
+    0.0321452841f, -0.123848036f, -0.0516746715f, -0.0730885193f, -0.0727434307f, 0.11402335f, 0.00077777839f, 0.0352931693f,
+    0.0248776097f, 0.204069808f, -0.0399801359f, -0.328729331f, -0.187710539f, -0.0479667112f, -0.206742167f, -0.0680896342f,
+    0.0528671257f, -0.25403595f, -0.193984002f, -0.281461746f, -0.0642909333f, -0.187133044f, 0.0410651043f, 0.0943712294f,
+    -0.107325986f, 0.0395405591f, -0.0154587254f, -0.0992828459f, -0.0767998248f, -0.0972648934f, -0.22266829f, 0.0361896269f,
+    0.0666400194f, -0.241217822f, 0.0324770696f, -0.148827255f, -0.0298874415f, 0.176291198f, -0.366640866f, -0.0994515866f,
+    0.0148142884f, 0.136128917f, -0.0361616574f, 0.0590968095f, -0.0199165735f, 0.194747061f, -0.0170168132f, -0.129836783f,
+    0.148315787f, -0.0710808486f, 0.0993548557f, -0.0412981883f, -0.247303024f, -0.135184735f, -0.0288888291f, 0.0183913372f,
+    0.106338553f, -0.0369451605f, -0.171343789f, 0.115621351f, 0.145663083f, 0.0593753569f, -0.0199912582f, 0.00263650762f,
+    0.00229672552f, -0.104814641f, 0.439858586f, -0.0994517282f, -0.000661024067f, 0.0979685485f, -0.429196626f, 0.0443110578f,
+    0.0693064183f, 0.119286135f, -0.0682233796f, 0.0887178332f, -0.0786063746f, 0.0833955929f, 0.00934161618f, -0.097529009f,
+    0.180654332f, -0.0123258578f, 0.0697700754f, -0.0330455564f, -0.27035135f, -0.122821204f, -0.0454841368f, 0.0568575449f,
+    -0.00549790729f, -0.0343204923f, -0.147927403f, 0.113237515f, 0.186238766f, 0.0766148716f, -0.268702775f, -0.0395426638f,
+    0.0395125784f, -0.113348678f, 0.366593391f, -0.0471770838f, 0.00886053871f, 0.110278189f, -0.238652572f, 0.0156637114f,
+    0.057618361f, 0.111694098f, -0.0402806588f, 0.074001573f, -0.0037188814f, 0.130081445f, -0.0139332563f, -0.0848147944f,
+    0.147872001f, -0.0654841512f, 0.0627489984f, -0.0652641654f, -0.18878977f, -0.13989073f, 0.0596499071f, 0.0273402743f,
+    0.0426984318f, 0.0174398366f, -0.160278231f, 0.0697935969f, 0.0947125331f, 0.0619504005f, -0.243602768f, -0.0106172962f,
+    0.127544031f, -0.0745985359f, 0.385808229f, -0.130610824f, 0.0506601185f, 0.101246394f, -0.300795615f, 0.0435617603f,
+    -0.00481447857f, 0.141222358f, -0.0841423124f, 0.0023643116f, 0.0336853787f, 0.178176925f, -0.0505950861f, -0.127174675f,
+    0.155277953f, -0.0410934612f, 0.0968544632f, -0.188995481f, -0.202799067f, -0.159318179f, 0.0447400659f, -0.00377332303f,
+    0.137428552f, 0.0271227211f, -0.178818837f, 0.11944367f, 0.0849119201f, 0.064469479f, -0.0220475998f, -0.0194305368f,
+    0.0100053865f, -0.164321542f, 0.509483457f, -0.143343538f, -0.0351996459f, 0.0611767322f, -0.356078982f, 0.0567061752f,
+    -0.0295208544f, 0.151760221f, -0.0343463384f, -0.0584946983f, -0.039574068f, 0.103099361f, -0.0686007813f, -0.132276952f,
+    0.104872733f, -0.0726980492f, 0.13791503f, -0.183159247f, -0.160616487f, -0.172147244f, 0.0569588766f, 0.0735373348f,
+    0.0863318592f, -0.0279623754f, -0.0879857391f, 0.0991419554f, 0.170318887f, 0.0398717187f, -0.218217835f, 0.0284601413f,
+    0.0104635237f, -0.147884429f, 0.46483925f, -0.0614952445f, -0.0245989244f, 0.0323154628f, -0.22160843f, 0.0198869891f,
+    0.0380714312f, 0.0889610797f, 0.0230802912f, -0.0453431681f, 0.0513009802f, 0.157645449f, -0.0482434183f, -0.0829566047f,
+    0.164732695f, -0.0615352951f, 0.10794881f, -0.167475089f, -0.19421725f, -0.160454378f, 0.0143660428f, 0.123400748f,
+    0.0109570678f, 0.0256206524f, -0.0837411284f, -0.00882114284f, 0.112428814f, 0.0528345071f, -0.174428672f, -0.0209183805f,
+    0.0363710187f, -0.0679331422f, 0.464099407f, -0.16841571f, 0.0467993021f, 0.144422293f, -0.216633141f, -0.0241536126f,
+    -0.0599645115f, 0.167275339f, -0.0823090449f, -0.157011837f, -0.00447110832f, 0.175017625f, -0.0163128413f, -0.123985492f,
+    0.137742057f, -0.0184016656f, 0.103693701f, -0.216067523f, -0.378939152f, -0.234044328f, 0.044145532f, 0.0875808001f,
+    0.0943801329f, 0.00300227618f, -0.264938951f, 0.0433895513f, 0.135591149f, -0.00162160781f, -0.0171613973f, 0.0548508577f,
+    0.0727488846f, -0.104848407f, 0.505637348f, -0.168235123f, 0.0173097868f, 0.0762529671f, -0.368353188f, 0.095481351f,
+    0.0130675426f, 0.129114807f, -0.070451051f, -0.151628822f, 0.0592330508f, 0.173263669f, -0.0116848983f, -0.194598377f,
+    0.1154631f, 0.0212776493f, 0.0967846066f, -0.1592457f, -0.239801913f, -0.142989844f, 0.0896170735f, 0.0366880931f,
+    -0.00134272536f, 0.0269815177f, -0.259134203f, 0.0826597735f, 0.120496862f, 0.0264967047f, -0.219467938f, -0.0394392498f,
+    0.0979183167f, -0.133541405f, 0.428478122f, -0.145867407f, 0.00652332325f, 0.134334922f, -0.35836935f, 0.00803476013f,
+    -0.0192237012f, 0.153965682f, -0.0507405289f, -0.209269285f, 0.0682841688f, 0.151251316f, -0.0367087275f, -0.23481594f,
+    0.144123912f, -0.039249815f, 0.141867816f, -0.218937695f, -0.283622146f, -0.080737561f, 0.0242764149f, 0.0731063709f,
+    -0.0129517503f, 0.0985756814f, -0.196582779f, 0.00248047709f, 0.0682750717f, -0.0196558069f, -0.173693433f, -0.0358638167f,
+    0.0815627202f, -0.0716492236f, 0.449170768f, -0.207389697f, -0.0235761348f, 0.0424755141f, -0.365237176f, 0.0541114137f,
+    0.0633868128f, 0.070701398f, 0.0631721094f, 0.147214189f, -0.332665086f, -0.0820836127f, -0.0787974223f, 0.0188840348f,
+    0.10708078f, -0.30291f, -0.212223202f, -0.458261102f, 0.0923804641f, -0.27504006f, -0.0247356519f, 0.00213641417f,
+    0.0158160273f, -0.00887579191f, 0.102458805f, -0.0715840012f, 0.122108974f, 0.0884716883f, -0.0451275632f, 0.0495855995f,
+    0.0139377173f, -0.12592949f, 0.131472811f, -0.0941657946f, 0.0266706105f, 0.0656151474f, -0.385175288f, 0.022825744f,
+    0.0162980612f, 0.178938866f, 0.127277836f, 0.144215509f, -0.768348694f, -0.227233291f, -0.164641619f, 0.0279169977f,
+    0.191122323f, -0.538164079f, -0.616401792f, -0.428842545f, 0.0523893647f, -0.281546384f, -0.00776783563f, 0.0296477284f,
+    -0.347842544f, -0.0724985749f, 0.122119874f, -0.10699638f, -0.0382095762f, -0.0648884624f, -0.0997694358f, 0.0454414897f,
+    0.133421272f, -0.274602115f, -0.196805328f, -0.0815063938f, 0.0202156119f, 0.0910360217f, -0.554560065f, -0.0297034252f,
+    -0.0614965074f, 0.188569233f, 0.135710731f, -0.0115899844f, -0.391472667f, 0.109635994f, -0.144375265f, -0.0849947557f,
+    0.270236641f, -0.249691933f, -0.0418786593f, -0.501435876f, 0.116679281f, -0.447304219f, 0.0277035702f, 0.0792638436f,
+    -0.43190822f, 0.00695774378f, 0.131647632f, -0.113770179f, -0.0761494935f, -0.193328515f, -0.153375313f, -0.0127553968f,
+    0.117420241f, -0.111189954f, 0.627435982f, -0.0737814605f, 0.0203219336f, 0.145406544f, -0.765980482f, -0.0995326117f,
+    -0.0175679494f, 0.112584472f, 0.0852713957f, -0.158500761f, -0.0603497811f, -0.00330672693f, -0.00127796526f, 0.000916496152f,
+    0.0447848178f, -0.105721086f, -0.0356854647f, -0.0127625186f, 0.00163698988f, -0.00072026375f, -0.0776851997f, -0.011132556f,
+    0.142153606f, 0.0164556503f, 0.0696170852f, 0.079968974f, 0.0799967572f, 0.152762532f, 0.169864863f, 0.038865108f,
+    0.00756405946f, -0.130369827f, 0.140933946f, -0.117577858f, -0.0515632629f, 0.0904112309f, 0.105386898f, 0.00982955098f,
+    -0.0565755107f, 0.0902311727f, 0.0662209913f, -0.0666441321f, -0.311844409f, 0.00454512937f, -0.000924524793f, 0.0260433983f,
+    0.078777127f, -0.207939789f, -0.202236563f, -0.0303648915f, 0.0428036824f, -0.10783764f, 0.0662405714f, 0.0851441026f,
+    -0.121671394f, 0.0154932002f, 0.0267129671f, -0.0436484963f, 0.0880397409f, 0.0390986651f, 0.00452939421f, 0.0174011588f,
+    0.111103393f, -0.115182064f, 0.148696899f, -0.131420791f, -0.0422000848f, 0.0717551261f, 0.0428825468f, -0.0331934951f,
+    -0.0229080003f, 0.110595204f, 0.0299199801f, -0.195231244f, -0.0473713875f, 0.27994889f, 0.0139914453f, -0.0108901262f,
+    0.147623852f, -0.0363089778f, 0.109569229f, -0.130586594f, 0.0206249114f, -0.16195333f, -0.00044513293f, 0.0327879488f,
+    -0.152174965f, -0.0120026292f, 0.0629845113f, -0.0427262299f, -0.0640030429f, -0.0508395955f, -0.0207861084f, 0.0743098781f,
+    0.117132634f, -0.0580938868f, 0.742176771f, -0.161520734f, 0.0544271134f, 0.0771000683f, -0.0186025444f, -0.0732241571f,
+    0.0641079396f, -0.0370914675f, 0.178530157f, 0.0338523425f, 0.0273808427f, 0.0133795794f, 0.11297331f, 0.241546854f,
+    0.0577161871f, 0.0218090732f, 0.099372834f, -0.0395341255f, 0.1290088f, 0.14919965f, -0.101579554f, 0.00174412294f,
+    0.275732309f, -0.0765120462f, 0.160537452f, 0.173577115f, 0.265606672f, 0.284967959f, 0.0354351923f, -0.0354067422f,
+    0.0339747369f, -0.225685194f, 0.280738503f, -0.0757732987f, -0.131556228f, 0.0429453515f, 0.0745950192f, 0.0307833571f,
+    0.107531622f, 0.161538392f, 0.16649279f, 0.0511981547f, -0.066077061f, 0.0840230212f, 0.0854784548f, 0.0905363262f,
+    0.0527577251f, 0.0193849094f, 0.172462359f, -0.0647253096f, 0.148387879f, 0.088027209f, -0.0173973609f, -0.0531741269f,
+    0.196609735f, -0.0112092551f, 0.211277261f, 0.098290205f, 0.189834431f, 0.229479536f, 0.0799066052f, 0.00310272607f,
+    -0.0299070906f, -0.0913689658f, 0.491615236f, 0.00361451809f, -0.065859139f, 0.107473649f, 0.132227764f, 0.0836903378f,
+    0.0762225389f, 0.0868792385f, 0.101734608f, 0.0195878949f, 0.0760233551f, 0.294308692f, 0.0125788264f, 0.148892283f,
+    0.104335345f, 0.0355644114f, 0.217424423f, 0.00688328501f, 0.0476053506f, -0.0192640591f, -0.00139231572f, 0.029566858f,
+    0.141417414f, -0.0744585991f, 0.108344838f, 0.210547835f, 0.170345202f, 0.243423879f, -0.10682606f, -0.0679583475f,
+    0.0093307551f, -0.0121965325f, 0.720754802f, -0.00930371508f, -0.126552954f, 0.111681193f, 0.0503735319f, 0.0714904442f,
+    -0.00865435973f, 0.0157026984f, -0.00362179452f, -0.0577079877f, -0.0421221443f, 0.00895735528f, -0.0570850261f, -0.0745013729f,
+    -0.015069386f, -0.0282163881f, -0.0847020596f, 0.019574821f, -0.0135941701f, 0.00292657269f, -0.0454309285f, -0.0272397865f,
+    -0.087890476f, -0.0158966202f, -0.0463662744f, -0.061468333f, -0.0492510907f, 0.0331910364f, 0.000137334529f, 0.0195797626f,
+    -0.00330483774f, -0.0776534602f, -0.0575087219f, 0.0033726031f, -0.0372078903f, -0.00413044309f, 0.027083274f, -0.0722820312f,
+    -0.00862721819f, 0.0233213734f, 0.0354018286f, -5.39678913e-05f, -0.0357952714f, -0.0202412568f, -0.000620265026f, 0.0356258117f,
+    0.0143105639f, -0.00152323197f, -0.00535047799f, -0.0649935603f, -0.0151548525f, 0.00460968446f, -0.000618288177f, -0.0835069194f,
+    -0.0357908458f, -0.0277543683f, -0.0283271596f, 0.00119288242f, -0.00343213952f, 0.0388768427f, 0.0748396516f, -0.0198301282f,
+    -0.05339038f, -0.025825398f, -0.0287406612f, -0.020954933f, -0.0522280186f, -0.00445308676f, 0.0348479152f, -0.0842640102f,
+    -0.0684466735f, -0.0946589038f, -0.0454597399f, -0.00204105722f, -0.0449407883f, 0.00665005576f, -0.097514689f, 0.00553092966f,
+    -0.00249465392f, 0.0107194921f, -0.00418709172f, -0.0181272849f, 0.0419871397f, 0.0233295783f, -0.0735061616f, 0.00818333961f,
+    -0.0915697664f, -0.0551711731f, 0.0166568235f, 0.00667937892f, 0.0222960673f, -0.00509543205f, -0.0140080433f, -0.00127280899f,
+    -0.00671977224f, -0.0878334269f, -0.059392117f, 0.0302312467f, -0.0488702767f, -0.0162831955f, 0.00270024221f, -0.109052524f,
+    -0.0833590627f, -0.0492779687f, -0.00988289248f, -0.0187840499f, -0.0193412825f, -0.0571676865f, 0.0179282576f, -0.000669045257f,
+    -0.0100581069f, 0.0310043395f, -0.0476174727f, 0.0234166719f, 0.0309937894f, 0.00942667481f, 0.00198450522f, -0.0645325631f,
+    -0.100934729f, -0.0246244483f, -0.0553388856f, -0.00482796365f, -0.10866496f, 0.0567731485f, -0.0160876941f, -0.0787270963f,
+    -0.0785880536f, 0.006650561f, -0.0274977274f, -0.0805595368f, 0.0147385718f, -0.0433877558f, -0.00125886383f, -0.0813755989f,
+    -0.0710698143f, -0.0855757296f, -0.0160267167f, -0.0273206793f, -0.0752969012f, 0.0186480228f, -0.0358322226f, -0.0552731901f,
+    0.0176158547f, -0.0285301432f, -0.0458443984f, -0.0681454614f, -0.00130824291f, -0.00612573978f, -0.0191273615f, 0.0164863952f,
+    -0.0696116313f, -0.0454234071f, 0.0141282277f, -0.0465461351f, -0.0863109976f, -0.095762372f, -0.00870964769f, -0.0171100795f,
+    0.0299360957f, -0.0265307259f, 0.016157221f, -0.0529407114f, -0.0539941862f, -0.063072674f, 0.0385812744f, -0.0981847942f,
+    -0.0183649212f, 0.0128472727f, 0.050327681f, 0.0289176069f, -0.0992043018f, -0.00579299917f, -0.0144010549f, 0.0346513167f,
+    0.0489225499f, -0.0974526107f, 0.0289765354f, -0.001273431f, -0.059738636f, -0.00304811331f, 0.00365345529f, -0.0222155005f,
+    -0.0475490391f, 0.0529576652f, -0.0181386322f, -0.103024945f, -0.03033459f, -0.0665390268f, 0.0135704232f, -0.0793500245f,
+    -0.0836492032f, -0.0337103233f, 0.0632413104f, -0.00268443045f, -0.0577072762f, -0.00917957257f, -0.0344917998f, -0.0777578205f,
+    0.00616676314f, -0.0124963494f, -0.0536775775f, -0.000859864347f, -0.0443613417f, -0.0485353991f, -0.103550896f, 0.0442194305f,
+    -0.0752725303f, -0.0973758847f, -0.0563546196f, -0.0468569808f, 0.00672597112f, -0.0187085159f, -0.0655526519f, -0.0581768975f,
+    -0.0942844078f, -0.0412453562f, -0.0511058085f, -0.00809745584f, -0.0211882666f, -0.089061521f, 0.00623723259f, 0.0327580199f,
+    -0.0880618095f, -0.0599290505f, -0.0028641352f, -0.0255514197f, -0.0284301341f, -0.00616154633f, -0.0162840169f, -0.0604606122f,
+    0.021761911f, -0.00893346872f, 0.052515544f, -0.044536598f, -0.047858391f, -0.0699147657f, -0.119591042f, 0.00898799486f,
+    -0.0162033774f, -0.0765747204f, -0.0332396254f, -0.0193302911f, -0.0445162393f, -0.114819691f, -0.0105359089f, -0.110439055f,
+    -0.0166049339f, 0.0132093634f, -0.0222607572f, -0.00477818353f, -0.0762307718f, -0.0292151701f, -0.0862364918f, 0.00154198334f,
+    -0.0366572402f, -0.0795722529f, -0.0934958979f, -0.0111840796f, -0.0142247537f, -0.0495454147f, -0.0739139542f, -0.081129916f,
+    -0.0491877533f, -0.0548256002f, -0.014004454f, 0.044035811f, -0.0715183467f, 0.0312132929f, -0.030523248f, 0.0786211565f,
+    -0.10034591f, -0.0746829435f, -0.0435296819f, -0.00582303805f, 0.00541250827f, -0.0348077156f, 0.026013501f, -0.0264394972f,
+    -0.00669650454f, 0.0305027738f, -0.0718744323f, 0.00307111302f, -0.0718709677f, -0.0517986529f, 0.0637076721f, 0.018400548f,
+    0.027363956f, -0.059471935f, 0.0354335122f, -0.0230464209f, -0.0233847927f, -0.000148789069f, 0.0245519895f, -0.0651918054f,
+    0.0204622969f, -0.0224611051f, -0.117590763f, -0.0200600941f, 0.00780719612f, 0.147512302f, -0.0696172714f, -0.114662223f,
+    0.0302630812f, 0.0616380312f, 0.0037262761f, 0.156115636f, -0.174166411f, -0.00980672706f, -0.0359340794f, 0.00576876616f,
+    -0.0402712636f, 0.0697003528f, -0.061453525f, 0.182201117f, 0.120782956f, 0.080555208f, -0.0564670563f, -0.0447760671f,
+    0.0139849037f, 0.0875924528f, 0.120783344f, -0.174609616f, 0.0638463572f, 0.00787756965f, 0.1485392f, 0.0944401845f,
+    -0.0147824958f, -0.0712100714f, -0.0982729122f, 0.0073937648f, -0.0130554112f, 0.0395784155f, -0.104561396f, -0.10133794f,
+    0.118009314f, 0.0315859914f, 0.049639944f, 0.151575431f, -0.163558602f, 0.0430978574f, -0.0742092505f, 0.0174845215f,
+    -0.0177119263f, -0.0243718624f, -0.0496351793f, 0.142461926f, 0.0415745191f, 0.0361689217f, -0.143047586f, -0.0381506607f,
+    0.00265275454f, 0.0857158899f, 0.187846556f, -0.153800324f, -0.00976789929f, -0.0662860572f, 0.114251733f, -0.0140403109f,
+    -0.0233099274f, -0.0560176745f, -0.0265039615f, -0.0405868664f, 0.0165187046f, 0.0354254693f, -0.141499966f, -0.0431328155f,
+    0.122609399f, -0.00609373581f, -0.0150323771f, 0.197469443f, -0.158347249f, 0.0358291678f, -0.0211832132f, -0.00295166369f,
+    0.0254425202f, -0.00584167615f, -0.112566672f, 0.159484774f, 0.0495744161f, 0.109593399f, -0.0634721518f, 0.00931766164f,
+    -0.00423164153f, 0.0978305265f, 0.18351984f, -0.128960416f, 0.0501711257f, -0.0637062639f, 0.270564735f, 0.00948426872f,
+    -0.0432761945f, -0.0581355169f, -0.0547398068f, 0.0201623887f, 0.0561112687f, 0.0303033069f, -0.0941555873f, -0.0693055242f,
+    0.0490205511f, -0.0441231802f, 0.0237294249f, 0.108280338f, -0.234398797f, -0.00229342445f, -0.0944762677f, 0.0401913524f,
+    0.00631020404f, 0.0329076424f, -0.108532853f, 0.115232103f, 0.105664425f, 0.0279672276f, -0.0753242746f, -0.00798938144f,
+    0.00828142278f, 0.0437174439f, 0.227785572f, -0.0784830973f, -0.00900355168f, -0.0889321044f, -0.0173029657f, 0.0755164623f,
+    0.00462072575f, -0.0153883118f, 0.0385140106f, -0.0300275236f, -0.0036413013f, 0.115884572f, -0.0781640559f, -0.102066435f,
+    0.121002577f, -0.0384330153f, 0.0590912476f, 0.0767346248f, -0.224465385f, -0.043630477f, -0.0556072779f, 0.0354826562f,
+    -0.0221839119f, -0.0149241267f, -0.106167145f, 0.0991458371f, 0.0402636603f, 0.0902221575f, -0.0931262672f, 0.0412795469f,
+    0.00089550321f, -0.00297955144f, 0.195729733f, -0.109419659f, -0.01928363f, -0.0602648817f, -0.0380840153f, -0.0145329842f,
+    -0.0564943068f, -0.00341726327f, 0.0123297144f, 0.0777774751f, -0.0425255969f, 0.0784805492f, -0.120821677f, -0.130300373f,
+    0.100243829f, 0.00248890882f, -0.0500479192f, 0.0891713798f, -0.0974936262f, -0.034399908f, -0.0523297861f, 0.0535913147f,
+    -0.0561768971f, 0.0122077633f, -0.0041983719f, 0.0325222202f, 0.0513560101f, -0.0287805479f, -0.137061641f, 0.0571628213f,
+    0.0845382437f, -0.0106073245f, 0.0640004575f, -0.108692676f, -0.0216067657f, 0.0223415941f, 0.128458261f, 0.0296183135f,
+    -0.0903573036f, 0.0318471491f, -0.0268618688f, 0.0936300606f, 0.040910624f, 0.13148573f, -0.16855526f, -0.0799446702f,
+    0.0614634529f, -0.0370495692f, 0.021545589f, 0.155156195f, -0.315779626f, -0.0186405033f, -0.00331693678f, 0.0221278612f,
+    -0.0609604679f, 0.0405640043f, -0.159578398f, -0.00343032298f, -0.0421174653f, -0.0426708423f, 0.064605087f, 0.0672141463f,
+    0.0525056347f, 0.088380821f, 0.195348829f, -0.0784449875f, 0.034847267f, 0.0092693679f, 0.180354938f, 0.0147766862f,
+    0.0120008849f, -0.00184331869f, -0.0158671625f, 0.0525972433f, 0.0292429235f, 0.0893799961f, -0.159425348f, -0.127631873f,
+    0.0621969961f, -0.0420811474f, -0.0120793041f, 0.0458931513f, -0.283205956f, -0.0271295253f, 0.0280265808f, 0.103360042f,
+    -0.0540156476f, -0.00102093071f, -0.127329379f, 0.102910362f, -0.0165614728f, -0.00631294353f, -0.114043847f, -0.015640052f,
+    0.0578719676f, 0.140875146f, 0.139550582f, -0.176360592f, 0.0597358346f, 0.0103742778f, 0.165940419f, -0.0131042199f,
+    0.0167445634f, 0.0848332271f, -0.0751960427f, 0.0717660859f, -0.0531435199f, 0.0843984783f, -0.180931509f, -0.134364158f,
+    0.0842697173f, -0.0465165488f, -0.0201734733f, 0.158704907f, -0.199122891f, -0.0547044985f, 0.0278219301f, 0.111012049f,
+    -0.160024866f, 0.0562377386f, -0.192496866f, -0.049899742f, -0.0681701824f, -0.0825464055f, 0.0126676215f, 0.0209482368f,
+    0.0393645577f, 0.0696920678f, 0.0500794947f, -0.153284803f, 0.0894352496f, -0.0598591641f, 0.210909128f, -0.0368812904f,
+    -0.0674199387f, -0.0230661202f, 0.0251663588f, -0.0189365409f, -0.000606068294f, -0.042574767f, -0.0283515062f, 0.0485831872f,
+    -0.0465485454f, 0.00320342137f, -0.0555443726f, 0.0313405655f, 0.00176659611f, -0.0106066903f, -0.0167469252f, 0.0357719325f,
+    -0.0670437068f, 0.0347699299f, 0.0401706845f, 0.0202305913f, 0.0175364539f, -0.0353103578f, 0.0550726205f, -0.0026240896f,
+    0.0189982522f, -0.055424463f, 0.0157688912f, -0.0220885277f, -0.031186495f, -0.0626698583f, 0.0402541496f, -0.0317443348f,
+    0.0324344635f, -0.0348142236f, -0.0327093974f, -0.011800752f, 0.00638613384f, 0.00683413632f, 0.0326742344f, -0.000653618656f,
+    0.0343696661f, -0.0411752723f, 0.0319551043f, -0.0226765964f, -0.0401804335f, -0.0398317613f, 0.048558116f, 0.0110824946f,
+    0.0408157371f, -0.0280676205f, 0.00596133573f, -0.0120996851f, -0.012752722f, -0.0437011756f, -0.0516537353f, 0.034028966f,
+    -0.0446459241f, -0.0350506157f, 0.00256518647f, -0.0514427051f, -0.0140764387f, 0.0231802538f, -0.0604062527f, -0.0217935946f,
+    0.0178764798f, 0.0093231108f, -0.0150395446f, -0.0254860073f, 0.0339717902f, -0.0637267381f, -0.0320537426f, 0.00880855136f,
+    -0.0143021494f, -0.0526765399f, 0.0473800339f, -0.0150789479f, -0.0594118908f, -0.0397410281f, -0.0201470293f, 0.0151965199f,
+    0.0229122899f, 0.0338714086f, 0.0431415364f, -0.0417103954f, 0.0279295929f, 0.0448217615f, -0.0424844697f, -0.00932669826f,
+    -0.0496884845f, -0.00483930297f, 0.0691332743f, -0.0580154695f, -0.020472493f, -0.0348308235f, -0.0588458627f, -0.0211248398f,
+    0.0215501767f, 0.0315785445f, -0.00160009053f, -0.0427384153f, -0.00562415272f, 0.02766449f, 0.0383967012f, -0.0179574639f,
+    -0.0548330881f, -0.061270576f, 0.016157452f, -0.0288824588f, -0.0411122665f, -0.0471706539f, 0.0102572264f, 0.00828974228f,
+    -0.0745039731f, -0.00265944889f, -0.0182999242f, 0.027804317f, -0.0591225997f, -0.061405126f, 0.0407055318f, -0.0555918999f,
+    0.0423620231f, 0.00628738478f, -0.0448457003f, 0.020336356f, -0.0358904339f, -0.00388615113f, 0.0268516652f, 0.0188806709f,
+    -0.00116202282f, -0.0637385249f, -0.0301702991f, 0.0108668227f, -0.00861646235f, 0.0170724876f, -0.0684216022f, -0.0523856319f,
+    -0.066903837f, 0.0154167004f, 0.0289391112f, 0.0207503699f, -0.04213503f, 0.0234132297f, -0.00485080434f, 0.0262500588f,
+    -0.0204005018f, 0.0365318172f, -0.00324153528f, -0.0703385919f, -0.0501369908f, -0.0793479681f, 0.000864656758f, 0.0311794244f,
+    -0.0243372843f, 0.0189617369f, 0.0204568021f, -0.0237866305f, -0.00450505735f, 0.0324931741f, -0.0253426265f, -0.0603432842f,
+    0.00245299423f, -0.0685455874f, -0.0307375714f, 0.0392023362f, -0.0377347209f, -0.0423114374f, -0.0391330533f, -0.0365624726f,
+    -0.0595295429f, -0.00347350491f, -0.0441016406f, 0.0389375538f, 0.0142388782f, 0.00488382997f, -0.0466855727f, 0.0308553688f,
+    -0.0351143517f, -0.0442742258f, 0.0154883377f, 0.0492865853f, -0.0406127386f, 0.048858881f, -0.0511067696f, -0.0157290176f,
+    0.00036168308f, 0.030991368f, 0.0477823354f, -0.00651440956f, -0.0464901552f, 0.00585326971f, 0.00277569727f, -0.0364867598f,
+    0.0197141357f, -0.0616471395f, 0.0423525013f, -0.0207517073f, -0.0663187951f, 0.00383018446f, -0.044067312f, -0.0355460532f,
+    -0.0214843247f, 0.0200609379f, -0.00543990498f, -0.0221230127f, -0.0679171756f, -0.0262872763f, 0.000832001795f, -0.0351749994f,
+    -0.038251888f, -0.00707142008f, 0.0282750968f, -0.0652600676f, -0.0466344357f, 0.0333024971f, 0.00790471118f, 0.0445422493f,
+    -0.0546709597f, -0.0283504557f, -0.0377628319f, -0.0665210783f, -0.0595816225f, -0.0457324535f, 0.0307763275f, -0.0443863943f,
+    0.0212385841f, -0.0549384542f, -0.0349458531f, 0.0102345292f, -0.0123661235f, -0.00038939534f, -0.0365683064f, 0.0280626584f,
+    0.0315532237f, -0.0255015641f, 0.0405872352f, -0.0468898974f, -0.00425911089f, -0.0259722658f, 0.0222841613f, -0.0197236352f,
+    -0.0597648881f, -0.0487628207f, -0.0193048865f, 0.0385809429f, 0.031281352f, -0.00100867474f, -0.00662852079f, 0.0265923142f,
+    -0.052963011f, -0.0546292625f, 0.00185943034f, -0.0267496966f, -0.0287133064f, 0.0101904524f, -0.0610415526f, 0.0303456709f,
+    -0.0576260984f, 0.00363456225f, -0.0555566251f, -0.06550695f, -0.0632802173f, 0.0344798639f, -0.0156100579f, -0.00867695361f,
+    -0.0351086371f, -0.0388756469f, -0.0401355103f, -0.00701441569f, 0.00689403946f, 0.026204383f, -0.0415847339f, -0.0551647842f,
+    -0.0182494409f, -0.0289917924f, 0.0338539667f, -0.0257778466f, -0.0146635156f, -0.0943069309f, -0.0245400984f, -0.00867781416f,
+    -0.0162780974f, -0.0494357795f, -0.0107346391f, 0.00921414699f, -0.0390766636f, -0.0353148431f, -0.0652998909f, 0.00745094428f,
+    0.0451908559f, -0.008121958f, -0.121902145f, -0.0563621148f, 0.0802343413f, 0.0795628875f, 0.00167951803f, 0.0840239823f,
+    0.0225009229f, 0.186981082f, 0.129988417f, 0.246612832f, -0.0896171555f, 0.0321012475f, 0.0244864114f, 0.0235896055f,
+    0.0590092316f, 0.0251102746f, -0.0863115788f, 0.0407351777f, 0.0735971257f, 0.0192725938f, -0.231020913f, 0.0136580504f,
+    -0.0737685412f, 0.00516901165f, 0.175581992f, -0.0424236618f, 0.0132309627f, -0.00552520854f, 0.170319393f, 0.0348628163f,
+    0.0663165525f, -0.0206597801f, -0.0893804878f, -0.0514174514f, 0.0498813577f, 0.122819498f, -0.00644975249f, 0.00403799769f,
+    -0.00503629912f, 0.137409389f, 0.117357567f, 0.165922895f, -0.0522043779f, -0.034249831f, -0.059194766f, -0.0438251123f,
+    0.0841693804f, -0.0689709261f, -0.109284215f, 0.103255332f, 0.0981013477f, 0.00389044313f, -0.301071614f, 0.0391808115f,
+    -0.0329817496f, 0.00517489947f, 0.209357917f, -0.133763924f, 0.038242735f, -0.0748897418f, 0.206256583f, 0.0559029691f,
+    0.00357846427f, -0.0975619107f, -0.101994887f, -0.0164539069f, 0.0875882208f, 0.0604009442f, 0.0924934596f, 0.09294606f,
+    -0.032036379f, 0.171464518f, 0.147758469f, 0.196216583f, -0.118816748f, 0.0363662392f, -0.0136561794f, -0.0134103708f,
+    0.0694884285f, -0.00232922286f, -0.138007417f, 0.0820852965f, 0.102718465f, 0.0944137201f, -0.419116914f, 0.0491489992f,
+    -0.0729111731f, 0.0467049181f, 0.16850394f, -0.03696068f, 0.0268476214f, 0.0258679949f, 0.207726255f, 0.0660310015f,
+    0.0221879072f, -0.0683111399f, -0.102395304f, -0.0886337608f, 0.0823992342f, 0.027128024f, 0.0699080229f, 0.0642600954f,
+    -0.00390269258f, 0.145816788f, 0.16778864f, 0.124765985f, -0.143815264f, -0.0571845584f, 0.0101768188f, 0.0158375539f,
+    0.11177659f, -0.0320758559f, -0.108324364f, 0.117885597f, 0.0122082103f, -0.0129786404f, -0.26729098f, 0.00288629229f,
+    -0.0633311495f, 0.010203463f, 0.175340667f, -0.0679642409f, 0.00419561332f, -0.0454371683f, 0.128219858f, 0.0406053253f,
+    0.00857119076f, -0.073017858f, -0.0354183502f, -0.00360720628f, 0.0325191244f, 0.0603802428f, 0.00497083366f, 0.0352218486f,
+    -0.0067508244f, 0.0409907587f, 0.102111965f, 0.18327783f, -0.0796140656f, -0.0975139514f, -0.0620712936f, 0.0299542695f,
+    0.0866655633f, 0.0343195982f, -0.0772162601f, 0.05545488f, 0.00436831499f, 0.0883197337f, -0.239598781f, -0.0457313284f,
+    0.0454677045f, -0.00361959334f, 0.173433065f, -0.178489089f, -0.0156483483f, -0.0320727192f, 0.0611891747f, 0.0541449338f,
+    -0.0191469323f, -0.0221930649f, -0.108152352f, -0.0906346589f, 0.131054536f, 0.0922122449f, -0.00312351994f, 0.0629850775f,
+    -0.0194665305f, 0.0304373596f, 0.169234425f, 0.0800804049f, -0.0755191073f, -0.0781860575f, -0.0417286567f, 0.0408839397f,
+    0.125669882f, -0.0431338586f, -0.0775153786f, 0.112129278f, 0.0942838714f, 0.0829608962f, -0.433290333f, -0.0432086699f,
+    -0.0551964268f, -0.0500681438f, 0.120359756f, -0.162925288f, -0.0117363678f, -0.0307030715f, 0.135694012f, 0.0284471717f,
+    0.00441844342f, -0.0698351115f, -0.0137118483f, -0.0434496179f, 0.142288744f, 0.0401084609f, 0.0592985302f, -0.00740151899f,
+    0.0479720645f, 0.1326994f, 0.134553894f, 0.2426714f, -0.0667272434f, -0.0190802701f, -0.02908797f, -0.0282611419f,
+    0.130879864f, -0.00978408661f, -0.151939347f, 0.111107223f, 0.0152495494f, -0.0275908019f, -0.271004468f, -0.0583793744f,
+    -0.0346996598f, -0.012090819f, 0.154577255f, -0.105260499f, 0.0757948533f, 0.0264622141f, 0.222663999f, -0.0361257903f,
+    0.0473310649f, -0.077015385f, -0.107209377f, -0.0762425214f, 0.127945006f, 0.0865338221f, 0.0603228658f, -0.0293909125f,
+    0.0211016145f, 0.0204906818f, 0.0463107079f, 0.123001941f, -0.118870303f, -0.0916236714f, -0.0875380784f, 0.0161020514f,
+    0.0427834131f, 0.0515043251f, -0.138837337f, -0.00730737066f, 0.0582037456f, 0.0170765854f, -0.331667572f, 0.0253132917f,
+    -0.0225806888f, -0.0451980419f, 0.132984072f, -0.190286353f, 0.0361543186f, 0.0627682358f, 0.11474108f, -0.0227185227f,
+    -0.0489327833f, -0.0575666763f, -0.0194371045f, -0.0478486754f, 0.112679899f, 0.0964336246f, 0.0761443824f, 0.0276714247f,
+    0.0241143331f, 0.158406034f, 0.169900239f, 0.163494661f, -0.0937074423f, 0.00865056925f, -0.0901810825f, -0.0256371386f,
+    0.114855953f, 0.0456836894f, -0.1771404f, 0.0201944001f, 0.0465914309f, 0.00624354742f, -0.346085459f, -0.0367654078f,
+    0.0135465888f, 0.00161956099f, 0.148757622f, -0.131043822f, 0.088636823f, -0.0297565907f, 0.172145337f, -0.0300318226f,
+    -0.0237360504f, -0.0876837373f, -0.139908627f, 0.00166951225f, -0.0379710495f, -0.0533302091f, 0.0493823811f, -0.230936438f,
+    -0.00643176027f, -0.00344639551f, 0.0827698335f, -0.0313635208f, 0.01816459f, 0.170412719f, -0.0445786715f, -0.0655568317f,
+    0.0255513936f, 0.0293118823f, -0.356387317f, -0.0816729218f, -0.235424876f, 0.00825974066f, 0.0303355642f, 0.0838745609f,
+    0.0187403075f, 0.00900364853f, 0.0194809865f, -0.00286320434f, -0.0427011512f, 0.0938187465f, 0.0709019601f, -0.0530820675f,
+    -0.0474857055f, -0.0197534841f, -0.067350477f, 0.0876473486f, -0.0201363787f, -0.0542389303f, 0.0911870152f, -0.15596801f,
+    -0.0914973915f, 0.0133150704f, -0.00428455649f, 0.00227198051f, 0.0306672249f, 0.120333627f, -0.0533525459f, -0.0134204896f,
+    -0.0905357972f, -0.0134528168f, -0.317196012f, -0.057678476f, -0.186024383f, -0.0264381263f, -0.000107688691f, 0.064881146f,
+    -0.00876866188f, -0.021000402f, -0.104115069f, 0.0692796931f, -0.01498718f, -0.0301168486f, 0.0984913185f, -0.00174120779f,
+    -0.063586548f, -0.0647841841f, -0.0928697735f, 0.0460020304f, 0.0812919959f, 6.70274021e-05f, -0.00807487592f, -0.354526043f,
+    -0.0976485088f, 0.0648194924f, 0.00416785805f, 0.012963389f, -0.0419749059f, 0.172313988f, -0.0988409668f, -0.0493040457f,
+    0.00369614316f, -0.0796770751f, -0.35461989f, -0.111571021f, -0.187751442f, -0.10371843f, 0.130509824f, 0.0318318307f,
+    -0.0197432507f, -0.00221151183f, -0.0345263183f, 0.0531875268f, -0.0500573218f, 0.0373764858f, 0.00605245959f, -0.00684738578f,
+    0.0785394683f, -0.0529672801f, 0.0456742123f, 0.119248472f, 0.092908673f, -0.0828169286f, 0.0999654755f, 0.0531420633f,
+    -0.0609529838f, 0.11991594f, 0.066715613f, -0.00597773492f, 0.0875533968f, 0.142328158f, 0.00349574769f, -0.0795917809f,
+    -0.0131237777f, 0.0125665665f, 0.0995216966f, -0.000373388495f, -0.160721228f, -0.0039608907f, 0.165575504f, 0.0123137357f,
+    -0.00760727981f, 0.0588786118f, -0.0416083261f, 0.097418651f, 0.0534571931f, 0.0499838069f, 0.126641184f, -0.0228443742f,
+    0.050576251f, -0.0768976659f, 0.0829987377f, 0.0872684792f, 0.0201063212f, -0.030891994f, 0.11031229f, 0.21948342f,
+    -0.116135567f, -0.00498036155f, -0.0740894377f, 0.0436595865f, 0.0278609861f, 0.0675258785f, -0.0419236757f, -0.0303433295f,
+    0.0337619819f, -0.0427875035f, 0.121704869f, -0.0151380654f, -0.0428796709f, -0.0126388567f, 0.0831332803f, 0.0254658889f,
+    -0.0591820516f, 0.0259710252f, -0.209160864f, -0.0347140431f, 0.0833489224f, 0.110072158f, 0.0684721172f, 0.029758716f,
+    -0.0539532378f, -0.0752318576f, 0.0402165465f, 0.0511939675f, -0.0193833672f, -0.124058686f, 0.107238136f, 0.00958222616f,
+    -0.0130497618f, 0.00489091501f, -0.0897934958f, 0.0883191377f, -0.0372505076f, 0.0306733027f, 0.02310271f, -0.0123299602f,
+    -0.0863010734f, -0.0484526083f, -0.0198728889f, -0.159156501f, -0.137850836f, -0.0650952086f, 0.131342754f, -0.0103367697f,
+    -0.0415313616f, 0.0911704227f, -0.197405383f, 0.0420478545f, 0.0179273523f, 0.0306784436f, 0.0475484207f, -0.0350242592f,
+    0.173587948f, -0.134837821f, 0.140562624f, 0.102719359f, 0.0743501708f, -0.0819319785f, -0.00155176851f, 0.0136174113f,
+    -0.0289906915f, -0.0404668413f, -0.0567761883f, 0.20073919f, -0.246307373f, 0.201052576f, -0.0396001525f, -0.144839525f,
+    -0.0194977634f, 0.00488593895f, -0.0576406494f, 0.0861292928f, -0.222227439f, 0.0332984664f, 0.0180672389f, -0.0435576923f,
+    -0.0477892235f, 0.0515400134f, -0.296248883f, 0.0767504796f, 0.197353542f, 0.076236628f, 0.138440907f, -0.0477988645f,
+    0.160905272f, -0.0536300056f, 0.0448958129f, 0.0867486522f, 0.0241344739f, -0.146933034f, 0.174930319f, 0.0640751198f,
+    0.0865067914f, -0.0260582715f, -0.0644860864f, 0.198491946f, -0.19723253f, 0.129057139f, -0.0763840079f, -0.0933142528f,
+    -0.0690375566f, -0.0300780535f, -0.0319170617f, 0.0511870608f, -0.135364965f, 0.112590328f, 0.0656261593f, 0.0456824824f,
+    -0.112664372f, 0.126956239f, -0.240410805f, 0.0124849677f, 0.186246127f, 0.0223179813f, 0.0605297685f, -0.0488315932f,
+    0.148178011f, -0.0859177113f, 0.0276768003f, 0.0671539754f, -0.088124752f, -0.188415259f, 0.0192446113f, 0.0344731286f,
+    0.0709439665f, -0.0985236317f, -0.146957055f, 0.182017311f, -0.216869712f, 0.137086049f, -0.0111385165f, -0.0734304339f,
+    -0.00353555474f, 0.0334732644f, -0.202659011f, 0.0926875174f, -0.138089269f, 0.0472149365f, 0.0409273803f, -0.00666294107f,
+    -0.0857884362f, 0.0587349087f, -0.351990104f, -0.000904256245f, 0.184437335f, 0.0872971937f, 0.126224622f, -0.0899313912f,
+    -0.00480874721f, 0.142442197f, -0.023897361f, -0.00251667574f, 0.0855885372f, 0.14067696f, 0.0497979075f, -0.0944337919f,
+    0.240713358f, -0.00223254226f, 0.145812303f, -0.0406843685f, -0.102560028f, -0.281980455f, 0.0084276516f, -0.0815839395f,
+    0.215009987f, -0.0732792318f, -0.0555731282f, 0.176458403f, 0.194288924f, 0.158328965f, -0.0449979901f, -0.00315738632f,
+    -0.0109593868f, -0.0485855341f, 0.445643753f, -0.0572405569f, -0.126347035f, 0.261063308f, -0.485693246f, 0.0426102579f,
+    -2.28623212e-05f, 0.0895439163f, -0.040482942f, -0.0155980149f, -0.0352015123f, 0.103448845f, 0.0821145847f, -0.0879109427f,
+    0.261504978f, -0.0628417134f, 0.067655988f, 0.0505132638f, -0.125676051f, -0.283374578f, 0.0227424391f, 0.0586037524f,
+    0.126627192f, -0.122394674f, -0.0433857106f, 0.0920655057f, 0.154872909f, 0.208023056f, -0.288658053f, -0.0839241669f,
+    -0.0412998311f, -0.0741432458f, 0.358230084f, -0.0614634566f, -0.090563789f, 0.171486437f, -0.367363632f, -0.00490560429f,
+    0.0732832029f, 0.116483144f, 0.0232825223f, -0.0190234929f, 0.00916874781f, 0.183405712f, -0.0398092791f, -0.140731037f,
+    0.381564975f, -0.0330666304f, 0.138175681f, -0.00146939687f, -0.0372395292f, -0.263293892f, 0.0309310891f, 0.0517435223f,
+    0.0520728491f, 0.0126565145f, -0.0560143143f, 0.0625368133f, 0.17017813f, 0.167412117f, -0.289628267f, -0.0964704677f,
+    0.0783530995f, -0.0501326621f, 0.432085723f, -0.0367292725f, -0.0359365828f, 0.214156955f, -0.431750178f, 0.0774537623f,
+    -0.12230318f, 0.198882654f, -0.0772620887f, -0.158374399f, 0.058446575f, 0.170983732f, 0.0963580087f, -0.171166942f,
+    0.170183867f, 0.0530920923f, 0.217474848f, -0.104227774f, -0.131251916f, -0.29708305f, 0.068198584f, 0.0420186631f,
+    0.241877973f, -0.0334496014f, -0.0820563287f, 0.0518516451f, 0.196929887f, 0.0965611786f, 0.0294947829f, 0.0258252732f,
+    0.0162568726f, -0.148063838f, 0.498834431f, -0.2059495f, -0.208503768f, 0.308813065f, -0.532908559f, 0.0270688701f,
+    -0.0551951192f, 0.109794751f, -0.12260443f, -0.200320989f, 0.0604077615f, 0.102812856f, 0.0178469773f, -0.189513519f,
+    0.227688745f, 0.0149179315f, 0.119920492f, -0.0742122382f, -0.0968542248f, -0.258253038f, 0.0220829099f, 0.0651923716f,
+    0.1231452f, -0.030692447f, -0.00387283298f, 0.044059962f, 0.134343222f, 0.107731506f, -0.247076601f, 0.0179353692f,
+    0.0203293897f, -0.122131415f, 0.418995678f, -0.115718134f, -0.12504375f, 0.150608301f, -0.417618036f, 0.0909692273f,
+    -0.0220069308f, 0.106881209f, -0.0441376679f, -0.196862042f, 0.011282065f, 0.151211336f, 0.0298368018f, -0.183650225f,
+    0.202546284f, 0.0234556515f, 0.182712168f, -0.0865529478f, -0.114315912f, -0.205249026f, 0.0755665377f, 0.0585440099f,
+    0.0854159296f, 0.0285655838f, -0.100762159f, 0.0847678557f, 0.0814811364f, -0.0107305283f, -0.287804037f, 0.0429007299f,
+    0.115847796f, -0.100314751f, 0.464571089f, -0.169914439f, -0.087256588f, 0.288755685f, -0.436701268f, 0.0568426587f,
+    -0.156413749f, 0.248802826f, -0.0650670081f, -0.43487832f, 0.0582221113f, 0.13466838f, 0.00453817332f, -0.177812278f,
+    0.134032264f, -0.0404499583f, 0.236539021f, -0.242726758f, -0.110279053f, -0.372301847f, 0.13707754f, 0.100966111f,
+    0.22050868f, 0.0257869009f, -0.139942124f, 0.0574052036f, 0.152049214f, -0.0124523165f, 0.0128554087f, 0.0755579546f,
+    0.0720460638f, -0.123245396f, 0.51248765f, -0.214382395f, -0.146388829f, 0.373118401f, -0.630396485f, 0.101717539f,
+    -0.0994775742f, 0.181723699f, -0.0682935715f, -0.385231674f, 0.0839571059f, 0.155332908f, -0.0212257467f, -0.206676647f,
+    0.168039724f, 0.0576122552f, 0.135560587f, -0.171766207f, -0.155581057f, -0.250401646f, 0.0165224038f, 0.0634665936f,
+    0.172104955f, -0.0096554514f, -0.125828326f, 0.0269449987f, 0.164360747f, 0.082243003f, -0.210175768f, 0.0278191585f,
+    0.102048874f, -0.0619156025f, 0.451844484f, -0.245382234f, -0.0573229454f, 0.185281247f, -0.533504665f, 0.0106476825f,
+    -0.124178313f, 0.121808939f, -0.135055795f, -0.397914529f, 0.132301524f, 0.15172416f, -0.0117931552f, -0.14328973f,
+    0.160247341f, 0.0760580972f, 0.204062417f, -0.17801407f, -0.128521532f, -0.203281224f, 0.0385770649f, 0.108097225f,
+    0.105013698f, 0.127140105f, -0.115608029f, 0.0589422472f, 0.0669429526f, -0.0173774622f, -0.238842875f, 0.00473485002f,
+    0.126860648f, -0.0715424046f, 0.413268626f, -0.174323842f, -0.0256546885f, 0.271411449f, -0.551023602f, 0.0807446912f,
+    -0.0129569229f, -0.097136721f, -0.231283084f, 0.0687487945f, -0.0178201459f, 0.0645597801f, -0.105008282f, 0.19409278f,
+    0.00578303263f, 0.0204851162f, -0.090597555f, -0.139800534f, -0.349317998f, 0.0580070429f, -0.0424067937f, 0.0152443377f,
+    -0.308774054f, 0.0913575068f, -0.261877477f, 0.0335848704f, 0.0358391814f, 0.0410172716f, -0.002072389f, -0.0244543366f,
+    0.0186866689f, -0.0234486982f, 0.0848709941f, 0.0745822713f, 0.10894908f, -0.0980962738f, 0.125946537f, -0.173731968f,
+    0.0194921605f, -0.081876725f, -0.264441043f, -0.0219778232f, 0.0638064817f, 0.0690030605f, -0.1279324f, 0.104415141f,
+    -0.0271718558f, -0.00676661637f, -0.0953605697f, -0.247130051f, -0.437877506f, 0.158714488f, -0.191759467f, 0.0209061187f,
+    -0.294570059f, 0.0875739306f, -0.33257845f, 0.0647211671f, 0.138443142f, 0.0595423207f, -0.0647411197f, -0.0926975757f,
+    0.0390546732f, 0.0062032491f, 0.0395640172f, -0.00434145005f, 0.0717477649f, -0.143873647f, 0.194163427f, -0.169806853f,
+    0.0110407816f, -0.0877551585f, -0.348385781f, 0.113734402f, -0.0680547804f, 0.0563936904f, -0.101346336f, 0.149505988f,
+    0.041853983f, -0.0497582853f, -0.0636299849f, -0.272819817f, -0.396869272f, 0.187073529f, -0.111621805f, 0.01696283f,
+    -0.303361416f, -0.00134760886f, -0.295497656f, 0.0181892868f, 0.0738472715f, 0.012506594f, -0.339812309f, 0.00418187585f,
+    -0.0388499647f, 0.0626228079f, 0.0167055801f, 0.151015043f, 0.0503450781f, -0.112257116f, 0.210124761f, -0.058574155f,
+    0.100382663f, -0.122036375f, -0.268244535f, 0.0139725264f, 0.00384005485f, 0.0483363047f, -0.0213440321f, 0.241754696f,
+    -0.0148173282f, 0.0637337789f, -0.0287636481f, -0.119351819f, -0.344975203f, 0.130917087f, -0.150340408f, -0.0343355499f,
+    -0.299165756f, 0.0813692436f, -0.141177014f, 0.148764893f, 0.111466654f, 0.182402864f, -0.0622357316f, -0.0264537819f,
+    0.0330941044f, 0.0195800327f, -0.00700227031f, -0.0248892624f, 0.0369177796f, -0.112463042f, -0.0414899625f, -0.126820505f,
+    0.0726069734f, -0.00380366482f, -0.247417286f, 0.0498778783f, 0.0026506111f, 0.137671247f, -0.0599205084f, 0.213787094f,
+    0.0641772151f, 0.0224989988f, -0.0174707752f, -0.384456635f, -0.36624229f, 0.183630139f, -0.15820609f, -0.00827016402f,
+    -0.259217888f, 0.0611117445f, -0.0887443945f, 0.126284003f, 0.226510763f, 0.228137538f, -0.151301861f, -0.0152953779f,
+    -0.039802976f, -0.0255735703f, 0.149664938f, -0.0698871538f, 0.0145523278f, -0.0238824524f, -0.232152879f, -0.0472211018f,
+    0.0632487237f, -0.0186570138f, -0.243160397f, 0.0159537122f, -0.0318630338f, 0.145027697f, -0.0637867153f, 0.279299766f,
+    -0.0276817884f, 0.0738608688f, -0.00793861225f, -0.261657029f, -0.370169014f, 0.100597203f, -0.0326394662f, 0.0207290463f,
+    -0.249579877f, 0.00537090935f, -0.173896551f, 0.215246111f, 0.18727389f, 0.220064387f, -0.256980509f, -0.0205441136f,
+    -0.0626548827f, 0.0405984111f, 0.00478961738f, 0.0194484368f, 0.0438688248f, -0.0657564253f, -0.177849919f, -0.108906299f,
+    -0.0182464477f, -0.37041381f, -0.28549251f, 0.0234062616f, 0.0591980703f, 0.121655464f, -0.0459854044f, 0.158846945f,
+    0.0570878498f, 0.157467991f, -0.0217477288f, 0.0961293057f, -0.379011422f, 0.241528079f, -0.259516001f, 0.0291367918f,
+    -0.259062588f, 0.000721781107f, -0.151875868f, 0.066049315f, 0.063469857f, 0.107127696f, -0.0515810438f, -0.0762779489f,
+    0.058287438f, 0.0498344377f, 0.0393456481f, -0.0491226129f, 0.136807844f, -0.0702530965f, 0.142535746f, -0.0319512561f,
+    0.0946141481f, -0.306216657f, -0.279011548f, 0.0430311449f, 0.0834394991f, 0.183907852f, 0.00861681625f, 0.210433066f,
+    0.0617474169f, 0.11762625f, -0.00457263226f, -0.00612902269f, -0.351286322f, 0.0613839626f, -0.222330227f, 0.0496949218f,
+    -0.139316082f, 0.0953255892f, -0.196260333f, 0.166037902f, 0.192966416f, 0.153353572f, -0.0555708297f, -0.0730967596f,
+    0.0817865953f, 0.0193167273f, 0.145635381f, -0.0278822314f, 0.150190845f, -0.107821532f, -0.126589522f, -0.101905361f,
+    0.0150537314f, -0.252322614f, -0.233724371f, 0.0745414197f, -0.00510984752f, 0.151016727f, -0.0231057368f, 0.196799934f,
+    0.00148124446f, 0.0424197055f, -0.0696640089f, -0.0155317755f, -0.38899681f, 0.0563534498f, -0.15180859f, 0.0784831867f,
+    -0.189388752f, 0.0319398791f, -0.227960303f, 0.170659527f, 0.193673581f, 0.102904208f, -0.0751823857f, -0.0595392585f,
+    -0.0118234139f, 0.0471248701f, 0.0836117566f, -0.016230287f, 0.159025103f, -0.116122156f, 0.0200046655f, -0.00238630106f,
+    0.0677408129f, 0.0386661999f, 0.0320982039f, -0.00619564159f, -0.0697441548f, -0.0161216445f, -0.0133698275f, -0.110032856f,
+    0.118248418f, -0.0365532935f, -0.0115241222f, 0.103150897f, 0.0201815832f, -0.0562547371f, -0.0334833711f, 0.128869399f,
+    0.044924587f, 0.0964642018f, 0.00247094641f, -0.140400693f, -0.0684714615f, -0.033700563f, -0.172409192f, 0.0435928628f,
+    0.146037444f, -0.105722517f, 0.0111832395f, 0.0914651379f, -0.0154059231f, 0.00261241966f, -0.236136898f, 0.018288482f,
+    0.131932333f, -0.0187932681f, 0.0284193568f, -0.0262134187f, -0.0768717825f, 0.0772286654f, -0.0406174175f, -0.164351046f,
+    0.0312280506f, -0.0776537284f, -0.0416708142f, 0.0360803865f, 0.0148268072f, -0.000886867114f, -0.111033536f, 0.135246947f,
+    0.0515191108f, 0.0851402879f, -0.000315186044f, -0.176799908f, -0.115336776f, -0.0846751928f, -0.193988964f, 0.0547172986f,
+    0.0739541799f, -0.00121671462f, 0.0268604364f, -0.0172199924f, -0.0103661548f, 0.00320119434f, -0.166230634f, -0.0251814257f,
+    0.137152284f, 0.011199587f, 0.0881695747f, 0.0738414526f, 0.00414832961f, 0.0523432307f, -0.0225613303f, -0.132360831f,
+    0.0300888047f, 0.0537445582f, 0.0190738253f, 0.0623915046f, 0.0987721384f, -0.0357117429f, -0.121515267f, 0.136913061f,
+    0.263140142f, 0.115047663f, 0.0457254238f, 0.0308427028f, -0.0130437762f, -0.0659242719f, 0.0731496587f, 0.0723210126f,
+    0.098514609f, -0.0193828177f, 0.2021081f, -0.0745683014f, 0.0879514441f, 0.0137437442f, -0.190481246f, 0.0315878876f,
+    0.0411110632f, 0.105332322f, 0.0893908143f, 0.0363797992f, -0.0609045997f, 0.0195440035f, -0.0173369255f, -0.116504923f,
+    0.0902805552f, -0.0459929779f, -0.0301716626f, -0.0582226813f, 0.0669815987f, -0.0163428448f, -0.00482320599f, 0.064646475f,
+    -0.0834192932f, 0.0910050496f, -0.0331064351f, -0.114371821f, -0.110129192f, -0.0745608136f, -0.226840034f, 0.0189818591f,
+    0.139981925f, -0.106914483f, 0.0123504438f, 0.110015817f, 0.0883579627f, 0.0692379177f, 0.0195949897f, -0.0288694464f,
+    0.0952036455f, 0.0482597239f, 0.119300522f, 0.0270390287f, -0.0572525151f, -0.0192915201f, -0.0214118976f, -0.069432281f,
+    0.120814577f, -0.0347930938f, -0.0819164589f, -0.0672867671f, 0.0668371394f, -0.02062211f, -0.0690933764f, 0.0809433833f,
+    0.0492415093f, 0.0228490233f, -0.0299835727f, -0.10185048f, -0.0261704084f, -0.0938482806f, -0.125031814f, -0.0337109044f,
+    0.122573696f, -0.089786388f, 0.111929186f, 0.00615033973f, 0.0243039224f, -0.00176504452f, -0.0372163355f, -0.0369101837f,
+    0.0651462823f, -0.0310125612f, 0.112662181f, 0.0675988346f, 0.0226649325f, 0.0759685785f, -0.0735300407f, -0.0555886813f,
+    0.0529283397f, -0.0119664455f, 0.071741946f, -0.120441161f, 0.0242623892f, -0.0857593715f, -0.057206776f, 0.158267215f,
+    0.102895431f, 0.0692121536f, -0.017670352f, 0.018379597f, 0.0434540734f, -0.081886746f, -0.00791554525f, 0.0518830419f,
+    0.157309324f, 0.0562427938f, 0.206969634f, -0.0815496445f, 0.119316213f, 0.0923868194f, -0.0126661621f, 0.00748736085f,
+    0.0643545836f, 0.0525344759f, 0.0558793172f, 0.0921629593f, -0.146375537f, 0.0278043076f, -0.153980047f, -0.0920523182f,
+    0.0623603463f, -0.114406839f, -0.000504547323f, 0.0457884409f, 0.0714684352f, -0.0153930373f, -0.0879215673f, 0.116846934f,
+    0.00452292571f, 0.053598959f, 0.0290024187f, -0.206658974f, -0.0816188306f, -0.122017458f, -0.130520374f, 0.0436257906f,
+    0.117844746f, 0.00505343312f, 0.0987074152f, 0.0634089783f, 0.0924574509f, 0.0327227302f, 0.153194264f, -0.0650133491f,
+    0.0684880763f, -0.0375810079f, 0.0384173803f, 0.0551906787f, -0.0813516676f, 0.0950609967f, -0.117687419f, -0.0759075657f,
+    0.0572186895f, -0.0695549846f, 0.0344498903f, 0.0124353841f, 0.116124935f, -0.0843741447f, -0.0932034701f, 0.100806162f,
+    -0.000849998556f, 0.0604618005f, -0.00261080195f, -0.0593307875f, -0.0607443526f, -0.00752582587f, -0.111966044f, 0.0206291247f,
+    0.059018787f, -0.046325542f, 0.148346573f, 0.0576076545f, 0.119597219f, -0.00878462568f, 0.116115414f, -0.0160811134f,
+    0.15334563f, -0.0356770009f, 0.0710026845f, 0.105431758f, -0.0304504111f, 0.137588665f, -0.129180923f, -0.0897880867f,
+    0.0673759207f, -0.0662922338f, -0.00782752503f, 0.0355369002f, 0.0510373898f, -0.147716388f, -0.096671842f, 0.0692296773f,
+    0.111437134f, 0.115734391f, -0.0161152463f, -0.0594363548f, -0.0784467757f, -0.090214856f, -0.0334768929f, -0.0300882123f,
+    0.0825994834f, 0.0541774444f, 0.205901474f, -0.0830776617f, 0.138841942f, 0.0973157212f, 0.0641851351f, 0.00478717312f,
+    0.0578680746f, 0.073324576f, -0.0218141768f, -0.0473500043f, 0.0794197023f, 0.106823467f, 0.00176162319f, -0.16213493f,
+    0.0826782063f, 0.0173121691f, 0.0292008165f, 0.1275962f, 0.00301386812f, 0.0717584938f, 0.0595241152f, 0.137643203f,
+    0.137783006f, 0.0884669423f, -0.109009705f, -0.00215022755f, -0.014771428f, -0.191792294f, -0.113563798f, 0.078276448f,
+    0.0943391845f, -0.0248810872f, 0.0315042026f, 0.041329056f, 0.0879646093f, 0.0417687893f, -0.0964399129f, 0.114622757f,
+    0.024016872f, 0.0786854699f, 0.0465618111f, 0.0300274994f, 0.0412837267f, 0.0266909711f, -0.0541669838f, -0.21731396f,
+    0.0622815602f, 0.0734707043f, -0.0294170789f, 0.145353913f, 0.0307977218f, 0.108618453f, -0.0519182496f, 0.0862089023f,
+    0.151965082f, 0.0852979496f, -0.130820051f, -0.0356164053f, -0.114928253f, -0.233383596f, -0.066082187f, 0.0051596961f,
+    0.127979681f, -0.0314794406f, 0.102815703f, -0.0429825261f, 0.0612692647f, 0.0435128324f, -0.0983936563f, -0.00122599071f,
+    0.0436215475f, 0.00131867232f, -0.021831885f, -0.0126740895f, 0.0676686689f, 0.0182042066f, 0.102988824f, -0.281476796f,
+    0.0412912667f, 0.0910589471f, 0.0984721109f, 0.081986703f, -0.0115292249f, 0.179204866f, 0.0426526628f, 0.0572262295f,
+    0.33464548f, 0.0500369668f, -0.115730956f, -0.0651819855f, -0.0317672417f, -0.172983572f, 0.200145766f, 0.00959199201f,
+    0.043138843f, 0.0370736644f, 0.118850499f, -0.0868857354f, 0.134865835f, 0.0273813196f, 0.115440659f, 0.101631775f,
+    0.0408700518f, 0.0676332787f, 0.0959240347f, -0.0168578401f, -0.00592265138f, -0.0162589233f, -0.09065409f, 0.00432315748f,
+    0.124755241f, -0.0337497666f, -0.00952351466f, 0.0292300023f, 0.032811556f, 0.0711344928f, -0.0284868218f, 0.0749369785f,
+    -0.0897019282f, 0.0725188404f, -0.0615114085f, -0.0329078473f, -0.0874513835f, -0.133754224f, -0.17416583f, 0.0805190131f,
+    0.134079009f, -0.0332497805f, 0.0303560272f, 0.0651824027f, 0.0745959654f, 0.0455187f, 0.0492396019f, 0.0132897021f,
+    0.104485929f, 0.0316269286f, 0.0838406011f, -0.00916760881f, -0.0408337116f, -0.0243557543f, -0.0348775722f, -0.0359983668f,
+    0.0848679692f, -0.0359411575f, -0.0911125392f, 0.00591887161f, 0.0454076044f, 0.00986824371f, -0.0597722232f, 0.0795086548f,
+    -0.0636356622f, 0.038234435f, 0.0435346551f, -0.0944040641f, -0.0502465889f, -0.0151549568f, -0.174995154f, -0.00775197474f,
+    0.0485334955f, 0.0192937143f, 0.0849248841f, -0.0149347978f, 0.0987017676f, 0.042676542f, 0.084451586f, -0.0441870876f,
+    0.0380997732f, 0.0121892076f, 0.0289414544f, 0.137841687f, -0.0547037162f, 0.0150775909f, 0.100721002f, -0.0844914541f,
+    0.0941456705f, 0.0225786362f, 0.00908573158f, -0.018572066f, 0.0307951961f, 0.000194916473f, 0.0120198363f, 0.0914617777f,
+    0.0365282074f, 0.0836213231f, -0.0303606112f, -0.0639648139f, -0.0395837799f, -0.104195856f, 0.0385455117f, 0.0877519399f,
+    0.124653615f, 0.010801373f, 0.0923951939f, -0.0141879693f, 0.0920088589f, 0.0798135027f, 0.144726843f, -0.0630117282f,
+    0.00256045f, 0.0189572703f, 0.0238556322f, 0.187878385f, -0.0995517895f, -0.02370397f, -0.133808255f, -0.260153294f,
+    0.0916998908f, -0.136332363f, -0.135576278f, 0.071824491f, -0.0339447334f, -0.00464505609f, -0.0647320822f, 0.0839252248f,
+    -0.0582637414f, 0.0733432025f, -0.105838515f, -0.126458138f, -0.239500359f, -0.143141627f, -0.14373973f, 0.0431973971f,
+    0.0820918828f, -0.0183532704f, -0.0146252038f, 0.0606741086f, 0.0787889436f, -0.00220678002f, 0.18980515f, -0.0438818038f,
+    0.115845837f, 0.00612634188f, 0.134424344f, 0.133525625f, -0.150567472f, -0.0108808195f, -0.00124119758f, -0.141064897f,
+    0.133717626f, -0.0777390078f, -0.135326698f, 0.0393945761f, -0.0276328661f, -0.059616562f, -0.0834904239f, 0.00783389248f,
+    0.0177204255f, 0.0868225098f, 0.0361305252f, -0.115798585f, -0.101783223f, -0.00547553785f, -0.176947922f, -0.003603308f,
+    0.0618299618f, 0.0426525846f, 0.0596403778f, 0.0362130292f, 0.0990804806f, -0.00312807201f, 0.121215701f, -0.0664495975f,
+    0.11552944f, -0.0417010784f, 0.114592806f, 0.160542473f, -0.129955158f, -0.0278008636f, -0.0354628414f, -0.169416487f,
+    0.0641957372f, -0.131606132f, -0.166370615f, 0.0877353773f, -0.00602481794f, -0.0678106472f, -0.0477528535f, 0.110087477f,
+    -0.02571656f, 0.0596707612f, -0.0114665879f, -0.20852074f, -0.150641337f, -0.119717568f, 0.0949531719f, 0.0546837151f,
+    0.0337172002f, 0.0121200504f, -0.100831099f, -0.0190649386f, 0.154712781f, 0.0110657783f, 0.136241302f, -0.105584636f,
+    0.059899509f, 0.15998894f, -0.060638953f, 0.0907915235f, -0.0271370187f, 0.105614595f, 0.0888763443f, -0.081691727f,
+    0.141040102f, -0.0194379687f, 0.114963524f, -0.0572300628f, -0.152715519f, -0.153048173f, -0.00387587957f, 0.0211272556f,
+    0.168035462f, 0.042806942f, -0.0885774195f, 0.118410781f, 0.119902357f, 0.164959341f, 0.0843990147f, -0.0276036933f,
+    0.0898398459f, -0.0574586838f, 0.327960372f, -0.0587511845f, -0.0505329929f, 0.113801412f, -0.4438155f, 0.059258543f,
+    0.0869549811f, 0.137427747f, -0.023377955f, 0.0773709863f, -0.0487410352f, 0.0271709822f, 0.0738872588f, -0.132700995f,
+    0.108550243f, -0.11880558f, 0.10017217f, -0.102765217f, -0.144760802f, -0.1472352f, -0.0379725881f, 0.00417736778f,
+    -0.0247759931f, -0.0274989549f, -0.0999289528f, 0.0855951682f, 0.135985717f, 0.0889500007f, -0.181166768f, -0.0419395491f,
+    -0.0147781437f, -0.0937383324f, 0.24544774f, -0.052508045f, -0.028084144f, 0.0947646126f, -0.233157247f, 0.0497511737f,
+    0.0510815829f, 0.0873706341f, -0.0562197827f, 0.0419444218f, -0.00992229115f, 0.130308971f, -0.0415720046f, -0.119574726f,
+    0.14972347f, -0.0987540483f, 0.0489522591f, -0.199666888f, -0.183885679f, -0.18962045f, 0.0406121314f, 0.0971791968f,
+    -0.020624483f, 0.0247251429f, -0.101853319f, 0.067958042f, 0.131202906f, 0.0227024872f, -0.141928345f, -0.033911787f,
+    0.10105285f, -0.095173426f, 0.367077738f, -0.0829655901f, -0.0441245362f, 0.198720157f, -0.420979589f, -0.0132666137f,
+    -0.0160312057f, 0.156789526f, -0.0394543633f, -0.0638975054f, -0.0492995419f, 0.0858740062f, 0.0493113697f, -0.0989303291f,
+    0.123672053f, -0.00656650402f, 0.119652115f, -0.208245143f, -0.0406468175f, -0.0883370787f, 0.0826225802f, 0.0477904677f,
+    0.146341145f, -0.00863216445f, -0.0706405342f, 0.0562865399f, 0.167256489f, 0.0485839248f, 0.0498968996f, 0.0452719368f,
+    0.0860938132f, -0.0516180471f, 0.377988935f, -0.0784004107f, -0.0657268539f, 0.122855693f, -0.511465847f, 0.0335017592f,
+    0.0227460712f, 0.165994197f, -0.065847069f, 0.00567712868f, 0.00238959049f, 0.0833627656f, -0.0243577585f, -0.206679031f,
+    0.136143014f, 0.00267287507f, 0.0866621435f, -0.154159546f, -0.111851819f, -0.11970678f, -0.00424119364f, 0.0507351831f,
+    0.07459189f, 0.0407638475f, -0.106979206f, 0.0329392627f, 0.100601204f, 0.0233157147f, -0.168750316f, -0.054262273f,
+    0.0153315766f, -0.0829686075f, 0.247986093f, -0.0586393923f, -0.0549545884f, 0.174057603f, -0.266099721f, -0.0205660705f,
+    -0.0597694255f, 0.11873202f, -0.0105038024f, -0.0747462139f, 0.00183223176f, 0.134302601f, -0.0146088246f, -0.162582651f,
+    0.13452585f, -0.047512386f, 0.100285962f, -0.223886833f, -0.0993986651f, -0.125162899f, 0.0232877322f, 0.126919404f,
+    0.00819989853f, 0.0103246318f, -0.11656934f, -0.0410593115f, 0.0496433415f, -0.064969711f, -0.133569866f, -0.0115236454f,
+    0.0787264034f, -0.070108138f, 0.421311349f, -0.0996535793f, 0.0177510604f, 0.0959832743f, -0.510029018f, 0.0533529967f,
+    -0.00215406343f, 0.138724715f, -0.0499054007f, -0.18951413f, 0.0671104938f, 0.100546941f, 0.0285626035f, -0.145660132f,
+    0.0356737003f, 0.00224990165f, 0.0875186995f, -0.214682326f, -0.147592142f, -0.135726914f, 0.0933779776f, 0.00998210721f,
+    0.246099323f, 0.0706754476f, -0.113443352f, 0.0507871173f, 0.0983610377f, 0.0335580707f, 0.0441324078f, 0.0589769259f,
+    0.0484913699f, -0.106835656f, 0.415018231f, -0.0732663348f, -0.00858153496f, 0.0886188f, -0.599932194f, 0.0150444703f,
+    -0.0347565338f, 0.17373848f, -0.0506414585f, -0.189453915f, -0.0294025f, 0.123328827f, 0.0177802332f, -0.0779952034f,
+    0.0744523928f, -0.0690923184f, 0.0345619544f, -0.181367368f, -0.150092468f, -0.189837664f, 0.0386189669f, 0.0829363018f,
+    0.0499601886f, -0.00206519663f, -0.113301106f, 0.00550659653f, 0.0907926932f, 0.0879510567f, -0.0962028801f, 0.0527880751f,
+    -0.0132630654f, -0.0800880641f, 0.354706734f, -0.141127005f, -0.0772896037f, 0.174844086f, -0.390489072f, 0.0383985266f,
+    -0.0345498957f, 0.148788467f, -0.0977434441f, -0.147858441f, 0.00409226213f, 0.187167421f, 0.0274658203f, -0.230693519f,
+    0.077085644f, -0.0382295847f, 0.130688339f, -0.188912988f, -0.205605492f, -0.208941922f, 0.0495876744f, 0.139717624f,
+    0.0630149394f, 0.0904489011f, -0.150608376f, 0.00342286727f, 0.00817322731f, 0.0108427983f, -0.0904049128f, -0.0269499663f,
+    0.0407768339f, -0.0818273872f, 0.39736259f, -0.225700513f, 0.0494413152f, 0.157718852f, -0.580417395f, 0.0347858407f,
+    0.0588903911f, -0.202651143f, -0.155927733f, -0.068422772f, 0.132302478f, 0.105218403f, 0.147342592f, 0.0326450616f,
+    -0.0876147449f, 0.197834f, 0.162307441f, 0.233596355f, -0.201685026f, 0.124868385f, -0.16591543f, 0.023314124f,
+    0.17425029f, -5.74412443e-05f, -0.200025707f, 0.176505432f, 0.137810603f, 0.0899417624f, -0.289518148f, -0.132781819f,
+    -0.068201609f, -0.0432091318f, 0.149792135f, -0.191739082f, -0.00538912136f, -0.105645694f, 0.234885484f, 0.0349614881f,
+    0.0452466011f, -0.237924606f, -0.0644485652f, -0.0751246661f, 0.110658355f, 0.0657009482f, 0.0250715856f, -0.00391019601f,
+    -0.0273894109f, 0.134304985f, 0.175404295f, 0.167613566f, -0.140784591f, 0.0181298852f, -0.121630445f, 0.0338291675f,
+    0.0938728228f, 0.0423555635f, -0.0820885897f, 0.12891911f, 0.126184076f, 0.107361086f, -0.416187555f, -0.127921984f,
+    0.0236012861f, 0.0112208156f, 0.0904258415f, -0.230696067f, -0.0555995144f, -0.0975741893f, 0.119651519f, -0.0520719104f,
+    -0.0329671539f, -0.222239003f, -0.186999127f, -0.0158648342f, 0.141110569f, 0.0978511199f, 0.163575396f, 0.0168883372f,
+    -0.0801684409f, 0.164514691f, 0.224424079f, 0.120392762f, -0.246919408f, 0.176802665f, -0.220422626f, 0.00529668992f,
+    0.12310496f, 0.0618856512f, -0.105933502f, 0.0985730439f, 0.136221185f, 0.090158008f, -0.498516291f, -0.0525079928f,
+    0.021969717f, -0.0326614045f, 0.122081891f, -0.170838341f, 0.00744891027f, -0.0492030568f, 0.289371789f, 0.0402899981f,
+    0.0126439473f, -0.217506573f, -0.0799805075f, -0.0634727031f, 0.117605828f, 0.0580833778f, 0.129878804f, -0.00538906688f,
+    -0.0910757408f, 0.118243806f, 0.187538087f, 0.138601705f, -0.19187656f, 0.133249581f, -0.128819436f, -0.0580876358f,
+    0.133380443f, 0.0179268271f, -0.14773041f, 0.14490889f, 0.0619560294f, 0.0354597196f, -0.292021185f, -0.0217257105f,
+    0.0171352495f, 0.0156682003f, 0.1694507f, -0.27228722f, 0.0398030803f, -0.0662434474f, 0.0689873397f, 0.00158504816f,
+    0.00302984007f, -0.115377709f, -0.15465121f, -0.11763408f, -0.00323689077f, -0.0176023524f, -0.0262634531f, 0.0117694726f,
+    -0.0793092027f, 0.105113268f, 0.0623434484f, 0.05269688f, -0.152099282f, 0.0841687396f, -0.167308301f, -0.0447490104f,
+    0.110238925f, -0.0281696953f, -0.175797924f, 0.0579147227f, 0.102184922f, 0.0893500298f, -0.385525316f, -0.0816378966f,
+    -0.0733157769f, -0.00271456665f, 0.0310182851f, -0.230585635f, -0.0599422753f, -0.0530319735f, -0.0186929964f, -0.000459426199f,
+    0.0318119079f, -0.181115106f, -0.119016863f, -0.120656058f, 0.139866263f, 0.111245565f, 0.103509665f, 0.0311452877f,
+    0.00128493516f, 0.0836704001f, 0.149927109f, 0.0247873515f, -0.170960024f, 0.110032856f, -0.151152715f, 0.0541210994f,
+    0.12704578f, 0.0094043538f, -0.184950337f, 0.14508073f, 0.109577663f, 0.0687196404f, -0.461110264f, -0.0287594981f,
+    0.0158413667f, -0.0682736635f, 0.0865013525f, -0.247161999f, 0.0503530949f, -0.0701171905f, 0.115603901f, -0.0499223284f,
+    0.022915503f, -0.152991369f, -0.119798996f, -0.0876098648f, 0.164743945f, 0.0247626062f, 0.118020564f, -0.00835645758f,
+    -0.0888649449f, 0.205062598f, 0.223698899f, 0.29427281f, -0.214834139f, 0.102574058f, -0.179405525f, 0.0656485334f,
+    0.200090498f, -0.0344135687f, -0.215523928f, 0.150587693f, 0.11778602f, 0.0238143187f, -0.249446511f, -0.109067783f,
+    -0.0257551391f, 0.000282846042f, 0.122771859f, -0.23506543f, 0.0566921532f, -0.0233594868f, 0.243683308f, -0.00587438978f,
+    -0.0158076249f, -0.136427894f, -0.104365163f, -0.146671802f, 0.0299385544f, -0.0141517865f, 0.0181181319f, -0.0670096874f,
+    -0.00344974757f, 0.0887119323f, 0.0999397114f, 0.128002614f, -0.209030703f, 0.0355937779f, -0.129629433f, 0.0185835883f,
+    0.0946751982f, -0.0139154475f, -0.12782836f, 0.0907901004f, 0.0661554486f, 0.10989321f, -0.341366559f, -0.0179490075f,
+    0.00492581259f, -0.0711815208f, 0.0212536026f, -0.265302598f, 0.0189545248f, -0.00089082442f, 0.144438937f, -0.0740976557f,
+    0.0302808154f, -0.198050737f, -0.205578089f, -0.0951810777f, 0.179638609f, 0.109140158f, 0.0625111982f, -0.0370795056f,
+    -0.0218625441f, 0.149427697f, 0.165826425f, 0.265802473f, -0.15527761f, 0.0889695734f, -0.214061141f, 0.084599182f,
+    0.118594408f, -0.0026239166f, -0.164430067f, 0.0678653494f, 0.0767408758f, -0.0170045085f, -0.458619833f, -0.0101263849f,
+    0.00228745746f, 0.0747289211f, 0.217994601f, -0.203671798f, 0.0894392654f, 0.0470679067f, 0.245788708f, -0.0441761613f,
+    0.116419554f, -0.0831244737f, 0.0476797f, -0.108363494f, -0.167645812f, -0.278952032f, 0.209648132f, 0.418276548f,
+    -0.0369653329f, -0.019974649f, -0.206334442f, -0.204156533f, 0.143490583f, 0.0834245607f, -0.0559786297f, 0.0112444777f,
+    -0.140514418f, 0.0206143949f, 0.334457546f, -0.00653305417f, 0.131835029f, 0.0500828587f, -0.247151583f, 0.0333707593f,
+    -0.0381222852f, -0.18972601f, -0.549747467f, 0.0586705096f, -0.000185179175f, -0.00454837736f, -0.1826251f, 0.0326950401f,
+    -0.039192982f, -0.0436285622f, -0.132708386f, -0.054268565f, 0.0889980569f, -0.0145440307f, 0.131067276f, 0.138505876f,
+    -0.0229053423f, 0.137693465f, 0.0566080362f, -0.144396678f, 0.012378104f, 0.188825458f, -0.0461815111f, -0.000604989356f,
+    0.0303461421f, 0.0761912912f, 0.172584772f, -0.0524124168f, -0.0520951413f, -0.0668539554f, 0.190068275f, 0.0827144161f,
+    -0.0701853558f, 0.0106458142f, -0.162436858f, 0.13100265f, 0.0569981113f, 0.0526420362f, -0.0344626009f, 0.0202720817f,
+    -0.175975025f, 0.0464332364f, -0.20406428f, -0.140059888f, 0.0145565877f, -0.148064598f, 0.115979806f, -0.328202188f,
+    -0.115482621f, 0.086186409f, 0.0492617451f, -0.116860263f, -0.211638197f, 0.2651245f, 0.0598289445f, 0.0248379074f,
+    0.00990285538f, 0.0573419705f, -0.329619259f, -0.181638792f, -0.221122399f, -0.174370944f, 0.120747834f, 0.0973424837f,
+    -0.0446310639f, -0.0432159565f, -0.213662177f, 0.142464727f, 0.00261436263f, 0.0417730361f, -0.0174925756f, 0.0134037482f,
+    0.143368319f, -0.0515427217f, -0.0533094704f, -0.0429421067f, -0.0279612597f, -0.140937611f, 0.153330281f, 0.320331812f,
+    0.0394959971f, 0.0772749931f, -0.0420650356f, -0.206655726f, -0.0199330151f, 0.105476446f, -0.0641347095f, -0.017261833f,
+    -0.0533962213f, -0.0121076526f, 0.181209788f, 0.0209190026f, 0.111506172f, 0.100426249f, -0.0790745839f, 0.0806275681f,
+    0.0630722046f, 0.000121273821f, -0.402748168f, 0.109094247f, 0.043281775f, 0.0744892359f, -0.152764037f, 0.0870917439f,
+    0.0534939393f, 0.0597874001f, -0.23369512f, -0.0499669984f, 0.0931607634f, -0.0357834809f, 0.181290776f, -0.0100409687f,
+    -0.020206036f, 0.121409737f, 0.0688800663f, -0.147963375f, -0.170026511f, 0.0894228369f, 0.00185526931f, 0.097570546f,
+    0.0649587736f, 0.0419939719f, -0.127024651f, -0.110383086f, -0.0315380581f, -0.0423213243f, 0.182195365f, 0.0611598194f,
+    0.064672716f, 0.0130453669f, -0.095436506f, 0.0887808427f, -0.00533940131f, 0.0517514572f, -0.0580315441f, 0.118725151f,
+    -0.101133324f, 0.00138606736f, -0.259702533f, -0.0717998222f, 0.0891399607f, -0.0873274803f, 0.116896763f, -0.189990386f,
+    -0.0218812004f, 0.0750483274f, -0.0517002679f, -0.0992567614f, -0.219441772f, 0.194657177f, 0.024726402f, 0.0595566854f,
+    0.0470558666f, 0.0809262395f, -0.39680928f, -0.166920736f, -0.185884699f, -0.151535898f, 0.151191235f, 0.123475261f,
+    0.0494036563f, -0.0165460594f, -0.173674479f, 0.0976497084f, 0.0326506495f, 0.0693308264f, -0.14589034f, 0.125106692f,
+    0.137682587f, 0.00681958487f, -0.178458601f, 0.0938172936f, 0.0693474114f, -0.11028225f, 0.267729908f, 0.304042906f,
+    0.0270492192f, 0.123456128f, -0.0218966659f, -0.0811556652f, -0.252703726f, 0.142042994f, 0.00591856381f, 0.0279899742f,
+    0.0290989038f, 0.00759672513f, -0.104848564f, -0.0760289207f, 0.0597672313f, 0.0795303136f, -0.0790737942f, 0.0800663307f,
+    0.0572860278f, 0.0318105109f, -0.357228488f, 0.0730656087f, 0.00074763369f, 0.0895643458f, -0.169317946f, 0.113288477f,
+    0.000176333037f, 0.0341851301f, -0.224422634f, -0.059247192f, 0.151754558f, 0.0858736858f, 0.240560263f, 0.153131157f,
+    -0.044789888f, 0.174215332f, 0.162171036f, -0.00177715416f, -0.174214497f, 0.133157268f, 0.106316373f, 0.0210685153f,
+    0.057275176f, 0.061142046f, -0.152615219f, -0.118732192f, -0.0528399684f, -0.0311824717f, 0.189410314f, 0.108809777f,
+    -0.0458033718f, 0.102544971f, -0.138984188f, 0.144223273f, 0.00772308977f, 0.0985784903f, -0.0692171305f, 0.0435134694f,
+    0.0103394045f, 0.0265117921f, -0.192273855f, -0.0608759858f, 0.124773584f, -0.0818800554f, 0.134448424f, 0.0302813724f,
+    0.00601947308f, 0.0710615814f, 0.0413150974f, -0.0641742796f, -0.131641984f, 0.1588521f, 0.0944364369f, -0.0144713139f,
+    -0.0433502384f, -0.0232962146f, -0.156005025f, -0.104573332f, -0.0893232003f, -0.00313610025f, 0.184044525f, 0.0715913028f,
+    0.0634723157f, -0.0361064263f, -0.195957839f, 0.103943855f, 0.00249550678f, 0.0500417538f, -0.14369671f, 0.107590057f,
+    -0.0658073351f, 0.0179613046f, -0.0299119428f, -0.0417598635f, 0.0109732309f, 0.0248620398f, -0.0127638429f, 0.000624284905f,
+    -0.0385421216f, -0.0396836363f, 0.0341970548f, -0.0342201479f, 0.022112608f, -0.0580083542f, 0.0271722339f, -0.0624526069f,
+    -0.0130424555f, -0.0202735309f, 0.0297317915f, 0.0169591289f, -0.0201175883f, -0.060426034f, 0.0115202861f, 0.0452535748f,
+    0.00126084161f, -0.01070558f, 0.0290644076f, -0.0394696444f, -0.014508862f, -0.0302933436f, 0.0174410734f, 0.0365833752f,
+    0.00672486937f, -0.00133933278f, -0.0589770488f, 0.0412288494f, 0.0172730181f, -0.0246928018f, -0.053452298f, -0.0233702399f,
+    0.00420929212f, -0.00984237529f, -0.0641595572f, 0.0363526456f, 0.0126225771f, 0.0269345921f, -0.00377292372f, 0.0375014916f,
+    0.0397978388f, -0.022115374f, 0.00151448278f, -0.0525614619f, -0.0457980745f, 0.0129043153f, -0.0340364799f, -0.0623109415f,
+    -0.0621007234f, -0.0671689883f, -0.00824549235f, -0.0445967056f, -0.0653877929f, -0.0533428602f, -0.0190107226f, -0.00266814581f,
+    -0.0574732199f, -0.0230807625f, -0.0206403174f, -0.0366712734f, -0.00491711032f, -0.0391973592f, -0.00586634642f, 0.0240359325f,
+    -0.0295896661f, -0.0513317436f, -0.0236795284f, 0.0361798182f, -0.0159792714f, -0.00579414563f, -0.0125808064f, -0.0367505215f,
+    -0.0111892838f, -0.0196276661f, 0.0334418118f, 0.0108446619f, -0.0602557994f, -0.0263713617f, -0.0439410284f, 0.0361831859f,
+    -0.0561098643f, -0.0379335098f, 0.0192394219f, -0.049887754f, -0.0492512211f, -0.041080527f, 0.00442823675f, 0.0305721331f,
+    -0.0169650894f, 0.0341831371f, 0.0444195271f, 0.0260038506f, -0.0222954899f, 0.0174251646f, -0.0085523501f, 0.0291728582f,
+    -0.00276878849f, -0.0554285198f, 0.0466503054f, 0.0308663081f, 0.0269109104f, -0.0390820876f, -0.0480196252f, -0.0185405854f,
+    0.0379330814f, -0.0151280798f, 0.0371542871f, -0.0256458279f, 0.0324197263f, -0.0828934163f, 0.00704523874f, -0.0235540848f,
+    -0.00505419821f, -0.0662857816f, -0.0296796635f, 0.00820753537f, -0.0105874045f, -0.0457537062f, -0.0655913427f, -0.0532984287f,
+    -0.001310391f, 0.0409727059f, -0.055419419f, -0.00695192302f, -0.00706832018f, 0.0202500839f, -0.0177535508f, -0.0384014882f,
+    -0.0471686348f, -0.0101051098f, -0.00497662043f, 0.0169375222f, -0.0561500043f, -0.0287867989f, -0.0571600869f, 0.00932545122f,
+    -0.0481785946f, 0.00833188649f, -0.0383434296f, -0.0274300072f, 0.0143421348f, -0.0498928353f, -0.0253456887f, 0.0343695059f,
+    0.0222983006f, -0.0431499146f, 0.0430310182f, 0.0131306648f, 0.0340564325f, 0.0160832833f, -0.0460434966f, -0.0389865004f,
+    0.00372859021f, -0.0632446334f, 0.0150332404f, -0.0134287355f, 0.00726398313f, -0.0325723998f, 0.0356058031f, -0.0269180108f,
+    0.0243366975f, -0.0362043679f, -0.0393008962f, -0.00636785384f, -0.061995402f, 0.0382844545f, 0.0287546832f, -0.026537681f,
+    0.0302477628f, 0.0319570117f, 0.0360463224f, -0.054967355f, -0.0462172739f, -0.0280314106f, 0.00392373232f, -0.050129544f,
+    -0.0221786741f, -0.0177920964f, 0.0246291477f, 0.00381057523f, 0.0269682277f, -0.00900838897f, 0.0192393586f, 0.0121354898f,
+    -0.0198505707f, -0.0197500773f, 0.0413899757f, -0.015519605f, 0.0241147019f, -0.056727007f, -0.03226671f, 0.00903808139f,
+    0.0329067558f, 0.0202420149f, -0.0444822609f, 0.0234398656f, 0.0177581087f, -0.0163501874f, -0.0379477851f, -0.0524479523f,
+    0.0363007411f, 0.0184325203f, 0.0216818526f, -0.0699043423f, -0.0535963103f, 0.0234991889f, -0.0401509181f, 0.0437395833f,
+    0.00821032561f, 0.0449650697f, 0.0453219302f, -0.0151848029f, -0.016287541f, -0.0131441839f, 0.0187001564f, -0.00708456524f,
+    -0.0156755783f, -0.0431481525f, 0.0137322964f, -0.0303097572f, 0.0440839827f, -0.0206896849f, -0.015232346f, 0.0130391615f,
+    -0.0474527664f, -0.0572816096f, 0.0175508484f, -0.0129334731f, -0.0564747043f, -0.0150870327f, 0.00328826578f, 0.0230158363f,
+    0.017695548f, -0.0136420848f, -0.0223614071f, -0.00123103196f, -0.0452696458f, -0.017048737f, -0.0637353063f, -0.00543426815f,
+    -0.0474730656f, -0.0345349088f, 0.0196906272f, -0.0436160006f, -0.00273270183f, -0.043008972f, 0.00705118058f, -0.0656818822f,
+    0.043443121f, 0.0156768281f, -0.0390707403f, -0.0136287734f, -0.0585064366f, -0.0339130424f, -0.0415555574f, -0.011799857f,
+    -0.0674506724f, 0.0415652618f, 0.0297928154f, -0.0308639929f, -0.00459700217f, -0.034221828f, -0.0223011784f, -0.0186018627f,
+    0.00220098509f, 0.0493891463f, -0.00556169171f, -0.0102703581f, -0.0100694196f, -0.0530837737f, 0.0107965684f, -0.0212784838f,
+    -0.025978379f, -0.00741876569f, 0.0147458548f, -0.00393233774f, -0.018554654f, 0.0310537964f, -0.0534233116f, -0.060017217f,
+    0.0803105235f, -0.313922495f, -0.0128561165f, 0.203426585f, 0.092345804f, -0.12341731f, 0.0920711234f, 0.128838867f,
+    -0.135953888f, 0.157511339f, 0.0132997902f, 0.226591557f, -0.0183185507f, 0.199743196f, -0.136209771f, -0.0521785505f,
+    0.0421618894f, -0.0715801194f, -0.0498471819f, 0.0254286099f, 0.0463701785f, 0.142292932f, -0.341950417f, -0.0848310813f,
+    0.0308171343f, -0.00689189415f, -0.149559289f, 0.026024932f, -0.0414285176f, -0.0153553542f, 0.347679406f, 0.0104105091f,
+    -0.0329934619f, -0.223733708f, 0.0393629298f, 0.103101783f, 0.030548146f, -0.0743664503f, -0.0398528986f, 0.148844048f,
+    -0.130574465f, 0.0360559113f, -0.0620221235f, 0.0938080996f, -0.00664909696f, 0.00392063567f, -0.0976044387f, -0.109612942f,
+    0.0358386673f, -0.0534540713f, 0.0297311544f, 0.0593698993f, 0.000389880239f, 0.0510047711f, -0.403876513f, -0.10471157f,
+    -0.04806339f, 0.0197966918f, -0.191710174f, -0.0277574696f, -0.119565897f, -0.0680427179f, 0.167652875f, 0.0585146137f,
+    -0.0172802415f, -0.212774172f, -0.0542628467f, 0.102574818f, 0.147515461f, 0.0214802772f, 0.0311565902f, 0.127902687f,
+    -0.133204713f, 0.159482315f, 0.0908544138f, 0.141773432f, -0.0430525281f, 0.0852295533f, -0.149039462f, -0.0457411222f,
+    0.112057045f, 0.0565928817f, -0.0351957344f, 0.073695682f, 0.0553503186f, 0.137540638f, -0.394156933f, -0.0449228063f,
+    0.0355213881f, 0.0734549612f, 0.00697219046f, -0.0358917527f, -0.0355524383f, 0.00488754082f, 0.303460389f, -0.0319078751f,
+    -0.0188281871f, -0.0912142992f, -0.0480776355f, 0.0324257836f, 0.0152900508f, -0.0910472646f, 0.00593093503f, 0.187246233f,
+    -0.130078807f, 0.106453449f, -0.0396905616f, 0.213369921f, 0.0307423398f, 0.0378688835f, -0.0516756661f, -0.0115385493f,
+    0.104408599f, -0.0420958512f, 0.023889903f, 0.0478597432f, 0.0650065169f, -0.00257885456f, -0.344419271f, -0.054571338f,
+    -0.00994057953f, -0.0271105804f, -0.163041696f, -0.106680416f, -0.116344057f, -0.0458117612f, 0.104643427f, 0.00674899761f,
+    -0.0919394493f, -0.0437849276f, -0.0212786961f, -0.00486933626f, -0.0281314794f, -0.00140619511f, 0.00220000953f, 0.10662543f,
+    -0.169705689f, 0.0693166777f, 0.0114416145f, 0.0640893206f, 0.0376370028f, 0.0170676596f, -0.124349073f, -0.0448820628f,
+    0.037357159f, -0.0454401709f, -0.055126369f, 0.0500549562f, -0.00757364323f, 0.000341276056f, -0.440075576f, -0.0255660415f,
+    -0.0594784804f, -0.0373352915f, -0.189015061f, -0.136591941f, -0.0471469983f, 0.0327032208f, 0.0945968032f, 0.0489695594f,
+    0.0240182932f, -0.0766941309f, -0.0665431023f, -0.0213865414f, 0.100110449f, 0.0600466877f, 0.0748526677f, 0.0825147852f,
+    -0.117878258f, 0.116156369f, 0.0567172766f, 0.0964340121f, -0.0299248695f, 0.0326072685f, -0.144641832f, 0.0222355369f,
+    0.103167854f, 0.0676008314f, 0.0233626142f, 0.0945044085f, 0.0799774751f, 0.0829759762f, -0.408774555f, -0.0631389692f,
+    -0.034149155f, 0.0119854081f, 0.0617719032f, -0.105449818f, -0.0748165548f, 0.0356148146f, 0.169770077f, 0.0340875722f,
+    0.00548653305f, -0.17472288f, -0.0653594211f, 0.0793097094f, 0.107487582f, -0.0896374732f, 0.0229777284f, 0.12958914f,
+    -0.120913699f, 0.0895191655f, 0.0670137182f, 0.223575026f, -0.0564749055f, 0.081366919f, -0.0635353699f, -0.0266202018f,
+    0.114420161f, 0.00570411608f, -0.008170221f, 0.110083267f, 0.0527391136f, 0.100097582f, -0.351812869f, -0.081220068f,
+    0.0195746701f, 0.118326634f, -0.196921527f, -0.195207149f, 0.114493348f, -0.0473449677f, 0.318677157f, 0.08402659f,
+    -0.0136052463f, -0.189417496f, -0.0912457705f, 0.00798694417f, -0.0336975567f, -0.0725516751f, 0.0266529229f, 0.0450820029f,
+    -0.119581357f, 0.0265598111f, -0.00363947963f, 0.145693123f, -0.0450621136f, 0.045522254f, -0.146512032f, 0.0122435279f,
+    -0.0436808988f, 0.0706557706f, -0.00327743147f, -0.0021638195f, -0.00537423091f, 0.00213257829f, -0.386137158f, -0.0173095446f,
+    0.0678102449f, 0.0418150797f, -0.107178636f, -0.121589556f, 0.0934056714f, -0.0300923977f, 0.190718964f, -0.00612453278f,
+    -0.0422391742f, -0.125895157f, 0.0124694901f, 0.00622325204f, 0.131339431f, 0.0819938183f, 0.0506296158f, 0.103850082f,
+    -0.0703871474f, 0.0979978591f, 0.105959557f, 0.135795832f, 0.0370545611f, 0.0824207962f, -0.161803558f, 0.10931319f,
+    0.127198324f, 0.0469580591f, -0.0175687242f, 0.149709895f, 0.0926920101f, 0.0246233512f, -0.455244064f, -0.11451897f,
+    0.0111339018f, 0.0883374885f, 0.0622529015f, -0.126208156f, 0.0874236226f, -0.0377946682f, 0.374421775f, 0.0362622142f,
+    0.0181593318f, 0.124858148f, 0.0847528055f, 0.0821666718f, -0.122174688f, -0.0652553439f, -0.123093657f, -0.241049618f,
+    0.10812103f, -0.174266472f, -0.133378297f, 0.0563319437f, 0.191359714f, -0.108029991f, 0.00631068321f, 0.0749750212f,
+    0.0824595764f, 0.0873746052f, 0.0327182598f, 0.00572122121f, -0.0160223823f, -0.0473148562f, -0.0107105514f, 0.113740839f,
+    0.0832216367f, -0.0876059681f, -0.00440533785f, -0.0537570305f, 0.07159058f, 0.0694154128f, 0.0329674147f, 0.00216900185f,
+    0.104515448f, 0.125241444f, 0.148960873f, 0.0889514685f, -0.13631013f, -0.0534090623f, -0.163671985f, -0.209543526f,
+    0.104570724f, -0.257977247f, -0.14531751f, -0.0274155326f, 0.160673499f, -0.163381621f, 0.0120414197f, 0.059380237f,
+    0.213326767f, -0.00983746443f, 0.00935657974f, -0.0453537814f, -0.0437818244f, -0.0155776981f, -0.108923562f, 0.0680897757f,
+    0.0765643343f, -0.0647678226f, 0.0287462659f, 0.00450849766f, 0.091879949f, 0.0750127658f, -0.0301789735f, -0.0312451497f,
+    0.088312231f, 0.115161031f, 0.12166106f, 0.176962242f, -0.112386838f, -0.0604608878f, -0.000458307244f, -0.384878874f,
+    0.109294131f, -0.0515460782f, -0.0356082171f, 0.0360944942f, 0.0960233286f, 0.0312958658f, 0.0860408023f, 0.0407574177f,
+    0.142833054f, 0.011225272f, -0.0266267508f, 0.0436741337f, -0.0271453597f, 0.00934875198f, -0.0121446662f, 0.119273968f,
+    0.0810861737f, 0.0113363685f, 0.115385875f, 0.0665890649f, 0.0644916669f, 0.146595567f, 0.102617987f, 0.0234976094f,
+    0.0792834535f, 0.0281798951f, 0.0290924255f, 0.0537400246f, -0.0907348692f, -0.113459669f, -0.0583521202f, -0.156402603f,
+    0.0775070116f, -0.177534893f, -0.0778726116f, -0.0840266272f, 0.125949278f, -0.187449604f, 0.0234354362f, 0.0381053165f,
+    0.259088039f, 0.0852310881f, 0.0710275546f, 0.0786748603f, 0.0146206124f, -0.00290787406f, -0.0509761907f, 0.0323058479f,
+    0.0893491134f, -0.0439830013f, -0.015252444f, -0.0810734853f, 0.0175661705f, 0.0937286615f, -0.0882766768f, 0.0384873413f,
+    0.0334930196f, 0.121084221f, 0.100935921f, 0.0423299223f, -0.16583629f, -0.0122710681f, -0.092163831f, -0.112108044f,
+    0.0476788431f, -0.229912817f, 0.0430588499f, -0.0453020856f, 0.0685727f, -0.22210066f, 0.0730927289f, 0.064093709f,
+    0.172461972f, 0.0148740672f, 0.0721341446f, 0.0249330774f, 0.0416327268f, 0.0459828191f, -0.157046631f, 0.0332722105f,
+    0.0819900855f, -0.00539416121f, 0.227159336f, 0.0168563165f, -0.0120856846f, 0.0512806252f, -0.0514924675f, -0.0491213575f,
+    0.0616196059f, 0.0982843339f, 0.120143972f, 0.184036598f, -0.00388791668f, 0.0448841937f, -0.0293356143f, -0.227032214f,
+    0.0481707416f, -0.0895788595f, 0.0574319474f, -0.0336385407f, 0.0194162596f, -0.111082733f, 0.0310147833f, 0.102337651f,
+    0.183028191f, 0.0118504893f, -0.0219024438f, 0.129343301f, -0.0326457545f, 0.0429665968f, -0.136609212f, 0.136044234f,
+    0.119522475f, 0.0552290604f, 0.18772845f, -0.0451293811f, -0.0119806994f, 0.15116331f, -0.0444118567f, -0.00409739697f,
+    0.0510516912f, 0.0539893731f, 0.0790012702f, 0.192624182f, -0.0380194746f, -0.0588800348f, -0.0184837878f, -0.42913121f,
+    0.181797177f, -0.0188673772f, 0.0982047841f, 0.0275900532f, -0.0295877382f, -0.0949274153f, 0.0637477636f, 0.0666579977f,
+    0.523504496f, 0.0818052739f, -0.16882439f, 0.00379328011f, 0.000406231149f, 0.0429547355f, -0.045858983f, 0.0532951318f,
+    0.0898813456f, 0.0390637629f, 0.165506572f, -0.0867144242f, 0.0707098097f, 0.0929475576f, -0.0150795681f, 0.102558404f,
+    0.0796620324f, 0.0867898464f, 0.0548469573f, 0.116411291f, -0.0328044072f, 0.00534079457f, 0.0131319799f, -0.367756158f,
+    0.129389778f, -0.0456252173f, 0.0527504198f, 0.0325019248f, -0.0745212287f, -0.186979532f, 0.0877138525f, 0.117918551f,
+    0.485775709f, 0.0710642338f, -0.20325692f, 0.0669673309f, 0.0187283084f, -0.0354087092f, -0.0876073614f, 0.0798436552f,
+    0.0461815633f, -0.0131980348f, 0.258963495f, 0.0343164019f, 0.0526567213f, 0.0646180287f, -0.0972351432f, 0.073727861f,
+    0.00191771833f, 0.0653590783f, 0.0589675158f, 0.147864282f, -0.0311937574f, -0.0332365148f, 0.048138842f, -0.502693772f,
+    0.143561304f, -0.032195773f, 0.0670509711f, 0.102167264f, -0.00527169136f, -0.121735044f, 0.0521747731f, 0.0334209241f,
+    0.225551292f, 0.104184426f, -0.318202227f, 0.0610485785f, -0.0639485791f, 0.0412808172f, -0.146295905f, 0.146242604f,
+    0.0526124053f, 0.0906833038f, 0.211578384f, -0.00305217155f, 0.0759094059f, 0.137339979f, 0.0253484454f, 0.0640890449f,
+    -0.0576251857f, -0.0399701372f, 0.00652364735f, 0.032326255f, -0.0501460098f, -0.0348581858f, -0.0272615179f, 0.0140531817f,
+    0.0230859779f, -0.0281982627f, 0.011938422f, 0.0263855681f, -0.0381064489f, -0.00386131764f, -0.0168309323f, -0.00187992386f,
+    0.0146829449f, 0.0120907705f, -0.0361481719f, -0.0567341f, 0.0300801639f, -0.0326644331f, 0.0258503817f, 0.0129383542f,
+    -0.0203895681f, 0.028772112f, -0.0126123866f, 0.022756841f, -0.00885737594f, 0.00950238202f, -0.0164361857f, -0.0285517685f,
+    -0.0329881944f, -0.0532076284f, -0.0155587392f, 0.0339433365f, -0.0346785486f, -0.00529306941f, -0.0251340065f, -0.0175932068f,
+    -0.0549929813f, -0.0787864998f, -0.0357624516f, -0.0187063981f, 0.0138270883f, -0.0630230084f, -0.00751198549f, -0.0287250225f,
+    -0.0441218279f, 0.00508252531f, -0.0224798135f, -0.0213786382f, -0.0216911621f, -0.0589024052f, -0.00992042013f, -0.0536926836f,
+    -0.0622249767f, 0.0299043488f, -0.0340976156f, -0.0500973836f, 0.0073779365f, 0.0366558209f, -0.0700555891f, -0.0607173294f,
+    0.00576044573f, -0.0512547046f, 0.0124774957f, -0.0514591597f, -0.000303585373f, 0.00148451014f, -0.0536513887f, -0.0350378044f,
+    -0.00263295695f, -0.00730965007f, 0.0407115296f, -0.0603323206f, -0.0247309189f, -0.0384070538f, -0.0291673057f, -0.0691259205f,
+    0.0214940924f, 0.0393494964f, 0.0372688137f, 0.0187045243f, -0.0374606438f, -0.00578047521f, -0.00489724427f, 0.0404886715f,
+    0.0278679896f, 0.0123441685f, 0.0334330648f, -0.0594771802f, 0.0369787104f, 0.00233879313f, -0.0105746966f, -0.016883472f,
+    -0.00916134287f, 0.0349311158f, 0.00283043273f, -0.0423054919f, -0.0785253942f, -0.0576212555f, 0.0619425066f, -0.056044206f,
+    -0.0207244456f, 0.020135656f, 0.0478703976f, -0.0164174475f, -0.000230553371f, 0.0305320527f, -0.0536180995f, -0.0525925756f,
+    -0.00201351405f, 0.0240778644f, 0.0419426635f, -0.0304496121f, -0.0570820421f, 0.00630804338f, 0.00558029022f, 0.00617736857f,
+    -0.0100432038f, 0.0154239452f, -0.0410633683f, 0.0298144333f, -0.00826239213f, -0.0512761138f, 0.00680700038f, -0.0507092625f,
+    -0.0608921871f, 0.0346133038f, 0.00482380064f, -0.0290810876f, 0.0100605013f, -0.0366502181f, -0.0694283992f, -0.0361933112f,
+    -0.0184882618f, -0.0492496528f, -0.0407725088f, 0.0412650369f, 0.0174727701f, -0.0309552625f, 0.0292816814f, -0.049808491f,
+    -0.0358932242f, 0.0326527134f, 0.0273654703f, 0.0289387945f, -0.0405967273f, -0.0610433668f, -0.0293060597f, -0.0611155368f,
+    -0.0202088263f, 0.0333696194f, -0.0192687027f, 0.0137730045f, 0.0217470992f, 0.0182894636f, -0.04219364f, -0.00978028867f,
+    -0.00982094835f, -0.0206065867f, 0.0278571174f, 0.0271776728f, -0.0569877513f, -0.0324926823f, 0.0225426909f, 0.0114814062f,
+    0.0387575626f, 0.0312838927f, -0.0341840275f, 0.00584377348f, -0.0449507833f, -0.0424341001f, -0.0843437165f, -0.0584771559f,
+    -0.0498901084f, -0.00164360285f, 0.0260205138f, -0.031039115f, -0.0580109395f, 0.0268654283f, -0.0832416937f, -0.0101540443f,
+    -0.0011193594f, -0.02590671f, -0.0303344298f, -0.0756880119f, 0.00312671717f, -0.0504136197f, -0.0511468202f, 0.0126350345f,
+    -0.00750668719f, 0.0444340594f, 0.0291688964f, -0.0682387725f, -0.065972738f, -0.0289450381f, 0.0472131446f, -0.0462379679f,
+    0.0372862481f, -0.0146263167f, 0.0264716614f, 0.0145935472f, 0.0116490871f, -0.0518619828f, -0.0876894444f, -0.0638535768f,
+    -0.0385638885f, 0.0305141062f, 0.0385883823f, -0.0597583503f, -0.0194770359f, -0.0412790924f, -0.00263517397f, 0.00791790802f,
+    -0.050635729f, -0.0218479112f, -0.0456824787f, 0.0361521095f, 0.00789520424f, -0.0389815308f, -0.0886129811f, -0.0608162656f,
+    -0.0265571382f, -0.0313020349f, -0.0293264464f, -0.0030141403f, 0.00451388676f, -0.0111486912f, -0.0777617916f, -0.00259039295f,
+    -0.0246991236f, -0.040656805f, 0.0399313569f, -0.0433839671f, -0.0584485084f, -0.0107566249f, -0.0535967015f, 0.0333021842f,
+    -0.0223472752f, -0.0412166715f, -0.0506206565f, -0.0367208719f, -0.0658558533f, -0.023792699f, -0.00818381738f, -0.0475123823f,
+    -0.0316481814f, 0.0432969145f, -0.0824815184f, -0.0872760713f, 0.00234284345f, -0.0460894927f, -0.0527548231f, 0.0311224535f,
+    0.0155309485f, -0.00965380855f, -0.0197300781f, -0.0331185423f, -0.0226203334f, -0.056881316f, 0.000180345989f, -0.0641754642f,
+    0.00992439967f, 0.0127041396f, -0.00741394842f, -0.0677253455f, -0.0366713814f, -0.012404575f, -0.05411838f, 0.0311304722f,
+    -0.0507940799f, -0.0483323708f, -0.00168425078f, 0.0111443419f, 0.0356718376f, 0.0480729416f, -0.0470730066f, 0.0189199168f,
+    0.0370523408f, 0.0489505194f, 0.044699382f, 0.0180668086f, -0.0244733859f, 0.0228682216f, -0.0564344637f, -0.0440410115f
+};
+
+alignas(16) static const float tensor_3[64] = {
+    0.00632322812f, 0.118593901f, 0.0263780169f, 0.178267255f, -0.0599668883f, -0.0160446782f, -0.0465149172f, -0.0383496806f,
+    -0.017320659f, -0.0234465729f, 0.0309405252f, -0.0084825987f, 0.0433043092f, -0.0761136264f, -0.020150261f, -0.0547562651f,
+    -0.0287375245f, -0.0409682468f, 0.0138863623f, 0.0302662607f, -0.0499671549f, 0.0256242715f, -0.00830895361f, -0.00642757816f,
+    0.058518663f, -0.015474706f, 0.0960395634f, 0.0124032535f, -0.00861697178f, 0.0442439206f, -0.0116980812f, -0.00628107134f,
+    0.0359684303f, 0.066765137f, 0.0405505858f, 0.0545389503f, -0.0579657033f, -0.0589223653f, -0.0613273866f, -0.00436816132f,
+    -0.0401580445f, 0.0374505445f, 0.00294136629f, -0.0867104977f, -0.0117255533f, -0.0647334009f, -0.0317418352f, -0.102286518f,
+    -0.048749961f, 0.0367897302f, 0.0134949433f, 0.0384228304f, -0.000313326891f, 0.0551122092f, -0.002715457f, 0.0110822003f,
+    0.0563638546f, 0.0897824541f, -0.0342869051f, 0.0439285077f, 0.00171373109f, -0.00435231207f, 0.0629135221f, -0.0515558608f
+};
+
+alignas(16) static const float tensor_9[384] = {
+    0.117848977f, 0.3051413f, 0.0706039816f, -0.183225483f, -0.074770309f, -0.217317134f, -0.0953773186f, -0.567367971f,
+    0.191026881f, 0.0264604352f, -0.0598745756f, 0.168449253f, -0.398594171f, -0.0727904886f, 0.173198655f, 0.204759747f,
+    0.000938262325f, -0.0659511909f, 0.197531179f, -0.556495249f, 0.235944316f, 0.174363211f, 0.150788009f, -0.352026075f,
+    0.111757793f, 0.148400143f, -0.258493781f, 0.190409347f, -0.0574428216f, -0.426685154f, -0.207938969f, -0.00274502696f,
+    0.0740963742f, -0.00496361591f, -0.0697790682f, 0.0216217209f, 0.00379180652f, -0.060123276f, 0.0372679867f, 0.249157712f,
+    0.190738648f, -0.529741764f, 0.193574429f, -0.35331744f, -0.0657743588f, -0.385118157f, -0.0597453266f, -0.31461069f,
+    0.0458792634f, 0.160756305f, -0.0270730928f, 0.194498524f, -0.274353117f, -0.129065022f, 0.253513336f, -0.0707664639f,
+    -0.0264830235f, -0.131974682f, 0.154726118f, -0.128388584f, 0.103497624f, 0.22533451f, -0.212422714f, 0.00629770057f,
+    -0.0517125353f, -0.392689973f, -0.00322193047f, -0.221841112f, 0.00330174994f, -0.0817422122f, -0.0122105563f, -0.0336818434f,
+    0.110520296f, -0.000570859294f, 0.177248701f, 0.22656323f, 0.408365637f, -0.114647903f, 0.210324302f, -0.167040735f,
+    0.244843379f, -0.0791159272f, -0.117751494f, -0.200522944f, 0.180415705f, -0.186375201f, -0.18666324f, 0.298889458f,
+    -0.211150274f, 0.0416228175f, -0.018524209f, -0.160008937f, -0.23567836f, 0.310196668f, 0.279534876f, 0.082950674f,
+    0.193438217f, 0.236819759f, -0.111610793f, 0.0288234036f, -0.270972282f, 0.123777591f, 0.258674115f, -0.360145956f,
+    -0.277938843f, 0.37789771f, 0.0415848829f, -0.324286669f, 0.106375672f, 0.120688401f, 0.267381519f, 0.316476077f,
+    -0.0661220849f, 0.142887488f, -0.0554904975f, 0.0134255635f, 0.350009412f, 0.408637345f, -0.241238177f, 0.139466211f,
+    0.294898927f, 0.321780652f, -0.0385772474f, -0.18698886f, -0.101603545f, -0.230923921f, 0.211786315f, -0.0369539894f,
+    0.258988768f, 0.0141174551f, -0.217761427f, 0.217505172f, 0.00341096125f, 0.521917403f, 0.0528802723f, 0.183830932f,
+    -0.29717505f, 0.0507480763f, 0.066804722f, -0.129837856f, -0.107539296f, 0.152118266f, -0.145802751f, -0.0118470201f,
+    0.167327568f, -0.155418038f, -0.176101059f, 0.276834637f, -0.441401243f, -0.242119163f, 0.181604505f, -0.147026196f,
+    -0.142629713f, -0.141530201f, 0.197179005f, 0.0668639839f, 0.0575316995f, -0.183725566f, -0.025475163f, -0.247090861f,
+    0.023224907f, 0.0752673894f, 0.0753686205f, -0.244026437f, 0.0196076017f, -0.000635042379f, -0.19141531f, -0.0950004458f,
+    0.0233575497f, -0.283641487f, -0.271313488f, 0.0475272015f, 0.238121524f, -0.44206357f, -0.263607949f, -0.499486387f,
+    0.013595989f, -0.282314628f, -0.0339613631f, 0.108303793f, 0.0118556833f, -0.121045254f, -0.363169074f, -0.0344250426f,
+    0.0904209986f, -0.159692094f, 0.0120290751f, 0.13778083f, 0.0101931198f, 0.164460555f, 0.126460001f, 0.0513710342f,
+    -0.378221512f, -0.0460513718f, 0.0046104677f, 0.0922428742f, -0.123522259f, -0.385904551f, -0.304763883f, -0.161774784f,
+    0.0844498873f, -0.0390095077f, -0.219690353f, -0.134574443f, 0.159504116f, -0.117610566f, -0.00946470629f, 0.0433865935f,
+    -0.068904534f, 0.0107840849f, 0.00904463604f, 0.0892001987f, 0.339375973f, -0.0853483006f, -0.312474281f, 0.139458761f,
+    -0.114886425f, 0.203401327f, 0.00357337319f, -0.0577904992f, -0.165934846f, 0.173475176f, -0.0151463132f, -0.0759673342f,
+    -0.051520519f, -0.112939015f, -0.0668535307f, 0.116693616f, 0.182058185f, -0.039752733f, 0.146131128f, 0.0964506119f,
+    -0.185160607f, 0.231811762f, -0.0936454013f, 0.0932384059f, -0.0920391679f, 0.17422989f, 0.184950188f, 0.357582569f,
+    0.111984126f, -0.066116482f, -0.11556071f, 0.0657714307f, 0.00119869958f, 0.217867598f, 0.107917152f, 0.00434023561f,
+    -0.19406426f, 0.210093901f, -0.0766770989f, 0.0191419311f, -0.0187970232f, -0.170957983f, -0.171528101f, 0.0337198153f,
+    0.0200659707f, 0.0310273841f, 0.165251926f, 0.0947273672f, 0.00323929847f, -0.249634072f, 0.188642383f, 0.221507922f,
+    -0.058234252f, 0.0869735777f, 0.181586772f, -0.0722635537f, -0.194451764f, 0.320003808f, -0.206054971f, -0.218624741f,
+    -0.379729211f, 0.0638456494f, 0.175079897f, 0.22592245f, -0.185698807f, 0.130560666f, -0.228445113f, 0.00813613366f,
+    -0.193322837f, 0.128720313f, 0.206375718f, 0.18848224f, 0.342004031f, -0.20332785f, -0.196232691f, 0.10813652f,
+    -0.249915004f, -0.348540694f, 0.0860923976f, -0.138613552f, -0.0153507562f, -0.064806819f, -0.0273894593f, -0.0167798437f,
+    0.220150754f, 0.106764108f, -0.00240507233f, 0.32044214f, -0.321397305f, -0.0953867659f, -0.250437081f, 0.195362151f,
+    0.0768102705f, -0.00145558338f, 0.024792783f, -0.25979948f, -0.125937939f, -0.342676282f, -0.0399882309f, 0.101005994f,
+    0.10492187f, -0.13870436f, -0.363827407f, 0.243805543f, -0.00625882531f, -0.107770309f, -0.0456672236f, 0.00656199781f,
+    0.210111186f, 0.148607537f, -0.226713061f, 0.157262057f, 0.0607003048f, 0.139972165f, 0.220328733f, -0.187267706f,
+    0.0554065406f, 0.078128323f, -0.24518095f, -0.143719643f, -0.241975501f, -0.230265722f, -0.12395376f, -0.115098961f,
+    0.110624216f, 0.00666387845f, -0.239115089f, -0.0873735696f, -0.10907983f, -0.146416694f, 0.243715212f, -0.163142979f,
+    0.329236507f, -0.179797441f, 0.069592528f, -0.259123623f, -0.301683843f, 0.0201730728f, 0.0651980415f, 0.125160784f,
+    -0.0547034144f, -0.0162707325f, -0.0406688079f, -0.123061083f, 0.191850901f, 0.0721046254f, -0.0583851896f, -0.124643862f,
+    -0.225468591f, -0.18556419f, 0.152574271f, -0.199032441f, -0.135744438f, -0.0895694494f, -0.0164857823f, -0.286390841f,
+    -0.0553917475f, -0.025579894f, 0.0163849853f, 0.0267413352f, -0.00584948622f, -0.102697603f, 0.240227818f, -0.259873867f,
+    -0.0326021127f, 0.0778063312f, 0.174801946f, 0.123024538f, 0.0706200004f, 0.0132294325f, 0.0184480287f, -0.00136187684f
+};
+
+alignas(16) static const float tensor_7[6] = {
+    0.101419002f, -0.0390853956f, 0.0752500072f, -0.0818987712f, -0.0379488021f, -0.0327099152f
+};
+
+size_t sign_model_arena_size() {
+    return ACTIVATION_BYTES;
+}
+
+void sign_model_predict(const uint8_t* rgb, float* logits, uint8_t* arena) {
+    float* t10 = reinterpret_cast<float*>(arena + 0);
+    float* t11 = reinterpret_cast<float*>(arena + 262144);
+    float* t12 = reinterpret_cast<float*>(arena + 0);
+    float* t13 = reinterpret_cast<float*>(arena + 131072);
+    float* t14 = reinterpret_cast<float*>(arena + 0);
+
+    // CONV_2D 64x64x3 -> 64x64x16, 3x3 filter
+    aot_conv_rgb_f32<64, 64, 3, 64, 64, 16, 3, 3, 1, 1, 1, 1>(rgb, conv_0_filter, conv_0_bias, t10, 127.5f, 0.0f, FLT_MAX);
+    // MAX_POOL_2D 64x64x16 -> 32x32x16
+    aot_max_pool_f32<64, 64, 16, 32, 32, 2, 2, 2, 2, 0, 0>(t10, t11, -FLT_MAX, FLT_MAX);
+    // CONV_2D 32x32x16 -> 32x32x32, 3x3 filter
+    aot_conv_f32<32, 32, 16, 32, 32, 32, 3, 3, 1, 1, 1, 1>(t11, tensor_5, tensor_2, t12, 0.0f, FLT_MAX);
+    // MAX_POOL_2D 32x32x32 -> 16x16x32
+    aot_max_pool_f32<32, 32, 32, 16, 16, 2, 2, 2, 2, 0, 0>(t12, t13, -FLT_MAX, FLT_MAX);
+    // CONV_2D 16x16x32 -> 16x16x64, 3x3 filter
+    aot_conv_f32<16, 16, 32, 16, 16, 64, 3, 3, 1, 1, 1, 1>(t13, tensor_6, tensor_3, t14, 0.0f, FLT_MAX);
+    // MEAN 16x16x64 -> 64
+    // FULLY_CONNECTED fused -> 6
+    aot_mean_fully_connected_f32<256, 64, 6>(t14, tensor_9, tensor_7, logits, -FLT_MAX, FLT_MAX);
+}
@@ -0,0 +1,19 @@
+// Generated by tools/model_compiler, do not edit
+#ifndef SIGN_MODEL_AOT_H
+#define SIGN_MODEL_AOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SIGN_MODEL_INPUT_HEIGHT 64
+#define SIGN_MODEL_INPUT_WIDTH 64
+#define SIGN_MODEL_INPUT_CHANNELS 3
+#define SIGN_MODEL_OUTPUTS 6
+
+// Bytes of the arena predict() works in, activations and esp-nn scratch
+size_t sign_model_arena_size();
+// rgb is the 64x64 HWC image, pixel p stands for (p / 255 - 0.5) / 0.5. Writes SIGN_MODEL_OUTPUTS logits,
+// the arena is 16 byte aligned and arena_size() bytes long
+void sign_model_predict(const uint8_t* rgb, float* logits, uint8_t* arena);
+
+#endif // SIGN_MODEL_AOT_H
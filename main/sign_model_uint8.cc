@@ -1,6 +1,6 @@
 #include <cstddef>
 
-alignas(4) unsigned char sign_model_tflite[] __attribute__((section(".rodata"))) = {
+alignas(16) unsigned char sign_model_tflite[] __attribute__((section(".rodata"))) = {
   0x20, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x00, 0x00, 0x00, 0x00,
   0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00,
   0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00,
@@ -46,6 +46,12 @@ extern "C" {
 #include "esp_nn_ansi_c.h"
 #endif
 
+/* kernels split between the calling core and a worker on the other one */
+#include "esp_nn_parallel.h"
+
+/* kernels staging tensors of external RAM in an internal buffer */
+#include "esp_nn_tiled.h"
+
 #ifdef __cplusplus
 }
 #endif
@@ -114,6 +114,28 @@ int esp_nn_get_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                       const conv_params_t *conv_params);
 void esp_nn_set_conv_scratch_buf_ansi(const void *buf);
 
+/**
+ * @brief       2d-convolution followed by max_pool, fused
+ *
+ * @note        inputs type: int8_t, output: int8_t
+ *              conv_dims are the dims of the convolution output the pool
+ *              reads, output_dims the pooled ones. Only the pooled values
+ *              are written, conv activation applies before the pool,
+ *              pool activation after it. Same results as esp_nn_conv_s8
+ *              followed by esp_nn_max_pool_s8.
+ */
+void esp_nn_conv_max_pool_s8_ansi(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const data_dims_t *conv_dims,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const conv_params_t *conv_params,
+                                  const pool_params_t *pool_params,
+                                  const quant_data_t *quant_data);
+
 int esp_nn_get_depthwise_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                                 const data_dims_t *filter_dims,
                                                 const data_dims_t *output_dims,
@@ -256,6 +278,149 @@ void esp_nn_softmax_s8_ansi(const int8_t *input_data,
                             int8_t *output_data);
 
 
+/************************** float32 functions ******************************/
+
+/**
+ * @brief       2d-convolution, float
+ *
+ * @note        layouts as the int8 version: input NHWC, filter OHWI
+ */
+void esp_nn_conv_f32_ansi(const data_dims_t *input_dims,
+                          const float *input_data,
+                          const data_dims_t *filter_dims,
+                          const float *filter_data,
+                          const float *bias,
+                          const data_dims_t *output_dims,
+                          float *out_data,
+                          const conv_f32_params_t *conv_params);
+
+/**
+ * @brief       2d-convolution of 8 bit pixels, float filters
+ *
+ * @note        The pixel normalisation of a model input is folded into
+ *              filter and bias by the caller, pad_value is the pixel the
+ *              zero padding of the normalised input stands for.
+ */
+void esp_nn_conv_rgb_f32_ansi(const data_dims_t *input_dims,
+                              const uint8_t *input_data,
+                              const data_dims_t *filter_dims,
+                              const float *filter_data,
+                              const float *bias,
+                              const data_dims_t *output_dims,
+                              float *out_data,
+                              const conv_f32_params_t *conv_params,
+                              const float pad_value);
+
+/**
+ * @brief       max_pool, float
+ */
+void esp_nn_max_pool_f32_ansi(const float *input,
+                              const uint16_t input_wd,
+                              const uint16_t input_ht,
+                              float *output,
+                              const uint16_t output_wd,
+                              const uint16_t output_ht,
+                              const uint16_t stride_wd,
+                              const uint16_t stride_ht,
+                              const uint16_t filter_wd,
+                              const uint16_t filter_ht,
+                              const uint16_t pad_wd,
+                              const uint16_t pad_ht,
+                              const float activation_min,
+                              const float activation_max,
+                              const uint16_t channels);
+
+/**
+ * @brief       global average pool, float
+ *
+ * @note        mean of every channel over input_wd * input_ht positions
+ */
+void esp_nn_global_avg_pool_f32_ansi(const float *input,
+                                     const uint16_t input_wd,
+                                     const uint16_t input_ht,
+                                     const uint16_t channels,
+                                     float *output);
+
+/**
+ * @brief       global average pool, int8
+ *
+ * @note        mean of every channel over input_wd * input_ht positions,
+ *              rounded as the integer Mean of TFLite Micro: the sum is
+ *              rescaled by out_mult and out_shift, then divided by the size
+ */
+void esp_nn_global_avg_pool_s8_ansi(const int8_t *input,
+                                    const uint16_t input_wd,
+                                    const uint16_t input_ht,
+                                    const uint16_t channels,
+                                    const int32_t input_offset,
+                                    const int32_t output_offset,
+                                    const int32_t out_mult,
+                                    const int32_t out_shift,
+                                    int8_t *output);
+
+/**
+ * @brief       fully connected, float
+ *
+ * @note        filter_data is out_channels rows of row_len
+ */
+void esp_nn_fully_connected_f32_ansi(const float *input_data,
+                                     const uint16_t row_len,
+                                     const float *filter_data,
+                                     const float *bias,
+                                     float *out_data,
+                                     const uint16_t out_channels,
+                                     const float activation_min,
+                                     const float activation_max);
+
+/* Channels the pooled row of the fused classifier head holds on the stack */
+#define ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS 256
+
+/**
+ * @brief       global average pool followed by fully connected, int8
+ *
+ * @note        the classifier head in one call: pool_offset, pool_mult and
+ *              pool_shift quantize the pooled row as
+ *              esp_nn_global_avg_pool_s8 does, the rest are the parameters
+ *              of esp_nn_fully_connected_s8 with filter_data out_channels
+ *              rows of channels. channels is at most
+ *              ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS
+ */
+void esp_nn_global_avg_pool_fc_s8_ansi(const int8_t *input,
+                                       const uint16_t input_wd,
+                                       const uint16_t input_ht,
+                                       const uint16_t channels,
+                                       const int32_t input_offset,
+                                       const int32_t pool_offset,
+                                       const int32_t pool_mult,
+                                       const int32_t pool_shift,
+                                       const int8_t *filter_data,
+                                       const int32_t filter_offset,
+                                       const int32_t *bias,
+                                       int8_t *out_data,
+                                       const uint16_t out_channels,
+                                       const int32_t out_offset,
+                                       const int32_t out_shift,
+                                       const int32_t out_mult,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max);
+
+/**
+ * @brief       global average pool followed by fully connected, float
+ *
+ * @note        channels is at most ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS
+ */
+void esp_nn_global_avg_pool_fc_f32_ansi(const float *input,
+                                        const uint16_t input_wd,
+                                        const uint16_t input_ht,
+                                        const uint16_t channels,
+                                        const float *filter_data,
+                                        const float *bias,
+                                        float *out_data,
+                                        const uint16_t out_channels,
+                                        const float activation_min,
+                                        const float activation_max);
+
+
 //////////////////////////// Generic optimisations /////////////////////////////
 
 /************************** Convolution functions *****************************/
@@ -306,6 +471,93 @@ int esp_nn_get_conv_scratch_size_opt(const data_dims_t *input_dims,
                                      const conv_params_t *conv_params);
 void esp_nn_set_conv_scratch_buf_opt(const void *buf);
 
+/**
+ * @brief       fused 2d-convolution and max_pool optimized version
+ *
+ * @note        requantizes once per pooled value: the largest accumulator
+ *              of the pool window gives the largest requantized output
+ *              since the multipliers are positive
+ */
+void esp_nn_conv_max_pool_s8_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const data_dims_t *filter_dims,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 const data_dims_t *conv_dims,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const pool_params_t *pool_params,
+                                 const quant_data_t *quant_data);
+
+/* Input channels the int32 sums of the Winograd convolution are exact for */
+#define ESP_NN_WINOGRAD_MAX_CHANNELS 128
+
+/**
+ * @brief       Whether esp_nn_conv_winograd_s8_opt can run a convolution:
+ *              3x3 filter, stride and dilation 1, at most
+ *              ESP_NN_WINOGRAD_MAX_CHANNELS input channels. pool_params,
+ *              NULL if none, must be a 2x2 stride 2 pool without padding.
+ */
+int esp_nn_conv_winograd_s8_supported_opt(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const conv_params_t *conv_params,
+                                          const pool_params_t *pool_params);
+
+/**
+ * @brief       Bytes of the transformed filters of a Winograd convolution
+ */
+int esp_nn_get_conv_winograd_filter_size_opt(const data_dims_t *input_dims,
+                                             const data_dims_t *output_dims);
+
+/**
+ * @brief       Winograd transform of OHWI 3x3 int8 filters, done once when
+ *              the model is prepared
+ */
+void esp_nn_conv_winograd_filter_s8_opt(const data_dims_t *input_dims,
+                                        const data_dims_t *output_dims,
+                                        const int8_t *filter_data,
+                                        int16_t *filter_transform);
+
+int esp_nn_get_conv_winograd_scratch_size_opt(const data_dims_t *input_dims);
+void esp_nn_set_conv_winograd_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       2d-convolution, Winograd F(2x2, 3x3), 16 multiplies per
+ *              2x2 output tile and input channel instead of 36
+ *
+ * @note        Same outputs as esp_nn_conv_s8: the integer transforms are
+ *              exact. filter_transform comes from
+ *              esp_nn_conv_winograd_filter_s8_opt, the scratch buffer must be
+ *              set before calling this. With pool_params the 2x2 stride 2
+ *              max pool is fused and output_dims are the pooled dims.
+ */
+void esp_nn_conv_winograd_s8_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const int16_t *filter_transform,
+                                 const int32_t *bias,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const pool_params_t *pool_params,
+                                 const quant_data_t *quant_data);
+
+/**
+ * @brief       esp_nn_conv_winograd_s8_opt with its own scratch buffer
+ *              instead of the one set, for convolutions running on both
+ *              cores at once
+ */
+void esp_nn_conv_winograd_s8_buf_opt(const data_dims_t *input_dims,
+                                     const int8_t *input_data,
+                                     const int16_t *filter_transform,
+                                     const int32_t *bias,
+                                     const data_dims_t *output_dims,
+                                     int8_t *out_data,
+                                     const conv_params_t *conv_params,
+                                     const pool_params_t *pool_params,
+                                     const quant_data_t *quant_data,
+                                     void *scratch);
+
 int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
                                                const data_dims_t *filter_dims,
                                                const data_dims_t *output_dims,
@@ -328,3 +580,223 @@ void esp_nn_softmax_s8_opt(const int8_t *input_data,
                            const int32_t shift,
                            const int32_t diff_min,
                            int8_t *output_data);
+
+/**
+ * @brief       relu6, optimized version
+ *
+ * @note        four values per 32 bit word, for targets without SIMD
+ */
+void esp_nn_relu6_s8_opt(int8_t *data, uint16_t size);
+
+/**
+ * @brief       max_pool, optimized version
+ *
+ * @note        four channels per 32 bit word, same results as the ansi
+ *              version
+ */
+void esp_nn_max_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels);
+
+/**
+ * @brief       avg_pool, optimized version
+ *
+ * @note        four channels per two words of 16 bit sums for windows of
+ *              up to 257 positions, same results as the ansi version
+ */
+void esp_nn_avg_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels);
+
+/**
+ * @brief       fully connected, optimized version
+ *
+ * @note        two filter rows per pass, the offsets applied once per row
+ *              instead of per product, same results as the ansi version
+ */
+void esp_nn_fully_connected_s8_opt(const int8_t *input_data,
+                                   const int32_t input_offset,
+                                   const uint16_t row_len,
+                                   const int8_t *filter_data,
+                                   const int32_t filter_offset,
+                                   const int32_t *bias,
+                                   int8_t *out_data,
+                                   const uint16_t out_channels,
+                                   const int32_t out_offset,
+                                   const int32_t out_shift,
+                                   const int32_t out_mult,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max);
+
+void esp_nn_fully_connected_per_ch_s8_opt(const int8_t *input_data,
+                                          const int32_t input_offset,
+                                          const uint16_t row_len,
+                                          const int8_t *filter_data,
+                                          const int32_t filter_offset,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const uint16_t out_channels,
+                                          const int32_t out_offset,
+                                          const int32_t *out_shift,
+                                          const int32_t *out_mult,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max);
+
+/************************** float32 functions optimized version ************/
+
+/**
+ * @brief       2d-convolution, float, optimized version
+ *
+ * @note        4 output channels per pass, bounds clipped once per
+ *              output position instead of tested per element
+ */
+void esp_nn_conv_f32_opt(const data_dims_t *input_dims,
+                         const float *input_data,
+                         const data_dims_t *filter_dims,
+                         const float *filter_data,
+                         const float *bias,
+                         const data_dims_t *output_dims,
+                         float *out_data,
+                         const conv_f32_params_t *conv_params);
+
+/**
+ * @brief       2d-convolution of 8 bit pixels, float filters, optimized version
+ *
+ * @note        3 channel RGB888 input with filters up to 7x7, otherwise
+ *              the ansi version is used
+ */
+void esp_nn_conv_rgb_f32_opt(const data_dims_t *input_dims,
+                             const uint8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const float *filter_data,
+                             const float *bias,
+                             const data_dims_t *output_dims,
+                             float *out_data,
+                             const conv_f32_params_t *conv_params,
+                             const float pad_value);
+
+/**
+ * @brief       max_pool, float, optimized version
+ */
+void esp_nn_max_pool_f32_opt(const float *input,
+                             const uint16_t input_wd,
+                             const uint16_t input_ht,
+                             float *output,
+                             const uint16_t output_wd,
+                             const uint16_t output_ht,
+                             const uint16_t stride_wd,
+                             const uint16_t stride_ht,
+                             const uint16_t filter_wd,
+                             const uint16_t filter_ht,
+                             const uint16_t pad_wd,
+                             const uint16_t pad_ht,
+                             const float activation_min,
+                             const float activation_max,
+                             const uint16_t channels);
+
+/**
+ * @brief       global average pool, float, optimized version
+ *
+ * @note        sums channel rows, may differ from the ansi version in
+ *              the last bit as it scales by the reciprocal of the size
+ */
+void esp_nn_global_avg_pool_f32_opt(const float *input,
+                                    const uint16_t input_wd,
+                                    const uint16_t input_ht,
+                                    const uint16_t channels,
+                                    float *output);
+
+/**
+ * @brief       global average pool, int8, optimized version
+ *
+ * @note        sums blocks of contiguous channels, same results as the
+ *              ansi version
+ */
+void esp_nn_global_avg_pool_s8_opt(const int8_t *input,
+                                   const uint16_t input_wd,
+                                   const uint16_t input_ht,
+                                   const uint16_t channels,
+                                   const int32_t input_offset,
+                                   const int32_t output_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   int8_t *output);
+
+/**
+ * @brief       fully connected, float, optimized version
+ *
+ * @note        4 filter rows per pass
+ */
+void esp_nn_fully_connected_f32_opt(const float *input_data,
+                                    const uint16_t row_len,
+                                    const float *filter_data,
+                                    const float *bias,
+                                    float *out_data,
+                                    const uint16_t out_channels,
+                                    const float activation_min,
+                                    const float activation_max);
+
+/**
+ * @brief       global average pool followed by fully connected, int8,
+ *              optimized version
+ *
+ * @note        the pooled row stays on the stack, same results as the ansi
+ *              version
+ */
+void esp_nn_global_avg_pool_fc_s8_opt(const int8_t *input,
+                                      const uint16_t input_wd,
+                                      const uint16_t input_ht,
+                                      const uint16_t channels,
+                                      const int32_t input_offset,
+                                      const int32_t pool_offset,
+                                      const int32_t pool_mult,
+                                      const int32_t pool_shift,
+                                      const int8_t *filter_data,
+                                      const int32_t filter_offset,
+                                      const int32_t *bias,
+                                      int8_t *out_data,
+                                      const uint16_t out_channels,
+                                      const int32_t out_offset,
+                                      const int32_t out_shift,
+                                      const int32_t out_mult,
+                                      const int32_t activation_min,
+                                      const int32_t activation_max);
+
+/**
+ * @brief       global average pool followed by fully connected, float,
+ *              optimized version
+ */
+void esp_nn_global_avg_pool_fc_f32_opt(const float *input,
+                                       const uint16_t input_wd,
+                                       const uint16_t input_ht,
+                                       const uint16_t channels,
+                                       const float *filter_data,
+                                       const float *bias,
+                                       float *out_data,
+                                       const uint16_t out_channels,
+                                       const float activation_min,
+                                       const float activation_max);
@@ -81,3 +81,32 @@ typedef struct dw_conv_params {
     data_2d_t dilation;
     act_params_t activation;
 } dw_conv_params_t;
+
+/**
+ * @brief params of a max/avg pooling fused after another op
+ *
+ */
+typedef struct pool_params {
+    data_2d_t filter;
+    data_2d_t stride;
+    data_2d_t padding;
+    act_params_t activation;
+} pool_params_t;
+
+/**
+ * @brief min/max activation of float ops
+ */
+typedef struct act_f32_params {
+    float min;
+    float max;
+} act_f32_params_t;
+
+/**
+ * @brief params specific to float convolution 2d
+ *
+ */
+typedef struct conv_f32_params {
+    data_2d_t stride;
+    data_2d_t padding;
+    act_f32_params_t activation;
+} conv_f32_params_t;
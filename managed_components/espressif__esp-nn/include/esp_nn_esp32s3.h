@@ -242,6 +242,15 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 #define esp_nn_set_depthwise_conv_scratch_buf esp_nn_set_depthwise_conv_scratch_buf_esp32s3
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_esp32s3
+#define esp_nn_conv_max_pool_s8 esp_nn_conv_max_pool_s8_opt
+
+#define esp_nn_conv_winograd_s8_supported esp_nn_conv_winograd_s8_supported_opt
+#define esp_nn_get_conv_winograd_filter_size esp_nn_get_conv_winograd_filter_size_opt
+#define esp_nn_conv_winograd_filter_s8 esp_nn_conv_winograd_filter_s8_opt
+#define esp_nn_get_conv_winograd_scratch_size esp_nn_get_conv_winograd_scratch_size_opt
+#define esp_nn_set_conv_winograd_scratch_buf esp_nn_set_conv_winograd_scratch_buf_opt
+#define esp_nn_conv_winograd_s8 esp_nn_conv_winograd_s8_opt
+#define esp_nn_conv_winograd_s8_buf esp_nn_conv_winograd_s8_buf_opt
 
 #define esp_nn_relu6_s8 esp_nn_relu6_s8_esp32s3
 
@@ -254,3 +263,12 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 #define esp_nn_get_softmax_scratch_size esp_nn_get_softmax_scratch_size_opt
 #define esp_nn_set_softmax_scratch_buf esp_nn_set_softmax_scratch_buf_opt
 #define esp_nn_softmax_s8 esp_nn_softmax_s8_opt
+
+#define esp_nn_conv_f32 esp_nn_conv_f32_opt
+#define esp_nn_conv_rgb_f32 esp_nn_conv_rgb_f32_opt
+#define esp_nn_max_pool_f32 esp_nn_max_pool_f32_opt
+#define esp_nn_global_avg_pool_f32 esp_nn_global_avg_pool_f32_opt
+#define esp_nn_global_avg_pool_s8 esp_nn_global_avg_pool_s8_opt
+#define esp_nn_fully_connected_f32 esp_nn_fully_connected_f32_opt
+#define esp_nn_global_avg_pool_fc_s8 esp_nn_global_avg_pool_fc_s8_opt
+#define esp_nn_global_avg_pool_fc_f32 esp_nn_global_avg_pool_fc_f32_opt
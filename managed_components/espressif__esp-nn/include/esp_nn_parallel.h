@@ -0,0 +1,118 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_nn_defs.h"
+
+/**
+ * @brief   a worker on the other core, provided by the application
+ *
+ * @note    start() hands a job to the worker and returns right away, wait()
+ *          returns once it is done. One job runs at a time and a kernel
+ *          waits for its job before returning.
+ */
+typedef struct esp_nn_worker {
+    void (*start)(void (*job)(void *), void *arg);
+    void (*wait)(void);
+    void *scratch;          /* the worker's Winograd scratch, the caller's is the one set */
+    int32_t scratch_size;
+    int32_t min_macs;       /* smaller kernels run on the calling core alone */
+} esp_nn_worker_t;
+
+/**
+ * @brief   kernels below split their work with this worker, NULL to run
+ *          them on the calling core only. The worker must outlive its use.
+ */
+void esp_nn_set_worker(const esp_nn_worker_t *worker);
+
+/**
+ * @brief   the worker set, NULL without one
+ */
+const esp_nn_worker_t *esp_nn_get_worker(void);
+
+/**
+ * @brief   the kernels of the same name split in two: the output rows of a
+ *          convolution, the output channels of a fully connected. The
+ *          calling core runs the first half, the worker the second, each
+ *          with the unchanged kernel, so outputs are bit-exact with the
+ *          single core call.
+ *
+ * @note    Without a worker, below its min_macs, or when the kernel needs
+ *          the one conv scratch buffer of esp_nn_set_conv_scratch_buf
+ *          (esp32s3, esp32p4), they are the plain call.
+ */
+void esp_nn_parallel_conv_s8(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data);
+
+void esp_nn_parallel_conv_max_pool_s8(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *filter_dims,
+                                      const int8_t *filter_data,
+                                      const int32_t *bias,
+                                      const data_dims_t *conv_dims,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const conv_params_t *conv_params,
+                                      const pool_params_t *pool_params,
+                                      const quant_data_t *quant_data);
+
+void esp_nn_parallel_conv_winograd_s8(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const int16_t *filter_transform,
+                                      const int32_t *bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const conv_params_t *conv_params,
+                                      const pool_params_t *pool_params,
+                                      const quant_data_t *quant_data);
+
+void esp_nn_parallel_conv_f32(const data_dims_t *input_dims,
+                              const float *input_data,
+                              const data_dims_t *filter_dims,
+                              const float *filter_data,
+                              const float *bias,
+                              const data_dims_t *output_dims,
+                              float *out_data,
+                              const conv_f32_params_t *conv_params);
+
+void esp_nn_parallel_conv_rgb_f32(const data_dims_t *input_dims,
+                                  const uint8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const float *filter_data,
+                                  const float *bias,
+                                  const data_dims_t *output_dims,
+                                  float *out_data,
+                                  const conv_f32_params_t *conv_params,
+                                  const float pad_value);
+
+void esp_nn_parallel_fully_connected_s8(const int8_t *input_data,
+                                        const int32_t input_offset,
+                                        const uint16_t row_len,
+                                        const int8_t *filter_data,
+                                        const int32_t filter_offset,
+                                        const int32_t *bias,
+                                        int8_t *out_data,
+                                        const uint16_t out_channels,
+                                        const int32_t out_offset,
+                                        const int32_t out_shift,
+                                        const int32_t out_mult,
+                                        const int32_t activation_min,
+                                        const int32_t activation_max);
+
+void esp_nn_parallel_fully_connected_f32(const float *input_data,
+                                         const uint16_t row_len,
+                                         const float *filter_data,
+                                         const float *bias,
+                                         float *out_data,
+                                         const uint16_t out_channels,
+                                         const float activation_min,
+                                         const float activation_max);
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "esp_nn_defs.h"
+
+/**
+ * @brief   internal RAM the kernels below stage their tiles in, NULL to run
+ *          them on the tensors in place. The buffer must outlive its use and
+ *          not be the one of esp_nn_set_conv_scratch_buf.
+ */
+void esp_nn_set_tile_buf(void *buf, int32_t size);
+
+/**
+ * @brief   the kernels of the same name over bands of output rows: the input
+ *          rows of a band, with the halo its filter reads, are copied to the
+ *          tile buffer, the band is computed there and copied out. A filter
+ *          taking at most half of the buffer is copied in first. Bands are
+ *          as tall as the buffer holds.
+ *
+ * @note    With a worker of esp_nn_set_worker, the input of the next band is
+ *          copied by the worker while the calling core computes the current
+ *          one, in two input slots. Outputs are bit-exact with the plain
+ *          call, which runs in place without a buffer or when one output row
+ *          does not fit.
+ */
+void esp_nn_tiled_conv_s8(const data_dims_t *input_dims,
+                          const int8_t *input_data,
+                          const data_dims_t *filter_dims,
+                          const int8_t *filter_data,
+                          const int32_t *bias,
+                          const data_dims_t *output_dims,
+                          int8_t *out_data,
+                          const conv_params_t *conv_params,
+                          const quant_data_t *quant_data);
+
+void esp_nn_tiled_conv_f32(const data_dims_t *input_dims,
+                           const float *input_data,
+                           const data_dims_t *filter_dims,
+                           const float *filter_data,
+                           const float *bias,
+                           const data_dims_t *output_dims,
+                           float *out_data,
+                           const conv_f32_params_t *conv_params);
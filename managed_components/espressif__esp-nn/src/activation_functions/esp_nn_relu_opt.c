@@ -0,0 +1,28 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/* Four values per word: clamped to [0, 6] lane by lane, 8 per iteration */
+void esp_nn_relu6_s8_opt(int8_t *data, uint16_t size)
+{
+    const uint32_t zero = 0;
+    const uint32_t six = ESP_NN_SWAR_SPLAT(6);
+    int32_t i = 0;
+    for (; i < size - 7; i += 8) {
+        uint32_t w0 = esp_nn_swar_load(data + i);
+        uint32_t w1 = esp_nn_swar_load(data + i + 4);
+        w0 = esp_nn_swar_min_s8(esp_nn_swar_max_s8(w0, zero), six);
+        w1 = esp_nn_swar_min_s8(esp_nn_swar_max_s8(w1, zero), six);
+        esp_nn_swar_store(data + i, w0);
+        esp_nn_swar_store(data + i + 4, w1);
+    }
+    for (; i < size; i++) {
+        int32_t ip = data[i];
+        ip = max(ip, 0);
+        data[i] = min(ip, 6);
+    }
+}
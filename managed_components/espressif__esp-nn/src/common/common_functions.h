@@ -89,6 +89,53 @@ __NN_FORCE_INLINE__ int32_t esp_nn_saturate8(int32_t in)
 #endif
 }
 
+/**
+ * SWAR helpers: four int8 lanes in a 32 bit word, for targets without SIMD.
+ * Loads and stores go through memcpy, the pointers need no alignment.
+ */
+#define ESP_NN_SWAR_HIGH 0x80808080u
+#define ESP_NN_SWAR_LOW7 0x7f7f7f7fu
+#define ESP_NN_SWAR_EVEN 0x00ff00ffu
+
+/* the byte in all four lanes */
+#define ESP_NN_SWAR_SPLAT(val) ((uint32_t) (uint8_t) (val) * 0x01010101u)
+
+__NN_FORCE_INLINE__ uint32_t esp_nn_swar_load(const int8_t *ptr)
+{
+    uint32_t word;
+    memcpy(&word, ptr, sizeof(word));
+    return word;
+}
+
+__NN_FORCE_INLINE__ void esp_nn_swar_store(int8_t *ptr, uint32_t word)
+{
+    memcpy(ptr, &word, sizeof(word));
+}
+
+/* 0xff in the lanes where a >= b as int8, 0 in the others */
+__NN_FORCE_INLINE__ uint32_t esp_nn_swar_ge_s8(uint32_t a, uint32_t b)
+{
+    /* flipping the sign bits orders int8 as uint8 */
+    a ^= ESP_NN_SWAR_HIGH;
+    b ^= ESP_NN_SWAR_HIGH;
+    /* top bit of each lane: low 7 bits of a >= low 7 bits of b, no borrow crosses a lane */
+    const uint32_t low_ge = (a | ESP_NN_SWAR_HIGH) - (b & ESP_NN_SWAR_LOW7);
+    const uint32_t ge = ((a & ~b) | (~(a ^ b) & low_ge)) & ESP_NN_SWAR_HIGH;
+    return (ge << 1) - (ge >> 7);
+}
+
+__NN_FORCE_INLINE__ uint32_t esp_nn_swar_max_s8(uint32_t a, uint32_t b)
+{
+    const uint32_t ge = esp_nn_swar_ge_s8(a, b);
+    return (a & ge) | (b & ~ge);
+}
+
+__NN_FORCE_INLINE__ uint32_t esp_nn_swar_min_s8(uint32_t a, uint32_t b)
+{
+    const uint32_t ge = esp_nn_swar_ge_s8(a, b);
+    return (b & ge) | (a & ~ge);
+}
+
 __NN_FORCE_INLINE__ int32_t esp_nn_pick_sat_high32_of64(int64_t val64)
 {
     int32_t sign = (int32_t) (val64 >> 63);
@@ -117,6 +164,27 @@ __NN_FORCE_INLINE__ int32_t esp_nn_sat_round_doubling_high_mul(int32_t in0, int3
     return overflow ? INT32_MAX : result;
 }
 
+/* High word of the 64 bit product, a single mulsh on cores with MUL32_HIGH */
+__NN_FORCE_INLINE__ int32_t esp_nn_mulhi_s32(int32_t in0, int32_t in1)
+{
+    return (int32_t) (((int64_t) in0 * in1) >> 32);
+}
+
+/**
+ * esp_nn_sat_round_doubling_high_mul from two 32 bit halves of the product,
+ * with no 64 bit adds or shifts. Both round (in0 * in1 + 2^30) / 2^31 down,
+ * the sign dependent nudge and truncation of the reference come to the same.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_sat_round_doubling_high_mul_mulhi(int32_t in0, int32_t in1)
+{
+    const uint32_t lo = (uint32_t) in0 * (uint32_t) in1;
+    const uint32_t lo_nudged = lo + (1u << 30);
+    const int32_t hi = esp_nn_mulhi_s32(in0, in1) + (lo_nudged < lo);
+    const int32_t result = (int32_t) (((uint32_t) hi << 1) | (lo_nudged >> 31));
+    bool overflow = (in0 == in1) && (in0 == (int32_t) INT32_MIN);
+    return overflow ? INT32_MAX : result;
+}
+
 /**
  * fast version
  * this will fail for values closer to INT32_MAX and INT32_MIN by `1 << (exponent - 1)`.
@@ -145,7 +213,13 @@ __NN_FORCE_INLINE__ int32_t esp_nn_div_by_power_of_two(int32_t val, int32_t expo
     return result;
 }
 
-__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult(int32_t x, int32_t mult, int32_t shift)
+/**
+ * Requantization on 32 bit halves of the product, selected with
+ * CONFIG_NN_REQUANT_*: the 64 bit reference, the same results from a mulsh
+ * and a mull (default), or one rounding instead of two, within 1 of the
+ * reference.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_ref(int32_t x, int32_t mult, int32_t shift)
 {
     int32_t left_shift = shift > 0 ? shift : 0;
     int32_t right_shift = shift > 0 ? 0 : -shift;
@@ -153,21 +227,92 @@ __NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult(int32_t x, int32_t
     return esp_nn_div_by_power_of_two(result, right_shift);
 }
 
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_mulhi(int32_t x, int32_t mult, int32_t shift)
+{
+    int32_t left_shift = shift > 0 ? shift : 0;
+    int32_t right_shift = shift > 0 ? 0 : -shift;
+    int32_t result = esp_nn_sat_round_doubling_high_mul_mulhi(x * (1 << left_shift), mult);
+    return esp_nn_div_by_power_of_two(result, right_shift);
+}
+
+/**
+ * (x * mult) / 2^(31 + right_shift) rounded once, the reference rounds the
+ * doubling high mul and then the shift. From a right shift of 2 the rounding
+ * bit is in the high word and the low one is not needed.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_round_once(int32_t x, int32_t mult, int32_t shift)
+{
+    int32_t left_shift = max(shift, 0);
+    int32_t right_shift = left_shift - shift;
+    int32_t in0 = x * (1 << left_shift);
+
+    if (right_shift >= 2) {
+        return (esp_nn_mulhi_s32(in0, mult) + (1 << (right_shift - 2))) >> (right_shift - 1);
+    }
+    if (right_shift == 1) {
+        const uint32_t lo = (uint32_t) in0 * (uint32_t) mult;
+        return esp_nn_mulhi_s32(in0, mult) + (int32_t) (lo >> 31);
+    }
+    return esp_nn_sat_round_doubling_high_mul_mulhi(in0, mult);
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult(int32_t x, int32_t mult, int32_t shift)
+{
+#if defined(CONFIG_NN_REQUANT_REFERENCE)
+    return esp_nn_multiply_by_quantized_mult_ref(x, mult, shift);
+#elif defined(CONFIG_NN_REQUANT_ROUND_ONCE)
+    return esp_nn_multiply_by_quantized_mult_round_once(x, mult, shift);
+#else
+    return esp_nn_multiply_by_quantized_mult_mulhi(x, mult, shift);
+#endif
+}
+
 __NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_fast(int32_t x, int32_t mult, int32_t shift)
 {
+#if defined(CONFIG_NN_REQUANT_ROUND_ONCE)
+    return esp_nn_multiply_by_quantized_mult_round_once(x, mult, shift);
+#else
     int32_t left_shift = max(shift, 0);
     int32_t right_shift = left_shift - shift;
 
+#if defined(CONFIG_NN_REQUANT_REFERENCE)
     int64_t nudge_val = 1 << 30;
     int64_t in0_64 = (int64_t) (x << left_shift);
 
     /* Multiply and add nudge */
     int64_t mult_64 = in0_64 * mult + nudge_val;
     int32_t result = (int32_t) (mult_64 >> 31);
+#else
+    int32_t result = esp_nn_sat_round_doubling_high_mul_mulhi(x << left_shift, mult);
+#endif
     if (right_shift) {
         result = esp_nn_div_by_power_of_two_fast(result, right_shift);
     }
     return result;
+#endif
+}
+
+/**
+ * Input rows a convolution reads for its output rows [begin, end), as the
+ * input of a convolution of only those rows: the first row, the number of
+ * rows and the padding left on top. Rows past the input stay padding.
+ */
+typedef struct {
+    int32_t row;
+    int32_t rows;
+    int32_t pad;
+} esp_nn_input_rows_t;
+
+__NN_FORCE_INLINE__ esp_nn_input_rows_t esp_nn_conv_input_rows(int32_t input_ht, int32_t filter_ht, int32_t stride,
+                                                               int32_t pad, int32_t begin, int32_t end)
+{
+    const int32_t first = begin * stride - pad;
+    const int32_t last = (end - 1) * stride - pad + filter_ht;
+    esp_nn_input_rows_t r;
+    r.row = max(0, first);
+    r.pad = r.row - first;
+    r.rows = max(0, min(input_ht, last) - r.row);
+    return r;
 }
 
 static void esp_nn_aligned_s8_pad_with_value(const int8_t *src, int8_t *dst,
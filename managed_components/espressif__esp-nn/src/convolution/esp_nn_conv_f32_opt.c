@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_nn_defs.h>
+
+#include <common_functions.h>
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: dialation width = 1
+ *
+ * Bounds are clipped once per output position: the filter columns inside the
+ * input are one contiguous span of input and filter in every filter row, so
+ * the inner loop has no padding tests. 4 output channels share each input
+ * value loaded, their accumulators stay in FPU registers.
+ */
+void esp_nn_conv_f32_opt(const data_dims_t *input_dims,
+                         const float *input_data,
+                         const data_dims_t *filter_dims,
+                         const float *filter_data,
+                         const float *bias,
+                         const data_dims_t *output_dims,
+                         float *out_data,
+                         const conv_f32_params_t *conv_params)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const float activation_min = conv_params->activation.min;
+    const float activation_max = conv_params->activation.max;
+
+    const int32_t filter_size = filter_wd * filter_ht * in_channels;
+    const int32_t input_row_size = input_wd * in_channels;
+    const int32_t filter_row_size = filter_wd * in_channels;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = stride_ht * out_y - pad_ht;
+        const int32_t filter_y_start = max(0, -base_y);
+        const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+        const int32_t rows = filter_y_end - filter_y_start;
+
+        for (int32_t out_x = 0; out_x < out_wd; out_x++, out_data += out_channels) {
+            const int32_t base_x = stride_wd * out_x - pad_wd;
+            const int32_t filter_x_start = max(0, -base_x);
+            const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+            const int32_t span = (filter_x_end - filter_x_start) * in_channels;
+
+            const float *input_ptr = input_data +
+                ((base_y + filter_y_start) * input_wd + base_x + filter_x_start) * in_channels;
+            const float *filter_ptr = filter_data + (filter_y_start * filter_wd + filter_x_start) * in_channels;
+
+            int32_t out_ch_idx = 0;
+            for (; out_ch_idx < out_channels - 3; out_ch_idx += 4, filter_ptr += 4 * filter_size) {
+                float acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+                const float *in_row = input_ptr;
+                const float *filter_row = filter_ptr;
+                for (int32_t row = 0; row < rows; row++, in_row += input_row_size, filter_row += filter_row_size) {
+                    const float *f0 = filter_row;
+                    const float *f1 = f0 + filter_size;
+                    const float *f2 = f1 + filter_size;
+                    const float *f3 = f2 + filter_size;
+                    for (int32_t i = 0; i < span; i++) {
+                        const float x = in_row[i];
+                        acc0 += x * f0[i];
+                        acc1 += x * f1[i];
+                        acc2 += x * f2[i];
+                        acc3 += x * f3[i];
+                    }
+                }
+                if (bias) {
+                    acc0 += bias[out_ch_idx];
+                    acc1 += bias[out_ch_idx + 1];
+                    acc2 += bias[out_ch_idx + 2];
+                    acc3 += bias[out_ch_idx + 3];
+                }
+                out_data[out_ch_idx] = min(max(acc0, activation_min), activation_max);
+                out_data[out_ch_idx + 1] = min(max(acc1, activation_min), activation_max);
+                out_data[out_ch_idx + 2] = min(max(acc2, activation_min), activation_max);
+                out_data[out_ch_idx + 3] = min(max(acc3, activation_min), activation_max);
+            }
+            for (; out_ch_idx < out_channels; out_ch_idx++, filter_ptr += filter_size) {
+                float acc = 0;
+                const float *in_row = input_ptr;
+                const float *filter_row = filter_ptr;
+                for (int32_t row = 0; row < rows; row++, in_row += input_row_size, filter_row += filter_row_size) {
+                    for (int32_t i = 0; i < span; i++) {
+                        acc += in_row[i] * filter_row[i];
+                    }
+                }
+                if (bias) {
+                    acc += bias[out_ch_idx];
+                }
+                out_data[out_ch_idx] = min(max(acc, activation_min), activation_max);
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_nn_defs.h>
+
+#include <common_functions.h>
+
+/* Requantized and clamped output of one convolution position, as esp_nn_conv_s8_ansi */
+static int32_t esp_nn_conv_point_s8(const data_dims_t *input_dims,
+                                    const int8_t *input_data,
+                                    const data_dims_t *filter_dims,
+                                    const int8_t *filter_data,
+                                    const int32_t *bias,
+                                    const conv_params_t *conv_params,
+                                    const quant_data_t *quant_data,
+                                    const int32_t out_y,
+                                    const int32_t out_x,
+                                    const int32_t out_ch_idx)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+
+    const int32_t base_y = conv_params->stride.height * out_y - conv_params->padding.height;
+    const int32_t base_x = conv_params->stride.width * out_x - conv_params->padding.width;
+
+    const int32_t filter_y_start = max(0, -base_y);
+    const int32_t filter_x_start = max(0, -base_x);
+    const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+    const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+
+    int32_t conv_out = 0;
+    for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+        for (int32_t filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+            const int32_t in_row = base_y + filter_y_idx;
+            const int32_t in_col = base_x + filter_x_idx;
+            int32_t input_base_offset = (in_row * input_wd + in_col) * in_channels;
+            int32_t filter_base_offset = out_ch_idx * in_channels * filter_ht * filter_wd +
+                                         (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
+            for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                conv_out += (input_data[input_base_offset + in_ch_idx] + input_offset) *
+                            filter_data[filter_base_offset + in_ch_idx];
+            }
+        }
+    }
+    if (bias) {
+        conv_out += bias[out_ch_idx];
+    }
+    conv_out = esp_nn_multiply_by_quantized_mult(conv_out, quant_data->mult[out_ch_idx],
+                                                 quant_data->shift[out_ch_idx]);
+    conv_out += conv_params->out_offset;
+    conv_out = max(conv_out, conv_params->activation.min);
+    conv_out = min(conv_out, conv_params->activation.max);
+    return conv_out;
+}
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: dialation width = 1
+ */
+void esp_nn_conv_max_pool_s8_ansi(const data_dims_t *input_dims,
+                                  const int8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const int8_t *filter_data,
+                                  const int32_t *bias,
+                                  const data_dims_t *conv_dims,
+                                  const data_dims_t *output_dims,
+                                  int8_t *out_data,
+                                  const conv_params_t *conv_params,
+                                  const pool_params_t *pool_params,
+                                  const quant_data_t *quant_data)
+{
+    const uint16_t conv_wd = conv_dims->width;
+    const uint16_t conv_ht = conv_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const uint16_t pool_filter_wd = pool_params->filter.width;
+    const uint16_t pool_filter_ht = pool_params->filter.height;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = out_y * pool_params->stride.height - pool_params->padding.height;
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t base_x = out_x * pool_params->stride.width - pool_params->padding.width;
+            /* Make sure pool filter does not cross the convolution output */
+            int32_t filter_y_start = max(0, -base_y);
+            int32_t filter_x_start = max(0, -base_x);
+            int32_t filter_y_end = min(pool_filter_ht, conv_ht - base_y);
+            int32_t filter_x_end = min(pool_filter_wd, conv_wd - base_x);
+
+            for (int32_t ch_idx = 0; ch_idx < out_channels; ch_idx++) {
+                int32_t result = INT8_MIN;
+                for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++) {
+                    for (int32_t filter_x = filter_x_start; filter_x < filter_x_end; filter_x++) {
+                        int32_t conv_out = esp_nn_conv_point_s8(input_dims, input_data, filter_dims,
+                                                                filter_data, bias, conv_params, quant_data,
+                                                                base_y + filter_y, base_x + filter_x, ch_idx);
+                        result = max(conv_out, result);
+                    }
+                }
+                result = max(result, pool_params->activation.min);
+                result = min(result, pool_params->activation.max);
+                *out_data++ = (int8_t) result;
+            }
+        }
+    }
+}
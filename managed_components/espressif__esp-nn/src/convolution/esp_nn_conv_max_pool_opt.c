@@ -0,0 +1,126 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_nn_defs.h>
+
+#include <common_functions.h>
+
+/* Accumulator of one convolution position before bias and requantization */
+__NN_FORCE_INLINE__ int32_t esp_nn_conv_acc_s8(const int8_t *input_data,
+                                               const int8_t *filter_data,
+                                               const uint16_t input_wd,
+                                               const uint16_t input_ht,
+                                               const uint16_t in_channels,
+                                               const int32_t input_offset,
+                                               const uint16_t filter_wd,
+                                               const uint16_t filter_ht,
+                                               const int32_t base_y,
+                                               const int32_t base_x)
+{
+    const int32_t filter_y_start = max(0, -base_y);
+    const int32_t filter_x_start = max(0, -base_x);
+    const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+    const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+
+    int32_t conv_out = 0;
+    for (int32_t filter_y_idx = filter_y_start; filter_y_idx < filter_y_end; filter_y_idx++) {
+        for (int32_t filter_x_idx = filter_x_start; filter_x_idx < filter_x_end; filter_x_idx++) {
+            const int8_t *input_ptr = input_data +
+                            ((base_y + filter_y_idx) * input_wd + base_x + filter_x_idx) * in_channels;
+            const int8_t *filter_ptr = filter_data + (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
+            int32_t in_ch_idx = 0;
+            for (; in_ch_idx < in_channels - 3; in_ch_idx += 4) {
+                conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+                conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+            }
+            for (; in_ch_idx < in_channels; in_ch_idx++) {
+                conv_out += (*input_ptr++ + input_offset) * *filter_ptr++;
+            }
+        }
+    }
+    return conv_out;
+}
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: dialation width = 1
+ * Assumption 3: quant_data->mult >= 0, as tflite's QuantizeMultiplier gives
+ */
+void esp_nn_conv_max_pool_s8_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const data_dims_t *filter_dims,
+                                 const int8_t *filter_data,
+                                 const int32_t *bias,
+                                 const data_dims_t *conv_dims,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const pool_params_t *pool_params,
+                                 const quant_data_t *quant_data)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t conv_wd = conv_dims->width;
+    const uint16_t conv_ht = conv_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t filter_size = filter_wd * filter_ht * in_channels;
+    /* the pool of an empty window gives INT8_MIN */
+    const int32_t empty_out = min(max(INT8_MIN, pool_params->activation.min), pool_params->activation.max);
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t pool_y = out_y * pool_params->stride.height - pool_params->padding.height;
+        const int32_t conv_y_start = max(0, pool_y);
+        const int32_t conv_y_end = min(conv_ht, pool_y + pool_params->filter.height);
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            const int32_t pool_x = out_x * pool_params->stride.width - pool_params->padding.width;
+            const int32_t conv_x_start = max(0, pool_x);
+            const int32_t conv_x_end = min(conv_wd, pool_x + pool_params->filter.width);
+            if (conv_y_start >= conv_y_end || conv_x_start >= conv_x_end) {
+                for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                    *out_data++ = (int8_t) empty_out;
+                }
+                continue;
+            }
+
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+            const int8_t *filter_ptr = filter_data;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++, filter_ptr += filter_size) {
+                /* requantization is monotonic, only the largest accumulator of the window is requantized */
+                int32_t acc_max = INT32_MIN;
+                for (int32_t conv_y = conv_y_start; conv_y < conv_y_end; conv_y++) {
+                    for (int32_t conv_x = conv_x_start; conv_x < conv_x_end; conv_x++) {
+                        int32_t acc = esp_nn_conv_acc_s8(input_data, filter_ptr, input_wd, input_ht, in_channels,
+                                                         input_offset, filter_wd, filter_ht,
+                                                         conv_y * stride_ht - pad_ht, conv_x * stride_wd - pad_wd);
+                        acc_max = max(acc, acc_max);
+                    }
+                }
+                if (bias) {
+                    acc_max += bias[out_ch_idx];
+                }
+                int32_t result = esp_nn_multiply_by_quantized_mult_fast(acc_max, *out_mult++, *out_shift++);
+                result += out_offset;
+                result = max(result, conv_params->activation.min);
+                result = min(result, conv_params->activation.max);
+                result = max(result, pool_params->activation.min);
+                result = min(result, pool_params->activation.max);
+                *out_data++ = (int8_t) result;
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_nn_defs.h>
+
+#include <common_functions.h>
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: dialation width = 1
+ */
+void esp_nn_conv_rgb_f32_ansi(const data_dims_t *input_dims,
+                              const uint8_t *input_data,
+                              const data_dims_t *filter_dims,
+                              const float *filter_data,
+                              const float *bias,
+                              const data_dims_t *output_dims,
+                              float *out_data,
+                              const conv_f32_params_t *conv_params,
+                              const float pad_value)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const float activation_min = conv_params->activation.min;
+    const float activation_max = conv_params->activation.max;
+
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        for (int32_t out_x = 0; out_x < out_wd; out_x++) {
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+                float conv_out = 0;
+
+                const int32_t base_y = stride_ht * out_y - pad_ht;
+                const int32_t base_x = stride_wd * out_x - pad_wd;
+
+                for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++) {
+                    for (int32_t filter_x_idx = 0; filter_x_idx < filter_wd; filter_x_idx++) {
+                        const int32_t in_row = base_y + filter_y_idx;
+                        const int32_t in_col = base_x + filter_x_idx;
+                        const int outside = in_row < 0 || in_row >= input_ht || in_col < 0 || in_col >= input_wd;
+                        int32_t input_base_offset = (in_row * input_wd + in_col) * in_channels;
+                        int32_t filter_base_offset = out_ch_idx * in_channels * filter_ht * filter_wd +
+                                                     (filter_y_idx * filter_wd + filter_x_idx) * in_channels;
+                        for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+                            /* padding reads as pad_value */
+                            const float pixel = outside ? pad_value : input_data[input_base_offset + in_ch_idx];
+                            conv_out += pixel * filter_data[filter_base_offset + in_ch_idx];
+                        }
+                    }
+                }
+                if (bias) {
+                    conv_out += bias[out_ch_idx];
+                }
+                conv_out = max(conv_out, activation_min);
+                conv_out = min(conv_out, activation_max);
+                *out_data++ = conv_out;
+            }
+        }
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+
+#include <common_functions.h>
+
+#define RGB_CHANNELS 3
+/* largest patch the columns on the stack hold, a 7x7 filter */
+#define RGB_MAX_PATCH (7 * 7 * RGB_CHANNELS)
+
+/* Filter window of one output position as floats, im2col style, taps in the padding take pad_value */
+static void esp_nn_rgb_patch_f32(const uint8_t *input_data,
+                                 const uint16_t input_wd,
+                                 const uint16_t input_ht,
+                                 const uint16_t filter_wd,
+                                 const uint16_t filter_ht,
+                                 const int32_t base_y,
+                                 const int32_t base_x,
+                                 const float pad_value,
+                                 float *col)
+{
+    const int32_t row_size = filter_wd * RGB_CHANNELS;
+    for (int32_t filter_y_idx = 0; filter_y_idx < filter_ht; filter_y_idx++, col += row_size) {
+        const int32_t in_row = base_y + filter_y_idx;
+        if (in_row < 0 || in_row >= input_ht) {
+            for (int32_t i = 0; i < row_size; i++) {
+                col[i] = pad_value;
+            }
+            continue;
+        }
+        const uint8_t *src = input_data + (in_row * input_wd + base_x) * RGB_CHANNELS;
+        if (base_x >= 0 && base_x + filter_wd <= input_wd) {
+            for (int32_t i = 0; i < row_size; i++) {
+                col[i] = src[i];
+            }
+            continue;
+        }
+        for (int32_t filter_x_idx = 0; filter_x_idx < filter_wd; filter_x_idx++, src += RGB_CHANNELS) {
+            const int32_t in_col = base_x + filter_x_idx;
+            float *dst = col + filter_x_idx * RGB_CHANNELS;
+            if (in_col < 0 || in_col >= input_wd) {
+                dst[0] = dst[1] = dst[2] = pad_value;
+            } else {
+                dst[0] = src[0];
+                dst[1] = src[1];
+                dst[2] = src[2];
+            }
+        }
+    }
+}
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: dialation width = 1
+ *
+ * Every pixel is converted to float once per output position instead of once
+ * per output channel: the window of two neighbouring outputs is laid out as a
+ * column each and the filters run over both, 4 output channels at a time, so
+ * 8 accumulators stay in FPU registers. Other channel counts and filters over
+ * 7x7 take the ansi version.
+ */
+void esp_nn_conv_rgb_f32_opt(const data_dims_t *input_dims,
+                             const uint8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const float *filter_data,
+                             const float *bias,
+                             const data_dims_t *output_dims,
+                             float *out_data,
+                             const conv_f32_params_t *conv_params,
+                             const float pad_value)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t stride_wd = conv_params->stride.width;
+    const uint16_t stride_ht = conv_params->stride.height;
+    const uint16_t filter_wd = filter_dims->width;
+    const uint16_t filter_ht = filter_dims->height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const float activation_min = conv_params->activation.min;
+    const float activation_max = conv_params->activation.max;
+    const int32_t filter_size = filter_wd * filter_ht * RGB_CHANNELS;
+
+    if (input_dims->channels != RGB_CHANNELS || filter_size > RGB_MAX_PATCH) {
+        esp_nn_conv_rgb_f32_ansi(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                                 conv_params, pad_value);
+        return;
+    }
+
+    float col0[RGB_MAX_PATCH], col1[RGB_MAX_PATCH];
+    for (int32_t out_y = 0; out_y < out_ht; out_y++) {
+        const int32_t base_y = stride_ht * out_y - pad_ht;
+        int32_t out_x = 0;
+        for (; out_x < out_wd - 1; out_x += 2) {
+            const int32_t base_x = stride_wd * out_x - pad_wd;
+            esp_nn_rgb_patch_f32(input_data, input_wd, input_ht, filter_wd, filter_ht, base_y, base_x,
+                                 pad_value, col0);
+            esp_nn_rgb_patch_f32(input_data, input_wd, input_ht, filter_wd, filter_ht, base_y,
+                                 base_x + stride_wd, pad_value, col1);
+            float *out0 = out_data;
+            float *out1 = out_data + out_channels;
+
+            const float *filter_ptr = filter_data;
+            int32_t out_ch_idx = 0;
+            for (; out_ch_idx < out_channels - 3; out_ch_idx += 4, filter_ptr += 4 * filter_size) {
+                const float *f0 = filter_ptr;
+                const float *f1 = f0 + filter_size;
+                const float *f2 = f1 + filter_size;
+                const float *f3 = f2 + filter_size;
+                float acc00 = 0, acc01 = 0, acc02 = 0, acc03 = 0;
+                float acc10 = 0, acc11 = 0, acc12 = 0, acc13 = 0;
+                for (int32_t i = 0; i < filter_size; i++) {
+                    const float x0 = col0[i], x1 = col1[i];
+                    acc00 += x0 * f0[i];
+                    acc01 += x0 * f1[i];
+                    acc02 += x0 * f2[i];
+                    acc03 += x0 * f3[i];
+                    acc10 += x1 * f0[i];
+                    acc11 += x1 * f1[i];
+                    acc12 += x1 * f2[i];
+                    acc13 += x1 * f3[i];
+                }
+                if (bias) {
+                    acc00 += bias[out_ch_idx];
+                    acc01 += bias[out_ch_idx + 1];
+                    acc02 += bias[out_ch_idx + 2];
+                    acc03 += bias[out_ch_idx + 3];
+                    acc10 += bias[out_ch_idx];
+                    acc11 += bias[out_ch_idx + 1];
+                    acc12 += bias[out_ch_idx + 2];
+                    acc13 += bias[out_ch_idx + 3];
+                }
+                out0[out_ch_idx] = min(max(acc00, activation_min), activation_max);
+                out0[out_ch_idx + 1] = min(max(acc01, activation_min), activation_max);
+                out0[out_ch_idx + 2] = min(max(acc02, activation_min), activation_max);
+                out0[out_ch_idx + 3] = min(max(acc03, activation_min), activation_max);
+                out1[out_ch_idx] = min(max(acc10, activation_min), activation_max);
+                out1[out_ch_idx + 1] = min(max(acc11, activation_min), activation_max);
+                out1[out_ch_idx + 2] = min(max(acc12, activation_min), activation_max);
+                out1[out_ch_idx + 3] = min(max(acc13, activation_min), activation_max);
+            }
+            for (; out_ch_idx < out_channels; out_ch_idx++, filter_ptr += filter_size) {
+                float acc0 = 0, acc1 = 0;
+                for (int32_t i = 0; i < filter_size; i++) {
+                    acc0 += col0[i] * filter_ptr[i];
+                    acc1 += col1[i] * filter_ptr[i];
+                }
+                if (bias) {
+                    acc0 += bias[out_ch_idx];
+                    acc1 += bias[out_ch_idx];
+                }
+                out0[out_ch_idx] = min(max(acc0, activation_min), activation_max);
+                out1[out_ch_idx] = min(max(acc1, activation_min), activation_max);
+            }
+            out_data += 2 * out_channels;
+        }
+        /* odd output width */
+        for (; out_x < out_wd; out_x++, out_data += out_channels) {
+            esp_nn_rgb_patch_f32(input_data, input_wd, input_ht, filter_wd, filter_ht, base_y,
+                                 stride_wd * out_x - pad_wd, pad_value, col0);
+            const float *filter_ptr = filter_data;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++, filter_ptr += filter_size) {
+                float acc = 0;
+                for (int32_t i = 0; i < filter_size; i++) {
+                    acc += col0[i] * filter_ptr[i];
+                }
+                if (bias) {
+                    acc += bias[out_ch_idx];
+                }
+                out_data[out_ch_idx] = min(max(acc, activation_min), activation_max);
+            }
+        }
+    }
+}
@@ -0,0 +1,304 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Winograd F(2x2, 3x3) for int8: a 4x4 input tile gives a 2x2 output tile
+ * with 16 multiplies per input channel instead of 36.
+ *
+ * The filter transform G g G^T has halves in G, it is done with 2 G so it
+ * stays integer and every output comes out 4 times too large, the exact sum
+ * of the direct convolution after the final shift. Ranges, with inputs
+ * offset into [-255, 255]:
+ *   filter tile  |U| <= 9 * 128 = 1152, int16
+ *   input tile   |V| <= 4 * 255 = 1020, int16
+ *   products     summed over at most ESP_NN_WINOGRAD_MAX_CHANNELS channels
+ *                and 9 of them in the output transform stay in int32
+ *
+ * Transformed filters are [out_ch][16][in_ch] so every one of the 16 sums
+ * is a contiguous dot product over the input channels.
+ */
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+
+#include <common_functions.h>
+
+#define WINOGRAD_TILE 16
+
+static int16_t *scratch_buffer = NULL;
+
+int esp_nn_conv_winograd_s8_supported_opt(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const conv_params_t *conv_params,
+                                          const pool_params_t *pool_params)
+{
+    if (filter_dims->width != 3 || filter_dims->height != 3 ||
+        conv_params->stride.width != 1 || conv_params->stride.height != 1 ||
+        conv_params->dilation.width > 1 || conv_params->dilation.height > 1 ||
+        input_dims->channels > ESP_NN_WINOGRAD_MAX_CHANNELS) {
+        return 0;
+    }
+    /* a 2x2 output tile is exactly one window of a 2x2 stride 2 pool */
+    if (pool_params && (pool_params->filter.width != 2 || pool_params->filter.height != 2 ||
+                        pool_params->stride.width != 2 || pool_params->stride.height != 2 ||
+                        pool_params->padding.width != 0 || pool_params->padding.height != 0)) {
+        return 0;
+    }
+    return 1;
+}
+
+int esp_nn_get_conv_winograd_filter_size_opt(const data_dims_t *input_dims,
+                                             const data_dims_t *output_dims)
+{
+    return input_dims->channels * output_dims->channels * WINOGRAD_TILE * sizeof(int16_t);
+}
+
+void esp_nn_conv_winograd_filter_s8_opt(const data_dims_t *input_dims,
+                                        const data_dims_t *output_dims,
+                                        const int8_t *filter_data,
+                                        int16_t *filter_transform)
+{
+    const int32_t in_channels = input_dims->channels;
+    const int32_t out_channels = output_dims->channels;
+
+    for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++) {
+        int16_t *dst = filter_transform + out_ch_idx * WINOGRAD_TILE * in_channels;
+        for (int32_t in_ch_idx = 0; in_ch_idx < in_channels; in_ch_idx++) {
+            const int8_t *g = filter_data + out_ch_idx * 9 * in_channels + in_ch_idx;
+            int32_t t[4][3];
+            /* rows of 2G g, G' = [2 0 0; 1 1 1; 1 -1 1; 0 0 2] */
+            for (int32_t col = 0; col < 3; col++) {
+                const int32_t g0 = g[col * in_channels];
+                const int32_t g1 = g[(3 + col) * in_channels];
+                const int32_t g2 = g[(6 + col) * in_channels];
+                t[0][col] = 2 * g0;
+                t[1][col] = g0 + g1 + g2;
+                t[2][col] = g0 - g1 + g2;
+                t[3][col] = 2 * g2;
+            }
+            /* then (2G g) 2G^T */
+            for (int32_t row = 0; row < 4; row++) {
+                const int32_t a = t[row][0], b = t[row][1], c = t[row][2];
+                dst[(row * 4 + 0) * in_channels + in_ch_idx] = (int16_t) (2 * a);
+                dst[(row * 4 + 1) * in_channels + in_ch_idx] = (int16_t) (a + b + c);
+                dst[(row * 4 + 2) * in_channels + in_ch_idx] = (int16_t) (a - b + c);
+                dst[(row * 4 + 3) * in_channels + in_ch_idx] = (int16_t) (2 * c);
+            }
+        }
+    }
+}
+
+int esp_nn_get_conv_winograd_scratch_size_opt(const data_dims_t *input_dims)
+{
+    return input_dims->channels * WINOGRAD_TILE * sizeof(int16_t);
+}
+
+void esp_nn_set_conv_winograd_scratch_buf_opt(const void *buf)
+{
+    scratch_buffer = (int16_t *) buf;
+}
+
+/* B^T d B of the 4x4 input tile at (base_y, base_x) for every channel, positions outside the input are the
+ * zero padding, which is zero after the input offset */
+static void esp_nn_winograd_input_s8(const int8_t *input_data,
+                                     const uint16_t input_wd,
+                                     const uint16_t input_ht,
+                                     const uint16_t in_channels,
+                                     const int32_t input_offset,
+                                     const int32_t base_y,
+                                     const int32_t base_x,
+                                     int16_t *v)
+{
+    const int8_t *rows[4];
+    int32_t valid_cols = 0;
+    for (int32_t i = 0; i < 4; i++) {
+        const int32_t y = base_y + i;
+        rows[i] = y >= 0 && y < input_ht ? input_data + y * input_wd * in_channels : NULL;
+        const int32_t x = base_x + i;
+        valid_cols |= (x >= 0 && x < input_wd) << i;
+    }
+
+    for (int32_t ch = 0; ch < in_channels; ch++) {
+        int32_t d[4][4];
+        for (int32_t i = 0; i < 4; i++) {
+            for (int32_t j = 0; j < 4; j++) {
+                d[i][j] = rows[i] && (valid_cols >> j & 1) ?
+                          rows[i][(base_x + j) * in_channels + ch] + input_offset : 0;
+            }
+        }
+        /* B^T = [1 0 -1 0; 0 1 1 0; 0 -1 1 0; 0 1 0 -1] down the columns, then along the rows */
+        int32_t t[4][4];
+        for (int32_t j = 0; j < 4; j++) {
+            t[0][j] = d[0][j] - d[2][j];
+            t[1][j] = d[1][j] + d[2][j];
+            t[2][j] = d[2][j] - d[1][j];
+            t[3][j] = d[1][j] - d[3][j];
+        }
+        for (int32_t i = 0; i < 4; i++) {
+            v[(i * 4 + 0) * in_channels + ch] = (int16_t) (t[i][0] - t[i][2]);
+            v[(i * 4 + 1) * in_channels + ch] = (int16_t) (t[i][1] + t[i][2]);
+            v[(i * 4 + 2) * in_channels + ch] = (int16_t) (t[i][2] - t[i][1]);
+            v[(i * 4 + 3) * in_channels + ch] = (int16_t) (t[i][1] - t[i][3]);
+        }
+    }
+}
+
+/* Interior tiles, no padding tests */
+static void esp_nn_winograd_input_inner_s8(const int8_t *input_data,
+                                           const uint16_t input_wd,
+                                           const uint16_t in_channels,
+                                           const int32_t input_offset,
+                                           const int32_t base_y,
+                                           const int32_t base_x,
+                                           int16_t *v)
+{
+    const int32_t row_size = input_wd * in_channels;
+    const int8_t *src = input_data + (base_y * input_wd + base_x) * in_channels;
+    for (int32_t ch = 0; ch < in_channels; ch++, src++) {
+        int32_t t[4][4];
+        for (int32_t j = 0; j < 4; j++) {
+            const int32_t d0 = src[j * in_channels] + input_offset;
+            const int32_t d1 = src[row_size + j * in_channels] + input_offset;
+            const int32_t d2 = src[2 * row_size + j * in_channels] + input_offset;
+            const int32_t d3 = src[3 * row_size + j * in_channels] + input_offset;
+            t[0][j] = d0 - d2;
+            t[1][j] = d1 + d2;
+            t[2][j] = d2 - d1;
+            t[3][j] = d1 - d3;
+        }
+        for (int32_t i = 0; i < 4; i++) {
+            v[(i * 4 + 0) * in_channels + ch] = (int16_t) (t[i][0] - t[i][2]);
+            v[(i * 4 + 1) * in_channels + ch] = (int16_t) (t[i][1] + t[i][2]);
+            v[(i * 4 + 2) * in_channels + ch] = (int16_t) (t[i][2] - t[i][1]);
+            v[(i * 4 + 3) * in_channels + ch] = (int16_t) (t[i][1] - t[i][3]);
+        }
+    }
+}
+
+__NN_FORCE_INLINE__ int32_t esp_nn_winograd_dot_s16(const int16_t *u, const int16_t *v, const int32_t len)
+{
+    int32_t acc0 = 0, acc1 = 0;
+    int32_t i = 0;
+    for (; i < len - 3; i += 4) {
+        acc0 += u[i] * v[i];
+        acc1 += u[i + 1] * v[i + 1];
+        acc0 += u[i + 2] * v[i + 2];
+        acc1 += u[i + 3] * v[i + 3];
+    }
+    for (; i < len; i++) {
+        acc0 += u[i] * v[i];
+    }
+    return acc0 + acc1;
+}
+
+/**
+ * Assumption 1: Pointers are valid
+ * Assumption 2: esp_nn_conv_winograd_s8_supported_opt() holds
+ * Assumption 3: quant_data->mult >= 0, as tflite's QuantizeMultiplier gives
+ */
+void esp_nn_conv_winograd_s8_buf_opt(const data_dims_t *input_dims,
+                                     const int8_t *input_data,
+                                     const int16_t *filter_transform,
+                                     const int32_t *bias,
+                                     const data_dims_t *output_dims,
+                                     int8_t *out_data,
+                                     const conv_params_t *conv_params,
+                                     const pool_params_t *pool_params,
+                                     const quant_data_t *quant_data,
+                                     void *scratch)
+{
+    const uint16_t input_wd = input_dims->width;
+    const uint16_t input_ht = input_dims->height;
+    const uint16_t in_channels = input_dims->channels;
+    const int32_t input_offset = conv_params->in_offset;
+    const int32_t out_offset = conv_params->out_offset;
+    const uint16_t pad_wd = conv_params->padding.width;
+    const uint16_t pad_ht = conv_params->padding.height;
+    const uint16_t out_wd = output_dims->width;
+    const uint16_t out_ht = output_dims->height;
+    const uint16_t out_channels = output_dims->channels;
+    const int32_t activation_min = conv_params->activation.min;
+    const int32_t activation_max = conv_params->activation.max;
+    /* convolution output, the pooled output is half of it */
+    const int32_t conv_wd = pool_params ? 2 * out_wd : out_wd;
+    const int32_t conv_ht = pool_params ? 2 * out_ht : out_ht;
+    const int32_t filter_stride = WINOGRAD_TILE * in_channels;
+    int16_t *v = (int16_t *) scratch;
+
+    for (int32_t tile_y = 0; tile_y < conv_ht; tile_y += 2) {
+        const int32_t base_y = tile_y - pad_ht;
+        const int32_t rows = min(2, conv_ht - tile_y);
+        for (int32_t tile_x = 0; tile_x < conv_wd; tile_x += 2) {
+            const int32_t base_x = tile_x - pad_wd;
+            const int32_t cols = min(2, conv_wd - tile_x);
+            if (base_y >= 0 && base_y + 4 <= input_ht && base_x >= 0 && base_x + 4 <= input_wd) {
+                esp_nn_winograd_input_inner_s8(input_data, input_wd, in_channels, input_offset,
+                                               base_y, base_x, v);
+            } else {
+                esp_nn_winograd_input_s8(input_data, input_wd, input_ht, in_channels, input_offset,
+                                         base_y, base_x, v);
+            }
+
+            const int32_t *out_shift = quant_data->shift;
+            const int32_t *out_mult = quant_data->mult;
+            const int16_t *u = filter_transform;
+            for (int32_t out_ch_idx = 0; out_ch_idx < out_channels; out_ch_idx++, u += filter_stride) {
+                int32_t m[WINOGRAD_TILE];
+                for (int32_t k = 0; k < WINOGRAD_TILE; k++) {
+                    m[k] = esp_nn_winograd_dot_s16(u + k * in_channels, v + k * in_channels, in_channels);
+                }
+                /* A^T M A, A^T = [1 1 1 0; 0 1 -1 -1], then the factor 4 of the filter transform */
+                int32_t t[2][4];
+                for (int32_t j = 0; j < 4; j++) {
+                    t[0][j] = m[j] + m[4 + j] + m[8 + j];
+                    t[1][j] = m[4 + j] - m[8 + j] - m[12 + j];
+                }
+                int32_t y[2][2];
+                for (int32_t i = 0; i < 2; i++) {
+                    y[i][0] = (t[i][0] + t[i][1] + t[i][2]) >> 2;
+                    y[i][1] = (t[i][1] - t[i][2] - t[i][3]) >> 2;
+                }
+                const int32_t b = bias ? bias[out_ch_idx] : 0;
+                const int32_t mult = *out_mult++;
+                const int32_t shift = *out_shift++;
+
+                if (pool_params) {
+                    /* requantization is monotonic, only the largest sum of the window is requantized */
+                    const int32_t acc = max(max(y[0][0], y[0][1]), max(y[1][0], y[1][1])) + b;
+                    int32_t result = esp_nn_multiply_by_quantized_mult_fast(acc, mult, shift) + out_offset;
+                    result = max(result, activation_min);
+                    result = min(result, activation_max);
+                    result = max(result, pool_params->activation.min);
+                    result = min(result, pool_params->activation.max);
+                    out_data[((tile_y / 2) * out_wd + tile_x / 2) * out_channels + out_ch_idx] = (int8_t) result;
+                    continue;
+                }
+                for (int32_t i = 0; i < rows; i++) {
+                    for (int32_t j = 0; j < cols; j++) {
+                        int32_t result = esp_nn_multiply_by_quantized_mult_fast(y[i][j] + b, mult, shift);
+                        result += out_offset;
+                        result = max(result, activation_min);
+                        result = min(result, activation_max);
+                        out_data[((tile_y + i) * out_wd + tile_x + j) * out_channels + out_ch_idx] =
+                            (int8_t) result;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void esp_nn_conv_winograd_s8_opt(const data_dims_t *input_dims,
+                                 const int8_t *input_data,
+                                 const int16_t *filter_transform,
+                                 const int32_t *bias,
+                                 const data_dims_t *output_dims,
+                                 int8_t *out_data,
+                                 const conv_params_t *conv_params,
+                                 const pool_params_t *pool_params,
+                                 const quant_data_t *quant_data)
+{
+    esp_nn_conv_winograd_s8_buf_opt(input_dims, input_data, filter_transform, bias, output_dims, out_data,
+                                    conv_params, pool_params, quant_data, scratch_buffer);
+}
@@ -0,0 +1,30 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+void esp_nn_fully_connected_f32_ansi(const float *input_data,
+                                     const uint16_t row_len,
+                                     const float *filter_data,
+                                     const float *bias,
+                                     float *out_data,
+                                     const uint16_t out_channels,
+                                     const float activation_min,
+                                     const float activation_max)
+{
+    for (int32_t out_c = 0; out_c < out_channels; ++out_c) {
+        float result = 0;
+        for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+            result += filter_data[row_len * out_c + data_idx] * input_data[data_idx];
+        }
+        if (bias) {
+            result += bias[out_c];
+        }
+        result = max(result, activation_min);
+        result = min(result, activation_max);
+        out_data[out_c] = result;
+    }
+}
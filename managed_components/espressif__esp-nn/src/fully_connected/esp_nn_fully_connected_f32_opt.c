@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/* 4 filter rows per pass share every input value loaded */
+void esp_nn_fully_connected_f32_opt(const float *input_data,
+                                    const uint16_t row_len,
+                                    const float *filter_data,
+                                    const float *bias,
+                                    float *out_data,
+                                    const uint16_t out_channels,
+                                    const float activation_min,
+                                    const float activation_max)
+{
+    int32_t out_c = 0;
+    for (; out_c < out_channels - 3; out_c += 4) {
+        const float *f0 = filter_data + row_len * out_c;
+        const float *f1 = f0 + row_len;
+        const float *f2 = f1 + row_len;
+        const float *f3 = f2 + row_len;
+        float acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+        for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+            const float x = input_data[data_idx];
+            acc0 += f0[data_idx] * x;
+            acc1 += f1[data_idx] * x;
+            acc2 += f2[data_idx] * x;
+            acc3 += f3[data_idx] * x;
+        }
+        if (bias) {
+            acc0 += bias[out_c];
+            acc1 += bias[out_c + 1];
+            acc2 += bias[out_c + 2];
+            acc3 += bias[out_c + 3];
+        }
+        out_data[out_c] = min(max(acc0, activation_min), activation_max);
+        out_data[out_c + 1] = min(max(acc1, activation_min), activation_max);
+        out_data[out_c + 2] = min(max(acc2, activation_min), activation_max);
+        out_data[out_c + 3] = min(max(acc3, activation_min), activation_max);
+    }
+    for (; out_c < out_channels; out_c++) {
+        const float *f = filter_data + row_len * out_c;
+        float acc = 0;
+        for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+            acc += f[data_idx] * input_data[data_idx];
+        }
+        if (bias) {
+            acc += bias[out_c];
+        }
+        out_data[out_c] = min(max(acc, activation_min), activation_max);
+    }
+}
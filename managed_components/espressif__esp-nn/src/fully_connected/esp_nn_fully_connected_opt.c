@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+__NN_FORCE_INLINE__ int32_t esp_nn_fc_input_sum(const int8_t *input_data, const uint16_t row_len)
+{
+    int32_t sum = 0;
+    for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+        sum += input_data[data_idx];
+    }
+    return sum;
+}
+
+/**
+ * Raw products only in the inner loop, the offsets come in once per row:
+ * sum((f + fo) * (x + xo)) = sum(f * x) + xo * sum(f) + fo * sum(x) + len * fo * xo
+ * The terms add up modulo 2^32, as the ansi kernel does.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_fc_row_result(int32_t dot, int32_t filter_sum, const int32_t input_offset,
+                                                 const uint32_t input_term)
+{
+    return (int32_t) ((uint32_t) dot + (uint32_t) input_offset * (uint32_t) filter_sum + input_term);
+}
+
+/* Two filter rows per pass share every input word loaded, four values deep */
+__NN_FORCE_INLINE__ void esp_nn_fc_dot2(const int8_t *input_data, const int8_t *f0, const int8_t *f1,
+                                        const uint16_t row_len, int32_t *dot, int32_t *filter_sum)
+{
+    int32_t acc0 = 0, acc1 = 0, sum0 = 0, sum1 = 0;
+    int32_t data_idx = 0;
+    for (; data_idx < row_len - 3; data_idx += 4) {
+        const int32_t x0 = input_data[data_idx];
+        const int32_t x1 = input_data[data_idx + 1];
+        const int32_t x2 = input_data[data_idx + 2];
+        const int32_t x3 = input_data[data_idx + 3];
+        acc0 += f0[data_idx] * x0 + f0[data_idx + 1] * x1 + f0[data_idx + 2] * x2 + f0[data_idx + 3] * x3;
+        acc1 += f1[data_idx] * x0 + f1[data_idx + 1] * x1 + f1[data_idx + 2] * x2 + f1[data_idx + 3] * x3;
+        sum0 += f0[data_idx] + f0[data_idx + 1] + f0[data_idx + 2] + f0[data_idx + 3];
+        sum1 += f1[data_idx] + f1[data_idx + 1] + f1[data_idx + 2] + f1[data_idx + 3];
+    }
+    for (; data_idx < row_len; data_idx++) {
+        const int32_t x = input_data[data_idx];
+        acc0 += f0[data_idx] * x;
+        acc1 += f1[data_idx] * x;
+        sum0 += f0[data_idx];
+        sum1 += f1[data_idx];
+    }
+    dot[0] = acc0;
+    dot[1] = acc1;
+    filter_sum[0] = sum0;
+    filter_sum[1] = sum1;
+}
+
+__NN_FORCE_INLINE__ void esp_nn_fc_dot1(const int8_t *input_data, const int8_t *f, const uint16_t row_len,
+                                        int32_t *dot, int32_t *filter_sum)
+{
+    int32_t acc = 0, sum = 0;
+    for (int32_t data_idx = 0; data_idx < row_len; data_idx++) {
+        acc += f[data_idx] * input_data[data_idx];
+        sum += f[data_idx];
+    }
+    *dot = acc;
+    *filter_sum = sum;
+}
+
+__NN_FORCE_INLINE__ int8_t esp_nn_fc_requant(int32_t result, const int32_t *bias, const int32_t out_c,
+                                             const int32_t out_offset, const int32_t out_shift,
+                                             const int32_t out_mult, const int32_t activation_min,
+                                             const int32_t activation_max)
+{
+    if (bias) {
+        result += bias[out_c];
+    }
+    result = esp_nn_multiply_by_quantized_mult(result, out_mult, out_shift);
+    result += out_offset;
+    result = max(result, activation_min);
+    return (int8_t) min(result, activation_max);
+}
+
+void esp_nn_fully_connected_s8_opt(const int8_t *input_data,
+                                   const int32_t input_offset,
+                                   const uint16_t row_len,
+                                   const int8_t *filter_data,
+                                   const int32_t filter_offset,
+                                   const int32_t *bias,
+                                   int8_t *out_data,
+                                   const uint16_t out_channels,
+                                   const int32_t out_offset,
+                                   const int32_t out_shift,
+                                   const int32_t out_mult,
+                                   const int32_t activation_min,
+                                   const int32_t activation_max)
+{
+    const uint32_t input_term = (uint32_t) filter_offset * (uint32_t) esp_nn_fc_input_sum(input_data, row_len) +
+                                (uint32_t) row_len * (uint32_t) filter_offset * (uint32_t) input_offset;
+    int32_t dot[2], filter_sum[2];
+    int32_t out_c = 0;
+    for (; out_c < out_channels - 1; out_c += 2) {
+        const int8_t *f0 = filter_data + row_len * out_c;
+        esp_nn_fc_dot2(input_data, f0, f0 + row_len, row_len, dot, filter_sum);
+        for (int32_t i = 0; i < 2; i++) {
+            const int32_t result = esp_nn_fc_row_result(dot[i], filter_sum[i], input_offset, input_term);
+            out_data[out_c + i] = esp_nn_fc_requant(result, bias, out_c + i, out_offset, out_shift, out_mult,
+                                                    activation_min, activation_max);
+        }
+    }
+    for (; out_c < out_channels; out_c++) {
+        esp_nn_fc_dot1(input_data, filter_data + row_len * out_c, row_len, dot, filter_sum);
+        const int32_t result = esp_nn_fc_row_result(dot[0], filter_sum[0], input_offset, input_term);
+        out_data[out_c] = esp_nn_fc_requant(result, bias, out_c, out_offset, out_shift, out_mult,
+                                            activation_min, activation_max);
+    }
+}
+
+void esp_nn_fully_connected_per_ch_s8_opt(const int8_t *input_data,
+                                          const int32_t input_offset,
+                                          const uint16_t row_len,
+                                          const int8_t *filter_data,
+                                          const int32_t filter_offset,
+                                          const int32_t *bias,
+                                          int8_t *out_data,
+                                          const uint16_t out_channels,
+                                          const int32_t out_offset,
+                                          const int32_t *out_shift,
+                                          const int32_t *out_mult,
+                                          const int32_t activation_min,
+                                          const int32_t activation_max)
+{
+    const uint32_t input_term = (uint32_t) filter_offset * (uint32_t) esp_nn_fc_input_sum(input_data, row_len) +
+                                (uint32_t) row_len * (uint32_t) filter_offset * (uint32_t) input_offset;
+    int32_t dot[2], filter_sum[2];
+    int32_t out_c = 0;
+    for (; out_c < out_channels - 1; out_c += 2) {
+        const int8_t *f0 = filter_data + row_len * out_c;
+        esp_nn_fc_dot2(input_data, f0, f0 + row_len, row_len, dot, filter_sum);
+        for (int32_t i = 0; i < 2; i++) {
+            const int32_t result = esp_nn_fc_row_result(dot[i], filter_sum[i], input_offset, input_term);
+            out_data[out_c + i] = esp_nn_fc_requant(result, bias, out_c + i, out_offset, out_shift[out_c + i],
+                                                    out_mult[out_c + i], activation_min, activation_max);
+        }
+    }
+    for (; out_c < out_channels; out_c++) {
+        esp_nn_fc_dot1(input_data, filter_data + row_len * out_c, row_len, dot, filter_sum);
+        const int32_t result = esp_nn_fc_row_result(dot[0], filter_sum[0], input_offset, input_term);
+        out_data[out_c] = esp_nn_fc_requant(result, bias, out_c, out_offset, out_shift[out_c], out_mult[out_c],
+                                            activation_min, activation_max);
+    }
+}
@@ -0,0 +1,388 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <esp_nn.h>
+
+#include <common_functions.h>
+
+static const esp_nn_worker_t *worker = NULL;
+
+void esp_nn_set_worker(const esp_nn_worker_t *w)
+{
+    worker = w;
+}
+
+const esp_nn_worker_t *esp_nn_get_worker(void)
+{
+    return worker;
+}
+
+/* Runs the outputs [begin, end) of a kernel, with scratch NULL on the calling core */
+typedef void (*range_fn_t)(const void *args, int32_t begin, int32_t end, void *scratch);
+
+typedef struct {
+    range_fn_t fn;
+    const void *args;
+    int32_t begin;
+    int32_t end;
+    void *scratch;
+} range_job_t;
+
+static void run_range_job(void *arg)
+{
+    const range_job_t *job = (const range_job_t *) arg;
+    job->fn(job->args, job->begin, job->end, job->scratch);
+}
+
+static bool split_worth(int64_t macs)
+{
+    return worker && macs >= worker->min_macs;
+}
+
+/* Outputs [0, split) on the calling core, [split, count) on the worker */
+static void run_split(range_fn_t fn, const void *args, int32_t count, int32_t split)
+{
+    const esp_nn_worker_t *w = worker;
+    range_job_t job = {fn, args, split, count, w->scratch};
+    w->start(run_range_job, &job);
+    fn(args, 0, split, NULL);
+    w->wait();
+}
+
+static int64_t conv_macs(const data_dims_t *input_dims, const data_dims_t *filter_dims,
+                         const data_dims_t *output_dims)
+{
+    return (int64_t) output_dims->width * output_dims->height * output_dims->channels *
+           filter_dims->width * filter_dims->height * input_dims->channels;
+}
+
+/* Arguments of every split convolution, the pointers of the type of its kernel */
+typedef struct {
+    const data_dims_t *input_dims;
+    const void *input_data;
+    const data_dims_t *filter_dims;
+    const void *filter_data;
+    const void *bias;
+    const data_dims_t *conv_dims;
+    const data_dims_t *output_dims;
+    void *out_data;
+    const void *conv_params;
+    const pool_params_t *pool_params;
+    const quant_data_t *quant_data;
+    float pad_value;
+} conv_args_t;
+
+static void conv_s8_rows(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    const conv_params_t *params = (const conv_params_t *) a->conv_params;
+    const esp_nn_input_rows_t r = esp_nn_conv_input_rows(a->input_dims->height, a->filter_dims->height,
+                                                         params->stride.height, params->padding.height,
+                                                         begin, end);
+    data_dims_t input_dims = *a->input_dims;
+    data_dims_t output_dims = *a->output_dims;
+    conv_params_t conv_params = *params;
+    input_dims.height = r.rows;
+    output_dims.height = end - begin;
+    conv_params.padding.height = r.pad;
+    esp_nn_conv_s8(&input_dims, (const int8_t *) a->input_data + r.row * input_dims.width * input_dims.channels,
+                   a->filter_dims, (const int8_t *) a->filter_data, (const int32_t *) a->bias, &output_dims,
+                   (int8_t *) a->out_data + begin * output_dims.width * output_dims.channels,
+                   &conv_params, a->quant_data);
+}
+
+void esp_nn_parallel_conv_s8(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data)
+{
+    const int32_t split = output_dims->height / 2;
+    if (!split_worth(conv_macs(input_dims, filter_dims, output_dims)) || split == 0 ||
+        esp_nn_get_conv_scratch_size(input_dims, filter_dims, output_dims, conv_params) > 0) {
+        esp_nn_conv_s8(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                       conv_params, quant_data);
+        return;
+    }
+    const conv_args_t args = {input_dims, input_data, filter_dims, filter_data, bias, NULL, output_dims,
+                              out_data, conv_params, NULL, quant_data, 0.0f};
+    run_split(conv_s8_rows, &args, output_dims->height, split);
+}
+
+/* Pooled rows [begin, end) read the convolution rows of their windows, which read their input rows */
+static void conv_max_pool_s8_rows(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    const conv_params_t *params = (const conv_params_t *) a->conv_params;
+    const pool_params_t *pool = a->pool_params;
+    const esp_nn_input_rows_t c = esp_nn_conv_input_rows(a->conv_dims->height, pool->filter.height,
+                                                         pool->stride.height, pool->padding.height, begin, end);
+    const esp_nn_input_rows_t r = esp_nn_conv_input_rows(a->input_dims->height, a->filter_dims->height,
+                                                         params->stride.height, params->padding.height,
+                                                         c.row, c.row + c.rows);
+    data_dims_t input_dims = *a->input_dims;
+    data_dims_t conv_dims = *a->conv_dims;
+    data_dims_t output_dims = *a->output_dims;
+    conv_params_t conv_params = *params;
+    pool_params_t pool_params = *pool;
+    input_dims.height = r.rows;
+    conv_dims.height = c.rows;
+    output_dims.height = end - begin;
+    conv_params.padding.height = r.pad;
+    pool_params.padding.height = c.pad;
+    esp_nn_conv_max_pool_s8(&input_dims,
+                            (const int8_t *) a->input_data + r.row * input_dims.width * input_dims.channels,
+                            a->filter_dims, (const int8_t *) a->filter_data, (const int32_t *) a->bias,
+                            &conv_dims, &output_dims,
+                            (int8_t *) a->out_data + begin * output_dims.width * output_dims.channels,
+                            &conv_params, &pool_params, a->quant_data);
+}
+
+void esp_nn_parallel_conv_max_pool_s8(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const data_dims_t *filter_dims,
+                                      const int8_t *filter_data,
+                                      const int32_t *bias,
+                                      const data_dims_t *conv_dims,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const conv_params_t *conv_params,
+                                      const pool_params_t *pool_params,
+                                      const quant_data_t *quant_data)
+{
+    const int32_t split = output_dims->height / 2;
+    if (!split_worth(conv_macs(input_dims, filter_dims, conv_dims)) || split == 0) {
+        esp_nn_conv_max_pool_s8(input_dims, input_data, filter_dims, filter_data, bias, conv_dims, output_dims,
+                                out_data, conv_params, pool_params, quant_data);
+        return;
+    }
+    const conv_args_t args = {input_dims, input_data, filter_dims, filter_data, bias, conv_dims, output_dims,
+                              out_data, conv_params, pool_params, quant_data, 0.0f};
+    run_split(conv_max_pool_s8_rows, &args, output_dims->height, split);
+}
+
+/* A pooled row is two rows of 2x2 tiles, an unpooled split starts on a tile */
+static void conv_winograd_s8_rows(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    const conv_params_t *params = (const conv_params_t *) a->conv_params;
+    const int32_t scale = a->pool_params ? 2 : 1;
+    const esp_nn_input_rows_t r = esp_nn_conv_input_rows(a->input_dims->height, 3, 1, params->padding.height,
+                                                         begin * scale, end * scale);
+    data_dims_t input_dims = *a->input_dims;
+    data_dims_t output_dims = *a->output_dims;
+    conv_params_t conv_params = *params;
+    input_dims.height = r.rows;
+    output_dims.height = end - begin;
+    conv_params.padding.height = r.pad;
+    const int8_t *input_data = (const int8_t *) a->input_data + r.row * input_dims.width * input_dims.channels;
+    int8_t *out_data = (int8_t *) a->out_data + begin * output_dims.width * output_dims.channels;
+    if (scratch) {
+        esp_nn_conv_winograd_s8_buf(&input_dims, input_data, (const int16_t *) a->filter_data,
+                                    (const int32_t *) a->bias, &output_dims, out_data, &conv_params,
+                                    a->pool_params, a->quant_data, scratch);
+    } else {
+        esp_nn_conv_winograd_s8(&input_dims, input_data, (const int16_t *) a->filter_data,
+                                (const int32_t *) a->bias, &output_dims, out_data, &conv_params,
+                                a->pool_params, a->quant_data);
+    }
+}
+
+void esp_nn_parallel_conv_winograd_s8(const data_dims_t *input_dims,
+                                      const int8_t *input_data,
+                                      const int16_t *filter_transform,
+                                      const int32_t *bias,
+                                      const data_dims_t *output_dims,
+                                      int8_t *out_data,
+                                      const conv_params_t *conv_params,
+                                      const pool_params_t *pool_params,
+                                      const quant_data_t *quant_data)
+{
+    const int32_t scale = pool_params ? 2 : 1;
+    const int64_t macs = (int64_t) output_dims->width * output_dims->height * scale * scale *
+                         output_dims->channels * 9 * input_dims->channels;
+    const int32_t split = pool_params ? output_dims->height / 2 : output_dims->height / 4 * 2;
+    if (!split_worth(macs) || split == 0 ||
+        worker->scratch_size < esp_nn_get_conv_winograd_scratch_size(input_dims)) {
+        esp_nn_conv_winograd_s8(input_dims, input_data, filter_transform, bias, output_dims, out_data,
+                                conv_params, pool_params, quant_data);
+        return;
+    }
+    const conv_args_t args = {input_dims, input_data, NULL, filter_transform, bias, NULL, output_dims,
+                              out_data, conv_params, pool_params, quant_data, 0.0f};
+    run_split(conv_winograd_s8_rows, &args, output_dims->height, split);
+}
+
+/* Float convolution of output rows [begin, end): its input rows, dims and parameters */
+static esp_nn_input_rows_t conv_f32_sub(const conv_args_t *a, int32_t begin, int32_t end,
+                                        data_dims_t *input_dims, data_dims_t *output_dims,
+                                        conv_f32_params_t *conv_params)
+{
+    const conv_f32_params_t *params = (const conv_f32_params_t *) a->conv_params;
+    const esp_nn_input_rows_t r = esp_nn_conv_input_rows(a->input_dims->height, a->filter_dims->height,
+                                                         params->stride.height, params->padding.height,
+                                                         begin, end);
+    *input_dims = *a->input_dims;
+    *output_dims = *a->output_dims;
+    *conv_params = *params;
+    input_dims->height = r.rows;
+    output_dims->height = end - begin;
+    conv_params->padding.height = r.pad;
+    return r;
+}
+
+static void conv_f32_rows(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    data_dims_t input_dims, output_dims;
+    conv_f32_params_t conv_params;
+    const esp_nn_input_rows_t r = conv_f32_sub(a, begin, end, &input_dims, &output_dims, &conv_params);
+    esp_nn_conv_f32(&input_dims, (const float *) a->input_data + r.row * input_dims.width * input_dims.channels,
+                    a->filter_dims, (const float *) a->filter_data, (const float *) a->bias, &output_dims,
+                    (float *) a->out_data + begin * output_dims.width * output_dims.channels, &conv_params);
+}
+
+static void conv_rgb_f32_rows(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    data_dims_t input_dims, output_dims;
+    conv_f32_params_t conv_params;
+    const esp_nn_input_rows_t r = conv_f32_sub(a, begin, end, &input_dims, &output_dims, &conv_params);
+    esp_nn_conv_rgb_f32(&input_dims,
+                        (const uint8_t *) a->input_data + r.row * input_dims.width * input_dims.channels,
+                        a->filter_dims, (const float *) a->filter_data, (const float *) a->bias, &output_dims,
+                        (float *) a->out_data + begin * output_dims.width * output_dims.channels, &conv_params,
+                        a->pad_value);
+}
+
+void esp_nn_parallel_conv_f32(const data_dims_t *input_dims,
+                              const float *input_data,
+                              const data_dims_t *filter_dims,
+                              const float *filter_data,
+                              const float *bias,
+                              const data_dims_t *output_dims,
+                              float *out_data,
+                              const conv_f32_params_t *conv_params)
+{
+    const int32_t split = output_dims->height / 2;
+    if (!split_worth(conv_macs(input_dims, filter_dims, output_dims)) || split == 0) {
+        esp_nn_conv_f32(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                        conv_params);
+        return;
+    }
+    const conv_args_t args = {input_dims, input_data, filter_dims, filter_data, bias, NULL, output_dims,
+                              out_data, conv_params, NULL, NULL, 0.0f};
+    run_split(conv_f32_rows, &args, output_dims->height, split);
+}
+
+void esp_nn_parallel_conv_rgb_f32(const data_dims_t *input_dims,
+                                  const uint8_t *input_data,
+                                  const data_dims_t *filter_dims,
+                                  const float *filter_data,
+                                  const float *bias,
+                                  const data_dims_t *output_dims,
+                                  float *out_data,
+                                  const conv_f32_params_t *conv_params,
+                                  const float pad_value)
+{
+    const int32_t split = output_dims->height / 2;
+    if (!split_worth(conv_macs(input_dims, filter_dims, output_dims)) || split == 0) {
+        esp_nn_conv_rgb_f32(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                            conv_params, pad_value);
+        return;
+    }
+    const conv_args_t args = {input_dims, input_data, filter_dims, filter_data, bias, NULL, output_dims,
+                              out_data, conv_params, NULL, NULL, pad_value};
+    run_split(conv_rgb_f32_rows, &args, output_dims->height, split);
+}
+
+typedef struct {
+    const void *input_data;
+    int32_t input_offset;
+    uint16_t row_len;
+    const void *filter_data;
+    int32_t filter_offset;
+    const void *bias;
+    void *out_data;
+    int32_t out_offset;
+    int32_t out_shift;
+    int32_t out_mult;
+    int32_t activation_min;
+    int32_t activation_max;
+    float activation_min_f32;
+    float activation_max_f32;
+} fc_args_t;
+
+static void fully_connected_s8_channels(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const fc_args_t *a = (const fc_args_t *) args;
+    const int32_t *bias = (const int32_t *) a->bias;
+    esp_nn_fully_connected_s8((const int8_t *) a->input_data, a->input_offset, a->row_len,
+                              (const int8_t *) a->filter_data + begin * a->row_len, a->filter_offset,
+                              bias ? bias + begin : NULL, (int8_t *) a->out_data + begin, end - begin,
+                              a->out_offset, a->out_shift, a->out_mult, a->activation_min, a->activation_max);
+}
+
+void esp_nn_parallel_fully_connected_s8(const int8_t *input_data,
+                                        const int32_t input_offset,
+                                        const uint16_t row_len,
+                                        const int8_t *filter_data,
+                                        const int32_t filter_offset,
+                                        const int32_t *bias,
+                                        int8_t *out_data,
+                                        const uint16_t out_channels,
+                                        const int32_t out_offset,
+                                        const int32_t out_shift,
+                                        const int32_t out_mult,
+                                        const int32_t activation_min,
+                                        const int32_t activation_max)
+{
+    const int32_t split = out_channels / 2;
+    if (!split_worth((int64_t) row_len * out_channels) || split == 0) {
+        esp_nn_fully_connected_s8(input_data, input_offset, row_len, filter_data, filter_offset, bias,
+                                  out_data, out_channels, out_offset, out_shift, out_mult,
+                                  activation_min, activation_max);
+        return;
+    }
+    const fc_args_t args = {input_data, input_offset, row_len, filter_data, filter_offset, bias, out_data,
+                            out_offset, out_shift, out_mult, activation_min, activation_max, 0.0f, 0.0f};
+    run_split(fully_connected_s8_channels, &args, out_channels, split);
+}
+
+static void fully_connected_f32_channels(const void *args, int32_t begin, int32_t end, void *scratch)
+{
+    const fc_args_t *a = (const fc_args_t *) args;
+    const float *bias = (const float *) a->bias;
+    esp_nn_fully_connected_f32((const float *) a->input_data, a->row_len,
+                               (const float *) a->filter_data + begin * a->row_len, bias ? bias + begin : NULL,
+                               (float *) a->out_data + begin, end - begin,
+                               a->activation_min_f32, a->activation_max_f32);
+}
+
+void esp_nn_parallel_fully_connected_f32(const float *input_data,
+                                         const uint16_t row_len,
+                                         const float *filter_data,
+                                         const float *bias,
+                                         float *out_data,
+                                         const uint16_t out_channels,
+                                         const float activation_min,
+                                         const float activation_max)
+{
+    const int32_t split = out_channels / 2;
+    if (!split_worth((int64_t) row_len * out_channels) || split == 0) {
+        esp_nn_fully_connected_f32(input_data, row_len, filter_data, bias, out_data, out_channels,
+                                   activation_min, activation_max);
+        return;
+    }
+    const fc_args_t args = {input_data, 0, row_len, filter_data, 0, bias, out_data, 0, 0, 0, 0, 0,
+                            activation_min, activation_max};
+    run_split(fully_connected_f32_channels, &args, out_channels, split);
+}
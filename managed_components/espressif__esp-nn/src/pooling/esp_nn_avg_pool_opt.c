@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/* Positions a window may hold for the 16 bit lane sums of biased bytes, 257 * 255 < 65536 */
+#define AVG_POOL_LANE_MAX_COUNT 257
+
+__NN_FORCE_INLINE__ int8_t esp_nn_avg_pool_result(int32_t sum, const int32_t count,
+                                                  const int32_t activation_min,
+                                                  const int32_t activation_max)
+{
+    /* Rounded average */
+    int32_t result = sum > 0 ? (sum + count / 2) / count : (sum - count / 2) / count;
+    result = max(result, activation_min);
+    return (int8_t) min(result, activation_max);
+}
+
+/**
+ * Four channels per word: the bytes are biased to uint8 and summed in two
+ * words of two 16 bit lanes, even and odd channels, with the bias taken
+ * back out of the sums once per window.
+ */
+void esp_nn_avg_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels)
+{
+    const int32_t row_size = input_wd * channels;
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        const int32_t filter_y_start = max(0, -base_y);
+        const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+            /* Make sure filter does not cross the input box */
+            const int32_t filter_x_start = max(0, -base_x);
+            const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+            const int32_t window_wd = filter_x_end - filter_x_start;
+            const int32_t count = (filter_y_end - filter_y_start) * window_wd;
+            const int32_t bias = 128 * count;
+            const int8_t *window = input + ((base_y + filter_y_start) * input_wd + base_x + filter_x_start) *
+                                   channels;
+            int8_t *out = output + (out_y * output_wd + out_x) * channels;
+
+            int32_t ch_idx = 0;
+            if (count <= AVG_POOL_LANE_MAX_COUNT) {
+                for (; ch_idx < channels - 3; ch_idx += 4) {
+                    uint32_t even = 0, odd = 0;
+                    const int8_t *row = window + ch_idx;
+                    for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++, row += row_size) {
+                        for (int32_t filter_x = 0; filter_x < window_wd; filter_x++) {
+                            const uint32_t w = esp_nn_swar_load(row + filter_x * channels) ^ ESP_NN_SWAR_HIGH;
+                            even += w & ESP_NN_SWAR_EVEN;
+                            odd += (w >> 8) & ESP_NN_SWAR_EVEN;
+                        }
+                    }
+                    out[ch_idx] = esp_nn_avg_pool_result((int32_t) (even & 0xffff) - bias, count,
+                                                         activation_min, activation_max);
+                    out[ch_idx + 1] = esp_nn_avg_pool_result((int32_t) (odd & 0xffff) - bias, count,
+                                                             activation_min, activation_max);
+                    out[ch_idx + 2] = esp_nn_avg_pool_result((int32_t) (even >> 16) - bias, count,
+                                                             activation_min, activation_max);
+                    out[ch_idx + 3] = esp_nn_avg_pool_result((int32_t) (odd >> 16) - bias, count,
+                                                             activation_min, activation_max);
+                }
+            }
+            for (; ch_idx < channels; ch_idx++) {
+                int32_t sum = 0;
+                const int8_t *row = window + ch_idx;
+                for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++, row += row_size) {
+                    for (int32_t filter_x = 0; filter_x < window_wd; filter_x++) {
+                        sum += row[filter_x * channels];
+                    }
+                }
+                out[ch_idx] = esp_nn_avg_pool_result(sum, count, activation_min, activation_max);
+            }
+        }
+    }
+}
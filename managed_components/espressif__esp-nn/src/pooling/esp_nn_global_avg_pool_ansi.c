@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+
+#include <common_functions.h>
+
+/* Rounded division of the rescaled sum, as the integer Mean of TFLite Micro */
+static int32_t mean_of_sum(int32_t sum, const int32_t size, const int32_t output_offset,
+                           const int32_t out_mult, const int32_t out_shift)
+{
+    int32_t result = esp_nn_multiply_by_quantized_mult(sum, out_mult, out_shift);
+    result = result > 0 ? (result + size / 2) / size : (result - size / 2) / size;
+    result += output_offset;
+    return max(-128, min(result, 127));
+}
+
+void esp_nn_global_avg_pool_s8_ansi(const int8_t *input,
+                                    const uint16_t input_wd,
+                                    const uint16_t input_ht,
+                                    const uint16_t channels,
+                                    const int32_t input_offset,
+                                    const int32_t output_offset,
+                                    const int32_t out_mult,
+                                    const int32_t out_shift,
+                                    int8_t *output)
+{
+    const int32_t size = input_wd * input_ht;
+    for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+        int32_t sum = 0;
+        for (int32_t i = 0; i < size; i++) {
+            sum += input[i * channels + ch_idx] + input_offset;
+        }
+        output[ch_idx] = (int8_t) mean_of_sum(sum, size, output_offset, out_mult, out_shift);
+    }
+}
+
+void esp_nn_global_avg_pool_fc_s8_ansi(const int8_t *input,
+                                       const uint16_t input_wd,
+                                       const uint16_t input_ht,
+                                       const uint16_t channels,
+                                       const int32_t input_offset,
+                                       const int32_t pool_offset,
+                                       const int32_t pool_mult,
+                                       const int32_t pool_shift,
+                                       const int8_t *filter_data,
+                                       const int32_t filter_offset,
+                                       const int32_t *bias,
+                                       int8_t *out_data,
+                                       const uint16_t out_channels,
+                                       const int32_t out_offset,
+                                       const int32_t out_shift,
+                                       const int32_t out_mult,
+                                       const int32_t activation_min,
+                                       const int32_t activation_max)
+{
+    int8_t pooled[ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS];
+    esp_nn_global_avg_pool_s8_ansi(input, input_wd, input_ht, channels, input_offset,
+                                   pool_offset, pool_mult, pool_shift, pooled);
+    esp_nn_fully_connected_s8_ansi(pooled, -pool_offset, channels, filter_data, filter_offset, bias,
+                                   out_data, out_channels, out_offset, out_shift, out_mult,
+                                   activation_min, activation_max);
+}
+
+void esp_nn_global_avg_pool_fc_f32_ansi(const float *input,
+                                        const uint16_t input_wd,
+                                        const uint16_t input_ht,
+                                        const uint16_t channels,
+                                        const float *filter_data,
+                                        const float *bias,
+                                        float *out_data,
+                                        const uint16_t out_channels,
+                                        const float activation_min,
+                                        const float activation_max)
+{
+    float pooled[ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS];
+    esp_nn_global_avg_pool_f32_ansi(input, input_wd, input_ht, channels, pooled);
+    esp_nn_fully_connected_f32_ansi(pooled, channels, filter_data, bias, out_data, out_channels,
+                                    activation_min, activation_max);
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <esp_nn_defs.h>
+#include <esp_nn_ansi_headers.h>
+
+#include <common_functions.h>
+
+/* Channels summed per pass over the positions, their sums stay in registers or on the stack */
+#define CHANNEL_BLOCK 32
+
+/**
+ * Channel rows are contiguous, so a block of channels is summed position by
+ * position with unit stride loads. The input offset is added once per
+ * channel as size * input_offset instead of at every element.
+ */
+void esp_nn_global_avg_pool_s8_opt(const int8_t *input,
+                                   const uint16_t input_wd,
+                                   const uint16_t input_ht,
+                                   const uint16_t channels,
+                                   const int32_t input_offset,
+                                   const int32_t output_offset,
+                                   const int32_t out_mult,
+                                   const int32_t out_shift,
+                                   int8_t *output)
+{
+    const int32_t size = input_wd * input_ht;
+    int32_t sum[CHANNEL_BLOCK];
+    for (int32_t ch_base = 0; ch_base < channels; ch_base += CHANNEL_BLOCK) {
+        const int32_t block = min(CHANNEL_BLOCK, channels - ch_base);
+        for (int32_t ch_idx = 0; ch_idx < block; ch_idx++) {
+            sum[ch_idx] = 0;
+        }
+        const int8_t *row = input + ch_base;
+        int32_t i = 0;
+        for (; i < size - 3; i += 4, row += 4 * channels) {
+            const int8_t *row1 = row + channels;
+            const int8_t *row2 = row1 + channels;
+            const int8_t *row3 = row2 + channels;
+            for (int32_t ch_idx = 0; ch_idx < block; ch_idx++) {
+                sum[ch_idx] += row[ch_idx] + row1[ch_idx] + row2[ch_idx] + row3[ch_idx];
+            }
+        }
+        for (; i < size; i++, row += channels) {
+            for (int32_t ch_idx = 0; ch_idx < block; ch_idx++) {
+                sum[ch_idx] += row[ch_idx];
+            }
+        }
+        for (int32_t ch_idx = 0; ch_idx < block; ch_idx++) {
+            int32_t result = esp_nn_multiply_by_quantized_mult(sum[ch_idx] + size * input_offset,
+                                                               out_mult, out_shift);
+            result = result > 0 ? (result + size / 2) / size : (result - size / 2) / size;
+            result += output_offset;
+            output[ch_base + ch_idx] = (int8_t) max(-128, min(result, 127));
+        }
+    }
+}
+
+/* The pooled row never leaves the stack, the classifier reads it right away */
+void esp_nn_global_avg_pool_fc_s8_opt(const int8_t *input,
+                                      const uint16_t input_wd,
+                                      const uint16_t input_ht,
+                                      const uint16_t channels,
+                                      const int32_t input_offset,
+                                      const int32_t pool_offset,
+                                      const int32_t pool_mult,
+                                      const int32_t pool_shift,
+                                      const int8_t *filter_data,
+                                      const int32_t filter_offset,
+                                      const int32_t *bias,
+                                      int8_t *out_data,
+                                      const uint16_t out_channels,
+                                      const int32_t out_offset,
+                                      const int32_t out_shift,
+                                      const int32_t out_mult,
+                                      const int32_t activation_min,
+                                      const int32_t activation_max)
+{
+    int8_t pooled[ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS];
+    esp_nn_global_avg_pool_s8_opt(input, input_wd, input_ht, channels, input_offset,
+                                  pool_offset, pool_mult, pool_shift, pooled);
+    esp_nn_fully_connected_s8_opt(pooled, -pool_offset, channels, filter_data, filter_offset, bias,
+                                  out_data, out_channels, out_offset, out_shift, out_mult,
+                                  activation_min, activation_max);
+}
+
+void esp_nn_global_avg_pool_fc_f32_opt(const float *input,
+                                       const uint16_t input_wd,
+                                       const uint16_t input_ht,
+                                       const uint16_t channels,
+                                       const float *filter_data,
+                                       const float *bias,
+                                       float *out_data,
+                                       const uint16_t out_channels,
+                                       const float activation_min,
+                                       const float activation_max)
+{
+    float pooled[ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS];
+    esp_nn_global_avg_pool_f32_opt(input, input_wd, input_ht, channels, pooled);
+    esp_nn_fully_connected_f32_opt(pooled, channels, filter_data, bias, out_data, out_channels,
+                                   activation_min, activation_max);
+}
@@ -0,0 +1,71 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/**
+ * Four channels per word: the window is reduced with a packed max, then
+ * clamped to the activation range, lane by lane.
+ */
+void esp_nn_max_pool_s8_opt(const int8_t *input,
+                            const uint16_t input_wd,
+                            const uint16_t input_ht,
+                            int8_t *output,
+                            const uint16_t output_wd,
+                            const uint16_t output_ht,
+                            const uint16_t stride_wd,
+                            const uint16_t stride_ht,
+                            const uint16_t filter_wd,
+                            const uint16_t filter_ht,
+                            const uint16_t pad_wd,
+                            const uint16_t pad_ht,
+                            const int32_t activation_min,
+                            const int32_t activation_max,
+                            const uint16_t channels)
+{
+    const uint32_t act_min = ESP_NN_SWAR_SPLAT(activation_min);
+    const uint32_t act_max = ESP_NN_SWAR_SPLAT(activation_max);
+    const int32_t row_size = input_wd * channels;
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        const int32_t filter_y_start = max(0, -base_y);
+        const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+            /* Make sure filter does not cross the input box */
+            const int32_t filter_x_start = max(0, -base_x);
+            const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+            const int32_t window_wd = filter_x_end - filter_x_start;
+            const int8_t *window = input + ((base_y + filter_y_start) * input_wd + base_x + filter_x_start) *
+                                   channels;
+            int8_t *out = output + (out_y * output_wd + out_x) * channels;
+
+            int32_t ch_idx = 0;
+            for (; ch_idx < channels - 3; ch_idx += 4) {
+                uint32_t result = ESP_NN_SWAR_SPLAT(INT8_MIN);
+                const int8_t *row = window + ch_idx;
+                for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++, row += row_size) {
+                    for (int32_t filter_x = 0; filter_x < window_wd; filter_x++) {
+                        result = esp_nn_swar_max_s8(result, esp_nn_swar_load(row + filter_x * channels));
+                    }
+                }
+                result = esp_nn_swar_min_s8(esp_nn_swar_max_s8(result, act_min), act_max);
+                esp_nn_swar_store(out + ch_idx, result);
+            }
+            for (; ch_idx < channels; ch_idx++) {
+                int32_t result = INT8_MIN;
+                const int8_t *row = window + ch_idx;
+                for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++, row += row_size) {
+                    for (int32_t filter_x = 0; filter_x < window_wd; filter_x++) {
+                        result = max(result, row[filter_x * channels]);
+                    }
+                }
+                result = max(result, activation_min);
+                out[ch_idx] = (int8_t) min(result, activation_max);
+            }
+        }
+    }
+}
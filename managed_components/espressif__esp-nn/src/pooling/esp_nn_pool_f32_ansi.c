@@ -0,0 +1,73 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <float.h>
+#include <stdint.h>
+
+#include <common_functions.h>
+
+void esp_nn_max_pool_f32_ansi(const float *input,
+                              const uint16_t input_wd,
+                              const uint16_t input_ht,
+                              float *output,
+                              const uint16_t output_wd,
+                              const uint16_t output_ht,
+                              const uint16_t stride_wd,
+                              const uint16_t stride_ht,
+                              const uint16_t filter_wd,
+                              const uint16_t filter_ht,
+                              const uint16_t pad_wd,
+                              const uint16_t pad_ht,
+                              const float activation_min,
+                              const float activation_max,
+                              const uint16_t channels)
+{
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd) {
+            /* Make sure filter does not cross the input box */
+            int32_t filter_y_start = max(0, -base_y);
+            int32_t filter_x_start = max(0, -base_x);
+            int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+            int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+
+            for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                float result = -FLT_MAX;
+
+                for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++) {
+                    for (int32_t filter_x = filter_x_start; filter_x < filter_x_end; filter_x++) {
+                        int32_t in_x_idx = base_x + filter_x;
+                        int32_t in_y_idx = base_y + filter_y;
+                        int32_t input_index = (in_y_idx * input_wd + in_x_idx) * channels + ch_idx;
+                        result = max(input[input_index], result);
+                    }
+                }
+
+                /* Activation function */
+                result = max(result, activation_min);
+                result = min(result, activation_max);
+
+                int32_t output_index = (out_y * output_wd + out_x) * channels + ch_idx;
+                output[output_index] = result;
+            }
+        }
+    }
+}
+
+void esp_nn_global_avg_pool_f32_ansi(const float *input,
+                                     const uint16_t input_wd,
+                                     const uint16_t input_ht,
+                                     const uint16_t channels,
+                                     float *output)
+{
+    const int32_t size = input_wd * input_ht;
+    for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+        float sum = 0;
+        for (int32_t i = 0; i < size; i++) {
+            sum += input[i * channels + ch_idx];
+        }
+        output[ch_idx] = sum / size;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <float.h>
+#include <stdint.h>
+
+#include <common_functions.h>
+
+/* Channels are the inner loop: every pass reads and writes contiguous rows of channels */
+void esp_nn_max_pool_f32_opt(const float *input,
+                             const uint16_t input_wd,
+                             const uint16_t input_ht,
+                             float *output,
+                             const uint16_t output_wd,
+                             const uint16_t output_ht,
+                             const uint16_t stride_wd,
+                             const uint16_t stride_ht,
+                             const uint16_t filter_wd,
+                             const uint16_t filter_ht,
+                             const uint16_t pad_wd,
+                             const uint16_t pad_ht,
+                             const float activation_min,
+                             const float activation_max,
+                             const uint16_t channels)
+{
+    int32_t base_y = -pad_ht;
+    for (int32_t out_y = 0; out_y < output_ht; out_y++, base_y += stride_ht) {
+        const int32_t filter_y_start = max(0, -base_y);
+        const int32_t filter_y_end = min(filter_ht, input_ht - base_y);
+        int32_t base_x = -pad_wd;
+        for (int32_t out_x = 0; out_x < output_wd; out_x++, base_x += stride_wd, output += channels) {
+            const int32_t filter_x_start = max(0, -base_x);
+            const int32_t filter_x_end = min(filter_wd, input_wd - base_x);
+            if (filter_y_start >= filter_y_end || filter_x_start >= filter_x_end) {
+                const float empty = min(max(-FLT_MAX, activation_min), activation_max);
+                for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                    output[ch_idx] = empty;
+                }
+                continue;
+            }
+
+            const float *first = input + ((base_y + filter_y_start) * input_wd + base_x + filter_x_start) * channels;
+            for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                output[ch_idx] = first[ch_idx];
+            }
+            for (int32_t filter_y = filter_y_start; filter_y < filter_y_end; filter_y++) {
+                const float *row = input + ((base_y + filter_y) * input_wd + base_x) * channels;
+                for (int32_t filter_x = filter_x_start; filter_x < filter_x_end; filter_x++) {
+                    const float *in = row + filter_x * channels;
+                    for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                        output[ch_idx] = max(in[ch_idx], output[ch_idx]);
+                    }
+                }
+            }
+            for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+                output[ch_idx] = min(max(output[ch_idx], activation_min), activation_max);
+            }
+        }
+    }
+}
+
+void esp_nn_global_avg_pool_f32_opt(const float *input,
+                                    const uint16_t input_wd,
+                                    const uint16_t input_ht,
+                                    const uint16_t channels,
+                                    float *output)
+{
+    const int32_t size = input_wd * input_ht;
+    for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+        output[ch_idx] = 0;
+    }
+    for (int32_t i = 0; i < size; i++, input += channels) {
+        for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+            output[ch_idx] += input[ch_idx];
+        }
+    }
+    const float scale = 1.0f / size;
+    for (int32_t ch_idx = 0; ch_idx < channels; ch_idx++) {
+        output[ch_idx] *= scale;
+    }
+}
@@ -0,0 +1,227 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <esp_nn.h>
+
+#include <common_functions.h>
+
+#define TILE_ALIGN 16
+
+static void *tile_buf = NULL;
+static int32_t tile_buf_size = 0;
+
+void esp_nn_set_tile_buf(void *buf, int32_t size)
+{
+    tile_buf = buf;
+    tile_buf_size = buf ? size : 0;
+}
+
+static int32_t tile_align(int32_t size)
+{
+    return (size + TILE_ALIGN - 1) & ~(TILE_ALIGN - 1);
+}
+
+/* Computes the output rows [begin, end) to out from their input rows r staged at input */
+typedef void (*band_fn_t)(const void *args, const void *input, const esp_nn_input_rows_t *r, const void *filter,
+                          int32_t begin, int32_t end, void *out);
+
+/* A convolution as rows of bytes, whatever its element type */
+typedef struct {
+    band_fn_t fn;
+    const void *args;
+    const int8_t *input;
+    const int8_t *filter;
+    int8_t *out;
+    int32_t input_ht;
+    int32_t output_ht;
+    int32_t filter_ht;
+    int32_t stride;
+    int32_t pad;
+    int32_t input_row_size;
+    int32_t output_row_size;
+    int32_t filter_size;
+} tiled_conv_t;
+
+typedef struct {
+    void *dst;
+    const void *src;
+    int32_t size;
+} copy_job_t;
+
+static void run_copy_job(void *arg)
+{
+    const copy_job_t *job = (const copy_job_t *) arg;
+    memcpy(job->dst, job->src, job->size);
+}
+
+/* Most output rows per band with their input rows in each of slots and their output in size bytes */
+static int32_t band_rows(const tiled_conv_t *c, int32_t size, int32_t slots)
+{
+    int32_t rows = 0;
+    while (rows < c->output_ht) {
+        const int32_t input_rows = min(rows * c->stride + c->filter_ht, c->input_ht);
+        const int32_t needed = slots * tile_align(input_rows * c->input_row_size) +
+                               tile_align((rows + 1) * c->output_row_size);
+        if (needed > size) {
+            break;
+        }
+        rows++;
+    }
+    return rows;
+}
+
+static esp_nn_input_rows_t band_input_rows(const tiled_conv_t *c, int32_t begin, int32_t end)
+{
+    return esp_nn_conv_input_rows(c->input_ht, c->filter_ht, c->stride, c->pad, begin, end);
+}
+
+/* Runs the convolution band by band in the tile buffer, false when one output row does not fit */
+static bool run_tiled(const tiled_conv_t *c)
+{
+    int8_t *buf = (int8_t *) tile_buf;
+    int32_t size = tile_buf_size;
+    const int8_t *filter = c->filter;
+    if (buf == NULL) {
+        return false;
+    }
+    if (c->filter_size <= size / 2 && band_rows(c, size - tile_align(c->filter_size), 1) > 0) {
+        memcpy(buf, c->filter, c->filter_size);
+        filter = buf;
+        buf += tile_align(c->filter_size);
+        size -= tile_align(c->filter_size);
+    }
+
+    /* two input slots when a worker fills the next one meanwhile */
+    const esp_nn_worker_t *worker = esp_nn_get_worker();
+    int32_t slots = 1;
+    int32_t rows = band_rows(c, size, 1);
+    if (worker && rows < c->output_ht && band_rows(c, size, 2) > 0) {
+        slots = 2;
+        rows = band_rows(c, size, 2);
+    }
+    if (rows == 0) {
+        return false;
+    }
+    const int32_t slot_size = tile_align(min((rows - 1) * c->stride + c->filter_ht, c->input_ht) *
+                                              c->input_row_size);
+    int8_t *slot[2] = {buf, buf + slot_size};
+    int8_t *out_band = buf + slots * slot_size;
+
+    esp_nn_input_rows_t r = band_input_rows(c, 0, min(rows, c->output_ht));
+    memcpy(slot[0], c->input + r.row * c->input_row_size, r.rows * c->input_row_size);
+    for (int32_t begin = 0, band = 0; begin < c->output_ht; band++) {
+        const int32_t end = min(begin + rows, c->output_ht);
+        const esp_nn_input_rows_t current = r;
+        int8_t *input = slot[band % slots];
+        copy_job_t job;
+        if (end < c->output_ht) {
+            r = band_input_rows(c, end, min(end + rows, c->output_ht));
+            job.dst = slot[(band + 1) % slots];
+            job.src = c->input + r.row * c->input_row_size;
+            job.size = r.rows * c->input_row_size;
+            if (slots == 2) {
+                worker->start(run_copy_job, &job);
+            }
+        }
+        c->fn(c->args, input, &current, filter, begin, end, out_band);
+        memcpy(c->out + begin * c->output_row_size, out_band, (end - begin) * c->output_row_size);
+        if (end < c->output_ht) {
+            if (slots == 2) {
+                worker->wait();
+            } else {
+                run_copy_job(&job);
+            }
+        }
+        begin = end;
+    }
+    return true;
+}
+
+typedef struct {
+    const data_dims_t *input_dims;
+    const data_dims_t *filter_dims;
+    const void *bias;
+    const data_dims_t *output_dims;
+    const void *conv_params;
+    const quant_data_t *quant_data;
+} conv_args_t;
+
+static void conv_s8_band(const void *args, const void *input, const esp_nn_input_rows_t *r, const void *filter,
+                         int32_t begin, int32_t end, void *out)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    data_dims_t input_dims = *a->input_dims;
+    data_dims_t output_dims = *a->output_dims;
+    conv_params_t conv_params = *(const conv_params_t *) a->conv_params;
+    input_dims.height = r->rows;
+    output_dims.height = end - begin;
+    conv_params.padding.height = r->pad;
+    esp_nn_conv_s8(&input_dims, (const int8_t *) input, a->filter_dims, (const int8_t *) filter,
+                   (const int32_t *) a->bias, &output_dims, (int8_t *) out, &conv_params, a->quant_data);
+}
+
+void esp_nn_tiled_conv_s8(const data_dims_t *input_dims,
+                          const int8_t *input_data,
+                          const data_dims_t *filter_dims,
+                          const int8_t *filter_data,
+                          const int32_t *bias,
+                          const data_dims_t *output_dims,
+                          int8_t *out_data,
+                          const conv_params_t *conv_params,
+                          const quant_data_t *quant_data)
+{
+    const conv_args_t args = {input_dims, filter_dims, bias, output_dims, conv_params, quant_data};
+    const tiled_conv_t c = {conv_s8_band, &args, input_data, filter_data, out_data,
+                            input_dims->height, output_dims->height, filter_dims->height,
+                            conv_params->stride.height, conv_params->padding.height,
+                            input_dims->width * input_dims->channels,
+                            output_dims->width * output_dims->channels,
+                            filter_dims->width * filter_dims->height * input_dims->channels *
+                            output_dims->channels};
+    if (!run_tiled(&c)) {
+        esp_nn_conv_s8(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                       conv_params, quant_data);
+    }
+}
+
+static void conv_f32_band(const void *args, const void *input, const esp_nn_input_rows_t *r, const void *filter,
+                          int32_t begin, int32_t end, void *out)
+{
+    const conv_args_t *a = (const conv_args_t *) args;
+    data_dims_t input_dims = *a->input_dims;
+    data_dims_t output_dims = *a->output_dims;
+    conv_f32_params_t conv_params = *(const conv_f32_params_t *) a->conv_params;
+    input_dims.height = r->rows;
+    output_dims.height = end - begin;
+    conv_params.padding.height = r->pad;
+    esp_nn_conv_f32(&input_dims, (const float *) input, a->filter_dims, (const float *) filter,
+                    (const float *) a->bias, &output_dims, (float *) out, &conv_params);
+}
+
+void esp_nn_tiled_conv_f32(const data_dims_t *input_dims,
+                           const float *input_data,
+                           const data_dims_t *filter_dims,
+                           const float *filter_data,
+                           const float *bias,
+                           const data_dims_t *output_dims,
+                           float *out_data,
+                           const conv_f32_params_t *conv_params)
+{
+    const conv_args_t args = {input_dims, filter_dims, bias, output_dims, conv_params, NULL};
+    const tiled_conv_t c = {conv_f32_band, &args, (const int8_t *) input_data, (const int8_t *) filter_data,
+                            (int8_t *) out_data, input_dims->height, output_dims->height, filter_dims->height,
+                            conv_params->stride.height, conv_params->padding.height,
+                            input_dims->width * input_dims->channels * (int32_t) sizeof(float),
+                            output_dims->width * output_dims->channels * (int32_t) sizeof(float),
+                            filter_dims->width * filter_dims->height * input_dims->channels *
+                            output_dims->channels * (int32_t) sizeof(float)};
+    if (!run_tiled(&c)) {
+        esp_nn_conv_f32(input_dims, input_data, filter_dims, filter_data, bias, output_dims, out_data,
+                        conv_params);
+    }
+}
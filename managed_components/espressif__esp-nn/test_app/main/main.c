@@ -26,6 +26,7 @@
 
 static const char *TAG = "test_app";
 static uint32_t start_c, start_opt, total_c, total_opt;
+static uint32_t check_failures;
 
 void profile_c_start()
 {
@@ -53,6 +54,11 @@ uint32_t profile_opt_end()
     return total_opt;
 }
 
+void esp_nn_test_check_failed()
+{
+    check_failures++;
+}
+
 void app_main()
 {
     /* s8 tests */
@@ -63,19 +69,38 @@ void app_main()
     printf("mul, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
     esp_nn_depthwise_conv_s8_test();
     esp_nn_conv_s8_test();
+    esp_nn_conv_max_pool_s8_test();
+    esp_nn_conv_winograd_s8_test();
 
     esp_nn_relu6_s8_test();
     printf("relu, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
+    esp_nn_relu6_s8_unaligned_test();
     esp_nn_avg_pool_s8_test();
     printf("avg_pool, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
+    esp_nn_avg_pool_s8_shapes_test();
     esp_nn_max_pool_s8_test();
     printf("max_pool, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
+    esp_nn_max_pool_s8_shapes_test();
+    esp_nn_global_avg_pool_s8_test();
+    esp_nn_global_avg_pool_fc_s8_test();
     esp_nn_fully_connected_s8_test();
     esp_nn_fully_connected_per_ch_s8_test();
+    esp_nn_fully_connected_s8_offsets_test();
     esp_nn_softmax_s8_test();
     printf("softmax, c %"PRIu32" opt %"PRIu32"\n", total_c, total_opt);
     ESP_LOGI(TAG, "s8 tests done!\n");
 
+    /* float tests */
+    ESP_LOGI(TAG, "Running f32 tests...");
+    esp_nn_conv_f32_test();
+    esp_nn_conv_rgb_f32_test();
+    esp_nn_conv_tiled_test();
+    esp_nn_max_pool_f32_test();
+    esp_nn_global_avg_pool_f32_test();
+    esp_nn_fully_connected_f32_test();
+    esp_nn_global_avg_pool_fc_f32_test();
+    ESP_LOGI(TAG, "f32 tests done!\n");
+
     /* u8 tests */
     //ESP_LOGI(TAG, "Running u8 tests...");
     //esp_nn_add_elementwise_u8_test();
@@ -85,4 +110,8 @@ void app_main()
     //esp_nn_max_pool_u8_test();
     //esp_nn_fully_connected_u8_test();
     //ESP_LOGI(TAG, "u8 tests done!\n");
+
+    if (check_failures) {
+        ESP_LOGE(TAG, "%"PRIu32" checks failed", check_failures);
+    }
 }
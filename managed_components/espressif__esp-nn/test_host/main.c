@@ -0,0 +1,528 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host build of the esp-nn tests: every test of tests/src runs its ansi and
+ * optimized kernels side by side, once per seed, and the layers of the sign
+ * model are benchmarked with their MACs per cycle. The optimized kernels are
+ * the generic ones an esp32 runs, the timings compare kernels with each other
+ * rather than predict the device.
+ *
+ * esp_nn_host_test [--runs N] [--seed S] [--reps N] [--tests-only]
+ *                  [--bench-only] [--quiet] [--json FILE]
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <float.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <esp_nn.h>
+#include <test_functions.h>
+#include "test_utils.h"
+
+/* Split kernels against the single core ones, with a thread as the worker */
+void esp_nn_parallel_test();
+
+/* Benchmark rows kept for the JSON report */
+#define MAX_RESULTS 64
+
+typedef struct {
+    const char *name;
+    void (*run)();
+} test_case_t;
+
+static const test_case_t tests[] = {
+    {"add_elementwise_s8", esp_nn_add_elementwise_s8_test},
+    {"mul_elementwise_s8", esp_nn_mul_elementwise_s8_test},
+    {"depthwise_conv_s8", esp_nn_depthwise_conv_s8_test},
+    {"conv_s8", esp_nn_conv_s8_test},
+    {"conv_max_pool_s8", esp_nn_conv_max_pool_s8_test},
+    {"conv_winograd_s8", esp_nn_conv_winograd_s8_test},
+    {"relu6_s8", esp_nn_relu6_s8_test},
+    {"relu6_s8_unaligned", esp_nn_relu6_s8_unaligned_test},
+    {"avg_pool_s8", esp_nn_avg_pool_s8_test},
+    {"avg_pool_s8_shapes", esp_nn_avg_pool_s8_shapes_test},
+    {"max_pool_s8", esp_nn_max_pool_s8_test},
+    {"max_pool_s8_shapes", esp_nn_max_pool_s8_shapes_test},
+    {"global_avg_pool_s8", esp_nn_global_avg_pool_s8_test},
+    {"global_avg_pool_fc_s8", esp_nn_global_avg_pool_fc_s8_test},
+    {"fully_connected_s8", esp_nn_fully_connected_s8_test},
+    {"fully_connected_per_ch_s8", esp_nn_fully_connected_per_ch_s8_test},
+    {"fully_connected_s8_offsets", esp_nn_fully_connected_s8_offsets_test},
+    {"softmax_s8", esp_nn_softmax_s8_test},
+    {"conv_f32", esp_nn_conv_f32_test},
+    {"conv_rgb_f32", esp_nn_conv_rgb_f32_test},
+    {"conv_tiled", esp_nn_conv_tiled_test},
+    {"max_pool_f32", esp_nn_max_pool_f32_test},
+    {"global_avg_pool_f32", esp_nn_global_avg_pool_f32_test},
+    {"fully_connected_f32", esp_nn_fully_connected_f32_test},
+    {"global_avg_pool_fc_f32", esp_nn_global_avg_pool_fc_f32_test},
+    {"parallel", esp_nn_parallel_test},
+};
+#define TEST_COUNT (sizeof(tests) / sizeof(tests[0]))
+
+typedef struct {
+    const char *layer;
+    const char *kernel;
+    uint64_t macs;
+    uint64_t cycles;    /* best of the repetitions */
+    double us;
+    bool match;         /* same outputs as the ansi kernel of the row */
+} bench_result_t;
+
+static bench_result_t results[MAX_RESULTS];
+static int result_count;
+static uint32_t check_failures;
+static double cycles_per_ns = 1.0;
+
+/* Cycle counter where there is one, nanoseconds otherwise */
+#if defined(__x86_64__) || defined(__i386__)
+#define TIMER_NAME "tsc"
+static inline uint64_t timer_now()
+{
+    return __rdtsc();
+}
+#else
+#define TIMER_NAME "ns"
+static inline uint64_t timer_now()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+#endif
+
+static uint64_t now_ns()
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ull + t.tv_nsec;
+}
+
+/* Timer ticks per nanosecond, to give the benchmarks in time as well */
+static void calibrate_timer()
+{
+    const uint64_t ns0 = now_ns(), t0 = timer_now();
+    while (now_ns() - ns0 < 20000000) {
+    }
+    cycles_per_ns = (double) (timer_now() - t0) / (now_ns() - ns0);
+}
+
+static uint64_t start_c, start_opt;
+
+void profile_c_start()
+{
+    start_c = timer_now();
+}
+
+uint32_t profile_c_end()
+{
+    return (uint32_t) (timer_now() - start_c);
+}
+
+void profile_opt_start()
+{
+    start_opt = timer_now();
+}
+
+uint32_t profile_opt_end()
+{
+    return (uint32_t) (timer_now() - start_opt);
+}
+
+void esp_nn_test_check_failed()
+{
+    check_failures++;
+}
+
+/* Best time of reps runs of CALL into CYCLES */
+#define BENCH(CYCLES, REPS, CALL) do {                          \
+    uint64_t _best = UINT64_MAX;                                \
+    for (int _r = 0; _r < (REPS); _r++) {                       \
+        const uint64_t _t0 = timer_now();                       \
+        CALL;                                                   \
+        const uint64_t _t = timer_now() - _t0;                  \
+        _best = _t < _best ? _t : _best;                        \
+    }                                                           \
+    CYCLES = _best;                                             \
+} while (0)
+
+static void record(const char *layer, const char *kernel, uint64_t macs, uint64_t cycles, bool match)
+{
+    if (result_count == MAX_RESULTS) {
+        return;
+    }
+    bench_result_t *r = &results[result_count++];
+    r->layer = layer;
+    r->kernel = kernel;
+    r->macs = macs;
+    r->cycles = cycles;
+    r->us = cycles / cycles_per_ns / 1000.0;
+    r->match = match;
+    printf("%-12s %-18s %10"PRIu64" MACs %10"PRIu64" cycles %9.1f us %6.2f MACs/cycle%s\n", layer, kernel, macs,
+           cycles, r->us, cycles ? (double) macs / cycles : 0.0, match ? "" : "  OUTPUT MISMATCH");
+}
+
+/* A 3x3 same padded convolution of the sign model, with the 2x2 max pool after it when pool is set */
+typedef struct {
+    const char *name;
+    uint16_t size, in_ch, out_ch;
+    bool pool;
+} sign_layer_t;
+
+static const sign_layer_t sign_layers[] = {
+    {"conv1", 64, 3, 16, true},
+    {"conv2", 32, 16, 32, true},
+    {"conv3", 16, 32, 64, false},
+};
+
+static void bench_conv_s8(const sign_layer_t *l, int reps)
+{
+    const int size = l->size, out_size = l->pool ? size / 2 : size;
+    const data_dims_t input_dims = {size, size, l->in_ch, 1};
+    const data_dims_t filter_dims = {3, 3, l->in_ch, l->out_ch};
+    const data_dims_t conv_dims = {size, size, l->out_ch, 1};
+    const data_dims_t output_dims = {out_size, out_size, l->out_ch, 1};
+    const conv_params_t conv_params = {128, -128, {1, 1}, {1, 1}, {1, 1}, {-128, 127}};
+    const pool_params_t pool_params = {{2, 2}, {2, 2}, {0, 0}, {-128, 127}};
+    const uint64_t macs = (uint64_t) size * size * l->out_ch * 9 * l->in_ch;
+    const int in_bytes = size * size * l->in_ch, conv_bytes = size * size * l->out_ch;
+    const int out_bytes = out_size * out_size * l->out_ch;
+
+    int8_t *input = malloc(in_bytes);
+    int8_t *filter = malloc(9 * l->in_ch * l->out_ch);
+    int32_t *bias = malloc(l->out_ch * sizeof(int32_t));
+    int32_t *mult = malloc(l->out_ch * sizeof(int32_t));
+    int32_t *shift = malloc(l->out_ch * sizeof(int32_t));
+    int8_t *conv_out = malloc(conv_bytes);
+    int8_t *out_ansi = malloc(out_bytes);
+    int8_t *out = malloc(out_bytes);
+    const int scratch_size = esp_nn_get_conv_scratch_size(&input_dims, &filter_dims, &conv_dims, &conv_params);
+    void *scratch = malloc(scratch_size > 0 ? scratch_size + 16 : 16);
+    int16_t *transform = malloc(esp_nn_get_conv_winograd_filter_size(&input_dims, &conv_dims));
+    void *winograd_scratch = malloc(esp_nn_get_conv_winograd_scratch_size(&input_dims));
+    if (!input || !filter || !bias || !mult || !shift || !conv_out || !out_ansi || !out || !scratch ||
+        !transform || !winograd_scratch) {
+        printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+        goto bench_conv_s8_cleanup;
+    }
+    for (int i = 0; i < in_bytes; i++) {
+        input[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < 9 * l->in_ch * l->out_ch; i++) {
+        filter[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < l->out_ch; i++) {
+        bias[i] = rand() % 20000 - 10000;
+        mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        shift[i] = -(rand() % 4 + 8);
+    }
+    const quant_data_t quant_data = {shift, mult};
+    uint64_t cycles;
+
+    BENCH(cycles, reps, {
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter, bias, &conv_dims,
+                            l->pool ? conv_out : out_ansi, &conv_params, &quant_data);
+        if (l->pool) {
+            esp_nn_max_pool_s8_ansi(conv_out, size, size, out_ansi, out_size, out_size, 2, 2, 2, 2, 0, 0,
+                                    -128, 127, l->out_ch);
+        }
+    });
+    record(l->name, "s8 ansi", macs, cycles, true);
+
+    esp_nn_set_conv_scratch_buf(scratch);
+    BENCH(cycles, reps, {
+        esp_nn_conv_s8(&input_dims, input, &filter_dims, filter, bias, &conv_dims, l->pool ? conv_out : out,
+                       &conv_params, &quant_data);
+        if (l->pool) {
+            esp_nn_max_pool_s8(conv_out, size, size, out, out_size, out_size, 2, 2, 2, 2, 0, 0,
+                               -128, 127, l->out_ch);
+        }
+    });
+    record(l->name, "s8 opt", macs, cycles, memcmp(out, out_ansi, out_bytes) == 0);
+
+    if (l->pool) {
+        memset(out, 0, out_bytes);
+        BENCH(cycles, reps, esp_nn_conv_max_pool_s8(&input_dims, input, &filter_dims, filter, bias, &conv_dims,
+                                                    &output_dims, out, &conv_params, &pool_params, &quant_data));
+        record(l->name, "s8 conv_max_pool", macs, cycles, memcmp(out, out_ansi, out_bytes) == 0);
+    }
+
+    if (esp_nn_conv_winograd_s8_supported(&input_dims, &filter_dims, &conv_params,
+                                          l->pool ? &pool_params : NULL)) {
+        /* filters are transformed once, ahead of the model, and not timed */
+        esp_nn_conv_winograd_filter_s8(&input_dims, &conv_dims, filter, transform);
+        esp_nn_set_conv_winograd_scratch_buf(winograd_scratch);
+        memset(out, 0, out_bytes);
+        BENCH(cycles, reps, esp_nn_conv_winograd_s8(&input_dims, input, transform, bias, &output_dims, out,
+                                                    &conv_params, l->pool ? &pool_params : NULL, &quant_data));
+        record(l->name, "s8 winograd", macs, cycles, memcmp(out, out_ansi, out_bytes) == 0);
+    }
+
+bench_conv_s8_cleanup:
+    free(input);
+    free(filter);
+    free(bias);
+    free(mult);
+    free(shift);
+    free(conv_out);
+    free(out_ansi);
+    free(out);
+    free(scratch);
+    free(transform);
+    free(winograd_scratch);
+}
+
+static void bench_conv_f32(const sign_layer_t *l, bool rgb, int reps)
+{
+    const int size = l->size, out_size = l->pool ? size / 2 : size;
+    const data_dims_t input_dims = {size, size, l->in_ch, 1};
+    const data_dims_t filter_dims = {3, 3, l->in_ch, l->out_ch};
+    const data_dims_t conv_dims = {size, size, l->out_ch, 1};
+    const conv_f32_params_t conv_params = {{1, 1}, {1, 1}, {0.0f, FLT_MAX}};
+    const uint64_t macs = (uint64_t) size * size * l->out_ch * 9 * l->in_ch;
+    const int in_size = size * size * l->in_ch, conv_size = size * size * l->out_ch;
+    const int out_size_all = out_size * out_size * l->out_ch;
+
+    uint8_t *pixels = malloc(in_size);
+    float *input = malloc(in_size * sizeof(float));
+    float *filter = malloc(9 * l->in_ch * l->out_ch * sizeof(float));
+    float *bias = malloc(l->out_ch * sizeof(float));
+    float *conv_out = malloc(conv_size * sizeof(float));
+    float *out_ansi = malloc(out_size_all * sizeof(float));
+    float *out = malloc(out_size_all * sizeof(float));
+    if (!pixels || !input || !filter || !bias || !conv_out || !out_ansi || !out) {
+        printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+        goto bench_conv_f32_cleanup;
+    }
+    /* rgb layers read the pixels, the others their normalised values */
+    for (int i = 0; i < in_size; i++) {
+        pixels[i] = rand() % 256;
+        input[i] = rgb ? pixels[i] : RAND_F32();
+    }
+    for (int i = 0; i < 9 * l->in_ch * l->out_ch; i++) {
+        filter[i] = RAND_F32() / 8;
+    }
+    for (int i = 0; i < l->out_ch; i++) {
+        bias[i] = RAND_F32();
+    }
+    uint64_t cycles;
+
+    BENCH(cycles, reps, {
+        esp_nn_conv_f32_ansi(&input_dims, input, &filter_dims, filter, bias, &conv_dims,
+                             l->pool ? conv_out : out_ansi, &conv_params);
+        if (l->pool) {
+            esp_nn_max_pool_f32_ansi(conv_out, size, size, out_ansi, out_size, out_size, 2, 2, 2, 2, 0, 0,
+                                     -FLT_MAX, FLT_MAX, l->out_ch);
+        }
+    });
+    record(l->name, "f32 ansi", macs, cycles, true);
+
+    BENCH(cycles, reps, {
+        esp_nn_conv_f32(&input_dims, input, &filter_dims, filter, bias, &conv_dims, l->pool ? conv_out : out,
+                        &conv_params);
+        if (l->pool) {
+            esp_nn_max_pool_f32(conv_out, size, size, out, out_size, out_size, 2, 2, 2, 2, 0, 0,
+                                -FLT_MAX, FLT_MAX, l->out_ch);
+        }
+    });
+    record(l->name, "f32 opt", macs, cycles, CHECK_FLOAT_CLOSE(out_ansi, out, out_size_all, 1e-4f));
+
+    if (rgb) {
+        BENCH(cycles, reps, {
+            esp_nn_conv_rgb_f32(&input_dims, pixels, &filter_dims, filter, bias, &conv_dims,
+                                l->pool ? conv_out : out, &conv_params, 0.0f);
+            if (l->pool) {
+                esp_nn_max_pool_f32(conv_out, size, size, out, out_size, out_size, 2, 2, 2, 2, 0, 0,
+                                    -FLT_MAX, FLT_MAX, l->out_ch);
+            }
+        });
+        record(l->name, "f32 rgb", macs, cycles, CHECK_FLOAT_CLOSE(out_ansi, out, out_size_all, 1e-4f));
+    }
+
+bench_conv_f32_cleanup:
+    free(pixels);
+    free(input);
+    free(filter);
+    free(bias);
+    free(conv_out);
+    free(out_ansi);
+    free(out);
+}
+
+/* Global average pool of the last convolution and the 64 -> 6 classifier */
+static void bench_head(int reps)
+{
+    const uint16_t size = 16, channels = 64, outputs = 6;
+    const uint64_t macs = size * size * channels + channels * outputs;
+    const int in_size = size * size * channels;
+    int8_t *input = malloc(in_size);
+    float *input_f32 = malloc(in_size * sizeof(float));
+    int8_t filter[64 * 6];
+    float filter_f32[64 * 6], bias_f32[6], out_f32_ansi[6], out_f32[6];
+    int32_t bias[6];
+    int8_t pooled[64], out_ansi[6], out[6];
+    float pooled_f32[64];
+    if (!input || !input_f32) {
+        printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+        goto bench_head_cleanup;
+    }
+    for (int i = 0; i < in_size; i++) {
+        input[i] = rand() % 256 - 128;
+        input_f32[i] = RAND_F32();
+    }
+    for (int i = 0; i < channels * outputs; i++) {
+        filter[i] = rand() % 256 - 128;
+        filter_f32[i] = RAND_F32();
+    }
+    for (int i = 0; i < outputs; i++) {
+        bias[i] = rand() % 20000 - 10000;
+        bias_f32[i] = RAND_F32();
+    }
+    uint64_t cycles;
+
+    /* quantization of the int8 sign model */
+    BENCH(cycles, reps, {
+        esp_nn_global_avg_pool_s8_ansi(input, size, size, channels, 128, -128, 1193154428, 3, pooled);
+        esp_nn_fully_connected_s8_ansi(pooled, 128, channels, filter, 0, bias, out_ansi, outputs, 21, -9,
+                                       2004859408, -128, 127);
+    });
+    record("head", "s8 ansi", macs, cycles, true);
+    BENCH(cycles, reps, esp_nn_global_avg_pool_fc_s8(input, size, size, channels, 128, -128, 1193154428, 3, filter,
+                                                     0, bias, out, outputs, 21, -9, 2004859408, -128, 127));
+    record("head", "s8 fused", macs, cycles, memcmp(out, out_ansi, sizeof(out)) == 0);
+
+    BENCH(cycles, reps, {
+        esp_nn_global_avg_pool_f32_ansi(input_f32, size, size, channels, pooled_f32);
+        esp_nn_fully_connected_f32_ansi(pooled_f32, channels, filter_f32, bias_f32, out_f32_ansi, outputs,
+                                        -FLT_MAX, FLT_MAX);
+    });
+    record("head", "f32 ansi", macs, cycles, true);
+    BENCH(cycles, reps, esp_nn_global_avg_pool_fc_f32(input_f32, size, size, channels, filter_f32, bias_f32,
+                                                      out_f32, outputs, -FLT_MAX, FLT_MAX));
+    record("head", "f32 fused", macs, cycles, CHECK_FLOAT_CLOSE(out_f32_ansi, out_f32, outputs, 1e-4f));
+
+bench_head_cleanup:
+    free(input);
+    free(input_f32);
+}
+
+static void write_json(const char *path, unsigned seed, int runs, const uint32_t *test_failures, bool ran_tests)
+{
+    FILE *f = fopen(path, "w");
+    if (f == NULL) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return;
+    }
+    fprintf(f, "{\n  \"timer\": \"%s\",\n  \"cycles_per_ns\": %.4f,\n  \"seed\": %u,\n  \"runs\": %d,\n",
+            TIMER_NAME, cycles_per_ns, seed, runs);
+    fprintf(f, "  \"tests\": [");
+    for (size_t i = 0; ran_tests && i < TEST_COUNT; i++) {
+        fprintf(f, "%s\n    {\"name\": \"%s\", \"failed_checks\": %"PRIu32"}", i ? "," : "", tests[i].name,
+                test_failures[i]);
+    }
+    fprintf(f, "\n  ],\n  \"bench\": [");
+    for (int i = 0; i < result_count; i++) {
+        const bench_result_t *r = &results[i];
+        fprintf(f, "%s\n    {\"layer\": \"%s\", \"kernel\": \"%s\", \"macs\": %"PRIu64", \"cycles\": %"PRIu64", "
+                "\"us\": %.2f, \"macs_per_cycle\": %.4f, \"mmacs_per_s\": %.1f, \"match\": %s}",
+                i ? "," : "", r->layer, r->kernel, r->macs, r->cycles, r->us,
+                r->cycles ? (double) r->macs / r->cycles : 0.0, r->us > 0 ? r->macs / r->us : 0.0,
+                r->match ? "true" : "false");
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned seed = 1;
+    int runs = 1, reps = 20;
+    bool run_tests = true, run_bench = true, quiet = false;
+    const char *json = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--runs") && i + 1 < argc) {
+            runs = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            seed = strtoul(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--reps") && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--tests-only")) {
+            run_bench = false;
+        } else if (!strcmp(argv[i], "--bench-only")) {
+            run_tests = false;
+        } else if (!strcmp(argv[i], "--quiet")) {
+            quiet = true;
+        } else if (!strcmp(argv[i], "--json") && i + 1 < argc) {
+            json = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [--runs N] [--seed S] [--reps N] [--tests-only] [--bench-only] "
+                    "[--quiet] [--json FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    calibrate_timer();
+
+    /* The tests draw their shapes and data from rand(), every run has its own seed */
+    uint32_t test_failures[TEST_COUNT] = {0};
+    uint32_t total_failures = 0;
+    for (size_t i = 0; run_tests && i < TEST_COUNT; i++) {
+        for (int run = 0; run < runs; run++) {
+            srand(seed + run);
+            const uint32_t before = check_failures;
+            fflush(stdout);
+            const int saved = quiet ? dup(STDOUT_FILENO) : -1;
+            if (quiet) {
+                const int null_fd = open("/dev/null", O_WRONLY);
+                dup2(null_fd, STDOUT_FILENO);
+                close(null_fd);
+            }
+            tests[i].run();
+            fflush(stdout);
+            if (quiet) {
+                dup2(saved, STDOUT_FILENO);
+                close(saved);
+            }
+            test_failures[i] += check_failures - before;
+        }
+        total_failures += test_failures[i];
+        printf("%-28s %s\n", tests[i].name, test_failures[i] ? ANSI_COLOR_RED"FAILED"ANSI_COLOR_RESET :
+               ANSI_COLOR_GREEN"ok"ANSI_COLOR_RESET);
+    }
+
+    if (run_bench) {
+        srand(seed);
+        printf("\nsign model layers, best of %d, timer %s (%.3f per ns)\n", reps, TIMER_NAME, cycles_per_ns);
+        for (size_t i = 0; i < sizeof(sign_layers) / sizeof(sign_layers[0]); i++) {
+            bench_conv_s8(&sign_layers[i], reps);
+        }
+        for (size_t i = 0; i < sizeof(sign_layers) / sizeof(sign_layers[0]); i++) {
+            bench_conv_f32(&sign_layers[i], i == 0, reps);
+        }
+        bench_head(reps);
+        for (int i = 0; i < result_count; i++) {
+            total_failures += !results[i].match;
+        }
+    }
+
+    if (json) {
+        write_json(json, seed, runs, test_failures, run_tests);
+    }
+    if (total_failures) {
+        printf(ANSI_COLOR_RED"%"PRIu32" checks failed\n"ANSI_COLOR_RESET, total_failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,359 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The kernels of esp_nn_parallel.h with a std::thread as the worker of the
+ * other core: their outputs must be bit-exact with the single core kernels,
+ * and the worker must have run its half.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <esp_nn.h>
+
+extern "C" void esp_nn_test_check_failed();
+
+namespace {
+
+// A persistent thread waiting for jobs, the caller spins on done as the device does
+struct thread_worker_t {
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    void (*job)(void*) = nullptr;
+    void* arg = nullptr;
+    bool stop = false;
+    std::atomic<bool> done{true};
+    uint32_t jobs = 0;
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this] { return stop || job; });
+            if (stop) {
+                return;
+            }
+            void (*fn)(void*) = job;
+            job = nullptr;
+            lock.unlock();
+            fn(arg);
+            jobs++;
+            done.store(true, std::memory_order_release);
+            lock.lock();
+        }
+    }
+};
+
+thread_worker_t thread_worker;
+
+void worker_start(void (*job)(void*), void* arg) {
+    thread_worker.done.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(thread_worker.mutex);
+        thread_worker.job = job;
+        thread_worker.arg = arg;
+    }
+    thread_worker.wake.notify_one();
+}
+
+void worker_wait() {
+    while (!thread_worker.done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+}
+
+int rand_range(int lo, int hi) {
+    return lo + rand() % (hi - lo + 1);
+}
+
+std::vector<int8_t> rand_s8(int n) {
+    std::vector<int8_t> v(n);
+    for (auto& x : v) {
+        x = rand() % 256 - 128;
+    }
+    return v;
+}
+
+std::vector<float> rand_f32(int n) {
+    std::vector<float> v(n);
+    for (auto& x : v) {
+        x = (rand() % 20001 - 10000) / 10000.0f;
+    }
+    return v;
+}
+
+uint32_t failures;
+
+template <typename T>
+void check(const char* kernel, int itr, const std::vector<T>& single, const std::vector<T>& split) {
+    if (memcmp(single.data(), split.data(), single.size() * sizeof(T)) != 0) {
+        printf("\x1b[31m%s, itr %d: split outputs differ\x1b[0m\n", kernel, itr);
+        esp_nn_test_check_failed();
+        failures++;
+    }
+}
+
+struct conv_shape_t {
+    data_dims_t input, filter, output;
+    int stride, pad_wd, pad_ht;
+};
+
+// Random convolution with at least two output rows, 1x1 ones unpadded as esp-nn assumes
+bool rand_conv_shape(conv_shape_t* s, int filter, int stride) {
+    const int in_wd = rand_range(filter, 24), in_ht = rand_range(filter, 40);
+    const int in_ch = rand_range(1, 24), out_ch = rand_range(1, 24);
+    s->stride = stride;
+    s->pad_wd = rand_range(0, filter - 1);
+    s->pad_ht = rand_range(0, filter - 1);
+    const int out_wd = (in_wd + 2 * s->pad_wd - filter) / stride + 1;
+    const int out_ht = (in_ht + 2 * s->pad_ht - filter) / stride + 1;
+    s->input = {in_wd, in_ht, in_ch, 1};
+    s->filter = {filter, filter, in_ch, out_ch};
+    s->output = {out_wd, out_ht, out_ch, 1};
+    return out_wd > 0 && out_ht > 1;
+}
+
+void conv_s8_test(int itr) {
+    conv_shape_t s;
+    if (!rand_conv_shape(&s, rand_range(1, 5), rand_range(1, 3))) {
+        return;
+    }
+    const int out_ch = s.output.channels;
+    const auto input = rand_s8(s.input.width * s.input.height * s.input.channels);
+    const auto filter = rand_s8(s.filter.width * s.filter.height * s.filter.channels * out_ch);
+    std::vector<int32_t> bias(out_ch), mult(out_ch), shift(out_ch);
+    for (int i = 0; i < out_ch; i++) {
+        bias[i] = rand() % 20000 - 10000;
+        mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        shift[i] = -(rand() % 4 + 8);
+    }
+    const conv_params_t params = {rand_range(-127, 128), rand_range(-128, 127), {s.stride, s.stride},
+                                  {s.pad_wd, s.pad_ht}, {1, 1}, {-128, 127}};
+    const quant_data_t quant = {shift.data(), mult.data()};
+    const int out_size = s.output.width * s.output.height * out_ch;
+    std::vector<int8_t> single(out_size), split(out_size);
+    esp_nn_conv_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output, single.data(),
+                   &params, &quant);
+    esp_nn_parallel_conv_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output,
+                            split.data(), &params, &quant);
+    check("conv_s8", itr, single, split);
+
+    // the same convolution with a pool fused, padded or not
+    const int pool = rand_range(2, 3), pool_stride = rand_range(1, pool), pool_pad = rand_range(0, pool - 1);
+    const data_dims_t pooled = {(s.output.width + 2 * pool_pad - pool) / pool_stride + 1,
+                                (s.output.height + 2 * pool_pad - pool) / pool_stride + 1, out_ch, 1};
+    if (pooled.width < 1 || pooled.height < 2) {
+        return;
+    }
+    const pool_params_t pool_params = {{pool, pool}, {pool_stride, pool_stride}, {pool_pad, pool_pad},
+                                       {-100, 100}};
+    const int pooled_size = pooled.width * pooled.height * out_ch;
+    std::vector<int8_t> pooled_single(pooled_size), pooled_split(pooled_size);
+    esp_nn_conv_max_pool_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output, &pooled,
+                            pooled_single.data(), &params, &pool_params, &quant);
+    esp_nn_parallel_conv_max_pool_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output,
+                                     &pooled, pooled_split.data(), &params, &pool_params, &quant);
+    check("conv_max_pool_s8", itr, pooled_single, pooled_split);
+}
+
+void conv_winograd_s8_test(int itr, std::vector<int16_t>& own_scratch) {
+    const int in_wd = rand_range(3, 24), in_ht = rand_range(3, 40);
+    const int in_ch = rand_range(1, 40), out_ch = rand_range(1, 24);
+    const int pad_wd = rand_range(0, 1), pad_ht = rand_range(0, 1);
+    const bool pooled = rand() % 2;
+    const int conv_wd = in_wd + 2 * pad_wd - 2, conv_ht = in_ht + 2 * pad_ht - 2;
+    const data_dims_t input_dims = {in_wd, in_ht, in_ch, 1};
+    const data_dims_t filter_dims = {3, 3, in_ch, out_ch};
+    const data_dims_t output_dims = {pooled ? conv_wd / 2 : conv_wd, pooled ? conv_ht / 2 : conv_ht, out_ch, 1};
+    const conv_params_t params = {rand_range(-127, 128), rand_range(-128, 127), {1, 1}, {pad_wd, pad_ht},
+                                  {1, 1}, {-128, 127}};
+    const pool_params_t pool_params = {{2, 2}, {2, 2}, {0, 0}, {-128, 127}};
+    const pool_params_t* pool = pooled ? &pool_params : nullptr;
+    if (output_dims.width < 1 || output_dims.height < 2 ||
+        !esp_nn_conv_winograd_s8_supported(&input_dims, &filter_dims, &params, pool)) {
+        return;
+    }
+    const auto input = rand_s8(in_wd * in_ht * in_ch);
+    const auto filter = rand_s8(9 * in_ch * out_ch);
+    std::vector<int16_t> transform(esp_nn_get_conv_winograd_filter_size(&input_dims, &output_dims) / 2);
+    esp_nn_conv_winograd_filter_s8(&input_dims, &output_dims, filter.data(), transform.data());
+    std::vector<int32_t> bias(out_ch), mult(out_ch), shift(out_ch);
+    for (int i = 0; i < out_ch; i++) {
+        bias[i] = rand() % 20000 - 10000;
+        mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        shift[i] = -(rand() % 4 + 8);
+    }
+    const quant_data_t quant = {shift.data(), mult.data()};
+    own_scratch.resize(esp_nn_get_conv_winograd_scratch_size(&input_dims) / 2);
+    esp_nn_set_conv_winograd_scratch_buf(own_scratch.data());
+    const int out_size = output_dims.width * output_dims.height * out_ch;
+    std::vector<int8_t> single(out_size), split(out_size);
+    esp_nn_conv_winograd_s8(&input_dims, input.data(), transform.data(), bias.data(), &output_dims, single.data(),
+                            &params, pool, &quant);
+    esp_nn_parallel_conv_winograd_s8(&input_dims, input.data(), transform.data(), bias.data(), &output_dims,
+                                     split.data(), &params, pool, &quant);
+    check("conv_winograd_s8", itr, single, split);
+}
+
+void conv_f32_test(int itr) {
+    conv_shape_t s;
+    if (!rand_conv_shape(&s, rand_range(1, 5), rand_range(1, 3))) {
+        return;
+    }
+    const int out_ch = s.output.channels;
+    const int in_size = s.input.width * s.input.height * s.input.channels;
+    const auto input = rand_f32(in_size);
+    const auto filter = rand_f32(s.filter.width * s.filter.height * s.filter.channels * out_ch);
+    const auto bias = rand_f32(out_ch);
+    const conv_f32_params_t params = {{s.stride, s.stride}, {s.pad_wd, s.pad_ht}, {-0.5f, 2.0f}};
+    const int out_size = s.output.width * s.output.height * out_ch;
+    std::vector<float> single(out_size), split(out_size);
+    esp_nn_conv_f32(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output, single.data(),
+                    &params);
+    esp_nn_parallel_conv_f32(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output,
+                             split.data(), &params);
+    check("conv_f32", itr, single, split);
+
+    std::vector<uint8_t> pixels(in_size);
+    for (auto& p : pixels) {
+        p = rand() % 256;
+    }
+    const float pad_value = rand() % 256;
+    esp_nn_conv_rgb_f32(&s.input, pixels.data(), &s.filter, filter.data(), bias.data(), &s.output, single.data(),
+                        &params, pad_value);
+    esp_nn_parallel_conv_rgb_f32(&s.input, pixels.data(), &s.filter, filter.data(), bias.data(), &s.output,
+                                 split.data(), &params, pad_value);
+    check("conv_rgb_f32", itr, single, split);
+}
+
+// The tiled kernels with the thread copying the next band, on a buffer of a few bands
+void tiled_conv_test(int itr) {
+    conv_shape_t s;
+    if (!rand_conv_shape(&s, rand_range(1, 5), rand_range(1, 3))) {
+        return;
+    }
+    const int out_ch = s.output.channels;
+    const int in_size = s.input.width * s.input.height * s.input.channels;
+    const int out_size = s.output.width * s.output.height * out_ch;
+    std::vector<uint8_t> tile_buf(rand_range(1, 16) * 1024);
+    esp_nn_set_tile_buf(tile_buf.data(), (int32_t) tile_buf.size());
+
+    const auto input = rand_s8(in_size);
+    const auto filter = rand_s8(s.filter.width * s.filter.height * s.filter.channels * out_ch);
+    std::vector<int32_t> bias(out_ch), mult(out_ch), shift(out_ch);
+    for (int i = 0; i < out_ch; i++) {
+        bias[i] = rand() % 20000 - 10000;
+        mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        shift[i] = -(rand() % 4 + 8);
+    }
+    const conv_params_t params = {rand_range(-127, 128), rand_range(-128, 127), {s.stride, s.stride},
+                                  {s.pad_wd, s.pad_ht}, {1, 1}, {-128, 127}};
+    const quant_data_t quant = {shift.data(), mult.data()};
+    std::vector<int8_t> single(out_size), tiled(out_size);
+    esp_nn_conv_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output, single.data(),
+                   &params, &quant);
+    esp_nn_tiled_conv_s8(&s.input, input.data(), &s.filter, filter.data(), bias.data(), &s.output, tiled.data(),
+                         &params, &quant);
+    check("tiled_conv_s8", itr, single, tiled);
+
+    const auto input_f32 = rand_f32(in_size);
+    const auto filter_f32 = rand_f32(s.filter.width * s.filter.height * s.filter.channels * out_ch);
+    const auto bias_f32 = rand_f32(out_ch);
+    const conv_f32_params_t params_f32 = {{s.stride, s.stride}, {s.pad_wd, s.pad_ht}, {-0.5f, 2.0f}};
+    std::vector<float> single_f32(out_size), tiled_f32(out_size);
+    esp_nn_conv_f32(&s.input, input_f32.data(), &s.filter, filter_f32.data(), bias_f32.data(), &s.output,
+                    single_f32.data(), &params_f32);
+    esp_nn_tiled_conv_f32(&s.input, input_f32.data(), &s.filter, filter_f32.data(), bias_f32.data(), &s.output,
+                          tiled_f32.data(), &params_f32);
+    check("tiled_conv_f32", itr, single_f32, tiled_f32);
+    esp_nn_set_tile_buf(nullptr, 0);
+}
+
+void fully_connected_test(int itr) {
+    const int row_len = rand_range(1, 300), out_ch = rand_range(2, 64);
+    const auto input = rand_s8(row_len);
+    const auto filter = rand_s8(row_len * out_ch);
+    std::vector<int32_t> bias(out_ch);
+    for (auto& b : bias) {
+        b = rand() % 20000 - 10000;
+    }
+    const int32_t in_offset = rand_range(-127, 128), filter_offset = rand_range(-127, 128);
+    const int32_t out_offset = rand_range(-128, 127), mult = 0x40000000 + rand() % 0x3fffffff;
+    const int32_t shift = -(rand() % 4 + 8);
+    const int32_t* b = rand() % 4 ? bias.data() : nullptr;
+    std::vector<int8_t> single(out_ch), split(out_ch);
+    esp_nn_fully_connected_s8(input.data(), in_offset, row_len, filter.data(), filter_offset, b, single.data(),
+                              out_ch, out_offset, shift, mult, -128, 127);
+    esp_nn_parallel_fully_connected_s8(input.data(), in_offset, row_len, filter.data(), filter_offset, b,
+                                       split.data(), out_ch, out_offset, shift, mult, -128, 127);
+    check("fully_connected_s8", itr, single, split);
+
+    const auto input_f32 = rand_f32(row_len);
+    const auto filter_f32 = rand_f32(row_len * out_ch);
+    const auto bias_f32 = rand_f32(out_ch);
+    const float* b_f32 = b ? bias_f32.data() : nullptr;
+    std::vector<float> single_f32(out_ch), split_f32(out_ch);
+    esp_nn_fully_connected_f32(input_f32.data(), row_len, filter_f32.data(), b_f32, single_f32.data(), out_ch,
+                               -1.0f, 1.0f);
+    esp_nn_parallel_fully_connected_f32(input_f32.data(), row_len, filter_f32.data(), b_f32, split_f32.data(),
+                                        out_ch, -1.0f, 1.0f);
+    check("fully_connected_f32", itr, single_f32, split_f32);
+}
+
+} // namespace
+
+extern "C" void esp_nn_parallel_test() {
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    failures = 0;
+    thread_worker.jobs = 0;
+    thread_worker.thread = std::thread(&thread_worker_t::run, &thread_worker);
+
+    // scratch of the worker, the caller's is the one set
+    std::vector<int16_t> worker_scratch(ESP_NN_WINOGRAD_MAX_CHANNELS * 16), own_scratch;
+    const esp_nn_worker_t worker = {worker_start, worker_wait, worker_scratch.data(),
+                                    (int32_t) (worker_scratch.size() * sizeof(int16_t)), 0};
+    esp_nn_set_worker(&worker);
+    for (int itr = 0; itr < 40; itr++) {
+        conv_s8_test(itr);
+        conv_winograd_s8_test(itr, own_scratch);
+        conv_f32_test(itr);
+        fully_connected_test(itr);
+        tiled_conv_test(itr);
+    }
+    const uint32_t jobs = thread_worker.jobs;
+
+    // below the threshold nothing goes to the worker
+    esp_nn_worker_t busy = worker;
+    busy.min_macs = INT32_MAX;
+    esp_nn_set_worker(&busy);
+    for (int itr = 0; itr < 4; itr++) {
+        fully_connected_test(itr);
+    }
+    esp_nn_set_worker(nullptr);
+
+    {
+        std::lock_guard<std::mutex> lock(thread_worker.mutex);
+        thread_worker.stop = true;
+    }
+    thread_worker.wake.notify_one();
+    thread_worker.thread.join();
+    thread_worker.stop = false;
+
+    if (jobs == 0 || thread_worker.jobs != jobs) {
+        printf("\x1b[31mworker ran %u jobs, then %u below the threshold\x1b[0m\n", jobs, thread_worker.jobs - jobs);
+        esp_nn_test_check_failed();
+        failures++;
+    }
+    if (failures == 0) {
+        printf("\x1b[32m%s split outputs bit-exact, %u jobs on the worker\x1b[0m\n", __FUNCTION__, jobs);
+    }
+}
@@ -0,0 +1,209 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Host check of the requantization helpers of common_functions.h against
+ * the TFLite reference arithmetic, written out here on 64 bit integers. Every
+ * shift of [-31, 7] runs with a set of multipliers over every input of
+ * [-2^17, 2^17] and a strided sweep of the rest of the int32 range that the
+ * left shift leaves valid. --full takes every valid input, best with one
+ * --shift and --mult as the 2^32 inputs of a pair take a few seconds.
+ *
+ * esp_nn_requant_test [--full] [--shift S] [--mult M] [--seed S]
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include <common_functions.h>
+
+#define DENSE_RANGE (1 << 17)
+#define SWEEP_STRIDE 4093
+#define RANDOM_PAIRS 10000000
+
+static int32_t reference_doubling_high_mul(int32_t a, int32_t b)
+{
+    if (a == b && a == INT32_MIN) {
+        return INT32_MAX;
+    }
+    const int64_t ab = (int64_t) a * b;
+    const int32_t nudge = ab >= 0 ? (1 << 30) : (1 - (1 << 30));
+    return (int32_t) ((ab + nudge) / (1ll << 31));
+}
+
+static int32_t reference_divide_by_pot(int32_t x, int32_t exponent)
+{
+    const int32_t mask = (int32_t) ((1ll << exponent) - 1);
+    const int32_t remainder = x & mask;
+    const int32_t threshold = (mask >> 1) + (x < 0);
+    return (x >> exponent) + (remainder > threshold);
+}
+
+static int32_t reference_requant(int32_t x, int32_t mult, int32_t shift)
+{
+    const int32_t left_shift = shift > 0 ? shift : 0;
+    const int32_t right_shift = shift > 0 ? 0 : -shift;
+    return reference_divide_by_pot(reference_doubling_high_mul((int32_t) ((uint32_t) x << left_shift), mult),
+                                   right_shift);
+}
+
+/* the previous 64 bit body of esp_nn_multiply_by_quantized_mult_fast */
+static int32_t reference_requant_fast(int32_t x, int32_t mult, int32_t shift)
+{
+    const int32_t left_shift = shift > 0 ? shift : 0;
+    const int32_t right_shift = left_shift - shift;
+    const int64_t product = (int64_t) (int32_t) ((uint32_t) x << left_shift) * mult + (1 << 30);
+    int32_t result = (int32_t) (product >> 31);
+    if (right_shift) {
+        result = esp_nn_div_by_power_of_two_fast(result, right_shift);
+    }
+    return result;
+}
+
+static uint32_t rng_state = 1;
+
+static uint32_t next_u32(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+typedef struct {
+    uint64_t checked;
+    uint64_t failures;
+    uint64_t round_once_diffs;
+    int32_t round_once_max_diff;
+} requant_stats_t;
+
+static void check_one(int32_t x, int32_t mult, int32_t shift, requant_stats_t *stats)
+{
+    const int32_t expected = reference_requant(x, mult, shift);
+    const int32_t mulhi = esp_nn_multiply_by_quantized_mult_mulhi(x, mult, shift);
+    const int32_t round_once = esp_nn_multiply_by_quantized_mult_round_once(x, mult, shift);
+    const int32_t configured = esp_nn_multiply_by_quantized_mult(x, mult, shift);
+    const int32_t fast = esp_nn_multiply_by_quantized_mult_fast(x, mult, shift);
+    const int64_t diff = llabs((int64_t) round_once - expected);
+#if defined(CONFIG_NN_REQUANT_ROUND_ONCE)
+    const bool configured_ok = configured == round_once && fast == round_once;
+#else
+    const bool configured_ok = configured == expected && fast == reference_requant_fast(x, mult, shift);
+#endif
+
+    stats->checked++;
+    if (diff) {
+        stats->round_once_diffs++;
+        if (diff > stats->round_once_max_diff) {
+            stats->round_once_max_diff = (int32_t) diff;
+        }
+    }
+    if (mulhi != expected || diff > 1 || !configured_ok) {
+        if (stats->failures++ < 10) {
+            printf("x %"PRIi32" mult %"PRIi32" shift %"PRIi32": reference %"PRIi32", mulhi %"PRIi32
+                   ", round once %"PRIi32", configured %"PRIi32", fast %"PRIi32"\n",
+                   x, mult, shift, expected, mulhi, round_once, configured, fast);
+        }
+    }
+}
+
+static void check_pair(int32_t mult, int32_t shift, bool full, requant_stats_t *stats)
+{
+    /* inputs that stay in range after the left shift */
+    const int32_t left_shift = shift > 0 ? shift : 0;
+    const int64_t lowest = INT32_MIN >> left_shift;
+    const int64_t highest = INT32_MAX >> left_shift;
+    const int64_t dense_lo = full ? lowest : (lowest > -DENSE_RANGE ? lowest : -DENSE_RANGE);
+    const int64_t dense_hi = full ? highest : (highest < DENSE_RANGE ? highest : DENSE_RANGE);
+
+    for (int64_t x = dense_lo; x <= dense_hi; x++) {
+        check_one((int32_t) x, mult, shift, stats);
+    }
+    if (!full) {
+        for (int64_t x = lowest; x <= highest; x += SWEEP_STRIDE) {
+            check_one((int32_t) x, mult, shift, stats);
+        }
+        check_one((int32_t) highest, mult, shift, stats);
+    }
+}
+
+/* the doubling high mul alone over edge values and random pairs of the whole int32 range */
+static uint64_t check_doubling_high_mul(void)
+{
+    static const int32_t edges[] = {INT32_MIN, INT32_MIN + 1, -(1 << 30), -2, -1, 0, 1, 2, 1 << 30,
+                                    INT32_MAX - 1, INT32_MAX};
+    const int edge_count = sizeof(edges) / sizeof(edges[0]);
+    uint64_t failures = 0;
+    for (int i = 0; i < edge_count; i++) {
+        for (int j = 0; j < edge_count; j++) {
+            failures += esp_nn_sat_round_doubling_high_mul_mulhi(edges[i], edges[j]) !=
+                        reference_doubling_high_mul(edges[i], edges[j]);
+        }
+    }
+    for (int i = 0; i < RANDOM_PAIRS; i++) {
+        const int32_t a = (int32_t) next_u32();
+        const int32_t b = (int32_t) next_u32();
+        const int32_t expected = reference_doubling_high_mul(a, b);
+        const int32_t result = esp_nn_sat_round_doubling_high_mul_mulhi(a, b);
+        if (result != expected && failures++ < 10) {
+            printf("doubling high mul %"PRIi32" * %"PRIi32": reference %"PRIi32", mulhi %"PRIi32"\n",
+                   a, b, expected, result);
+        }
+    }
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    bool full = false, one_shift = false, one_mult = false;
+    int32_t only_shift = 0, only_mult = 0;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--full")) {
+            full = true;
+        } else if (!strcmp(argv[i], "--shift") && i + 1 < argc) {
+            one_shift = true;
+            only_shift = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--mult") && i + 1 < argc) {
+            one_mult = true;
+            only_mult = (int32_t) strtol(argv[++i], NULL, 0);
+        } else if (!strcmp(argv[i], "--seed") && i + 1 < argc) {
+            rng_state = strtoul(argv[++i], NULL, 0) | 1;
+        } else {
+            fprintf(stderr, "usage: %s [--full] [--shift S] [--mult M] [--seed S]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    uint64_t failures = check_doubling_high_mul();
+    printf("doubling high mul: %d random pairs, %s\n", RANDOM_PAIRS, failures ? "FAILED" : "ok");
+
+    /* the edges of the [2^30, 2^31) range TFLite multipliers take, zero, and a few drawn from it */
+    int32_t mults[8] = {1 << 30, INT32_MAX, 0, 0x59e492c4};
+    for (int i = 4; i < 8; i++) {
+        mults[i] = (int32_t) ((1u << 30) | (next_u32() >> 2));
+    }
+    const int mult_count = one_mult ? 1 : 8;
+    if (one_mult) {
+        mults[0] = only_mult;
+    }
+
+    const clock_t start = clock();
+    for (int32_t shift = one_shift ? only_shift : -31; shift <= (one_shift ? only_shift : 7); shift++) {
+        requant_stats_t stats = {0};
+        for (int m = 0; m < mult_count; m++) {
+            check_pair(mults[m], shift, full, &stats);
+        }
+        printf("shift %3"PRIi32": %10"PRIu64" inputs, %s, round once off by %"PRIi32" on %.4f%%\n",
+               shift, stats.checked, stats.failures ? "FAILED" : "ok", stats.round_once_max_diff,
+               100.0 * stats.round_once_diffs / stats.checked);
+        failures += stats.failures;
+    }
+    printf("%.1f s, %s\n", (double) (clock() - start) / CLOCKS_PER_SEC, failures ? "FAILED" : "all ok");
+    return failures ? 1 : 0;
+}
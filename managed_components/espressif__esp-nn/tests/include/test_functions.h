@@ -19,17 +19,34 @@ void esp_nn_mul_elementwise_s8_test();
 
 void esp_nn_depthwise_conv_s8_test();
 void esp_nn_conv_s8_test();
+void esp_nn_conv_max_pool_s8_test();
+void esp_nn_conv_winograd_s8_test();
+void esp_nn_conv_tiled_test();
 
 void esp_nn_avg_pool_s8_test();
 void esp_nn_max_pool_s8_test();
+void esp_nn_avg_pool_s8_shapes_test();
+void esp_nn_max_pool_s8_shapes_test();
+void esp_nn_global_avg_pool_s8_test();
+void esp_nn_global_avg_pool_fc_s8_test();
 
 void esp_nn_fully_connected_s8_test();
 void esp_nn_fully_connected_per_ch_s8_test();
+void esp_nn_fully_connected_s8_offsets_test();
 
 void esp_nn_relu6_s8_test();
+void esp_nn_relu6_s8_unaligned_test();
 
 void esp_nn_softmax_s8_test();
 
+/* float ops tests */
+void esp_nn_conv_f32_test();
+void esp_nn_conv_rgb_f32_test();
+void esp_nn_max_pool_f32_test();
+void esp_nn_global_avg_pool_f32_test();
+void esp_nn_fully_connected_f32_test();
+void esp_nn_global_avg_pool_fc_f32_test();
+
 /* uint8_t ops tests */
 void esp_nn_add_elementwise_u8_test();
 
@@ -41,6 +41,12 @@ void profile_opt_start();
  */
 uint32_t profile_opt_end();
 
+/**
+ * @brief callback function to run when CHECK_EQUAL or CHECK_FLOAT_CLOSE
+ *        finds different outputs, lets the app count failures
+ */
+void esp_nn_test_check_failed();
+
 #define ANSI_COLOR_RED     "\x1b[31m"
 #define ANSI_COLOR_GREEN   "\x1b[32m"
 #define ANSI_COLOR_YELLOW  "\x1b[33m"
@@ -57,9 +63,33 @@ uint32_t profile_opt_end();
             break;                              \
         }                                       \
     }                                           \
+    if (!res) {                                 \
+        esp_nn_test_check_failed();             \
+    }                                           \
     res;                                        \
 })
 
+/* float results summed in another order: relative tolerance, absolute near zero */
+#define CHECK_FLOAT_CLOSE(ARRAY1, ARRAY2, size, tolerance) ({                   \
+    bool res = true;                                                            \
+    for (int _i = 0; _i < size; _i++) {                                        \
+        float _a = ARRAY1[_i], _b = ARRAY2[_i];                                 \
+        float _scale = _a < 0 ? -_a : _a;                                       \
+        float _diff = _a > _b ? _a - _b : _b - _a;                              \
+        if (_diff > (tolerance) * (_scale > 1.0f ? _scale : 1.0f)) {            \
+            res = false;                                                        \
+            break;                                                              \
+        }                                                                       \
+    }                                                                           \
+    if (!res) {                                                                 \
+        esp_nn_test_check_failed();                                             \
+    }                                                                           \
+    res;                                                                        \
+})
+
+/* random float in [-1, 1] */
+#define RAND_F32() ((float) rand() / RAND_MAX * 2.0f - 1.0f)
+
 #define PRINT_ARRAY_INT(ARRAY, width, height) ({        \
     int *_array = (int *) ARRAY;                        \
     for (int _j = 0; _j < height; _j++) {               \
@@ -103,7 +133,10 @@ uint32_t profile_opt_end();
 #if IDF_HEAP_CAPS
 #include "esp_heap_caps.h"
 #define ESP_NN_TEST_ALLOC(SIZE) heap_caps_malloc(SIZE, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+/* working sets the kernels stage tensors in */
+#define ESP_NN_TEST_ALLOC_INTERNAL(SIZE) heap_caps_malloc(SIZE, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
 #else
 #include <malloc.h>
 #define ESP_NN_TEST_ALLOC(SIZE) malloc(SIZE)
+#define ESP_NN_TEST_ALLOC_INTERNAL(SIZE) malloc(SIZE)
 #endif
@@ -161,13 +161,13 @@ void esp_nn_add_elementwise_s8_test()
             goto elementwise_add_test_cleanup;
         }
 
-        input1 = (int8_t *) (((uint32_t) input1_orig + 15) & ~15);
-        input2 = (int8_t *) (((uint32_t) input2_orig + 15) & ~15);
+        input1 = (int8_t *) (((uintptr_t) input1_orig + 15) & ~15);
+        input2 = (int8_t *) (((uintptr_t) input2_orig + 15) & ~15);
         if (itr == 4) {
             input2 = input2_orig; // unaligned input
         }
-        out_data_c = (int8_t *) (((uint32_t)out_c_orig + 15) & ~15);
-        out_data_opt = (int8_t *) (((uint32_t)out_opt_orig + 15) & ~15);
+        out_data_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+        out_data_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
 
         if (itr == 4) {
@@ -310,14 +310,14 @@ void esp_nn_mul_elementwise_s8_test()
             goto elementwise_mult_test_cleanup;
         }
 
-        input1 = (int8_t *) (((uint32_t) input1_orig + 15) & ~15);
-        input2 = (int8_t *) (((uint32_t) input2_orig + 15) & ~15);
+        input1 = (int8_t *) (((uintptr_t) input1_orig + 15) & ~15);
+        input2 = (int8_t *) (((uintptr_t) input2_orig + 15) & ~15);
         if (itr == 4 || itr == 5) {
             input2 = input2_orig; // unaligned input
         }
 
-        out_data_c = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-        out_data_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+        out_data_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+        out_data_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
         for (int i = 0; i < size; ++i) {
             input1[i] = rand() % 256 - 128;
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <float.h>
 #include <malloc.h>
 #include <inttypes.h>
 
@@ -206,9 +207,9 @@ void esp_nn_depthwise_conv_s8_test()
             goto dc_s8_cleanup;
         }
 
-        input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-        out_data_c = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-        out_data_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+        input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+        out_data_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+        out_data_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
         /* Generate input data */
         for (int i = 0; i < in_size; ++i) {
@@ -244,7 +245,7 @@ void esp_nn_depthwise_conv_s8_test()
                        itr, scratch_buf_size);
                 goto dc_s8_cleanup;
             }
-            int align_sz = 16 - (((int32_t) scratch_buf) & 0xf);
+            int align_sz = 16 - (((uintptr_t) scratch_buf) & 0xf);
             esp_nn_set_depthwise_conv_scratch_buf(scratch_buf + align_sz);
         }
 
@@ -507,9 +508,9 @@ void esp_nn_conv_s8_test()
             goto conv_s8_cleanup;
         }
 
-        int8_t *input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-        int8_t *out_data_c = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-        int8_t *out_data_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+        int8_t *input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+        int8_t *out_data_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+        int8_t *out_data_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
         /* Generate input data between -128 -> +127 */
         for (int i = 0; i < in_size; ++i) {
@@ -552,7 +553,7 @@ void esp_nn_conv_s8_test()
                 printf(ANSI_COLOR_RED"scratch_buf alloc failed size %d\n"ANSI_COLOR_RESET, scratch_buf_size);
                 goto conv_s8_cleanup;
             }
-            int align_sz = 16 - (((int32_t) scratch_buf) & 0xf);
+            int align_sz = 16 - (((uintptr_t) scratch_buf) & 0xf);
             esp_nn_set_conv_scratch_buf(scratch_buf + align_sz);
         }
 
@@ -626,3 +627,845 @@ void esp_nn_conv_s8_test()
         }
     }
 }
+
+/* random in [lo, hi] */
+static int rand_range(int lo, int hi)
+{
+    return lo + rand() % (hi - lo + 1);
+}
+
+void esp_nn_conv_max_pool_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    /* independent variables */
+    int in_wd, in_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, pad_wd, pad_ht, stride_wd, stride_ht;
+    uint16_t pool_filter_wd, pool_filter_ht, pool_pad_wd, pool_pad_ht, pool_stride_wd, pool_stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // shapes of the sign network, then random ones
+    for (int itr = 0; itr < 40; itr++) {
+        int8_t *input = NULL, *filter_data = NULL, *conv_out = NULL;
+        int8_t *out_data_c = NULL, *out_data_fused_c = NULL, *out_data_opt = NULL;
+        int32_t *bias = NULL, *out_shift = NULL, *out_mult = NULL;
+
+        switch (itr) {
+        case 0: // 3x3 conv (3 -> 16), pad (1,1), 2x2 pool
+            in_wd = 64;
+            in_ht = 64;
+            in_channels = 3;
+            out_channels = 16;
+            filter_wd = filter_ht = 3;
+            pad_wd = pad_ht = 1;
+            stride_wd = stride_ht = 1;
+            pool_filter_wd = pool_filter_ht = 2;
+            pool_stride_wd = pool_stride_ht = 2;
+            pool_pad_wd = pool_pad_ht = 0;
+            break;
+        case 1: // 3x3 conv (16 -> 32), pad (1,1), 2x2 pool
+            in_wd = 32;
+            in_ht = 32;
+            in_channels = 16;
+            out_channels = 32;
+            filter_wd = filter_ht = 3;
+            pad_wd = pad_ht = 1;
+            stride_wd = stride_ht = 1;
+            pool_filter_wd = pool_filter_ht = 2;
+            pool_stride_wd = pool_stride_ht = 2;
+            pool_pad_wd = pool_pad_ht = 0;
+            break;
+        default: // random shapes, strides and paddings of both
+            in_wd = rand_range(3, 20);
+            in_ht = rand_range(3, 20);
+            in_channels = rand_range(1, 20);
+            out_channels = rand_range(1, 24);
+            filter_wd = rand_range(1, 5);
+            filter_ht = rand_range(1, 5);
+            filter_wd = min(filter_wd, in_wd);
+            filter_ht = min(filter_ht, in_ht);
+            pad_wd = rand() % 2 ? filter_wd / 2 : 0;
+            pad_ht = rand() % 2 ? filter_ht / 2 : 0;
+            stride_wd = rand_range(1, 2);
+            stride_ht = rand_range(1, 2);
+            pool_filter_wd = rand_range(1, 3);
+            pool_filter_ht = rand_range(1, 3);
+            pool_stride_wd = rand_range(1, 3);
+            pool_stride_ht = rand_range(1, 3);
+            pool_pad_wd = rand() % 2 ? pool_filter_wd / 2 : 0;
+            pool_pad_ht = rand() % 2 ? pool_filter_ht / 2 : 0;
+            break;
+        }
+
+        /* prepare data */
+        const int conv_wd = (in_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const int conv_ht = (in_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        pool_filter_wd = min(pool_filter_wd, conv_wd);
+        pool_filter_ht = min(pool_filter_ht, conv_ht);
+        const int out_wd = (conv_wd + 2 * pool_pad_wd - pool_filter_wd) / pool_stride_wd + 1;
+        const int out_ht = (conv_ht + 2 * pool_pad_ht - pool_filter_ht) / pool_stride_ht + 1;
+
+        const int32_t input_offset = rand_range(-128, 127);
+        const int32_t out_offset = rand_range(-128, 127);
+        /* no activation, relu, or a narrower clamp of the pool */
+        const int32_t activation_min = rand() % 2 ? max(out_offset, -128) : -128;
+        const int32_t activation_max = 127;
+        const int32_t pool_activation_min = rand() % 3 ? -128 : -100;
+        const int32_t pool_activation_max = rand() % 3 ? 127 : 100;
+
+        int in_size = in_wd * in_ht * in_channels;
+        int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        int conv_size = conv_wd * conv_ht * out_channels;
+        int out_size = out_wd * out_ht * out_channels;
+
+        input = ESP_NN_TEST_ALLOC(in_size);
+        filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        conv_out = ESP_NN_TEST_ALLOC(conv_size);
+        out_data_c = ESP_NN_TEST_ALLOC(out_size);
+        out_data_fused_c = ESP_NN_TEST_ALLOC(out_size);
+        out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        bias = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_shift = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_mult = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+
+        if (input == NULL || filter_data == NULL || conv_out == NULL || out_data_c == NULL ||
+                out_data_fused_c == NULL || out_data_opt == NULL || bias == NULL ||
+                out_shift == NULL || out_mult == NULL) {
+            printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_max_pool_s8_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % UINT16_MAX - INT16_MAX;
+        }
+        /* scale the accumulators of the larger filters down further, to keep outputs off the clamps */
+        const int32_t base_shift = filter_size / out_channels > 32 ? -14 : -10;
+        for (int i = 0; i < out_channels; ++i) {
+            out_shift[i] = base_shift + rand() % 3;
+            out_mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        }
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        data_dims_t conv_dims = {.width = conv_wd, .height = conv_ht, .channels = out_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                     .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                     .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        pool_params_t pool_params = {.filter = {pool_filter_wd, pool_filter_ht},
+                                     .stride = {pool_stride_wd, pool_stride_ht},
+                                     .padding = {pool_pad_wd, pool_pad_ht},
+                                     .activation = {pool_activation_min, pool_activation_max}};
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+        /* unfused reference */
+        profile_c_start();
+        esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data,
+                            bias, &conv_dims, conv_out, &conv_params, &quant_data);
+        esp_nn_max_pool_s8_ansi(conv_out, conv_wd, conv_ht, out_data_c, out_wd, out_ht,
+                                pool_stride_wd, pool_stride_ht, pool_filter_wd, pool_filter_ht,
+                                pool_pad_wd, pool_pad_ht, pool_activation_min, pool_activation_max,
+                                out_channels);
+        total_c = profile_c_end();
+
+        esp_nn_conv_max_pool_s8_ansi(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims,
+                                     &output_dims, out_data_fused_c, &conv_params, &pool_params, &quant_data);
+
+        /* Optimized function */
+        profile_opt_start();
+        esp_nn_conv_max_pool_s8(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims,
+                                &output_dims, out_data_opt, &conv_params, &pool_params, &quant_data);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_fused_c, out_size) &&
+                   CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " conv: (%3d,%3d,%3d), filter: (%d, %d,%3d), pool: (%d, %d) stride (%d, %d) pad (%d, %d)]\n"
+                   ANSI_COLOR_RESET, itr, pad_wd, pad_ht, stride_wd, stride_ht, conv_wd, conv_ht,
+                   out_channels, filter_wd, filter_ht, in_channels, pool_filter_wd, pool_filter_ht,
+                   pool_stride_wd, pool_stride_ht, pool_pad_wd, pool_pad_ht);
+            goto conv_max_pool_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " conv: (%3d,%3d,%3d), filter: (%d, %d,%3d), pool: (%d, %d) stride (%d, %d) pad (%d, %d)]"
+               ANSI_COLOR_RESET, itr, pad_wd, pad_ht, stride_wd, stride_ht, conv_wd, conv_ht,
+               out_channels, filter_wd, filter_ht, in_channels, pool_filter_wd, pool_filter_ht,
+               pool_stride_wd, pool_stride_ht, pool_pad_wd, pool_pad_ht);
+        printf("\tcycles: unfused c %8"PRIu32", fused opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_max_pool_s8_cleanup:
+        free(input);
+        free(filter_data);
+        free(conv_out);
+        free(out_data_c);
+        free(out_data_fused_c);
+        free(out_data_opt);
+        free(bias);
+        free(out_shift);
+        free(out_mult);
+    }
+}
+
+void esp_nn_conv_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    /* independent variables */
+    int in_wd, in_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, pad_wd, pad_ht, stride_wd, stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // 3x3 layers of the sign network, then random shapes
+    for (int itr = 0; itr < 20; itr++) {
+        float *input = NULL, *filter_data = NULL, *bias = NULL;
+        float *out_data_c = NULL, *out_data_opt = NULL;
+
+        switch (itr) {
+        case 0:
+            in_wd = 64;
+            in_ht = 64;
+            in_channels = 3;
+            out_channels = 16;
+            break;
+        case 1:
+            in_wd = 32;
+            in_ht = 32;
+            in_channels = 16;
+            out_channels = 32;
+            break;
+        case 2:
+            in_wd = 16;
+            in_ht = 16;
+            in_channels = 32;
+            out_channels = 64;
+            break;
+        default:
+            in_wd = rand_range(1, 20);
+            in_ht = rand_range(1, 20);
+            in_channels = rand_range(1, 20);
+            out_channels = rand_range(1, 24);
+            break;
+        }
+        if (itr < 3) {
+            filter_wd = filter_ht = 3;
+            pad_wd = pad_ht = 1;
+            stride_wd = stride_ht = 1;
+        } else {
+            filter_wd = min(rand_range(1, 5), in_wd);
+            filter_ht = min(rand_range(1, 5), in_ht);
+            pad_wd = rand_range(0, filter_wd / 2);
+            pad_ht = rand_range(0, filter_ht / 2);
+            stride_wd = rand_range(1, 2);
+            stride_ht = rand_range(1, 2);
+        }
+
+        /* prepare data */
+        const int out_wd = (in_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const int out_ht = (in_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        const int in_size = in_wd * in_ht * in_channels;
+        const int filter_size = filter_wd * filter_ht * in_channels * out_channels;
+        const int out_size = out_wd * out_ht * out_channels;
+        /* relu or no activation */
+        const float activation_min = rand() % 2 ? 0.0f : -FLT_MAX;
+        const float activation_max = FLT_MAX;
+
+        input = ESP_NN_TEST_ALLOC(in_size * sizeof(float));
+        filter_data = ESP_NN_TEST_ALLOC(filter_size * sizeof(float));
+        bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(float));
+        out_data_c = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+        out_data_opt = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+        if (input == NULL || filter_data == NULL || bias == NULL || out_data_c == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_f32_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = RAND_F32();
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = RAND_F32();
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = RAND_F32();
+        }
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        conv_f32_params_t conv_params = {.stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                         .activation = {activation_min, activation_max}};
+
+        profile_c_start();
+        esp_nn_conv_f32_ansi(&input_dims, input, &filter_dims, filter_data, bias,
+                             &output_dims, out_data_c, &conv_params);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_conv_f32(&input_dims, input, &filter_dims, filter_data, bias,
+                        &output_dims, out_data_opt, &conv_params);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_FLOAT_CLOSE(out_data_c, out_data_opt, out_size, 1e-5f);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   out_channels, filter_wd, filter_ht, in_channels);
+            goto conv_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+               out_channels, filter_wd, filter_ht, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_f32_cleanup:
+        free(input);
+        free(filter_data);
+        free(bias);
+        free(out_data_c);
+        free(out_data_opt);
+    }
+}
+
+void esp_nn_conv_rgb_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    /* independent variables */
+    int in_wd, in_ht, in_channels, out_channels;
+    uint16_t filter_ht, filter_wd, pad_wd, pad_ht, stride_wd, stride_ht;
+    /* pixel p stands for (p / 255 - mean) / std, as the sign model input */
+    const float mean = 0.5f, std = 0.5f;
+    const float pad_value = mean * 255.0f;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // first layer of the sign network, then random shapes, mostly RGB
+    for (int itr = 0; itr < 20; itr++) {
+        uint8_t *pixels = NULL;
+        float *input = NULL, *filter_data = NULL, *bias = NULL;
+        float *folded_filter = NULL, *folded_bias = NULL;
+        float *out_data_c = NULL, *out_data_ansi = NULL, *out_data_opt = NULL;
+
+        if (itr == 0) {
+            in_wd = 64;
+            in_ht = 64;
+            in_channels = 3;
+            out_channels = 16;
+            filter_wd = filter_ht = 3;
+            pad_wd = pad_ht = 1;
+            stride_wd = stride_ht = 1;
+        } else {
+            in_wd = rand_range(1, 20);
+            in_ht = rand_range(1, 20);
+            in_channels = itr % 4 ? 3 : rand_range(1, 4);
+            out_channels = rand_range(1, 24);
+            filter_wd = min(rand_range(1, 7), in_wd);
+            filter_ht = min(rand_range(1, 7), in_ht);
+            pad_wd = rand_range(0, filter_wd / 2);
+            pad_ht = rand_range(0, filter_ht / 2);
+            stride_wd = rand_range(1, 2);
+            stride_ht = rand_range(1, 2);
+        }
+
+        /* prepare data */
+        const int out_wd = (in_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const int out_ht = (in_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        const int in_size = in_wd * in_ht * in_channels;
+        const int filter_per_out = filter_wd * filter_ht * in_channels;
+        const int filter_size = filter_per_out * out_channels;
+        const int out_size = out_wd * out_ht * out_channels;
+        /* relu or no activation */
+        const float activation_min = rand() % 2 ? 0.0f : -FLT_MAX;
+        const float activation_max = FLT_MAX;
+
+        pixels = ESP_NN_TEST_ALLOC(in_size);
+        input = ESP_NN_TEST_ALLOC(in_size * sizeof(float));
+        filter_data = ESP_NN_TEST_ALLOC(filter_size * sizeof(float));
+        bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(float));
+        folded_filter = ESP_NN_TEST_ALLOC(filter_size * sizeof(float));
+        folded_bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(float));
+        out_data_c = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+        out_data_ansi = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+        out_data_opt = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+        if (pixels == NULL || input == NULL || filter_data == NULL || bias == NULL || folded_filter == NULL ||
+            folded_bias == NULL || out_data_c == NULL || out_data_ansi == NULL || out_data_opt == NULL) {
+            printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_rgb_f32_cleanup;
+        }
+
+        for (int i = 0; i < in_size; ++i) {
+            pixels[i] = rand() & 0xff;
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = RAND_F32();
+        }
+        /* w * ((p / 255 - mean) / std) = w / (255 std) * p - w * mean / std */
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = RAND_F32();
+            float sum = 0;
+            for (int j = 0; j < filter_per_out; ++j) {
+                folded_filter[i * filter_per_out + j] = filter_data[i * filter_per_out + j] / (255.0f * std);
+                sum += filter_data[i * filter_per_out + j];
+            }
+            folded_bias[i] = bias[i] - sum * mean / std;
+        }
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+        conv_f32_params_t conv_params = {.stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                         .activation = {activation_min, activation_max}};
+
+        /* the path it replaces: a normalisation pass, then the float convolution */
+        profile_c_start();
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = (pixels[i] / 255.0f - mean) / std;
+        }
+        esp_nn_conv_f32(&input_dims, input, &filter_dims, filter_data, bias,
+                        &output_dims, out_data_c, &conv_params);
+        total_c = profile_c_end();
+
+        esp_nn_conv_rgb_f32_ansi(&input_dims, pixels, &filter_dims, folded_filter, folded_bias,
+                                 &output_dims, out_data_ansi, &conv_params, pad_value);
+
+        profile_opt_start();
+        esp_nn_conv_rgb_f32(&input_dims, pixels, &filter_dims, folded_filter, folded_bias,
+                            &output_dims, out_data_opt, &conv_params, pad_value);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_FLOAT_CLOSE(out_data_c, out_data_ansi, out_size, 1e-4f) &&
+                   CHECK_FLOAT_CLOSE(out_data_c, out_data_opt, out_size, 1e-4f);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]\n"ANSI_COLOR_RESET,
+                   itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   out_channels, filter_wd, filter_ht, in_channels);
+            goto conv_rgb_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d)]"ANSI_COLOR_RESET,
+               itr, pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+               out_channels, filter_wd, filter_ht, in_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    conv_rgb_f32_cleanup:
+        free(pixels);
+        free(input);
+        free(filter_data);
+        free(bias);
+        free(folded_filter);
+        free(folded_bias);
+        free(out_data_c);
+        free(out_data_ansi);
+        free(out_data_opt);
+    }
+}
+
+void esp_nn_conv_winograd_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    /* independent variables */
+    int in_wd, in_ht, in_channels, out_channels, pooled;
+    uint16_t pad_wd, pad_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // 3x3 layers of the sign network, the first two pooled, then random shapes
+    for (int itr = 0; itr < 40; itr++) {
+        int8_t *input = NULL, *filter_data = NULL, *out_data_c = NULL, *out_data_opt = NULL;
+        int16_t *filter_transform = NULL, *scratch_buf = NULL;
+        int32_t *bias = NULL, *out_shift = NULL, *out_mult = NULL;
+
+        switch (itr) {
+        case 0:
+            in_wd = in_ht = 64;
+            in_channels = 3;
+            out_channels = 16;
+            pooled = 1;
+            break;
+        case 1:
+            in_wd = in_ht = 32;
+            in_channels = 16;
+            out_channels = 32;
+            pooled = 1;
+            break;
+        case 2:
+            in_wd = in_ht = 16;
+            in_channels = 32;
+            out_channels = 64;
+            pooled = 0;
+            break;
+        default:
+            in_wd = rand_range(3, 20);
+            in_ht = rand_range(3, 20);
+            in_channels = itr % 8 ? rand_range(1, 40) : ESP_NN_WINOGRAD_MAX_CHANNELS;
+            out_channels = rand_range(1, 24);
+            pooled = rand() % 2;
+            break;
+        }
+        if (itr < 3) {
+            pad_wd = pad_ht = 1;
+        } else {
+            pad_wd = rand_range(0, 2);
+            pad_ht = rand_range(0, 2);
+        }
+
+        /* prepare data */
+        const int conv_wd = in_wd + 2 * pad_wd - 2;
+        const int conv_ht = in_ht + 2 * pad_ht - 2;
+        const int out_wd = pooled ? conv_wd / 2 : conv_wd;
+        const int out_ht = pooled ? conv_ht / 2 : conv_ht;
+        if (out_wd < 1 || out_ht < 1) {
+            continue;
+        }
+
+        const int32_t input_offset = rand_range(-127, 128);
+        const int32_t out_offset = rand_range(-128, 127);
+        /* no activation or relu, and a narrower clamp of the pool */
+        const int32_t activation_min = rand() % 2 ? max(out_offset, -128) : -128;
+        const int32_t activation_max = 127;
+        const int32_t pool_activation_min = rand() % 3 ? -128 : -100;
+        const int32_t pool_activation_max = rand() % 3 ? 127 : 100;
+
+        int in_size = in_wd * in_ht * in_channels;
+        int filter_size = 9 * in_channels * out_channels;
+        int conv_size = conv_wd * conv_ht * out_channels;
+        int out_size = out_wd * out_ht * out_channels;
+
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t filter_dims = {.width = 3, .height = 3, 0, 0};
+        data_dims_t conv_dims = {.width = conv_wd, .height = conv_ht, .channels = out_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        conv_params_t conv_params = {.in_offset = input_offset, .out_offset = out_offset,
+                                     .stride = {1, 1}, .padding = {pad_wd, pad_ht},
+                                     .dilation = {0, 0}, .activation = {activation_min, activation_max}};
+        pool_params_t pool_params = {.filter = {2, 2}, .stride = {2, 2}, .padding = {0, 0},
+                                     .activation = {pool_activation_min, pool_activation_max}};
+        const pool_params_t *pool = pooled ? &pool_params : NULL;
+
+        input = ESP_NN_TEST_ALLOC(in_size);
+        filter_data = ESP_NN_TEST_ALLOC(filter_size);
+        out_data_c = ESP_NN_TEST_ALLOC(pooled ? out_size : conv_size);
+        out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+        filter_transform = ESP_NN_TEST_ALLOC(esp_nn_get_conv_winograd_filter_size(&input_dims, &output_dims));
+        scratch_buf = ESP_NN_TEST_ALLOC(esp_nn_get_conv_winograd_scratch_size(&input_dims));
+        bias = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_shift = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+        out_mult = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+
+        if (input == NULL || filter_data == NULL || out_data_c == NULL || out_data_opt == NULL ||
+                filter_transform == NULL || scratch_buf == NULL || bias == NULL ||
+                out_shift == NULL || out_mult == NULL) {
+            printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+            goto conv_winograd_s8_cleanup;
+        }
+
+        /* extreme values too, the int16 tiles and int32 sums must hold them */
+        for (int i = 0; i < in_size; ++i) {
+            input[i] = itr % 8 ? rand() % 256 - 128 : (rand() % 2 ? 127 : -128);
+        }
+        for (int i = 0; i < filter_size; ++i) {
+            filter_data[i] = itr % 8 ? rand() % 256 - 128 : (rand() % 2 ? 127 : -128);
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % UINT16_MAX - INT16_MAX;
+        }
+        /* scale the accumulators of the larger filters down further, to keep outputs off the clamps */
+        const int32_t base_shift = in_channels > 32 ? -16 : in_channels > 3 ? -14 : -10;
+        for (int i = 0; i < out_channels; ++i) {
+            out_shift[i] = base_shift + rand() % 3;
+            out_mult[i] = 0x40000000 + rand() % 0x3fffffff;
+        }
+
+        quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+        if (!esp_nn_conv_winograd_s8_supported(&input_dims, &filter_dims, &conv_params, pool)) {
+            printf(ANSI_COLOR_RED"[%3d] shape not supported\n"ANSI_COLOR_RESET, itr);
+            goto conv_winograd_s8_cleanup;
+        }
+        /* prepare time */
+        esp_nn_conv_winograd_filter_s8(&input_dims, &output_dims, filter_data, filter_transform);
+        esp_nn_set_conv_winograd_scratch_buf(scratch_buf);
+
+        /* reference, timed against the direct convolution of the current path */
+        if (pooled) {
+            esp_nn_conv_max_pool_s8_ansi(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims,
+                                         &output_dims, out_data_c, &conv_params, &pool_params, &quant_data);
+            profile_c_start();
+            esp_nn_conv_max_pool_s8(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims,
+                                    &output_dims, out_data_opt, &conv_params, &pool_params,
+                                    &quant_data);
+            total_c = profile_c_end();
+        } else {
+            esp_nn_conv_s8_ansi(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims, out_data_c,
+                                &conv_params, &quant_data);
+            profile_c_start();
+            esp_nn_conv_s8(&input_dims, input, &filter_dims, filter_data, bias, &conv_dims, out_data_opt,
+                           &conv_params, &quant_data);
+            total_c = profile_c_end();
+        }
+
+        profile_opt_start();
+        esp_nn_conv_winograd_s8(&input_dims, input, filter_transform, bias, &output_dims, out_data_opt,
+                                &conv_params, pool, &quant_data);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [pad: (%d, %d), out: (%3d,%3d,%3d), in_ch: %3d, pooled: %d]\n"
+                   ANSI_COLOR_RESET, itr, pad_wd, pad_ht, out_wd, out_ht, out_channels, in_channels, pooled);
+            goto conv_winograd_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [pad: (%d, %d), out: (%3d,%3d,%3d), in_ch: %3d, pooled: %d]"
+               ANSI_COLOR_RESET, itr, pad_wd, pad_ht, out_wd, out_ht, out_channels, in_channels, pooled);
+        printf("\tcycles: direct %8"PRIu32", winograd %8"PRIu32"\n", total_c, total_opt);
+
+    conv_winograd_s8_cleanup:
+        free(input);
+        free(filter_data);
+        free(out_data_c);
+        free(out_data_opt);
+        free(filter_transform);
+        free(scratch_buf);
+        free(bias);
+        free(out_shift);
+        free(out_mult);
+    }
+}
+
+/* runs the job on the calling core: the tiled kernels then take their two slot path */
+static void inline_worker_start(void (*job)(void *), void *arg)
+{
+    job(arg);
+}
+
+static void inline_worker_wait(void)
+{
+}
+
+static const esp_nn_worker_t inline_worker = {inline_worker_start, inline_worker_wait, NULL, 0, 0};
+
+static bool conv_tiled_s8_case(const data_dims_t *input_dims, const data_dims_t *filter_dims,
+                               const data_dims_t *output_dims, const conv_params_t *conv_params,
+                               uint32_t *total_c, uint32_t *total_opt)
+{
+    const int out_channels = output_dims->channels;
+    const int in_size = input_dims->width * input_dims->height * input_dims->channels;
+    const int filter_size = filter_dims->width * filter_dims->height * input_dims->channels * out_channels;
+    const int out_size = output_dims->width * output_dims->height * out_channels;
+    bool ret = false;
+
+    int8_t *input = ESP_NN_TEST_ALLOC(in_size);
+    int8_t *filter_data = ESP_NN_TEST_ALLOC(filter_size);
+    int8_t *out_data_c = ESP_NN_TEST_ALLOC(out_size);
+    int8_t *out_data_opt = ESP_NN_TEST_ALLOC(out_size);
+    int32_t *bias = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+    int32_t *out_shift = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+    int32_t *out_mult = ESP_NN_TEST_ALLOC(sizeof (int32_t) * out_channels);
+    const int scratch_buf_size = esp_nn_get_conv_scratch_size(input_dims, filter_dims, output_dims, conv_params);
+    void *scratch_buf = scratch_buf_size > 0 ? ESP_NN_TEST_ALLOC(scratch_buf_size + 16) : NULL;
+    if (input == NULL || filter_data == NULL || out_data_c == NULL || out_data_opt == NULL || bias == NULL ||
+            out_shift == NULL || out_mult == NULL || (scratch_buf_size > 0 && scratch_buf == NULL)) {
+        printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+        goto conv_tiled_s8_cleanup;
+    }
+    if (scratch_buf) {
+        esp_nn_set_conv_scratch_buf((int8_t *) scratch_buf + 16 - (((uintptr_t) scratch_buf) & 0xf));
+    }
+
+    for (int i = 0; i < in_size; ++i) {
+        input[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < filter_size; ++i) {
+        filter_data[i] = rand() % 256 - 128;
+    }
+    for (int i = 0; i < out_channels; ++i) {
+        bias[i] = rand() % UINT16_MAX - INT16_MAX;
+        out_shift[i] = (filter_size / out_channels > 32 ? -14 : -10) + rand() % 3;
+        out_mult[i] = 0x40000000 + rand() % 0x3fffffff;
+    }
+    quant_data_t quant_data = {.shift = out_shift, .mult = out_mult};
+
+    /* the plain call on the tensors in place, against the tiled one */
+    profile_c_start();
+    esp_nn_conv_s8(input_dims, input, filter_dims, filter_data, bias, output_dims, out_data_c,
+                   conv_params, &quant_data);
+    *total_c = profile_c_end();
+
+    profile_opt_start();
+    esp_nn_tiled_conv_s8(input_dims, input, filter_dims, filter_data, bias, output_dims, out_data_opt,
+                         conv_params, &quant_data);
+    *total_opt = profile_opt_end();
+
+    ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+
+conv_tiled_s8_cleanup:
+    free(input);
+    free(filter_data);
+    free(out_data_c);
+    free(out_data_opt);
+    free(bias);
+    free(out_shift);
+    free(out_mult);
+    free(scratch_buf);
+    return ret;
+}
+
+static bool conv_tiled_f32_case(const data_dims_t *input_dims, const data_dims_t *filter_dims,
+                                const data_dims_t *output_dims, const conv_f32_params_t *conv_params,
+                                uint32_t *total_c, uint32_t *total_opt)
+{
+    const int out_channels = output_dims->channels;
+    const int in_size = input_dims->width * input_dims->height * input_dims->channels;
+    const int filter_size = filter_dims->width * filter_dims->height * input_dims->channels * out_channels;
+    const int out_size = output_dims->width * output_dims->height * out_channels;
+    bool ret = false;
+
+    float *input = ESP_NN_TEST_ALLOC(in_size * sizeof(float));
+    float *filter_data = ESP_NN_TEST_ALLOC(filter_size * sizeof(float));
+    float *bias = ESP_NN_TEST_ALLOC(out_channels * sizeof(float));
+    float *out_data_c = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+    float *out_data_opt = ESP_NN_TEST_ALLOC(out_size * sizeof(float));
+    if (input == NULL || filter_data == NULL || bias == NULL || out_data_c == NULL || out_data_opt == NULL) {
+        printf(ANSI_COLOR_RED"allocations failed\n"ANSI_COLOR_RESET);
+        goto conv_tiled_f32_cleanup;
+    }
+
+    for (int i = 0; i < in_size; ++i) {
+        input[i] = RAND_F32();
+    }
+    for (int i = 0; i < filter_size; ++i) {
+        filter_data[i] = RAND_F32();
+    }
+    for (int i = 0; i < out_channels; ++i) {
+        bias[i] = RAND_F32();
+    }
+
+    profile_c_start();
+    esp_nn_conv_f32(input_dims, input, filter_dims, filter_data, bias, output_dims, out_data_c, conv_params);
+    *total_c = profile_c_end();
+
+    profile_opt_start();
+    esp_nn_tiled_conv_f32(input_dims, input, filter_dims, filter_data, bias, output_dims, out_data_opt,
+                          conv_params);
+    *total_opt = profile_opt_end();
+
+    /* the same sums in the same order, only read from elsewhere */
+    ret = CHECK_EQUAL(out_data_c, out_data_opt, out_size);
+
+conv_tiled_f32_cleanup:
+    free(input);
+    free(filter_data);
+    free(bias);
+    free(out_data_c);
+    free(out_data_opt);
+    return ret;
+}
+
+void esp_nn_conv_tiled_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    /* independent variables */
+    int in_wd, in_ht, in_channels, out_channels, is_f32, tile_size;
+    uint16_t filter_ht, filter_wd, pad_wd, pad_ht, stride_wd, stride_ht;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // 3x3 layers of the sign network on a 32 KB tile buffer, then random shapes and buffer sizes
+    for (int itr = 0; itr < 60; itr++) {
+        switch (itr % 30) {
+        case 0:
+            in_wd = in_ht = 64;
+            in_channels = 3;
+            out_channels = 16;
+            break;
+        case 1:
+            in_wd = in_ht = 32;
+            in_channels = 16;
+            out_channels = 32;
+            break;
+        case 2:
+            in_wd = in_ht = 16;
+            in_channels = 32;
+            out_channels = 64;
+            break;
+        default:
+            in_wd = rand_range(1, 20);
+            in_ht = rand_range(1, 20);
+            in_channels = rand_range(1, 20);
+            out_channels = rand_range(1, 24);
+            break;
+        }
+        is_f32 = itr >= 30;
+        if (itr % 30 < 3) {
+            filter_wd = filter_ht = 3;
+            pad_wd = pad_ht = 1;
+            stride_wd = stride_ht = 1;
+            tile_size = 32 * 1024;
+        } else {
+            filter_wd = min(rand_range(1, 5), in_wd);
+            filter_ht = min(rand_range(1, 5), in_ht);
+            pad_wd = rand_range(0, filter_wd / 2);
+            pad_ht = rand_range(0, filter_ht / 2);
+            stride_wd = rand_range(1, 2);
+            stride_ht = rand_range(1, 2);
+            /* too small for a row now and then, else from a few rows up to the whole tensors */
+            tile_size = itr % 10 ? rand_range(256, 16 * 1024) : 64;
+        }
+        /* the two slots of a worker on every other run */
+        esp_nn_set_worker(itr % 2 ? &inline_worker : NULL);
+
+        const int out_wd = (in_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const int out_ht = (in_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        data_dims_t input_dims = {.width = in_wd, .height = in_ht, .channels = in_channels, 1};
+        data_dims_t output_dims = {.width = out_wd, .height = out_ht, .channels = out_channels, 1};
+        data_dims_t filter_dims = {.width = filter_wd, .height = filter_ht, 0, 0};
+
+        void *tile_buf = ESP_NN_TEST_ALLOC_INTERNAL(tile_size);
+        if (tile_buf == NULL) {
+            printf(ANSI_COLOR_RED"tile_buf alloc failed size %d\n"ANSI_COLOR_RESET, tile_size);
+            continue;
+        }
+        esp_nn_set_tile_buf(tile_buf, tile_size);
+
+        bool ret;
+        if (is_f32) {
+            const float activation_min = rand() % 2 ? 0.0f : -FLT_MAX;
+            conv_f32_params_t conv_params = {.stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                             .activation = {activation_min, FLT_MAX}};
+            ret = conv_tiled_f32_case(&input_dims, &filter_dims, &output_dims, &conv_params,
+                                      &total_c, &total_opt);
+        } else {
+            const int32_t out_offset = rand_range(-128, 127);
+            conv_params_t conv_params = {.in_offset = rand_range(-127, 128), .out_offset = out_offset,
+                                         .stride = {stride_wd, stride_ht}, .padding = {pad_wd, pad_ht},
+                                         .dilation = {0, 0},
+                                         .activation = {rand() % 2 ? max(out_offset, -128) : -128, 127}};
+            ret = conv_tiled_s8_case(&input_dims, &filter_dims, &output_dims, &conv_params,
+                                     &total_c, &total_opt);
+        }
+        esp_nn_set_tile_buf(NULL, 0);
+        esp_nn_set_worker(NULL);
+        free(tile_buf);
+
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [%s pad: (%d, %d), stride: (%d, %d)"
+                   " out: (%3d,%3d,%3d), filter: (%d, %d,%3d), tile buf: %5d]\n"ANSI_COLOR_RESET,
+                   itr, is_f32 ? "f32" : "s8", pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+                   out_channels, filter_wd, filter_ht, in_channels, tile_size);
+            continue;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [%s pad: (%d, %d), stride: (%d, %d)"
+               " out: (%3d,%3d,%3d), filter: (%d, %d,%3d), tile buf: %5d]"ANSI_COLOR_RESET,
+               itr, is_f32 ? "f32" : "s8", pad_wd, pad_ht, stride_wd, stride_ht, out_wd, out_ht,
+               out_channels, filter_wd, filter_ht, in_channels, tile_size);
+        printf("\tcycles: in place %8"PRIu32", tiled %8"PRIu32"\n", total_c, total_opt);
+    }
+}
@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <float.h>
 
 #include <esp_nn.h>
 #include "test_utils.h"
@@ -22,7 +23,7 @@ void esp_nn_fully_connected_s8_test()
     uint16_t out_channels = 3;
     int8_t input[row_len];
     int8_t filter_data[row_len * out_channels];
-    int8_t output_c[out_channels], output_opt[out_channels];
+    int8_t output_c[16], output_opt[16]; /* most out_channels of the iterations below */
     int32_t activation_min = -128;
     int32_t activation_max = 127;
     int32_t input_offset = 0;
@@ -274,3 +275,144 @@ void esp_nn_fully_connected_per_ch_s8_test()
         }
     }
 }
+
+/* nonzero offsets and a bias, per tensor and per channel quantization */
+void esp_nn_fully_connected_s8_offsets_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 12; itr++) {
+        const bool per_ch = itr % 2;
+        const uint16_t row_len = itr < 2 ? 64 : rand() % 300 + 1;
+        const uint16_t out_channels = itr < 2 ? 6 : rand() % 17 + 1;
+        const int32_t input_offset = itr < 2 ? 128 : rand() % 256 - 127;
+        const int32_t filter_offset = itr < 2 ? 0 : rand() % 256 - 127;
+        const int32_t out_offset = rand() % 256 - 128;
+        const int32_t activation_min = itr % 3 == 0 ? -128 : rand() % 64 - 64;
+        const int32_t activation_max = itr % 3 == 0 ? 127 : rand() % 64;
+        int8_t *input = malloc(row_len);
+        int8_t *filter_data = malloc(row_len * out_channels);
+        int32_t *bias = malloc(out_channels * sizeof(int32_t));
+        int32_t *out_mult = malloc(out_channels * sizeof(int32_t));
+        int32_t *out_shift = malloc(out_channels * sizeof(int32_t));
+        int8_t *output_c = malloc(out_channels);
+        int8_t *output_opt = malloc(out_channels);
+        if (input == NULL || filter_data == NULL || bias == NULL || out_mult == NULL || out_shift == NULL ||
+                output_c == NULL || output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto fully_connected_offsets_cleanup;
+        }
+        for (int i = 0; i < row_len; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < row_len * out_channels; ++i) {
+            filter_data[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % 40000 - 20000;
+            out_mult[i] = INT32_MAX - rand() % (1 << 30);
+            out_shift[i] = per_ch || i == 0 ? -(rand() % 8 + 8) : out_shift[0];
+        }
+
+        profile_c_start();
+        if (per_ch) {
+            esp_nn_fully_connected_per_ch_s8_ansi(input, input_offset, row_len, filter_data, filter_offset,
+                                                  bias, output_c, out_channels, out_offset, out_shift, out_mult,
+                                                  activation_min, activation_max);
+        } else {
+            esp_nn_fully_connected_s8_ansi(input, input_offset, row_len, filter_data, filter_offset,
+                                           bias, output_c, out_channels, out_offset, out_shift[0], out_mult[0],
+                                           activation_min, activation_max);
+        }
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        if (per_ch) {
+            esp_nn_fully_connected_per_ch_s8(input, input_offset, row_len, filter_data, filter_offset,
+                                             bias, output_opt, out_channels, out_offset, out_shift, out_mult,
+                                             activation_min, activation_max);
+        } else {
+            esp_nn_fully_connected_s8(input, input_offset, row_len, filter_data, filter_offset,
+                                      bias, output_opt, out_channels, out_offset, out_shift[0], out_mult[0],
+                                      activation_min, activation_max);
+        }
+        total_opt = profile_opt_end();
+
+        if (CHECK_EQUAL(output_c, output_opt, out_channels) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [row_len %"PRIu16", out_ch %"PRIu16", offsets (%"PRIi32", %"PRIi32")]\n"
+                   ANSI_COLOR_RESET, itr, row_len, out_channels, input_offset, filter_offset);
+            goto fully_connected_offsets_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [row_len %"PRIu16", out_ch %"PRIu16", %s]"ANSI_COLOR_RESET,
+               itr, row_len, out_channels, per_ch ? "per channel" : "per tensor");
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    fully_connected_offsets_cleanup:
+        free(input);
+        free(filter_data);
+        free(bias);
+        free(out_mult);
+        free(out_shift);
+        free(output_c);
+        free(output_opt);
+    }
+}
+
+void esp_nn_fully_connected_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // classifier of the sign network, then random sizes
+    for (int itr = 0; itr < 10; itr++) {
+        const uint16_t row_len = itr == 0 ? 64 : rand() % 300 + 1;
+        const uint16_t out_channels = itr == 0 ? 6 : rand() % 17 + 1;
+        const float activation_min = itr % 2 ? 0.0f : -FLT_MAX;
+        const float activation_max = FLT_MAX;
+        float *input = malloc(row_len * sizeof(float));
+        float *filter_data = malloc(row_len * out_channels * sizeof(float));
+        float *bias = malloc(out_channels * sizeof(float));
+        float *output_c = malloc(out_channels * sizeof(float));
+        float *output_opt = malloc(out_channels * sizeof(float));
+        if (input == NULL || filter_data == NULL || bias == NULL || output_c == NULL || output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto fully_connected_f32_cleanup;
+        }
+        for (int i = 0; i < row_len; ++i) {
+            input[i] = RAND_F32();
+        }
+        for (int i = 0; i < row_len * out_channels; ++i) {
+            filter_data[i] = RAND_F32();
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = RAND_F32();
+        }
+
+        profile_c_start();
+        esp_nn_fully_connected_f32_ansi(input, row_len, filter_data, bias, output_c, out_channels,
+                                        activation_min, activation_max);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_fully_connected_f32(input, row_len, filter_data, bias, output_opt, out_channels,
+                                   activation_min, activation_max);
+        total_opt = profile_opt_end();
+
+        if (CHECK_FLOAT_CLOSE(output_c, output_opt, out_channels, 1e-5f) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [row_len %d, out_channels %d]\n"ANSI_COLOR_RESET,
+                   itr, row_len, out_channels);
+            goto fully_connected_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [row_len %d, out_channels %d]"ANSI_COLOR_RESET,
+               itr, row_len, out_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    fully_connected_f32_cleanup:
+        free(input);
+        free(filter_data);
+        free(bias);
+        free(output_c);
+        free(output_opt);
+    }
+}
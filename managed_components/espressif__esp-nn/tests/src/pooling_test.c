@@ -8,6 +8,8 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <float.h>
+#include <inttypes.h>
 #include <malloc.h>
 
 #include <esp_nn.h>
@@ -42,9 +44,9 @@ void esp_nn_avg_pool_s8_test()
         goto avg_pool_s8_cleanup;
     }
 
-    input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-    output_c = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-    output_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+    input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+    output_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+    output_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
     /**
      * width/height, channels etc look suspicious but it it true.
@@ -129,9 +131,9 @@ void esp_nn_max_pool_s8_test()
         goto max_pool_s8_cleanup;
     }
 
-    input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-    output_c = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-    output_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+    input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+    output_c = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+    output_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
     for (int i = 0; i < size; ++i) {
         input[i] = rand() % 256 - 128;
@@ -181,3 +183,413 @@ max_pool_s8_cleanup:
         free(out_opt_orig);
     }
 }
+
+/* random shapes and activation ranges, windows past the 16 bit lane sums of the avg pool included */
+static void pool_s8_shapes_test(const char *name, bool avg)
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", name);
+    for (int itr = 0; itr < 12; itr++) {
+        uint16_t input_wd, input_ht, channels, filter_wd, filter_ht, stride_wd, stride_ht, pad_wd, pad_ht;
+        int8_t *input_orig = NULL, *out_c_orig = NULL, *out_opt_orig = NULL;
+        if (itr < 2) {
+            /* one window over the whole input, 400 and 576 positions */
+            input_wd = input_ht = filter_wd = filter_ht = itr == 0 ? 20 : 24;
+            channels = itr == 0 ? 8 : 13;
+            stride_wd = stride_ht = 1;
+            pad_wd = pad_ht = 0;
+        } else {
+            input_wd = rand() % 20 + 1;
+            input_ht = rand() % 20 + 1;
+            channels = rand() % 24 + 1;
+            filter_wd = min(rand() % 5 + 1, input_wd);
+            filter_ht = min(rand() % 5 + 1, input_ht);
+            stride_wd = rand() % 3 + 1;
+            stride_ht = rand() % 3 + 1;
+            pad_wd = rand() % (filter_wd / 2 + 1);
+            pad_ht = rand() % (filter_ht / 2 + 1);
+        }
+        const uint16_t out_wd = (input_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const uint16_t out_ht = (input_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        const int size = input_wd * input_ht * channels;
+        const int out_size = out_wd * out_ht * channels;
+        const int32_t activation_min = itr % 3 == 0 ? -128 : rand() % 64 - 64;
+        const int32_t activation_max = itr % 3 == 0 ? 127 : rand() % 64;
+
+        /* odd addresses, the kernels must not assume aligned words */
+        input_orig = malloc(size + 1);
+        out_c_orig = malloc(out_size + 1);
+        out_opt_orig = malloc(out_size + 1);
+        if (input_orig == NULL || out_c_orig == NULL || out_opt_orig == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, name);
+            goto pool_s8_shapes_cleanup;
+        }
+        int8_t *input = input_orig + 1, *output_c = out_c_orig + 1, *output_opt = out_opt_orig + 1;
+        for (int i = 0; i < size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+
+        profile_c_start();
+        if (avg) {
+            esp_nn_avg_pool_s8_ansi(input, input_wd, input_ht, output_c, out_wd, out_ht,
+                                    stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                                    activation_min, activation_max, channels);
+        } else {
+            esp_nn_max_pool_s8_ansi(input, input_wd, input_ht, output_c, out_wd, out_ht,
+                                    stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                                    activation_min, activation_max, channels);
+        }
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        if (avg) {
+            esp_nn_avg_pool_s8(input, input_wd, input_ht, output_opt, out_wd, out_ht,
+                               stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                               activation_min, activation_max, channels);
+        } else {
+            esp_nn_max_pool_s8(input, input_wd, input_ht, output_opt, out_wd, out_ht,
+                               stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                               activation_min, activation_max, channels);
+        }
+        total_opt = profile_opt_end();
+
+        if (CHECK_EQUAL(output_c, output_opt, out_size) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d), filter: (%d, %d), stride: (%d, %d), pad: (%d, %d)]\n"
+                   ANSI_COLOR_RESET, itr, input_wd, input_ht, channels, filter_wd, filter_ht,
+                   stride_wd, stride_ht, pad_wd, pad_ht);
+            goto pool_s8_shapes_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d), filter: (%d, %d), stride: (%d, %d), pad: (%d, %d)]"
+               ANSI_COLOR_RESET, itr, input_wd, input_ht, channels, filter_wd, filter_ht,
+               stride_wd, stride_ht, pad_wd, pad_ht);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    pool_s8_shapes_cleanup:
+        free(input_orig);
+        free(out_c_orig);
+        free(out_opt_orig);
+    }
+}
+
+void esp_nn_avg_pool_s8_shapes_test()
+{
+    pool_s8_shapes_test(__FUNCTION__, true);
+}
+
+void esp_nn_max_pool_s8_shapes_test()
+{
+    pool_s8_shapes_test(__FUNCTION__, false);
+}
+
+void esp_nn_max_pool_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // 2x2 pools of the sign network, then random shapes
+    for (int itr = 0; itr < 12; itr++) {
+        uint16_t input_wd, input_ht, channels, filter_wd, filter_ht, stride_wd, stride_ht, pad_wd, pad_ht;
+        float *input = NULL, *output_c = NULL, *output_opt = NULL;
+        if (itr < 2) {
+            input_wd = input_ht = itr == 0 ? 64 : 32;
+            channels = itr == 0 ? 16 : 32;
+            filter_wd = filter_ht = 2;
+            stride_wd = stride_ht = 2;
+            pad_wd = pad_ht = 0;
+        } else {
+            input_wd = rand() % 16 + 1;
+            input_ht = rand() % 16 + 1;
+            channels = rand() % 24 + 1;
+            filter_wd = min(rand() % 3 + 1, input_wd);
+            filter_ht = min(rand() % 3 + 1, input_ht);
+            stride_wd = rand() % 3 + 1;
+            stride_ht = rand() % 3 + 1;
+            pad_wd = rand() % (filter_wd / 2 + 1);
+            pad_ht = rand() % (filter_ht / 2 + 1);
+        }
+        const uint16_t out_wd = (input_wd + 2 * pad_wd - filter_wd) / stride_wd + 1;
+        const uint16_t out_ht = (input_ht + 2 * pad_ht - filter_ht) / stride_ht + 1;
+        const int size = input_wd * input_ht * channels;
+        const int out_size = out_wd * out_ht * channels;
+        const float activation_min = itr % 3 == 0 ? 0.0f : -FLT_MAX;
+        const float activation_max = itr % 4 == 0 ? 0.5f : FLT_MAX;
+
+        input = malloc(size * sizeof(float));
+        output_c = malloc(out_size * sizeof(float));
+        output_opt = malloc(out_size * sizeof(float));
+        if (input == NULL || output_c == NULL || output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto max_pool_f32_cleanup;
+        }
+        for (int i = 0; i < size; ++i) {
+            input[i] = RAND_F32();
+        }
+
+        profile_c_start();
+        esp_nn_max_pool_f32_ansi(input, input_wd, input_ht, output_c, out_wd, out_ht,
+                                 stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                                 activation_min, activation_max, channels);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_max_pool_f32(input, input_wd, input_ht, output_opt, out_wd, out_ht,
+                            stride_wd, stride_ht, filter_wd, filter_ht, pad_wd, pad_ht,
+                            activation_min, activation_max, channels);
+        total_opt = profile_opt_end();
+
+        /* max selects one of the inputs, results are exact */
+        if (CHECK_EQUAL(output_c, output_opt, out_size) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d), filter: (%d, %d), stride: (%d, %d), pad: (%d, %d)]\n"
+                   ANSI_COLOR_RESET, itr, input_wd, input_ht, channels, filter_wd, filter_ht,
+                   stride_wd, stride_ht, pad_wd, pad_ht);
+            goto max_pool_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d), filter: (%d, %d), stride: (%d, %d), pad: (%d, %d)]"
+               ANSI_COLOR_RESET, itr, input_wd, input_ht, channels, filter_wd, filter_ht,
+               stride_wd, stride_ht, pad_wd, pad_ht);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    max_pool_f32_cleanup:
+        free(input);
+        free(output_c);
+        free(output_opt);
+    }
+}
+
+void esp_nn_global_avg_pool_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // head of the sign network, then random shapes
+    for (int itr = 0; itr < 8; itr++) {
+        const uint16_t input_wd = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t input_ht = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t channels = itr == 0 ? 64 : rand() % 70 + 1;
+        const int size = input_wd * input_ht * channels;
+        float *input = malloc(size * sizeof(float));
+        float *output_c = malloc(channels * sizeof(float));
+        float *output_opt = malloc(channels * sizeof(float));
+        if (input == NULL || output_c == NULL || output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto global_avg_pool_f32_cleanup;
+        }
+        for (int i = 0; i < size; ++i) {
+            input[i] = RAND_F32();
+        }
+
+        profile_c_start();
+        esp_nn_global_avg_pool_f32_ansi(input, input_wd, input_ht, channels, output_c);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_global_avg_pool_f32(input, input_wd, input_ht, channels, output_opt);
+        total_opt = profile_opt_end();
+
+        if (CHECK_FLOAT_CLOSE(output_c, output_opt, channels, 1e-5f) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d)]\n"ANSI_COLOR_RESET,
+                   itr, input_wd, input_ht, channels);
+            goto global_avg_pool_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d)]"ANSI_COLOR_RESET, itr, input_wd, input_ht, channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    global_avg_pool_f32_cleanup:
+        free(input);
+        free(output_c);
+        free(output_opt);
+    }
+}
+
+void esp_nn_global_avg_pool_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // head of the sign network, then random shapes and quantization
+    for (int itr = 0; itr < 10; itr++) {
+        const uint16_t input_wd = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t input_ht = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t channels = itr == 0 ? 64 : rand() % 100 + 1;
+        const int32_t input_offset = itr == 0 ? 128 : rand() % 256 - 127;
+        const int32_t output_offset = itr == 0 ? -128 : rand() % 256 - 128;
+        const int32_t out_mult = itr == 0 ? 1193154428 : INT32_MAX - rand() % (1 << 30);
+        const int32_t out_shift = itr == 0 ? 3 : rand() % 8 - 4;
+        const int size = input_wd * input_ht * channels;
+        int8_t *input = malloc(size);
+        int8_t *output_c = malloc(channels);
+        int8_t *output_opt = malloc(channels);
+        if (input == NULL || output_c == NULL || output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto global_avg_pool_s8_cleanup;
+        }
+        for (int i = 0; i < size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+
+        profile_c_start();
+        esp_nn_global_avg_pool_s8_ansi(input, input_wd, input_ht, channels, input_offset, output_offset,
+                                       out_mult, out_shift, output_c);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_global_avg_pool_s8(input, input_wd, input_ht, channels, input_offset, output_offset,
+                                  out_mult, out_shift, output_opt);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(output_c, output_opt, channels);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d)]\n"ANSI_COLOR_RESET,
+                   itr, input_wd, input_ht, channels);
+            goto global_avg_pool_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d)]"ANSI_COLOR_RESET, itr, input_wd, input_ht, channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    global_avg_pool_s8_cleanup:
+        free(input);
+        free(output_c);
+        free(output_opt);
+    }
+}
+
+void esp_nn_global_avg_pool_fc_s8_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    // the sign classifier head, then random shapes. The reference runs pool and fully connected apart
+    for (int itr = 0; itr < 10; itr++) {
+        const uint16_t input_wd = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t input_ht = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t channels = itr == 0 ? 64 : rand() % ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS + 1;
+        const uint16_t out_channels = itr == 0 ? 6 : rand() % 20 + 1;
+        const int32_t input_offset = itr == 0 ? 128 : rand() % 256 - 127;
+        const int32_t pool_offset = itr == 0 ? -128 : rand() % 256 - 128;
+        const int32_t pool_mult = itr == 0 ? 1193154428 : INT32_MAX - rand() % (1 << 30);
+        const int32_t pool_shift = itr == 0 ? 3 : rand() % 8 - 4;
+        const int32_t filter_offset = itr == 0 ? 0 : rand() % 2 ? 0 : rand() % 256 - 127;
+        const int32_t out_offset = itr == 0 ? 21 : rand() % 256 - 128;
+        const int32_t out_mult = itr == 0 ? 2004859408 : INT32_MAX - rand() % (1 << 30);
+        const int32_t out_shift = itr == 0 ? -9 : -(rand() % 6 + 6);
+        const int32_t activation_min = itr % 3 ? -128 : -100;
+        const int32_t activation_max = itr % 3 ? 127 : 100;
+        const int size = input_wd * input_ht * channels;
+        int8_t *input = malloc(size);
+        int8_t *filter = malloc(channels * out_channels);
+        int32_t *bias = malloc(out_channels * sizeof(int32_t));
+        int8_t *pooled = malloc(channels);
+        int8_t *output_c = malloc(out_channels);
+        int8_t *output_opt = malloc(out_channels);
+        if (input == NULL || filter == NULL || bias == NULL || pooled == NULL || output_c == NULL ||
+            output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto global_avg_pool_fc_s8_cleanup;
+        }
+        for (int i = 0; i < size; ++i) {
+            input[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < channels * out_channels; ++i) {
+            filter[i] = rand() % 256 - 128;
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = rand() % 20000 - 10000;
+        }
+
+        profile_c_start();
+        esp_nn_global_avg_pool_s8_ansi(input, input_wd, input_ht, channels, input_offset, pool_offset,
+                                       pool_mult, pool_shift, pooled);
+        esp_nn_fully_connected_s8_ansi(pooled, -pool_offset, channels, filter, filter_offset, bias, output_c,
+                                       out_channels, out_offset, out_shift, out_mult, activation_min, activation_max);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_global_avg_pool_fc_s8(input, input_wd, input_ht, channels, input_offset, pool_offset, pool_mult,
+                                     pool_shift, filter, filter_offset, bias, output_opt, out_channels, out_offset,
+                                     out_shift, out_mult, activation_min, activation_max);
+        total_opt = profile_opt_end();
+
+        bool ret = CHECK_EQUAL(output_c, output_opt, out_channels);
+        if (ret == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d), out: %d]\n"ANSI_COLOR_RESET,
+                   itr, input_wd, input_ht, channels, out_channels);
+            goto global_avg_pool_fc_s8_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d), out: %d]"ANSI_COLOR_RESET,
+               itr, input_wd, input_ht, channels, out_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    global_avg_pool_fc_s8_cleanup:
+        free(input);
+        free(filter);
+        free(bias);
+        free(pooled);
+        free(output_c);
+        free(output_opt);
+    }
+}
+
+void esp_nn_global_avg_pool_fc_f32_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    for (int itr = 0; itr < 10; itr++) {
+        const uint16_t input_wd = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t input_ht = itr == 0 ? 16 : rand() % 20 + 1;
+        const uint16_t channels = itr == 0 ? 64 : rand() % ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS + 1;
+        const uint16_t out_channels = itr == 0 ? 6 : rand() % 20 + 1;
+        const float activation_min = itr % 3 ? -FLT_MAX : 0.0f;
+        const float activation_max = itr % 3 ? FLT_MAX : 6.0f;
+        const int size = input_wd * input_ht * channels;
+        float *input = malloc(size * sizeof(float));
+        float *filter = malloc(channels * out_channels * sizeof(float));
+        float *bias = malloc(out_channels * sizeof(float));
+        float *pooled = malloc(channels * sizeof(float));
+        float *output_c = malloc(out_channels * sizeof(float));
+        float *output_opt = malloc(out_channels * sizeof(float));
+        if (input == NULL || filter == NULL || bias == NULL || pooled == NULL || output_c == NULL ||
+            output_opt == NULL) {
+            printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
+            goto global_avg_pool_fc_f32_cleanup;
+        }
+        for (int i = 0; i < size; ++i) {
+            input[i] = RAND_F32();
+        }
+        for (int i = 0; i < channels * out_channels; ++i) {
+            filter[i] = RAND_F32();
+        }
+        for (int i = 0; i < out_channels; ++i) {
+            bias[i] = RAND_F32();
+        }
+
+        profile_c_start();
+        esp_nn_global_avg_pool_f32_ansi(input, input_wd, input_ht, channels, pooled);
+        esp_nn_fully_connected_f32_ansi(pooled, channels, filter, bias, output_c, out_channels,
+                                        activation_min, activation_max);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_global_avg_pool_fc_f32(input, input_wd, input_ht, channels, filter, bias, output_opt,
+                                      out_channels, activation_min, activation_max);
+        total_opt = profile_opt_end();
+
+        if (CHECK_FLOAT_CLOSE(output_c, output_opt, out_channels, 1e-4f) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [in: (%d, %d, %d), out: %d]\n"ANSI_COLOR_RESET,
+                   itr, input_wd, input_ht, channels, out_channels);
+            goto global_avg_pool_fc_f32_cleanup;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [in: (%d, %d, %d), out: %d]"ANSI_COLOR_RESET,
+               itr, input_wd, input_ht, channels, out_channels);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+
+    global_avg_pool_fc_f32_cleanup:
+        free(input);
+        free(filter);
+        free(bias);
+        free(pooled);
+        free(output_c);
+        free(output_opt);
+    }
+}
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <inttypes.h>
 #include <malloc.h>
 
 #include <esp_nn.h>
@@ -26,9 +27,9 @@ void esp_nn_relu6_s8_test()
         printf(ANSI_COLOR_RED"%s allocations failed\n"ANSI_COLOR_RESET, __FUNCTION__);
         goto relu6_s8_cleanup;
     }
-    input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-    inout_ansi = (int8_t *) (((uint32_t) inout_c_orig + 15) & ~15);
-    inout_opt = (int8_t *) (((uint32_t) inout_opt_orig + 15) & ~15);
+    input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+    inout_ansi = (int8_t *) (((uintptr_t) inout_c_orig + 15) & ~15);
+    inout_opt = (int8_t *) (((uintptr_t) inout_opt_orig + 15) & ~15);
 
     /* Generate filter data between -128 -> +127 */
     for (int i = 0; i < size; ++i) {
@@ -76,3 +77,36 @@ relu6_s8_cleanup:
         free (inout_opt_orig);
     }
 }
+
+void esp_nn_relu6_s8_unaligned_test()
+{
+    uint32_t total_c = 0, total_opt = 0;
+    int8_t buf_c[64 + 3], buf_opt[64 + 3];
+
+    printf("\n######## Running %s ##########\n", __FUNCTION__);
+    /* every start offset within a word, sizes around the 8 value steps */
+    for (int itr = 0; itr < 16; itr++) {
+        const int offset = itr % 4;
+        const uint16_t size = itr < 4 ? 64 : rand() % 64 + 1;
+        int8_t *inout_ansi = buf_c + offset, *inout_opt = buf_opt + offset;
+        for (int i = 0; i < size; ++i) {
+            inout_ansi[i] = rand() % 256 - 128;
+            inout_opt[i] = inout_ansi[i];
+        }
+
+        profile_c_start();
+        esp_nn_relu6_s8_ansi(inout_ansi, size);
+        total_c = profile_c_end();
+
+        profile_opt_start();
+        esp_nn_relu6_s8(inout_opt, size);
+        total_opt = profile_opt_end();
+
+        if (CHECK_EQUAL(inout_ansi, inout_opt, size) == false) {
+            printf(ANSI_COLOR_RED"[%3d] failed [offset %d, size %"PRIu16"]\n"ANSI_COLOR_RESET, itr, offset, size);
+            return;
+        }
+        printf(ANSI_COLOR_GREEN"[%3d] passed [offset %d, size %"PRIu16"]"ANSI_COLOR_RESET, itr, offset, size);
+        printf("\tcycles: c %8"PRIu32", opt %8"PRIu32"\n", total_c, total_opt);
+    }
+}
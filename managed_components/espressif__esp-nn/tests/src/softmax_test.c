@@ -33,9 +33,9 @@ void esp_nn_softmax_s8_test()
         goto softmax_s8_cleanup;
     }
 
-    input = (int8_t *) (((uint32_t) input_orig + 15) & ~15);
-    out_ansi = (int8_t *) (((uint32_t) out_c_orig + 15) & ~15);
-    out_opt = (int8_t *) (((uint32_t) out_opt_orig + 15) & ~15);
+    input = (int8_t *) (((uintptr_t) input_orig + 15) & ~15);
+    out_ansi = (int8_t *) (((uintptr_t) out_c_orig + 15) & ~15);
+    out_opt = (int8_t *) (((uintptr_t) out_opt_orig + 15) & ~15);
 
     /* Generate input data between -128 -> +127 */
     for (int i = 0; i < size; ++i) {
@@ -53,7 +53,7 @@ void esp_nn_softmax_s8_test()
     int32_t scratch_buf_size = esp_nn_get_softmax_scratch_size(width, height);
     if (scratch_buf_size) {
         scratch_buf_orig = malloc(scratch_buf_size * 4 + 16);
-        scratch_buf = 16 + scratch_buf_orig - ((uint32_t) scratch_buf_orig & 0xf);
+        scratch_buf = 16 + scratch_buf_orig - ((uintptr_t) scratch_buf_orig & 0xf);
         if (scratch_buf == NULL) {
             printf(ANSI_COLOR_RED"%s scratch_buf alloc failed size %"PRIi32"\n"ANSI_COLOR_RESET,
                    __FUNCTION__, scratch_buf_size);
@@ -30,6 +30,10 @@ typedef enum {
 typedef enum {
     JPEG_IMAGE_FORMAT_RGB888 = 0,   /*!< Format RGB888 */
     JPEG_IMAGE_FORMAT_RGB565,       /*!< Format RGB565 */
+    JPEG_IMAGE_FORMAT_RGBX8888,     /*!< Format RGB888 padded to 4 bytes (R, G, B, 0) */
+    JPEG_IMAGE_FORMAT_RGBM8888,     /*!< Format RGB888 with red-mask byte (R, G, B, 0xFF if saturation > 1/4 and hue within 30 deg of red, else 0) */
+    JPEG_IMAGE_FORMAT_RGB888_PLANAR,/*!< Format planar RGB888 (full R plane, then G plane, then B plane) */
+    JPEG_IMAGE_FORMAT_GRAY8,        /*!< Format luma only (8-bit/pix) */
 } esp_jpeg_image_format_t;
 
 /**
@@ -45,18 +49,20 @@ typedef struct esp_jpeg_image_cfg_s {
     esp_jpeg_image_scale_t  out_scale; /*!< Output scale */
 
     struct {
-        uint8_t swap_color_bytes: 1; /*!< Swap first and last color bytes */
+        uint8_t swap_color_bytes: 1; /*!< Swap first and last color bytes (RGB888 and RGB565 only) */
     } flags;
 
     struct {
         void *working_buffer;       /*!< If set to NULL, a working buffer will be allocated in esp_jpeg_decode().
                                          Tjpgd does not use dynamic allocation, se we pass this buffer to Tjpgd that uses it as scratchpad */
         size_t working_buffer_size; /*!< Size of the working buffer. Must be set it working_buffer != NULL.
-                                         Default size is 3.1kB or 65kB if JD_FASTDECODE == 2 */
+                                         Default size is 3.1kB, 3.5kB if JD_FASTDECODE == 1 or 65kB if JD_FASTDECODE == 2.
+                                         RGBX8888, RGBM8888 and RGB888_PLANAR need 1kB more for their MCU output */
     } advanced;
 
     struct {
         uint32_t read;  /*!< Internal count of read bytes */
+        void *band;     /*!< Internal state of band decoding */
     } priv;
 } esp_jpeg_image_cfg_t;
 
@@ -69,21 +75,78 @@ typedef struct esp_jpeg_image_output_s {
     size_t output_len; /*!< Length of the output image in bytes */
 } esp_jpeg_image_output_t;
 
+/**
+ * @brief Band of decoded image rows
+ *
+ * A band is one row of MCUs (8 or 16 rows of pixels divided by the scale) over the full image width.
+ * The last band is shorter if the image height is not a multiple of the MCU height.
+ */
+typedef struct esp_jpeg_band_s {
+    const uint8_t *data;    /*!< First pixel of the band in the output format */
+    uint16_t x;             /*!< Left edge of the band in the output image (always 0) */
+    uint16_t y;             /*!< Top edge of the band in the output image */
+    uint16_t width;         /*!< Width of the band in pixels */
+    uint16_t height;        /*!< Height of the band in pixels */
+    uint32_t stride;        /*!< Distance between two rows in bytes */
+    uint32_t plane_stride;  /*!< Distance between R, G and B planes in bytes (RGB888_PLANAR only, 0 otherwise) */
+} esp_jpeg_band_t;
+
+/**
+ * @brief Band callback
+ *
+ * The band data is valid only during the call, the buffer is reused for the next band.
+ *
+ * @param[in] band:      Decoded band
+ * @param[in] user_data: User data passed to esp_jpeg_decode_bands()
+ *
+ * @return ESP_OK to continue decoding, any other value stops it and is returned by esp_jpeg_decode_bands()
+ */
+typedef esp_err_t (*esp_jpeg_band_cb_t)(const esp_jpeg_band_t *band, void *user_data);
+
 /**
  * @brief Decode JPEG image
  *
  * @note This function is blocking.
+ * @note RGBX8888, RGBM8888, RGB888_PLANAR and GRAY8 are converted straight from YCbCr per MCU.
+ *       They are available only with the external TJpgDec (not ROM) and JPEG_IMAGE_SCALE_0.
  *
  * @param[in]  cfg: Configuration structure
  * @param[out] img: Output image info
  *
  * @return
- *      - ESP_OK            on success
- *      - ESP_ERR_NO_MEM    if there is no memory for allocating main structure
- *      - ESP_FAIL          if there is an error in decoding JPEG
+ *      - ESP_OK                on success
+ *      - ESP_ERR_NO_MEM        if there is no memory for allocating main structure
+ *      - ESP_ERR_NOT_SUPPORTED if the output format is not supported with this configuration
+ *      - ESP_FAIL              if there is an error in decoding JPEG
  */
 esp_err_t esp_jpeg_decode(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img);
 
+/**
+ * @brief Decode JPEG image band by band
+ *
+ * The image is decoded into a buffer for one band only and the callback is called as soon as
+ * every band is complete, from the top of the image to the bottom.
+ * The whole output image is never stored, so it can be analysed while the band is still in cache.
+ *
+ * @note This function is blocking, the callback is called from the calling task.
+ * @note cfg->outbuf is used as band buffer, if it is NULL, the band buffer is allocated in this function.
+ *       The band buffer needs (width / scale) * (MCU height / scale) * color bytes, that is 15kB for QVGA RGB888 image in 4:2:0.
+ *
+ * @param[in]  cfg:       Configuration structure
+ * @param[out] img:       Output image info (output_len is the size of the band buffer)
+ * @param[in]  cb:        Band callback
+ * @param[in]  user_data: User data passed to the callback
+ *
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if cb is NULL
+ *      - ESP_ERR_NO_MEM        if there is no memory for band or working buffer
+ *      - ESP_ERR_NOT_SUPPORTED if the output format is not supported with this configuration
+ *      - ESP_FAIL              if there is an error in decoding JPEG
+ *      - Other                 error returned by the callback
+ */
+esp_err_t esp_jpeg_decode_bands(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img, esp_jpeg_band_cb_t cb, void *user_data);
+
 /**
  * @brief Get information about the JPEG image
  *
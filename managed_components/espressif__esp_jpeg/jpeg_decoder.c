@@ -38,10 +38,15 @@ static const char *TAG = "JPEG";
 
 #if defined(JD_FASTDECODE) && (JD_FASTDECODE == 2)
 #define JPEG_WORK_BUF_SIZE  65472
+#elif defined(JD_FASTDECODE) && (JD_FASTDECODE == 1)
+#define JPEG_WORK_BUF_SIZE  3500    /* 16-bit MCU buffer of a 4:2:0 image does not fit in 3100 bytes */
 #else
 #define JPEG_WORK_BUF_SIZE  3100    /* Recommended buffer size; Independent on the size of the image */
 #endif
 
+/* Separate MCU output buffer taken from the working buffer for 32-bit and planar formats (16x16 pixels, 4 bytes) */
+#define JPEG_OUT_BUF_SIZE   1024
+
 /* If not set JD_FORMAT, it is set in ROM to RGB888, otherwise, it can be set in config */
 #ifndef JD_FORMAT
 #define JD_FORMAT 0
@@ -53,18 +58,28 @@ static const char *TAG = "JPEG";
 #elif  (JD_FORMAT==1)
 #define ESP_JPEG_COLOR_BYTES    2
 #elif  (JD_FORMAT==2)
-#error Grayscale image output format is not supported
 #define ESP_JPEG_COLOR_BYTES    1
 #endif
 
+/* State of band decoding, pointed by cfg->priv.band */
+typedef struct {
+    esp_jpeg_band_cb_t cb;  /* User callback */
+    void *user_data;        /* User data passed to the callback */
+    esp_jpeg_band_t band;   /* Band passed to the callback */
+    esp_err_t ret;          /* Error returned by the callback */
+} jpeg_band_state_t;
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
+static esp_err_t jpeg_decode(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img, jpeg_band_state_t *band);
 static uint8_t jpeg_get_div_by_scale(esp_jpeg_image_scale_t scale);
 static uint8_t jpeg_get_color_bytes(esp_jpeg_image_format_t format);
+static bool jpeg_is_tjpgd_format(esp_jpeg_image_format_t format);
 
 static unsigned int jpeg_decode_in_cb(JDEC *jd, uint8_t *buff, unsigned int nbyte);
 static jpeg_decode_out_t jpeg_decode_out_cb(JDEC *jd, void *bitmap, JRECT *rect);
+static void jpeg_copy_rect(esp_jpeg_image_cfg_t *cfg, JDEC *dec, uint8_t *in, const JRECT *rect, uint8_t *dst, uint32_t top, uint32_t plane);
 static inline uint16_t ldb_word(const void *ptr);
 /*******************************************************************************
 * Public API functions
@@ -72,53 +87,24 @@ static inline uint16_t ldb_word(const void *ptr);
 
 esp_err_t esp_jpeg_decode(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img)
 {
-    esp_err_t ret = ESP_OK;
-    uint8_t *workbuf = NULL;
-    JRESULT res;
-    JDEC JDEC;
-
     assert(cfg != NULL);
     assert(img != NULL);
 
-    const bool allocate_buffer = (cfg->advanced.working_buffer == NULL);
-    const size_t workbuf_size = allocate_buffer ? JPEG_WORK_BUF_SIZE : cfg->advanced.working_buffer_size;
-    if (allocate_buffer) {
-        workbuf = heap_caps_malloc(JPEG_WORK_BUF_SIZE, MALLOC_CAP_DEFAULT);
-        ESP_GOTO_ON_FALSE(workbuf, ESP_ERR_NO_MEM, err, TAG, "no mem for JPEG work buffer");
-    } else {
-        workbuf = cfg->advanced.working_buffer;
-        ESP_RETURN_ON_FALSE(workbuf_size != 0, ESP_ERR_INVALID_ARG, TAG, "Working buffer size not defined!");
-    }
-
-
-    cfg->priv.read = 0;
-
-    /* Prepare image */
-    res = jd_prepare(&JDEC, jpeg_decode_in_cb, workbuf, workbuf_size, cfg);
-    ESP_GOTO_ON_FALSE((res == JDR_OK), ESP_FAIL, err, TAG, "Error in preparing JPEG image! %d", res);
-
-    const uint8_t scale_div       = jpeg_get_div_by_scale(cfg->out_scale);
-    const uint8_t out_color_bytes = jpeg_get_color_bytes(cfg->out_format);
-
-    /* Size of output image */
-    const uint32_t outsize = (JDEC.height / scale_div) * (JDEC.width / scale_div) * out_color_bytes;
-    ESP_GOTO_ON_FALSE((outsize <= cfg->outbuf_size), ESP_ERR_NO_MEM, err, TAG, "Not enough size in output buffer!");
-
-    /* Size of output image */
-    img->height = JDEC.height / scale_div;
-    img->width = JDEC.width / scale_div;
-    img->output_len = outsize;
-
-    /* Decode JPEG */
-    res = jd_decomp(&JDEC, jpeg_decode_out_cb, cfg->out_scale);
-    ESP_GOTO_ON_FALSE((res == JDR_OK), ESP_FAIL, err, TAG, "Error in decoding JPEG image! %d", res);
-
-err:
-    if (workbuf && allocate_buffer) {
-        free(workbuf);
-    }
+    return jpeg_decode(cfg, img, NULL);
+}
 
-    return ret;
+esp_err_t esp_jpeg_decode_bands(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img, esp_jpeg_band_cb_t cb, void *user_data)
+{
+    assert(cfg != NULL);
+    assert(img != NULL);
+    ESP_RETURN_ON_FALSE(cb, ESP_ERR_INVALID_ARG, TAG, "Band callback not defined!");
+
+    jpeg_band_state_t band = {
+        .cb = cb,
+        .user_data = user_data,
+        .ret = ESP_OK,
+    };
+    return jpeg_decode(cfg, img, &band);
 }
 
 esp_err_t esp_jpeg_get_image_info(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img)
@@ -168,6 +154,118 @@ esp_err_t esp_jpeg_get_image_info(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_outp
 * Private API functions
 *******************************************************************************/
 
+static esp_err_t jpeg_decode(esp_jpeg_image_cfg_t *cfg, esp_jpeg_image_output_t *img, jpeg_band_state_t *band)
+{
+    esp_err_t ret = ESP_OK;
+    uint8_t *workbuf = NULL;
+    uint8_t *bandbuf = NULL;
+    JRESULT res;
+    JDEC JDEC;
+
+    const bool tjpgd_format = jpeg_is_tjpgd_format(cfg->out_format);
+#if CONFIG_JD_USE_ROM
+    ESP_RETURN_ON_FALSE(tjpgd_format, ESP_ERR_NOT_SUPPORTED, TAG, "Output format is not supported by ROM decoder!");
+#elif (JD_FORMAT==2)
+    ESP_RETURN_ON_FALSE(tjpgd_format, ESP_ERR_NOT_SUPPORTED, TAG, "Only GRAY8 output is supported by grayscale decoder!");
+#endif
+    ESP_RETURN_ON_FALSE(tjpgd_format || cfg->out_scale == JPEG_IMAGE_SCALE_0, ESP_ERR_NOT_SUPPORTED, TAG, "Output format cannot be scaled!");
+    ESP_RETURN_ON_FALSE(!cfg->flags.swap_color_bytes || cfg->out_format <= JPEG_IMAGE_FORMAT_RGB565, ESP_ERR_NOT_SUPPORTED, TAG, "Output format cannot swap color bytes!");
+
+    const bool allocate_buffer = (cfg->advanced.working_buffer == NULL);
+    const size_t default_size = JPEG_WORK_BUF_SIZE + ((tjpgd_format || cfg->out_format == JPEG_IMAGE_FORMAT_GRAY8) ? 0 : JPEG_OUT_BUF_SIZE);
+    const size_t workbuf_size = allocate_buffer ? default_size : cfg->advanced.working_buffer_size;
+    if (allocate_buffer) {
+        workbuf = heap_caps_malloc(default_size, MALLOC_CAP_DEFAULT);
+        ESP_GOTO_ON_FALSE(workbuf, ESP_ERR_NO_MEM, err, TAG, "no mem for JPEG work buffer");
+    } else {
+        workbuf = cfg->advanced.working_buffer;
+        ESP_RETURN_ON_FALSE(workbuf_size != 0, ESP_ERR_INVALID_ARG, TAG, "Working buffer size not defined!");
+    }
+
+
+    cfg->priv.read = 0;
+    cfg->priv.band = band;
+
+    /* Prepare image */
+    res = jd_prepare(&JDEC, jpeg_decode_in_cb, workbuf, workbuf_size, cfg);
+    ESP_GOTO_ON_FALSE((res == JDR_OK), ESP_FAIL, err, TAG, "Error in preparing JPEG image! %d", res);
+
+    const uint8_t scale_div       = jpeg_get_div_by_scale(cfg->out_scale);
+    const uint8_t out_color_bytes = jpeg_get_color_bytes(cfg->out_format);
+
+    /* Size of output image */
+    img->height = JDEC.height / scale_div;
+    img->width = JDEC.width / scale_div;
+
+    if (band) {
+        /* Output buffer holds one row of MCUs only */
+        const uint32_t band_rows = (JDEC.msy * 8) / scale_div;
+        const uint32_t bandsize = img->width * band_rows * out_color_bytes;
+        if (cfg->outbuf == NULL) {
+            bandbuf = heap_caps_malloc(bandsize, MALLOC_CAP_DEFAULT);
+            ESP_GOTO_ON_FALSE(bandbuf, ESP_ERR_NO_MEM, err, TAG, "no mem for JPEG band buffer");
+            band->band.data = bandbuf;
+        } else {
+            ESP_GOTO_ON_FALSE((bandsize <= cfg->outbuf_size), ESP_ERR_NO_MEM, err, TAG, "Not enough size in output buffer!");
+            band->band.data = cfg->outbuf;
+        }
+        band->band.x = 0;
+        band->band.width = img->width;
+        if (cfg->out_format == JPEG_IMAGE_FORMAT_RGB888_PLANAR) {
+            band->band.stride = img->width;
+            band->band.plane_stride = img->width * band_rows;
+        } else {
+            band->band.stride = img->width * out_color_bytes;
+            band->band.plane_stride = 0;
+        }
+        img->output_len = bandsize;
+    } else {
+        const uint32_t outsize = img->height * img->width * out_color_bytes;
+        ESP_GOTO_ON_FALSE((outsize <= cfg->outbuf_size), ESP_ERR_NO_MEM, err, TAG, "Not enough size in output buffer!");
+        img->output_len = outsize;
+    }
+
+#if !CONFIG_JD_USE_ROM
+    /* Select output layout of TJPGD */
+    switch (cfg->out_format) {
+    case JPEG_IMAGE_FORMAT_RGBX8888:
+        JDEC.outfmt = JD_OUT_RGBX;
+        break;
+    case JPEG_IMAGE_FORMAT_RGBM8888:
+        JDEC.outfmt = JD_OUT_RGBM;
+        break;
+    case JPEG_IMAGE_FORMAT_RGB888_PLANAR:
+        JDEC.outfmt = JD_OUT_PLANAR;
+        break;
+    case JPEG_IMAGE_FORMAT_GRAY8:
+        JDEC.outfmt = tjpgd_format ? JD_OUT_DEFAULT : JD_OUT_GRAY;
+        break;
+    default:
+        JDEC.outfmt = JD_OUT_DEFAULT;
+        break;
+    }
+#endif
+
+    /* Decode JPEG */
+    res = jd_decomp(&JDEC, jpeg_decode_out_cb, cfg->out_scale);
+    if (band && band->ret != ESP_OK) {
+        ret = band->ret;    /* Decoding stopped by the band callback */
+        goto err;
+    }
+    ESP_GOTO_ON_FALSE((res == JDR_OK), ESP_FAIL, err, TAG, "Error in decoding JPEG image! %d", res);
+
+err:
+    cfg->priv.band = NULL;
+    if (workbuf && allocate_buffer) {
+        free(workbuf);
+    }
+    if (bandbuf) {
+        free(bandbuf);
+    }
+
+    return ret;
+}
+
 static unsigned int jpeg_decode_in_cb(JDEC *dec, uint8_t *buff, unsigned int nbyte)
 {
     assert(dec != NULL);
@@ -194,7 +292,6 @@ static unsigned int jpeg_decode_in_cb(JDEC *dec, uint8_t *buff, unsigned int nby
 
 static jpeg_decode_out_t jpeg_decode_out_cb(JDEC *dec, void *bitmap, JRECT *rect)
 {
-    uint16_t color = 0;
     assert(dec != NULL);
 
     esp_jpeg_image_cfg_t *cfg = (esp_jpeg_image_cfg_t *)dec->device;
@@ -202,48 +299,95 @@ static jpeg_decode_out_t jpeg_decode_out_cb(JDEC *dec, void *bitmap, JRECT *rect
     assert(bitmap != NULL);
     assert(rect != NULL);
 
+    jpeg_band_state_t *band = (jpeg_band_state_t *)cfg->priv.band;
+    if (band == NULL) {
+        /* Copy decoded image data to output buffer */
+        const uint8_t scale_div = jpeg_get_div_by_scale(cfg->out_scale);
+        const uint32_t plane = (dec->height / scale_div) * (dec->width / scale_div);
+        jpeg_copy_rect(cfg, dec, (uint8_t *)bitmap, rect, cfg->outbuf, 0, plane);
+        return 1;
+    }
+
+    /* All MCUs of a row have the same top edge, copy the MCU to the band buffer */
+    jpeg_copy_rect(cfg, dec, (uint8_t *)bitmap, rect, (uint8_t *)band->band.data, rect->top, band->band.plane_stride);
+
+    if (rect->right + 1u < band->band.width) {
+        return 1;
+    }
+
+    /* Last MCU of the row, the band is complete */
+    band->band.y = rect->top;
+    band->band.height = rect->bottom - rect->top + 1;
+    band->ret = band->cb(&band->band, band->user_data);
+    return (band->ret == ESP_OK) ? 1 : 0;
+}
+
+/* Copy the decoded rectangle to dst, which holds image rows from top on, planes of RGB888_PLANAR are plane bytes apart */
+static void jpeg_copy_rect(esp_jpeg_image_cfg_t *cfg, JDEC *dec, uint8_t *in, const JRECT *rect, uint8_t *dst, uint32_t top, uint32_t plane)
+{
+    uint16_t color = 0;
     uint8_t scale_div = jpeg_get_div_by_scale(cfg->out_scale);
     uint8_t out_color_bytes = jpeg_get_color_bytes(cfg->out_format);
 
-    /* Copy decoded image data to output buffer */
-    uint8_t *in = (uint8_t *)bitmap;
     uint32_t line = dec->width / scale_div;
-    uint8_t *dst = (uint8_t *)cfg->outbuf;
-    for (int y = rect->top; y <= rect->bottom; y++) {
-        for (int x = rect->left; x <= rect->right; x++) {
-            if ( (JD_FORMAT == 0 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB888) ||
-                    (JD_FORMAT == 1 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB565) ) {
-                /* Output image format is same as set in TJPGD */
+    const uint32_t rect_w = rect->right - rect->left + 1;
+
+    if (cfg->out_format == JPEG_IMAGE_FORMAT_RGB888_PLANAR) {
+        /* The rectangle is stored as R, G and B planes, copy their rows to the image planes */
+        for (int p = 0; p < 3; p++) {
+            for (int y = rect->top; y <= rect->bottom; y++) {
+                memcpy(&dst[p * plane + (y - top) * line + rect->left], in, rect_w);
+                in += rect_w;
+            }
+        }
+        return;
+    }
+
+    if (!cfg->flags.swap_color_bytes &&
+            (!jpeg_is_tjpgd_format(cfg->out_format) || out_color_bytes == ESP_JPEG_COLOR_BYTES)) {
+        /* Output image format is same as produced by TJPGD, copy whole rows */
+        const uint32_t row_bytes = rect_w * out_color_bytes;
+        for (int y = rect->top; y <= rect->bottom; y++) {
+            memcpy(&dst[((y - top) * line + rect->left) * out_color_bytes], in, row_bytes);
+            in += row_bytes;
+        }
+        return;
+    }
+
+    if ( (JD_FORMAT == 0 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB888) ||
+            (JD_FORMAT == 1 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB565) ) {
+        /* Output image format is same as set in TJPGD, only color bytes are swapped */
+        for (int y = rect->top; y <= rect->bottom; y++) {
+            uint8_t *o = &dst[((y - top) * line + rect->left) * out_color_bytes];
+            for (uint32_t x = 0; x < rect_w; x++) {
                 for (int b = 0; b < ESP_JPEG_COLOR_BYTES; b++) {
-                    if (cfg->flags.swap_color_bytes) {
-                        dst[(y * line * out_color_bytes) + x * out_color_bytes + b] = in[out_color_bytes - b - 1];
-                    } else {
-                        dst[(y * line * out_color_bytes) + x * out_color_bytes + b] = in[b];
-                    }
+                    o[b] = in[ESP_JPEG_COLOR_BYTES - b - 1];
                 }
-            } else if (JD_FORMAT == 0 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB565) {
-                /* Output image format is not same as set in TJPGD */
-                /* We need to convert the 3 bytes in `in` to a rgb565 value */
+                o += out_color_bytes;
+                in += ESP_JPEG_COLOR_BYTES;
+            }
+        }
+    } else if (JD_FORMAT == 0 && cfg->out_format == JPEG_IMAGE_FORMAT_RGB565) {
+        /* Output image format is not same as set in TJPGD */
+        /* We need to convert the 3 bytes in `in` to a rgb565 value */
+        const int hi = cfg->flags.swap_color_bytes ? 0 : 1;
+        for (int y = rect->top; y <= rect->bottom; y++) {
+            uint8_t *o = &dst[((y - top) * line + rect->left) * out_color_bytes];
+            for (uint32_t x = 0; x < rect_w; x++) {
                 color = ((in[0] & 0xF8) << 8);
                 color |= ((in[1] & 0xFC) << 3);
                 color |= (in[2] >> 3);
 
-                if (cfg->flags.swap_color_bytes) {
-                    dst[(y * line * out_color_bytes) + (x * out_color_bytes)] = HIBYTE(color);
-                    dst[(y * line * out_color_bytes) + (x * out_color_bytes) + 1] = LOBYTE(color);
-                } else {
-                    dst[(y * line * out_color_bytes) + (x * out_color_bytes) + 1] = HIBYTE(color);
-                    dst[(y * line * out_color_bytes) + (x * out_color_bytes)] = LOBYTE(color);
-                }
-            } else {
-                ESP_LOGE(TAG, "Selected output format is not supported!");
-                assert(0);
+                o[hi] = HIBYTE(color);
+                o[1 - hi] = LOBYTE(color);
+                o += out_color_bytes;
+                in += ESP_JPEG_COLOR_BYTES;
             }
-            in += ESP_JPEG_COLOR_BYTES;
         }
+    } else {
+        ESP_LOGE(TAG, "Selected output format is not supported!");
+        assert(0);
     }
-
-    return 1;
 }
 
 static uint8_t jpeg_get_div_by_scale(esp_jpeg_image_scale_t scale)
@@ -275,11 +419,31 @@ static uint8_t jpeg_get_color_bytes(esp_jpeg_image_format_t format)
     /* RGB565 (16-bit/pix) */
     case JPEG_IMAGE_FORMAT_RGB565:
         return 2;
+    /* RGBX8888 and RGBM8888 (32-bit/pix) */
+    case JPEG_IMAGE_FORMAT_RGBX8888:
+    case JPEG_IMAGE_FORMAT_RGBM8888:
+        return 4;
+    /* Planar RGB888 (24-bit/pix) */
+    case JPEG_IMAGE_FORMAT_RGB888_PLANAR:
+        return 3;
+    /* Luma only (8-bit/pix) */
+    case JPEG_IMAGE_FORMAT_GRAY8:
+        return 1;
     }
 
     return 1;
 }
 
+static bool jpeg_is_tjpgd_format(esp_jpeg_image_format_t format)
+{
+    /* Formats produced by TJPGD according to JD_FORMAT, others are selected in run time */
+#if (JD_FORMAT==2)
+    return format == JPEG_IMAGE_FORMAT_GRAY8;
+#else
+    return format == JPEG_IMAGE_FORMAT_RGB888 || format == JPEG_IMAGE_FORMAT_RGB565;
+#endif
+}
+
 static inline uint16_t ldb_word(const void *ptr)
 {
     const uint8_t *p = (const uint8_t *)ptr;
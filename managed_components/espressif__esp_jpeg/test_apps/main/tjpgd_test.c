@@ -16,6 +16,10 @@
 #include "test_logo_rgb888.h"
 #include "test_usb_camera_2_jpg.h"
 #include "test_usb_camera_2_rgb888.h"
+#if CONFIG_JD_DEFAULT_HUFFMAN
+#include "test_usb_camera_jpg.h"
+#include "test_usb_camera_rgb888.h"
+#endif
 
 #define TESTW 46
 #define TESTH 46
@@ -35,6 +39,8 @@ void esp_jpeg_print_ascii(unsigned char *rgb888, esp_jpeg_image_output_t *outimg
     }
 }
 
+/* The grayscale build only outputs GRAY8, these tests decode to RGB888 */
+#if (CONFIG_JD_FORMAT != 2)
 TEST_CASE("Test JPEG decompression library", "[esp_jpeg]")
 {
     unsigned char *decoded, *p;
@@ -199,9 +205,6 @@ TEST_CASE("Test JPEG decompression library: User defined working buffer", "[esp_
 }
 
 #if CONFIG_JD_DEFAULT_HUFFMAN
-#include "test_usb_camera_jpg.h"
-#include "test_usb_camera_rgb888.h"
-
 /**
  * @brief Test for JPEG decompression without Huffman tables
  *
@@ -325,4 +328,343 @@ TEST_CASE("Test JPEG invalid marker 0xFFFF", "[esp_jpeg]")
 
     free(decoded);
 }
+#endif
+
+#if !CONFIG_JD_USE_ROM && (CONFIG_JD_FASTDECODE >= 1)
+static uint32_t test_crc32(const uint8_t *data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    while (len--) {
+        crc ^= *data++;
+        for (int b = 0; b < 8; b++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+#endif
+
+#if !CONFIG_JD_USE_ROM && (CONFIG_JD_FASTDECODE >= 1) && (CONFIG_JD_FORMAT == 0)
+/**
+ * @brief Bit-exact decoder output test
+ *
+ * The IDCT selects a DC-only fill, a reduced 4x4 transform or the full 8x8
+ * transform depending on the highest non-zero coefficient of each block.
+ * All paths must produce exactly the same pixels as the full transform.
+ * Reference CRC32 values were taken from the decoder output before the
+ * sparse paths were introduced (RGB888, JD_FASTDECODE >= 1), for every
+ * image of the test corpus and every output scale.
+ */
+TEST_CASE("Test JPEG decoder output is bit-exact", "[esp_jpeg]")
+{
+    const struct {
+        const uint8_t *jpg;
+        uint32_t jpg_len;
+        uint32_t crc[4]; /* Indexed by esp_jpeg_image_scale_t */
+    } corpus[] = {
+        {logo_jpg, logo_jpg_len, {0x5E08B2FB, 0xA3A5FC5E, 0x858EACB4, 0xDAC75374}},
+        {camera_2_jpg, camera_2_jpg_len, {0x9634950E, 0x903A49C1, 0x21C65DC8, 0x659A8EAE}},
+#if CONFIG_JD_DEFAULT_HUFFMAN
+        {jpeg_no_huffman, jpeg_no_huffman_len, {0x19945F7C, 0xDEBE58E2, 0x90B4C1E4, 0x091C7B6B}},
+#endif
+    };
+
+    for (int i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++) {
+        for (int scale = JPEG_IMAGE_SCALE_0; scale <= JPEG_IMAGE_SCALE_1_8; scale++) {
+            esp_jpeg_image_cfg_t jpeg_cfg = {
+                .indata = (uint8_t *)corpus[i].jpg,
+                .indata_size = corpus[i].jpg_len,
+                .out_format = JPEG_IMAGE_FORMAT_RGB888,
+                .out_scale = scale,
+            };
+            esp_jpeg_image_output_t outimg;
+            TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_get_image_info(&jpeg_cfg, &outimg));
+
+            unsigned char *decoded = calloc(1, outimg.output_len);
+            TEST_ASSERT_NOT_NULL(decoded);
+            jpeg_cfg.outbuf = decoded;
+            jpeg_cfg.outbuf_size = outimg.output_len;
+
+            TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+            TEST_ASSERT_EQUAL_HEX32(corpus[i].crc[scale], test_crc32(decoded, outimg.output_len));
+            free(decoded);
+        }
+    }
+}
+#endif
+
+#if !CONFIG_JD_USE_ROM && (CONFIG_JD_FORMAT == 0)
+static unsigned char *test_decode_format(esp_jpeg_image_format_t format, esp_jpeg_image_output_t *outimg)
+{
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)logo_jpg,
+        .indata_size = logo_jpg_len,
+        .out_format = format,
+        .out_scale = JPEG_IMAGE_SCALE_0,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_get_image_info(&jpeg_cfg, outimg));
+
+    unsigned char *decoded = malloc(outimg->output_len);
+    TEST_ASSERT_NOT_NULL(decoded);
+    jpeg_cfg.outbuf = decoded;
+    jpeg_cfg.outbuf_size = outimg->output_len;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, outimg));
+    return decoded;
+}
+
+/**
+ * @brief Run-time output formats test
+ *
+ * RGBX8888, RGBM8888 and planar RGB888 are converted straight from YCbCr,
+ * their color components must be identical to the RGB888 output.
+ * The red-mask byte of RGBM8888 must match saturation > 1/4 and hue within
+ * 30 degrees of red computed from the RGB888 output.
+ */
+TEST_CASE("Test JPEG run-time output formats", "[esp_jpeg]")
+{
+    esp_jpeg_image_output_t outimg;
+    unsigned char *rgb = test_decode_format(JPEG_IMAGE_FORMAT_RGB888, &outimg);
+    const int pixels = outimg.width * outimg.height;
+    unsigned char *rgbx = test_decode_format(JPEG_IMAGE_FORMAT_RGBX8888, &outimg);
+    TEST_ASSERT_EQUAL(pixels * 4, outimg.output_len);
+    unsigned char *rgbm = test_decode_format(JPEG_IMAGE_FORMAT_RGBM8888, &outimg);
+    TEST_ASSERT_EQUAL(pixels * 4, outimg.output_len);
+    unsigned char *planar = test_decode_format(JPEG_IMAGE_FORMAT_RGB888_PLANAR, &outimg);
+    TEST_ASSERT_EQUAL(pixels * 3, outimg.output_len);
+    unsigned char *gray = test_decode_format(JPEG_IMAGE_FORMAT_GRAY8, &outimg);
+    TEST_ASSERT_EQUAL(pixels, outimg.output_len);
+
+    int red_pixels = 0;
+    for (int i = 0; i < pixels; i++) {
+        const int r = rgb[i * 3], g = rgb[i * 3 + 1], b = rgb[i * 3 + 2];
+        for (int c = 0; c < 3; c++) {
+            TEST_ASSERT_EQUAL_UINT8(rgb[i * 3 + c], rgbx[i * 4 + c]);
+            TEST_ASSERT_EQUAL_UINT8(rgb[i * 3 + c], rgbm[i * 4 + c]);
+            TEST_ASSERT_EQUAL_UINT8(rgb[i * 3 + c], planar[c * pixels + i]);
+        }
+        TEST_ASSERT_EQUAL_UINT8(0, rgbx[i * 4 + 3]);
+
+        const int min = g < b ? g : b;
+        const bool red = r >= g && r >= b && 4 * (r - min) > r && 2 * abs(g - b) < r - min;
+        TEST_ASSERT_EQUAL_UINT8(red ? 0xFF : 0, rgbm[i * 4 + 3]);
+        red_pixels += red;
+
+        /* Luma is the Y component, R, G and B can't be all above or all below it */
+        TEST_ASSERT_TRUE(gray[i] <= (r > g ? (r > b ? r : b) : (g > b ? g : b)) + 1);
+        TEST_ASSERT_TRUE(gray[i] + 1 >= (r < g ? (r < b ? r : b) : (g < b ? g : b)));
+    }
+    TEST_ASSERT_GREATER_THAN(0, red_pixels);
+
+    /* Run-time formats are not descaled */
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)logo_jpg,
+        .indata_size = logo_jpg_len,
+        .outbuf = rgbx,
+        .outbuf_size = pixels * 4,
+        .out_format = JPEG_IMAGE_FORMAT_RGBX8888,
+        .out_scale = JPEG_IMAGE_SCALE_1_2,
+    };
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, esp_jpeg_decode(&jpeg_cfg, &outimg));
+
+    free(gray);
+    free(planar);
+    free(rgbm);
+    free(rgbx);
+    free(rgb);
+}
+#endif
+
+#if !CONFIG_JD_USE_ROM
+/**
+ * @brief Luma-only decoding test
+ *
+ * Decodes the test images to GRAY8 and compares the result with the luma
+ * (ITU-R BT.601) of the reference RGB888 data converted by an external decoder
+ * (jpg_to_rgb888_hex.py).
+ */
+TEST_CASE("Test JPEG luma-only decoding", "[esp_jpeg]")
+{
+    const int decoded_outsize = 160 * 120;
+    unsigned char *decoded = malloc(decoded_outsize);
+    TEST_ASSERT_NOT_NULL(decoded);
+
+    /* Logo 46x46, reference RGB888 bytes */
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)logo_jpg,
+        .indata_size = logo_jpg_len,
+        .outbuf = decoded,
+        .outbuf_size = decoded_outsize,
+        .out_format = JPEG_IMAGE_FORMAT_GRAY8,
+        .out_scale = JPEG_IMAGE_SCALE_0,
+    };
+    esp_jpeg_image_output_t outimg;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+    TEST_ASSERT_EQUAL(TESTW, outimg.width);
+    TEST_ASSERT_EQUAL(TESTH, outimg.height);
+    TEST_ASSERT_EQUAL(TESTW * TESTH, outimg.output_len);
+
+    for (int x = 0; x < outimg.width * outimg.height; x++) {
+        const unsigned char *o = &logo_rgb888[x * 3];
+        const int luma = (299 * o[0] + 587 * o[1] + 114 * o[2] + 500) / 1000;
+        TEST_ASSERT_UINT8_WITHIN(3, luma, decoded[x]);
+    }
+
+    /* USB camera frame 160x120, reference 0xRRGGBB words */
+    jpeg_cfg.indata = (uint8_t *)camera_2_jpg;
+    jpeg_cfg.indata_size = camera_2_jpg_len;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+    TEST_ASSERT_EQUAL(160, outimg.width);
+    TEST_ASSERT_EQUAL(120, outimg.height);
+
+    /* The reference of this frame differs up to 13 per color near saturated edges, its luma up to 8 */
+    for (int x = 0; x < outimg.width * outimg.height; x++) {
+        const unsigned int o = usb_camera_2_rgb888[x];
+        const int luma = (299 * ((o >> 16) & 0xff) + 587 * ((o >> 8) & 0xff) + 114 * (o & 0xff) + 500) / 1000;
+        TEST_ASSERT_UINT8_WITHIN(8, luma, decoded[x]);
+    }
+
+    free(decoded);
+}
+#endif
+
+#if !CONFIG_JD_USE_ROM && (CONFIG_JD_FASTDECODE >= 1)
+/**
+ * @brief Bit-exact luma-only output test
+ *
+ * The run-time GRAY8 path of the RGB888 build and the JD_FORMAT == 2 build
+ * must decode the same luma. Both are checked against these CRC32 values for
+ * every image of the test corpus, the JD_FORMAT == 2 build at every output
+ * scale and the run-time path, which is not descaled, at JPEG_IMAGE_SCALE_0.
+ */
+TEST_CASE("Test JPEG luma-only output is bit-exact", "[esp_jpeg]")
+{
+    const struct {
+        const uint8_t *jpg;
+        uint32_t jpg_len;
+        uint32_t crc[4]; /* Indexed by esp_jpeg_image_scale_t */
+    } corpus[] = {
+        {logo_jpg, logo_jpg_len, {0xD8C84547, 0x0EAB1EB1, 0xA5536BAE, 0x8F5EACDF}},
+        {camera_2_jpg, camera_2_jpg_len, {0x1E02D083, 0x0B988823, 0xA880588C, 0x53167AD0}},
+#if CONFIG_JD_DEFAULT_HUFFMAN
+        {jpeg_no_huffman, jpeg_no_huffman_len, {0x358B061D, 0xAA7790C7, 0xB61A8D40, 0xC3DE32B6}},
+#endif
+    };
+
+    for (int i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++) {
+        for (int scale = JPEG_IMAGE_SCALE_0; scale <= JPEG_IMAGE_SCALE_1_8; scale++) {
+            esp_jpeg_image_cfg_t jpeg_cfg = {
+                .indata = (uint8_t *)corpus[i].jpg,
+                .indata_size = corpus[i].jpg_len,
+                .out_format = JPEG_IMAGE_FORMAT_GRAY8,
+                .out_scale = scale,
+            };
+            esp_jpeg_image_output_t outimg;
+            TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_get_image_info(&jpeg_cfg, &outimg));
+
+            unsigned char *decoded = calloc(1, outimg.output_len);
+            TEST_ASSERT_NOT_NULL(decoded);
+            jpeg_cfg.outbuf = decoded;
+            jpeg_cfg.outbuf_size = outimg.output_len;
+
+#if (CONFIG_JD_FORMAT != 2)
+            if (scale != JPEG_IMAGE_SCALE_0) {
+                TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, esp_jpeg_decode(&jpeg_cfg, &outimg));
+                free(decoded);
+                continue;
+            }
+#endif
+            TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
+            TEST_ASSERT_EQUAL(outimg.width * outimg.height, outimg.output_len);
+            TEST_ASSERT_EQUAL_HEX32(corpus[i].crc[scale], test_crc32(decoded, outimg.output_len));
+                        free(decoded);
+        }
+    }
+}
+#endif
+
+#if (CONFIG_JD_FORMAT == 0)
+typedef struct {
+    unsigned char *image;   /* Image assembled from the bands */
+    int next_row;           /* Expected top edge of the next band */
+    int bands;              /* Number of received bands */
+    int stop_at;            /* Band after which the decoding is stopped */
+} test_band_ctx_t;
+
+static esp_err_t test_band_cb(const esp_jpeg_band_t *band, void *user_data)
+{
+    test_band_ctx_t *ctx = (test_band_ctx_t *)user_data;
+
+    TEST_ASSERT_EQUAL(0, band->x);
+    TEST_ASSERT_EQUAL(ctx->next_row, band->y);
+    TEST_ASSERT_EQUAL(160, band->width);
+    TEST_ASSERT_EQUAL(160 * 3, band->stride);
+    TEST_ASSERT_EQUAL(0, band->plane_stride);
+    TEST_ASSERT_GREATER_THAN(0, band->height);
+
+    for (int y = 0; y < band->height; y++) {
+        memcpy(&ctx->image[(band->y + y) * band->stride], &band->data[y * band->stride], band->width * 3);
+    }
+    ctx->next_row += band->height;
+    ctx->bands++;
+    return (ctx->bands == ctx->stop_at) ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+/**
+ * @brief Band decoding test
+ *
+ * The image assembled from the bands must be identical to the image decoded at once.
+ * An error returned by the band callback stops the decoding.
+ */
+TEST_CASE("Test JPEG band decoding", "[esp_jpeg]")
+{
+    const int decoded_outsize = 160 * 120 * 3;
+    unsigned char *decoded = malloc(decoded_outsize);
+    unsigned char *assembled = calloc(1, decoded_outsize);
+    TEST_ASSERT_NOT_NULL(decoded);
+    TEST_ASSERT_NOT_NULL(assembled);
+
+    esp_jpeg_image_cfg_t jpeg_cfg = {
+        .indata = (uint8_t *)camera_2_jpg,
+        .indata_size = camera_2_jpg_len,
+        .outbuf = decoded,
+        .outbuf_size = decoded_outsize,
+        .out_format = JPEG_IMAGE_FORMAT_RGB888,
+        .out_scale = JPEG_IMAGE_SCALE_0,
+    };
+    esp_jpeg_image_output_t outimg;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode(&jpeg_cfg, &outimg));
 
+    /* Band buffer allocated by the decoder */
+    test_band_ctx_t ctx = {
+        .image = assembled,
+    };
+    jpeg_cfg.outbuf = NULL;
+    jpeg_cfg.outbuf_size = 0;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, esp_jpeg_decode_bands(&jpeg_cfg, &outimg, NULL, &ctx));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_decode_bands(&jpeg_cfg, &outimg, test_band_cb, &ctx));
+    TEST_ASSERT_EQUAL(160, outimg.width);
+    TEST_ASSERT_EQUAL(120, outimg.height);
+    TEST_ASSERT_EQUAL(120, ctx.next_row);
+    TEST_ASSERT_EQUAL(outimg.output_len, 160 * 3 * (120 / ctx.bands));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(decoded, assembled, decoded_outsize);
+
+    /* Band buffer provided by the user, stopped after the second band */
+    const int bands = ctx.bands;
+    unsigned char *band_buf = malloc(outimg.output_len);
+    TEST_ASSERT_NOT_NULL(band_buf);
+    jpeg_cfg.outbuf = band_buf;
+    jpeg_cfg.outbuf_size = outimg.output_len - 1;
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, esp_jpeg_decode_bands(&jpeg_cfg, &outimg, test_band_cb, &ctx));
+    jpeg_cfg.outbuf_size = outimg.output_len;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.image = assembled;
+    ctx.stop_at = 2;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, esp_jpeg_decode_bands(&jpeg_cfg, &outimg, test_band_cb, &ctx));
+    TEST_ASSERT_EQUAL(2, ctx.bands);
+    TEST_ASSERT_LESS_THAN(bands, ctx.bands);
+
+    free(band_buf);
+    free(assembled);
+    free(decoded);
+}
+#endif
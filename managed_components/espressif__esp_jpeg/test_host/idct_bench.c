@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * The three block paths of mcu_load(): a DC-only fill, block_idct_4x4() for
+ * blocks coded within zig-zag 0..9 and the full block_idct(). The reduced
+ * transform is first checked bit-exact against the full one on random
+ * sparse blocks, then each path is timed per block and every image of the
+ * test_apps corpus is decoded at every scale to RGB888, and to GRAY8 at
+ * full scale as the run-time luma-only layout is not descaled. Host timings compare the paths with
+ * each other rather than predict the device.
+ *
+ * esp_jpeg_idct_bench [--reps N]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* The block transforms are static */
+#include "tjpgd.c"
+
+#include "jpeg_decoder.h"
+#include "test_logo_jpg.h"
+#include "test_usb_camera_jpg.h"
+#include "test_usb_camera_2_jpg.h"
+
+#define BLOCKS 1000
+
+static int32_t blocks[3][BLOCKS][64];
+static volatile int sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* De-quantized blocks with their non-zero coefficients in zig-zag 0..last */
+static void fill_blocks(int32_t block[BLOCKS][64], int last)
+{
+    for (int b = 0; b < BLOCKS; b++) {
+        memset(block[b], 0, sizeof(block[b]));
+        for (int z = 0; z <= last; z++) {
+            block[b][Zig[z]] = rand() % 2001 - 1000;
+        }
+    }
+}
+
+static int check_reduced_idct(void)
+{
+    for (int b = 0; b < BLOCKS; b++) {
+        int32_t src[64];
+        jd_yuv_t full[64], reduced[64];
+        memcpy(src, blocks[1][b], sizeof(src));
+        block_idct(src, full);
+        memcpy(src, blocks[1][b], sizeof(src));
+        block_idct_4x4(src, reduced);
+        if (memcmp(full, reduced, sizeof(full))) {
+            printf("block_idct_4x4 differs from block_idct on block %d\n", b);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void bench_paths(int reps)
+{
+    static const char *names[3] = {"dc fill", "idct 4x4", "idct 8x8"};
+    for (int path = 0; path < 3; path++) {
+        const double start = now_ns();
+        for (int r = 0; r < reps; r++) {
+            for (int b = 0; b < BLOCKS; b++) {
+                int32_t src[64];
+                jd_yuv_t dst[64];
+                memcpy(src, blocks[path][b], sizeof(src));   /* the transforms work in place */
+                if (path == 0) {
+                    const jd_yuv_t d = (jd_yuv_t)((src[0] / 256) + 128);
+                    for (int i = 0; i < 64; dst[i++] = d) ;
+                } else if (path == 1) {
+                    block_idct_4x4(src, dst);
+                } else {
+                    block_idct(src, dst);
+                }
+                sink += dst[9];
+            }
+        }
+        printf("%-10s %6.1f ns/block\n", names[path], (now_ns() - start) / ((double)reps * BLOCKS));
+    }
+}
+
+static void bench_corpus(int reps)
+{
+    const struct {
+        const char *name;
+        const uint8_t *jpg;
+        uint32_t jpg_len;
+    } corpus[] = {
+        {"logo.jpg", logo_jpg, logo_jpg_len},
+        {"usb_camera.jpg", jpeg_no_huffman, jpeg_no_huffman_len},
+        {"usb_camera_2.jpg", camera_2_jpg, camera_2_jpg_len},
+    };
+
+    for (int i = 0; i < sizeof(corpus) / sizeof(corpus[0]); i++) {
+        for (int scale = JPEG_IMAGE_SCALE_0; scale <= JPEG_IMAGE_SCALE_1_8; scale++) {
+            double us[2] = {0, 0};
+            esp_jpeg_image_output_t outimg, rgb_img;
+            for (int gray = 0; gray < (scale == JPEG_IMAGE_SCALE_0 ? 2 : 1); gray++) {
+                esp_jpeg_image_cfg_t jpeg_cfg = {
+                    .indata = (uint8_t *)corpus[i].jpg,
+                    .indata_size = corpus[i].jpg_len,
+                    .out_format = gray ? JPEG_IMAGE_FORMAT_GRAY8 : JPEG_IMAGE_FORMAT_RGB888,
+                    .out_scale = scale,
+                };
+                if (esp_jpeg_get_image_info(&jpeg_cfg, &outimg) != ESP_OK) {
+                    continue;
+                }
+                uint8_t *decoded = malloc(outimg.output_len);
+                jpeg_cfg.outbuf = decoded;
+                jpeg_cfg.outbuf_size = outimg.output_len;
+
+                const double start = now_ns();
+                for (int r = 0; r < reps; r++) {
+                    esp_jpeg_decode(&jpeg_cfg, &outimg);
+                }
+                us[gray] = (now_ns() - start) / reps / 1e3;
+                if (!gray) {
+                    rgb_img = outimg;
+                }
+                free(decoded);
+            }
+            printf("%-17s 1/%d %3dx%-3d RGB888 %8.1f us/frame", corpus[i].name, 1 << scale,
+                   rgb_img.width, rgb_img.height, us[0]);
+            if (us[1] > 0) {
+                printf(", GRAY8 %8.1f us/frame", us[1]);
+            }
+            printf("\n");
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int reps = 200;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--reps") && i + 1 < argc) {
+            reps = atoi(argv[++i]);
+        }
+    }
+
+    srand(1);
+    fill_blocks(blocks[0], 0);
+    fill_blocks(blocks[1], 9);
+    fill_blocks(blocks[2], 63);
+    if (check_reduced_idct()) {
+        return 1;
+    }
+    bench_paths(reps);
+    bench_corpus(reps / 10 + 1);
+    return 0;
+}
@@ -0,0 +1,16 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_DEFAULT  0
+#define MALLOC_CAP_8BIT     0
+#define MALLOC_CAP_INTERNAL 0
+#define MALLOC_CAP_SPIRAM   0
+
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_calloc(n, size, caps) calloc(n, size)
+#define heap_caps_free(ptr) free(ptr)
@@ -0,0 +1,17 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* The configuration of test_apps/sdkconfig.ci, CONFIG_JD_FORMAT and CONFIG_JD_FASTDECODE come from the build */
+#pragma once
+
+#define CONFIG_JD_SZBUF 512
+#ifndef CONFIG_JD_FORMAT
+#define CONFIG_JD_FORMAT 0
+#endif
+#define CONFIG_JD_USE_SCALE 1
+#define CONFIG_JD_TBLCLIP 1
+#ifndef CONFIG_JD_FASTDECODE
+#define CONFIG_JD_FASTDECODE 1
+#endif
+#define CONFIG_JD_DEFAULT_HUFFMAN 1
@@ -0,0 +1,69 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* The assertions of test_apps/main on the host, a failed one jumps out of its test case like Unity's */
+#pragma once
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+extern jmp_buf unity_abort;
+
+typedef void (*unity_test_fn_t)(void);
+void unity_register_test(const char *name, unity_test_fn_t fn);
+
+#define UNITY_FAIL(format, ...) do {                                    \
+        printf("%s:%d: FAIL " format "\n", __FILE__, __LINE__, ##__VA_ARGS__); \
+        longjmp(unity_abort, 1);                                        \
+    } while (0)
+
+#define TEST_ASSERT_TRUE(condition) do {                                \
+        if (!(condition)) {                                             \
+            UNITY_FAIL("%s", #condition);                               \
+        }                                                               \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL(expected, actual) do {                        \
+        const long long expected_ = (long long)(expected);              \
+        const long long actual_ = (long long)(actual);                  \
+        if (expected_ != actual_) {                                     \
+            UNITY_FAIL("expected %lld, was %lld", expected_, actual_);  \
+        }                                                               \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_HEX32(expected, actual) do {                  \
+        const unsigned expected_ = (unsigned)(expected);                \
+        const unsigned actual_ = (unsigned)(actual);                    \
+        if (expected_ != actual_) {                                     \
+            UNITY_FAIL("expected 0x%08X, was 0x%08X", expected_, actual_); \
+        }                                                               \
+    } while (0)
+
+#define TEST_ASSERT_UINT8_WITHIN(delta, expected, actual) do {          \
+        const int expected_ = (unsigned char)(expected);                \
+        const int actual_ = (unsigned char)(actual);                    \
+        if (abs(expected_ - actual_) > (delta)) {                       \
+            UNITY_FAIL("expected %d +-%d, was %d", expected_, (int)(delta), actual_); \
+        }                                                               \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_UINT8(expected, actual) TEST_ASSERT_EQUAL((unsigned char)(expected), (unsigned char)(actual))
+#define TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, actual, n) TEST_ASSERT_TRUE(memcmp((expected), (actual), (n)) == 0)
+#define TEST_ASSERT_NOT_NULL(ptr) TEST_ASSERT_TRUE((ptr) != NULL)
+#define TEST_ASSERT_GREATER_THAN(threshold, actual) TEST_ASSERT_TRUE((actual) > (threshold))
+#define TEST_ASSERT_LESS_THAN(threshold, actual) TEST_ASSERT_TRUE((actual) < (threshold))
+
+#define UNITY_CONCAT2(a, b) a##b
+#define UNITY_CONCAT(a, b) UNITY_CONCAT2(a, b)
+
+/* Registers the test case before main() runs them */
+#define TEST_CASE(name, tags)                                                           \
+    static void UNITY_CONCAT(test_case_, __LINE__)(void);                               \
+    __attribute__((constructor)) static void UNITY_CONCAT(register_test_case_, __LINE__)(void) \
+    {                                                                                   \
+        unity_register_test(name, UNITY_CONCAT(test_case_, __LINE__));                  \
+    }                                                                                   \
+    static void UNITY_CONCAT(test_case_, __LINE__)(void)
@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * Runs every test case of test_apps/main/tjpgd_test.c on the host, the
+ * decoder configuration is the one of stubs/sdkconfig.h and the build.
+ */
+
+#include <stdio.h>
+#include "unity.h"
+
+#define MAX_TESTS 32
+
+jmp_buf unity_abort;
+
+static struct {
+    const char *name;
+    unity_test_fn_t fn;
+} tests[MAX_TESTS];
+static int test_count = 0;
+
+void unity_register_test(const char *name, unity_test_fn_t fn)
+{
+    if (test_count < MAX_TESTS) {
+        tests[test_count].name = name;
+        tests[test_count].fn = fn;
+        test_count++;
+    }
+}
+
+int main(void)
+{
+    int failed = 0;
+    for (int i = 0; i < test_count; i++) {
+        volatile int passed = 0;
+        if (!setjmp(unity_abort)) {
+            tests[i].fn();
+            passed = 1;
+        }
+        printf("%s: %s\n", tests[i].name, passed ? "PASS" : "FAIL");
+        failed += !passed;
+    }
+    printf("%d tests, %d failed\n", test_count, failed);
+    return failed != 0;
+}
@@ -818,6 +818,106 @@ static void block_idct (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Apply Inverse-DCT to a block whose non-zero elements are all in the   */
+/* top-left 4x4 quadrant (same arithmetic as block_idct, zeros folded)   */
+/*-----------------------------------------------------------------------*/
+
+static void block_idct_4x4 (
+    int32_t *src,   /* Input block data (de-quantized and pre-scaled for Arai Algorithm) */
+    jd_yuv_t *dst   /* Pointer to the destination to store the block as byte array */
+)
+{
+    const int32_t M13 = (int32_t)(1.41421 * 4096), M2 = (int32_t)(1.08239 * 4096), M4 = (int32_t)(2.61313 * 4096), M5 = (int32_t)(1.84776 * 4096);
+    int32_t v0, v1, v2, v3, v4, v5, v6, v7;
+    int32_t t10, t11, t12, t13;
+    int i;
+
+    /* Process columns (columns 4..7 are all zero and remain zero) */
+    for (i = 0; i < 4; i++) {
+        t10 = src[8 * 0];   /* Get even elements (rows 4 and 6 are zero) */
+        v1 = src[8 * 2];
+
+        t11 = (v1 * M13 >> 12) - v1;    /* Process the even elements */
+        v0 = t10 + v1;
+        v3 = t10 - v1;
+        v1 = t10 + t11;
+        v2 = t10 - t11;
+
+        t10 = src[8 * 1];   /* Get odd elements (rows 5 and 7 are zero) */
+        t12 = -src[8 * 3];
+
+        v7 = t10 - t12;     /* Process the odd elements */
+        v5 = (t10 + t12) * M13 >> 12;
+        t13 = (t10 + t12) * M5 >> 12;
+        v4 = t13 - (t10 * M2 >> 12);
+        v6 = t13 - (t12 * M4 >> 12) - v7;
+        v5 -= v6;
+        v4 -= v5;
+
+        src[8 * 0] = v0 + v7;   /* Write-back transformed values */
+        src[8 * 7] = v0 - v7;
+        src[8 * 1] = v1 + v6;
+        src[8 * 6] = v1 - v6;
+        src[8 * 2] = v2 + v5;
+        src[8 * 5] = v2 - v5;
+        src[8 * 3] = v3 + v4;
+        src[8 * 4] = v3 - v4;
+
+        src++;  /* Next column */
+    }
+
+    /* Process rows (elements 4..7 of each row are zero) */
+    src -= 4;
+    for (i = 0; i < 8; i++) {
+        t10 = src[0] + (128L << 8); /* Get even elements (remove DC offset (-128) here) */
+        v1 = src[2];
+
+        t11 = (v1 * M13 >> 12) - v1;    /* Process the even elements */
+        v0 = t10 + v1;
+        v3 = t10 - v1;
+        v1 = t10 + t11;
+        v2 = t10 - t11;
+
+        t10 = src[1];               /* Get odd elements */
+        t12 = -src[3];
+
+        v7 = t10 - t12;             /* Process the odd elements */
+        v5 = (t10 + t12) * M13 >> 12;
+        t13 = (t10 + t12) * M5 >> 12;
+        v4 = t13 - (t10 * M2 >> 12);
+        v6 = t13 - (t12 * M4 >> 12) - v7;
+        v5 -= v6;
+        v4 -= v5;
+
+        /* Descale the transformed values 8 bits and output a row */
+#if JD_FASTDECODE >= 1
+        dst[0] = (int16_t)((v0 + v7) >> 8);
+        dst[7] = (int16_t)((v0 - v7) >> 8);
+        dst[1] = (int16_t)((v1 + v6) >> 8);
+        dst[6] = (int16_t)((v1 - v6) >> 8);
+        dst[2] = (int16_t)((v2 + v5) >> 8);
+        dst[5] = (int16_t)((v2 - v5) >> 8);
+        dst[3] = (int16_t)((v3 + v4) >> 8);
+        dst[4] = (int16_t)((v3 - v4) >> 8);
+#else
+        dst[0] = BYTECLIP((v0 + v7) >> 8);
+        dst[7] = BYTECLIP((v0 - v7) >> 8);
+        dst[1] = BYTECLIP((v1 + v6) >> 8);
+        dst[6] = BYTECLIP((v1 - v6) >> 8);
+        dst[2] = BYTECLIP((v2 + v5) >> 8);
+        dst[5] = BYTECLIP((v2 - v5) >> 8);
+        dst[3] = BYTECLIP((v3 + v4) >> 8);
+        dst[4] = BYTECLIP((v3 - v4) >> 8);
+#endif
+
+        dst += 8; src += 8; /* Next row */
+    }
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Load all blocks in an MCU into working buffer                         */
 /*-----------------------------------------------------------------------*/
@@ -828,7 +928,7 @@ static JRESULT mcu_load (
 {
     int32_t *tmp = (int32_t *)jd->workbuf;  /* Block working buffer for de-quantize and IDCT */
     int d, e;
-    unsigned int blk, nby, i, bc, z, id, cmp;
+    unsigned int blk, nby, i, bc, z, zl, id, cmp, idct;
     jd_yuv_t *bp;
     const int32_t *dqf;
 
@@ -844,6 +944,7 @@ static JRESULT mcu_load (
 
         } else {                            /* Load Y/C blocks from input stream */
             id = cmp ? 1 : 0;                       /* Huffman table ID of this component */
+            idct = !cmp || (JD_FORMAT != 2 && jd->outfmt != JD_OUT_GRAY);  /* C blocks are only entropy decoded to advance the stream in grayscale output */
 
             /* Extract a DC element from input stream */
             d = huffext(jd, id, 0);                 /* Extract a huffman coded data (bit length) */
@@ -868,8 +969,11 @@ static JRESULT mcu_load (
             tmp[0] = d * dqf[0] >> 8;               /* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
 
             /* Extract following 63 AC elements from input stream */
-            memset(&tmp[1], 0, 63 * sizeof (int32_t));  /* Initialize all AC elements */
+            if (idct) {
+                memset(&tmp[1], 0, 63 * sizeof (int32_t));  /* Initialize all AC elements */
+            }
             z = 1;      /* Top of the AC elements (in zigzag-order) */
+            zl = 0;     /* Highest non-zero element (in zigzag-order) */
             do {
                 d = huffext(jd, id, 1);             /* Extract a huffman coded value (zero runs and bit length) */
                 if (d == 0) {
@@ -894,10 +998,11 @@ static JRESULT mcu_load (
                     }
                     i = Zig[z];                     /* Get raster-order index */
                     tmp[i] = d * dqf[i] >> 8;       /* De-quantize, apply scale factor of Arai algorithm and descale 8 bits */
+                    zl = z;
                 }
             } while (++z < 64);     /* Next AC element */
 
-            if (JD_FORMAT != 2 || !cmp) {   /* C components may not be processed if in grayscale output */
+            if (idct) {     /* C components are not processed in grayscale output */
                 if (z == 1 || (JD_USE_SCALE && jd->scale == 3)) {   /* If no AC element or scale ratio is 1/8, IDCT can be ommited and the block is filled with DC value */
                     d = (jd_yuv_t)((*tmp / 256) + 128);
                     if (JD_FASTDECODE >= 1) {
@@ -905,6 +1010,8 @@ static JRESULT mcu_load (
                     } else {
                         memset(bp, d, 64);
                     }
+                } else if (zl < 10) {   /* Zigzag elements 0..9 are all in the top-left 4x4 quadrant */
+                    block_idct_4x4(tmp, bp);    /* Apply reduced IDCT and store the block to the MCU buffer */
                 } else {
                     block_idct(tmp, bp);    /* Apply IDCT and store the block to the MCU buffer */
                 }
@@ -920,6 +1027,101 @@ static JRESULT mcu_load (
 
 
 
+/*-----------------------------------------------------------------------*/
+/* Red-mask test: saturation above 1/4 and hue within 30 deg of red      */
+/*-----------------------------------------------------------------------*/
+
+static int is_red (
+    int r, int g, int b  /* RGB value (0..255) */
+)
+{
+    int d;
+
+
+    if (r < g || r < b) {
+        return 0;           /* Hue is not around red if R is not the largest component */
+    }
+    d = r - (g < b ? g : b);    /* Chroma (max - min) */
+    return 4 * d > r && 2 * (g > b ? g - b : b - g) < d;
+}
+
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Convert an MCU straight from YCrCb to the run-time output layout      */
+/*-----------------------------------------------------------------------*/
+
+static void mcu_convert (
+    JDEC *jd,           /* Pointer to the decompressor object */
+    unsigned int rx,    /* Width of the effective rectangular (pixel) */
+    unsigned int ry     /* Height of the effective rectangular (pixel) */
+)
+{
+    const int CVACC = (sizeof (int) > 2) ? 1024 : 128;  /* Adaptive accuracy for both 16-/32-bit systems */
+    unsigned int ix, iy, mx, my;
+    int yy, cb, cr, rc = 0, gc = 0, bc = 0;
+    uint8_t r, g, b, *pix, *pg, *pb;
+    jd_yuv_t *py, *pc;
+
+
+    mx = jd->msx * 8; my = jd->msy * 8;     /* MCU size (pixel) */
+    pix = (uint8_t *)jd->workbuf;
+    pg = pix + rx * ry;                     /* G and B planes for JD_OUT_PLANAR */
+    pb = pg + rx * ry;
+
+    for (iy = 0; iy < ry; iy++) {
+        pc = py = jd->mcubuf;
+        if (my == 16) {     /* Double block height? */
+            pc += 64 * 4 + (iy >> 1) * 8;
+            if (iy >= 8) {
+                py += 64;
+            }
+        } else {            /* Single block height */
+            pc += mx * 8 + iy * 8;
+        }
+        py += iy * 8;
+
+        if (jd->outfmt == JD_OUT_GRAY) {    /* Luma only, C components are not referred */
+            for (ix = 0; ix < rx; ix++) {
+                if (ix == 8) {
+                    py += 64 - 8;   /* Jump to next block if double block width */
+                }
+                *pix++ = BYTECLIP(*py++);
+            }
+            continue;
+        }
+
+        for (ix = 0; ix < rx; ix++) {
+            if (mx == 8 || !(ix & 1)) { /* Chroma terms are shared by pixel pairs if double block width */
+                cb = pc[0] - 128;       /* Get Cb/Cr component and remove offset */
+                cr = pc[64] - 128;
+                pc++;
+                rc = (int)(1.402 * CVACC) * cr / CVACC;
+                gc = ((int)(0.344 * CVACC) * cb + (int)(0.714 * CVACC) * cr) / CVACC;
+                bc = (int)(1.772 * CVACC) * cb / CVACC;
+            }
+            if (ix == 8) {
+                py += 64 - 8;   /* Jump to next block if double block width */
+            }
+            yy = *py++;         /* Get Y component */
+            r = BYTECLIP(yy + rc);
+            g = BYTECLIP(yy - gc);
+            b = BYTECLIP(yy + bc);
+            if (jd->outfmt == JD_OUT_PLANAR) {
+                *pix++ = r; *pg++ = g; *pb++ = b;
+            } else {
+                pix[0] = r; pix[1] = g; pix[2] = b;
+                pix[3] = (jd->outfmt == JD_OUT_RGBM && is_red(r, g, b)) ? 0xFF : 0;
+                pix += 4;
+            }
+        }
+    }
+}
+
+
+
+
 /*-----------------------------------------------------------------------*/
 /* Output an MCU: Convert YCrCb to RGB and output it in RGB form         */
 /*-----------------------------------------------------------------------*/
@@ -952,6 +1154,10 @@ static JRESULT mcu_output (
     rect.left = x; rect.right = x + rx - 1;             /* Rectangular area in the frame buffer */
     rect.top = y; rect.bottom = y + ry - 1;
 
+    if (jd->outfmt != JD_OUT_DEFAULT) {     /* Run-time output layout (never descaled) */
+        mcu_convert(jd, rx, ry);
+        return outfunc(jd, jd->workbuf, &rect) ? JDR_OK : JDR_INTR;
+    }
 
     if (!JD_USE_SCALE || jd->scale != 3) {  /* Not for 1/8 scaling */
         pix = (uint8_t *)jd->workbuf;
@@ -1002,7 +1208,7 @@ static JRESULT mcu_output (
                             py += 64 - 8;    /* Jump to next block if double block height */
                         }
                     }
-                    *pix++ = (uint8_t) * py++;          /* Get and store a Y value as grayscale */
+                    *pix++ = BYTECLIP(*py++);           /* Get and store a Y value as grayscale */
                 }
             }
         }
@@ -1060,7 +1266,7 @@ static JRESULT mcu_output (
                     *pix++ = /*G*/ BYTECLIP(yy - ((int)(0.344 * CVACC) * cb + (int)(0.714 * CVACC) * cr) / CVACC);
                     *pix++ = /*B*/ BYTECLIP(yy + ((int)(1.772 * CVACC) * cb / CVACC));
                 } else {
-                    *pix++ = yy;
+                    *pix++ = BYTECLIP(yy);
                 }
             }
         }
@@ -1364,6 +1570,19 @@ JRESULT jd_decomp (
 
     mx = jd->msx * 8; my = jd->msy * 8;         /* Size of the MCU (pixel) */
 
+    if (jd->outfmt != JD_OUT_DEFAULT) {         /* Run-time output layout? */
+        if (scale || jd->outfmt > JD_OUT_GRAY || (JD_FORMAT == 2 && jd->outfmt != JD_OUT_GRAY)) {
+            return JDR_PAR;     /* Err: not descaled, RGB needs C components */
+        }
+        if (jd->outfmt != JD_OUT_GRAY) {
+            /* 32-bit and planar layouts cannot share the MCU working buffer, give them a separate one */
+            jd->workbuf = alloc_pool(jd, mx * my * 4);
+            if (!jd->workbuf) {
+                return JDR_MEM1;    /* Err: not enough memory */
+            }
+        }
+    }
+
     jd->dcv[2] = jd->dcv[1] = jd->dcv[0] = 0;   /* Initialize DC values */
     rst = rsc = 0;
 
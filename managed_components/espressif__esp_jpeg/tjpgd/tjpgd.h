@@ -43,6 +43,17 @@ typedef enum {
 
 
 
+/* Output pixel layout selected at run time (set JDEC.outfmt after jd_prepare) */
+typedef enum {
+    JD_OUT_DEFAULT = 0, /* Layout given by JD_FORMAT */
+    JD_OUT_RGBX,        /* R, G, B, 0 (32-bit/pix) */
+    JD_OUT_RGBM,        /* R, G, B, red-mask 0x00/0xFF (32-bit/pix) */
+    JD_OUT_PLANAR,      /* R plane, G plane and B plane of the rectangular (24-bit/pix) */
+    JD_OUT_GRAY         /* Y (8-bit/pix) */
+} JOUTFMT;
+
+
+
 /* Rectangular region in the output image */
 typedef struct {
     uint16_t left;      /* Left end */
@@ -61,6 +72,7 @@ struct JDEC {
     uint8_t *inbuf;             /* Bit stream input buffer */
     uint8_t dbit;               /* Number of bits availavble in wreg or reading bit mask */
     uint8_t scale;              /* Output scaling ratio */
+    uint8_t outfmt;             /* Output pixel layout (JOUTFMT) */
     uint8_t msx, msy;           /* MCU size in unit of block (width, height) */
     uint8_t qtid[3];            /* Quantization table ID of each component, Y, Cb, Cr */
     uint8_t ncomp;              /* Number of color components 1:grayscale, 3:color */
@@ -0,0 +1,11 @@
+#include <stdio.h>
+#include "unity.h"
+#include "unity_test_runner.h"
+
+void app_main(void)
+{
+    printf("Running compiled model host tests\n");
+    UNITY_BEGIN();
+    unity_run_all_tests();
+    UNITY_END();
+}
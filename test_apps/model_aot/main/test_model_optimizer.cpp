@@ -0,0 +1,101 @@
+#include <math.h>
+#include <stdio.h>
+#include <memory>
+#include <vector>
+#include "unity.h"
+
+#include "graph_optimizer.h"
+#include "sign_model.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#define TEST_IMAGES 8
+#define ARENA_SIZE (400 * 1024)
+
+struct model_run_t {
+    std::vector<uint8_t> arena;
+    tflite::MicroMutableOpResolver<8> resolver;
+    std::unique_ptr<tflite::MicroInterpreter> interpreter;
+};
+
+static void init_run(model_run_t& run, const uint8_t* flatbuffer)
+{
+    run.arena.resize(ARENA_SIZE);
+    run.resolver.AddConv2D();
+    run.resolver.AddFullyConnected();
+    run.resolver.AddReshape();
+    run.resolver.AddPad();
+    run.resolver.AddTranspose();
+    run.resolver.AddMaxPool2D();
+    run.resolver.AddMean();
+    run.interpreter.reset(new tflite::MicroInterpreter(tflite::GetModel(flatbuffer), run.resolver, run.arena.data(),
+                                                       run.arena.size()));
+    TEST_ASSERT_EQUAL(kTfLiteOk, run.interpreter->AllocateTensors());
+}
+
+TEST_CASE("Optimised sign model has no layout ops and matches the original", "[model_optimizer]")
+{
+    std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(sign_model_tflite);
+    graph_optimizer_options_t options;
+    graph_optimizer_stats_t stats;
+    graph_optimize(*model, options, &stats);
+    TEST_ASSERT_TRUE(stats.removed_transpose > 0);
+    TEST_ASSERT_TRUE(stats.removed_pad > 0);
+
+    flatbuffers::FlatBufferBuilder builder;
+    tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+    // A heap copy starts 16 byte aligned like the array of main/sign_model.cc
+    std::vector<uint8_t> optimised(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize());
+    flatbuffers::Verifier verifier(optimised.data(), optimised.size());
+    TEST_ASSERT_TRUE(tflite::VerifyModelBuffer(verifier));
+
+    const tflite::Model* optimised_model = tflite::GetModel(optimised.data());
+    for (const tflite::Operator* op : *optimised_model->subgraphs()->Get(0)->operators()) {
+        const tflite::BuiltinOperator code =
+            tflite::GetBuiltinCode(optimised_model->operator_codes()->Get(op->opcode_index()));
+        TEST_ASSERT_TRUE(code != tflite::BuiltinOperator_TRANSPOSE);
+        TEST_ASSERT_TRUE(code != tflite::BuiltinOperator_PAD);
+        TEST_ASSERT_TRUE(code != tflite::BuiltinOperator_PADV2);
+    }
+
+    model_run_t original, folded;
+    init_run(original, sign_model_tflite);
+    init_run(folded, optimised.data());
+    // The input Transpose folds into the graph input, NCHW becomes NHWC
+    TfLiteTensor* nchw = original.interpreter->input(0);
+    TfLiteTensor* nhwc = folded.interpreter->input(0);
+    TEST_ASSERT_EQUAL(nchw->dims->data[1], nhwc->dims->data[3]);
+    TEST_ASSERT_EQUAL(nchw->dims->data[2], nhwc->dims->data[1]);
+    TEST_ASSERT_EQUAL(nchw->dims->data[3], nhwc->dims->data[2]);
+    const int channels = nchw->dims->data[1];
+    const int plane = nchw->dims->data[2] * nchw->dims->data[3];
+
+    float max_diff = 0.0f;
+    for (int image = 0; image < TEST_IMAGES; ++image) {
+        uint32_t state = 2654435761u * (image + 1);
+        for (int i = 0; i < plane; ++i) {
+            for (int c = 0; c < channels; ++c) {
+                state = state * 1664525u + 1013904223u;
+                const float v = (state >> 24) / 127.5f - 1.0f;
+                nchw->data.f[c * plane + i] = v;
+                nhwc->data.f[i * channels + c] = v;
+            }
+        }
+        TEST_ASSERT_EQUAL(kTfLiteOk, original.interpreter->Invoke());
+        TEST_ASSERT_EQUAL(kTfLiteOk, folded.interpreter->Invoke());
+
+        const TfLiteTensor* expected = original.interpreter->output(0);
+        const TfLiteTensor* got = folded.interpreter->output(0);
+        TEST_ASSERT_EQUAL(expected->bytes, got->bytes);
+        for (size_t k = 0; k < expected->bytes / sizeof(float); ++k) {
+            // Kernels may sum in another order on the NHWC layout
+            const float tolerance = 1e-5f * fmaxf(1.0f, fabsf(expected->data.f[k]));
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, expected->data.f[k], got->data.f[k]);
+            max_diff = fmaxf(max_diff, fabsf(got->data.f[k] - expected->data.f[k]));
+        }
+    }
+    printf("%d -> %d ops, %d images, max logit difference %g\n", stats.ops_before, stats.ops_after, TEST_IMAGES,
+           max_diff);
+}
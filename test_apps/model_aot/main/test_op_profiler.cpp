@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <vector>
+#include "unity.h"
+
+#include "op_profiler.h"
+#include "sign_model.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+#define ARENA_SIZE (400 * 1024)
+#define PROFILED_INVOKES 3
+
+// Bytes of a float32 or int32 tensor from its shape in the flatbuffer
+static uint32_t model_tensor_bytes(const tflite::SubGraph* subgraph, int index)
+{
+    uint32_t bytes = 4;
+    for (int32_t dim : *subgraph->tensors()->Get(index)->shape()) {
+        bytes *= dim;
+    }
+    return bytes;
+}
+
+TEST_CASE("Operator profiler attributes every Invoke() event to its operator", "[op_profiler]")
+{
+    std::vector<uint8_t> arena(ARENA_SIZE);
+    tflite::MicroMutableOpResolver<8> resolver;
+    resolver.AddConv2D();
+    resolver.AddFullyConnected();
+    resolver.AddReshape();
+    resolver.AddPad();
+    resolver.AddTranspose();
+    resolver.AddMaxPool2D();
+    resolver.AddMean();
+    const tflite::Model* model = tflite::GetModel(sign_model_tflite);
+    tflite::MicroInterpreter interpreter(model, resolver, arena.data(), arena.size(), nullptr,
+                                         op_profiler_instance());
+    TEST_ASSERT_EQUAL(kTfLiteOk, interpreter.AllocateTensors());
+    op_profiler_init(&interpreter, model);
+    op_profiler_reset();
+
+    float* in = interpreter.input(0)->data.f;
+    for (size_t i = 0; i < interpreter.input(0)->bytes / sizeof(float); ++i) {
+        in[i] = (int)(i % 17) / 8.0f - 1.0f;
+    }
+    for (int i = 0; i < PROFILED_INVOKES; ++i) {
+        TEST_ASSERT_EQUAL(kTfLiteOk, op_profiler_invoke(&interpreter));
+    }
+
+    op_profile_t ops[OP_PROFILER_MAX_OPS];
+    op_profiler_summary_t summary;
+    const int count = op_profiler_get(ops, OP_PROFILER_MAX_OPS, &summary);
+    const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+    TEST_ASSERT_EQUAL(subgraph->operators()->size(), count);
+    TEST_ASSERT_EQUAL(count, summary.op_count);
+    TEST_ASSERT_EQUAL(PROFILED_INVOKES, summary.invokes);
+    TEST_ASSERT_EQUAL_STRING("ns", summary.unit);
+
+    uint64_t op_ticks = 0;
+    for (int i = 0; i < count; ++i) {
+        const tflite::Operator* op = subgraph->operators()->Get(i);
+        const tflite::BuiltinOperator code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+        uint32_t input_bytes = 0, weight_bytes = 0, output_bytes = 0;
+        for (int32_t index : *op->inputs()) {
+            const tflite::Buffer* buffer = model->buffers()->Get(subgraph->tensors()->Get(index)->buffer());
+            const bool constant = buffer->data() && buffer->data()->size();
+            (constant ? weight_bytes : input_bytes) += model_tensor_bytes(subgraph, index);
+        }
+        for (int32_t index : *op->outputs()) {
+            output_bytes += model_tensor_bytes(subgraph, index);
+        }
+
+        TEST_ASSERT_EQUAL_STRING(tflite::EnumNameBuiltinOperator(code), ops[i].tag);
+        TEST_ASSERT_EQUAL(PROFILED_INVOKES, ops[i].invocations);
+        TEST_ASSERT_TRUE(ops[i].total_ticks > 0);
+        TEST_ASSERT_TRUE(ops[i].max_ticks > 0 && ops[i].max_ticks <= ops[i].total_ticks);
+        TEST_ASSERT_EQUAL(input_bytes, ops[i].input_bytes);
+        TEST_ASSERT_EQUAL(weight_bytes, ops[i].weight_bytes);
+        TEST_ASSERT_EQUAL(output_bytes, ops[i].output_bytes);
+        op_ticks += ops[i].total_ticks;
+        printf("%2d %-16s %8llu ns, in %6u weights %6u out %6u bytes\n", i, ops[i].tag,
+               (unsigned long long)(ops[i].total_ticks / PROFILED_INVOKES), (unsigned)ops[i].input_bytes,
+               (unsigned)ops[i].weight_bytes, (unsigned)ops[i].output_bytes);
+    }
+    // Invoke() runs every operator plus the interpreter around them
+    TEST_ASSERT_TRUE(summary.invoke_ticks >= op_ticks);
+}
@@ -0,0 +1,134 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "unity.h"
+
+#include "sign_model.h"
+#include "sign_model_aot.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define TEST_IMAGES 16
+#define ARENA_SIZE (400 * 1024)
+#define TIMED_RUNS 20
+
+// Smooth colour gradients with noise, reproducible and closer to camera windows than white noise
+static void make_image(int index, uint8_t* rgb)
+{
+    uint32_t state = 2654435761u * (index + 1);
+    auto next = [&state]() { return (state = state * 1664525u + 1013904223u) >> 24; };
+    int base[3], slope[3];
+    for (int c = 0; c < 3; ++c) {
+        base[c] = next();
+        slope[c] = (int)(next() % 9) - 4;
+    }
+    for (int y = 0; y < SIGN_MODEL_INPUT_HEIGHT; ++y) {
+        for (int x = 0; x < SIGN_MODEL_INPUT_WIDTH; ++x) {
+            for (int c = 0; c < 3; ++c) {
+                const int v = base[c] + slope[c] * (c == 1 ? y - 32 : x - 32) + (int)(next() % 32) - 16;
+                rgb[(y * SIGN_MODEL_INPUT_WIDTH + x) * 3 + c] = v < 0 ? 0 : v > 255 ? 255 : v;
+            }
+        }
+    }
+}
+
+struct reference_t {
+    std::vector<uint8_t> arena;
+    tflite::MicroMutableOpResolver<8> resolver;
+    tflite::MicroInterpreter* interpreter = nullptr;
+};
+
+static void init_reference(reference_t& ref)
+{
+    ref.arena.resize(ARENA_SIZE);
+    ref.resolver.AddConv2D();
+    ref.resolver.AddFullyConnected();
+    ref.resolver.AddReshape();
+    ref.resolver.AddPad();
+    ref.resolver.AddTranspose();
+    ref.resolver.AddMaxPool2D();
+    ref.resolver.AddMean();
+    ref.interpreter = new tflite::MicroInterpreter(tflite::GetModel(sign_model_tflite), ref.resolver,
+                                                   ref.arena.data(), ref.arena.size());
+    TEST_ASSERT_EQUAL(kTfLiteOk, ref.interpreter->AllocateTensors());
+}
+
+// The flatbuffer takes NCHW, the compiled model the HWC window the detector resizes
+static void reference_logits(reference_t& ref, const uint8_t* rgb, float* logits)
+{
+    float* in = ref.interpreter->input(0)->data.f;
+    const int plane = SIGN_MODEL_INPUT_HEIGHT * SIGN_MODEL_INPUT_WIDTH;
+    for (int i = 0; i < plane; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            in[c * plane + i] = (rgb[i * 3 + c] / 255.0f - 0.5f) / 0.5f;
+        }
+    }
+    TEST_ASSERT_EQUAL(kTfLiteOk, ref.interpreter->Invoke());
+    const float* out = ref.interpreter->output(0)->data.f;
+    for (int k = 0; k < SIGN_MODEL_OUTPUTS; ++k) {
+        logits[k] = out[k];
+    }
+}
+
+static int argmax(const float* v)
+{
+    int best = 0;
+    for (int k = 1; k < SIGN_MODEL_OUTPUTS; ++k) {
+        if (v[k] > v[best]) best = k;
+    }
+    return best;
+}
+
+TEST_CASE("Compiled sign model matches TFLite Micro", "[model_aot]")
+{
+    reference_t ref;
+    init_reference(ref);
+    std::vector<uint8_t> arena(sign_model_arena_size());
+    std::vector<uint8_t> rgb(SIGN_MODEL_INPUT_HEIGHT * SIGN_MODEL_INPUT_WIDTH * 3);
+
+    float max_diff = 0.0f;
+    for (int i = 0; i < TEST_IMAGES; ++i) {
+        make_image(i, rgb.data());
+        float expected[SIGN_MODEL_OUTPUTS], got[SIGN_MODEL_OUTPUTS];
+        reference_logits(ref, rgb.data(), expected);
+        sign_model_predict(rgb.data(), got, arena.data());
+        for (int k = 0; k < SIGN_MODEL_OUTPUTS; ++k) {
+            // Float sums in another order, relative to the size of the logit
+            const float tolerance = 1e-4f * fmaxf(1.0f, fabsf(expected[k]));
+            TEST_ASSERT_FLOAT_WITHIN(tolerance, expected[k], got[k]);
+            max_diff = fmaxf(max_diff, fabsf(got[k] - expected[k]));
+        }
+        TEST_ASSERT_EQUAL(argmax(expected), argmax(got));
+    }
+    printf("%d images, max logit difference %g, arena %u bytes\n", TEST_IMAGES, max_diff,
+           (unsigned)sign_model_arena_size());
+    delete ref.interpreter;
+}
+
+TEST_CASE("Compiled sign model time against Invoke", "[model_aot]")
+{
+    reference_t ref;
+    init_reference(ref);
+    std::vector<uint8_t> arena(sign_model_arena_size());
+    std::vector<uint8_t> rgb(SIGN_MODEL_INPUT_HEIGHT * SIGN_MODEL_INPUT_WIDTH * 3);
+    make_image(0, rgb.data());
+    float logits[SIGN_MODEL_OUTPUTS];
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMED_RUNS; ++i) {
+        reference_logits(ref, rgb.data(), logits);
+    }
+    const auto middle = std::chrono::steady_clock::now();
+    for (int i = 0; i < TIMED_RUNS; ++i) {
+        sign_model_predict(rgb.data(), logits, arena.data());
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double invoke_ms = std::chrono::duration<double, std::milli>(middle - start).count() / TIMED_RUNS;
+    const double predict_ms = std::chrono::duration<double, std::milli>(end - middle).count() / TIMED_RUNS;
+    printf("Invoke %.3f ms, predict %.3f ms\n", invoke_ms, predict_ms);
+    delete ref.interpreter;
+}
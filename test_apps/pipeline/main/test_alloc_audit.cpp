@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "esp_heap_caps.h"
+
+#include "alloc_audit.h"
+#include "buffer_pool.h"
+#include "detect_frame.h"
+
+#define WARMUP_FRAMES 2
+#define AUDITED_FRAMES 5
+// Large enough for every CONFIG_JD_FASTDECODE level
+#define JPEG_WORK_SIZE 65472
+
+extern const uint8_t jpeg_start[] asm("_binary_test_inside_jpeg_start");
+extern const uint8_t jpeg_end[] asm("_binary_test_inside_jpeg_end");
+
+static esp_jpeg_image_cfg_t jpeg_config(uint8_t* band, size_t band_size, uint8_t* work, size_t work_size)
+{
+    esp_jpeg_image_cfg_t cfg = {};
+    cfg.indata = (uint8_t*)jpeg_start;
+    cfg.indata_size = jpeg_end - jpeg_start;
+    cfg.outbuf = band;
+    cfg.outbuf_size = band_size;
+    cfg.out_format = JPEG_IMAGE_FORMAT_RGBM8888;
+    cfg.out_scale = JPEG_IMAGE_SCALE_0;
+    cfg.advanced.working_buffer = work;
+    cfg.advanced.working_buffer_size = work_size;
+    return cfg;
+}
+
+TEST_CASE("Allocation audit catches an allocation after warm-up", "[alloc_audit]")
+{
+    // volatile keeps the compiler from eliding the malloc and free pairs
+    void* volatile warmup;
+    void* volatile late;
+    void* volatile other;
+
+    alloc_audit_reset();
+    alloc_audit_set_stage(PIPELINE_STAGE_DECODE);
+    warmup = malloc(16);
+    alloc_audit_arm();
+    late = heap_caps_malloc(32, MALLOC_CAP_DEFAULT);
+    alloc_audit_set_stage(PIPELINE_STAGE_OTHER);
+    other = malloc(64);
+    alloc_audit_frame_done();
+    free(warmup);
+    heap_caps_free(late);
+    free(other);
+
+    alloc_audit_stats_t stats;
+    alloc_audit_get_stats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.count[PIPELINE_STAGE_DECODE]);
+    TEST_ASSERT_EQUAL(48, stats.bytes[PIPELINE_STAGE_DECODE]);
+    TEST_ASSERT_EQUAL(1, stats.violations);
+    TEST_ASSERT_EQUAL(PIPELINE_STAGE_DECODE, stats.violation_stage);
+    TEST_ASSERT_EQUAL(32, stats.violation_size);
+    TEST_ASSERT_EQUAL(1, stats.frames);
+}
+
+TEST_CASE("Frame hot path does not allocate after warm-up", "[alloc_audit]")
+{
+    esp_jpeg_image_cfg_t cfg = jpeg_config(NULL, 0, NULL, 0);
+    esp_jpeg_image_output_t info;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_jpeg_get_image_info(&cfg, &info));
+    const int width = info.width, height = info.height;
+
+    size_t rows_size, stats_size;
+    detect_frame_buffer_sizes(width, height, &rows_size, &stats_size);
+    TEST_ASSERT_EQUAL(ESP_OK, buffer_pool_init(BUFFER_CLASS_BAND, width * 16 * 4, 1, MALLOC_CAP_DEFAULT));
+    TEST_ASSERT_EQUAL(ESP_OK, buffer_pool_init(BUFFER_CLASS_JPEG_WORK, JPEG_WORK_SIZE, 1, MALLOC_CAP_DEFAULT));
+    TEST_ASSERT_EQUAL(ESP_OK, buffer_pool_init(BUFFER_CLASS_FRAME_ROWS, rows_size, 1, MALLOC_CAP_DEFAULT));
+    TEST_ASSERT_EQUAL(ESP_OK, buffer_pool_init(BUFFER_CLASS_FRAME_STATS, stats_size, 1, MALLOC_CAP_DEFAULT));
+    TEST_ASSERT_EQUAL(ESP_OK, buffer_pool_init(BUFFER_CLASS_PATCH, DETECT_INPUT_SIZE * DETECT_INPUT_SIZE * 3, 1,
+                                               MALLOC_CAP_DEFAULT));
+
+    alloc_audit_reset();
+    {
+        buffer_handle_t band = buffer_pool_acquire(BUFFER_CLASS_BAND);
+        buffer_handle_t work = buffer_pool_acquire(BUFFER_CLASS_JPEG_WORK);
+        buffer_handle_t patch = buffer_pool_acquire(BUFFER_CLASS_PATCH);
+        detect_frame_t* frame = detect_frame_create(width, height);
+        TEST_ASSERT_NOT_NULL(frame);
+
+        for (int i = 0; i < WARMUP_FRAMES + AUDITED_FRAMES; ++i) {
+            if (i == WARMUP_FRAMES) {
+                alloc_audit_arm();
+            }
+
+            // Same calls as the pipeline tasks make for every frame
+            alloc_audit_set_stage(PIPELINE_STAGE_DECODE);
+            cfg = jpeg_config(band.data(), band.size(), work.data(), work.size());
+            esp_jpeg_image_output_t out;
+            esp_err_t ret = esp_jpeg_decode_bands(&cfg, &out, detect_frame_band_cb, frame);
+
+            alloc_audit_set_stage(PIPELINE_STAGE_CLASSIFY);
+            int candidates = 0;
+            for (const window_t& win : frame->windows) {
+                if (!is_candidate(win)) continue;
+                resize_window_nearest(frame, win, patch.data());
+                candidates++;
+            }
+            alloc_audit_set_stage(PIPELINE_STAGE_OTHER);
+            alloc_audit_frame_done();
+
+            TEST_ASSERT_EQUAL(ESP_OK, ret);
+            TEST_ASSERT_GREATER_THAN(0, candidates);
+        }
+        detect_frame_delete(frame);
+    }
+
+    alloc_audit_stats_t stats;
+    alloc_audit_get_stats(&stats);
+    printf("Allocations: decode %u (%u B), classify %u (%u B) in %u frames\n",
+           (unsigned)stats.count[PIPELINE_STAGE_DECODE], (unsigned)stats.bytes[PIPELINE_STAGE_DECODE],
+           (unsigned)stats.count[PIPELINE_STAGE_CLASSIFY], (unsigned)stats.bytes[PIPELINE_STAGE_CLASSIFY],
+           (unsigned)stats.frames);
+    TEST_ASSERT_EQUAL(WARMUP_FRAMES + AUDITED_FRAMES, stats.frames);
+    TEST_ASSERT_EQUAL(0, stats.frame_count[PIPELINE_STAGE_DECODE]);
+    TEST_ASSERT_EQUAL(0, stats.frame_count[PIPELINE_STAGE_CLASSIFY]);
+    TEST_ASSERT_EQUAL_MESSAGE(0, stats.violations, "allocation in the frame hot path after warm-up");
+}
@@ -0,0 +1,264 @@
+#include <math.h>
+#include <algorithm>
+#include <stdio.h>
+#include <vector>
+#include "unity.h"
+#include "esp_heap_caps.h"
+
+#include "buffer_pool.h"
+#include "detect_frame.h"
+#include "shared_features.h"
+
+#define CLASSES 6
+// Large enough for every CONFIG_JD_FASTDECODE level
+#define JPEG_WORK_SIZE 65472
+
+extern const uint8_t jpeg_start[] asm("_binary_test_inside_jpeg_start");
+extern const uint8_t jpeg_end[] asm("_binary_test_inside_jpeg_end");
+
+// Layer shapes of the sign model with reproducible weights of a He initialised network
+struct test_net_t {
+    std::vector<float> weights[3], bias[3], fc_weights, fc_bias;
+    sign_net_t net;
+};
+
+static float next_weight(uint32_t& state, float scale)
+{
+    state = state * 1664525u + 1013904223u;
+    return ((state >> 8) / 16777216.0f * 2.0f - 1.0f) * scale;
+}
+
+static void make_net(test_net_t& t)
+{
+    static const int channels[] = {3, 16, 32, 64};
+    uint32_t state = 1;
+    t.net = {};
+    for (int l = 0; l < 3; ++l) {
+        const int fan_in = 9 * channels[l];
+        t.weights[l].resize(channels[l + 1] * fan_in);
+        t.bias[l].resize(channels[l + 1]);
+        for (float& w : t.weights[l]) w = next_weight(state, sqrtf(6.0f / fan_in));
+        for (float& b : t.bias[l]) b = next_weight(state, 0.1f);
+        t.net.layers[l] = {t.weights[l].data(), t.bias[l].data(), channels[l], channels[l + 1], 3, l < 2};
+    }
+    t.net.layer_count = 3;
+    t.fc_weights.resize(CLASSES * 64);
+    t.fc_bias.resize(CLASSES);
+    for (float& w : t.fc_weights) w = next_weight(state, sqrtf(6.0f / 64));
+    for (float& b : t.fc_bias) b = next_weight(state, 0.1f);
+    t.net.fc_weights = t.fc_weights.data();
+    t.net.fc_bias = t.fc_bias.data();
+    t.net.classes = CLASSES;
+}
+
+// Plain convolution of a whole HWC image with zero padding, ReLU and optional 2x2 max pool
+static std::vector<float> reference_layer(const sign_conv_layer_t& layer, const std::vector<float>& in,
+                                          int& width, int& height)
+{
+    const int half = layer.kernel / 2, ci = layer.in_channels, co = layer.out_channels;
+    std::vector<float> out(width * height * co);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            for (int o = 0; o < co; ++o) {
+                float acc = layer.bias[o];
+                for (int ky = 0; ky < layer.kernel; ++ky) {
+                    for (int kx = 0; kx < layer.kernel; ++kx) {
+                        const int iy = y + ky - half, ix = x + kx - half;
+                        if (iy < 0 || iy >= height || ix < 0 || ix >= width) continue;
+                        for (int i = 0; i < ci; ++i) {
+                            acc += in[(iy * width + ix) * ci + i] *
+                                   layer.weights[((o * layer.kernel + ky) * layer.kernel + kx) * ci + i];
+                        }
+                    }
+                }
+                out[(y * width + x) * co + o] = acc > 0.0f ? acc : 0.0f;
+            }
+        }
+    }
+    if (!layer.pool) return out;
+
+    std::vector<float> pooled((width / 2) * (height / 2) * co);
+    for (int y = 0; y < height / 2; ++y) {
+        for (int x = 0; x < width / 2; ++x) {
+            for (int o = 0; o < co; ++o) {
+                float m = out[((2 * y) * width + 2 * x) * co + o];
+                m = fmaxf(m, out[((2 * y) * width + 2 * x + 1) * co + o]);
+                m = fmaxf(m, out[((2 * y + 1) * width + 2 * x) * co + o]);
+                m = fmaxf(m, out[((2 * y + 1) * width + 2 * x + 1) * co + o]);
+                pooled[(y * (width / 2) + x) * co + o] = m;
+            }
+        }
+    }
+    width /= 2;
+    height /= 2;
+    return pooled;
+}
+
+// What detect_in_frame() computes for one window: resize, normalise, the whole network on 64x64
+static void reference_window(const sign_net_t& net, const detect_frame_t* frame, const window_t& win, float* logits)
+{
+    std::vector<uint8_t> patch(DETECT_INPUT_SIZE * DETECT_INPUT_SIZE * 3);
+    resize_window_nearest(frame, win, patch.data());
+    std::vector<float> x(patch.size());
+    for (size_t i = 0; i < patch.size(); ++i) {
+        x[i] = (patch[i] / 255.0f - 0.5f) / 0.5f;
+    }
+    int width = DETECT_INPUT_SIZE, height = DETECT_INPUT_SIZE;
+    for (int l = 0; l < net.layer_count; ++l) {
+        x = reference_layer(net.layers[l], x, width, height);
+    }
+    const int channels = net.layers[net.layer_count - 1].out_channels;
+    for (int k = 0; k < net.classes; ++k) {
+        float acc = 0.0f;
+        for (int c = 0; c < channels; ++c) {
+            float mean = 0.0f;
+            for (int i = 0; i < width * height; ++i) mean += x[i * channels + c];
+            acc += mean / (width * height) * net.fc_weights[k * channels + c];
+        }
+        logits[k] = acc + net.fc_bias[k];
+    }
+}
+
+static detect_frame_t* decode_test_frame(std::vector<uint8_t>& band, std::vector<uint8_t>& work)
+{
+    esp_jpeg_image_cfg_t cfg = {};
+    cfg.indata = (uint8_t*)jpeg_start;
+    cfg.indata_size = jpeg_end - jpeg_start;
+    esp_jpeg_image_output_t info;
+    if (esp_jpeg_get_image_info(&cfg, &info) != ESP_OK) return NULL;
+
+    size_t rows_size, stats_size;
+    detect_frame_buffer_sizes(info.width, info.height, &rows_size, &stats_size);
+    buffer_pool_deinit(BUFFER_CLASS_FRAME_ROWS);
+    buffer_pool_deinit(BUFFER_CLASS_FRAME_STATS);
+    if (buffer_pool_init(BUFFER_CLASS_FRAME_ROWS, rows_size, 1, MALLOC_CAP_DEFAULT) != ESP_OK ||
+        buffer_pool_init(BUFFER_CLASS_FRAME_STATS, stats_size, 1, MALLOC_CAP_DEFAULT) != ESP_OK) {
+        return NULL;
+    }
+    detect_frame_t* frame = detect_frame_create(info.width, info.height);
+    if (!frame) return NULL;
+
+    band.resize(info.width * 16 * 4);
+    work.resize(JPEG_WORK_SIZE);
+    cfg.outbuf = band.data();
+    cfg.outbuf_size = band.size();
+    cfg.out_format = JPEG_IMAGE_FORMAT_RGBM8888;
+    cfg.out_scale = JPEG_IMAGE_SCALE_0;
+    cfg.advanced.working_buffer = work.data();
+    cfg.advanced.working_buffer_size = work.size();
+    if (esp_jpeg_decode_bands(&cfg, &info, detect_frame_band_cb, frame) != ESP_OK) {
+        detect_frame_delete(frame);
+        return NULL;
+    }
+    return frame;
+}
+
+TEST_CASE("Shared features classify every window of the pyramid", "[shared_features]")
+{
+    test_net_t t;
+    make_net(t);
+    std::vector<uint8_t> band, work;
+    detect_frame_t* frame = decode_test_frame(band, work);
+    TEST_ASSERT_NOT_NULL(frame);
+
+    std::vector<uint8_t> workspace(shared_features_workspace_size(t.net, frame->windows));
+    TEST_ASSERT_GREATER_THAN(0, workspace.size());
+    printf("Workspace %u bytes for %u windows\n", (unsigned)workspace.size(), (unsigned)frame->windows.size());
+
+    int classified = 0, levels = 0, same_class = 0;
+    float max_diff = 0.0f, single_window_diff = 0.0f;
+    for (int first = 0; first < (int)frame->windows.size(); ++levels) {
+        const float* logits;
+        const int count = shared_features_classify_level(t.net, frame, first, workspace.data(), workspace.size(),
+                                                         &logits);
+        TEST_ASSERT_GREATER_THAN(0, count);
+        for (int w = 0; w < count; ++w) {
+            float expected[CLASSES];
+            reference_window(t.net, frame, frame->windows[first + w], expected);
+            const float* got = logits + w * CLASSES;
+            int expected_class = 0, got_class = 0;
+            for (int k = 0; k < CLASSES; ++k) {
+                const float diff = fabsf(got[k] - expected[k]);
+                max_diff = fmaxf(max_diff, diff);
+                if (count == 1) single_window_diff = fmaxf(single_window_diff, diff);
+                if (expected[k] > expected[expected_class]) expected_class = k;
+                if (got[k] > got[got_class]) got_class = k;
+            }
+            same_class += expected_class == got_class;
+        }
+        classified += count;
+        first += count;
+    }
+    printf("%d levels, %d windows, same class %d, max logit difference %f\n", levels, classified, same_class,
+           max_diff);
+
+    TEST_ASSERT_EQUAL(frame->windows.size(), classified);
+    // A level of one window is the window itself, the zero padding is the same
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, single_window_diff);
+    // Elsewhere the border cells see the neighbouring image instead of the padding, the test image measures
+    // 58 of 59 windows with the same class and logits within 0.29
+    TEST_ASSERT_GREATER_OR_EQUAL(classified * 9 / 10, same_class);
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 0.0f, max_diff);
+
+    detect_frame_delete(frame);
+}
+
+TEST_CASE("Shared features match the whole level convolved at once", "[shared_features]")
+{
+    test_net_t t;
+    make_net(t);
+    std::vector<uint8_t> band, work;
+    detect_frame_t* frame = decode_test_frame(band, work);
+    TEST_ASSERT_NOT_NULL(frame);
+    std::vector<uint8_t> workspace(shared_features_workspace_size(t.net, frame->windows));
+
+    // The last level has the most windows, 32 level pixels apart
+    const int size = frame->windows.back().size;
+    int first = frame->windows.size() - 1;
+    while (first > 0 && frame->windows[first - 1].size == size) --first;
+    const float* logits;
+    const int count = shared_features_classify_level(t.net, frame, first, workspace.data(), workspace.size(),
+                                                     &logits);
+    TEST_ASSERT_EQUAL((int)frame->windows.size() - first, count);
+
+    // Level image sampled like the windows, then every layer over all of it
+    int x1 = 0, y1 = 0;
+    for (int w = first; w < first + count; ++w) {
+        x1 = std::max<int>(x1, frame->windows[w].x);
+        y1 = std::max<int>(y1, frame->windows[w].y);
+    }
+    int width = x1 * DETECT_INPUT_SIZE / size + DETECT_INPUT_SIZE;
+    int height = y1 * DETECT_INPUT_SIZE / size + DETECT_INPUT_SIZE;
+    std::vector<float> x(width * height * 3);
+    for (int v = 0; v < height; ++v) {
+        const uint8_t* row = &frame->rows[frame->row_slot[v * size / DETECT_INPUT_SIZE] * frame->width * 3];
+        for (int u = 0; u < width; ++u) {
+            for (int c = 0; c < 3; ++c) {
+                x[(v * width + u) * 3 + c] = (row[(u * size / DETECT_INPUT_SIZE) * 3 + c] / 255.0f - 0.5f) / 0.5f;
+            }
+        }
+    }
+    for (int l = 0; l < t.net.layer_count; ++l) {
+        x = reference_layer(t.net.layers[l], x, width, height);
+    }
+
+    float max_diff = 0.0f;
+    for (int w = 0; w < count; ++w) {
+        const window_t& win = frame->windows[first + w];
+        const int cx = win.x * DETECT_INPUT_SIZE / size / 4, cy = win.y * DETECT_INPUT_SIZE / size / 4;
+        for (int k = 0; k < CLASSES; ++k) {
+            float acc = 0.0f;
+            for (int c = 0; c < 64; ++c) {
+                float sum = 0.0f;
+                for (int j = cy; j < cy + 16; ++j) {
+                    for (int i = cx; i < cx + 16; ++i) sum += x[(j * width + i) * 64 + c];
+                }
+                acc += sum / 256.0f * t.net.fc_weights[k * 64 + c];
+            }
+            max_diff = fmaxf(max_diff, fabsf(logits[w * CLASSES + k] - (acc + t.net.fc_bias[k])));
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(1e-4f, 0.0f, max_diff);
+
+    detect_frame_delete(frame);
+}
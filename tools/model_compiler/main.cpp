@@ -0,0 +1,83 @@
+// Host tool that compiles a TFLite model into a C++ predict() function
+//   model_compiler <in.tflite> <out_dir> [--name <prefix>] [--mean <m>] [--std <s>] [--no-winograd]
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "model_compiler.h"
+
+static bool read_file(const char* path, std::vector<uint8_t>* data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    data->assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool write_file(const std::string& path, const std::string& text) {
+    std::ofstream file(path, std::ios::binary);
+    file << text;
+    return static_cast<bool>(file);
+}
+
+static void usage(const char* program) {
+    fprintf(stderr, "usage: %s <in.tflite> <out_dir> [--name <prefix>] [--mean <m>] [--std <s>] [--no-winograd]\n", program);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char* in_path = argv[1];
+    const std::string out_dir = argv[2];
+    model_compiler_options_t options;
+    for (int i = 3; i < argc; ++i) {
+        if (!strcmp(argv[i], "--name") && i + 1 < argc) {
+            options.name = argv[++i];
+        } else if (!strcmp(argv[i], "--mean") && i + 1 < argc) {
+            options.input_mean = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--std") && i + 1 < argc) {
+            options.input_std = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--no-winograd")) {
+            options.winograd = false;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> data;
+    if (!read_file(in_path, &data)) {
+        fprintf(stderr, "Failed to read %s\n", in_path);
+        return 1;
+    }
+    flatbuffers::Verifier verifier(data.data(), data.size());
+    if (!tflite::VerifyModelBuffer(verifier)) {
+        fprintf(stderr, "%s is not a TFLite model\n", in_path);
+        return 1;
+    }
+
+    std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(data.data());
+    printf("%s\n", in_path);
+    std::string header, source, error;
+    model_compiler_stats_t stats;
+    if (!model_compile(*model, options, &header, &source, &stats, &error)) {
+        fprintf(stderr, "Cannot compile %s: %s\n", in_path, error.c_str());
+        return 1;
+    }
+
+    const std::string header_path = out_dir + "/" + options.name + "_aot.h";
+    const std::string source_path = out_dir + "/" + options.name + "_aot.cc";
+    if (!write_file(header_path, header) || !write_file(source_path, source)) {
+        fprintf(stderr, "Failed to write %s\n", source_path.c_str());
+        return 1;
+    }
+    printf("%d kernels, %zu bytes of constants, %zu bytes of activations\n", stats.kernels, stats.weight_bytes,
+           stats.arena_bytes);
+    printf("Wrote %s and %s\n", header_path.c_str(), source_path.c_str());
+    return 0;
+}
@@ -0,0 +1,886 @@
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <string>
+#include <vector>
+#include "esp_nn.h"
+#include "model_compiler.h"
+#include "../model_optimizer/graph_optimizer.h"
+
+#define ARENA_ALIGN 16
+#define VALUES_PER_LINE 8
+
+using tflite::BuiltinOperator;
+
+// A tensor the generated code writes, Reshapes alias their input
+struct value_t {
+    int tensor;
+    size_t bytes;
+    int first, last;  // steps that write and last read it, the input is written at -1
+    size_t offset;
+};
+
+struct compiler_t {
+    tflite::ModelT& model;
+    tflite::SubGraphT& subgraph;
+    const model_compiler_options_t& options;
+    model_compiler_stats_t& stats;
+    std::string* error;
+
+    std::vector<int> alias;       // tensor -> tensor holding its data
+    std::vector<bool> folded;     // ops with no kernel of their own
+    std::vector<int> pooled;      // op -> max pool fused into it, -1 if none
+    std::vector<int> classifier;  // mean op -> fully connected fused into it, -1 if none
+    int rgb_conv = -1;            // float convolution reading the pixels with the normalisation folded, -1 if none
+    int input = -1;               // tensor the pixel table fills
+    int logits = -1;              // tensor predict() returns as float logits
+    std::vector<value_t> values;
+    std::string constants, body;
+    bool needs_scratch = false;
+    std::string scratch_sizes;
+};
+
+static std::string format(const char* fmt, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    return buffer;
+}
+
+static bool fail(compiler_t& c, const std::string& message) {
+    *c.error = message;
+    return false;
+}
+
+static BuiltinOperator op_code(const compiler_t& c, const tflite::OperatorT& op) {
+    const tflite::OperatorCodeT& code = *c.model.operator_codes[op.opcode_index];
+    return static_cast<BuiltinOperator>(std::max(static_cast<int32_t>(code.builtin_code),
+                                                 static_cast<int32_t>(code.deprecated_builtin_code)));
+}
+
+static tflite::TensorT& tensor(const compiler_t& c, int index) {
+    return *c.subgraph.tensors[index];
+}
+
+static const std::vector<uint8_t>& const_data(const compiler_t& c, int index) {
+    return c.model.buffers[tensor(c, index).buffer]->data;
+}
+
+static bool is_const(const compiler_t& c, int index) {
+    return index >= 0 && !const_data(c, index).empty();
+}
+
+static int elements(const tflite::TensorT& t) {
+    int n = 1;
+    for (int32_t dim : t.shape) n *= dim;
+    return n;
+}
+
+static size_t element_size(tflite::TensorType type) {
+    return type == tflite::TensorType_FLOAT32 || type == tflite::TensorType_INT32 ? 4 : 1;
+}
+
+static float scale(const tflite::TensorT& t, int channel = 0) {
+    return t.quantization && (int)t.quantization->scale.size() > channel ? t.quantization->scale[channel] : 0.0f;
+}
+
+static int32_t zero_point(const tflite::TensorT& t) {
+    return t.quantization && !t.quantization->zero_point.empty() ? t.quantization->zero_point[0] : 0;
+}
+
+static bool quantized(const tflite::TensorT& t) {
+    return t.type == tflite::TensorType_INT8 && t.quantization && !t.quantization->scale.empty();
+}
+
+// Same rounding as TFLite Micro's QuantizeMultiplier, shift is positive to the left
+static void quantize_multiplier(double multiplier, int32_t* mult, int32_t* shift) {
+    if (multiplier == 0.0) {
+        *mult = 0;
+        *shift = 0;
+        return;
+    }
+    int exponent;
+    const double q = frexp(multiplier, &exponent);
+    int64_t fixed = static_cast<int64_t>(round(q * (1ll << 31)));
+    if (fixed == (1ll << 31)) {
+        fixed /= 2;
+        ++exponent;
+    }
+    if (exponent < -31) {
+        exponent = 0;
+        fixed = 0;
+    }
+    *mult = static_cast<int32_t>(fixed);
+    *shift = exponent;
+}
+
+static std::string float_literal(float value) {
+    std::string s = format("%.9g", value);
+    if (s.find_first_of(".e") == std::string::npos) s += ".0";
+    return s + "f";
+}
+
+static std::string symbol(int tensor_index) {
+    return format("tensor_%d", tensor_index);
+}
+
+static std::string upper(const std::string& s) {
+    std::string out = s;
+    for (char& ch : out) ch = toupper(static_cast<unsigned char>(ch));
+    return out;
+}
+
+template <typename T>
+static void emit_array(compiler_t& c, const char* type, const std::string& name, const std::vector<T>& values,
+                       std::string (*literal)(T)) {
+    c.constants += format("alignas(16) static const %s %s[%d] = {\n", type, name.c_str(), (int)values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (i % VALUES_PER_LINE == 0) c.constants += "    ";
+        c.constants += literal(values[i]);
+        c.constants += i + 1 == values.size() ? "\n" : (i % VALUES_PER_LINE == VALUES_PER_LINE - 1 ? ",\n" : ", ");
+    }
+    c.constants += "};\n\n";
+    c.stats.weight_bytes += values.size() * sizeof(T);
+}
+
+static std::string int_literal(int32_t value) {
+    return format("%d", (int)value);
+}
+
+static std::string int16_literal(int16_t value) {
+    return format("%d", (int)value);
+}
+
+static std::string int8_literal(int8_t value) {
+    return format("%d", (int)value);
+}
+
+// Checked data of a constant tensor
+static bool constant_data(compiler_t& c, int index, tflite::TensorType type, const std::vector<uint8_t>** data) {
+    const tflite::TensorT& t = tensor(c, index);
+    if (t.type != type) {
+        return fail(c, format("%s has type %d, %d expected", t.name.c_str(), (int)t.type, (int)type));
+    }
+    *data = &const_data(c, index);
+    if ((*data)->size() != elements(t) * element_size(type)) {
+        return fail(c, format("%s has %zu bytes of data", t.name.c_str(), (*data)->size()));
+    }
+    return true;
+}
+
+static bool float_constant(compiler_t& c, int index, std::vector<float>* values) {
+    const std::vector<uint8_t>* data;
+    if (!constant_data(c, index, tflite::TensorType_FLOAT32, &data)) return false;
+    values->resize(data->size() / sizeof(float));
+    memcpy(values->data(), data->data(), data->size());
+    for (float v : *values) {
+        if (!isfinite(v)) return fail(c, tensor(c, index).name + " is not finite");
+    }
+    return true;
+}
+
+// Constant input of an operator as an array of the generated source, emitted once
+static bool emit_constant(compiler_t& c, int index, tflite::TensorType type) {
+    const std::string name = symbol(index);
+    if (c.constants.find(" " + name + "[") != std::string::npos) return true;
+
+    if (type == tflite::TensorType_FLOAT32) {
+        std::vector<float> values;
+        if (!float_constant(c, index, &values)) return false;
+        emit_array(c, "float", name, values, float_literal);
+        return true;
+    }
+    const std::vector<uint8_t>* data;
+    if (!constant_data(c, index, type, &data)) return false;
+    if (type == tflite::TensorType_INT32) {
+        std::vector<int32_t> values(data->size() / sizeof(int32_t));
+        memcpy(values.data(), data->data(), data->size());
+        emit_array(c, "int32_t", name, values, int_literal);
+    } else {
+        std::vector<int8_t> values(data->begin(), data->end());
+        emit_array(c, "int8_t", name, values, int8_literal);
+    }
+    return true;
+}
+
+static bool float_activation(compiler_t& c, tflite::ActivationFunctionType act, std::string* range) {
+    switch (act) {
+        case tflite::ActivationFunctionType_NONE:
+            *range = "-FLT_MAX, FLT_MAX";
+            return true;
+        case tflite::ActivationFunctionType_RELU:
+            *range = "0.0f, FLT_MAX";
+            return true;
+        case tflite::ActivationFunctionType_RELU6:
+            *range = "0.0f, 6.0f";
+            return true;
+        case tflite::ActivationFunctionType_RELU_N1_TO_1:
+            *range = "-1.0f, 1.0f";
+            return true;
+        default:
+            return fail(c, format("no kernel for fused activation %d", (int)act));
+    }
+}
+
+// Clamp of the quantized output, as TFLite Micro's CalculateActivationRangeQuantized
+static bool int8_activation(compiler_t& c, tflite::ActivationFunctionType act, const tflite::TensorT& out,
+                            std::string* range) {
+    const float s = scale(out);
+    const int32_t zp = zero_point(out);
+    auto quantize = [s, zp](float x) { return zp + static_cast<int32_t>(round(x / s)); };
+    int32_t lo = -128, hi = 127;
+    switch (act) {
+        case tflite::ActivationFunctionType_NONE:
+            break;
+        case tflite::ActivationFunctionType_RELU:
+            lo = std::max(lo, quantize(0.0f));
+            break;
+        case tflite::ActivationFunctionType_RELU6:
+            lo = std::max(lo, quantize(0.0f));
+            hi = std::min(hi, quantize(6.0f));
+            break;
+        case tflite::ActivationFunctionType_RELU_N1_TO_1:
+            lo = std::max(lo, quantize(-1.0f));
+            hi = std::min(hi, quantize(1.0f));
+            break;
+        default:
+            return fail(c, format("no kernel for fused activation %d", (int)act));
+    }
+    *range = format("%d, %d", (int)lo, (int)hi);
+    return true;
+}
+
+static int same_padding(int in, int out, int filter, int stride) {
+    return std::max((out - 1) * stride + filter - in, 0) / 2;
+}
+
+// Arena pointer of a tensor inside predict()
+static std::string ref(const compiler_t& c, int index) {
+    const int t = c.alias[index];
+    if (t == c.logits && tensor(c, t).type == tflite::TensorType_FLOAT32) return "logits";
+    return format("t%d", t);
+}
+
+static bool check_nhwc(compiler_t& c, const tflite::TensorT& t) {
+    if (t.shape.size() != 4 || t.shape[0] != 1) {
+        return fail(c, t.name + " is not a single NHWC image");
+    }
+    return true;
+}
+
+// Output size, filter, stride and padding of a max pool, the template arguments after its input shape
+static bool max_pool_params(compiler_t& c, const tflite::OperatorT& op, std::string* params) {
+    const tflite::Pool2DOptionsT* options = op.builtin_options.AsPool2DOptions();
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    if (!options || !check_nhwc(c, in) || !check_nhwc(c, out) || in.shape[3] != out.shape[3]) {
+        return fail(c, "MAX_POOL_2D " + out.name + " has no options or changes the channels");
+    }
+    const int h = in.shape[1], w = in.shape[2], oh = out.shape[1], ow = out.shape[2];
+    const int fh = options->filter_height, fw = options->filter_width;
+    const int sh = options->stride_h, sw = options->stride_w;
+    const bool same = options->padding == tflite::Padding_SAME;
+    const int ph = same ? same_padding(h, oh, fh, sh) : 0, pw = same ? same_padding(w, ow, fw, sw) : 0;
+    *params = format("%d, %d, %d, %d, %d, %d, %d, %d", oh, ow, fh, fw, sh, sw, ph, pw);
+    return true;
+}
+
+// Max pool keeps the quantization of its input
+static bool max_pool_int8_activation(compiler_t& c, const tflite::OperatorT& op, std::string* range) {
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    if (!quantized(in) || !quantized(out) || scale(in) != scale(out) || zero_point(in) != zero_point(out)) {
+        return fail(c, "MAX_POOL_2D " + out.name + " requantizes");
+    }
+    return int8_activation(c, op.builtin_options.AsPool2DOptions()->fused_activation_function, out, range);
+}
+
+// Winograd filters of an int8 convolution esp-nn runs as F(2x2, 3x3), transformed here once instead of at
+// every predict(). Leaves transform empty for shapes it does not take or when the option is off
+static bool winograd_filter(compiler_t& c, const tflite::OperatorT& op, const tflite::OperatorT* pool,
+                            const data_dims_t& in_dims, const data_dims_t& filter_dims, const data_dims_t& out_dims,
+                            const conv_params_t& conv_params, std::vector<int16_t>* transform) {
+    transform->clear();
+    if (!c.options.winograd) return true;
+    pool_params_t pool_params = {};
+    if (pool) {
+        const tflite::Pool2DOptionsT* options = pool->builtin_options.AsPool2DOptions();
+        const tflite::TensorT& pooled = tensor(c, pool->outputs[0]);
+        const bool same = options->padding == tflite::Padding_SAME;
+        pool_params.filter = {options->filter_width, options->filter_height};
+        pool_params.stride = {options->stride_w, options->stride_h};
+        pool_params.padding = {same ? same_padding(out_dims.width, pooled.shape[2], options->filter_width,
+                                                   options->stride_w) : 0,
+                               same ? same_padding(out_dims.height, pooled.shape[1], options->filter_height,
+                                                   options->stride_h) : 0};
+    }
+    if (!esp_nn_conv_winograd_s8_supported(&in_dims, &filter_dims, &conv_params, pool ? &pool_params : nullptr)) {
+        return true;
+    }
+    const std::vector<uint8_t>* data;
+    if (!constant_data(c, op.inputs[1], tflite::TensorType_INT8, &data)) return false;
+    transform->resize(esp_nn_get_conv_winograd_filter_size(&in_dims, &out_dims) / sizeof(int16_t));
+    esp_nn_conv_winograd_filter_s8(&in_dims, &out_dims, reinterpret_cast<const int8_t*>(data->data()),
+                                   transform->data());
+    return true;
+}
+
+// Float convolution of the 8 bit pixels. A pixel p stands for a * p + b, so the filter becomes w * a, the
+// bias gains b times the filter sum and the zero padding is the pixel -b / a
+static bool emit_rgb_conv(compiler_t& c, const tflite::OperatorT& op, int step, const std::string& shape,
+                          const std::string& range) {
+    const int bias = op.inputs.size() > 2 ? op.inputs[2] : -1;
+    const int o = tensor(c, op.outputs[0]).shape[3];
+    std::vector<float> weights, biases(o, 0.0f);
+    if (!float_constant(c, op.inputs[1], &weights) || (bias >= 0 && !float_constant(c, bias, &biases))) {
+        return false;
+    }
+
+    const double a = 1.0 / (255.0 * c.options.input_std), b = -c.options.input_mean / c.options.input_std;
+    const int per_out = weights.size() / o;
+    std::vector<float> folded(weights.size());
+    for (int k = 0; k < o; ++k) {
+        double sum = 0.0;
+        for (int i = k * per_out; i < (k + 1) * per_out; ++i) {
+            folded[i] = static_cast<float>(weights[i] * a);
+            sum += weights[i];
+        }
+        biases[k] = static_cast<float>(biases[k] + b * sum);
+    }
+    const std::string name = format("conv_%d", step);
+    emit_array(c, "float", name + "_filter", folded, float_literal);
+    emit_array(c, "float", name + "_bias", biases, float_literal);
+    c.body += format("    aot_conv_rgb_f32<%s>(rgb, %s_filter, %s_bias, %s, %s, %s);\n", shape.c_str(), name.c_str(),
+                     name.c_str(), ref(c, op.outputs[0]).c_str(), float_literal(-b / a).c_str(), range.c_str());
+    return true;
+}
+
+static bool emit_conv(compiler_t& c, const tflite::OperatorT& op, int step) {
+    const tflite::Conv2DOptionsT* options = op.builtin_options.AsConv2DOptions();
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& filter = tensor(c, op.inputs[1]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    const int bias = op.inputs.size() > 2 ? op.inputs[2] : -1;
+    if (!options || !check_nhwc(c, in) || !check_nhwc(c, out) || filter.shape.size() != 4 ||
+        !is_const(c, op.inputs[1]) || (bias >= 0 && !is_const(c, bias))) {
+        return fail(c, "CONV_2D " + out.name + " is not a 2D convolution with constant filters");
+    }
+    if (options->dilation_h_factor != 1 || options->dilation_w_factor != 1 || filter.shape[3] != in.shape[3]) {
+        return fail(c, "CONV_2D " + out.name + " is dilated or grouped");
+    }
+
+    const int h = in.shape[1], w = in.shape[2], ch = in.shape[3];
+    const int oh = out.shape[1], ow = out.shape[2], o = out.shape[3];
+    const int kh = filter.shape[1], kw = filter.shape[2];
+    const int sh = options->stride_h, sw = options->stride_w;
+    const bool same = options->padding == tflite::Padding_SAME;
+    const int ph = same ? same_padding(h, oh, kh, sh) : 0, pw = same ? same_padding(w, ow, kw, sw) : 0;
+    const std::string shape = format("%d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d", h, w, ch, oh, ow, o, kh, kw,
+                                     sh, sw, ph, pw);
+    const std::string bias_ref = bias >= 0 ? symbol(bias) : "nullptr";
+    c.body += format("    // CONV_2D %dx%dx%d -> %dx%dx%d, %dx%d filter\n", h, w, ch, oh, ow, o, kh, kw);
+
+    std::string range;
+    if (in.type == tflite::TensorType_FLOAT32 && out.type == tflite::TensorType_FLOAT32) {
+        if (!float_activation(c, options->fused_activation_function, &range)) return false;
+        if (step == c.rgb_conv) return emit_rgb_conv(c, op, step, shape, range);
+        if (!emit_constant(c, op.inputs[1], tflite::TensorType_FLOAT32) ||
+            (bias >= 0 && !emit_constant(c, bias, tflite::TensorType_FLOAT32))) {
+            return false;
+        }
+        c.body += format("    aot_conv_f32<%s>(%s, %s, %s, %s, %s);\n", shape.c_str(), ref(c, op.inputs[0]).c_str(),
+                         symbol(op.inputs[1]).c_str(), bias_ref.c_str(), ref(c, op.outputs[0]).c_str(),
+                         range.c_str());
+        return true;
+    }
+
+    if (!quantized(in) || !quantized(out) || !quantized(filter) || zero_point(filter) != 0) {
+        return fail(c, "CONV_2D " + out.name + " is neither float nor int8 with symmetric filters");
+    }
+    const tflite::OperatorT* pool = c.pooled[step] >= 0 ? c.subgraph.operators[c.pooled[step]].get() : nullptr;
+    std::string pool_params, pool_range;
+    if ((pool && (!max_pool_params(c, *pool, &pool_params) || !max_pool_int8_activation(c, *pool, &pool_range))) ||
+        (bias >= 0 && !emit_constant(c, bias, tflite::TensorType_INT32)) ||
+        !int8_activation(c, options->fused_activation_function, out, &range)) {
+        return false;
+    }
+    const std::string name = format("conv_%d", step);
+    const data_dims_t in_dims = {w, h, ch, 1}, filter_dims = {kw, kh, ch, o}, out_dims = {ow, oh, o, 1};
+    const conv_params_t conv_params = {0, 0, {sw, sh}, {pw, ph}, {1, 1}, {-128, 127}};
+    std::vector<int16_t> transform;
+    if (!winograd_filter(c, op, pool, in_dims, filter_dims, out_dims, conv_params, &transform)) return false;
+    if (transform.empty() && !emit_constant(c, op.inputs[1], tflite::TensorType_INT8)) return false;
+    if (!transform.empty()) emit_array(c, "int16_t", name + "_winograd", transform, int16_literal);
+
+    // Per channel multipliers, a per tensor filter scale applies to every channel
+    std::vector<int32_t> mult(o), shift(o);
+    const bool per_channel = filter.quantization->scale.size() > 1;
+    for (int k = 0; k < o; ++k) {
+        const double effective = static_cast<double>(scale(in)) * scale(filter, per_channel ? k : 0) / scale(out);
+        quantize_multiplier(effective, &mult[k], &shift[k]);
+    }
+    emit_array(c, "int32_t", name + "_mult", mult, int_literal);
+    emit_array(c, "int32_t", name + "_shift", shift, int_literal);
+    const std::string in_ref = ref(c, op.inputs[0]);
+    const std::string filter_ref = transform.empty() ? symbol(op.inputs[1]) : name + "_winograd";
+    const char* kernel = transform.empty() ? "aot_conv" : "aot_conv_winograd";
+
+    if (pool) {
+        const tflite::TensorT& pooled = tensor(c, pool->outputs[0]);
+        c.body += format("    // MAX_POOL_2D fused -> %dx%dx%d\n", pooled.shape[1], pooled.shape[2], o);
+        c.body += format("    %s_max_pool_s8<%s, %s>(%s, %s, %s, %s, %d, %d, %s_mult, %s_shift, %s, %s", kernel,
+                         shape.c_str(), pool_params.c_str(), in_ref.c_str(), filter_ref.c_str(), bias_ref.c_str(),
+                         ref(c, pool->outputs[0]).c_str(), (int)-zero_point(in), (int)zero_point(out), name.c_str(),
+                         name.c_str(), range.c_str(), pool_range.c_str());
+    } else {
+        c.body += format("    %s_s8<%s>(%s, %s, %s, %s, %d, %d, %s_mult, %s_shift, %s", kernel, shape.c_str(),
+                         in_ref.c_str(), filter_ref.c_str(), bias_ref.c_str(), ref(c, op.outputs[0]).c_str(),
+                         (int)-zero_point(in), (int)zero_point(out), name.c_str(), name.c_str(), range.c_str());
+    }
+    // The direct fused kernel needs no scratch
+    if (pool && transform.empty()) {
+        c.body += ");\n";
+        return true;
+    }
+    c.body += ", scratch);\n";
+    c.scratch_sizes += format("    scratch = std::max(scratch, %s_s8_scratch_size<%s>());\n", kernel, shape.c_str());
+    c.needs_scratch = true;
+    return true;
+}
+
+static bool emit_max_pool(compiler_t& c, const tflite::OperatorT& op) {
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    std::string params;
+    if (!max_pool_params(c, op, &params)) return false;
+    const int h = in.shape[1], w = in.shape[2], ch = in.shape[3];
+    const std::string shape = format("%d, %d, %d, %s", h, w, ch, params.c_str());
+    c.body += format("    // MAX_POOL_2D %dx%dx%d -> %dx%dx%d\n", h, w, ch, out.shape[1], out.shape[2], ch);
+
+    std::string range;
+    if (in.type == tflite::TensorType_FLOAT32 && out.type == tflite::TensorType_FLOAT32) {
+        const tflite::Pool2DOptionsT* options = op.builtin_options.AsPool2DOptions();
+        if (!float_activation(c, options->fused_activation_function, &range)) return false;
+        c.body += format("    aot_max_pool_f32<%s>(%s, %s, %s);\n", shape.c_str(), ref(c, op.inputs[0]).c_str(),
+                         ref(c, op.outputs[0]).c_str(), range.c_str());
+        return true;
+    }
+    if (!max_pool_int8_activation(c, op, &range)) return false;
+    c.body += format("    aot_max_pool_s8<%s>(%s, %s, %s);\n", shape.c_str(), ref(c, op.inputs[0]).c_str(),
+                     ref(c, op.outputs[0]).c_str(), range.c_str());
+    return true;
+}
+
+// Only the spatial mean of an NHWC tensor, the global average pooling of classifiers. n is the positions, ch
+// the channels
+static bool mean_shape(compiler_t& c, const tflite::OperatorT& op, int* n, int* ch) {
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    const tflite::TensorT& axes_tensor = tensor(c, op.inputs[1]);
+    const std::vector<uint8_t>& data = const_data(c, op.inputs[1]);
+    std::vector<int32_t> axes;
+    if (axes_tensor.type == tflite::TensorType_INT32) {
+        axes.resize(data.size() / sizeof(int32_t));
+        memcpy(axes.data(), data.data(), axes.size() * sizeof(int32_t));
+    }
+    for (int32_t& axis : axes) {
+        if (axis < 0) axis += 4;
+    }
+    std::sort(axes.begin(), axes.end());
+    if (!check_nhwc(c, in) || axes != std::vector<int32_t>{1, 2} || elements(out) != in.shape[3]) {
+        return fail(c, "MEAN " + out.name + " is not over the height and width of NHWC");
+    }
+    *n = in.shape[1] * in.shape[2];
+    *ch = in.shape[3];
+    c.body += format("    // MEAN %dx%dx%d -> %d\n", in.shape[1], in.shape[2], *ch, *ch);
+    return true;
+}
+
+// Offsets and multiplier of an int8 mean, the arguments after its tensors
+static bool mean_int8_params(compiler_t& c, const tflite::OperatorT& op, std::string* params) {
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    if (!quantized(in) || !quantized(out)) return fail(c, "MEAN " + out.name + " is neither float nor int8");
+    int32_t mult, shift;
+    quantize_multiplier(static_cast<double>(scale(in)) / scale(out), &mult, &shift);
+    *params = format("%d, %d, %d, %d", (int)-zero_point(in), (int)zero_point(out), (int)mult, (int)shift);
+    return true;
+}
+
+static bool emit_fully_connected(compiler_t& c, const tflite::OperatorT& op, const tflite::OperatorT* mean);
+
+static bool emit_mean(compiler_t& c, const tflite::OperatorT& op, int step) {
+    if (c.classifier[step] >= 0) return emit_fully_connected(c, *c.subgraph.operators[c.classifier[step]], &op);
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    int n, ch;
+    if (!mean_shape(c, op, &n, &ch)) return false;
+
+    if (in.type == tflite::TensorType_FLOAT32 && out.type == tflite::TensorType_FLOAT32) {
+        c.body += format("    aot_mean_f32<%d, %d>(%s, %s);\n", n, ch, ref(c, op.inputs[0]).c_str(),
+                         ref(c, op.outputs[0]).c_str());
+        return true;
+    }
+    std::string params;
+    if (!mean_int8_params(c, op, &params)) return false;
+    c.body += format("    aot_mean_s8<%d, %d>(%s, %s, %s);\n", n, ch, ref(c, op.inputs[0]).c_str(),
+                     ref(c, op.outputs[0]).c_str(), params.c_str());
+    return true;
+}
+
+// mean is the Mean fused into the fully connected, the call then reads the Mean's input
+static bool emit_fully_connected(compiler_t& c, const tflite::OperatorT& op, const tflite::OperatorT* mean) {
+    const tflite::FullyConnectedOptionsT* options = op.builtin_options.AsFullyConnectedOptions();
+    const tflite::TensorT& in = tensor(c, op.inputs[0]);
+    const tflite::TensorT& weights = tensor(c, op.inputs[1]);
+    const tflite::TensorT& out = tensor(c, op.outputs[0]);
+    const int bias = op.inputs.size() > 2 ? op.inputs[2] : -1;
+    if (!options || weights.shape.size() != 2 || !is_const(c, op.inputs[1]) || (bias >= 0 && !is_const(c, bias)) ||
+        elements(in) != weights.shape[1] || elements(out) != weights.shape[0]) {
+        return fail(c, "FULLY_CONNECTED " + out.name + " is not one input row times constant weights");
+    }
+    const int inputs = weights.shape[1], outputs = weights.shape[0];
+    const std::string bias_ref = bias >= 0 ? symbol(bias) : "nullptr";
+    int n = 0, ch = 0;
+    if (mean && !mean_shape(c, *mean, &n, &ch)) return false;
+    const std::string in_ref = ref(c, mean ? mean->inputs[0] : op.inputs[0]);
+    const char* kernel = mean ? "aot_mean_fully_connected" : "aot_fully_connected";
+    const std::string shape = mean ? format("%d, %d, %d", n, inputs, outputs) : format("%d, %d", inputs, outputs);
+    c.body += format(mean ? "    // FULLY_CONNECTED fused -> %d\n" : "    // FULLY_CONNECTED %d -> %d\n",
+                     mean ? outputs : inputs, outputs);
+
+    std::string range;
+    if (in.type == tflite::TensorType_FLOAT32 && out.type == tflite::TensorType_FLOAT32) {
+        if (!emit_constant(c, op.inputs[1], tflite::TensorType_FLOAT32) ||
+            (bias >= 0 && !emit_constant(c, bias, tflite::TensorType_FLOAT32)) ||
+            !float_activation(c, options->fused_activation_function, &range)) {
+            return false;
+        }
+        c.body += format("    %s_f32<%s>(%s, %s, %s, %s, %s);\n", kernel, shape.c_str(), in_ref.c_str(),
+                         symbol(op.inputs[1]).c_str(), bias_ref.c_str(), ref(c, op.outputs[0]).c_str(),
+                         range.c_str());
+        return true;
+    }
+
+    if (!quantized(in) || !quantized(out) || !quantized(weights) || weights.quantization->scale.size() > 1) {
+        return fail(c, "FULLY_CONNECTED " + out.name + " is neither float nor int8 with per tensor weights");
+    }
+    std::string mean_params;
+    if (!emit_constant(c, op.inputs[1], tflite::TensorType_INT8) ||
+        (bias >= 0 && !emit_constant(c, bias, tflite::TensorType_INT32)) ||
+        !int8_activation(c, options->fused_activation_function, out, &range) ||
+        (mean && !mean_int8_params(c, *mean, &mean_params))) {
+        return false;
+    }
+    int32_t mult, shift;
+    quantize_multiplier(static_cast<double>(scale(in)) * scale(weights) / scale(out), &mult, &shift);
+    // The fused call takes the mean's offsets and multiplier, its output zero point is the input offset
+    const std::string in_params = mean ? mean_params : format("%d", (int)-zero_point(in));
+    c.body += format("    %s_s8<%s>(%s, %s, %s, %s, %s, %d, %d, %d, %d, %s);\n", kernel, shape.c_str(),
+                     in_ref.c_str(), symbol(op.inputs[1]).c_str(), bias_ref.c_str(), ref(c, op.outputs[0]).c_str(),
+                     in_params.c_str(), (int)-zero_point(weights), (int)zero_point(out), (int)mult, (int)shift,
+                     range.c_str());
+    return true;
+}
+
+// Quantize and Dequantize at the edges of the graph fold into the input table and the logits, Reshapes
+// only rename their input
+static bool fold_edges(compiler_t& c) {
+    const int n = c.subgraph.operators.size();
+    c.alias.resize(c.subgraph.tensors.size());
+    for (size_t t = 0; t < c.alias.size(); ++t) c.alias[t] = t;
+    c.folded.assign(n, false);
+    c.input = c.subgraph.inputs[0];
+    c.logits = c.subgraph.outputs[0];
+
+    for (int i = 0; i < n; ++i) {
+        const tflite::OperatorT& op = *c.subgraph.operators[i];
+        const BuiltinOperator code = op_code(c, op);
+        const bool edge_in = op.inputs[0] == c.input, edge_out = op.outputs[0] == c.logits;
+        if (code == tflite::BuiltinOperator_QUANTIZE && edge_in && !edge_out) {
+            c.input = op.outputs[0];
+            c.folded[i] = true;
+        } else if ((code == tflite::BuiltinOperator_QUANTIZE || code == tflite::BuiltinOperator_DEQUANTIZE) &&
+                   edge_out && !edge_in) {
+            c.logits = op.inputs[0];
+            c.folded[i] = true;
+        } else if (code == tflite::BuiltinOperator_RESHAPE) {
+            c.alias[op.outputs[0]] = c.alias[op.inputs[0]];
+            c.folded[i] = true;
+        }
+    }
+    // A Reshape of the logits makes them the tensor it reshapes
+    c.logits = c.alias[c.logits];
+    if (c.alias[c.input] != c.input) return fail(c, "the model input is reshaped before use");
+
+    const tflite::TensorT& in = tensor(c, c.input);
+    const tflite::TensorT& logits = tensor(c, c.logits);
+    if (!check_nhwc(c, in)) return false;
+    if (in.type != tflite::TensorType_FLOAT32 && !quantized(in)) {
+        return fail(c, "the model input is neither float nor int8");
+    }
+    if (logits.type != tflite::TensorType_FLOAT32 && !quantized(logits)) {
+        return fail(c, "the model output is neither float nor int8");
+    }
+    return true;
+}
+
+// Operator reading a tensor if it has exactly one reader, -1 otherwise
+static int only_reader(const compiler_t& c, int t) {
+    int reader = -1, readers = 0;
+    for (size_t j = 0; j < c.subgraph.operators.size(); ++j) {
+        const std::vector<int32_t>& inputs = c.subgraph.operators[j]->inputs;
+        if (std::find(inputs.begin(), inputs.end(), t) != inputs.end()) {
+            reader = j;
+            readers++;
+        }
+    }
+    return readers == 1 ? reader : -1;
+}
+
+// An int8 convolution read only by a max pool computes the pooled values directly, its full resolution output
+// is never written
+static void fuse_max_pools(compiler_t& c) {
+    const int n = c.subgraph.operators.size();
+    c.pooled.assign(n, -1);
+    for (int i = 0; i < n; ++i) {
+        const tflite::OperatorT& op = *c.subgraph.operators[i];
+        const int out = op.outputs[0];
+        if (c.folded[i] || op_code(c, op) != tflite::BuiltinOperator_CONV_2D || !quantized(tensor(c, out)) ||
+            c.alias[out] == c.logits) {
+            continue;
+        }
+        const int reader = only_reader(c, out);
+        if (reader >= 0 && op_code(c, *c.subgraph.operators[reader]) == tflite::BuiltinOperator_MAX_POOL_2D &&
+            !c.folded[reader]) {
+            c.pooled[i] = reader;
+            c.folded[reader] = true;
+        }
+    }
+}
+
+// A Mean read only by a fully connected, directly or through a Reshape, runs with it as the classifier head:
+// the means stay on the stack of the kernel
+static void fuse_classifier(compiler_t& c) {
+    const int n = c.subgraph.operators.size();
+    c.classifier.assign(n, -1);
+    for (int i = 0; i < n; ++i) {
+        const tflite::OperatorT& op = *c.subgraph.operators[i];
+        if (c.folded[i] || op_code(c, op) != tflite::BuiltinOperator_MEAN || c.alias[op.outputs[0]] == c.logits) {
+            continue;
+        }
+        int reader = only_reader(c, op.outputs[0]);
+        if (reader >= 0 && op_code(c, *c.subgraph.operators[reader]) == tflite::BuiltinOperator_RESHAPE) {
+            reader = only_reader(c, c.subgraph.operators[reader]->outputs[0]);
+        }
+        if (reader < 0 || c.folded[reader] ||
+            op_code(c, *c.subgraph.operators[reader]) != tflite::BuiltinOperator_FULLY_CONNECTED ||
+            elements(tensor(c, op.outputs[0])) > ESP_NN_GLOBAL_AVG_POOL_FC_MAX_CHANNELS) {
+            continue;
+        }
+        c.classifier[i] = reader;
+        c.folded[reader] = true;
+    }
+}
+
+// A float RGB input read only by a convolution is never materialised: the convolution takes the pixels and
+// the normalisation is folded into its weights. Int8 inputs keep the table, its rounding is not linear
+static void fold_normalisation(compiler_t& c) {
+    c.rgb_conv = -1;
+    const tflite::TensorT& in = tensor(c, c.input);
+    if (in.type != tflite::TensorType_FLOAT32 || in.shape[3] != 3) return;
+    const int reader = only_reader(c, c.input);
+    if (reader < 0 || c.folded[reader]) return;
+    const tflite::OperatorT& op = *c.subgraph.operators[reader];
+    if (op_code(c, op) == tflite::BuiltinOperator_CONV_2D && op.inputs[0] == c.input &&
+        tensor(c, op.outputs[0]).type == tflite::TensorType_FLOAT32) {
+        c.rgb_conv = reader;
+    }
+}
+
+// Tensor a step writes, the one of the max pool or fully connected fused into it if any
+static int step_output(const compiler_t& c, int step) {
+    const int fused = c.pooled[step] >= 0 ? c.pooled[step] : c.classifier[step];
+    return c.alias[c.subgraph.operators[fused >= 0 ? fused : step]->outputs[0]];
+}
+
+// Greedy first fit of the largest tensors first, like the TFLite Micro planner, but at compile time
+static size_t plan_arena(compiler_t& c) {
+    const int n = c.subgraph.operators.size();
+    auto find = [&c](int t) {
+        for (value_t& v : c.values) {
+            if (v.tensor == t) return &v;
+        }
+        return static_cast<value_t*>(nullptr);
+    };
+    auto add = [&c](int t, int step) {
+        const tflite::TensorT& info = tensor(c, t);
+        c.values.push_back({t, elements(info) * element_size(info.type), step, step, 0});
+    };
+
+    if (c.rgb_conv < 0) add(c.input, -1);
+    for (int i = 0; i < n; ++i) {
+        if (c.folded[i]) continue;
+        const tflite::OperatorT& op = *c.subgraph.operators[i];
+        for (int32_t index : op.inputs) {
+            if (index < 0 || is_const(c, index)) continue;
+            if (value_t* v = find(c.alias[index])) v->last = i;
+        }
+        const int out = step_output(c, i);
+        // Float logits are written straight to the caller's array
+        if (out == c.logits && tensor(c, out).type == tflite::TensorType_FLOAT32) continue;
+        add(out, i);
+    }
+    if (value_t* v = find(c.logits)) v->last = n;
+
+    std::vector<value_t*> order;
+    for (value_t& v : c.values) order.push_back(&v);
+    std::sort(order.begin(), order.end(), [](const value_t* a, const value_t* b) {
+        return a->bytes != b->bytes ? a->bytes > b->bytes : a->first < b->first;
+    });
+    size_t arena = 0;
+    std::vector<const value_t*> placed;
+    for (value_t* v : order) {
+        size_t offset = 0;
+        bool moved = true;
+        while (moved) {
+            moved = false;
+            for (const value_t* p : placed) {
+                const bool live_together = v->first <= p->last && p->first <= v->last;
+                if (live_together && offset < p->offset + p->bytes && p->offset < offset + v->bytes) {
+                    offset = (p->offset + p->bytes + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+                    moved = true;
+                }
+            }
+        }
+        v->offset = offset;
+        placed.push_back(v);
+        arena = std::max(arena, offset + v->bytes);
+    }
+    return (arena + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+// Table of the model input value of every 8 bit pixel
+static void emit_input_table(compiler_t& c) {
+    const tflite::TensorT& in = tensor(c, c.input);
+    std::vector<float> normalised(256);
+    for (int p = 0; p < 256; ++p) {
+        normalised[p] = (p / 255.0f - c.options.input_mean) / c.options.input_std;
+    }
+    if (in.type == tflite::TensorType_FLOAT32) {
+        emit_array(c, "float", "input_table", normalised, float_literal);
+        return;
+    }
+    std::vector<int8_t> table(256);
+    for (int p = 0; p < 256; ++p) {
+        const int32_t q = zero_point(in) + static_cast<int32_t>(round(normalised[p] / scale(in)));
+        table[p] = static_cast<int8_t>(std::min(std::max(q, -128), 127));
+    }
+    emit_array(c, "int8_t", "input_table", table, int8_literal);
+}
+
+bool model_compile(tflite::ModelT& model, const model_compiler_options_t& options, std::string* header,
+                   std::string* source, model_compiler_stats_t* stats, std::string* error) {
+    *stats = {};
+    graph_optimizer_options_t optimizer_options;
+    graph_optimizer_stats_t optimizer_stats;
+    graph_optimize(model, optimizer_options, &optimizer_stats);
+
+    if (model.subgraphs.size() != 1 || model.subgraphs[0]->inputs.size() != 1 ||
+        model.subgraphs[0]->outputs.size() != 1) {
+        *error = "only models of one subgraph with one input and one output compile";
+        return false;
+    }
+    compiler_t c = {model, *model.subgraphs[0], options, *stats, error};
+    if (!fold_edges(c)) return false;
+    fuse_max_pools(c);
+    fuse_classifier(c);
+    fold_normalisation(c);
+    const size_t activations = plan_arena(c);
+    stats->arena_bytes = activations;
+    if (c.rgb_conv < 0) emit_input_table(c);
+
+    const tflite::TensorT& in = tensor(c, c.input);
+    const tflite::TensorT& logits = tensor(c, c.logits);
+    const bool float_logits = logits.type == tflite::TensorType_FLOAT32;
+    const int pixels = elements(in);
+    if (c.rgb_conv < 0) {
+        c.body += format("    aot_input<%d>(rgb, input_table, %s);\n", pixels, ref(c, c.input).c_str());
+    }
+
+    for (size_t i = 0; i < c.subgraph.operators.size(); ++i) {
+        if (c.folded[i]) continue;
+        const tflite::OperatorT& op = *c.subgraph.operators[i];
+        const BuiltinOperator code = op_code(c, op);
+        bool ok;
+        switch (code) {
+            case tflite::BuiltinOperator_CONV_2D:
+                ok = emit_conv(c, op, i);
+                break;
+            case tflite::BuiltinOperator_MAX_POOL_2D:
+                ok = emit_max_pool(c, op);
+                break;
+            case tflite::BuiltinOperator_MEAN:
+                ok = emit_mean(c, op, i);
+                break;
+            case tflite::BuiltinOperator_FULLY_CONNECTED:
+                ok = emit_fully_connected(c, op, nullptr);
+                break;
+            default:
+                return fail(c, format("no kernel for %s", tflite::EnumNameBuiltinOperator(code)));
+        }
+        if (!ok) return false;
+        stats->kernels++;
+    }
+    if (!float_logits) {
+        c.body += format("    aot_dequantize<%d>(%s, logits, %d, %s);\n", elements(logits), ref(c, c.logits).c_str(),
+                         (int)zero_point(logits), float_literal(scale(logits)).c_str());
+    }
+
+    const std::string prefix = upper(options.name);
+    const std::string guard = prefix + "_AOT_H";
+    *header = "// Generated by tools/model_compiler, do not edit\n";
+    *header += "#ifndef " + guard + "\n#define " + guard + "\n\n";
+    *header += "#include <stddef.h>\n#include <stdint.h>\n\n";
+    *header += format("#define %s_INPUT_HEIGHT %d\n", prefix.c_str(), in.shape[1]);
+    *header += format("#define %s_INPUT_WIDTH %d\n", prefix.c_str(), in.shape[2]);
+    *header += format("#define %s_INPUT_CHANNELS %d\n", prefix.c_str(), in.shape[3]);
+    *header += format("#define %s_OUTPUTS %d\n\n", prefix.c_str(), elements(logits));
+    *header += "// Bytes of the arena predict() works in, activations and esp-nn scratch\n";
+    *header += format("size_t %s_arena_size();\n", options.name.c_str());
+    *header += format("// rgb is the %dx%d HWC image, pixel p stands for (p / 255 - %g) / %g. Writes %s_OUTPUTS logits,\n",
+                      in.shape[2], in.shape[1], options.input_mean, options.input_std, prefix.c_str());
+    *header += "// the arena is 16 byte aligned and arena_size() bytes long\n";
+    *header += format("void %s_predict(const uint8_t* rgb, float* logits, uint8_t* arena);\n\n", options.name.c_str());
+    *header += "#endif // " + guard + "\n";
+
+    *source = "// Generated by tools/model_compiler, do not edit\n";
+    *source += "#include \"" + options.name + "_aot.h\"\n";
+    *source += "#include <float.h>\n";
+    *source += "#include \"aot_kernels.h\"\n\n";
+    *source += format("#define ACTIVATION_BYTES %u\n\n", (unsigned)activations);
+    *source += c.constants;
+    *source += format("size_t %s_arena_size() {\n", options.name.c_str());
+    if (c.needs_scratch) {
+        *source += "    int scratch = 0;\n" + c.scratch_sizes;
+        *source += format("    return ACTIVATION_BYTES + ((scratch + %d) & ~%d);\n", ARENA_ALIGN - 1, ARENA_ALIGN - 1);
+    } else {
+        *source += "    return ACTIVATION_BYTES;\n";
+    }
+    *source += "}\n\n";
+    *source += format("void %s_predict(const uint8_t* rgb, float* logits, uint8_t* arena) {\n", options.name.c_str());
+    for (const value_t& v : c.values) {
+        const char* type = tensor(c, v.tensor).type == tflite::TensorType_FLOAT32 ? "float" : "int8_t";
+        *source += format("    %s* t%d = reinterpret_cast<%s*>(arena + %u);\n", type, v.tensor, type,
+                          (unsigned)v.offset);
+    }
+    if (c.needs_scratch) *source += "    void* scratch = arena + ACTIVATION_BYTES;\n";
+    *source += "\n" + c.body + "}\n";
+    return true;
+}
@@ -0,0 +1,35 @@
+#ifndef MODEL_COMPILER_H
+#define MODEL_COMPILER_H
+
+#include <stddef.h>
+#include <string>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+struct model_compiler_options_t {
+    std::string name = "sign_model";  // prefix of the generated functions, macros and files
+    // A pixel p of the RGB input stands for (p / 255 - mean) / std, as the detector normalises it
+    float input_mean = 0.5f;
+    float input_std = 0.5f;
+    // 3x3 stride 1 int8 convolutions as Winograd F(2x2, 3x3): 2.25x fewer multiplies, filters grow from 9
+    // bytes to 16 int16 per input and output channel pair
+    bool winograd = true;
+};
+
+struct model_compiler_stats_t {
+    int kernels = 0;            // kernel calls in the generated predict()
+    size_t weight_bytes = 0;    // constant data, quantization parameters included
+    size_t arena_bytes = 0;     // activations of the static buffer plan, esp-nn scratch excluded
+};
+
+// Turns a one subgraph model into C++ with <name>_predict(rgb, logits, arena). The layout Transposes and Pads
+// are removed first, then every operator becomes a direct call with its shapes as template arguments:
+// the kernels of main/aot_kernels.h, which forward to esp-nn. An int8 convolution read only by a max pool runs
+// fused with it, 3x3 stride 1 ones as Winograd with the filters transformed at compile time. A Mean read only
+// by a fully connected runs with it as one classifier head kernel. A float convolution reading the input takes
+// the pixels with the normalisation folded into its weights. Activations get fixed offsets in one arena.
+// Returns false with a message in error for operators or types without a kernel.
+bool model_compile(tflite::ModelT& model, const model_compiler_options_t& options, std::string* header,
+                   std::string* source, model_compiler_stats_t* stats, std::string* error);
+
+#endif // MODEL_COMPILER_H
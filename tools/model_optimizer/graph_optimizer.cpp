@@ -0,0 +1,518 @@
+#include <stdio.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "graph_optimizer.h"
+
+using tflite::BuiltinOperator;
+
+struct graph_t {
+    tflite::ModelT& model;
+    tflite::SubGraphT& subgraph;
+    graph_optimizer_stats_t& stats;
+};
+
+static BuiltinOperator op_code(const graph_t& g, int op) {
+    const tflite::OperatorCodeT& code = *g.model.operator_codes[g.subgraph.operators[op]->opcode_index];
+    // Codes below 127 are still written to the deprecated field
+    return static_cast<BuiltinOperator>(std::max(static_cast<int32_t>(code.builtin_code),
+                                                 static_cast<int32_t>(code.deprecated_builtin_code)));
+}
+
+static tflite::TensorT& tensor(const graph_t& g, int index) {
+    return *g.subgraph.tensors[index];
+}
+
+static int producer(const graph_t& g, int tensor_index) {
+    for (size_t op = 0; op < g.subgraph.operators.size(); ++op) {
+        const std::vector<int32_t>& outputs = g.subgraph.operators[op]->outputs;
+        if (std::find(outputs.begin(), outputs.end(), tensor_index) != outputs.end()) return op;
+    }
+    return -1;
+}
+
+static std::vector<int> consumers(const graph_t& g, int tensor_index) {
+    std::vector<int> ops;
+    for (size_t op = 0; op < g.subgraph.operators.size(); ++op) {
+        const std::vector<int32_t>& inputs = g.subgraph.operators[op]->inputs;
+        if (std::find(inputs.begin(), inputs.end(), tensor_index) != inputs.end()) ops.push_back(op);
+    }
+    return ops;
+}
+
+static bool is_graph_input(const graph_t& g, int tensor_index) {
+    return std::find(g.subgraph.inputs.begin(), g.subgraph.inputs.end(), tensor_index) != g.subgraph.inputs.end();
+}
+
+static bool is_graph_output(const graph_t& g, int tensor_index) {
+    return std::find(g.subgraph.outputs.begin(), g.subgraph.outputs.end(), tensor_index) != g.subgraph.outputs.end();
+}
+
+// Only the op reading it sees the tensor, so its layout and shape can change with that op
+static bool single_use(const graph_t& g, int tensor_index) {
+    return consumers(g, tensor_index).size() == 1 && !is_graph_output(g, tensor_index);
+}
+
+static size_t tensor_bytes(const tflite::TensorT& t) {
+    size_t elements = 1;
+    for (int32_t dim : t.shape) elements *= dim;
+    switch (t.type) {
+        case tflite::TensorType_FLOAT32:
+        case tflite::TensorType_INT32:
+            return elements * 4;
+        case tflite::TensorType_INT16:
+        case tflite::TensorType_FLOAT16:
+            return elements * 2;
+        case tflite::TensorType_INT64:
+            return elements * 8;
+        default:
+            return elements;
+    }
+}
+
+static bool const_ints(const graph_t& g, int tensor_index, std::vector<int32_t>* values) {
+    const tflite::TensorT& t = tensor(g, tensor_index);
+    const std::vector<uint8_t>& data = g.model.buffers[t.buffer]->data;
+    if (data.empty()) return false;
+
+    values->clear();
+    if (t.type == tflite::TensorType_INT32) {
+        values->resize(data.size() / sizeof(int32_t));
+        memcpy(values->data(), data.data(), values->size() * sizeof(int32_t));
+    } else if (t.type == tflite::TensorType_INT64) {
+        std::vector<int64_t> wide(data.size() / sizeof(int64_t));
+        memcpy(wide.data(), data.data(), wide.size() * sizeof(int64_t));
+        values->assign(wide.begin(), wide.end());
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Constants are shared between ops, a rewritten op gets its own
+static int add_const_ints(graph_t& g, const std::string& name, const std::vector<int32_t>& shape,
+                          const std::vector<int32_t>& values) {
+    auto buffer = std::make_unique<tflite::BufferT>();
+    buffer->data.resize(values.size() * sizeof(int32_t));
+    memcpy(buffer->data.data(), values.data(), buffer->data.size());
+    g.model.buffers.push_back(std::move(buffer));
+
+    auto t = std::make_unique<tflite::TensorT>();
+    t->shape = shape;
+    t->type = tflite::TensorType_INT32;
+    t->buffer = g.model.buffers.size() - 1;
+    t->name = name;
+    g.subgraph.tensors.push_back(std::move(t));
+    return g.subgraph.tensors.size() - 1;
+}
+
+static bool per_axis_quantized(const tflite::TensorT& t) {
+    return t.quantization && t.quantization->scale.size() > 1;
+}
+
+static std::unique_ptr<tflite::QuantizationParametersT> copy_quantization(
+        const std::unique_ptr<tflite::QuantizationParametersT>& q) {
+    if (!q) return nullptr;
+    auto copy = std::make_unique<tflite::QuantizationParametersT>();
+    copy->min = q->min;
+    copy->max = q->max;
+    copy->scale = q->scale;
+    copy->zero_point = q->zero_point;
+    copy->quantized_dimension = q->quantized_dimension;
+    return copy;
+}
+
+// out[i] = in[perm[i]], the shape a Transpose with perm produces
+static std::vector<int32_t> permute(const std::vector<int32_t>& in, const std::vector<int32_t>& perm) {
+    std::vector<int32_t> out(perm.size());
+    for (size_t i = 0; i < perm.size(); ++i) out[i] = in[perm[i]];
+    return out;
+}
+
+static bool valid_perm(const std::vector<int32_t>& perm, size_t rank) {
+    if (perm.size() != rank) return false;
+    std::vector<bool> seen(rank, false);
+    for (int32_t axis : perm) {
+        if (axis < 0 || axis >= (int32_t)rank || seen[axis]) return false;
+        seen[axis] = true;
+    }
+    return true;
+}
+
+static void replace_uses(graph_t& g, int from, int to) {
+    for (auto& op : g.subgraph.operators) {
+        std::replace(op->inputs.begin(), op->inputs.end(), from, to);
+    }
+    std::replace(g.subgraph.outputs.begin(), g.subgraph.outputs.end(), from, to);
+}
+
+static void remove_op(graph_t& g, int op) {
+    const BuiltinOperator code = op_code(g, op);
+    const tflite::TensorT& out = tensor(g, g.subgraph.operators[op]->outputs[0]);
+    printf("  removed %s -> %s (%zu bytes)\n", tflite::EnumNameBuiltinOperator(code), out.name.c_str(),
+           tensor_bytes(out));
+    g.stats.removed_bytes += tensor_bytes(out);
+    if (code == tflite::BuiltinOperator_TRANSPOSE) g.stats.removed_transpose++;
+    if (code == tflite::BuiltinOperator_PAD) g.stats.removed_pad++;
+    g.subgraph.operators.erase(g.subgraph.operators.begin() + op);
+}
+
+static bool transpose_perm(const graph_t& g, int op, std::vector<int32_t>* perm) {
+    const tflite::OperatorT& transpose = *g.subgraph.operators[op];
+    return op_code(g, op) == tflite::BuiltinOperator_TRANSPOSE && const_ints(g, transpose.inputs[1], perm) &&
+           valid_perm(*perm, tensor(g, transpose.inputs[0]).shape.size());
+}
+
+// Ops that treat every element alike, a Transpose after them can run before them
+static bool layout_agnostic(BuiltinOperator code) {
+    switch (code) {
+        case tflite::BuiltinOperator_PAD:
+        case tflite::BuiltinOperator_PADV2:
+        case tflite::BuiltinOperator_QUANTIZE:
+        case tflite::BuiltinOperator_DEQUANTIZE:
+        case tflite::BuiltinOperator_RELU:
+        case tflite::BuiltinOperator_RELU6:
+        case tflite::BuiltinOperator_LOGISTIC:
+        case tflite::BuiltinOperator_TANH:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// op(x) -> y, Transpose(y) -> z becomes Transpose(x) -> y, op(y) -> z. Moves the Transposes of the
+// converter towards the one that undoes them and the graph input, and leaves Pads next to convolutions
+static bool hoist_transpose(graph_t& g) {
+    for (size_t j = 0; j < g.subgraph.operators.size(); ++j) {
+        std::vector<int32_t> perm;
+        if (!transpose_perm(g, j, &perm)) continue;
+        tflite::OperatorT& transpose = *g.subgraph.operators[j];
+        const int y = transpose.inputs[0];
+        const int i = producer(g, y);
+        if (i < 0 || !layout_agnostic(op_code(g, i)) || !single_use(g, y)) continue;
+
+        tflite::OperatorT& op = *g.subgraph.operators[i];
+        const int x = op.inputs[0];
+        const int z = transpose.outputs[0];
+        if (per_axis_quantized(tensor(g, x)) || per_axis_quantized(tensor(g, y))) continue;
+
+        const BuiltinOperator code = op_code(g, i);
+        if (code == tflite::BuiltinOperator_PAD || code == tflite::BuiltinOperator_PADV2) {
+            std::vector<int32_t> paddings;
+            if (!const_ints(g, op.inputs[1], &paddings) || paddings.size() != 2 * perm.size()) continue;
+            std::vector<int32_t> permuted(paddings.size());
+            for (size_t k = 0; k < perm.size(); ++k) {
+                permuted[2 * k] = paddings[2 * perm[k]];
+                permuted[2 * k + 1] = paddings[2 * perm[k] + 1];
+            }
+            op.inputs[1] = add_const_ints(g, tensor(g, op.inputs[1]).name + "/transposed",
+                                          {(int32_t)perm.size(), 2}, permuted);
+        }
+
+        // y now holds x transposed
+        tflite::TensorT& ty = tensor(g, y);
+        const tflite::TensorT& tx = tensor(g, x);
+        ty.shape = permute(tx.shape, perm);
+        ty.shape_signature = tx.shape_signature.empty() ? std::vector<int32_t>() : permute(tx.shape_signature, perm);
+        ty.type = tx.type;
+        ty.quantization = copy_quantization(tx.quantization);
+        std::swap(ty.name, tensor(g, z).name);
+
+        transpose.inputs[0] = x;
+        transpose.outputs[0] = y;
+        op.inputs[0] = y;
+        op.outputs[0] = z;
+        std::swap(g.subgraph.operators[i], g.subgraph.operators[j]);
+        printf("  moved TRANSPOSE before %s\n", tflite::EnumNameBuiltinOperator(code));
+        return true;
+    }
+    return false;
+}
+
+// Transpose(x) -> y, Transpose(y) -> z with z laid out like x, readers of z read x
+static bool cancel_transposes(graph_t& g) {
+    for (size_t j = 0; j < g.subgraph.operators.size(); ++j) {
+        std::vector<int32_t> second;
+        if (!transpose_perm(g, j, &second)) continue;
+        const int y = g.subgraph.operators[j]->inputs[0];
+        const int i = producer(g, y);
+        std::vector<int32_t> first;
+        if (i < 0 || !transpose_perm(g, i, &first) || !single_use(g, y)) continue;
+
+        const int x = g.subgraph.operators[i]->inputs[0];
+        const int z = g.subgraph.operators[j]->outputs[0];
+        bool identity = first.size() == second.size();
+        for (size_t k = 0; identity && k < second.size(); ++k) {
+            identity = first[second[k]] == (int32_t)k;
+        }
+        if (!identity || is_graph_output(g, z)) continue;
+
+        replace_uses(g, z, x);
+        remove_op(g, j);
+        remove_op(g, i);
+        return true;
+    }
+    return false;
+}
+
+// A Transpose of a graph input is left to whoever fills the input
+static bool fold_input_transpose(graph_t& g) {
+    for (size_t j = 0; j < g.subgraph.operators.size(); ++j) {
+        std::vector<int32_t> perm;
+        if (!transpose_perm(g, j, &perm)) continue;
+        const int x = g.subgraph.operators[j]->inputs[0];
+        const int z = g.subgraph.operators[j]->outputs[0];
+        if (!is_graph_input(g, x) || !single_use(g, x) || is_graph_output(g, z)) continue;
+
+        tflite::TensorT& tx = tensor(g, x);
+        tx.shape = permute(tx.shape, perm);
+        if (!tx.shape_signature.empty()) tx.shape_signature = permute(tx.shape_signature, perm);
+
+        replace_uses(g, z, x);
+        remove_op(g, j);
+        printf("  input %s is now [", tx.name.c_str());
+        for (size_t k = 0; k < tx.shape.size(); ++k) printf(k ? ", %d" : "%d", (int)tx.shape[k]);
+        printf("]\n");
+        return true;
+    }
+    return false;
+}
+
+static bool is_reduction(BuiltinOperator code) {
+    return code == tflite::BuiltinOperator_MEAN || code == tflite::BuiltinOperator_SUM ||
+           code == tflite::BuiltinOperator_REDUCE_MAX || code == tflite::BuiltinOperator_REDUCE_MIN;
+}
+
+// Transpose(x) -> y, Mean(y, axes) -> z reduces x directly when the axes left over keep their
+// order, z then holds the same elements in the same order and only Reshapes may read it
+static bool fold_transpose_into_reduction(graph_t& g) {
+    for (size_t j = 0; j < g.subgraph.operators.size(); ++j) {
+        if (!is_reduction(op_code(g, j))) continue;
+        tflite::OperatorT& reduce = *g.subgraph.operators[j];
+        const int y = reduce.inputs[0];
+        const int z = reduce.outputs[0];
+        const int i = producer(g, y);
+        std::vector<int32_t> perm;
+        std::vector<int32_t> axes;
+        if (i < 0 || !transpose_perm(g, i, &perm) || !single_use(g, y) || !const_ints(g, reduce.inputs[1], &axes) ||
+            is_graph_output(g, z)) {
+            continue;
+        }
+        const std::vector<int> readers = consumers(g, z);
+        if (!std::all_of(readers.begin(), readers.end(),
+                         [&g](int op) { return op_code(g, op) == tflite::BuiltinOperator_RESHAPE; })) {
+            continue;
+        }
+
+        const int rank = perm.size();
+        std::vector<bool> reduced(rank, false);
+        for (int32_t axis : axes) reduced[axis < 0 ? axis + rank : axis] = true;
+        const std::vector<int32_t>& y_shape = tensor(g, y).shape;
+        int last = -1;
+        bool ordered = true;
+        for (int k = 0; k < rank && ordered; ++k) {
+            if (reduced[k] || y_shape[k] == 1) continue;
+            ordered = perm[k] > last;
+            last = perm[k];
+        }
+        if (!ordered) continue;
+
+        const int x = g.subgraph.operators[i]->inputs[0];
+        const std::vector<int32_t> x_shape = tensor(g, x).shape;
+        std::vector<int32_t> new_axes;
+        for (int k = 0; k < rank; ++k) {
+            if (reduced[k]) new_axes.push_back(perm[k]);
+        }
+        std::sort(new_axes.begin(), new_axes.end());
+
+        const tflite::ReducerOptionsT* options = reduce.builtin_options.AsReducerOptions();
+        const bool keep_dims = options && options->keep_dims;
+        std::vector<int32_t> z_shape;
+        for (int k = 0; k < rank; ++k) {
+            const bool axis_reduced = std::find(new_axes.begin(), new_axes.end(), k) != new_axes.end();
+            if (!axis_reduced) {
+                z_shape.push_back(x_shape[k]);
+            } else if (keep_dims) {
+                z_shape.push_back(1);
+            }
+        }
+        tensor(g, z).shape = z_shape;
+        tensor(g, z).shape_signature.clear();
+
+        reduce.inputs[0] = x;
+        reduce.inputs[1] = add_const_ints(g, tensor(g, reduce.inputs[1]).name + "/transposed",
+                                          {(int32_t)new_axes.size()}, new_axes);
+        remove_op(g, i);
+        return true;
+    }
+    return false;
+}
+
+// Padding of one spatial dimension that SAME padding of the convolution would add
+static bool same_padding(int in, int out, int filter, int stride, int dilation, int before, int after) {
+    const int effective_filter = (filter - 1) * dilation + 1;
+    if (out != (in + stride - 1) / stride) return false;
+    const int total = std::max((out - 1) * stride + effective_filter - in, 0);
+    return before == total / 2 && after == total - total / 2;
+}
+
+// Pad(x) -> y, Conv2D(y, VALID) -> z becomes Conv2D(x, SAME) -> z when the Pad adds exactly the
+// SAME padding. Pad fills with the zero point, quantized convolutions pad with it too
+static bool merge_pad_into_conv(graph_t& g) {
+    for (size_t j = 0; j < g.subgraph.operators.size(); ++j) {
+        const BuiltinOperator code = op_code(g, j);
+        if (code != tflite::BuiltinOperator_CONV_2D && code != tflite::BuiltinOperator_DEPTHWISE_CONV_2D) continue;
+        tflite::OperatorT& conv = *g.subgraph.operators[j];
+        const int y = conv.inputs[0];
+        const int i = producer(g, y);
+        std::vector<int32_t> paddings;
+        if (i < 0 || op_code(g, i) != tflite::BuiltinOperator_PAD || !single_use(g, y) ||
+            !const_ints(g, g.subgraph.operators[i]->inputs[1], &paddings) || paddings.size() != 8) {
+            continue;
+        }
+
+        tflite::Padding* padding;
+        int stride_h, stride_w, dilation_h, dilation_w;
+        if (code == tflite::BuiltinOperator_CONV_2D) {
+            tflite::Conv2DOptionsT* options = conv.builtin_options.AsConv2DOptions();
+            if (!options) continue;
+            padding = &options->padding;
+            stride_h = options->stride_h;
+            stride_w = options->stride_w;
+            dilation_h = options->dilation_h_factor;
+            dilation_w = options->dilation_w_factor;
+        } else {
+            tflite::DepthwiseConv2DOptionsT* options = conv.builtin_options.AsDepthwiseConv2DOptions();
+            if (!options) continue;
+            padding = &options->padding;
+            stride_h = options->stride_h;
+            stride_w = options->stride_w;
+            dilation_h = options->dilation_h_factor;
+            dilation_w = options->dilation_w_factor;
+        }
+
+        const int x = g.subgraph.operators[i]->inputs[0];
+        const std::vector<int32_t>& in = tensor(g, x).shape;
+        const std::vector<int32_t>& out = tensor(g, conv.outputs[0]).shape;
+        // Filters are [out, h, w, in] for Conv2D and [1, h, w, out] for DepthwiseConv2D
+        const std::vector<int32_t>& filter = tensor(g, conv.inputs[1]).shape;
+        if (*padding != tflite::Padding_VALID || in.size() != 4 || out.size() != 4 || filter.size() != 4 ||
+            paddings[0] || paddings[1] || paddings[6] || paddings[7] ||
+            !same_padding(in[1], out[1], filter[1], stride_h, dilation_h, paddings[2], paddings[3]) ||
+            !same_padding(in[2], out[2], filter[2], stride_w, dilation_w, paddings[4], paddings[5])) {
+            continue;
+        }
+
+        *padding = tflite::Padding_SAME;
+        conv.inputs[0] = x;
+        remove_op(g, i);
+        return true;
+    }
+    return false;
+}
+
+// Drops tensors no op or signature refers to, then unused buffers and operator codes
+static void compact(tflite::ModelT& model) {
+    for (size_t s = 0; s < model.subgraphs.size(); ++s) {
+        tflite::SubGraphT& subgraph = *model.subgraphs[s];
+        std::vector<bool> used(subgraph.tensors.size(), false);
+        auto mark = [&used](const std::vector<int32_t>& indices) {
+            for (int32_t index : indices) {
+                if (index >= 0) used[index] = true;
+            }
+        };
+        mark(subgraph.inputs);
+        mark(subgraph.outputs);
+        for (const auto& op : subgraph.operators) {
+            mark(op->inputs);
+            mark(op->outputs);
+            mark(op->intermediates);
+        }
+
+        std::vector<int32_t> remap(subgraph.tensors.size(), -1);
+        std::vector<std::unique_ptr<tflite::TensorT>> tensors;
+        for (size_t t = 0; t < subgraph.tensors.size(); ++t) {
+            if (!used[t]) continue;
+            remap[t] = tensors.size();
+            tensors.push_back(std::move(subgraph.tensors[t]));
+        }
+        subgraph.tensors = std::move(tensors);
+
+        auto apply = [&remap](std::vector<int32_t>& indices) {
+            for (int32_t& index : indices) {
+                if (index >= 0) index = remap[index];
+            }
+        };
+        apply(subgraph.inputs);
+        apply(subgraph.outputs);
+        for (auto& op : subgraph.operators) {
+            apply(op->inputs);
+            apply(op->outputs);
+            apply(op->intermediates);
+        }
+        for (auto& signature : model.signature_defs) {
+            if (signature->subgraph_index != s) continue;
+            for (auto& map : signature->inputs) map->tensor_index = remap[map->tensor_index];
+            for (auto& map : signature->outputs) map->tensor_index = remap[map->tensor_index];
+        }
+    }
+
+    // Buffer 0 stays the empty buffer of tensors without data
+    std::vector<bool> used_buffers(model.buffers.size(), false);
+    used_buffers[0] = true;
+    for (const auto& subgraph : model.subgraphs) {
+        for (const auto& t : subgraph->tensors) used_buffers[t->buffer] = true;
+    }
+    for (const auto& metadata : model.metadata) used_buffers[metadata->buffer] = true;
+    for (int32_t buffer : model.metadata_buffer) used_buffers[buffer] = true;
+
+    std::vector<int32_t> buffer_remap(model.buffers.size(), -1);
+    std::vector<std::unique_ptr<tflite::BufferT>> buffers;
+    for (size_t b = 0; b < model.buffers.size(); ++b) {
+        if (!used_buffers[b]) continue;
+        buffer_remap[b] = buffers.size();
+        buffers.push_back(std::move(model.buffers[b]));
+    }
+    model.buffers = std::move(buffers);
+    for (auto& subgraph : model.subgraphs) {
+        for (auto& t : subgraph->tensors) t->buffer = buffer_remap[t->buffer];
+    }
+    for (auto& metadata : model.metadata) metadata->buffer = buffer_remap[metadata->buffer];
+    for (int32_t& buffer : model.metadata_buffer) buffer = buffer_remap[buffer];
+
+    std::vector<bool> used_codes(model.operator_codes.size(), false);
+    for (const auto& subgraph : model.subgraphs) {
+        for (const auto& op : subgraph->operators) used_codes[op->opcode_index] = true;
+    }
+    std::vector<uint32_t> code_remap(model.operator_codes.size(), 0);
+    std::vector<std::unique_ptr<tflite::OperatorCodeT>> codes;
+    for (size_t c = 0; c < model.operator_codes.size(); ++c) {
+        if (!used_codes[c]) continue;
+        code_remap[c] = codes.size();
+        codes.push_back(std::move(model.operator_codes[c]));
+    }
+    model.operator_codes = std::move(codes);
+    for (auto& subgraph : model.subgraphs) {
+        for (auto& op : subgraph->operators) op->opcode_index = code_remap[op->opcode_index];
+    }
+}
+
+void graph_optimize(tflite::ModelT& model, const graph_optimizer_options_t& options, graph_optimizer_stats_t* stats) {
+    *stats = {};
+    for (auto& subgraph : model.subgraphs) {
+        graph_t g = {model, *subgraph, *stats};
+        stats->ops_before += subgraph->operators.size();
+
+        // Every rewrite removes an op or moves a Transpose one op closer to the inputs
+        bool changed = true;
+        while (changed) {
+            changed = hoist_transpose(g) || cancel_transposes(g) ||
+                      (options.fold_input_transpose && fold_input_transpose(g)) ||
+                      fold_transpose_into_reduction(g) || merge_pad_into_conv(g);
+        }
+        stats->ops_after += subgraph->operators.size();
+    }
+    compact(model);
+}
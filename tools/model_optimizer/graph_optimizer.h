@@ -0,0 +1,25 @@
+#ifndef GRAPH_OPTIMIZER_H
+#define GRAPH_OPTIMIZER_H
+
+#include <stddef.h>
+
+#include "tensorflow/lite/schema/schema_generated.h"
+
+struct graph_optimizer_options_t {
+    // Let a graph input take the layout of the Transpose that reads it, changes the model interface
+    bool fold_input_transpose = true;
+};
+
+struct graph_optimizer_stats_t {
+    int ops_before = 0;
+    int ops_after = 0;
+    int removed_transpose = 0;
+    int removed_pad = 0;
+    size_t removed_bytes = 0;  // activation bytes the removed ops wrote per Invoke()
+};
+
+// Removes the layout Transposes and explicit Pads the ONNX to TFLite conversion leaves around
+// convolutions, drops the tensors, buffers and operator codes nothing refers to anymore
+void graph_optimize(tflite::ModelT& model, const graph_optimizer_options_t& options, graph_optimizer_stats_t* stats);
+
+#endif // GRAPH_OPTIMIZER_H
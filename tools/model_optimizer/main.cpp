@@ -0,0 +1,101 @@
+// Host tool that removes the layout conversion ops of the sign model
+//   model_optimizer <in.tflite> <out.tflite> [--source <out.cc>] [--name <array>] [--keep-input-layout]
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "graph_optimizer.h"
+
+#define BYTES_PER_LINE 12
+
+static bool read_file(const char* path, std::vector<uint8_t>* data) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    data->assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool write_file(const char* path, const uint8_t* data, size_t size) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data), size);
+    return static_cast<bool>(file);
+}
+
+// Same layout as main/sign_model.cc so the output replaces it as is
+static bool write_source(const char* path, const char* name, const uint8_t* data, size_t size) {
+    FILE* file = fopen(path, "w");
+    if (!file) return false;
+    fprintf(file, "#include <cstddef>\n\n");
+    fprintf(file, "alignas(16) unsigned char %s[] __attribute__((section(\".rodata\"))) = {\n", name);
+    for (size_t i = 0; i < size; ++i) {
+        if (i % BYTES_PER_LINE == 0) fprintf(file, "  ");
+        fprintf(file, "0x%02x", data[i]);
+        if (i + 1 < size) fprintf(file, (i % BYTES_PER_LINE == BYTES_PER_LINE - 1) ? ",\n" : ", ");
+    }
+    fprintf(file, "\n};\n\nunsigned int %s_len = sizeof(%s);\n", name, name);
+    return fclose(file) == 0;
+}
+
+static void usage(const char* program) {
+    fprintf(stderr, "usage: %s <in.tflite> <out.tflite> [--source <out.cc>] [--name <array>] [--keep-input-layout]\n",
+            program);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char* in_path = argv[1];
+    const char* out_path = argv[2];
+    const char* source_path = nullptr;
+    const char* array_name = "sign_model_tflite";
+    graph_optimizer_options_t options;
+    for (int i = 3; i < argc; ++i) {
+        if (!strcmp(argv[i], "--source") && i + 1 < argc) {
+            source_path = argv[++i];
+        } else if (!strcmp(argv[i], "--name") && i + 1 < argc) {
+            array_name = argv[++i];
+        } else if (!strcmp(argv[i], "--keep-input-layout")) {
+            options.fold_input_transpose = false;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> data;
+    if (!read_file(in_path, &data)) {
+        fprintf(stderr, "Failed to read %s\n", in_path);
+        return 1;
+    }
+    flatbuffers::Verifier verifier(data.data(), data.size());
+    if (!tflite::VerifyModelBuffer(verifier)) {
+        fprintf(stderr, "%s is not a TFLite model\n", in_path);
+        return 1;
+    }
+
+    std::unique_ptr<tflite::ModelT> model = tflite::UnPackModel(data.data());
+    printf("%s\n", in_path);
+    graph_optimizer_stats_t stats;
+    graph_optimize(*model, options, &stats);
+
+    flatbuffers::FlatBufferBuilder builder;
+    tflite::FinishModelBuffer(builder, tflite::Model::Pack(builder, model.get()));
+    if (!write_file(out_path, builder.GetBufferPointer(), builder.GetSize())) {
+        fprintf(stderr, "Failed to write %s\n", out_path);
+        return 1;
+    }
+    if (source_path && !write_source(source_path, array_name, builder.GetBufferPointer(), builder.GetSize())) {
+        fprintf(stderr, "Failed to write %s\n", source_path);
+        return 1;
+    }
+
+    printf("%d -> %d ops, removed %d TRANSPOSE and %d PAD writing %zu activation bytes per invoke\n",
+           stats.ops_before, stats.ops_after, stats.removed_transpose, stats.removed_pad, stats.removed_bytes);
+    printf("%zu -> %u bytes written to %s\n", data.size(), (unsigned)builder.GetSize(), out_path);
+    return 0;
+}